@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <Base/FileInfo.h>
+
+#include "DocumentGenerator.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+benchmarks::DocumentSpec specFromArgs(const benchmark::State& state)
+{
+    benchmarks::DocumentSpec spec;
+    spec.objects = int(state.range(0));
+    spec.linkFanOut = int(state.range(1));
+    spec.expressionDensity = double(state.range(2)) / 100.0;
+    spec.dataSize = int(state.range(3));
+    return spec;
+}
+
+void documentArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"objects", "links", "expr%", "data"});
+    bench->Args({100, 0, 0, 0});
+    bench->Args({1000, 0, 0, 0});
+    bench->Args({1000, 4, 0, 0});
+    bench->Args({1000, 0, 50, 0});
+    bench->Args({1000, 0, 100, 0});
+    bench->Args({1000, 0, 0, 1000});
+    bench->Args({10000, 1, 10, 10});
+    bench->Unit(benchmark::kMillisecond);
+}
+
+void DocumentRecompute(benchmark::State& state)
+{
+    App::Document* doc = benchmarks::createDocument(specFromArgs(state));
+    std::vector<App::DocumentObject*> objects = doc->getObjects();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (auto obj : objects) {
+            obj->touch();
+        }
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(doc->recompute());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(objects.size()));
+
+    benchmarks::closeDocument(doc);
+}
+
+void DocumentSave(benchmark::State& state)
+{
+    App::Document* doc = benchmarks::createDocument(specFromArgs(state));
+    std::string fileName = Base::FileInfo::getTempFileName("Benchmark.FCStd");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(doc->saveCopy(fileName.c_str()));
+    }
+    Base::FileInfo file(fileName);
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(file.size()));
+
+    file.deleteFile();
+    benchmarks::closeDocument(doc);
+}
+
+void DocumentRestore(benchmark::State& state)
+{
+    std::string fileName = Base::FileInfo::getTempFileName("Benchmark.FCStd");
+    App::Document* doc = benchmarks::createDocument(specFromArgs(state));
+    doc->saveCopy(fileName.c_str());
+    benchmarks::closeDocument(doc);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        doc = benchmarks::createDocument(benchmarks::DocumentSpec {0});
+        state.ResumeTiming();
+        doc->restore(fileName.c_str());
+        state.PauseTiming();
+        benchmarks::closeDocument(doc);
+        state.ResumeTiming();
+    }
+    Base::FileInfo file(fileName);
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(file.size()));
+
+    file.deleteFile();
+}
+
+}  // namespace
+
+BENCHMARK(DocumentRecompute)->Apply(documentArgs);
+BENCHMARK(DocumentSave)->Apply(documentArgs);
+BENCHMARK(DocumentRestore)->Apply(documentArgs);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <memory>
+#include <vector>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/Expression.h>
+#include <App/FeatureTest.h>
+#include <App/Link.h>
+#include <App/ObjectIdentifier.h>
+
+#include "DocumentGenerator.h"
+
+namespace benchmarks
+{
+
+App::Document* createDocument(const DocumentSpec& spec)
+{
+    std::string name = App::GetApplication().getUniqueDocumentName("Benchmark");
+    App::Document* doc = App::GetApplication().newDocument(name.c_str(), "Benchmark");
+
+    // Spread the bound features evenly instead of placing them all at the start
+    double expressions = 0.0;
+    App::FeatureTest* prev = nullptr;
+    for (int i = 0; i < spec.objects; ++i) {
+        auto feature = static_cast<App::FeatureTest*>(doc->addObject("App::FeatureTest"));
+        if (spec.dataSize > 0) {
+            feature->FloatList.setValues(std::vector<double>(spec.dataSize, double(i)));
+        }
+
+        if (prev) {
+            feature->Link.setValue(prev);
+
+            expressions += spec.expressionDensity;
+            if (expressions >= 1.0) {
+                expressions -= 1.0;
+                std::string text = std::string(prev->getNameInDocument()) + ".Integer + 1";
+                std::shared_ptr<App::Expression> expr(App::Expression::parse(feature, text));
+                feature->setExpression(App::ObjectIdentifier(feature->Integer), expr);
+            }
+        }
+
+        for (int j = 0; j < spec.linkFanOut; ++j) {
+            auto link = static_cast<App::Link*>(doc->addObject("App::Link"));
+            link->setLink(-1, feature);
+        }
+        prev = feature;
+    }
+    return doc;
+}
+
+void closeDocument(App::Document* doc)
+{
+    App::GetApplication().closeDocument(doc->getName());
+}
+
+Data::ElementMapPtr createElementMap(const App::StringHasherRef& hasher, int faces, long tag)
+{
+    auto map = std::make_shared<Data::ElementMap>();
+    map->hasher = hasher;
+    for (const char* type : {"Face", "Edge", "Vertex"}) {
+        for (int i = 1; i <= faces; ++i) {
+            Data::IndexedName element(type, i);
+            map->setElementName(element, Data::MappedName(element), tag);
+        }
+    }
+    return map;
+}
+
+}  // namespace benchmarks
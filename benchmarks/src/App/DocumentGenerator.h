@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef BENCHMARKS_DOCUMENTGENERATOR_H
+#define BENCHMARKS_DOCUMENTGENERATOR_H
+
+#include <App/ElementMap.h>
+#include <App/StringHasher.h>
+
+namespace App
+{
+class Document;
+}
+
+namespace benchmarks
+{
+
+/// Describes the shape of a synthetic document
+struct DocumentSpec
+{
+    /// Number of App::FeatureTest objects. Each one links to its predecessor.
+    int objects = 100;
+    /// Number of App::Link objects pointing to each feature
+    int linkFanOut = 0;
+    /// Fraction (0..1) of the features whose Integer property is bound to the predecessor
+    double expressionDensity = 0.0;
+    /** Number of values in the FloatList of each feature. It stands in for the size of the
+     * geometry an object carries, which is what dominates saving and restoring real models.
+     */
+    int dataSize = 0;
+};
+
+/// Creates a new document filled as described by \a spec
+App::Document* createDocument(const DocumentSpec& spec);
+
+/// Closes a document created by createDocument()
+void closeDocument(App::Document* doc);
+
+/** Creates an element map like the one of a solid with \a faces faces, the same number of
+ * edges and vertexes. Every name is hashed by \a hasher.
+ */
+Data::ElementMapPtr createElementMap(const App::StringHasherRef& hasher, int faces, long tag);
+
+}  // namespace benchmarks
+
+#endif  // BENCHMARKS_DOCUMENTGENERATOR_H
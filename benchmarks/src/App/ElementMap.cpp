@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <App/ElementMap.h>
+#include <App/StringHasher.h>
+
+#include "DocumentGenerator.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+constexpr long tag = 1;
+
+void elementMapArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("faces");
+    bench->RangeMultiplier(10);
+    bench->Range(10, 100000);
+}
+
+void ElementMapCreate(benchmark::State& state)
+{
+    int faces = int(state.range(0));
+
+    for (auto _ : state) {
+        App::StringHasherRef hasher(new App::StringHasher);
+        benchmark::DoNotOptimize(benchmarks::createElementMap(hasher, faces, tag));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * faces * 3);
+}
+
+void ElementMapFind(benchmark::State& state)
+{
+    int faces = int(state.range(0));
+    App::StringHasherRef hasher(new App::StringHasher);
+    Data::ElementMapPtr map = benchmarks::createElementMap(hasher, faces, tag);
+    std::vector<Data::IndexedName> elements;
+    for (int i = 1; i <= faces; ++i) {
+        elements.emplace_back("Face", i);
+    }
+
+    for (auto _ : state) {
+        for (const auto& element : elements) {
+            Data::MappedName name = map->find(element);
+            benchmark::DoNotOptimize(map->find(name));
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * faces);
+}
+
+void ElementMapSaveRestore(benchmark::State& state)
+{
+    int faces = int(state.range(0));
+    App::StringHasherRef hasher(new App::StringHasher);
+    Data::ElementMapPtr map = benchmarks::createElementMap(hasher, faces, tag);
+
+    int64_t bytes = 0;
+    for (auto _ : state) {
+        std::stringstream stream;
+        map->save(stream);
+        bytes += int64_t(stream.tellp());
+        auto restored = std::make_shared<Data::ElementMap>();
+        benchmark::DoNotOptimize(restored->restore(hasher, stream));
+    }
+    state.SetBytesProcessed(bytes);
+}
+
+}  // namespace
+
+BENCHMARK(ElementMapCreate)->Apply(elementMapArgs);
+BENCHMARK(ElementMapFind)->Apply(elementMapArgs);
+BENCHMARK(ElementMapSaveRestore)->Apply(elementMapArgs);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <array>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <App/Document.h>
+#include <App/Expression.h>
+
+#include "DocumentGenerator.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+// Samples of the expressions found in real models, selected by the benchmark argument
+constexpr std::array<const char*, 5> expressions {
+    "1 + 2 * 3",
+    "10 mm + 2 in",
+    "FeatureTest.Integer * 2 + FeatureTest001.Integer",
+    "sqrt(FeatureTest001.Float ^ 2 + 4) * cos(30 deg)",
+    "FeatureTest.Integer > 10 ? FeatureTest001.Float : 1 m / 3",
+};
+
+void expressionArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("expression");
+    bench->DenseRange(0, int(expressions.size()) - 1);
+}
+
+void ExpressionParse(benchmark::State& state)
+{
+    App::Document* doc = benchmarks::createDocument(benchmarks::DocumentSpec {2});
+    App::DocumentObject* owner = doc->getObjects().back();
+    const char* text = expressions[state.range(0)];
+
+    for (auto _ : state) {
+        std::unique_ptr<App::Expression> expr(App::Expression::parse(owner, text));
+        benchmark::DoNotOptimize(expr.get());
+    }
+
+    benchmarks::closeDocument(doc);
+}
+
+void ExpressionEval(benchmark::State& state)
+{
+    App::Document* doc = benchmarks::createDocument(benchmarks::DocumentSpec {2});
+    App::DocumentObject* owner = doc->getObjects().back();
+    std::unique_ptr<App::Expression> expr(
+        App::Expression::parse(owner, expressions[state.range(0)]));
+
+    for (auto _ : state) {
+        std::unique_ptr<App::Expression> result(expr->eval());
+        benchmark::DoNotOptimize(result.get());
+    }
+
+    expr.reset();
+    benchmarks::closeDocument(doc);
+}
+
+}  // namespace
+
+BENCHMARK(ExpressionParse)->Apply(expressionArgs);
+BENCHMARK(ExpressionEval)->Apply(expressionArgs);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <App/IndexedName.h>
+#include <App/MappedName.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+/// Names like the ones of an element map, most of them share a long prefix and have a postfix
+std::vector<Data::MappedName> createNames(int count, bool postfix)
+{
+    std::vector<Data::MappedName> names;
+    names.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        std::string name = ";#" + std::to_string(i % 16) + ":1;:G;XTR;:H3c:8,F.Face"
+            + std::to_string(i);
+        if (postfix) {
+            std::string tail = ";:M;FUS;:H" + std::to_string(i % 7) + ":6,F";
+            names.emplace_back(Data::MappedName(name), tail.c_str());
+        }
+        else {
+            names.emplace_back(name);
+        }
+    }
+    return names;
+}
+
+void nameArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"names", "postfix"});
+    bench->Args({1000, 0});
+    bench->Args({100000, 0});
+    bench->Args({100000, 1});
+}
+
+void MappedNameMapInsert(benchmark::State& state)
+{
+    std::vector<Data::MappedName> names = createNames(int(state.range(0)), state.range(1) != 0);
+
+    for (auto _ : state) {
+        std::map<Data::MappedName, Data::IndexedName, std::less<>> map;
+        int index = 0;
+        for (const auto& name : names) {
+            map.emplace(name, Data::IndexedName("Face", ++index));
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(names.size()));
+}
+
+void MappedNameMapFind(benchmark::State& state)
+{
+    std::vector<Data::MappedName> names = createNames(int(state.range(0)), state.range(1) != 0);
+    std::map<Data::MappedName, Data::IndexedName, std::less<>> map;
+    int index = 0;
+    for (const auto& name : names) {
+        map.emplace(name, Data::IndexedName("Face", ++index));
+    }
+
+    for (auto _ : state) {
+        for (const auto& name : names) {
+            benchmark::DoNotOptimize(map.find(name));
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(names.size()));
+}
+
+void MappedNameHash(benchmark::State& state)
+{
+    std::vector<Data::MappedName> names = createNames(int(state.range(0)), state.range(1) != 0);
+
+    for (auto _ : state) {
+        for (const auto& name : names) {
+            benchmark::DoNotOptimize(name.hash());
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(names.size()));
+}
+
+}  // namespace
+
+BENCHMARK(MappedNameMapInsert)->Apply(nameArgs);
+BENCHMARK(MappedNameMapFind)->Apply(nameArgs);
+BENCHMARK(MappedNameHash)->Apply(nameArgs);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <App/StringHasher.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+std::vector<std::string> createNames(int count, int length)
+{
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        std::string name = "Face" + std::to_string(i) + ";:H" + std::to_string(i * 7) + ":";
+        name.resize(std::max<std::size_t>(name.size(), length), 'x');
+        names.push_back(std::move(name));
+    }
+    return names;
+}
+
+void hasherArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"strings", "length"});
+    bench->Args({1000, 16});
+    bench->Args({100000, 16});
+    bench->Args({100000, 200});
+}
+
+void StringHasherInsert(benchmark::State& state)
+{
+    std::vector<std::string> names = createNames(int(state.range(0)), int(state.range(1)));
+
+    for (auto _ : state) {
+        App::StringHasherRef hasher(new App::StringHasher);
+        for (const auto& name : names) {
+            benchmark::DoNotOptimize(hasher->getID(name.c_str(), int(name.size()), true));
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(names.size()));
+}
+
+void StringHasherLookup(benchmark::State& state)
+{
+    std::vector<std::string> names = createNames(int(state.range(0)), int(state.range(1)));
+    App::StringHasherRef hasher(new App::StringHasher);
+    std::vector<App::StringIDRef> ids;
+    for (const auto& name : names) {
+        ids.push_back(hasher->getID(name.c_str(), int(name.size()), true));
+    }
+
+    for (auto _ : state) {
+        for (const auto& name : names) {
+            benchmark::DoNotOptimize(hasher->getID(name.c_str(), int(name.size()), true));
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(names.size()));
+}
+
+}  // namespace
+
+BENCHMARK(StringHasherInsert)->Apply(hasherArgs);
+BENCHMARK(StringHasherLookup)->Apply(hasherArgs);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <Base/Base64.h>
+#include <Base/Base64Filter.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+std::string createData(std::size_t size)
+{
+    std::string data;
+    data.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        data.push_back(static_cast<char>(i * 7 + i / 251));
+    }
+    return data;
+}
+
+void Base64Encode(benchmark::State& state)
+{
+    std::string data = createData(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Base::base64_encode(data.c_str(), data.size()));
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(data.size()));
+}
+
+void Base64Decode(benchmark::State& state)
+{
+    std::string data = createData(std::size_t(state.range(0)));
+    std::string encoded = Base::base64_encode(data.c_str(), data.size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Base::base64_decode(encoded));
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(data.size()));
+}
+
+/// Encodes with line breaks like Writer::beginCharStream() does
+void Base64EncodeStream(benchmark::State& state)
+{
+    std::string data = createData(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        std::ostringstream out;
+        {
+            auto encoder = Base::create_base64_encoder(out);
+            encoder->write(data.c_str(), std::streamsize(data.size()));
+        }
+        benchmark::DoNotOptimize(out.tellp());
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(data.size()));
+}
+
+void Base64DecodeStream(benchmark::State& state)
+{
+    std::string data = createData(std::size_t(state.range(0)));
+    std::ostringstream encoded;
+    {
+        auto encoder = Base::create_base64_encoder(encoded);
+        encoder->write(data.c_str(), std::streamsize(data.size()));
+    }
+    std::string text = encoded.str();
+    std::string decoded(data.size(), '\0');
+
+    for (auto _ : state) {
+        std::istringstream in(text);
+        auto decoder = Base::create_base64_decoder(in);
+        decoder->read(&decoded[0], std::streamsize(decoded.size()));
+        benchmark::DoNotOptimize(decoded.data());
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(data.size()));
+}
+
+}  // namespace
+
+BENCHMARK(Base64Encode)->ArgName("bytes")->RangeMultiplier(100)->Range(100, 10000000);
+BENCHMARK(Base64Decode)->ArgName("bytes")->RangeMultiplier(100)->Range(100, 10000000);
+BENCHMARK(Base64EncodeStream)->ArgName("bytes")->RangeMultiplier(100)->Range(100, 10000000);
+BENCHMARK(Base64DecodeStream)->ArgName("bytes")->RangeMultiplier(100)->Range(100, 10000000);
+
+// NOLINTEND(readability-magic-numbers)
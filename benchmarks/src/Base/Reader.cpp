@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <Base/Reader.h>
+#include <Base/Writer.h>
+
+#include "XMLGenerator.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+std::string createProperties(int count)
+{
+    Base::StringWriter writer;
+    benchmarks::writeProperties(writer, count);
+    return writer.getString();
+}
+
+void readProperties(Base::XMLReader& reader)
+{
+    reader.readElement("Properties");
+    long count = reader.getAttributeAsInteger("Count");
+    for (long i = 0; i < count; ++i) {
+        reader.readElement("Property");
+        benchmark::DoNotOptimize(reader.getAttribute("name"));
+        reader.readElement("String");
+        benchmark::DoNotOptimize(reader.getAttribute("value"));
+        reader.readEndElement("Property");
+    }
+    reader.readEndElement("Properties");
+}
+
+void XMLReaderStream(benchmark::State& state)
+{
+    std::string data = createProperties(int(state.range(0)));
+
+    for (auto _ : state) {
+        std::istringstream stream(data);
+        Base::XMLReader reader("Document.xml", stream);
+        readProperties(reader);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(data.size()));
+}
+
+void XMLReaderBuffer(benchmark::State& state)
+{
+    std::string data = createProperties(int(state.range(0)));
+
+    for (auto _ : state) {
+        Base::XMLReader reader("Document.xml", data);
+        readProperties(reader);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(data.size()));
+}
+
+}  // namespace
+
+BENCHMARK(XMLReaderStream)->ArgName("properties")->RangeMultiplier(10)->Range(100, 100000);
+BENCHMARK(XMLReaderBuffer)->ArgName("properties")->RangeMultiplier(10)->Range(100, 100000);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <benchmark/benchmark.h>
+
+#include <Base/Writer.h>
+
+#include "XMLGenerator.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+void StringWriterProperties(benchmark::State& state)
+{
+    int count = int(state.range(0));
+
+    int64_t bytes = 0;
+    for (auto _ : state) {
+        Base::StringWriter writer;
+        benchmarks::writeProperties(writer, count);
+        bytes += int64_t(writer.Stream().tellp());
+    }
+    state.SetBytesProcessed(bytes);
+}
+
+}  // namespace
+
+BENCHMARK(StringWriterProperties)->ArgName("properties")->RangeMultiplier(10)->Range(100, 100000);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef BENCHMARKS_XMLGENERATOR_H
+#define BENCHMARKS_XMLGENERATOR_H
+
+#include <string>
+
+#include <Base/Persistence.h>
+#include <Base/Writer.h>
+
+namespace benchmarks
+{
+
+/// Writes \a count string properties the way PropertyContainer::Save() lays them out
+inline void writeProperties(Base::Writer& writer, int count)
+{
+    writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>\n";
+    writer.Stream() << writer.ind() << "<Properties Count=\"" << count << "\">\n";
+    writer.incInd();
+    for (int i = 0; i < count; ++i) {
+        std::string value = "Value <" + std::to_string(i) + "> & \"text\"";
+        writer.Stream() << writer.ind() << "<Property name=\"Prop" << i
+                        << "\" type=\"App::PropertyString\">\n";
+        writer.incInd();
+        writer.Stream() << writer.ind() << "<String value=\""
+                        << Base::Persistence::encodeAttribute(value) << "\"/>\n";
+        writer.decInd();
+        writer.Stream() << writer.ind() << "</Property>\n";
+    }
+    writer.decInd();
+    writer.Stream() << writer.ind() << "</Properties>\n";
+}
+
+}  // namespace benchmarks
+
+#endif  // BENCHMARKS_XMLGENERATOR_H
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+#include <sstream>
+
+#include <benchmark/benchmark.h>
+
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/Grid.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+/** A closed torus with a wavy surface, \a size segments around both circles, so it has
+ * 2 * size * size facets. Like a scanned part it is a solid with facets of different sizes.
+ */
+MeshCore::MeshKernel createTorus(int size)
+{
+    const double radius = 50.0;
+    const double tube = 15.0;
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    auto num = MeshCore::PointIndex(size);
+    for (MeshCore::PointIndex i = 0; i < num; i++) {
+        double u = 2.0 * M_PI * double(i) / double(num);
+        for (MeshCore::PointIndex j = 0; j < num; j++) {
+            double v = 2.0 * M_PI * double(j) / double(num);
+            double r = tube + 0.5 * std::sin(7.0 * u) * std::cos(5.0 * v);
+            points.emplace_back(float((radius + r * std::cos(v)) * std::cos(u)),
+                                float((radius + r * std::cos(v)) * std::sin(u)),
+                                float(r * std::sin(v)));
+        }
+    }
+    for (MeshCore::PointIndex i = 0; i < num; i++) {
+        for (MeshCore::PointIndex j = 0; j < num; j++) {
+            MeshCore::PointIndex p0 = i * num + j;
+            MeshCore::PointIndex p1 = ((i + 1) % num) * num + j;
+            MeshCore::PointIndex p2 = i * num + (j + 1) % num;
+            MeshCore::PointIndex p3 = ((i + 1) % num) * num + (j + 1) % num;
+            facets.emplace_back(p0, p1, p3);
+            facets.emplace_back(p0, p3, p2);
+        }
+    }
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    return kernel;
+}
+
+void meshArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("size");
+    bench->Arg(100);
+    bench->Arg(500);
+}
+
+void setFacetCounters(benchmark::State& state, const MeshCore::MeshKernel& kernel)
+{
+    state.counters["facets"] = double(kernel.CountFacets());
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(kernel.CountFacets()));
+}
+
+void MeshLoadBinarySTL(benchmark::State& state)
+{
+    MeshCore::MeshKernel kernel = createTorus(int(state.range(0)));
+    std::stringstream stl;
+    MeshCore::MeshOutput(kernel).SaveBinarySTL(stl);
+    std::string data = stl.str();
+
+    for (auto _ : state) {
+        MeshCore::MeshKernel loaded;
+        std::istringstream input(data);
+        benchmark::DoNotOptimize(MeshCore::MeshInput(loaded).LoadBinarySTL(input));
+    }
+    setFacetCounters(state, kernel);
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(data.size()));
+}
+
+/// The checks of the mesh evaluation panel, on a mesh without defects
+void MeshEvaluate(benchmark::State& state)
+{
+    MeshCore::MeshKernel kernel = createTorus(int(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MeshCore::MeshEvalOrientation(kernel).Evaluate());
+        benchmark::DoNotOptimize(MeshCore::MeshEvalSolid(kernel).Evaluate());
+        benchmark::DoNotOptimize(MeshCore::MeshEvalTopology(kernel).Evaluate());
+        benchmark::DoNotOptimize(MeshCore::MeshEvalPointManifolds(kernel).Evaluate());
+        benchmark::DoNotOptimize(MeshCore::MeshEvalSelfIntersection(kernel).Evaluate());
+    }
+    setFacetCounters(state, kernel);
+}
+
+/// Rays from points around the torus towards its center line, like picking in the 3D view
+template<typename Pick>
+void pickRays(benchmark::State& state, Pick pick)
+{
+    const int rays = 1000;
+    int hits = 0;
+    for (auto _ : state) {
+        for (int k = 0; k < rays; k++) {
+            double u = 2.0 * M_PI * double(k) / double(rays);
+            Base::Vector3f origin(float(100.0 * std::cos(u)), float(100.0 * std::sin(u)), 40.0F);
+            Base::Vector3f dir = Base::Vector3f(float(50.0 * std::cos(u)),
+                                                float(50.0 * std::sin(u)),
+                                                0.0F)
+                - origin;
+            hits += pick(origin, dir) ? 1 : 0;
+        }
+    }
+    state.counters["hits"] = benchmark::Counter(hits, benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(int64_t(state.iterations()) * rays);
+}
+
+void MeshRayPickGrid(benchmark::State& state)
+{
+    MeshCore::MeshKernel kernel = createTorus(int(state.range(0)));
+    MeshCore::MeshFacetGrid grid(kernel);
+    MeshCore::MeshAlgorithm algo(kernel);
+    pickRays(state, [&](const Base::Vector3f& origin, const Base::Vector3f& dir) {
+        Base::Vector3f res;
+        MeshCore::FacetIndex facet {};
+        return algo.NearestFacetOnRay(origin, dir, grid, res, facet);
+    });
+}
+
+void MeshRayPickBVH(benchmark::State& state)
+{
+    MeshCore::MeshKernel kernel = createTorus(int(state.range(0)));
+    MeshCore::MeshFacetBVH bvh(kernel);
+    pickRays(state, [&](const Base::Vector3f& origin, const Base::Vector3f& dir) {
+        Base::Vector3f res;
+        MeshCore::FacetIndex facet {};
+        return bvh.NearestFacetOnRay(origin, dir, MeshCore::Mathf::PI, res, facet);
+    });
+}
+
+void MeshSimplify(benchmark::State& state)
+{
+    MeshCore::MeshKernel kernel = createTorus(int(state.range(0)));
+
+    std::size_t facets = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        MeshCore::MeshKernel copy(kernel);
+        state.ResumeTiming();
+        MeshCore::MeshSimplify(copy).simplify(0.1F, 0.5F);
+        facets = copy.CountFacets();
+    }
+    setFacetCounters(state, kernel);
+    state.counters["simplified"] = double(facets);
+}
+
+}  // namespace
+
+BENCHMARK(MeshLoadBinarySTL)->Apply(meshArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(MeshEvaluate)->Apply(meshArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(MeshRayPickGrid)->Apply(meshArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(MeshRayPickBVH)->Apply(meshArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(MeshSimplify)->Apply(meshArgs)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(readability-magic-numbers)
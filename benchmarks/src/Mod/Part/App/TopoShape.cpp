@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <BRep_Builder.hxx>
+#include <BRepAlgoAPI_Cut.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakeWire.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepTools.hxx>
+#include <gp_Circ.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <App/StringHasher.h>
+#include <Mod/Part/App/BRepMesh.h>
+#include <Mod/Part/App/FaceMakerBullseye.h>
+#include <Mod/Part/App/TopoShape.h>
+#include <Mod/Part/App/TopoShapeOpCode.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+/// A plate and \a size by \a size pins standing on it, the tools of the boolean benchmarks
+struct PinPlate
+{
+    explicit PinPlate(int size)
+        : hasher(new App::StringHasher)
+    {
+        const double pitch = 4.0;
+        double length = pitch * (size + 1);
+        plate = Part::TopoShape(1, hasher, BRepPrimAPI_MakeBox(length, length, 2.0).Shape());
+
+        BRep_Builder builder;
+        TopoDS_Compound compound;
+        builder.MakeCompound(compound);
+        for (int i = 1; i <= size; i++) {
+            for (int j = 1; j <= size; j++) {
+                gp_Ax2 axis(gp_Pnt(pitch * i, pitch * j, -1.0), gp_Dir(0, 0, 1));
+                builder.Add(compound, BRepPrimAPI_MakeCylinder(axis, 1.0, 4.0).Shape());
+            }
+        }
+        pins = Part::TopoShape(2, hasher, compound);
+    }
+
+    std::vector<Part::TopoShape> inputs() const
+    {
+        return {plate, pins};
+    }
+
+    App::StringHasherRef hasher;
+    Part::TopoShape plate;
+    Part::TopoShape pins;
+};
+
+void shapeArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("size");
+    bench->Arg(5);
+    bench->Arg(20);
+}
+
+void PartBooleanCut(benchmark::State& state)
+{
+    PinPlate model(int(state.range(0)));
+
+    for (auto _ : state) {
+        Part::TopoShape result(0, model.hasher);
+        result.makeElementBoolean(Part::OpCodes::Cut, model.inputs());
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void PartFillet(benchmark::State& state)
+{
+    PinPlate model(int(state.range(0)));
+    Part::TopoShape holes(0, model.hasher);
+    holes.makeElementBoolean(Part::OpCodes::Cut, model.inputs());
+    // round the edges of the holes on both sides of the plate
+    std::vector<Part::TopoShape> edges;
+    for (const auto& edge : holes.getSubTopoShapes(TopAbs_EDGE)) {
+        if (!edge.isLinearEdge()) {
+            edges.push_back(edge);
+        }
+    }
+
+    for (auto _ : state) {
+        Part::TopoShape result(0, model.hasher);
+        result.makeElementFillet(holes, edges, 0.3, 0.3);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["edges"] = double(edges.size());
+}
+
+/// Only maps the element names of a boolean, the boolean itself is done once up front
+void PartElementMap(benchmark::State& state)
+{
+    PinPlate model(int(state.range(0)));
+    BRepAlgoAPI_Cut mkCut(model.plate.getShape(), model.pins.getShape());
+    std::vector<Part::TopoShape> inputs = model.inputs();
+
+    std::size_t count = 0;
+    for (auto _ : state) {
+        Part::TopoShape result(0, model.hasher);
+        result.makeElementShape(mkCut, inputs, Part::OpCodes::Cut);
+        count = result.getElementMapSize();
+    }
+    state.counters["elements"] = double(count);
+}
+
+/// Copies the triangulation of a meshed shape into points and facets, like the view providers
+void PartTessellationExtract(benchmark::State& state)
+{
+    PinPlate model(int(state.range(0)));
+    Part::TopoShape holes(0, model.hasher);
+    holes.makeElementBoolean(Part::OpCodes::Cut, model.inputs());
+    BRepMesh_IncrementalMesh mesher(holes.getShape(), 0.01, Standard_False, 0.5, Standard_True);
+
+    std::size_t facets = 0;
+    for (auto _ : state) {
+        std::vector<Data::ComplexGeoData::Domain> domains;
+        std::vector<Base::Vector3d> points;
+        std::vector<Data::ComplexGeoData::Facet> faces;
+        holes.getDomains(domains);
+        Part::BRepMesh().getFacesFromDomains(domains, points, faces);
+        facets = faces.size();
+    }
+    state.counters["facets"] = double(facets);
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(facets));
+}
+
+void PartTessellate(benchmark::State& state)
+{
+    PinPlate model(int(state.range(0)));
+    Part::TopoShape holes(0, model.hasher);
+    holes.makeElementBoolean(Part::OpCodes::Cut, model.inputs());
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        BRepTools::Clean(holes.getShape());
+        state.ResumeTiming();
+        std::vector<Base::Vector3d> points;
+        std::vector<Data::ComplexGeoData::Facet> faces;
+        holes.getFaces(points, faces, 0.01);
+        benchmark::DoNotOptimize(faces);
+    }
+}
+
+/// Rows of targets made of concentric circles, the face maker has to find the nesting
+void PartFaceMakerBullseye(benchmark::State& state)
+{
+    auto size = int(state.range(0));
+    std::vector<TopoDS_Wire> wires;
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            for (int k = 1; k <= 4; k++) {
+                gp_Circ circle(gp_Ax2(gp_Pnt(20.0 * i, 20.0 * j, 0.0), gp_Dir(0, 0, 1)), 2.0 * k);
+                wires.push_back(BRepBuilderAPI_MakeWire(BRepBuilderAPI_MakeEdge(circle)).Wire());
+            }
+        }
+    }
+
+    for (auto _ : state) {
+        Part::FaceMakerBullseye mkFace;
+        for (const auto& wire : wires) {
+            mkFace.addWire(wire);
+        }
+        mkFace.Build();
+        benchmark::DoNotOptimize(mkFace.Shape());
+    }
+    state.counters["wires"] = double(wires.size());
+}
+
+}  // namespace
+
+BENCHMARK(PartBooleanCut)->Apply(shapeArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(PartFillet)->Apply(shapeArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(PartElementMap)->Apply(shapeArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(PartTessellationExtract)->Apply(shapeArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(PartTessellate)->Apply(shapeArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(PartFaceMakerBullseye)->Apply(shapeArgs)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+#include <random>
+
+#include "SketchGenerator.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace benchmarks
+{
+
+namespace
+{
+
+double* addValue(GcsSketch& sketch, double value)
+{
+    sketch.values.push_back(value);
+    return &sketch.values.back();
+}
+
+/// Adds a point whose coordinates are unknowns starting at (x, y) moved by up to \a noise
+GCS::Point addPoint(GcsSketch& sketch, std::mt19937& gen, double x, double y, double noise)
+{
+    std::uniform_real_distribution<double> offset(-noise, noise);
+    GCS::Point pnt(addValue(sketch, x + offset(gen)), addValue(sketch, y + offset(gen)));
+    sketch.unknowns.push_back(pnt.x);
+    sketch.unknowns.push_back(pnt.y);
+    sketch.points.push_back(pnt);
+    return pnt;
+}
+
+void createGrid(GcsSketch& sketch, std::mt19937& gen, int size)
+{
+    const double length = 10.0;
+    double* distance = addValue(sketch, length);
+    GCS::System& sys = sketch.system;
+
+    std::vector<GCS::Point> grid;
+    for (int i = 0; i <= size; i++) {
+        for (int j = 0; j <= size; j++) {
+            grid.push_back(addPoint(sketch, gen, j * length, i * length, 1.0));
+        }
+    }
+    auto at = [&grid, size](int i, int j) -> GCS::Point& {
+        return grid[i * (size + 1) + j];
+    };
+
+    sys.addConstraintCoordinateX(at(0, 0), addValue(sketch, 0.0), ++sketch.numTags);
+    sys.addConstraintCoordinateY(at(0, 0), addValue(sketch, 0.0), ++sketch.numTags);
+    for (int k = 1; k <= size; k++) {
+        sys.addConstraintHorizontal(at(0, k - 1), at(0, k), ++sketch.numTags);
+        sys.addConstraintP2PDistance(at(0, k - 1), at(0, k), distance, ++sketch.numTags);
+        sys.addConstraintVertical(at(k - 1, 0), at(k, 0), ++sketch.numTags);
+        sys.addConstraintP2PDistance(at(k - 1, 0), at(k, 0), distance, ++sketch.numTags);
+    }
+    for (int i = 1; i <= size; i++) {
+        for (int j = 1; j <= size; j++) {
+            sys.addConstraintP2PDistance(at(i, j - 1), at(i, j), distance, ++sketch.numTags);
+            sys.addConstraintP2PDistance(at(i - 1, j), at(i, j), distance, ++sketch.numTags);
+        }
+    }
+}
+
+void createImport(GcsSketch& sketch, std::mt19937& gen, int size)
+{
+    const int segments = 4;
+    std::uniform_real_distribution<double> pos(0.0, 1000.0);
+    std::uniform_real_distribution<double> length(5.0, 50.0);
+    GCS::System& sys = sketch.system;
+
+    std::vector<GCS::Line> previous;
+    for (int i = 0; i < size; i++) {
+        std::vector<GCS::Line> polyline;
+        double x = pos(gen);
+        double y = pos(gen);
+        for (int k = 0; k < segments; k++) {
+            // alternately horizontal and vertical segments, coincident end to start
+            double dx = k % 2 == 0 ? length(gen) : 0.0;
+            double dy = k % 2 == 0 ? 0.0 : length(gen);
+            GCS::Line line;
+            line.p1 = addPoint(sketch, gen, x, y, 0.5);
+            line.p2 = addPoint(sketch, gen, x + dx, y + dy, 0.5);
+            if (k % 2 == 0) {
+                sys.addConstraintHorizontal(line, ++sketch.numTags);
+            }
+            else {
+                sys.addConstraintVertical(line, ++sketch.numTags);
+            }
+            if (k > 0) {
+                sys.addConstraintP2PCoincident(polyline.back().p2, line.p1, ++sketch.numTags);
+            }
+            polyline.push_back(line);
+            x += dx;
+            y += dy;
+        }
+
+        // every other polyline touches the previous one, as snapped lines do
+        if (i % 2 == 1) {
+            sys.addConstraintPointOnLine(polyline.front().p1, previous.back(), ++sketch.numTags);
+        }
+        previous = std::move(polyline);
+    }
+}
+
+void createLinkage(GcsSketch& sketch, std::mt19937& gen, int size)
+{
+    const double crank = 3.0;
+    const double coupler = 10.0;
+    const double angle = 1.0;
+    double* crankLength = addValue(sketch, crank);
+    double* couplerLength = addValue(sketch, coupler);
+    GCS::System& sys = sketch.system;
+
+    GCS::Point previous;
+    for (int k = 0; k < size; k++) {
+        GCS::Point pivot(addValue(sketch, k * coupler), addValue(sketch, 0.0));
+        GCS::Point joint = addPoint(sketch,
+                                    gen,
+                                    k * coupler + crank * std::cos(angle),
+                                    crank * std::sin(angle),
+                                    0.5);
+        sys.addConstraintP2PDistance(pivot, joint, crankLength, ++sketch.numTags);
+        if (k > 0) {
+            sys.addConstraintP2PDistance(previous, joint, couplerLength, ++sketch.numTags);
+        }
+        previous = joint;
+    }
+}
+
+}  // namespace
+
+double GcsSketch::residual()
+{
+    double sum = 0.0;
+    for (int tag = 1; tag <= numTags; tag++) {
+        double err = system.calculateConstraintErrorByTag(tag);
+        sum += err * err;
+    }
+    return numTags > 0 ? std::sqrt(sum / numTags) : 0.0;
+}
+
+std::unique_ptr<GcsSketch> createSketch(SketchKind kind, int size, GCS::Algorithm alg)
+{
+    auto sketch = std::make_unique<GcsSketch>();
+    sketch->system.debugMode = GCS::NoDebug;
+
+    // the same corpus on every run
+    std::mt19937 gen(42);
+    switch (kind) {
+        case SketchKind::Grid:
+            createGrid(*sketch, gen, size);
+            break;
+        case SketchKind::Import:
+            createImport(*sketch, gen, size);
+            break;
+        case SketchKind::Linkage:
+            createLinkage(*sketch, gen, size);
+            break;
+    }
+
+    sketch->system.declareUnknowns(sketch->unknowns);
+    sketch->system.initSolution(alg);
+    return sketch;
+}
+
+std::pair<double*, double*> initDrag(GcsSketch& sketch, GCS::Algorithm alg)
+{
+    GCS::Point& pnt = sketch.points.front();
+    double* x = addValue(sketch, *pnt.x);
+    double* y = addValue(sketch, *pnt.y);
+    sketch.system.addConstraintCoordinateX(pnt, x, GCS::DefaultTemporaryConstraint);
+    sketch.system.addConstraintCoordinateY(pnt, y, GCS::DefaultTemporaryConstraint);
+    sketch.system.initSolution(alg);
+    return {x, y};
+}
+
+}  // namespace benchmarks
+
+// NOLINTEND(readability-magic-numbers)
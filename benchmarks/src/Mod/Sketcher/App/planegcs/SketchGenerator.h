@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef BENCHMARKS_SKETCHGENERATOR_H
+#define BENCHMARKS_SKETCHGENERATOR_H
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <Mod/Sketcher/App/planegcs/GCS.h>
+
+namespace benchmarks
+{
+
+/// The kinds of sketches of the solver corpus
+enum class SketchKind
+{
+    /** A grid of points, fully constrained: the first row is horizontal, the first column
+     * vertical and every point has a fixed distance to its left and lower neighbour.
+     */
+    Grid,
+    /** Polylines with coincident, horizontal, vertical and point on line constraints like a
+     * DXF import that has been auto constrained. It has many degrees of freedom.
+     */
+    Import,
+    /** A chain of bars, each one pinned to a fixed pivot and of fixed length, connected by
+     * coupler bars of fixed length. The mechanism has one degree of freedom.
+     */
+    Linkage,
+};
+
+/** A planegcs system with the parameters it refers to. The start values of the parameters are
+ * perturbed away from a solution, so solve() has some work to do.
+ */
+struct GcsSketch
+{
+    GCS::System system;
+    /// All values referred to by the system, a deque keeps their addresses stable
+    std::deque<double> values;
+    GCS::VEC_pD unknowns;
+    std::vector<GCS::Point> points;
+    int numTags = 0;
+
+    /// Returns the RMS of the errors of all constraints
+    double residual();
+};
+
+/** Creates a sketch of the given kind. \a size is the number of grid cells per side, of
+ * polylines or of bars. The system is ready to be solved with \a alg.
+ */
+std::unique_ptr<GcsSketch> createSketch(SketchKind kind, int size, GCS::Algorithm alg);
+
+/** Adds temporary constraints fixing the first point of \a sketch to the returned target
+ * coordinates, like the Sketcher does when dragging the point.
+ */
+std::pair<double*, double*> initDrag(GcsSketch& sketch, GCS::Algorithm alg);
+
+}  // namespace benchmarks
+
+#endif  // BENCHMARKS_SKETCHGENERATOR_H
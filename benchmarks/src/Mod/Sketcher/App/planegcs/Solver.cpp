@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "SketchGenerator.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+// The benchmark arguments are the kind of sketch, its size and the algorithm or QR variant
+void solveArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"kind", "size", "algorithm"});
+    for (int alg : {GCS::BFGS, GCS::LevenbergMarquardt, GCS::DogLeg}) {
+        bench->Args({int(benchmarks::SketchKind::Grid), 5, alg});
+        bench->Args({int(benchmarks::SketchKind::Grid), 10, alg});
+        bench->Args({int(benchmarks::SketchKind::Import), 50, alg});
+        bench->Args({int(benchmarks::SketchKind::Import), 200, alg});
+        bench->Args({int(benchmarks::SketchKind::Linkage), 10, alg});
+        bench->Args({int(benchmarks::SketchKind::Linkage), 30, alg});
+    }
+}
+
+void diagnoseArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"kind", "size", "qr"});
+    for (int qr : {GCS::EigenDenseQR, GCS::EigenSparseQR}) {
+        bench->Args({int(benchmarks::SketchKind::Grid), 5, qr});
+        bench->Args({int(benchmarks::SketchKind::Grid), 10, qr});
+        bench->Args({int(benchmarks::SketchKind::Import), 50, qr});
+        bench->Args({int(benchmarks::SketchKind::Import), 100, qr});
+        bench->Args({int(benchmarks::SketchKind::Linkage), 30, qr});
+    }
+}
+
+void dragArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"size", "algorithm"});
+    for (int alg : {GCS::BFGS, GCS::LevenbergMarquardt, GCS::DogLeg}) {
+        bench->Args({10, alg});
+        bench->Args({30, alg});
+    }
+}
+
+/// Reports the quality of the last solution, the counters end up in the JSON output
+void setCounters(benchmark::State& state,
+                 benchmarks::GcsSketch& sketch,
+                 int iterations,
+                 int failures)
+{
+    sketch.system.applySolution();
+    state.counters["iterations"] = benchmark::Counter(iterations, benchmark::Counter::kAvgIterations);
+    state.counters["failures"] = failures;
+    state.counters["residual"] = sketch.residual();
+    state.counters["unknowns"] = double(sketch.unknowns.size());
+}
+
+void SketcherSolve(benchmark::State& state)
+{
+    auto alg = GCS::Algorithm(state.range(2));
+    auto sketch = benchmarks::createSketch(benchmarks::SketchKind(state.range(0)),
+                                           int(state.range(1)),
+                                           alg);
+
+    // every solve starts again from the perturbed parameters
+    int iterations = 0;
+    int failures = 0;
+    for (auto _ : state) {
+        int ret = sketch->system.solve(true, alg);
+        iterations += sketch->system.getIterations();
+        failures += ret == GCS::Success ? 0 : 1;
+    }
+
+    setCounters(state, *sketch, iterations, failures);
+}
+
+void SketcherDiagnose(benchmark::State& state)
+{
+    auto sketch = benchmarks::createSketch(benchmarks::SketchKind(state.range(0)),
+                                           int(state.range(1)),
+                                           GCS::DogLeg);
+    sketch->system.qrAlgorithm = GCS::QRAlgorithm(state.range(2));
+
+    int dofs = 0;
+    for (auto _ : state) {
+        dofs = sketch->system.diagnose();
+    }
+
+    state.counters["dofs"] = dofs;
+    state.counters["unknowns"] = double(sketch->unknowns.size());
+}
+
+void SketcherDrag(benchmark::State& state)
+{
+    auto alg = GCS::Algorithm(state.range(1));
+    auto sketch =
+        benchmarks::createSketch(benchmarks::SketchKind::Linkage, int(state.range(0)), alg);
+    sketch->system.solve(true, alg);
+    sketch->system.applySolution();
+    sketch->system.setReference();
+
+    // drag the first joint of the linkage around its pivot, each step starting from the last
+    auto [x, y] = benchmarks::initDrag(*sketch, alg);
+    double angle = std::atan2(*y, *x);
+    double radius = std::hypot(*x, *y);
+    int iterations = 0;
+    int failures = 0;
+    for (auto _ : state) {
+        angle += 0.01;
+        *x = radius * std::cos(angle);
+        *y = radius * std::sin(angle);
+        int ret = sketch->system.solve(true, alg);
+        iterations += sketch->system.getIterations();
+        if (ret == GCS::Success) {
+            sketch->system.applySolution();
+            sketch->system.setReference();
+        }
+        else {
+            failures++;
+        }
+    }
+
+    setCounters(state, *sketch, iterations, failures);
+}
+
+}  // namespace
+
+BENCHMARK(SketcherSolve)->Apply(solveArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(SketcherDiagnose)->Apply(diagnoseArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(SketcherDrag)->Apply(dragArgs)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <chrono>
+
+#include <benchmark/benchmark.h>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/Parameter.h>
+#include <Mod/TechDraw/App/DrawGeomHatch.h>
+#include <Mod/TechDraw/App/DrawViewDimension.h>
+#include <Mod/TechDraw/App/DrawViewPart.h>
+
+#include "DrawingGenerator.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+/** Turns the HLR and hatch caches on or off and the preview off while a benchmark runs,
+ * so every iteration does the same work. The user settings are removed afterwards.
+ */
+class CacheSettings
+{
+public:
+    explicit CacheSettings(bool useCaches)
+        : general(getGroup("General"))
+        , pat(getGroup("PAT"))
+    {
+        general->SetInt("HLRCacheSize", useCaches ? 100 : 0);
+        general->SetInt("HLRPreviewFaceCount", 0);
+        pat->SetInt("HatchCacheSize", useCaches ? 200 : 0);
+    }
+    CacheSettings(const CacheSettings&) = delete;
+    CacheSettings& operator=(const CacheSettings&) = delete;
+
+    ~CacheSettings()
+    {
+        general->RemoveInt("HLRCacheSize");
+        general->RemoveInt("HLRPreviewFaceCount");
+        pat->RemoveInt("HatchCacheSize");
+    }
+
+private:
+    static ParameterGrp::handle getGroup(const char* name)
+    {
+        return App::GetApplication()
+            .GetUserParameter()
+            .GetGroup("BaseApp/Preferences/Mod/TechDraw")
+            ->GetGroup(name);
+    }
+
+    ParameterGrp::handle general;
+    ParameterGrp::handle pat;
+};
+
+// the sizes of the corpus are chosen so the big models take about a second to project
+void viewArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"kind", "size", "cache"});
+    bench->Args({int(benchmarks::ModelKind::SheetMetal), 10, 0});
+    bench->Args({int(benchmarks::ModelKind::SheetMetal), 40, 0});
+    bench->Args({int(benchmarks::ModelKind::Casting), 5, 0});
+    bench->Args({int(benchmarks::ModelKind::Casting), 20, 0});
+    bench->Args({int(benchmarks::ModelKind::Assembly), 4, 0});
+    bench->Args({int(benchmarks::ModelKind::Assembly), 10, 0});
+    bench->Args({int(benchmarks::ModelKind::SheetMetal), 40, 1});
+    bench->Args({int(benchmarks::ModelKind::Casting), 20, 1});
+    bench->Args({int(benchmarks::ModelKind::Assembly), 10, 1});
+}
+
+void dimensionArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"kind", "size", "dims"});
+    bench->Args({int(benchmarks::ModelKind::SheetMetal), 40, 10});
+    bench->Args({int(benchmarks::ModelKind::SheetMetal), 40, 100});
+    bench->Args({int(benchmarks::ModelKind::Assembly), 10, 100});
+}
+
+benchmarks::Drawing createDrawing(const benchmark::State& state)
+{
+    auto kind = benchmarks::ModelKind(state.range(0));
+    return benchmarks::createDrawing(benchmarks::createModel(kind, int(state.range(1))));
+}
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/// Recomputes the view, the counters hold the time taken by each stage
+void TechDrawViewUpdate(benchmark::State& state)
+{
+    CacheSettings caches(state.range(2) != 0);
+    benchmarks::Drawing drawing = createDrawing(state);
+    TechDraw::DrawViewPart* view = drawing.view;
+    benchmarks::updateView(drawing);
+
+    double hlr = 0.0;
+    double faces = 0.0;
+    for (auto _ : state) {
+        auto start = Clock::now();
+        view->touch();
+        drawing.doc->recompute();
+        benchmarks::processEventsUntil([view]() {
+            return !view->waitingForHlr();
+        });
+        hlr += secondsSince(start);
+
+        start = Clock::now();
+        benchmarks::processEventsUntil([view]() {
+            return !view->waitingForFaces();
+        });
+        faces += secondsSince(start);
+    }
+
+    // the hlr stage includes extracting the edges and adding the cosmetic geometry, the faces
+    // stage updating the dimensions
+    state.counters["hlr"] = benchmark::Counter(hlr, benchmark::Counter::kAvgIterations);
+    state.counters["faces"] = benchmark::Counter(faces, benchmark::Counter::kAvgIterations);
+    state.counters["edgeCount"] = double(view->getEdgeGeometry().size());
+    state.counters["faceCount"] = double(view->getFaceGeometry().size());
+
+    benchmarks::closeDrawing(drawing);
+}
+
+void TechDrawDimensionUpdate(benchmark::State& state)
+{
+    CacheSettings caches(true);
+    benchmarks::Drawing drawing = createDrawing(state);
+    benchmarks::updateView(drawing);
+    std::vector<TechDraw::DrawViewDimension*> dims =
+        benchmarks::addDimensions(drawing, int(state.range(2)));
+
+    for (auto _ : state) {
+        for (auto dim : dims) {
+            dim->recomputeFeature();
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(dims.size()));
+    state.counters["dimCount"] = double(dims.size());
+
+    benchmarks::closeDrawing(drawing);
+}
+
+void TechDrawCosmeticUpdate(benchmark::State& state)
+{
+    CacheSettings caches(true);
+    benchmarks::Drawing drawing =
+        benchmarks::createDrawing(benchmarks::createModel(benchmarks::ModelKind::Casting, 5));
+    TechDraw::DrawViewPart* view = drawing.view;
+    auto count = int(state.range(0));
+    for (int i = 0; i < count; i++) {
+        view->addCosmeticEdge(Base::Vector3d(i, 0.0, 0.0), Base::Vector3d(i, 10.0, 0.0));
+    }
+    benchmarks::updateView(drawing);
+
+    for (auto _ : state) {
+        view->refreshCEGeoms();
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * count);
+
+    benchmarks::closeDrawing(drawing);
+}
+
+void TechDrawHatch(benchmark::State& state)
+{
+    CacheSettings caches(state.range(2) != 0);
+    benchmarks::Drawing drawing = createDrawing(state);
+    TechDraw::DrawViewPart* view = drawing.view;
+    benchmarks::updateView(drawing);
+    std::vector<TechDraw::LineSet> lineSets =
+        TechDraw::DrawGeomHatch::makeLineSets(TechDraw::DrawGeomHatch::prefGeomHatchFile(),
+                                              TechDraw::DrawGeomHatch::prefGeomHatchName());
+    if (lineSets.empty()) {
+        state.SkipWithError("The PAT file of the preferences has no hatch pattern");
+        benchmarks::closeDrawing(drawing);
+        return;
+    }
+
+    auto faceCount = int(view->getFaceGeometry().size());
+    for (auto _ : state) {
+        for (int iFace = 0; iFace < faceCount; iFace++) {
+            benchmark::DoNotOptimize(
+                TechDraw::DrawGeomHatch::getTrimmedLines(view, lineSets, iFace, 1.0));
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * faceCount);
+    state.counters["faceCount"] = faceCount;
+
+    benchmarks::closeDrawing(drawing);
+}
+
+}  // namespace
+
+BENCHMARK(TechDrawViewUpdate)->Apply(viewArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(TechDrawDimensionUpdate)->Apply(dimensionArgs)->Unit(benchmark::kMillisecond);
+BENCHMARK(TechDrawCosmeticUpdate)
+    ->ArgName("edges")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(TechDrawHatch)->Apply(viewArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// NOLINTEND(readability-magic-numbers)
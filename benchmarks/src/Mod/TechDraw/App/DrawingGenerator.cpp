@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include <QCoreApplication>
+
+#include <BRep_Builder.hxx>
+#include <BRepAlgoAPI_Cut.hxx>
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepFilletAPI_MakeFillet.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakePrism.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <gp_Ax2.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <Base/Interpreter.h>
+#include <Mod/Part/App/PartFeature.h>
+#include <Mod/TechDraw/App/DrawPage.h>
+#include <Mod/TechDraw/App/DrawViewDimension.h>
+#include <Mod/TechDraw/App/DrawViewPart.h>
+#include <Mod/TechDraw/App/Geometry.h>
+
+#include "DrawingGenerator.h"
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace benchmarks
+{
+
+namespace
+{
+
+class CompoundMaker
+{
+public:
+    CompoundMaker()
+    {
+        builder.MakeCompound(compound);
+    }
+
+    void add(const TopoDS_Shape& shape)
+    {
+        builder.Add(compound, shape);
+    }
+
+    const TopoDS_Compound& shape() const
+    {
+        return compound;
+    }
+
+private:
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+};
+
+TopoDS_Shape createSheetMetal(int size)
+{
+    const double length = 10.0 * size + 20.0;
+    const double width = 100.0;
+    const double thickness = 2.0;
+    const double flange = 30.0;
+
+    TopoDS_Shape plate = BRepPrimAPI_MakeBox(length, width, thickness).Shape();
+    TopoDS_Shape front = BRepPrimAPI_MakeBox(gp_Pnt(0, 0, 0), length, thickness, flange).Shape();
+    TopoDS_Shape back =
+        BRepPrimAPI_MakeBox(gp_Pnt(0, width - thickness, 0), length, thickness, flange).Shape();
+    TopoDS_Shape part = BRepAlgoAPI_Fuse(BRepAlgoAPI_Fuse(plate, front).Shape(), back).Shape();
+
+    // rows of holes in the plate and slots through both flanges
+    CompoundMaker holes;
+    for (int i = 0; i < size; i++) {
+        double x = 15.0 + 10.0 * i;
+        for (int j = 0; j < 4; j++) {
+            gp_Ax2 axis(gp_Pnt(x, 20.0 + 20.0 * j, -1.0), gp_Dir(0, 0, 1));
+            holes.add(BRepPrimAPI_MakeCylinder(axis, 2.5, thickness + 2.0).Shape());
+        }
+        gp_Ax2 axis(gp_Pnt(x, -1.0, flange / 2.0), gp_Dir(0, 1, 0));
+        holes.add(BRepPrimAPI_MakeCylinder(axis, 3.0, width + 2.0).Shape());
+    }
+    return BRepAlgoAPI_Cut(part, holes.shape()).Shape();
+}
+
+TopoDS_Shape createCasting(int size)
+{
+    const double length = 20.0 * size + 20.0;
+    const double width = 80.0;
+    const double height = 20.0;
+
+    TopoDS_Shape block = BRepPrimAPI_MakeBox(length, width, height).Shape();
+    BRepFilletAPI_MakeFillet fillet(block);
+    for (TopExp_Explorer edges(block, TopAbs_EDGE); edges.More(); edges.Next()) {
+        fillet.Add(3.0, TopoDS::Edge(edges.Current()));
+    }
+    block = fillet.Shape();
+
+    CompoundMaker bosses;
+    CompoundMaker pockets;
+    for (int i = 0; i < size; i++) {
+        double x = 20.0 + 20.0 * i;
+        for (double y : {20.0, width - 20.0}) {
+            gp_Ax2 axis(gp_Pnt(x, y, height - 1.0), gp_Dir(0, 0, 1));
+            bosses.add(BRepPrimAPI_MakeCylinder(axis, 6.0, 16.0).Shape());
+        }
+        pockets.add(BRepPrimAPI_MakeSphere(gp_Pnt(x, width / 2.0, height), 6.0).Shape());
+    }
+    TopoDS_Shape part = BRepAlgoAPI_Fuse(block, bosses.shape()).Shape();
+    return BRepAlgoAPI_Cut(part, pockets.shape()).Shape();
+}
+
+TopoDS_Shape createBolt(const gp_Pnt& base)
+{
+    const double head = 5.0;
+    BRepBuilderAPI_MakePolygon hexagon;
+    for (int k = 0; k < 6; k++) {
+        double angle = k * M_PI / 3.0;
+        hexagon.Add(gp_Pnt(base.X() + head * std::cos(angle),
+                           base.Y() + head * std::sin(angle),
+                           base.Z()));
+    }
+    hexagon.Close();
+    TopoDS_Face face = BRepBuilderAPI_MakeFace(hexagon.Wire()).Face();
+    TopoDS_Shape nut = BRepPrimAPI_MakePrism(face, gp_Vec(0, 0, 4.0)).Shape();
+    gp_Ax2 axis(gp_Pnt(base.X(), base.Y(), base.Z() + 4.0), gp_Dir(0, 0, 1));
+    TopoDS_Shape shank = BRepPrimAPI_MakeCylinder(axis, 3.0, 20.0).Shape();
+    return BRepAlgoAPI_Fuse(nut, shank).Shape();
+}
+
+TopoDS_Shape createAssembly(int size)
+{
+    const double pitch = 15.0;
+    CompoundMaker assembly;
+    assembly.add(BRepPrimAPI_MakeBox(gp_Pnt(-pitch, -pitch, -5.0), pitch * (size + 1), pitch * (size + 1), 5.0)
+                     .Shape());
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            assembly.add(createBolt(gp_Pnt(pitch * i, pitch * j, 0.0)));
+        }
+    }
+    return assembly.shape();
+}
+
+//! the views report the results of their worker threads through the Qt event loop
+void ensureApplication()
+{
+    if (!QCoreApplication::instance()) {
+        static int argc = 1;
+        static std::array<char*, 1> argv {const_cast<char*>("Benchmarks_run")};  // NOLINT
+        static auto app = std::make_unique<QCoreApplication>(argc, argv.data());
+    }
+}
+
+}  // namespace
+
+TopoDS_Shape createModel(ModelKind kind, int size)
+{
+    switch (kind) {
+        case ModelKind::SheetMetal:
+            return createSheetMetal(size);
+        case ModelKind::Casting:
+            return createCasting(size);
+        case ModelKind::Assembly:
+            return createAssembly(size);
+    }
+    return {};
+}
+
+Drawing createDrawing(const TopoDS_Shape& shape)
+{
+    ensureApplication();
+    Base::Interpreter().runString("import TechDraw");
+
+    Drawing drawing;
+    App::Document* doc =
+        App::GetApplication().newDocument(App::GetApplication().getUniqueDocumentName("Drawing").c_str());
+    auto model = static_cast<Part::Feature*>(doc->addObject("Part::Feature", "Model"));
+    model->Shape.setValue(shape);
+
+    auto page = static_cast<TechDraw::DrawPage*>(doc->addObject("TechDraw::DrawPage", "Page"));
+    page->KeepUpdated.setValue(true);
+    auto view = static_cast<TechDraw::DrawViewPart*>(doc->addObject("TechDraw::DrawViewPart", "View"));
+    view->Source.setValues({model});
+    view->Direction.setValue(Base::Vector3d(1.0, -1.0, 1.0));
+    view->XDirection.setValue(Base::Vector3d(1.0, 1.0, 0.0));
+    view->HardHidden.setValue(true);
+    // a custom scale does not need the template to check the fit of the view
+    view->ScaleType.setValue("Custom");
+    page->addView(view, false);
+
+    drawing.doc = doc;
+    drawing.page = page;
+    drawing.view = view;
+    return drawing;
+}
+
+void closeDrawing(Drawing& drawing)
+{
+    // let running computations report back before their view goes away
+    processEventsUntil([&drawing]() {
+        return !drawing.view->waitingForResult();
+    });
+    App::GetApplication().closeDocument(drawing.doc->getName());
+    drawing = Drawing();
+}
+
+std::vector<TechDraw::DrawViewDimension*> addDimensions(Drawing& drawing, int count)
+{
+    std::vector<TechDraw::DrawViewDimension*> dims;
+    int iEdge = 0;
+    for (const auto& geom : drawing.view->getEdgeGeometry()) {
+        if (int(dims.size()) >= count) {
+            break;
+        }
+        if (geom->getGeomType() == TechDraw::GENERIC && !geom->getCosmetic()) {
+            auto dim = static_cast<TechDraw::DrawViewDimension*>(
+                drawing.doc->addObject("TechDraw::DrawViewDimension", "Dimension"));
+            dim->Type.setValue("Distance");
+            std::string edgeName = std::string("Edge") + std::to_string(iEdge);
+            dim->References2D.setValue(drawing.view, edgeName.c_str());
+            drawing.page->addView(dim, false);
+            dims.push_back(dim);
+        }
+        iEdge++;
+    }
+    drawing.doc->recompute();
+    processEventsUntil([&drawing]() {
+        return !drawing.view->waitingForResult();
+    });
+    return dims;
+}
+
+void processEventsUntil(const std::function<bool()>& done)
+{
+    ensureApplication();
+    while (!done()) {
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+    }
+}
+
+void updateView(Drawing& drawing)
+{
+    drawing.view->touch();
+    drawing.doc->recompute();
+    processEventsUntil([&drawing]() {
+        return !drawing.view->waitingForResult();
+    });
+}
+
+}  // namespace benchmarks
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef BENCHMARKS_DRAWINGGENERATOR_H
+#define BENCHMARKS_DRAWINGGENERATOR_H
+
+#include <functional>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+
+namespace App
+{
+class Document;
+}
+
+namespace TechDraw
+{
+class DrawPage;
+class DrawViewDimension;
+class DrawViewPart;
+}  // namespace TechDraw
+
+namespace benchmarks
+{
+
+/// The kinds of models of the drawing corpus
+enum class ModelKind
+{
+    /// A bent plate with two flanges and rows of holes and slots, mostly lines and circles
+    SheetMetal,
+    /// A block with rounded edges, bosses on top and spherical pockets, many smooth edges
+    Casting,
+    /// A compound of bolts standing on a base plate, many small solids
+    Assembly,
+};
+
+/// Creates a model of the given kind, \a size is the number of holes, bosses or bolts per row
+TopoDS_Shape createModel(ModelKind kind, int size);
+
+/// A document with a page showing one view of a model
+struct Drawing
+{
+    App::Document* doc = nullptr;
+    TechDraw::DrawPage* page = nullptr;
+    TechDraw::DrawViewPart* view = nullptr;
+};
+
+/** Creates a document holding \a shape in a Part::Feature and a page with an isometric view
+ * of it, hidden lines shown. The view is not computed yet.
+ */
+Drawing createDrawing(const TopoDS_Shape& shape);
+
+/// Closes the document of a drawing created by createDrawing()
+void closeDrawing(Drawing& drawing);
+
+/** Adds up to \a count length dimensions to the straight edges of the view of \a drawing,
+ * the view must have been computed.
+ */
+std::vector<TechDraw::DrawViewDimension*> addDimensions(Drawing& drawing, int count);
+
+/** Processes the events of the application until \a done returns true. Views compute in
+ * worker threads and report back through the event loop.
+ */
+void processEventsUntil(const std::function<bool()>& done);
+
+/// Recomputes the view of \a drawing and waits until its hidden lines and faces are found
+void updateView(Drawing& drawing);
+
+}  // namespace benchmarks
+
+#endif  // BENCHMARKS_DRAWINGGENERATOR_H
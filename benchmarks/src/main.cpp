@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <array>
+
+#include <benchmark/benchmark.h>
+
+#include <App/Application.h>
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    constexpr int appArgc = 1;
+    std::array<const char*, appArgc> appArgv {"FreeCAD"};
+    App::Application::Config()["ExeName"] = "FreeCAD";
+    App::Application::init(appArgc, const_cast<char**>(appArgv.data()));  // NOLINT
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -122,6 +122,8 @@ class NETGENPLUGIN_EXPORT NETGENPlugin_Mesher
   void SetParameters(const NETGENPlugin_Hypothesis*          hyp);
   void SetParameters(const NETGENPlugin_SimpleHypothesis_2D* hyp);
   void SetViscousLayers2DAssigned(bool isAssigned) { _isViscousLayers2D = isAssigned; }
+  // number of threads meshing the volumes of different solids, if netgen supports it
+  void SetNbThreads(int nbThreads) { _nbThreads = nbThreads; }
 
   bool Compute();
 
@@ -204,6 +206,7 @@ class NETGENPLUGIN_EXPORT NETGENPlugin_Mesher
   bool                 _optimize;
   int                  _fineness;
   bool                 _isViscousLayers2D;
+  int                  _nbThreads;
 #if NETGEN_VERSION < NETGEN_VERSION_STRING(6,0,0)
   netgen::Mesh*        _ngMesh;
 #else
@@ -130,6 +130,7 @@ namespace netgen {
   DLL_HEADER extern bool merge_solids;
 }
 
+#include <exception>
 #include <vector>
 #include <limits>
 
@@ -174,6 +175,7 @@ NETGENPlugin_Mesher::NETGENPlugin_Mesher (SMESH_Mesh*         mesh,
     _optimize(true),
     _fineness(NETGENPlugin_Hypothesis::GetDefaultFineness()),
     _isViscousLayers2D(false),
+    _nbThreads(1),
     _ngMesh(NULL),
     _occgeom(NULL),
     _curShapeIndex(-1),
@@ -2991,7 +2993,31 @@ bool NETGENPlugin_Mesher::Compute()
       try
       {
         OCC_CATCH_SIGNALS;
-#if NETGEN_VERSION >= NETGEN_VERSION_STRING(6,2,0)
+#if NETGEN_VERSION >= NETGEN_VERSION_STRING(6,2,2105)
+        // netgen meshes the domains, i.e. the solids, in parallel on the surface mesh
+        // computed above, the shared faces stay conforming
+        mparams.parallel_meshing = _nbThreads > 1;
+        mparams.nthreads = _nbThreads;
+        if ( _nbThreads > 1 )
+        {
+          std::exception_ptr error;
+          ngcore::TaskManager::SetNumThreads( _nbThreads );
+          ngcore::RunWithTaskManager( [&]() {
+            try {
+              err = netgen::OCCGenerateMesh(occgeo, _ngMesh, mparams);
+            }
+            catch (...) {
+              error = std::current_exception();
+            }
+          });
+          if ( error )
+            std::rethrow_exception( error );
+        }
+        else
+        {
+          err = netgen::OCCGenerateMesh(occgeo, _ngMesh, mparams);
+        }
+#elif NETGEN_VERSION >= NETGEN_VERSION_STRING(6,2,0)
         err = netgen::OCCGenerateMesh(occgeo, _ngMesh, mparams);
 #elif NETGEN_VERSION >= NETGEN_VERSION_STRING(5,0,0)
         err = netgen::OCCGenerateMesh(occgeo, _ngMesh, mparams, startWith, endWith);
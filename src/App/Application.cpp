@@ -37,7 +37,10 @@
 # include <boost/date_time/posix_time/posix_time.hpp>
 # include <boost/scope_exit.hpp>
 # include <chrono>
+# include <condition_variable>
+# include <mutex>
 # include <random>
+# include <thread>
 # include <fmt/format.h>
 #endif
 
@@ -79,7 +82,10 @@
 #include <Base/PlacementPy.h>
 #include <Base/PrecisionPy.h>
 #include <Base/ProgressIndicatorPy.h>
+#include <Base/Reader.h>
 #include <Base/RotationPy.h>
+#include <Base/StartupProfile.h>
+#include <Base/Trace.h>
 #include <Base/Tools.h>
 #include <Base/Translate.h>
 #include <Base/Type.h>
@@ -643,6 +649,134 @@ std::string Application::getUniqueDocumentName(const char *Name, bool tempDoc) c
     }
 }
 
+namespace App {
+
+/** Reads the archives of documents ahead of Application::openDocuments()
+ *
+ * Only the file I/O and the inflating of the zip entries are done by the
+ * worker threads. Parsing the XML, creating the objects and restoring their
+ * data files stays on the thread that opens the documents, because that
+ * involves the type system, the document registry and the signals.
+ */
+class DocumentPrefetcher
+{
+public:
+    using Archive = std::shared_ptr<const std::vector<Base::ArchiveEntry>>;
+
+    explicit DocumentPrefetcher(std::size_t maxThreads)
+        : maxThreads(maxThreads)
+    {}
+
+    ~DocumentPrefetcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+            queue.clear();
+        }
+        workAvailable.notify_all();
+        for (auto &worker : workers)
+            worker.join();
+    }
+
+    DocumentPrefetcher(const DocumentPrefetcher&) = delete;
+    DocumentPrefetcher& operator=(const DocumentPrefetcher&) = delete;
+
+    void schedule(const std::string &path)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!jobs.emplace(path, Job()).second)
+                return;
+            queue.push_back(path);
+            if (workers.size() < maxThreads)
+                workers.emplace_back([this]() { run(); });
+        }
+        workAvailable.notify_one();
+    }
+
+    Archive take(const std::string &path)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        auto it = jobs.find(path);
+        if (it == jobs.end())
+            return {};
+        if (!it->second.started) {
+            // Not picked up by a worker yet, the caller is faster reading it itself
+            queue.erase(std::find(queue.begin(), queue.end(), path));
+            it->second.started = it->second.done = true;
+            return {};
+        }
+        jobDone.wait(lock, [&]() { return it->second.done; });
+        return std::move(it->second.archive);
+    }
+
+private:
+    struct Job {
+        bool started = false;
+        bool done = false;
+        Archive archive;
+    };
+
+    void run()
+    {
+        for (;;) {
+            std::string path;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                workAvailable.wait(lock, [this]() { return stopped || !queue.empty(); });
+                if (stopped)
+                    return;
+                path = std::move(queue.front());
+                queue.pop_front();
+                jobs[path].started = true;
+            }
+
+            Archive archive;
+            try {
+                archive = std::make_shared<const std::vector<Base::ArchiveEntry>>(
+                        Base::XMLReader::readArchive(path.c_str()));
+            }
+            catch (...) {
+                // Leave it to Document::restore() to read the file and report the error
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto &job = jobs[path];
+                job.archive = std::move(archive);
+                job.done = true;
+            }
+            jobDone.notify_all();
+        }
+    }
+
+    std::size_t maxThreads;
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable jobDone;
+    std::deque<std::string> queue;
+    std::map<std::string, Job> jobs;
+    std::vector<std::thread> workers;
+    bool stopped = false;
+};
+
+} // namespace App
+
+void Application::prefetchDocument(const char *FileName)
+{
+    if (_docPrefetcher && !getDocumentByPath(FileName))
+        _docPrefetcher->schedule(FileInfo(FileName).filePath());
+}
+
+std::shared_ptr<const std::vector<Base::ArchiveEntry>>
+Application::takePrefetchedDocument(const char *FileName)
+{
+    if (!_docPrefetcher || !FileName)
+        return {};
+    return _docPrefetcher->take(FileInfo(FileName).filePath());
+}
+
 int Application::addPendingDocument(const char *FileName, const char *objName, bool allowPartial)
 {
     if(!_isRestoring)
@@ -657,6 +791,7 @@ int Application::addPendingDocument(const char *FileName, const char *objName, b
     ret.first->second.emplace_back(objName);
     if(ret.second) {
         _pendingDocs.emplace_back(ret.first->first.c_str());
+        prefetchDocument(FileName);
         return 1;
     }
     return -1;
@@ -769,8 +904,28 @@ std::vector<Document*> Application::openDocuments(const std::vector<std::string>
     ParameterGrp::handle hGrp = GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     _allowPartial = !hGrp->GetBool("NoPartialLoading",false);
 
-    for (auto &name : filenames)
-        _pendingDocs.emplace_back(name.c_str());
+    // Linked documents are only known once the document linking them has
+    // been read, so they are queued for reading ahead by addPendingDocument().
+    std::shared_ptr<DocumentPrefetcher> prefetcher;
+    if (!_docPrefetcher && hGrp->GetBool("PrefetchDocuments", true)) {
+        std::size_t threads = std::max<long>(hGrp->GetInt("PrefetchThreads", 0), 0);
+        if (threads == 0)
+            threads = std::max(1U, std::thread::hardware_concurrency());
+        prefetcher = std::make_shared<DocumentPrefetcher>(threads);
+        _docPrefetcher = prefetcher;
+    }
+    BOOST_SCOPE_EXIT_ALL(&) {
+        if (prefetcher && _docPrefetcher == prefetcher)
+            _docPrefetcher.reset();
+    };
+
+    for (std::size_t i = 0; i < filenames.size(); ++i) {
+        _pendingDocs.emplace_back(filenames[i].c_str());
+        if (paths && paths->size() > i)
+            prefetchDocument((*paths)[i].c_str());
+        else
+            prefetchDocument(filenames[i].c_str());
+    }
 
     std::map<DocumentT, DocTiming> timings;
 
@@ -1722,6 +1877,9 @@ void Application::cleanupUnits()
 
 void Application::destruct()
 {
+    // the trace requested with --trace ends here
+    Base::Trace::writeFile();
+
     // saving system parameter
     if (_pcSysParamMngr->IgnoreSave()) {
         Base::Console().Warning("Discard system parameter\n");
@@ -1782,6 +1940,9 @@ void Application::destruct()
 
 void Application::destructObserver()
 {
+    if (Base::Console().GetConnectionMode() == Base::ConsoleSingleton::Asynchronous) {
+        Base::Console().SetConnectionMode(Base::ConsoleSingleton::Direct);
+    }
     if ( _pConsoleObserverFile ) {
         Base::Console().DetachObserver(_pConsoleObserverFile);
         delete _pConsoleObserverFile;
@@ -1959,6 +2120,7 @@ void Application::init(int argc, char ** argv)
 #if defined(FC_SE_TRANSLATOR)
         _set_se_translator(my_se_translator_filter);
 #endif
+        Base::StartupProfile::Scope step("Application::init");
         initTypes();
 
         initConfig(argc,argv);
@@ -1974,6 +2136,8 @@ void Application::init(int argc, char ** argv)
 // clang-format off
 void Application::initTypes()
 {
+    Base::StartupProfile::Scope step("Application::initTypes");
+
     // Base types
     Base::Type                      ::init();
     Base::BaseClass                 ::init();
@@ -2275,6 +2439,8 @@ void parseProgramOptions(int ac, char ** av, const string& exe, variables_map& v
     ("disable-addon", value< vector<string> >()->composing(),"Disable a given addon.")
     ("single-instance", "Allow to run a single instance of the application")
     ("safe-mode", "Force enable safe mode")
+    ("startup-profile", value<string>(), "Writes the timings of the startup steps to a Chrome trace file")
+    ("trace", value<string>(), "Traces the whole session and writes it to a Chrome trace file on exit")
     ("pass", value< vector<string> >()->multitoken(), "Ignores the following arguments and pass them through to be used by a script")
     ;
 
@@ -2468,6 +2634,15 @@ void processProgramOptions(const variables_map& vm, std::map<std::string,std::st
         mConfig["DisabledAddons"] = temp;
     }
 
+    if (vm.count("startup-profile")) {
+        Base::StartupProfile::setFile(vm["startup-profile"].as<string>());
+    }
+
+    if (vm.count("trace")) {
+        Base::Trace::setFile(vm["trace"].as<string>());
+        Base::Trace::start();
+    }
+
     if (vm.count("input-file")) {
         vector<string> files(vm["input-file"].as< vector<string> >());
         int OpenFileCount=0;
@@ -2566,6 +2741,8 @@ void processProgramOptions(const variables_map& vm, std::map<std::string,std::st
 
 void Application::initConfig(int argc, char ** argv)
 {
+    Base::StartupProfile::Scope step("Application::initConfig");
+
     // find the home path....
     mConfig["AppHomePath"] = FindHomePath(argv[0]);
 
@@ -2760,6 +2937,11 @@ void Application::initConfig(int argc, char ** argv)
 #endif
     }
 
+    // Deliver console messages from a dedicated thread, e.g. for verbose logging
+    if (loglevelParam->GetBool("Asynchronous", false)) {
+        Base::Console().SetConnectionMode(Base::ConsoleSingleton::Asynchronous);
+    }
+
     // Change application tmp. directory
     std::string tmpPath = _pcUserParamMngr->GetGroup("BaseApp/Preferences/General")->GetASCII("TempPath");
     Base::FileInfo di(tmpPath);
@@ -2818,6 +3000,8 @@ void Application::SaveEnv(const char* s)
 
 void Application::initApplication()
 {
+    Base::StartupProfile::Scope step("Application::initApplication");
+
     // interpreter and Init script ==========================================================
     // register scripts
     new Base::ScriptProducer( "CMakeVariables", CMakeVariables );
@@ -2847,6 +3031,7 @@ void Application::initApplication()
     // starting the init script
     Base::Console().Log("Run App init script\n");
     try {
+        Base::StartupProfile::Scope initStep("FreeCADInit.py");
         Base::Interpreter().runString(Base::ScriptFactory().ProduceScript("CMakeVariables"));
         Base::Interpreter().runString(Base::ScriptFactory().ProduceScript("FreeCADInit"));
     }
@@ -2994,6 +3179,9 @@ void Application::processCmdLineFiles()
 
 void Application::runApplication()
 {
+    // the startup ends here for the console application
+    Base::StartupProfile::write();
+
     // process all files given through command line interface
     processCmdLineFiles();
 
@@ -3028,6 +3216,8 @@ void Application::logStatus()
 
 void Application::LoadParameters()
 {
+    Base::StartupProfile::Scope step("Application::LoadParameters");
+
     // Init parameter sets ===========================================================
     //
     if (mConfig.find("UserParameter") == mConfig.end())
@@ -27,6 +27,7 @@
 #include <boost_signals2.hpp>
 
 #include <deque>
+#include <memory>
 #include <vector>
 
 #include <Base/Observer.h>
@@ -40,6 +41,7 @@ namespace Base
 {
 class ConsoleObserverStd;
 class ConsoleObserverFile;
+struct ArchiveEntry;
 }
 
 namespace App
@@ -51,6 +53,7 @@ class ApplicationObserver;
 class Property;
 class AutoTransaction;
 class ExtensionContainer;
+class DocumentPrefetcher;
 
 enum GetLinkOption {
     /// Get all links (both directly and in directly) linked to the given object
@@ -492,6 +495,10 @@ protected:
     /// open single document only
     App::Document* openDocumentPrivate(const char * FileName, const char *propFileName,
             const char *label, bool isMainDoc, DocumentCreateFlags createFlags, std::vector<std::string> &&objNames);
+    /// Read ahead the archive of a document that is about to be opened by openDocuments()
+    void prefetchDocument(const char *FileName);
+    /// Return the archive read ahead for the given file, or null if there is none
+    std::shared_ptr<const std::vector<Base::ArchiveEntry>> takePrefetchedDocument(const char *FileName);
 
     /// Helper class for App::Document to signal on close/abort transaction
     class AppExport TransactionSignaller {
@@ -572,6 +579,12 @@ private:
     static PyObject *sGetActiveTransaction  (PyObject *self,PyObject *args);
     static PyObject *sCloseActiveTransaction(PyObject *self,PyObject *args);
     static PyObject *sCheckAbort(PyObject *self,PyObject *args);
+
+    static PyObject *sStartupProfileBegin(PyObject *self,PyObject *args);
+    static PyObject *sStartupProfileEnd  (PyObject *self,PyObject *args);
+    static PyObject *sStartTrace         (PyObject *self,PyObject *args);
+    static PyObject *sStopTrace          (PyObject *self,PyObject *args);
+    static PyObject *sGetMemoryReport    (PyObject *self,PyObject *args);
     static PyMethodDef    Methods[];
     // clang-format on
 
@@ -628,6 +641,9 @@ private:
     // missing object
     std::map<std::string,std::set<std::string> > _docReloadAttempts;
 
+    // Reads the archives of pending documents on worker threads while opening
+    std::shared_ptr<DocumentPrefetcher> _docPrefetcher;
+
     bool _isRestoring{false};
     bool _allowPartial{false};
     bool _isClosingAll{false};
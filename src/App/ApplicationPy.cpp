@@ -31,11 +31,14 @@
 #include <Base/Parameter.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Sequencer.h>
+#include <Base/StartupProfile.h>
+#include <Base/Trace.h>
 
 #include "Application.h"
 #include "DocumentPy.h"
 #include "DocumentObserverPython.h"
 #include "DocumentObjectPy.h"
+#include "StringHasher.h"
 
 
 // using Base::GetConsole;
@@ -264,6 +267,37 @@ PyMethodDef Application::Methods[] = {
      "There is an active sequencer during document restore and recomputation. User may\n"
      "abort the operation by pressing the ESC key. Once detected, this function will\n"
      "trigger a Base.FreeCADAbort exception."},
+    {"startupProfileBegin",
+     (PyCFunction)Application::sStartupProfileBegin,
+     METH_VARARGS,
+     "startupProfileBegin(name) -- Begin a step of the startup profile.\n\n"
+     "The profile is written to the file given by --startup-profile."},
+    {"startupProfileEnd",
+     (PyCFunction)Application::sStartupProfileEnd,
+     METH_VARARGS,
+     "startupProfileEnd() -- End the step of the startup profile begun last."},
+    {"startTrace",
+     (PyCFunction)Application::sStartTrace,
+     METH_VARARGS,
+     "startTrace() -- Start recording the time spent in the traced zones of all threads.\n\n"
+     "The zones recorded before are discarded."},
+    {"stopTrace",
+     (PyCFunction)Application::sStopTrace,
+     METH_VARARGS,
+     "stopTrace(fileName=None) -- Stop the trace and write it to a Chrome trace file.\n\n"
+     "The file can be opened with chrome://tracing or https://ui.perfetto.dev."},
+    {"getMemoryReport",
+     (PyCFunction)Application::sGetMemoryReport,
+     METH_VARARGS,
+     "getMemoryReport(properties=False) -> dict\n"
+     "Report the memory used by the open documents, in bytes.\n\n"
+     "The dictionary holds the 'Total' of all documents, the sizes per object type in\n"
+     "'Types', per property type in 'Categories' and a dictionary per document in\n"
+     "'Documents'. A document reports its 'Total', the size of its 'Undo' stack, its\n"
+     "'StringHasher' and its 'Objects'. Each object reports its 'Type' and 'Total' and,\n"
+     "if properties is True, the size of each of its 'Properties'.\n"
+     "The sizes are those reported by getMemSize() of the C++ classes and therefore\n"
+     "estimates. View provider and scene graph memory isn't included."},
     {nullptr, nullptr, 0, nullptr} /* Sentinel */
 };
 
@@ -1188,3 +1222,131 @@ PyObject* Application::sCheckAbort(PyObject* /*self*/, PyObject* args)
     }
     PY_CATCH
 }
+
+PyObject* Application::sStartupProfileBegin(PyObject* /*self*/, PyObject* args)
+{
+    char* name;
+    if (!PyArg_ParseTuple(args, "s", &name)) {
+        return nullptr;
+    }
+
+    Base::StartupProfile::begin(name);
+    Py_Return;
+}
+
+PyObject* Application::sStartupProfileEnd(PyObject* /*self*/, PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    Base::StartupProfile::end();
+    Py_Return;
+}
+
+PyObject* Application::sStartTrace(PyObject* /*self*/, PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    Base::Trace::start();
+    Py_Return;
+}
+
+PyObject* Application::sStopTrace(PyObject* /*self*/, PyObject* args)
+{
+    char* fileName = nullptr;
+    if (!PyArg_ParseTuple(args, "|et", "utf-8", &fileName)) {
+        return nullptr;
+    }
+
+    std::string name = fileName ? fileName : "";
+    PyMem_Free(fileName);
+    Base::Trace::stop();
+    if (!name.empty() && !Base::Trace::write(name)) {
+        PyErr_Format(PyExc_IOError, "Cannot write trace to '%s'", name.c_str());
+        return nullptr;
+    }
+    Py_Return;
+}
+
+PyObject* Application::sGetMemoryReport(PyObject* /*self*/, PyObject* args)
+{
+    PyObject* withProperties = Py_False;
+    if (!PyArg_ParseTuple(args, "|O!", &PyBool_Type, &withProperties)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        bool details = Base::asBoolean(withProperties);
+        std::map<std::string, std::uint64_t> types;
+        std::map<std::string, std::uint64_t> categories;
+        std::uint64_t total = 0;
+
+        // the sizes are summed up as 64 bit to not overflow for large documents
+        auto addProperties = [&](const PropertyContainer* container, Py::Dict* sizes) {
+            std::uint64_t sum = 0;
+            std::vector<Property*> props;
+            container->getPropertyList(props);
+            for (auto prop : props) {
+                std::uint64_t size = prop->getMemSize();
+                sum += size;
+                categories[prop->getTypeId().getName()] += size;
+                if (sizes) {
+                    sizes->setItem(prop->getName(),
+                                   Py::Long(static_cast<unsigned long long>(size)));
+                }
+            }
+            return sum;
+        };
+
+        Py::Dict documents;
+        for (auto doc : GetApplication().getDocuments()) {
+            Py::Dict objects;
+            std::uint64_t docTotal = addProperties(doc, nullptr);
+            for (auto obj : doc->getObjects()) {
+                Py::Dict entry;
+                Py::Dict properties;
+                std::uint64_t size = addProperties(obj, details ? &properties : nullptr);
+                types[obj->getTypeId().getName()] += size;
+                docTotal += size;
+                entry.setItem("Type", Py::String(obj->getTypeId().getName()));
+                entry.setItem("Total", Py::Long(static_cast<unsigned long long>(size)));
+                if (details) {
+                    entry.setItem("Properties", properties);
+                }
+                objects.setItem(obj->getNameInDocument(), entry);
+            }
+
+            std::uint64_t undo = doc->getUndoMemSize();
+            std::uint64_t hasher = doc->getStringHasher()->getMemSize();
+            docTotal += undo + hasher;
+            total += docTotal;
+
+            Py::Dict entry;
+            entry.setItem("Total", Py::Long(static_cast<unsigned long long>(docTotal)));
+            entry.setItem("Undo", Py::Long(static_cast<unsigned long long>(undo)));
+            entry.setItem("StringHasher", Py::Long(static_cast<unsigned long long>(hasher)));
+            entry.setItem("Objects", objects);
+            documents.setItem(doc->getName(), entry);
+        }
+
+        auto toDict = [](const std::map<std::string, std::uint64_t>& sizes) {
+            Py::Dict dict;
+            for (const auto& it : sizes) {
+                dict.setItem(it.first, Py::Long(static_cast<unsigned long long>(it.second)));
+            }
+            return dict;
+        };
+
+        Py::Dict report;
+        report.setItem("Total", Py::Long(static_cast<unsigned long long>(total)));
+        report.setItem("Types", toDict(types));
+        report.setItem("Categories", toDict(categories));
+        report.setItem("Documents", documents);
+        return Py::new_reference_to(report);
+    }
+    PY_CATCH;
+}
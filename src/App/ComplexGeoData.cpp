@@ -28,6 +28,7 @@
 
 #ifndef _PreComp_
 #include <cstdlib>
+#include <memory>
 #endif
 
 #include <boost/regex.hpp>
@@ -37,6 +38,7 @@
 #include "ElementNamingUtils.h"
 
 #include <Base/BoundBox.h>
+#include <Base/Exception.h>
 #include <Base/Placement.h>
 #include <Base/Reader.h>
 #include <Base/Rotation.h>
@@ -137,6 +139,53 @@ void ComplexGeoData::getFacesFromSubElement(const Segment* segment,
     (void)faces;
 }
 
+std::vector<ComplexGeoData::Tessellation>
+ComplexGeoData::getLinesFromSubElements(const std::vector<IndexedName>& names) const
+{
+    std::vector<Tessellation> result(names.size());
+    for (std::size_t i = 0; i < names.size(); i++) {
+        if (!names[i]) {
+            continue;
+        }
+        try {
+            std::unique_ptr<Segment> segment(
+                getSubElement(names[i].getType(), names[i].getIndex()));
+            if (segment) {
+                getLinesFromSubElement(segment.get(), result[i].points, result[i].lines);
+            }
+        }
+        catch (const Base::Exception&) {
+            // leave the result of a missing element empty
+        }
+    }
+    return result;
+}
+
+std::vector<ComplexGeoData::Tessellation>
+ComplexGeoData::getFacesFromSubElements(const std::vector<IndexedName>& names) const
+{
+    std::vector<Tessellation> result(names.size());
+    for (std::size_t i = 0; i < names.size(); i++) {
+        if (!names[i]) {
+            continue;
+        }
+        try {
+            std::unique_ptr<Segment> segment(
+                getSubElement(names[i].getType(), names[i].getIndex()));
+            if (segment) {
+                getFacesFromSubElement(segment.get(),
+                                       result[i].points,
+                                       result[i].normals,
+                                       result[i].facets);
+            }
+        }
+        catch (const Base::Exception&) {
+            // leave the result of a missing element empty
+        }
+    }
+    return result;
+}
+
 Base::Vector3d ComplexGeoData::getPointFromLineIntersection(const Base::Vector3f& base,
                                                             const Base::Vector3f& dir) const
 {
@@ -463,7 +512,8 @@ void ComplexGeoData::Save(Base::Writer& writer) const
     writer.Stream() << writer.ind() << "<ElementMap2";
 
     if (!_persistenceName.empty()) {
-        writer.Stream() << " file=\"" << writer.addFile((_persistenceName + ".txt").c_str(), this)
+        const char* ext = writer.getMode("BinaryElementMap") ? ".dat" : ".txt";
+        writer.Stream() << " file=\"" << writer.addFile((_persistenceName + ext).c_str(), this)
                         << "\"/>\n";
         return;
     }
@@ -631,6 +681,11 @@ void ComplexGeoData::SaveDocFile(Base::Writer& writer) const
 {
     flushElementMap();
     if (_elementMap) {
+        if (writer.getMode("BinaryElementMap")) {
+            writer.Stream() << "BeginElementMap v2\n";
+            _elementMap->saveBinary(writer.Stream());
+            return;
+        }
         writer.Stream() << "BeginElementMap v1\n";
         _elementMap->save(writer.Stream());
     }
@@ -644,6 +699,13 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
     if (boost::equals(marker, "BeginElementMap")) {
         resetElementMap();
         reader >> ver;
+        if (ver == "v2") {
+            // skip the line break in front of the binary data
+            reader.get();
+            resetElementMap(std::make_shared<ElementMap>());
+            _elementMap = _elementMap->restoreBinary(Hasher, reader);
+            return;
+        }
         if (ver != "v1") {
             FC_WARN("Unknown element map format");  // NOLINT
         }
@@ -107,6 +107,14 @@ public:
         std::vector<Base::Vector3d> points;
         std::vector<Facet> facets;
     };
+    /// The tessellation of a single sub-element, see getFacesFromSubElements()
+    struct Tessellation
+    {
+        std::vector<Base::Vector3d> points;
+        std::vector<Base::Vector3d> normals;
+        std::vector<Line> lines;
+        std::vector<Facet> facets;
+    };
 
     /// Constructor
     ComplexGeoData();
@@ -137,6 +145,17 @@ public:
                                         std::vector<Base::Vector3d>& Points,
                                         std::vector<Base::Vector3d>& PointNormals,
                                         std::vector<Facet>& faces) const;
+    /** Get lines from many sub-elements in one pass
+     * Returns the tessellation of each element of \a names in the same order, it is
+     * empty for an element that does not exist. The default implementation calls
+     * getLinesFromSubElement() for each element, a subclass can share the lookup of the
+     * elements and the data needed to tessellate them.
+     */
+    virtual std::vector<Tessellation>
+    getLinesFromSubElements(const std::vector<IndexedName>& names) const;
+    /** Get faces from many sub-elements in one pass, see getLinesFromSubElements() */
+    virtual std::vector<Tessellation>
+    getFacesFromSubElements(const std::vector<IndexedName>& names) const;
     //@}
 
     /** @name Placement control */
@@ -81,6 +81,31 @@ PyObject* ComplexGeoDataPy::countSubElements(PyObject* args)
     }
 }
 
+namespace
+{
+
+std::vector<Data::IndexedName> getIndexedNames(PyObject* seq)
+{
+    std::vector<Data::IndexedName> names;
+    Py::Sequence list(seq);
+    names.reserve(list.size());
+    for (const auto& it : list) {
+        names.emplace_back(Py::String(it).as_std_string("utf-8").c_str());
+    }
+    return names;
+}
+
+Py::List getPointList(const std::vector<Base::Vector3d>& points)
+{
+    Py::List vertex;
+    for (const auto& it : points) {
+        vertex.append(Py::asObject(new Base::VectorPy(it)));
+    }
+    return vertex;
+}
+
+}  // namespace
+
 PyObject* ComplexGeoDataPy::getFacesFromSubElement(PyObject* args)
 {
     char* type;
@@ -155,6 +180,59 @@ PyObject* ComplexGeoDataPy::getLinesFromSubElement(PyObject* args)
     return Py::new_reference_to(tuple);
 }
 
+PyObject* ComplexGeoDataPy::getFacesFromSubElements(PyObject* args)
+{
+    PyObject* seq;
+    if (!PyArg_ParseTuple(args, "O", &seq)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        auto result = getComplexGeoDataPtr()->getFacesFromSubElements(getIndexedNames(seq));
+        Py::List list;
+        for (const auto& mesh : result) {
+            Py::List facet;
+            for (const auto& it : mesh.facets) {
+                Py::Tuple f(3);
+                f.setItem(0, Py::Int(int(it.I1)));
+                f.setItem(1, Py::Int(int(it.I2)));
+                f.setItem(2, Py::Int(int(it.I3)));
+                facet.append(f);
+            }
+            list.append(Py::TupleN(getPointList(mesh.points), facet));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH
+}
+
+PyObject* ComplexGeoDataPy::getLinesFromSubElements(PyObject* args)
+{
+    PyObject* seq;
+    if (!PyArg_ParseTuple(args, "O", &seq)) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        auto result = getComplexGeoDataPtr()->getLinesFromSubElements(getIndexedNames(seq));
+        Py::List list;
+        for (const auto& mesh : result) {
+            Py::List line;
+            for (const auto& it : mesh.lines) {
+                Py::Tuple l(2);
+                l.setItem(0, Py::Int(int(it.I1)));
+                l.setItem(1, Py::Int(int(it.I2)));
+                line.append(l);
+            }
+            list.append(Py::TupleN(getPointList(mesh.points), line));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH
+}
+
 PyObject* ComplexGeoDataPy::getPoints(PyObject* args)
 {
     double accuracy = 0.05;
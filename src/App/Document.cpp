@@ -59,6 +59,10 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 
 #ifndef _PreComp_
 #include <bitset>
+#include <chrono>
+#include <future>
+#include <iterator>
+#include <limits>
 #include <stack>
 #include <boost/filesystem.hpp>
 #endif
@@ -75,7 +79,9 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 #endif  // USE_OLD_DAG
 
 #include <boost/regex.hpp>
+#include <atomic>
 #include <random>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -84,6 +90,7 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 
 #include <App/DocumentPy.h>
 #include <Base/Interpreter.h>
+#include <Base/Cancellation.h>
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
@@ -91,6 +98,7 @@ recompute path. Also, it enables more complicated dependencies beyond trees.
 #include <Base/Reader.h>
 #include <Base/Writer.h>
 #include <Base/Tools.h>
+#include <Base/Trace.h>
 #include <Base/Uuid.h>
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
@@ -139,6 +147,12 @@ namespace App
 static bool globalIsRestoring;
 static bool globalIsRelabeling;
 
+// Change notifications queued by the object being recomputed on the calling
+// thread, if it is a parallel recompute worker. See Document::_recomputeConcurrently()
+static thread_local std::vector<std::function<void()>>* recomputeNotifications;
+
+std::atomic<std::size_t> DocumentP::dependencyGeneration(1);
+
 DocumentP::DocumentP()
 {
     Hasher = new StringHasher;
@@ -328,6 +342,13 @@ void Document::addOrRemovePropertyOfObject(TransactionalObject* obj, Property* p
     if (d->activeUndoTransaction && !d->rollback) {
         d->activeUndoTransaction->addOrRemoveProperty(obj, prop, add);
     }
+    if (!add && d->changeBatchDepth > 0) {
+        auto it = d->batchedChanges.find(static_cast<const DocumentObject*>(obj));
+        if (it != d->batchedChanges.end()) {
+            auto& props = it->second;
+            props.erase(std::remove(props.begin(), props.end(), prop), props.end());
+        }
+    }
 }
 
 bool Document::isPerformingTransaction() const
@@ -533,6 +554,33 @@ void Document::_commitTransaction(bool notify)
             delete mUndoTransactions.front();
             mUndoTransactions.pop_front();
         }
+        // and the memory budget, but always keep the latest transaction. The
+        // oldest transactions are moved to the disk first and only dropped if
+        // that does not free enough memory.
+        if (d->UndoMemSize > 0) {
+            std::size_t size = 0;
+            for (auto trans : mUndoTransactions) {
+                size += trans->getMemSize();
+            }
+            for (auto it = mUndoTransactions.begin();
+                 size > d->UndoMemSize && std::next(it) != mUndoTransactions.end();
+                 ++it) {
+                auto trans = *it;
+                std::size_t before = trans->getMemSize();
+                std::string name =
+                    Base::FileInfo::getTempFileName("Undo", TransientDir.getValue());
+                if (trans->spill(name)) {
+                    size -= before - trans->getMemSize();
+                }
+            }
+            while (size > d->UndoMemSize && mUndoTransactions.size() > 1) {
+                auto trans = mUndoTransactions.front();
+                size -= trans->getMemSize();
+                mUndoMap.erase(trans->getID());
+                delete trans;
+                mUndoTransactions.pop_front();
+            }
+        }
         signalCommitTransaction(*this);
 
         // closeActiveTransaction() may call again _commitTransaction()
@@ -646,8 +694,10 @@ void Document::clearDocument()
 
     d->clearRecomputeLog();
     d->objectArray.clear();
+    ++DocumentP::dependencyGeneration;
     d->objectMap.clear();
     d->objectIdMap.clear();
+    d->recomputeProfile.clear();
     d->lastObjectId = 0;
 }
 
@@ -745,7 +795,15 @@ int Document::getUndoMode() const
 
 unsigned int Document::getUndoMemSize() const
 {
-    return d->UndoMemSize;
+    std::size_t size = 0;
+    for (auto trans : mUndoTransactions) {
+        size += trans->getMemSize();
+    }
+    for (auto trans : mRedoTransactions) {
+        size += trans->getMemSize();
+    }
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
 }
 
 void Document::setUndoLimit(unsigned int UndoMemSize)
@@ -836,9 +894,21 @@ void Document::onChanged(const Property* prop)
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
     if (Who->isDerivedFrom<App::DocumentObject>()) {
-        signalBeforeChangeObject(*static_cast<const App::DocumentObject*>(Who), *What);
+        auto obj = static_cast<const App::DocumentObject*>(Who);
+        if (!isRecomputeWorker()) {
+            signalBeforeChangeObject(*obj, *What);
+        }
+        else {
+            deferRecomputeNotification([this, obj, What]() {
+                signalBeforeChangeObject(*obj, *What);
+            });
+        }
     }
     if (!d->rollback && !globalIsRelabeling) {
+        std::unique_lock<std::mutex> guard(d->recomputeMutex, std::defer_lock);
+        if (isRecomputeWorker()) {
+            guard.lock();
+        }
         _checkTransaction(nullptr, What, __LINE__);
         if (d->activeUndoTransaction) {
             d->activeUndoTransaction->addObjectChange(Who, What);
@@ -848,9 +918,88 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
+    if (isRecomputeWorker()) {
+        deferRecomputeNotification([this, Who, What]() {
+            onChangedProperty(Who, What);
+        });
+        return;
+    }
+    if (d->changeBatchDepth > 0) {
+        auto res = d->batchedChanges.emplace(Who, std::vector<const Property*>());
+        if (res.second) {
+            d->batchedObjects.push_back(Who);
+        }
+        auto& props = res.first->second;
+        if (std::find(props.begin(), props.end(), What) == props.end()) {
+            props.push_back(What);
+        }
+        return;
+    }
     signalChangedObject(*Who, *What);
 }
 
+bool Document::isFlushingChangeBatch() const
+{
+    return d->flushingChangeBatch;
+}
+
+DocumentChangeBatch::DocumentChangeBatch(Document* doc)
+    : doc(doc)
+{
+    ++doc->d->changeBatchDepth;
+}
+
+DocumentChangeBatch::~DocumentChangeBatch()
+{
+    auto d = doc->d;
+    if (--d->changeBatchDepth > 0) {
+        return;
+    }
+
+    ObjectChanges changes;
+    for (auto obj : d->batchedObjects) {
+        auto it = d->batchedChanges.find(obj);
+        if (it == d->batchedChanges.end()) {
+            continue;
+        }
+        for (auto prop : it->second) {
+            changes.emplace_back(obj, prop);
+        }
+        d->batchedChanges.erase(it);
+    }
+    d->batchedObjects.clear();
+    if (changes.empty()) {
+        return;
+    }
+
+    try {
+        doc->signalChangedObjects(*doc, changes);
+        Base::FlagToggler<bool> flag(d->flushingChangeBatch);
+        for (const auto& change : changes) {
+            doc->signalChangedObject(*change.first, *change.second);
+        }
+    }
+    catch (Base::Exception& e) {
+        e.ReportException();
+    }
+    catch (...) {
+    }
+}
+
+bool Document::isRecomputeWorker()
+{
+    return recomputeNotifications != nullptr;
+}
+
+bool Document::deferRecomputeNotification(const std::function<void()>& notify)
+{
+    if (!recomputeNotifications) {
+        return false;
+    }
+    recomputeNotifications->push_back(notify);
+    return true;
+}
+
 void Document::setTransactionMode(int iMode)
 {
     d->iTransactionMode = iMode;
@@ -1631,6 +1780,8 @@ void Document::addRecomputeObject(DocumentObject* obj)
 
 std::vector<App::DocumentObject*> Document::importObjects(Base::XMLReader& reader)
 {
+    // Pasting many objects changes their properties many times over, notify them only once
+    DocumentChangeBatch changeBatch(this);
     d->hashers.clear();
     Base::FlagToggler<> flag(globalIsRestoring, false);
     Base::ObjectStatusLocker<Status, Document> restoreBit(Status::Restoring, this);
@@ -2121,6 +2272,7 @@ private:
 
 bool Document::saveToFile(const char* filename) const
 {
+    FC_TRACE_ZONE("Document::saveToFile", filename);
     signalStartSave(*this, filename);
 
     auto hGrp = App::GetApplication().GetParameterGroupByPath(
@@ -2186,11 +2338,32 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        writer.setThreads(static_cast<int>(hGrp->GetInt("SaveThreads", 0)));
+
+        // In the fast container mode large binary files are stored uncompressed or
+        // with a lower level, given as a list of 'extension:level' pairs
+        if (hGrp->GetBool("FastContainer", false)) {
+            std::string entries = hGrp->GetASCII("FastContainerEntries", "brp:0;bin:0;bms:0");
+            std::vector<std::string> tokens;
+            boost::split(tokens, entries, boost::is_any_of(";"), boost::token_compress_on);
+            for (const auto& token : tokens) {
+                if (token.empty()) {
+                    continue;
+                }
+                auto pos = token.find(':');
+                int level = pos == std::string::npos ? 0 : std::atoi(token.c_str() + pos + 1);
+                writer.setEntryLevel(token.substr(0, pos),
+                                     Base::clamp<int>(level, Z_NO_COMPRESSION, Z_BEST_COMPRESSION));
+            }
+        }
         writer.putNextEntry("Document.xml");
 
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
             writer.setMode("BinaryBrep");
         }
+        if (hGrp->GetBool("SaveBinaryElementMap", false)) {
+            writer.setMode("BinaryElementMap");
+        }
 
         writer.Stream() << "<?xml version='1.0' encoding='utf-8'?>" << endl
                         << "<!--" << endl
@@ -2260,6 +2433,7 @@ void Document::restore(const char* filename,
                        bool delaySignal,
                        const std::vector<std::string>& objNames)
 {
+    FC_TRACE_ZONE("Document::restore", filename);
     clearUndos();
     d->activeObject = nullptr;
 
@@ -2277,8 +2451,10 @@ void Document::restore(const char* filename,
 
     d->clearRecomputeLog();
     d->objectArray.clear();
+    ++DocumentP::dependencyGeneration;
     d->objectMap.clear();
     d->objectIdMap.clear();
+    d->recomputeProfile.clear();
     d->lastObjectId = 0;
 
     if (signal) {
@@ -2291,17 +2467,54 @@ void Document::restore(const char* filename,
     if (!filename) {
         filename = FileName.getValue();
     }
-    Base::FileInfo fi(filename);
-    Base::ifstream file(fi, std::ios::in | std::ios::binary);
-    std::streambuf* buf = file.rdbuf();
-    std::streamoff size = buf->pubseekoff(0, std::ios::end, std::ios::in);
-    buf->pubseekoff(0, std::ios::beg, std::ios::in);
-    if (size < 22) {  // an empty zip archive has 22 bytes
-        throw Base::FileException("Invalid project file", filename);
+    // Use the archive if Application::openDocuments() has already read it ahead
+    auto archive = GetApplication().takePrefetchedDocument(filename);
+    if (archive && archive->empty()) {
+        archive.reset();
+    }
+    std::unique_ptr<Base::ifstream> file;
+    std::unique_ptr<zipios::ZipInputStream> zipstream;
+    if (!archive) {
+        Base::FileInfo fi(filename);
+        file = std::make_unique<Base::ifstream>(fi, std::ios::in | std::ios::binary);
+        std::streambuf* buf = file->rdbuf();
+        std::streamoff size = buf->pubseekoff(0, std::ios::end, std::ios::in);
+        buf->pubseekoff(0, std::ios::beg, std::ios::in);
+        if (size < 22) {  // an empty zip archive has 22 bytes
+            throw Base::FileException("Invalid project file", filename);
+        }
+        zipstream = std::make_unique<zipios::ZipInputStream>(*file);
     }
 
-    zipios::ZipInputStream zipstream(file);
-    Base::XMLReader reader(filename, zipstream);
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    // Inflate the data files on worker threads while Document.xml is parsed and the objects
+    // are created, the zip stream is only left for the files if that fails
+    std::future<std::vector<Base::ArchiveEntry>> inflating;
+    if (!archive && hGrp->GetBool("ParallelRestore", true)) {
+        inflating = std::async(std::launch::async, [path = std::string(filename)]() {
+            return Base::XMLReader::readArchive(path.c_str(), 0, false);
+        });
+    }
+    std::unique_ptr<Base::Streambuf> xmlbuf;
+    std::unique_ptr<std::istream> xmlstream;
+    std::unique_ptr<Base::XMLReader> xmlreader;
+    if (hGrp->GetBool("FastXMLReader", true)) {
+        // Parse Document.xml in place from memory instead of through Xerces
+        std::string xml = archive ? archive->front().Data
+                                  : std::string(std::istreambuf_iterator<char>(*zipstream),
+                                                std::istreambuf_iterator<char>());
+        xmlreader = std::make_unique<Base::XMLReader>(filename, std::move(xml));
+    }
+    else if (archive) {
+        xmlbuf = std::make_unique<Base::Streambuf>(archive->front().Data);
+        xmlstream = std::make_unique<std::istream>(xmlbuf.get());
+        xmlreader = std::make_unique<Base::XMLReader>(filename, *xmlstream);
+    }
+    else {
+        xmlreader = std::make_unique<Base::XMLReader>(filename, *zipstream);
+    }
+    Base::XMLReader& reader = *xmlreader;
 
     if (!reader.isValid()) {
         throw Base::FileException("Error reading compression file", filename);
@@ -2330,7 +2543,21 @@ void Document::restore(const char* filename,
     // Note: This file doesn't need to be available if the document has been created
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
-    reader.readFiles(zipstream);
+    if (inflating.valid()) {
+        try {
+            archive = std::make_shared<const std::vector<Base::ArchiveEntry>>(inflating.get());
+        }
+        catch (...) {
+            // read the files through the zip stream, which reports the errors
+        }
+    }
+    if (archive) {
+        std::size_t index = 0;
+        reader.readFiles(*archive, index);
+    }
+    else {
+        reader.readFiles(*zipstream);
+    }
 
     DocumentP::checkStringHasher(reader);
 
@@ -2819,9 +3046,62 @@ Document::getDependencyList(const std::vector<App::DocumentObject*>& objectArray
     return ret;
 }
 
+void Document::_dependencyChanged()
+{
+    ++DocumentP::dependencyGeneration;
+}
+
+std::size_t Document::_getDependencyGeneration()
+{
+    return DocumentP::dependencyGeneration;
+}
+
+const std::vector<App::DocumentObject*>& Document::_getDependencyOrder()
+{
+    if (d->dependencyOrderGeneration != DocumentP::dependencyGeneration) {
+        FC_TIME_INIT(t);
+        d->dependencyOrder = getDependencyList(d->objectArray, DepSort);
+        d->dependencyOrderGeneration = DocumentP::dependencyGeneration;
+        FC_TIME_LOG(t, "Rebuild dependency order");
+    }
+    return d->dependencyOrder;
+}
+
+std::vector<App::DocumentObject*> Document::_getRecomputeCone()
+{
+    // Walk the cached dependency order once. It is sorted so that any object
+    // comes after the objects it depends on, thus the downstream cone of the
+    // touched objects can be collected in a single pass.
+    std::vector<App::DocumentObject*> res;
+    std::unordered_set<App::DocumentObject*> cone;
+    for (auto obj : _getDependencyOrder()) {
+        bool pending = obj->isTouched() || obj->mustRecompute();
+        if (!pending) {
+            for (auto dep : obj->getOutList()) {
+                if (cone.count(dep)) {
+                    pending = true;
+                    break;
+                }
+            }
+        }
+        if (pending) {
+            cone.insert(obj);
+            res.push_back(obj);
+        }
+    }
+    return res;
+}
+
 std::vector<App::Document*> Document::getDependentDocuments(bool sort)
 {
-    return getDependentDocuments({this}, sort);
+    std::size_t generation = DocumentP::dependencyGeneration;
+    auto& cached = d->dependentDocuments[sort ? 1 : 0];
+    auto& cachedGeneration = d->dependentDocumentsGeneration[sort ? 1 : 0];
+    if (cachedGeneration != generation) {
+        cached = getDependentDocuments({this}, sort);
+        cachedGeneration = generation;
+    }
+    return cached;
 }
 
 std::vector<App::Document*> Document::getDependentDocuments(std::vector<App::Document*> pending,
@@ -3085,6 +3365,7 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
                         bool* hasError,
                         int options)
 {
+    FC_TRACE_ZONE("Document::recompute", getName());
     if (d->undoing || d->rollback) {
         if (FC_LOG_INSTANCE.isEnabled(FC_LOGLEVEL_LOG)) {
             FC_WARN("Ignore document recompute on undo/redo");
@@ -3093,6 +3374,7 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
     }
 
     int objectCount = 0;
+    d->recomputeByDependency.clear();
     if (testStatus(Document::PartialDoc)) {
         if (mustExecute()) {
             FC_WARN("Please reload partial document '" << Label.getValue()
@@ -3139,8 +3421,9 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
     }
     std::reverse(topoSortedObjects.begin(),topoSortedObjects.end());
 #else
-    auto topoSortedObjects =
-        getDependencyList(objs.empty() ? d->objectArray : objs, DepSort | options);
+    auto topoSortedObjects = (objs.empty() && !options)
+        ? _getRecomputeCone()
+        : getDependencyList(objs.empty() ? d->objectArray : objs, DepSort | options);
 #endif
     for (auto obj : topoSortedObjects) {
         obj->setStatus(ObjectStatus::PendingRecompute, true);
@@ -3149,8 +3432,39 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
     ParameterGrp::handle hGrp =
         GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
+    bool parallel = hGrp->GetBool("ParallelRecompute", false);
+    // A feature running longer than the limit is stopped where it polls Base::Cancellation and
+    // reported as failed, the features not depending on it are still recomputed
+    d->recomputeTimeLimit = hGrp->GetFloat("RecomputeTimeLimit", 0.0);
+    // a cancel request only applies to the recompute running when it is made
+    Base::Cancellation::reset();
+
+    // Group the sorted objects into levels, where all dependencies of an object
+    // are in a lower level. Objects of the same level are independent of each
+    // other, so a stable sort by level still gives a valid recompute order with
+    // each level forming one contiguous range.
+    std::unordered_map<App::DocumentObject*, int> levels;
+    if (parallel) {
+        levels.reserve(topoSortedObjects.size());
+        for (auto obj : topoSortedObjects) {
+            int level = 0;
+            for (auto dep : obj->getOutList()) {
+                auto it = levels.find(dep);
+                if (it != levels.end()) {
+                    level = std::max(level, it->second + 1);
+                }
+            }
+            levels[obj] = level;
+        }
+        std::stable_sort(topoSortedObjects.begin(),
+                         topoSortedObjects.end(),
+                         [&levels](App::DocumentObject* a, App::DocumentObject* b) {
+                             return levels[a] < levels[b];
+                         });
+    }
 
     std::set<App::DocumentObject*> filter;
+    std::unordered_set<App::DocumentObject*> done;
     size_t idx = 0;
 
     FC_TIME_INIT(t2);
@@ -3164,31 +3478,23 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
                                                                 topoSortedObjects.size());
             }
             FC_LOG("Recompute pass " << passes);
-            for (; idx < topoSortedObjects.size(); ++idx) {
-                auto obj = topoSortedObjects[idx];
-                if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
-                    continue;
-                }
-                // ask the object if it should be recomputed
-                bool doRecompute = false;
-                if (obj->mustRecompute()) {
-                    doRecompute = true;
-                    ++objectCount;
-                    int res = _recomputeFeature(obj);
-                    if (res) {
-                        if (hasError) {
-                            *hasError = true;
-                        }
-                        if (res < 0) {
-                            passes = 2;
-                            break;
-                        }
-                        // if something happened filter all object in its
-                        // inListRecursive from the queue then proceed
-                        obj->getInListEx(filter, true);
-                        filter.insert(obj);
-                        continue;
+            done.clear();
+
+            // Handle the result of recomputing an object. Returns false if
+            // the recompute is aborted
+            auto finishObject = [&](App::DocumentObject* obj, bool doRecompute, int res) {
+                if (res) {
+                    if (hasError) {
+                        *hasError = true;
+                    }
+                    if (res < 0) {
+                        return false;
                     }
+                    // if something happened filter all object in its
+                    // inListRecursive from the queue then proceed
+                    obj->getInListEx(filter, true);
+                    filter.insert(obj);
+                    return true;
                 }
                 if (obj->isTouched() || doRecompute) {
                     signalRecomputedObject(*obj);
@@ -3196,11 +3502,70 @@ int Document::recompute(const std::vector<App::DocumentObject*>& objs,
                     // set all dependent object touched to force recompute
                     for (auto inObjIt : obj->getInList()) {
                         inObjIt->enforceRecompute();
+                        d->recomputeByDependency.insert(inObjIt);
                     }
                 }
                 if (seq) {
                     seq->next(true);
                 }
+                return true;
+            };
+
+            for (; idx < topoSortedObjects.size(); ++idx) {
+                auto obj = topoSortedObjects[idx];
+                if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
+                    continue;
+                }
+                if (done.erase(obj)) {
+                    // already recomputed together with its level
+                    continue;
+                }
+                // ask the object if it should be recomputed
+                if (!obj->mustRecompute()) {
+                    if (!finishObject(obj, false, 0)) {
+                        passes = 2;
+                        break;
+                    }
+                    continue;
+                }
+
+                std::vector<App::DocumentObject*> batch {obj};
+                if (parallel && obj->canRecomputeConcurrently()) {
+                    int level = levels[obj];
+                    for (size_t j = idx + 1; j < topoSortedObjects.size(); ++j) {
+                        auto other = topoSortedObjects[j];
+                        if (levels[other] != level) {
+                            break;
+                        }
+                        if (other->isAttachedToDocument() && !filter.count(other)
+                            && other->canRecomputeConcurrently() && other->mustRecompute()) {
+                            batch.push_back(other);
+                        }
+                    }
+                }
+
+                std::vector<int> results;
+                if (batch.size() > 1) {
+                    results = _recomputeConcurrently(batch);
+                }
+                else {
+                    results.push_back(_recomputeFeature(obj));
+                }
+
+                bool aborted = false;
+                for (size_t i = 0; i < batch.size(); ++i) {
+                    ++objectCount;
+                    if (i) {
+                        done.insert(batch[i]);
+                    }
+                    if (!finishObject(batch[i], true, results[i])) {
+                        aborted = true;
+                    }
+                }
+                if (aborted) {
+                    passes = 2;
+                    break;
+                }
             }
             // check if all objects are recomputed but still thouched
             for (size_t i = 0; i < topoSortedObjects.size(); ++i) {
@@ -3457,11 +3822,87 @@ const char* Document::getErrorDescription(const App::DocumentObject* Obj) const
     return d->findRecomputeLog(Obj);
 }
 
+// describe why an object is about to be recomputed for the recompute profile
+static std::string recomputeReason(const DocumentP* d, const DocumentObject* Feat)
+{
+    std::vector<Property*> props;
+    Feat->getPropertyList(props);
+    std::string reason;
+    for (auto prop : props) {
+        if (prop->isTouched()) {
+            reason += reason.empty() ? "Touched: " : ", ";
+            reason += prop->getName();
+        }
+    }
+    if (!reason.empty()) {
+        return reason;
+    }
+    if (d->recomputeByDependency.count(Feat) > 0) {
+        return "Dependency";
+    }
+    if (Feat->testStatus(ObjectStatus::Enforce)) {
+        return "Enforced";
+    }
+    if (Feat->isTouched()) {
+        return "Touched";
+    }
+    return "Must execute";
+}
+
+std::vector<RecomputeProfileEntry> Document::getRecomputeProfile() const
+{
+    std::lock_guard<std::mutex> guard(d->recomputeMutex);
+    std::vector<RecomputeProfileEntry> entries;
+    entries.reserve(d->recomputeProfile.size());
+    for (const auto& it : d->recomputeProfile) {
+        entries.push_back(it.second);
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.time > b.time;
+    });
+    return entries;
+}
+
+void Document::clearRecomputeProfile()
+{
+    std::lock_guard<std::mutex> guard(d->recomputeMutex);
+    d->recomputeProfile.clear();
+}
+
+void Document::_addRecomputeExtensionTime(const DocumentObject* Feat,
+                                          const std::string& extension,
+                                          double seconds)
+{
+    if (!Feat->isAttachedToDocument()) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(d->recomputeMutex);
+    auto& entry = d->recomputeProfile[Feat->getID()];
+    entry.name = Feat->getNameInDocument();
+    entry.extensions[extension] += seconds;
+}
+
 // call the recompute of the Feature and handle the exceptions and errors.
 int Document::_recomputeFeature(DocumentObject* Feat)
 {
+    FC_TRACE_ZONE("Document::_recomputeFeature", Feat->getNameInDocument());
     FC_LOG("Recomputing " << Feat->getFullName());
 
+    // record the time spent on any return path
+    struct ProfileRecorder
+    {
+        DocumentP* d;
+        const DocumentObject* obj;
+        std::string reason;
+        std::chrono::steady_clock::time_point start;
+        ~ProfileRecorder()
+        {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            d->addRecomputeProfile(obj, reason, elapsed.count());
+        }
+    } recorder {d, Feat, recomputeReason(d, Feat), std::chrono::steady_clock::now()};
+
+    Base::Cancellation::Deadline deadline(d->recomputeTimeLimit);
     DocumentObjectExecReturn* returnCode = nullptr;
     try {
         returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
@@ -3474,6 +3915,12 @@ int Document::_recomputeFeature(DocumentObject* Feat)
         }
     }
     catch (Base::AbortException& e) {
+        if (Base::Cancellation::deadlineExceeded()) {
+            FC_ERR(Feat->getFullName() << " exceeded the recompute time limit of "
+                                       << d->recomputeTimeLimit << " s");
+            d->addRecomputeLog("Recompute time limit exceeded", Feat);
+            return 1;
+        }
         e.ReportException();
         FC_LOG("Failed to recompute " << Feat->getFullName() << ": " << e.what());
         d->addRecomputeLog("User abort", Feat);
@@ -3515,6 +3962,63 @@ int Document::_recomputeFeature(DocumentObject* Feat)
     return 0;
 }
 
+std::vector<int> Document::_recomputeConcurrently(const std::vector<DocumentObject*>& Feats)
+{
+    std::vector<int> results(Feats.size(), 0);
+    std::vector<std::vector<std::function<void()>>> notifications(Feats.size());
+    std::atomic<size_t> next(0);
+
+    auto worker = [&]() {
+        for (size_t i = next++; i < Feats.size(); i = next++) {
+            recomputeNotifications = &notifications[i];
+            try {
+                results[i] = _recomputeFeature(Feats[i]);
+            }
+            catch (...) {
+                d->addRecomputeLog("Unknown exception!", Feats[i]);
+                results[i] = 1;
+            }
+            recomputeNotifications = nullptr;
+        }
+    };
+
+    ParameterGrp::handle hGrp =
+        GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
+    size_t count = std::max<long>(hGrp->GetInt("ParallelRecomputeThreads", 0), 0);
+    if (count == 0) {
+        count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    count = std::min(count, Feats.size());
+
+    FC_LOG("Recompute " << Feats.size() << " objects using " << count << " threads");
+    {
+        // Features running on the workers may need the interpreter, e.g. for
+        // evaluating expressions, so let them take the GIL while we wait.
+        std::unique_ptr<Base::PyGILStateRelease> release;
+        if (Py_IsInitialized() && PyGILState_Check()) {
+            release = std::make_unique<Base::PyGILStateRelease>();
+        }
+        std::vector<std::thread> threads;
+        threads.reserve(count - 1);
+        for (size_t i = 1; i < count; ++i) {
+            threads.emplace_back(worker);
+        }
+        // the calling thread works on the batch as well
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    // replay the change notifications on the main thread in recompute order
+    for (auto& list : notifications) {
+        for (auto& notify : list) {
+            notify();
+        }
+    }
+    return results;
+}
+
 bool Document::recomputeFeature(DocumentObject* Feat, bool recursive)
 {
     // delete recompute log
@@ -3593,6 +4097,7 @@ DocumentObject* Document::addObject(const char* sType,
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    ++DocumentP::dependencyGeneration;
 
     // If we are restoring, don't set the Label object now; it will be restored later. This is to
     // avoid potential duplicate label conflicts later.
@@ -3705,6 +4210,7 @@ Document::addObjects(const char* sType, const std::vector<std::string>& objectNa
         pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
         // insert in the vector
         d->objectArray.push_back(pcObject);
+        ++DocumentP::dependencyGeneration;
 
         pcObject->Label.setValue(ObjectName);
 
@@ -3775,6 +4281,7 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    ++DocumentP::dependencyGeneration;
 
     pcObject->Label.setValue(ObjectName);
 
@@ -3804,6 +4311,7 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
     }
     d->objectIdMap[pcObject->_Id] = pcObject;
     d->objectArray.push_back(pcObject);
+    ++DocumentP::dependencyGeneration;
     // cache the pointer to the name string in the Object (for performance of
     // DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
@@ -3900,6 +4408,8 @@ void Document::removeObject(const char* sName)
 
     // remove the ID before possibly deleting the object
     d->objectIdMap.erase(pos->second->_Id);
+    d->recomputeProfile.erase(pos->second->_Id);
+    d->batchedChanges.erase(pos->second);
     // Unset the bit to be on the safe side
     pos->second->setStatus(ObjectStatus::Remove, false);
 
@@ -3924,6 +4434,7 @@ void Document::removeObject(const char* sName)
          ++obj) {
         if (*obj == pos->second) {
             d->objectArray.erase(obj);
+            ++DocumentP::dependencyGeneration;
             break;
         }
     }
@@ -4001,6 +4512,8 @@ void Document::_removeObject(DocumentObject* pcObject)
     // remove from map
     pcObject->setStatus(ObjectStatus::Remove, false);  // Unset the bit to be on the safe side
     d->objectIdMap.erase(pcObject->_Id);
+    d->recomputeProfile.erase(pcObject->_Id);
+    d->batchedChanges.erase(pcObject);
     d->objectMap.erase(pos);
 
     for (std::vector<DocumentObject*>::iterator it = d->objectArray.begin();
@@ -4008,6 +4521,7 @@ void Document::_removeObject(DocumentObject* pcObject)
          ++it) {
         if (*it == pcObject) {
             d->objectArray.erase(it);
+            ++DocumentP::dependencyGeneration;
             break;
         }
     }
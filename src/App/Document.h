@@ -54,6 +54,24 @@ class Transaction;
 class StringHasher;
 using StringHasherRef = Base::Reference<StringHasher>;
 
+/// Changed properties of objects, see Document::signalChangedObjects
+using ObjectChanges = std::vector<std::pair<const DocumentObject*, const Property*>>;
+
+/// Time spent in recomputing a single object, see Document::getRecomputeProfile()
+struct RecomputeProfileEntry
+{
+    /// name of the object in the document
+    std::string name;
+    /// accumulated wall time in seconds
+    double time {0.0};
+    /// how many times the object was recomputed
+    long count {0};
+    /// why the object was recomputed the last time
+    std::string reason;
+    /// accumulated wall time in seconds spent in the execute() of each extension
+    std::map<std::string, double> extensions;
+};
+
 /// The document class
 class AppExport Document: public App::PropertyContainer
 {
@@ -139,6 +157,8 @@ public:
     boost::signals2::signal<void(const App::DocumentObject&, const App::Property&)> signalBeforeChangeObject;
     /// signal on changed Object
     boost::signals2::signal<void(const App::DocumentObject&, const App::Property&)> signalChangedObject;
+    /// signal at the end of a DocumentChangeBatch with all the changes it coalesced
+    boost::signals2::signal<void(const App::Document&, const App::ObjectChanges&)> signalChangedObjects;
     /// signal on manually called DocumentObject::touch()
     boost::signals2::signal<void(const App::DocumentObject&)> signalTouchedObject;
     /// signal on relabeled Object
@@ -570,12 +590,44 @@ public:
     /// Indicate if there is any document restoring/importing
     static bool isAnyRestoring();
 
+    /** @name Parallel recompute */
+    //@{
+    /// Check if the calling thread is recomputing an object on a worker thread
+    static bool isRecomputeWorker();
+    /** Queue a change notification raised while recomputing on a worker thread
+     *
+     * @param notify: the notification to be called on the main thread once the
+     * worker has finished.
+     *
+     * @return Return false if the calling thread is not a recompute worker, in
+     * which case @a notify is not queued and the caller shall notify directly.
+     */
+    static bool deferRecomputeNotification(const std::function<void()>& notify);
+    //@}
+
+    /** @name Change batches */
+    //@{
+    /** Check if signalChangedObject is sent for the changes coalesced by a
+     * DocumentChangeBatch. Observers handling signalChangedObjects can skip those.
+     */
+    bool isFlushingChangeBatch() const;
+    //@}
+
+    /** @name Recompute profile */
+    //@{
+    /// Return the recompute statistics of all objects since the last clearRecomputeProfile()
+    std::vector<RecomputeProfileEntry> getRecomputeProfile() const;
+    /// Clear the recorded recompute statistics
+    void clearRecomputeProfile();
+    //@}
+
     friend class Application;
     /// because of transaction handling
     friend class TransactionalObject;
     friend class DocumentObject;
     friend class Transaction;
     friend class TransactionDocumentObject;
+    friend class DocumentChangeBatch;
 
     /// Destruction
     ~Document() override;
@@ -603,8 +655,24 @@ protected:
     /// helper which Recompute only this feature
     /// @return 0 if succeeded, 1 if failed, -1 if aborted by user.
     int _recomputeFeature(DocumentObject* Feat);
+    /// helper which recomputes mutually independent features on worker threads
+    /// @return the result of _recomputeFeature() for each feature.
+    std::vector<int> _recomputeConcurrently(const std::vector<DocumentObject*>& Feats);
+    /// record the time spent in the execute() of an extension of the given object
+    void _addRecomputeExtensionTime(const DocumentObject* Feat,
+                                    const std::string& extension,
+                                    double seconds);
     void _clearRedos();
 
+    /// notify that the dependencies of some object have changed
+    static void _dependencyChanged();
+    /// return a counter bumped on any change of object dependencies in any document
+    static std::size_t _getDependencyGeneration();
+    /// return all objects sorted by dependency, rebuilt only if dependencies changed
+    const std::vector<App::DocumentObject*>& _getDependencyOrder();
+    /// return the touched objects and the objects depending on them in recompute order
+    std::vector<App::DocumentObject*> _getRecomputeCone();
+
     /// refresh the internal dependency graph
     void _rebuildDependencyList(
         const std::vector<App::DocumentObject*>& objs = std::vector<App::DocumentObject*>());
@@ -642,6 +710,26 @@ private:
     std::string myName;
 };
 
+/** Coalesce the change notifications of the objects of a document
+ *
+ * While an instance is alive, signalChangedObject of the document is not sent for every change
+ * of a property. Each changed property is recorded once, and when the outermost instance goes
+ * away signalChangedObjects is sent with all of them, followed by one signalChangedObject for
+ * each. The changes of objects and dynamic properties removed in between are dropped.
+ */
+class AppExport DocumentChangeBatch
+{
+public:
+    explicit DocumentChangeBatch(Document* doc);
+    ~DocumentChangeBatch();
+
+    DocumentChangeBatch(const DocumentChangeBatch&) = delete;
+    DocumentChangeBatch& operator=(const DocumentChangeBatch&) = delete;
+
+private:
+    Document* doc;
+};
+
 template<typename T>
 inline std::vector<T*> Document::getObjectsOfType() const
 {
@@ -24,7 +24,10 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <chrono>
+#include <mutex>
 #include <stack>
+#include <unordered_set>
 #endif
 
 #include <App/DocumentObjectPy.h>
@@ -187,7 +190,12 @@ App::DocumentObjectExecReturn* DocumentObject::executeExtensions()
     this->setStatus(App::RecomputeExtension, false);  // reset the flag
     auto vector = getExtensionsDerivedFromType<App::DocumentObjectExtension>();
     for (auto ext : vector) {
+        auto start = std::chrono::steady_clock::now();
         auto ret = ext->extensionExecute();
+        if (auto doc = getDocument()) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            doc->_addRecomputeExtensionTime(this, ext->name(), elapsed.count());
+        }
         if (ret != StdReturn) {
             return ret;
         }
@@ -492,11 +500,119 @@ const std::vector<App::DocumentObject*>& DocumentObject::getInList() const
 // of objects. And this may not be the worst case. getInListEx() has no such
 // problem.
 
+namespace
+{
+
+// Recursive in and out lists of objects, cached until the dependencies of any
+// object change, see Document::_dependencyChanged()
+struct RecursiveListCache
+{
+    using ListMap = std::unordered_map<const DocumentObject*, std::vector<DocumentObject*>>;
+
+    std::mutex mutex;
+    std::size_t generation = 0;
+    std::size_t size = 0;
+    ListMap inLists;
+    ListMap outLists;
+
+    // must be called with the mutex locked
+    void sync(std::size_t currentGeneration)
+    {
+        if (generation != currentGeneration) {
+            inLists.clear();
+            outLists.clear();
+            size = 0;
+            generation = currentGeneration;
+        }
+    }
+
+    // must be called with the mutex locked
+    void add(ListMap& lists, const DocumentObject* obj, const std::vector<DocumentObject*>& list)
+    {
+        if (!obj->isAttachedToDocument()) {
+            return;
+        }
+        // The lists of all objects of a large document may grow quadratically,
+        // so limit the total number of cached entries
+        static ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Document");
+        auto limit = static_cast<std::size_t>(
+            std::max<long>(hGrp->GetInt("RecursiveListCacheSize", 1000000), 0));
+        if (size + list.size() > limit) {
+            return;
+        }
+        size += list.size();
+        lists[obj] = list;
+    }
+};
+
+RecursiveListCache& recursiveListCache()
+{
+    static RecursiveListCache cache;
+    return cache;
+}
+
+// Walk the in lists starting at obj. Objects with a cached recursive in list
+// are not walked again, their list is merged instead.
+void collectInListRecursive(const RecursiveListCache& cache,
+                            const DocumentObject* obj,
+                            std::vector<DocumentObject*>& res)
+{
+    std::unordered_set<DocumentObject*> inSet;
+    std::stack<const DocumentObject*> pendings;
+    pendings.push(obj);
+    while (!pendings.empty()) {
+        auto current = pendings.top();
+        pendings.pop();
+        for (auto o : current->getInList()) {
+            if (!o || !o->isAttachedToDocument() || !inSet.insert(o).second) {
+                continue;
+            }
+            res.push_back(o);
+            auto it = cache.inLists.find(o);
+            if (it == cache.inLists.end()) {
+                pendings.push(o);
+                continue;
+            }
+            for (auto parent : it->second) {
+                if (inSet.insert(parent).second) {
+                    res.push_back(parent);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
 std::vector<App::DocumentObject*> DocumentObject::getInListRecursive() const
 {
-    std::set<App::DocumentObject*> inSet;
-    std::vector<App::DocumentObject*> res;
-    getInListEx(inSet, true, &res);
+    return getInListsRecursive({const_cast<DocumentObject*>(this)}).front();
+}
+
+std::vector<std::vector<App::DocumentObject*>>
+DocumentObject::getInListsRecursive(const std::vector<App::DocumentObject*>& objs)
+{
+    std::vector<std::vector<App::DocumentObject*>> res(objs.size());
+#ifdef USE_OLD_DAG
+    for (std::size_t i = 0; i < objs.size(); ++i) {
+        std::set<App::DocumentObject*> inSet;
+        objs[i]->getInListEx(inSet, true, &res[i]);
+    }
+#else
+    auto& cache = recursiveListCache();
+    std::lock_guard<std::mutex> guard(cache.mutex);
+    cache.sync(Document::_getDependencyGeneration());
+    for (std::size_t i = 0; i < objs.size(); ++i) {
+        auto it = cache.inLists.find(objs[i]);
+        if (it != cache.inLists.end()) {
+            res[i] = it->second;
+            continue;
+        }
+        collectInListRecursive(cache, objs[i], res[i]);
+        cache.add(cache.inLists, objs[i], res[i]);
+    }
+#endif
     return res;
 }
 
@@ -551,18 +667,9 @@ void DocumentObject::getInListEx(std::set<App::DocumentObject*>& inSet,
         return;
     }
 
-    std::stack<DocumentObject*> pendings;
-    pendings.push(const_cast<DocumentObject*>(this));
-    while (!pendings.empty()) {
-        auto obj = pendings.top();
-        pendings.pop();
-        for (auto o : obj->getInList()) {
-            if (o && o->isAttachedToDocument() && inSet.insert(o).second) {
-                pendings.push(o);
-                if (inList) {
-                    inList->push_back(o);
-                }
-            }
+    for (auto o : getInListRecursive()) {
+        if (inSet.insert(o).second && inList) {
+            inList->push_back(o);
         }
     }
 
@@ -598,16 +705,34 @@ void _getOutListRecursive(std::set<DocumentObject*>& objSet,
 
 std::vector<App::DocumentObject*> DocumentObject::getOutListRecursive() const
 {
+    return getOutListsRecursive({const_cast<DocumentObject*>(this)}).front();
+}
+
+std::vector<std::vector<App::DocumentObject*>>
+DocumentObject::getOutListsRecursive(const std::vector<App::DocumentObject*>& objs)
+{
+    std::vector<std::vector<App::DocumentObject*>> res(objs.size());
     // number of objects in document is a good estimate in result size
     int maxDepth = GetApplication().checkLinkDepth(0);
-    std::set<App::DocumentObject*> result;
 
-    // using a recursive helper to collect all OutLists
-    _getOutListRecursive(result, this, this, maxDepth);
+    auto& cache = recursiveListCache();
+    std::lock_guard<std::mutex> guard(cache.mutex);
+    cache.sync(Document::_getDependencyGeneration());
+    for (std::size_t i = 0; i < objs.size(); ++i) {
+        auto it = cache.outLists.find(objs[i]);
+        if (it != cache.outLists.end()) {
+            res[i] = it->second;
+            continue;
+        }
+        std::set<App::DocumentObject*> result;
 
-    std::vector<App::DocumentObject*> array;
-    array.insert(array.begin(), result.begin(), result.end());
-    return array;
+        // using a recursive helper to collect all OutLists
+        _getOutListRecursive(result, objs[i], objs[i], maxDepth);
+
+        res[i].insert(res[i].begin(), result.begin(), result.end());
+        cache.add(cache.outLists, objs[i], res[i]);
+    }
+    return res;
 }
 
 // helper for isInInListRecursive()
@@ -811,6 +936,12 @@ void DocumentObject::onBeforeChange(const Property* prop)
         onBeforeChangeProperty(_pDoc, prop);
     }
 
+    if (Document::isRecomputeWorker()) {
+        Document::deferRecomputeNotification([this, prop]() {
+            signalBeforeChange(*this, *prop);
+        });
+        return;
+    }
     signalBeforeChange(*this, *prop);
 }
 
@@ -884,6 +1015,12 @@ void DocumentObject::onChanged(const Property* prop)
         _pDoc->onChangedProperty(this, prop);
     }
 
+    if (Document::isRecomputeWorker()) {
+        Document::deferRecomputeNotification([this, prop]() {
+            signalChanged(*this, *prop);
+        });
+        return;
+    }
     signalChanged(*this, *prop);
 }
 
@@ -892,6 +1029,7 @@ void DocumentObject::clearOutListCache() const
     _outList.clear();
     _outListMap.clear();
     _outListCached = false;
+    Document::_dependencyChanged();
 }
 
 PyObject* DocumentObject::getPyObject()
@@ -1254,6 +1392,7 @@ void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
     auto it = std::find(_inList.begin(), _inList.end(), rmvObj);
     if (it != _inList.end()) {
         _inList.erase(it);
+        Document::_dependencyChanged();
     }
 #else
     (void)rmvObj;
@@ -1268,6 +1407,7 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     // only once this removal would clear the object from the inlist, even though there may be other
     // link properties from this object that link to us.
     _inList.push_back(newObj);
+    Document::_dependencyChanged();
 #else
     (void)newObj;
 #endif  // USE_OLD_DAG
@@ -282,7 +282,11 @@ public:
 
     /// returns a list of objects linked by the property
     std::vector<App::DocumentObject*> getOutListOfProperty(App::Property*) const;
-    /// returns a list of objects this object is pointing to by Links and all further descended
+    /** returns a list of objects this object is pointing to by Links and all further descended
+     *
+     * The recursive in and out lists of objects are cached until the
+     * dependencies of any object change.
+     */
     std::vector<App::DocumentObject*> getOutListRecursive() const;
     /// clear internal out list cache
     void clearOutListCache() const;
@@ -296,6 +300,16 @@ public:
 #endif
         /// get all objects link directly or indirectly to this object
         std::vector<App::DocumentObject*> getInListRecursive() const;
+    /** Get the recursive in lists of many objects at once
+     *
+     * Same as calling getInListRecursive() on each object, but the objects
+     * share the cached in lists of each other while walking the graph.
+     */
+    static std::vector<std::vector<App::DocumentObject*>>
+    getInListsRecursive(const std::vector<App::DocumentObject*>& objs);
+    /// Get the recursive out lists of many objects at once, see getOutListRecursive()
+    static std::vector<std::vector<App::DocumentObject*>>
+    getOutListsRecursive(const std::vector<App::DocumentObject*>& objs);
     /** Get a set of all objects linking to this object, including possible external parent objects
      *
      * @param inSet [out]: a set containing all objects linking to this object.
@@ -373,6 +387,19 @@ public:
      */
     virtual short mustExecute() const;
 
+    /** Check if this object can be recomputed on a worker thread
+     *
+     * If parallel recompute is enabled, the document recomputes independent
+     * objects returning true here concurrently. Such an object must not use
+     * the GUI or run Python code in its execute(), and shall only read the
+     * objects it depends on. Change notifications of the object are queued
+     * and emitted on the main thread after the recompute.
+     */
+    virtual bool canRecomputeConcurrently() const
+    {
+        return false;
+    }
+
     /** Recompute only this feature
      *
      * @param recursive: set to true to recompute any dependent objects as well
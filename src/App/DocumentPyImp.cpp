@@ -1123,6 +1123,44 @@ PyObject* DocumentPy::getDependentDocuments(PyObject* args)
     PY_CATCH;
 }
 
+PyObject* DocumentPy::getRecomputeProfile(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        Py::Dict ret;
+        for (const auto& entry : getDocumentPtr()->getRecomputeProfile()) {
+            Py::Dict extensions;
+            for (const auto& ext : entry.extensions) {
+                extensions.setItem(ext.first, Py::Float(ext.second));
+            }
+            Py::Dict item;
+            item.setItem("time", Py::Float(entry.time));
+            item.setItem("count", Py::Long(entry.count));
+            item.setItem("reason", Py::String(entry.reason));
+            item.setItem("extensions", extensions);
+            ret.setItem(entry.name, item);
+        }
+        return Py::new_reference_to(ret);
+    }
+    PY_CATCH;
+}
+
+PyObject* DocumentPy::clearRecomputeProfile(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        getDocumentPtr()->clearRecomputeProfile();
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
 Py::Boolean DocumentPy::getRestoring() const
 {
     return {getDocumentPtr()->testStatus(Document::Status::Restoring)};
@@ -1,5 +1,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <limits>
+#include <sstream>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -44,6 +46,81 @@ namespace Data
 static std::unordered_map<const ElementMap*, unsigned> _elementMapToId;
 static std::unordered_map<unsigned, ElementMapPtr> _idToElementMap;
 
+namespace
+{
+
+// Helpers of the binary element map format. Unsigned integers are written
+// with a variable length encoding of 7 bits per byte, signed ones zigzag
+// encoded first, and strings prefixed by their length.
+
+void writeCount(std::ostream& stream, unsigned long value)
+{
+    const unsigned long mask {0x7f};
+    const unsigned long more {0x80};
+    while (value >= more) {
+        stream.put(static_cast<char>((value & mask) | more));
+        value >>= 7;
+    }
+    stream.put(static_cast<char>(value));
+}
+
+void writeSigned(std::ostream& stream, long value)
+{
+    auto bits = static_cast<unsigned long>(value);
+    writeCount(stream, value < 0 ? ~(bits << 1) : bits << 1);
+}
+
+void writeBytes(std::ostream& stream, const char* data, std::size_t size)
+{
+    writeCount(stream, size);
+    stream.write(data, static_cast<std::streamsize>(size));
+}
+
+unsigned long readCount(std::istream& stream)
+{
+    const unsigned long mask {0x7f};
+    const int more {0x80};
+    const int maxShift {64};
+    unsigned long value = 0;
+    for (int shift = 0; shift < maxShift; shift += 7) {
+        int c = stream.get();
+        if (c == std::char_traits<char>::eof()) {
+            FC_THROWM(Base::RuntimeError, "unexpected end of element map");  // NOLINT
+        }
+        value |= (static_cast<unsigned long>(c) & mask) << shift;
+        if ((c & more) == 0) {
+            return value;
+        }
+    }
+    FC_THROWM(Base::RuntimeError, "Invalid element map integer");  // NOLINT
+}
+
+int readInt(std::istream& stream)
+{
+    unsigned long value = readCount(stream);
+    if (value > static_cast<unsigned long>(std::numeric_limits<int>::max())) {
+        FC_THROWM(Base::RuntimeError, "Invalid element map count");  // NOLINT
+    }
+    return static_cast<int>(value);
+}
+
+long readSigned(std::istream& stream)
+{
+    unsigned long bits = readCount(stream);
+    return static_cast<long>((bits & 1U) != 0U ? ~(bits >> 1) : bits >> 1);
+}
+
+std::string readBytes(std::istream& stream)
+{
+    std::string res(readInt(stream), '\0');
+    if (!stream.read(&res[0], static_cast<std::streamsize>(res.size()))) {
+        FC_THROWM(Base::RuntimeError, "unexpected end of element map");  // NOLINT
+    }
+    return res;
+}
+
+}  // namespace
+
 
 void ElementMap::init()
 {
@@ -491,6 +568,365 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
         FC_THROWM(Base::RuntimeError, "unexpected end of child element map");  // NOLINT
     }
 
+    // Share this map with other objects referring to the same saved map
+    if (id != 0) {
+        _idToElementMap[id] = shared_from_this();
+    }
+    return shared_from_this();
+}
+
+void ElementMap::saveBinary(std::ostream& stream,
+                            const std::map<const ElementMap*, int>& childMapSet,
+                            const std::map<QByteArray, int>& postfixMap) const
+{
+    writeCount(stream, this->indexedNames.size());
+
+    for (auto& indexedName : this->indexedNames) {
+        writeBytes(stream, indexedName.first, std::strlen(indexedName.first));
+
+        writeCount(stream, indexedName.second.children.size());
+        for (auto& vv : indexedName.second.children) {
+            auto& child = vv.second;
+            int mapIndex = 0;
+            if (child.elementMap) {
+                auto it = childMapSet.find(child.elementMap.get());
+                if (it == childMapSet.end() || it->second == 0) {
+                    FC_ERR("Invalid child element map");  // NOLINT
+                }
+                else {
+                    mapIndex = it->second;
+                }
+            }
+            writeCount(stream, child.indexedName.getIndex());
+            writeSigned(stream, child.offset);
+            writeSigned(stream, child.count);
+            writeSigned(stream, child.tag);
+            writeCount(stream, mapIndex);
+            writeBytes(stream, child.postfix.constData(), child.postfix.size());
+            std::vector<long> sids;
+            for (auto& sid : child.sids) {
+                if (sid.isMarked()) {
+                    sids.push_back(sid.value());
+                }
+            }
+            writeCount(stream, sids.size());
+            for (long sid : sids) {
+                writeCount(stream, sid);
+            }
+        }
+
+        writeCount(stream, indexedName.second.names.size());
+        for (auto& dequeueOfMappedNameRef : indexedName.second.names) {
+            int refCount = 0;
+            for (auto ref = &dequeueOfMappedNameRef; ref && ref->name; ref = ref->next.get()) {
+                ++refCount;
+            }
+            writeCount(stream, refCount);
+            for (auto ref = &dequeueOfMappedNameRef; ref && ref->name; ref = ref->next.get()) {
+                ::App::StringID::IndexID prefixID {};
+                prefixID.id = 0;
+                const QByteArray& data = ref->name.dataBytes();
+                IndexedName idx(data);
+                bool printName = true;
+                if (idx) {
+                    auto key = QByteArray::fromRawData(idx.getType(),
+                                                       static_cast<int>(qstrlen(idx.getType())));
+                    auto it = postfixMap.find(key);
+                    if (it != postfixMap.end()) {
+                        stream.put(':');
+                        writeCount(stream, it->second);
+                        writeCount(stream, idx.getIndex());
+                        printName = false;
+                    }
+                }
+                else {
+                    prefixID = ::App::StringID::fromString(data);
+                    if (prefixID.id != 0) {
+                        for (auto& sid : ref->sids) {
+                            if (sid.isMarked() && sid.value() == prefixID.id) {
+                                stream.put('$');
+                                writeBytes(stream, data.constData(), data.size());
+                                printName = false;
+                                break;
+                            }
+                        }
+                        if (printName) {
+                            prefixID.id = 0;
+                        }
+                    }
+                }
+                if (printName) {
+                    stream.put(';');
+                    writeBytes(stream, data.constData(), data.size());
+                }
+
+                const QByteArray& postfix = ref->name.postfixBytes();
+                if (postfix.isEmpty()) {
+                    writeCount(stream, 0);
+                }
+                else {
+                    auto it = postfixMap.find(postfix);
+                    assert(it != postfixMap.end());
+                    writeCount(stream, it->second);
+                }
+
+                std::vector<long> sids;
+                for (auto& sid : ref->sids) {
+                    if (sid.isMarked() && sid.value() != prefixID.id) {
+                        sids.push_back(sid.value());
+                    }
+                }
+                writeCount(stream, sids.size());
+                for (long sid : sids) {
+                    writeCount(stream, sid);
+                }
+            }
+        }
+    }
+}
+
+void ElementMap::saveBinary(std::ostream& stream) const
+{
+    std::map<const ElementMap*, int> childMapSet;
+    std::vector<const ElementMap*> childMaps;
+    std::map<QByteArray, int> postfixMap;
+    std::vector<QByteArray> postfixes;
+
+    collectChildMaps(childMapSet, childMaps, postfixMap, postfixes);
+
+    writeCount(stream, this->_id);
+    writeCount(stream, postfixes.size());
+    for (auto& postfix : postfixes) {
+        writeBytes(stream, postfix.constData(), postfix.size());
+    }
+    writeCount(stream, childMaps.size());
+    std::ostringstream buffer(std::ios::out | std::ios::binary);
+    for (auto& elementMap : childMaps) {
+        buffer.str(std::string());
+        elementMap->saveBinary(buffer, childMapSet, postfixMap);
+        writeCount(stream, elementMap->_id);
+        const std::string& data = buffer.str();
+        writeBytes(stream, data.c_str(), data.size());
+    }
+}
+
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream)
+{
+    unsigned id = readInt(stream);
+    auto& map = _idToElementMap[id];
+    if (map) {
+        return map;
+    }
+
+    int count = readInt(stream);
+    std::vector<std::string> postfixes;
+    postfixes.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        postfixes.push_back(readBytes(stream));
+    }
+
+    count = readInt(stream);
+    if (count == 0) {
+        FC_THROWM(Base::RuntimeError, "Invalid element map");  // NOLINT
+    }
+    std::vector<ElementMapPtr> childMaps;
+    childMaps.reserve(count - 1);
+    for (int i = 0; i < count; ++i) {
+        unsigned mapId = readInt(stream);
+        std::istringstream data(readBytes(stream), std::ios::in | std::ios::binary);
+        if (i + 1 == count) {
+            return restoreBinary(hasherRef, data, mapId, childMaps, postfixes);
+        }
+        auto& childMap = _idToElementMap[mapId];
+        if (childMap) {
+            // already restored by another object, no need to parse it again
+            childMaps.push_back(childMap);
+        }
+        else {
+            childMaps.push_back(std::make_shared<ElementMap>()->restoreBinary(hasherRef,
+                                                                             data,
+                                                                             mapId,
+                                                                             childMaps,
+                                                                             postfixes));
+        }
+    }
+    return shared_from_this();
+}
+
+ElementMapPtr ElementMap::restoreBinary(::App::StringHasherRef hasherRef,
+                                        std::istream& stream,
+                                        unsigned id,
+                                        std::vector<ElementMapPtr>& childMaps,
+                                        const std::vector<std::string>& postfixes)
+{
+    if (id != 0) {
+        auto& map = _idToElementMap[id];
+        if (map) {
+            return map;
+        }
+    }
+
+    const char* hasherWarn = nullptr;
+    const char* hasherIDWarn = nullptr;
+    const char* postfixWarn = nullptr;
+    const char* childSIDWarn = nullptr;
+
+    auto getPostfix = [&postfixes](int index) -> const std::string* {
+        if (index <= 0 || index > static_cast<int>(postfixes.size())) {
+            return nullptr;
+        }
+        return &postfixes[index - 1];
+    };
+
+    int typeCount = readInt(stream);
+    for (int i = 0; i < typeCount; ++i) {
+        std::string type = readBytes(stream);
+        IndexedName idx(type.c_str(), 1);
+
+        auto& indices = this->indexedNames[idx.getType()];
+        int childCount = readInt(stream);
+        for (int j = 0; j < childCount; ++j) {
+            int cIndex = readInt(stream);
+            long offset = readSigned(stream);
+            long count = readSigned(stream);
+            long tag = readSigned(stream);
+            int mapIndex = readInt(stream);
+            if (offset < 0 || offset > std::numeric_limits<int>::max()) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child offset");  // NOLINT
+            }
+            if (count < std::numeric_limits<int>::min() || count > std::numeric_limits<int>::max()) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child count");  // NOLINT
+            }
+            if (mapIndex > static_cast<int>(childMaps.size())) {
+                FC_THROWM(Base::RuntimeError, "Invalid element child map index");  // NOLINT
+            }
+            auto& child = indices.children[cIndex + static_cast<int>(offset + count)];
+            child.indexedName = IndexedName::fromConst(idx.getType(), cIndex);
+            child.offset = static_cast<int>(offset);
+            child.count = static_cast<int>(count);
+            child.tag = tag;
+            if (mapIndex > 0) {
+                child.elementMap = childMaps[mapIndex - 1];
+            }
+            else {
+                child.elementMap = nullptr;
+            }
+            child.postfix = readBytes(stream).c_str();
+            this->childElements[child.postfix].childMap = &child;
+            this->childElementSize += child.count;
+
+            int sidCount = readInt(stream);
+            child.sids.reserve(sidCount);
+            for (int k = 0; k < sidCount; ++k) {
+                auto childID = static_cast<long>(readCount(stream));
+                auto sid = hasherRef ? hasherRef->getID(childID) : ::App::StringIDRef();
+                if (!sid) {
+                    childSIDWarn = "Missing element child string id";
+                }
+                else {
+                    child.sids.push_back(sid);
+                }
+            }
+        }
+
+        int nameCount = readInt(stream);
+        indices.names.resize(nameCount);
+        for (int j = 0; j < nameCount; ++j) {
+            idx.setIndex(j);
+            auto* ref = &indices.names[j];
+            int refCount = readInt(stream);
+            for (int r = 0; r < refCount; ++r) {
+                if (r != 0) {
+                    ref->next = std::make_unique<MappedNameRef>();
+                    ref = ref->next.get();
+                }
+
+                ::App::StringID::IndexID prefixID {};
+                prefixID.id = 0;
+
+                switch (stream.get()) {
+                    case ':': {
+                        const std::string* name = getPostfix(readInt(stream));
+                        if (!name) {
+                            FC_THROWM(Base::RuntimeError, "Invalid element name index");  // NOLINT
+                        }
+                        int elementIndex = readInt(stream);
+                        ref->name = MappedName(IndexedName::fromConst(name->c_str(), elementIndex));
+                        break;
+                    }
+                    case '$':
+                        ref->name = MappedName(readBytes(stream));
+                        prefixID = ::App::StringID::fromString(ref->name.dataBytes());
+                        break;
+                    case ';':
+                        ref->name = MappedName(readBytes(stream));
+                        break;
+                    default:
+                        FC_THROWM(Base::RuntimeError, "Invalid element name marker");  // NOLINT
+                }
+
+                int postfixIndex = readInt(stream);
+                if (postfixIndex != 0) {
+                    const std::string* postfix = getPostfix(postfixIndex);
+                    if (!postfix) {
+                        postfixWarn = "Invalid element postfix index";
+                    }
+                    else {
+                        ref->name += *postfix;
+                    }
+                }
+
+                this->mappedNames.emplace(ref->name, idx);
+
+                int sidCount = readInt(stream);
+                if (!hasherRef) {
+                    for (int k = 0; k < sidCount; ++k) {
+                        readCount(stream);
+                    }
+                    if (sidCount != 0) {
+                        hasherWarn = "No hasherRef";
+                    }
+                    continue;
+                }
+
+                ref->sids.reserve(sidCount + (prefixID.id != 0 ? 1 : 0));
+                if (prefixID.id != 0) {
+                    auto sid = hasherRef->getID(prefixID.id);
+                    if (!sid) {
+                        hasherIDWarn = "Missing element name prefix id";
+                    }
+                    else {
+                        ref->sids.push_back(sid);
+                    }
+                }
+                for (int k = 0; k < sidCount; ++k) {
+                    auto sid = hasherRef->getID(static_cast<long>(readCount(stream)));
+                    if (!sid) {
+                        hasherIDWarn = "Invalid element name string id";
+                    }
+                    else {
+                        ref->sids.push_back(sid);
+                    }
+                }
+            }
+        }
+    }
+    if (hasherWarn) {
+        FC_WARN(hasherWarn);  // NOLINT
+    }
+    if (hasherIDWarn) {
+        FC_WARN(hasherIDWarn);  // NOLINT
+    }
+    if (postfixWarn) {
+        FC_WARN(postfixWarn);  // NOLINT
+    }
+    if (childSIDWarn) {
+        FC_WARN(childSIDWarn);  // NOLINT
+    }
+
+    if (id != 0) {
+        _idToElementMap[id] = shared_from_this();
+    }
     return shared_from_this();
 }
 
@@ -101,6 +101,23 @@ public:
      */
     ElementMapPtr restore(::App::StringHasherRef hasherRef, std::istream& stream);
 
+    /** Serialize this map in a compact binary format
+     *
+     * Same content as save(), but with variable length integers instead of
+     * text, and each map prefixed by its size so that a map already restored
+     * by another object can be skipped without parsing.
+     * @param stream: serialized stream, must be opened in binary mode
+     */
+    void saveBinary(std::ostream& stream) const;
+
+    /** Deserialize and restore this map from the format written by saveBinary()
+     * @param hasherRef: where all the StringIDs are stored
+     * @param stream: stream to deserialize
+     * @return the restored map, which may be an already restored map shared
+     * with another object.
+     */
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef, std::istream& stream);
+
 
     /** Add a sub-element name mapping.
      *
@@ -233,6 +250,18 @@ private:
                           std::vector<ElementMapPtr>& childMaps,
                           const std::vector<std::string>& postfixes);
 
+    /// Binary version of the private save() above
+    void saveBinary(std::ostream& stream,
+                    const std::map<const ElementMap*, int>& childMapSet,
+                    const std::map<QByteArray, int>& postfixMap) const;
+
+    /// Binary version of the private restore() above
+    ElementMapPtr restoreBinary(::App::StringHasherRef hasherRef,
+                                std::istream& stream,
+                                unsigned id,
+                                std::vector<ElementMapPtr>& childMaps,
+                                const std::vector<std::string>& postfixes);
+
     /** Associate the MappedName \c name with the IndexedName \c idx.
      * @param name: the name to add
      * @param idx: the indexed name that \c name will be bound to
@@ -850,6 +850,601 @@ void Expression::Component::toString(std::ostream &ss, bool persistent) const {
 }
 
 
+//
+// Compiled evaluation
+//
+// Expressions that consist of numbers, units, arithmetic and comparison
+// operators, conditionals and references to numeric properties are lowered
+// into a flat list of instructions operating on a stack of plain values, so
+// that no Python object has to be created for these nodes. Constant sub
+// expressions are folded at compile time. Any other node is still evaluated
+// through Python, and its result is converted back. The instructions follow
+// the Python semantics of the interpreted path. Whenever they cannot reproduce
+// a result exactly (e.g. in case of an error or an integer overflow), the
+// expression is evaluated once more through the interpreted path, which then
+// produces the usual result or error.
+//
+
+namespace {
+
+// Thrown when the compiled evaluation has to be abandoned
+struct CompiledFallback {};
+
+// Integers up to this magnitude are represented exactly as double
+constexpr double MaxExactInteger = 9007199254740992.0;
+
+bool compiledEvaluationEnabled()
+{
+    static ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Expression");
+    return hGrp->GetBool("CompiledEvaluation", true);
+}
+
+long checkedAdd(long a, long b)
+{
+    if ((b > 0 && a > LONG_MAX - b) || (b < 0 && a < LONG_MIN - b))
+        throw CompiledFallback();
+    return a + b;
+}
+
+long checkedSub(long a, long b)
+{
+    if ((b < 0 && a > LONG_MAX + b) || (b > 0 && a < LONG_MIN + b))
+        throw CompiledFallback();
+    return a - b;
+}
+
+long checkedMul(long a, long b)
+{
+    if (a == 0 || b == 0)
+        return 0;
+    if (a > 0) {
+        if (b > 0 ? a > LONG_MAX / b : b < LONG_MIN / a)
+            throw CompiledFallback();
+    }
+    else if (b > 0 ? a < LONG_MIN / b : b < LONG_MAX / a) {
+        throw CompiledFallback();
+    }
+    return a * b;
+}
+
+// Same as Python's float.__mod__
+double pythonMod(double a, double b)
+{
+    if (b == 0.0)
+        throw CompiledFallback();
+    double mod = std::fmod(a, b);
+    if (mod != 0.0) {
+        if ((b < 0.0) != (mod < 0.0))
+            mod += b;
+    }
+    else {
+        mod = std::copysign(0.0, b);
+    }
+    return mod;
+}
+
+// Same as Python's float.__pow__, restricted to results that do not raise
+double pythonPow(double a, double b)
+{
+    if (!std::isfinite(a) || !std::isfinite(b)
+            || (a == 0.0 && b < 0.0)
+            || (a < 0.0 && b != std::floor(b)))
+        throw CompiledFallback();
+    double res = std::pow(a, b);
+    if (!std::isfinite(res))
+        throw CompiledFallback();
+    return res;
+}
+
+} // anonymous namespace
+
+struct Expression::Program
+{
+    enum class Kind {
+        Int,
+        Float,
+        Bool,
+        Quantity,
+    };
+
+    struct Value
+    {
+        Kind kind = Kind::Int;
+        long integer = 0;
+        double number = 0.0;
+        Base::Quantity quantity;
+
+        static Value fromInt(long v) {
+            Value res;
+            res.integer = v;
+            return res;
+        }
+        static Value fromBool(bool v) {
+            Value res;
+            res.kind = Kind::Bool;
+            res.integer = v ? 1 : 0;
+            return res;
+        }
+        static Value fromFloat(double v) {
+            Value res;
+            res.kind = Kind::Float;
+            res.number = v;
+            return res;
+        }
+        static Value fromQuantity(const Base::Quantity &q) {
+            Value res;
+            res.kind = Kind::Quantity;
+            res.quantity = q;
+            return res;
+        }
+        // Same conversion as pyFromQuantity()
+        static Value fromNumber(const Base::Quantity &q) {
+            if (!q.getUnit().isEmpty())
+                return fromQuantity(q);
+            long l;
+            int i;
+            if (essentiallyInteger(q.getValue(), l, i))
+                return fromInt(l);
+            return fromFloat(q.getValue());
+        }
+
+        bool isInteger() const {
+            return kind == Kind::Int || kind == Kind::Bool;
+        }
+        double toDouble() const {
+            switch (kind) {
+            case Kind::Float:
+                return number;
+            case Kind::Quantity:
+                return quantity.getValue();
+            default:
+                return static_cast<double>(integer);
+            }
+        }
+        Base::Quantity toQuantity() const {
+            if (kind == Kind::Quantity)
+                return quantity;
+            return Base::Quantity(toDouble());
+        }
+        bool isTrue() const {
+            return isInteger() ? integer != 0 : toDouble() != 0.0;
+        }
+
+        // Same as pyObjectToAny()
+        App::any toAny() const {
+            switch (kind) {
+            case Kind::Float:
+                return App::any(number);
+            case Kind::Quantity:
+                return App::any(quantity);
+            default:
+                return App::any(integer);
+            }
+        }
+        // Same as expressionFromPy()
+        Expression *toExpression(const DocumentObject *owner) const {
+            switch (kind) {
+            case Kind::Bool:
+                return new ConstantExpression(owner, integer ? "True" : "False",
+                                              Quantity(integer ? 1.0 : 0.0));
+            case Kind::Float:
+                return new NumberExpression(owner, Quantity(number));
+            case Kind::Quantity:
+                return new NumberExpression(owner, quantity);
+            default:
+                return new NumberExpression(owner, Quantity(static_cast<double>(integer)));
+            }
+        }
+    };
+
+    enum class OpCode {
+        Push,           // push constants[arg]
+        Variable,       // push the value of the VariableExpression node
+        Python,         // push the value of node as evaluated by Python
+        Unary,          // apply operator arg to the top of the stack
+        Binary,         // pop the right operand and apply operator arg
+        JumpIfFalse,    // pop the condition and jump to arg if it is false
+        Jump,           // jump to arg
+    };
+
+    struct Instruction
+    {
+        OpCode code;
+        int arg;
+        const Expression *node;
+    };
+
+    std::vector<Instruction> code;
+    std::vector<Value> constants;
+    std::size_t stackSize = 0;
+
+    std::size_t emit(OpCode op, int arg = 0, const Expression *node = nullptr) {
+        code.push_back({op, arg, node});
+        return code.size() - 1;
+    }
+
+    void pushConstant(const Value &value) {
+        constants.push_back(value);
+        emit(OpCode::Push, static_cast<int>(constants.size() - 1));
+    }
+
+    // Replace the instructions starting at 'start', which only operate on
+    // constants, with their result
+    bool fold(std::size_t start) {
+        Value value;
+        try {
+            value = execute(start);
+        }
+        catch (...) {
+            // leave it to the evaluation to report the error
+            return false;
+        }
+        code.resize(start);
+        pushConstant(value);
+        return true;
+    }
+
+    // Returns true if the node compiles into a constant
+    bool compileNode(const Expression *expr, std::size_t depth) {
+        stackSize = std::max(stackSize, depth + 1);
+        std::size_t start = code.size();
+        Base::Type type = expr->getTypeId();
+
+        if (!expr->components.empty()) {
+            emit(OpCode::Python, 0, expr);
+            return false;
+        }
+
+        if (type == NumberExpression::getClassTypeId()
+                || type == UnitExpression::getClassTypeId()) {
+            pushConstant(Value::fromNumber(static_cast<const UnitExpression*>(expr)->getQuantity()));
+            return true;
+        }
+
+        if (type == ConstantExpression::getClassTypeId()) {
+            auto constant = static_cast<const ConstantExpression*>(expr);
+            std::string name = constant->getName();
+            if (name == "True" || name == "False") {
+                pushConstant(Value::fromBool(name == "True"));
+                return true;
+            }
+            if (name != "None") {
+                pushConstant(Value::fromNumber(constant->getQuantity()));
+                return true;
+            }
+        }
+        else if (type == OperatorExpression::getClassTypeId()) {
+            auto opExpr = static_cast<const OperatorExpression*>(expr);
+            int op = opExpr->getOperator();
+            switch (op) {
+            case OperatorExpression::NEG:
+            case OperatorExpression::POS: {
+                bool isConstant = compileNode(opExpr->getLeft(), depth);
+                emit(OpCode::Unary, op);
+                return isConstant && fold(start);
+            }
+            case OperatorExpression::ADD:
+            case OperatorExpression::SUB:
+            case OperatorExpression::MUL:
+            case OperatorExpression::UNIT:
+            case OperatorExpression::DIV:
+            case OperatorExpression::MOD:
+            case OperatorExpression::POW:
+            case OperatorExpression::EQ:
+            case OperatorExpression::NEQ:
+            case OperatorExpression::LT:
+            case OperatorExpression::GT:
+            case OperatorExpression::LTE:
+            case OperatorExpression::GTE: {
+                bool isConstant = compileNode(opExpr->getLeft(), depth);
+                isConstant = compileNode(opExpr->getRight(), depth + 1) && isConstant;
+                emit(OpCode::Binary, op);
+                return isConstant && fold(start);
+            }
+            default:
+                break;
+            }
+        }
+        else if (type == ConditionalExpression::getClassTypeId()) {
+            auto conditional = static_cast<const ConditionalExpression*>(expr);
+            if (compileNode(conditional->getCondition(), depth)) {
+                bool test = constants[code.back().arg].isTrue();
+                code.resize(start);
+                return compileNode(test ? conditional->getTrueExpression()
+                                        : conditional->getFalseExpression(), depth);
+            }
+            std::size_t jumpIfFalse = emit(OpCode::JumpIfFalse);
+            compileNode(conditional->getTrueExpression(), depth);
+            std::size_t jump = emit(OpCode::Jump);
+            code[jumpIfFalse].arg = static_cast<int>(code.size());
+            compileNode(conditional->getFalseExpression(), depth);
+            code[jump].arg = static_cast<int>(code.size());
+            return false;
+        }
+        else if (type == VariableExpression::getClassTypeId()) {
+            emit(OpCode::Variable, 0, expr);
+            return false;
+        }
+
+        emit(OpCode::Python, 0, expr);
+        return false;
+    }
+
+    bool compile(const Expression *expr) {
+        compileNode(expr, 0);
+        // Nothing to gain if the expression has to be evaluated by Python as a whole
+        return code.size() != 1 || code[0].code != OpCode::Python;
+    }
+
+    static Value pythonValue(const Expression *node) {
+        Base::PyGILStateLocker lock;
+        Py::Object pyobj = node->getPyValue();
+        PyObject *value = pyobj.ptr();
+        if (PyObject_TypeCheck(value, &Base::QuantityPy::Type))
+            return Value::fromQuantity(*static_cast<Base::QuantityPy*>(value)->getQuantityPtr());
+        if (PyBool_Check(value))
+            return Value::fromBool(value == Py_True);
+        if (PyLong_Check(value)) {
+            long l = PyLong_AsLong(value);
+            if (l == -1 && PyErr_Occurred()) {
+                PyErr_Clear();
+                throw CompiledFallback();
+            }
+            return Value::fromInt(l);
+        }
+        if (PyFloat_Check(value))
+            return Value::fromFloat(PyFloat_AsDouble(value));
+        throw CompiledFallback();
+    }
+
+    static Value variableValue(const Expression *node) {
+        auto prop = static_cast<const VariableExpression*>(node)->getWholeProperty();
+        if (prop) {
+            if (prop->isDerivedFrom(PropertyQuantity::getClassTypeId()))
+                return Value::fromQuantity(static_cast<const PropertyQuantity*>(prop)->getQuantityValue());
+            if (prop->isDerivedFrom(PropertyFloat::getClassTypeId()))
+                return Value::fromFloat(static_cast<const PropertyFloat*>(prop)->getValue());
+            if (prop->isDerivedFrom(PropertyInteger::getClassTypeId()))
+                return Value::fromInt(static_cast<const PropertyInteger*>(prop)->getValue());
+            if (prop->isDerivedFrom(PropertyBool::getClassTypeId()))
+                return Value::fromBool(static_cast<const PropertyBool*>(prop)->getValue());
+        }
+        return pythonValue(node);
+    }
+
+    static Value unary(int op, const Value &value) {
+        if (value.kind == Kind::Quantity)
+            return Value::fromQuantity(op == OperatorExpression::NEG ? value.quantity * -1.0 : value.quantity);
+        if (value.kind == Kind::Float)
+            return Value::fromFloat(op == OperatorExpression::NEG ? -value.number : value.number);
+        if (op == OperatorExpression::NEG)
+            return Value::fromInt(checkedSub(0, value.integer));
+        return Value::fromInt(value.integer);
+    }
+
+    static bool compare(int op, const Value &l, const Value &r) {
+        if (l.kind == Kind::Quantity && r.kind == Kind::Quantity) {
+            // Same as QuantityPy::richCompare()
+            switch (op) {
+            case OperatorExpression::EQ:
+                return l.quantity == r.quantity;
+            case OperatorExpression::NEQ:
+                return !(l.quantity == r.quantity);
+            case OperatorExpression::LT:
+                return l.quantity < r.quantity;
+            case OperatorExpression::LTE:
+                return l.quantity < r.quantity || l.quantity == r.quantity;
+            case OperatorExpression::GT:
+                return !(l.quantity < r.quantity) && !(l.quantity == r.quantity);
+            default:
+                return !(l.quantity < r.quantity);
+            }
+        }
+        if (l.isInteger() && r.isInteger()) {
+            switch (op) {
+            case OperatorExpression::EQ:
+                return l.integer == r.integer;
+            case OperatorExpression::NEQ:
+                return l.integer != r.integer;
+            case OperatorExpression::LT:
+                return l.integer < r.integer;
+            case OperatorExpression::LTE:
+                return l.integer <= r.integer;
+            case OperatorExpression::GT:
+                return l.integer > r.integer;
+            default:
+                return l.integer >= r.integer;
+            }
+        }
+        // Python compares integers with floats exactly
+        if ((l.isInteger() && r.kind == Kind::Float && std::fabs(l.toDouble()) > MaxExactInteger)
+                || (r.isInteger() && l.kind == Kind::Float && std::fabs(r.toDouble()) > MaxExactInteger))
+            throw CompiledFallback();
+        double a = l.toDouble();
+        double b = r.toDouble();
+        switch (op) {
+        case OperatorExpression::EQ:
+            return a == b;
+        case OperatorExpression::NEQ:
+            return a != b;
+        case OperatorExpression::LT:
+            return a < b;
+        case OperatorExpression::LTE:
+            return a <= b;
+        case OperatorExpression::GT:
+            return a > b;
+        default:
+            return a >= b;
+        }
+    }
+
+    static Value binary(int op, const Value &l, const Value &r) {
+        switch (op) {
+        case OperatorExpression::EQ:
+        case OperatorExpression::NEQ:
+        case OperatorExpression::LT:
+        case OperatorExpression::GT:
+        case OperatorExpression::LTE:
+        case OperatorExpression::GTE:
+            return Value::fromBool(compare(op, l, r));
+        default:
+            break;
+        }
+
+        if (l.kind == Kind::Quantity || r.kind == Kind::Quantity) {
+            // Same as the number handlers of QuantityPy
+            switch (op) {
+            case OperatorExpression::ADD:
+                return Value::fromQuantity(l.toQuantity() + r.toQuantity());
+            case OperatorExpression::SUB:
+                return Value::fromQuantity(l.toQuantity() - r.toQuantity());
+            case OperatorExpression::MUL:
+            case OperatorExpression::UNIT:
+                return Value::fromQuantity(l.toQuantity() * r.toQuantity());
+            case OperatorExpression::DIV:
+                return Value::fromQuantity(l.toQuantity() / r.toQuantity());
+            case OperatorExpression::MOD:
+                if (l.kind != Kind::Quantity)
+                    throw CompiledFallback();
+                return Value::fromQuantity(Base::Quantity(pythonMod(l.quantity.getValue(), r.toDouble()),
+                                                          l.quantity.getUnit()));
+            default:
+                if (l.kind != Kind::Quantity)
+                    throw CompiledFallback();
+                if (r.kind == Kind::Quantity)
+                    return Value::fromQuantity(l.quantity.pow(r.quantity));
+                return Value::fromQuantity(l.quantity.pow(r.toDouble()));
+            }
+        }
+
+        if (l.isInteger() && r.isInteger()) {
+            long a = l.integer;
+            long b = r.integer;
+            switch (op) {
+            case OperatorExpression::ADD:
+                return Value::fromInt(checkedAdd(a, b));
+            case OperatorExpression::SUB:
+                return Value::fromInt(checkedSub(a, b));
+            case OperatorExpression::MUL:
+            case OperatorExpression::UNIT:
+                return Value::fromInt(checkedMul(a, b));
+            case OperatorExpression::DIV:
+                if (b == 0 || std::fabs(l.toDouble()) > MaxExactInteger
+                           || std::fabs(r.toDouble()) > MaxExactInteger)
+                    throw CompiledFallback();
+                return Value::fromFloat(l.toDouble() / r.toDouble());
+            case OperatorExpression::MOD: {
+                if (b == 0)
+                    throw CompiledFallback();
+                if (b == -1)
+                    return Value::fromInt(0);
+                long mod = a % b;
+                if (mod != 0 && ((mod < 0) != (b < 0)))
+                    mod += b;
+                return Value::fromInt(mod);
+            }
+            default: {
+                if (b < 0)
+                    return Value::fromFloat(pythonPow(l.toDouble(), r.toDouble()));
+                long res = 1;
+                while (b) {
+                    if (b & 1)
+                        res = checkedMul(res, a);
+                    b >>= 1;
+                    if (b)
+                        a = checkedMul(a, a);
+                }
+                return Value::fromInt(res);
+            }
+            }
+        }
+
+        double a = l.toDouble();
+        double b = r.toDouble();
+        switch (op) {
+        case OperatorExpression::ADD:
+            return Value::fromFloat(a + b);
+        case OperatorExpression::SUB:
+            return Value::fromFloat(a - b);
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            return Value::fromFloat(a * b);
+        case OperatorExpression::DIV:
+            if (b == 0.0)
+                throw CompiledFallback();
+            return Value::fromFloat(a / b);
+        case OperatorExpression::MOD:
+            return Value::fromFloat(pythonMod(a, b));
+        default:
+            return Value::fromFloat(pythonPow(a, b));
+        }
+    }
+
+    Value execute(std::size_t start = 0) const {
+        std::vector<Value> stack;
+        stack.reserve(stackSize);
+        for (std::size_t pc = start; pc < code.size();) {
+            const Instruction &instr = code[pc++];
+            switch (instr.code) {
+            case OpCode::Push:
+                stack.push_back(constants[instr.arg]);
+                break;
+            case OpCode::Variable:
+                stack.push_back(variableValue(instr.node));
+                break;
+            case OpCode::Python:
+                stack.push_back(pythonValue(instr.node));
+                break;
+            case OpCode::Unary:
+                stack.back() = unary(instr.arg, stack.back());
+                break;
+            case OpCode::Binary: {
+                Value right = stack.back();
+                stack.pop_back();
+                stack.back() = binary(instr.arg, stack.back(), right);
+                break;
+            }
+            case OpCode::JumpIfFalse: {
+                bool test = stack.back().isTrue();
+                stack.pop_back();
+                if (!test)
+                    pc = instr.arg;
+                break;
+            }
+            case OpCode::Jump:
+                pc = instr.arg;
+                break;
+            }
+        }
+        return stack.back();
+    }
+
+    bool run(Value &res) const {
+        try {
+            res = execute();
+            return true;
+        }
+        catch (...) {
+            return false;
+        }
+    }
+};
+
+const Expression::Program *Expression::getProgram() const
+{
+    if (!compiledEvaluationEnabled())
+        return nullptr;
+    if (!program && !notCompilable) {
+        auto prog = std::make_unique<Program>();
+        if (prog->compile(this))
+            program = std::move(prog);
+        else
+            notCompilable = true;
+    }
+    return program.get();
+}
+
 //
 // Expression base-class
 //
@@ -1107,6 +1702,11 @@ ExpressionPtr Expression::replaceObject(const DocumentObject *parent,
 }
 
 App::any Expression::getValueAsAny() const {
+    if (auto prog = getProgram()) {
+        Program::Value value;
+        if (prog->run(value))
+            return value.toAny();
+    }
     Base::PyGILStateLocker lock;
     return pyObjectToAny(getPyValue());
 }
@@ -1128,6 +1728,8 @@ Py::Object Expression::getPyValue() const {
 void Expression::addComponent(Component *component) {
     assert(component);
     components.push_back(component);
+    program.reset();
+    notCompilable = false;
 }
 
 void Expression::visit(ExpressionVisitor &v) {
@@ -1138,6 +1740,11 @@ void Expression::visit(ExpressionVisitor &v) {
 }
 
 Expression* Expression::eval() const {
+    if (auto prog = getProgram()) {
+        Program::Value value;
+        if (prog->run(value))
+            return value.toExpression(owner);
+    }
     Base::PyGILStateLocker lock;
     return expressionFromPy(owner,getPyValue());
 }
@@ -213,12 +213,20 @@ protected:
     virtual Py::Object _getPyValue() const = 0;
     virtual void _visit(ExpressionVisitor &) {}
 
+private:
+    struct Program;
+    const Program *getProgram() const;
+
 protected:
     // clang-format off
     App::DocumentObject * owner; /**< The document object used to access unqualified variables (i.e local scope) */
 
     ComponentList components;
 
+private:
+    mutable std::unique_ptr<Program> program; /**< Compiled form of the expression, see getProgram() */
+    mutable bool notCompilable = false;
+
 public:
     std::string comment;
     // clang-format on
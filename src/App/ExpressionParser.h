@@ -270,6 +270,19 @@ public:
 
     int priority() const override;
 
+    const Expression* getCondition() const
+    {
+        return condition;
+    }
+    const Expression* getTrueExpression() const
+    {
+        return trueExpr;
+    }
+    const Expression* getFalseExpression() const
+    {
+        return falseExpr;
+    }
+
 protected:
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
@@ -466,6 +479,11 @@ public:
 
     const App::Property* getProperty() const;
 
+    const App::Property* getWholeProperty() const
+    {
+        return var.getWholeProperty();
+    }
+
     void addComponent(Component* component) override;
 
 protected:
@@ -196,6 +196,11 @@ public:
         }
         return imp->mustExecute() ? 1 : 0;
     }
+    /// Python features are always recomputed on the main thread
+    bool canRecomputeConcurrently() const override
+    {
+        return false;
+    }
     /// recalculate the Feature
     DocumentObjectExecReturn* execute() override
     {
@@ -179,6 +179,7 @@ def InitApplications():
     def RunInitPy(Dir):
         InstallFile = os.path.join(Dir,"Init.py")
         if (os.path.exists(InstallFile)):
+            FreeCAD.startupProfileBegin(InstallFile)
             try:
                 with open(InstallFile, 'rt', encoding='utf-8') as f:
                     exec(compile(f.read(), InstallFile, 'exec'))
@@ -191,6 +192,8 @@ def InitApplications():
                 Err('Please look into the log file for further information\n')
             else:
                 Log('Init:      Initializing ' + Dir + '... done\n')
+            finally:
+                FreeCAD.startupProfileEnd()
         else:
             Log('Init:      Initializing ' + Dir + '(Init.py not found)... ignore\n')
 
@@ -277,13 +280,17 @@ def InitApplications():
                             Msg(f'NOTICE: Addon "{freecad_module_name}" does not support this version of FreeCAD, so is being skipped\n')
                             continue
 
-                    freecad_module = importlib.import_module(freecad_module_name)
-                    extension_modules += [freecad_module_name]
-                    if any (module_name == 'init' for _, module_name, ispkg in pkgutil.iter_modules(freecad_module.__path__)):
-                        importlib.import_module(freecad_module_name + '.init')
-                        Log('Init: Initializing ' + freecad_module_name + '... done\n')
-                    else:
-                        Log('Init: No init module found in ' + freecad_module_name + ', skipping\n')
+                    FreeCAD.startupProfileBegin(freecad_module_name)
+                    try:
+                        freecad_module = importlib.import_module(freecad_module_name)
+                        extension_modules += [freecad_module_name]
+                        if any (module_name == 'init' for _, module_name, ispkg in pkgutil.iter_modules(freecad_module.__path__)):
+                            importlib.import_module(freecad_module_name + '.init')
+                            Log('Init: Initializing ' + freecad_module_name + '... done\n')
+                        else:
+                            Log('Init: No init module found in ' + freecad_module_name + ', skipping\n')
+                    finally:
+                        FreeCAD.startupProfileEnd()
                 except Exception as inst:
                     Err('During initialization the error "' + str(inst) + '" occurred in ' + freecad_module_name + '\n')
                     Err('-'*80+'\n')
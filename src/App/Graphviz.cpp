@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #include <boost/graph/graphviz.hpp>
+#include <iomanip>
 #include <random>
 
 #include "Application.h"
@@ -105,6 +106,10 @@ void Document::exportGraphviz(std::ostream& out) const
             , seed(std::random_device()())
             , distribution(0, 255)
         {
+            for (const auto& it : d->recomputeProfile) {
+                profileTotal += it.second.time;
+                profileMax = std::max(profileMax, it.second.time);
+            }
             build();
         }
 
@@ -209,6 +214,33 @@ void Document::exportGraphviz(std::ostream& out) const
             get(vertex_attribute, g)[vertex]["fontsize"] = "8pt";
         }
 
+        /**
+         * @brief setProfileVertexAttributes Overlay the recompute profile of an object, i.e.
+         * add the recompute time to the label and color the node from white for the cheapest to
+         * red for the most expensive object.
+         * @param g Graph
+         * @param vertex Object node
+         * @param obj Document object of the node
+         */
+
+        void setProfileVertexAttributes(Graph& g, Vertex vertex, const DocumentObject* obj)
+        {
+            auto it = d->recomputeProfile.find(obj->getID());
+            if (it == d->recomputeProfile.end() || profileMax <= 0.0) {
+                return;
+            }
+
+            double time = it->second.time;
+            std::stringstream str;
+            str << std::fixed << std::setprecision(1) << time * 1000.0 << " ms, "
+                << std::setprecision(0) << 100.0 * time / profileTotal << "%";
+            get(vertex_attribute, g)[vertex]["label"] += "&#92;n" + str.str();
+
+            str.str(std::string());
+            str << std::setprecision(3) << "0.000 " << time / profileMax << " 1.000";
+            get(vertex_attribute, g)[vertex]["fillcolor"] = str.str();
+        }
+
         /**
          * @brief addExpressionSubgraphIfNeeded Add a subgraph to the main graph if it is needed,
          * i.e. there are defined at least one expression in the document object, or other objects
@@ -342,6 +374,7 @@ void Document::exportGraphviz(std::ostream& out) const
                     get(vertex_attribute, *sgraph)[LocalVertexList[getId(docObj)]]["label"] =
                         name + "&#92;n(" + label + ")";
                 }
+                setProfileVertexAttributes(*sgraph, LocalVertexList[getId(docObj)], docObj);
             }
             else {
                 get(vertex_attribute, *sgraph)[LocalVertexList[getId(docObj)]]["style"] = "invis";
@@ -776,6 +809,9 @@ void Document::exportGraphviz(std::ostream& out) const
         std::map<std::string, Vertex> GlobalVertexList;
         std::set<const DocumentObject*> objects;
         std::map<const DocumentObject*, Graph*> GraphList;
+        // recompute profile overlay
+        double profileTotal {0.0};
+        double profileMax {0.0};
         // random color generation
         std::mt19937 seed;
         std::uniform_int_distribution<int> distribution;
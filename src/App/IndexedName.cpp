@@ -26,7 +26,8 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
-#include <cstdlib>
+#include <array>
+#include <mutex>
 #include <unordered_set>
 #endif
 
@@ -42,7 +43,7 @@ inline bool isInvalidChar(char test)
 
 /// Get the integer suffix of name. Returns a tuple of (suffix, suffixPosition). Calling code
 /// should check to ensure that suffixPosition is not equal to nameLength (in which case there was
-/// no suffix).
+/// no suffix). Only the first nameLength characters are read, name need not be null-terminated.
 ///
 /// \param name The name to check
 /// \param nameLength The length of the string in name
@@ -60,14 +61,18 @@ std::pair<int, int> getIntegerSuffix(const char* name, int nameLength)
     }
     ++suffixPosition;
     int suffix {0};
-    if (suffixPosition < nameLength) {
+    for (int i = suffixPosition; i < nameLength; ++i) {
         // When we support C++20 we can use std::span<> to eliminate the clang-tidy warning
         // NOLINTNEXTLINE cppcoreguidelines-pro-bounds-pointer-arithmetic
-        suffix = std::atoi(name + suffixPosition);
+        suffix = suffix * 10 + (name[i] - '0');
     }
     return std::make_pair(suffix, suffixPosition);
 }
 
+/// The types of the elements of the shapes. They are looked up before the NameSet, so the names
+/// created by the millions for the element maps and the selection neither hash nor lock.
+constexpr std::array<std::string_view, 3> PredefinedTypes {"Face", "Edge", "Vertex"};
+
 void IndexedName::set(const char* name,
                       int length,
                       const std::vector<const char*>& allowedNames,
@@ -75,6 +80,7 @@ void IndexedName::set(const char* name,
 {
     // Storage for names that we weren't given external storage for
     static std::unordered_set<ByteArray, ByteArrayHasher> NameSet;
+    static std::mutex NameSetMutex;
 
     if (length < 0) {
         length = static_cast<int>(std::strlen(name));
@@ -106,6 +112,15 @@ void IndexedName::set(const char* name,
     // If the type was NOT in the list of allowedNames, but the caller has set the allowOthers flag
     // to true, then add the new type to the static NameSet (if it is not already there).
     if (allowOthers) {
+        std::string_view typeName(name, suffixPosition);
+        for (const auto& predefined : PredefinedTypes) {
+            if (typeName == predefined) {
+                // The data of the literal is null-terminated and persistent
+                this->type = predefined.data();
+                return;
+            }
+        }
+        std::lock_guard<std::mutex> lock(NameSetMutex);
         auto res = NameSet.insert(ByteArray(QByteArray::fromRawData(name, suffixPosition)));
         if (res.second /*The insert succeeded (the type was new)*/) {
             // Make sure that the data in the set is a unique (unshared) copy of the text
@@ -29,6 +29,7 @@
 #include <cstring>
 #include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <QByteArray>
@@ -114,6 +115,17 @@ public:
         set(data.constData(), data.size());
     }
 
+    /// Construct from a string view, the characters are only read. Like the QByteArray
+    /// constructor, the type is copied on its first occurrence only.
+    ///
+    /// \param name The name, ASCII letters and underscores only, with optional integer suffix
+    explicit IndexedName(std::string_view name)
+        : type("")
+        , index(0)
+    {
+        set(name.data(), static_cast<int>(name.size()));
+    }
+
     /// Given constant name and an index, re-use the existing memory for the name, not making a copy
     /// of it, or scanning any existing storage for it. The name must never become invalid for the
     /// lifetime of the object it names. This memory will never be re-used by another object.
@@ -73,6 +73,7 @@ public:
         funcs;
 
     bool CopyOnChangeApplyToAll;  // Auto generated code. See class document of LinkParams.
+    long MaxElementObjects;       // Auto generated code. See class document of LinkParams.
 
     // Auto generated code. See class document of LinkParams.
     LinkParamsP()
@@ -83,6 +84,8 @@ public:
 
         CopyOnChangeApplyToAll = handle->GetBool("CopyOnChangeApplyToAll", true);
         funcs["CopyOnChangeApplyToAll"] = &LinkParamsP::updateCopyOnChangeApplyToAll;
+        MaxElementObjects = handle->GetInt("MaxElementObjects", 1000);
+        funcs["MaxElementObjects"] = &LinkParamsP::updateMaxElementObjects;
     }
 
     // Auto generated code. See class document of LinkParams.
@@ -107,6 +110,11 @@ public:
     {
         self->CopyOnChangeApplyToAll = self->handle->GetBool("CopyOnChangeApplyToAll", true);
     }
+    // Auto generated code. See class document of LinkParams.
+    static void updateMaxElementObjects(LinkParamsP* self)
+    {
+        self->MaxElementObjects = self->handle->GetInt("MaxElementObjects", 1000);
+    }
 };
 
 // Auto generated code. See class document of LinkParams.
@@ -158,6 +166,42 @@ void LinkParams::removeCopyOnChangeApplyToAll()
 {
     instance()->handle->RemoveBool("CopyOnChangeApplyToAll");
 }
+
+// Auto generated code. See class document of LinkParams.
+const char* LinkParams::docMaxElementObjects()
+{
+    return QT_TRANSLATE_NOOP(
+        "LinkParams",
+        "Link arrays with more elements than this don't create an object per element.\n"
+        "The placements, scales and visibilities of the elements are kept in lists.\n"
+        "Zero or less means no limit");
+}
+
+// Auto generated code. See class document of LinkParams.
+const long& LinkParams::getMaxElementObjects()
+{
+    return instance()->MaxElementObjects;
+}
+
+// Auto generated code. See class document of LinkParams.
+const long& LinkParams::defaultMaxElementObjects()
+{
+    static const long def = 1000;
+    return def;
+}
+
+// Auto generated code. See class document of LinkParams.
+void LinkParams::setMaxElementObjects(const long& v)
+{
+    instance()->handle->SetInt("MaxElementObjects", v);
+    instance()->MaxElementObjects = v;
+}
+
+// Auto generated code. See class document of LinkParams.
+void LinkParams::removeMaxElementObjects()
+{
+    instance()->handle->RemoveInt("MaxElementObjects");
+}
 //[[[end]]]
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1880,7 +1924,11 @@ void LinkBaseExtension::update(App::DocumentObject* parent, const Property* prop
     }
     else if (prop == _getShowElementProperty()) {
         if (_getShowElementValue()) {
+            // the user asks for the element objects, so MaxElementObjects doesn't apply
+            auto propShow = _getShowElementProperty();
+            propShow->setStatus(Property::User3, true);
             update(parent, _getElementCountProperty());
+            propShow->setStatus(Property::User3, false);
         }
         else {
             auto objs = getElementListValue();
@@ -1936,6 +1984,19 @@ void LinkBaseExtension::update(App::DocumentObject* parent, const Property* prop
             }
         }
 
+        // A large array keeps its elements in the lists instead of creating an object per
+        // element. Turning ShowElement on again creates the objects on request.
+        auto propShow = _getShowElementProperty();
+        long maxObjects = LinkParams::getMaxElementObjects();
+        if (propShow && propShow->getValue() && !propShow->testStatus(Property::User3)
+            && maxObjects > 0 && elementCount > static_cast<size_t>(maxObjects)
+            && getElementListProperty() && _getElementListValue().size() < elementCount
+            && !parent->getDocument()->isPerformingTransaction()) {
+            FC_LOG(parent->getFullName() << " keeps its " << elementCount
+                                         << " elements without element objects");
+            propShow->setValue(false);
+        }
+
         if (!_getShowElementValue()) {
             if (getScaleListProperty()) {
                 auto scales = getScaleListValue();
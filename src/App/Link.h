@@ -814,6 +814,19 @@ public:
     static const char* docCopyOnChangeApplyToAll();
     //@}
 
+    //@{
+    /// Accessor for parameter MaxElementObjects
+    ///
+    /// Link arrays with more elements than this don't create an object per element.
+    /// The placements, scales and visibilities of the elements are kept in lists.
+    /// Zero or less means no limit
+    static const long& getMaxElementObjects();
+    static const long& defaultMaxElementObjects();
+    static void removeMaxElementObjects();
+    static void setMaxElementObjects(const long& v);
+    static const char* docMaxElementObjects();
+    //@}
+
     // Auto generated code. See class document of LinkParams.
 };
 }  // namespace App
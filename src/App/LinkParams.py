@@ -24,6 +24,14 @@ Params = [
 Stores the last user choice of whether to apply CopyOnChange setup to all link
 that links to the same configurable object""",
     ),
+    ParamInt(
+        "MaxElementObjects",
+        1000,
+        """\
+Link arrays with more elements than this don't create an object per element.
+The placements, scales and visibilities of the elements are kept in lists.
+Zero or less means no limit""",
+    ),
 ]
 
 
@@ -25,10 +25,12 @@
 #ifndef APP_MAPPED_NAME_H
 #define APP_MAPPED_NAME_H
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/container_hash/hash.hpp>
 
 #include <QByteArray>
 #include <QHash>
@@ -131,7 +133,7 @@ public:
     /// \param other The mapped name to copy. Its data and postfix become the new MappedName's data
     /// \param postfix The postfix for the new MappedName
     MappedName(const MappedName& other, const char* postfix)
-        : data(other.data + other.postfix)
+        : data(other.postfix.isEmpty() && !other.raw ? other.data : other.data + other.postfix)
         , postfix(postfix)
         , raw(false)
     {}
@@ -644,25 +646,41 @@ public:
     /// data, the shorter array is considered "less than" the longer.
     int compare(const MappedName& other) const
     {
-        int thisSize = this->size();
-        int otherSize = other.size();
-        for (int i = 0, count = std::min(thisSize, otherSize); i < count; ++i) {
-            char thisChar = this->operator[](i);
-            char otherChar = other[i];
-            if (thisChar < otherChar) {
-                return -1;
+        // Compare the contiguous runs of data and postfix of both names instead of single
+        // characters, this is the comparison of the element maps.
+        const QByteArray* thisParts[] = {&this->data, &this->postfix};
+        const QByteArray* otherParts[] = {&other.data, &other.postfix};
+        int thisPart = 0;
+        int otherPart = 0;
+        int thisPos = 0;
+        int otherPos = 0;
+        for (;;) {
+            while (thisPart < 2 && thisPos == thisParts[thisPart]->size()) {
+                ++thisPart;
+                thisPos = 0;
             }
-            if (thisChar > otherChar) {
-                return 1;
+            while (otherPart < 2 && otherPos == otherParts[otherPart]->size()) {
+                ++otherPart;
+                otherPos = 0;
             }
+            if (thisPart == 2 || otherPart == 2) {
+                break;
+            }
+            int count = std::min(thisParts[thisPart]->size() - thisPos,
+                                 otherParts[otherPart]->size() - otherPos);
+            const char* thisChars = thisParts[thisPart]->constData() + thisPos;
+            const char* otherChars = otherParts[otherPart]->constData() + otherPos;
+            auto diff = std::mismatch(thisChars, thisChars + count, otherChars);
+            if (diff.first != thisChars + count) {
+                return *diff.first < *diff.second ? -1 : 1;
+            }
+            thisPos += count;
+            otherPos += count;
         }
-        if (thisSize < otherSize) {
-            return -1;
-        }
-        if (thisSize > otherSize) {
-            return 1;
+        if (thisPart == 2 && otherPart == 2) {
+            return 0;
         }
-        return 0;
+        return thisPart == 2 ? -1 : 1;
     }
 
     /// \see compare()
@@ -918,9 +936,15 @@ public:
                              bool recursive = true) const;
 
     /// Get a hash for this MappedName
+    /// Equal names have the same hash, no matter how they are split into data and postfix
     std::size_t hash() const
     {
-        return qHash(data, qHash(postfix));
+        std::size_t seed = 0;
+        boost::hash_range(seed, this->data.constData(), this->data.constData() + this->data.size());
+        boost::hash_range(seed,
+                          this->postfix.constData(),
+                          this->postfix.constData() + this->postfix.size());
+        return seed;
     }
 
 private:
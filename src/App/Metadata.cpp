@@ -24,7 +24,11 @@
 
 #ifndef _PreComp_
 #include <boost/core/ignore_unused.hpp>
+#include <cstdint>
+#include <ctime>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #endif
 
@@ -111,6 +115,37 @@ Metadata::Metadata()
     : _dom(nullptr)
 {}
 
+Metadata Metadata::fromFile(const fs::path& metadataFile)
+{
+    boost::system::error_code modifiedError;
+    boost::system::error_code sizeError;
+    auto modified = fs::last_write_time(metadataFile, modifiedError);
+    auto size = fs::file_size(metadataFile, sizeError);
+    if (modifiedError || sizeError) {
+        return Metadata(metadataFile);
+    }
+
+    struct CachedMetadata
+    {
+        std::time_t modified;
+        std::uintmax_t size;
+        Metadata metadata;
+    };
+    static std::mutex mutex;
+    // Never destroyed: the parsed documents must not outlive the XML library, which is
+    // terminated at exit before static objects are destroyed
+    static auto* cache = new std::map<std::string, CachedMetadata>();  // NOLINT
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache->find(metadataFile.string());
+    if (it == cache->end() || it->second.modified != modified || it->second.size != size) {
+        Metadata metadata(metadataFile);
+        it = cache->insert_or_assign(metadataFile.string(), CachedMetadata {modified, size, metadata})
+                 .first;
+    }
+    return it->second.metadata;
+}
+
 Metadata::Metadata(const DOMNode* domNode, int format)
     : _dom(nullptr)
 {
@@ -222,6 +222,15 @@ public:
 
     ~Metadata();
 
+    /**
+     * Read the data from a file on disk, or return a copy of the data read before
+     *
+     * The metadata of each file is kept until the file's modification time or size changes. At
+     * startup both the application and the GUI go through the package.xml of every addon, with
+     * this each file is only parsed once.
+     */
+    static Metadata fromFile(const boost::filesystem::path& metadataFile);
+
 
     //////////////////////////////////////////////////////////////
     // Recognized Metadata
@@ -94,7 +94,7 @@ int MetadataPy::PyInit(PyObject* args, PyObject* /*kwd*/)
             std::string utf8Name = std::string(filename);
             PyMem_Free(filename);
 
-            auto md = new Metadata(Base::FileInfo::stringToPath(utf8Name));
+            auto md = new Metadata(Metadata::fromFile(Base::FileInfo::stringToPath(utf8Name)));
             setTwinPointer(md);
             return 0;
         }
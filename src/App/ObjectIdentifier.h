@@ -420,6 +420,12 @@ public:
 
     App::Property* getProperty(int* ptype = nullptr) const;
 
+    /** Return the referenced property if this identifier refers to the
+     * property as a whole, i.e. without pseudo property, sub-object or any
+     * further sub path, or nullptr otherwise.
+     */
+    App::Property* getWholeProperty() const;
+
     App::ObjectIdentifier canonicalPath() const;
 
     // Document-centric functions
@@ -48,6 +48,7 @@
 // standard
 #include <cassert>
 #include <csignal>
+#include <cstdint>
 #include <cstdio>
 #include <ctime>
 #include <cfloat>
@@ -77,6 +78,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <random>
 #include <set>
@@ -233,12 +233,13 @@ struct PropertyCleaner
     Property* prop;
 
     static std::vector<Property*> _RemovedProps;
-    static int _PropCleanerCounter;
+    // atomic because objects may be recomputed on several threads at once
+    static std::atomic<int> _PropCleanerCounter;
 };
 }  // namespace App
 
 std::vector<Property*> PropertyCleaner::_RemovedProps;
-int PropertyCleaner::_PropCleanerCounter = 0;
+std::atomic<int> PropertyCleaner::_PropCleanerCounter(0);
 
 void Property::destroy(Property* p)
 {
@@ -29,7 +29,10 @@
 #include <boost/any.hpp>
 #include <boost/signals2.hpp>
 #include <bitset>
+#include <map>
 #include <string>
+#include <type_traits>
+#include <vector>
 #include <FCGlobal.h>
 
 #include "ElementNamingUtils.h"
@@ -42,6 +45,7 @@ namespace App
 {
 
 class PropertyContainer;
+class PropertyDelta;
 class ObjectIdentifier;
 
 /** Base class of all properties
@@ -262,6 +266,14 @@ public:
     virtual Property* Copy() const = 0;
     /// Paste the value from the property (mainly for Undo/Redo and transactions)
     virtual void Paste(const Property& from) = 0;
+    /** Return a compact record of the part of the value that is about to change
+     * Called by transactions from aboutToSetValue() instead of Copy() to keep the
+     * undo stack small. The default returns nullptr to record a full copy.
+     */
+    virtual PropertyDelta* createDelta() const
+    {
+        return nullptr;
+    }
 
     /// Called when a child property has changed value
     virtual void hasSetChildValue(Property&)
@@ -335,6 +347,27 @@ public:
     boost::signals2::signal<void(const App::Property&)> signalChanged;
 };
 
+/** Undo/redo record of a partial change of a property
+ * @see Property::createDelta()
+ */
+class AppExport PropertyDelta
+{
+public:
+    PropertyDelta() = default;
+    virtual ~PropertyDelta() = default;
+
+    /// Restore the recorded part of the value into the given property
+    virtual void apply(Property& prop) const = 0;
+    /** Extend the record with the part of the property that is about to change
+     * @return false if this is not possible. The caller must then take a full
+     * copy of the property and apply this record to it.
+     */
+    virtual bool merge(const Property& prop) = 0;
+    virtual unsigned int getMemSize() const = 0;
+
+    FC_DISABLE_COPY_MOVE(PropertyDelta)
+};
+
 
 /** A template class that is used to inhibit multiple nested calls to aboutToSetValue/hasSetValue
  * for properties.
@@ -563,8 +596,8 @@ public:
 
     virtual void setValues(const ListT& newValues = ListT())
     {
+        touchChangedValues(newValues);
         atomic_change guard(*this);
-        this->_touchList.clear();
         this->_lValueList = newValues;
         guard.tryInvoke();
     }
@@ -617,7 +650,11 @@ public:
             throw Base::RuntimeError("index out of bound");
         }
 
+        // tell createDelta() which element is about to change
+        std::vector<int> indices {index};
+        this->_pendingIndices = &indices;
         atomic_change guard(*this);
+        this->_pendingIndices = nullptr;
         if (index == -1 || index == size) {
             index = size;
             setSize(index + 1, value);
@@ -629,7 +666,111 @@ public:
         guard.tryInvoke();
     }
 
+    PropertyDelta* createDelta() const override
+    {
+        // Link lists keep back links in sync in their own setters, so only
+        // plain value lists record deltas
+        if (!_pendingIndices || !std::is_same<ParentT, PropertyLists>::value) {
+            return nullptr;
+        }
+        auto delta = new ListDelta(getSize());
+        delta->merge(*this);
+        return delta;
+    }
+
 protected:
+    /** Put the elements that differ from \a newValues into the touch list, so observers of the
+     * change can update only those. Must be called before the change starts.
+     *
+     * The touch list is left empty, which stands for the whole list, if the size changes, if
+     * the change is part of a bigger atomic change or if more than a quarter of the elements
+     * differ.
+     */
+    void touchChangedValues(const ListT& newValues)
+    {
+        this->_touchList.clear();
+        std::size_t size = _lValueList.size();
+        // Link lists keep more than the values in sync in their own setters
+        if (!std::is_same<ParentT, PropertyLists>::value || this->signalCounter > 0
+            || newValues.size() != size) {
+            return;
+        }
+        std::size_t limit = size / 4;
+        std::vector<int> changed;
+        for (std::size_t i = 0; i < size; ++i) {
+            if (!(_lValueList[i] == newValues[i])) {
+                if (changed.size() == limit) {
+                    return;
+                }
+                changed.push_back(static_cast<int>(i));
+            }
+        }
+        this->_touchList.insert(changed.begin(), changed.end());
+    }
+
+    /** Records the old values of the changed elements and the old size
+     *
+     * Applying it on the property resizes the list to the old size and
+     * restores the recorded elements, while recording the reverse change
+     * for redo.
+     */
+    class ListDelta: public PropertyDelta
+    {
+    public:
+        explicit ListDelta(int size)
+            : size(size)
+        {}
+
+        void apply(Property& prop) const override
+        {
+            auto& list = dynamic_cast<PropertyListsT&>(prop);
+            std::vector<int> indices;
+            indices.reserve(values.size());
+            for (const auto& it : values) {
+                if (it.first < list.getSize()) {
+                    indices.push_back(it.first);
+                }
+            }
+            for (int i = size; i < list.getSize(); ++i) {
+                indices.push_back(i);
+            }
+
+            list._pendingIndices = &indices;
+            typename PropertyListsT::atomic_change guard(list);
+            list._pendingIndices = nullptr;
+            list.setSize(size);
+            for (const auto& it : values) {
+                list._lValueList[it.first] = it.second;
+                list._touchList.insert(it.first);
+            }
+            guard.tryInvoke();
+        }
+
+        bool merge(const Property& prop) override
+        {
+            const auto& list = static_cast<const PropertyListsT&>(prop);
+            if (!list._pendingIndices) {
+                return false;
+            }
+            for (int index : *list._pendingIndices) {
+                // appended elements are removed by restoring the size
+                if (index >= 0 && index < size && index < list.getSize()) {
+                    values.emplace(index, list._lValueList[index]);
+                }
+            }
+            return true;
+        }
+
+        unsigned int getMemSize() const override
+        {
+            return static_cast<unsigned int>(sizeof(*this) + values.size() * sizeof(T));
+        }
+
+    private:
+        int size;
+        std::map<int, T> values;
+    };
+
     void setPyValues(const std::vector<PyObject*>& vals, const std::vector<int>& indices) override
     {
         if (indices.empty()) {
@@ -655,6 +796,8 @@ protected:
 
 protected:
     ListT _lValueList;
+    /// elements about to be changed, see createDelta()
+    const std::vector<int>* _pendingIndices {nullptr};
 };
 
 }  // namespace App
@@ -227,6 +227,7 @@ static const std::map<std::string, int>& getStatusMap()
         statusMap["NoModify"] = Property::NoModify;
         statusMap["PartialTrigger"] = Property::PartialTrigger;
         statusMap["NoRecompute"] = Property::NoRecompute;
+        statusMap["Single"] = Property::Single;
         statusMap["CopyOnChange"] = Property::CopyOnChange;
         statusMap["UserEdit"] = Property::UserEdit;
     }
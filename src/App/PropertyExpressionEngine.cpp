@@ -83,6 +83,13 @@ struct PropertyExpressionEngine::Private
     // defined in header, hence the private structure here.
     std::vector<boost::signals2::scoped_connection> conns;
     std::unordered_map<std::string, std::vector<ObjectIdentifier>> propMap;
+
+    // Input tracking for incremental evaluation, see trackInputs()
+    std::vector<boost::signals2::scoped_connection> inputConns;
+    std::unordered_map<std::string, std::vector<ObjectIdentifier>> inputMap;
+    std::set<ObjectIdentifier> tracked;
+    std::set<ObjectIdentifier> upToDate;
+    bool inputsTracked = false;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -136,6 +143,10 @@ Property* PropertyExpressionEngine::Copy() const
 void PropertyExpressionEngine::hasSetValue()
 {
     App::DocumentObject* owner = dynamic_cast<App::DocumentObject*>(getContainer());
+    if (pimpl) {
+        pimpl->inputsTracked = false;
+    }
+
     if (!owner || !owner->isAttachedToDocument() || owner->isRestoring()
         || testFlag(LinkDetached)) {
         PropertyExpressionContainer::hasSetValue();
@@ -274,6 +285,103 @@ void PropertyExpressionEngine::slotChangedProperty(const App::DocumentObject&,
     updateHiddenReference(prop.getFullName());
 }
 
+/**
+ * @brief Track the inputs of the expressions for incremental evaluation.
+ *
+ * An expression is tracked if all its identifiers resolve to actual
+ * properties. It is then connected to the change signals of the objects it
+ * depends on, and of its own bound property, so that execute() can skip it
+ * as long as none of them changed since its last evaluation. Any other
+ * expression is evaluated on each execution.
+ */
+
+void PropertyExpressionEngine::trackInputs()
+{
+    if (!pimpl) {
+        pimpl = std::make_unique<Private>();
+    }
+    pimpl->inputConns.clear();
+    pimpl->inputMap.clear();
+    pimpl->tracked.clear();
+    pimpl->upToDate.clear();
+
+    auto owner = freecad_dynamic_cast<DocumentObject>(getContainer());
+    if (!owner || !owner->isAttachedToDocument() || owner->isRestoring()
+        || testFlag(LinkDetached)) {
+        return;
+    }
+    pimpl->inputsTracked = true;
+
+    std::set<const DocumentObject*> connected;
+    auto addInput = [&](DocumentObject* obj, const std::string& key, const ObjectIdentifier& path) {
+        if (connected.insert(obj).second) {
+            // NOLINTBEGIN
+            pimpl->inputConns.emplace_back(obj->signalChanged.connect(
+                std::bind(&PropertyExpressionEngine::slotChangedInput, this, sp::_1, sp::_2)));
+            // NOLINTEND
+        }
+        pimpl->inputMap[key].push_back(path);
+    };
+
+    for (auto& e : expressions) {
+        auto expr = e.second.expression;
+        Property* prop = e.first.getProperty();
+        if (!expr || !prop) {
+            continue;
+        }
+        auto identifiers = expr->getIdentifiers();
+        bool trackable = true;
+        for (auto& dep : identifiers) {
+            const ObjectIdentifier& var = dep.first;
+            int ptype;
+            if (!var.getProperty(&ptype) || ptype || !var.getSubObjectName().empty()) {
+                trackable = false;
+                break;
+            }
+        }
+        if (!trackable) {
+            continue;
+        }
+        for (auto& dep : identifiers) {
+            for (auto& vdep : dep.first.getDep(true)) {
+                auto obj = vdep.first;
+                for (auto& propName : vdep.second) {
+                    if (propName.empty()) {
+                        addInput(obj, obj->getFullName(), e.first);
+                    }
+                    else {
+                        addInput(obj, obj->getFullName() + "." + propName, e.first);
+                    }
+                }
+            }
+        }
+        // Re-evaluate if someone else modified the bound property
+        addInput(owner, prop->getFullName(), e.first);
+        pimpl->tracked.insert(e.first);
+    }
+}
+
+void PropertyExpressionEngine::slotChangedInput(const App::DocumentObject& obj,
+                                                const App::Property& prop)
+{
+    for (const auto& key : {obj.getFullName(), prop.getFullName()}) {
+        auto it = pimpl->inputMap.find(key);
+        if (it == pimpl->inputMap.end()) {
+            continue;
+        }
+        for (auto& path : it->second) {
+            pimpl->upToDate.erase(path);
+        }
+    }
+}
+
+void PropertyExpressionEngine::markEvaluated(const ObjectIdentifier& path)
+{
+    if (pimpl && pimpl->tracked.count(path)) {
+        pimpl->upToDate.insert(path);
+    }
+}
+
 void PropertyExpressionEngine::Paste(const Property& from)
 {
     const PropertyExpressionEngine& fromee = dynamic_cast<const PropertyExpressionEngine&>(from);
@@ -721,6 +829,28 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
 
     resetter r(running);
 
+    // Only evaluate the expressions whose inputs changed since the last time
+    ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Expression");
+    bool incremental =
+        option != ExecuteOnRestore && hGrp->GetBool("IncrementalEvaluation", true);
+    if (incremental) {
+        if (!pimpl || !pimpl->inputsTracked) {
+            trackInputs();
+        }
+        for (auto& conn : pimpl->inputConns) {
+            // an input object is gone
+            if (!conn.connected()) {
+                pimpl->inputsTracked = false;
+                trackInputs();
+                break;
+            }
+        }
+    }
+    else if (pimpl) {
+        pimpl->upToDate.clear();
+    }
+
     // Compute evaluation order
     std::vector<App::ObjectIdentifier> evaluationOrder = computeEvaluationOrder(option);
     std::vector<ObjectIdentifier>::const_iterator it = evaluationOrder.begin();
@@ -746,6 +876,10 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
             throw Base::RuntimeError("Invalid property owner.");
         }
 
+        if (incremental && pimpl->upToDate.count(*it)) {
+            continue;
+        }
+
         /* Set value of property */
         App::any value;
         try {
@@ -768,6 +902,7 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                 // if (option == ExecuteOnRestore && prop->testStatus(Property::EvalOnRestore))
                 {
                     if (isAnyEqual(value, prop->getPathValue(*it))) {
+                        markEvaluated(*it);
                         continue;
                     }
                     if (touched) {
@@ -775,6 +910,7 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                     }
                 }
                 prop->setPathValue(*it, value);
+                markEvaluated(*it);
             }
         }
         catch (Base::Exception& e) {
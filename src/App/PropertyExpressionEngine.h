@@ -217,6 +217,9 @@ private:
     void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
     void slotChangedProperty(const App::DocumentObject& obj, const App::Property& prop);
     void updateHiddenReference(const std::string& key);
+    void slotChangedInput(const App::DocumentObject& obj, const App::Property& prop);
+    void trackInputs();
+    void markEvaluated(const App::ObjectIdentifier& path);
 
     bool running = false; /**< Boolean used to avoid loops */
     bool restoring = false;
@@ -291,6 +291,14 @@ void PropertyVectorList::setValue(double x, double y, double z)
     setValue(Base::Vector3d(x, y, z));
 }
 
+void PropertyVectorList::setValues(std::vector<Base::Vector3d>&& values)
+{
+    touchChangedValues(values);
+    atomic_change guard(*this);
+    _lValueList = std::move(values);
+    guard.tryInvoke();
+}
+
 PyObject* PropertyVectorList::getPyObject()
 {
     PyObject* list = PyList_New(getSize());
@@ -366,7 +374,7 @@ void PropertyVectorList::RestoreDocFile(Base::Reader& reader)
             it.Set(vec.x, vec.y, vec.z);
         }
     }
-    setValues(values);
+    setValues(std::move(values));
 }
 
 Property* PropertyVectorList::Copy() const
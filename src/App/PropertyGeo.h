@@ -227,6 +227,9 @@ public:
 
     void setValue(double x, double y, double z);
     using inherited::setValue;
+    /// Takes over the given values without copying them
+    void setValues(std::vector<Base::Vector3d>&& values);
+    using inherited::setValues;
 
     PyObject* getPyObject() override;
 
@@ -131,6 +131,15 @@ void PropertyLinkBase::unregisterElementReference()
         }
     }
     _ElementRefs.clear();
+    _ElementRefGeos.clear();
+}
+
+void PropertyLinkBase::_recordElementReference(App::DocumentObject* obj, App::DocumentObject* geo)
+{
+    _ElementRefGeos[obj].insert(geo);
+    if (geo && _ElementRefs.insert(geo).second) {
+        _ElementRefMap[geo].insert(this);
+    }
 }
 
 void PropertyLinkBase::unregisterLabelReferences()
@@ -321,12 +330,11 @@ void PropertyLinkBase::_registerElementReference(App::DocumentObject* obj,
                                &element,
                                &geo);
     if (!geo || !element || !element[0]) {
+        _recordElementReference(obj, nullptr);
         return;
     }
 
-    if (_ElementRefs.insert(geo).second) {
-        _ElementRefMap[geo].insert(this);
-    }
+    _recordElementReference(obj, geo);
 }
 
 class StringGuard
@@ -404,6 +412,15 @@ bool PropertyLinkBase::_updateElementReference(DocumentObject* feature,
     if (!obj || !obj->getNameInDocument()) {
         return false;
     }
+    if (feature && feature != obj) {
+        // Skip the reference if it is known to be resolved to the geometry
+        // of some other object
+        auto it = _ElementRefGeos.find(obj);
+        if (it != _ElementRefGeos.end() && !it->second.count(feature)
+            && !it->second.count(nullptr)) {
+            return false;
+        }
+    }
     ShadowSub elementName;
     const char* subname;
     if (shadow.newName.size()) {
@@ -429,12 +446,11 @@ bool PropertyLinkBase::_updateElementReference(DocumentObject* feature,
         if (elementName.oldName.size()) {
             shadow.oldName.swap(elementName.oldName);
         }
+        _recordElementReference(obj, nullptr);
         return false;
     }
 
-    if (_ElementRefs.insert(geo).second) {
-        _ElementRefMap[geo].insert(this);
-    }
+    _recordElementReference(obj, geo);
 
     if (!reverse) {
         if (elementName.newName.empty()) {
@@ -633,8 +633,13 @@ protected:
                      const std::vector<PropertyLinkBase::ShadowSub>& shadows) const;
 
 private:
+    void _recordElementReference(App::DocumentObject* obj, App::DocumentObject* geo);
+
     std::set<std::string> _LabelRefs;
     std::set<App::DocumentObject*> _ElementRefs;
+    /// Geometry objects resolved from the element references by linked object,
+    /// with a null entry if some reference could not be resolved
+    std::unordered_map<App::DocumentObject*, std::set<App::DocumentObject*>> _ElementRefGeos;
 };
 
 /** The general Link Property
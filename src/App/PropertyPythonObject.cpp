@@ -38,6 +38,52 @@
 
 using namespace App;
 
+namespace
+{
+
+/** Returns the function \a name of the json module. It is looked up once and kept for the
+ * lifetime of the interpreter in \a cache, documents with many Python features convert many
+ * objects in a row. The caller must hold the GIL.
+ */
+Py::Callable getJsonFunction(PyObject*& cache, const char* name)
+{
+    if (!cache) {
+        Py::Module json(PyImport_ImportModule("json"), true);
+        if (json.isNull()) {
+            throw Py::Exception();
+        }
+        cache = Py::new_reference_to(json.getAttr(name));
+    }
+    return Py::Callable(cache);
+}
+
+Py::Callable getJsonDumps()
+{
+    static PyObject* dumps = nullptr;
+    return getJsonFunction(dumps, "dumps");
+}
+
+Py::Callable getJsonLoads()
+{
+    static PyObject* loads = nullptr;
+    return getJsonFunction(loads, "loads");
+}
+
+/// Returns the module \a name from sys.modules and only imports it if it is not there yet
+Py::Module getModule(const char* name)
+{
+    PyObject* mod = PyImport_GetModule(Py::String(name).ptr());
+    if (!mod) {
+        if (PyErr_Occurred()) {
+            throw Py::Exception();
+        }
+        mod = PyImport_ImportModule(name);
+    }
+    return Py::Module(mod, true);
+}
+
+}  // namespace
+
 
 TYPESYSTEM_SOURCE(App::PropertyPythonObject, App::Property)
 
@@ -82,11 +128,7 @@ std::string PropertyPythonObject::toString() const
     std::string repr;
     Base::PyGILStateLocker lock;
     try {
-        Py::Module pickle(PyImport_ImportModule("json"), true);
-        if (pickle.isNull()) {
-            throw Py::Exception();
-        }
-        Py::Callable method(pickle.getAttr(std::string("dumps")));
+        Py::Callable method(getJsonDumps());
         Py::Object dump;
         if (this->object.hasAttr("dumps")) {
             Py::Tuple args;
@@ -134,11 +176,7 @@ void PropertyPythonObject::fromString(const std::string& repr)
         if (repr.empty()) {
             return;
         }
-        Py::Module pickle(PyImport_ImportModule("json"), true);
-        if (pickle.isNull()) {
-            throw Py::Exception();
-        }
-        Py::Callable method(pickle.getAttr(std::string("loads")));
+        Py::Callable method(getJsonLoads());
         Py::Tuple args(1);
         args.setItem(0, Py::String(repr));
         Py::Object res = method.apply(args);
@@ -181,7 +219,7 @@ void PropertyPythonObject::loadPickle(const std::string& str)
     Base::PyGILStateLocker lock;
     try {
         std::string buffer = str;
-        boost::regex pickle(R"(S'(\w+)'.+S'(\w+)'\n)");
+        static const boost::regex pickle(R"(S'(\w+)'.+S'(\w+)'\n)");
         boost::match_results<std::string::const_iterator> what;
         std::string::const_iterator start, end;
         start = buffer.begin();
@@ -348,13 +386,13 @@ void PropertyPythonObject::Restore(Base::XMLReader& reader)
 
         Base::PyGILStateLocker lock;
         try {
-            boost::regex pickle(R"(^\(i(\w+)\n(\w+)\n)");
+            static const boost::regex pickle(R"(^\(i(\w+)\n(\w+)\n)");
             boost::match_results<std::string::const_iterator> what;
             std::string::const_iterator start, end;
             start = buffer.begin();
             end = buffer.end();
             if (reader.hasAttribute("module") && reader.hasAttribute("class")) {
-                Py::Module mod(PyImport_ImportModule(reader.getAttribute("module")), true);
+                Py::Module mod(getModule(reader.getAttribute("module")));
                 if (mod.isNull()) {
                     throw Py::Exception();
                 }
@@ -376,7 +414,7 @@ void PropertyPythonObject::Restore(Base::XMLReader& reader)
             else if (boost::regex_search(start, end, what, pickle)) {
                 std::string name = std::string(what[1].first, what[1].second);
                 std::string type = std::string(what[2].first, what[2].second);
-                Py::Module mod(PyImport_ImportModule(name.c_str()), true);
+                Py::Module mod(getModule(name.c_str()));
                 if (mod.isNull()) {
                     throw Py::Exception();
                 }
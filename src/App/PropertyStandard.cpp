@@ -48,6 +48,9 @@ using namespace App;
 using namespace Base;
 using namespace std;
 
+/// Integer and bool lists with more elements are saved in a binary file instead of the XML
+static constexpr int BinaryListThreshold = 256;
+
 
 //**************************************************************************
 //**************************************************************************
@@ -820,6 +823,18 @@ long PropertyIntegerList::getPyValue(PyObject* item) const
 
 void PropertyIntegerList::Save(Base::Writer& writer) const
 {
+    // the binary file holds 32 bit values
+    auto fitsInt32 = [](long value) {
+        return value >= std::numeric_limits<int32_t>::min()
+            && value <= std::numeric_limits<int32_t>::max();
+    };
+    if (!writer.isForceXML() && getSize() > BinaryListThreshold
+        && std::all_of(_lValueList.begin(), _lValueList.end(), fitsInt32)) {
+        writer.Stream() << writer.ind() << "<IntegerList file=\""
+                        << writer.addFile(getName(), this) << "\"/>" << endl;
+        return;
+    }
+
     writer.Stream() << writer.ind() << "<IntegerList count=\"" << getSize() << "\">" << endl;
     writer.incInd();
     for (int i = 0; i < getSize(); i++) {
@@ -833,6 +848,14 @@ void PropertyIntegerList::Restore(Base::XMLReader& reader)
 {
     // read my Element
     reader.readElement("IntegerList");
+    if (reader.hasAttribute("file")) {
+        std::string file(reader.getAttribute("file"));
+        if (!file.empty()) {
+            // initiate a file read
+            reader.addFile(file.c_str(), this);
+        }
+        return;
+    }
     // get the value of my Attribute
     int count = reader.getAttributeAsInteger("count");
 
@@ -848,6 +871,30 @@ void PropertyIntegerList::Restore(Base::XMLReader& reader)
     setValues(values);
 }
 
+void PropertyIntegerList::SaveDocFile(Base::Writer& writer) const
+{
+    Base::OutputStream str(writer.Stream());
+    uint32_t uCt = (uint32_t)getSize();
+    str << uCt;
+    for (long it : _lValueList) {
+        str << static_cast<int32_t>(it);
+    }
+}
+
+void PropertyIntegerList::RestoreDocFile(Base::Reader& reader)
+{
+    Base::InputStream str(reader);
+    uint32_t uCt = 0;
+    str >> uCt;
+    std::vector<long> values(uCt);
+    for (long& it : values) {
+        int32_t val {};
+        str >> val;
+        it = val;
+    }
+    setValues(values);
+}
+
 Property* PropertyIntegerList::Copy() const
 {
     PropertyIntegerList* p = new PropertyIntegerList();
@@ -1296,6 +1343,14 @@ PropertyFloatList::PropertyFloatList() = default;
 
 PropertyFloatList::~PropertyFloatList() = default;
 
+void PropertyFloatList::setValues(std::vector<double>&& values)
+{
+    touchChangedValues(values);
+    atomic_change guard(*this);
+    _lValueList = std::move(values);
+    guard.tryInvoke();
+}
+
 //**************************************************************************
 // Base class implementer
 
@@ -1388,7 +1443,7 @@ void PropertyFloatList::RestoreDocFile(Base::Reader& reader)
             it = val;
         }
     }
-    setValues(values);
+    setValues(std::move(values));
 }
 
 Property* PropertyFloatList::Copy() const
@@ -2254,6 +2309,12 @@ bool PropertyBoolList::getPyValue(PyObject* item) const
 
 void PropertyBoolList::Save(Base::Writer& writer) const
 {
+    if (!writer.isForceXML() && getSize() > BinaryListThreshold) {
+        writer.Stream() << writer.ind() << "<BoolList file=\"" << writer.addFile(getName(), this)
+                        << "\"/>" << std::endl;
+        return;
+    }
+
     writer.Stream() << writer.ind() << "<BoolList value=\"";
     std::string bitset;
     boost::to_string(_lValueList, bitset);
@@ -2265,12 +2326,54 @@ void PropertyBoolList::Restore(Base::XMLReader& reader)
 {
     // read my Element
     reader.readElement("BoolList");
+    if (reader.hasAttribute("file")) {
+        std::string file(reader.getAttribute("file"));
+        if (!file.empty()) {
+            // initiate a file read
+            reader.addFile(file.c_str(), this);
+        }
+        return;
+    }
     // get the value of my Attribute
     string str = reader.getAttribute("value");
     boost::dynamic_bitset<> bitset(str);
     setValues(bitset);
 }
 
+void PropertyBoolList::SaveDocFile(Base::Writer& writer) const
+{
+    // eight values per byte, the first value in the lowest bit
+    Base::OutputStream str(writer.Stream());
+    uint32_t uCt = (uint32_t)getSize();
+    str << uCt;
+    uint8_t byte = 0;
+    for (uint32_t i = 0; i < uCt; i++) {
+        if (_lValueList[i]) {
+            byte |= uint8_t(1 << (i % 8));
+        }
+        if (i % 8 == 7 || i + 1 == uCt) {
+            str << byte;
+            byte = 0;
+        }
+    }
+}
+
+void PropertyBoolList::RestoreDocFile(Base::Reader& reader)
+{
+    Base::InputStream str(reader);
+    uint32_t uCt = 0;
+    str >> uCt;
+    boost::dynamic_bitset<> values(uCt);
+    uint8_t byte = 0;
+    for (uint32_t i = 0; i < uCt; i++) {
+        if (i % 8 == 0) {
+            str >> byte;
+        }
+        values[i] = (byte & (1 << (i % 8))) != 0;
+    }
+    setValues(values);
+}
+
 Property* PropertyBoolList::Copy() const
 {
     PropertyBoolList* p = new PropertyBoolList();
@@ -390,6 +390,9 @@ public:
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
 
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
+
     Property* Copy() const override;
     void Paste(const Property& from) override;
     unsigned int getMemSize() const override;
@@ -713,6 +716,10 @@ public:
      */
     ~PropertyFloatList() override;
 
+    /// Takes over the given values without copying them
+    void setValues(std::vector<double>&& values);
+    using PropertyListsT<double>::setValues;
+
     const char* getEditorName() const override
     {
         return "Gui::PropertyEditor::PropertyFloatListItem";
@@ -990,6 +997,9 @@ public:
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
 
+    void SaveDocFile(Base::Writer& writer) const override;
+    void RestoreDocFile(Base::Reader& reader) override;
+
     Property* Copy() const override;
     void Paste(const Property& from) override;
     unsigned int getMemSize() const override;
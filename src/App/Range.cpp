@@ -22,12 +22,10 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
-#include <boost/regex.hpp>
 #include <cassert>
 #include <sstream>
 #include <string>
 #include <cmath>
-#include <regex>
 #endif
 
 #include <string_view>
@@ -225,7 +223,15 @@ int App::validRow(const std::string& rowstr)
 
 bool App::validColumn(const std::string& colstr)
 {
-    return boost::regex_match(colstr, boost::regex("[A-Z]{1,3}"));
+    if (colstr.empty() || colstr.size() > 3) {
+        return false;
+    }
+    for (char chr : colstr) {
+        if (chr < 'A' || chr > 'Z') {
+            return false;
+        }
+    }
+    return true;
 }
 
 /**
@@ -242,27 +248,31 @@ App::CellAddress App::stringToAddress(const char* strAddress, bool silent)
 {
     assert(strAddress);
 
-    static boost::regex e("(\\$?[A-Z]{1,2})(\\$?[0-9]{1,5})");
-    boost::cmatch cm;
-
-    if (boost::regex_match(strAddress, cm, e)) {
-        bool absCol = (cm[1].first[0] == '$');
-        std::string r, c;
-        if (absCol) {
-            c = std::string(cm[1].first + 1, cm[1].second);
-        }
-        else {
-            c = std::string(cm[1].first, cm[1].second);
-        }
+    // Match "\$?[A-Z]{1,2}\$?[0-9]{1,5}" by hand, this is called for every
+    // identifier resolved in a spreadsheet
+    const char* pos = strAddress;
+    bool absCol = (*pos == '$');
+    if (absCol) {
+        ++pos;
+    }
+    const char* colBegin = pos;
+    while (pos - colBegin < 2 && *pos >= 'A' && *pos <= 'Z') {
+        ++pos;
+    }
+    const char* colEnd = pos;
 
-        bool absRow = (cm[2].first[0] == '$');
-        if (absRow) {
-            r = std::string(cm[2].first + 1, cm[2].second);
-        }
-        else {
-            r = std::string(cm[2].first, cm[2].second);
-        }
+    bool absRow = (*pos == '$');
+    if (absRow) {
+        ++pos;
+    }
+    const char* rowBegin = pos;
+    while (pos - rowBegin < 5 && *pos >= '0' && *pos <= '9') {
+        ++pos;
+    }
 
+    if (colBegin != colEnd && rowBegin != pos && *pos == '\0') {
+        std::string c(colBegin, colEnd);
+        std::string r(rowBegin, pos);
         return CellAddress(decodeRow(r, silent), decodeColumn(c, silent), absRow, absCol);
     }
     else if (silent) {
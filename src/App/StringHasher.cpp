@@ -25,6 +25,8 @@
 #include <QCryptographicHash>
 #include <QHash>
 #include <deque>
+#include <mutex>
+#include <shared_mutex>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -82,6 +84,8 @@ class StringHasher::HashMap: public HashMapBase
 public:
     bool SaveAll = false;
     int Threshold = 0;
+    /// Lookups share the lock, changing the table requires it exclusively
+    mutable std::shared_mutex mutex;
 };
 
 ///////////////////////////////////////////////////////////
@@ -195,6 +199,8 @@ void StringHasher::compact()
         return;
     }
 
+    std::unique_lock<std::shared_mutex> lock(_hashes->mutex);
+
     // Make a list of all the table entries that have only a single reference and are not marked
     // "persistent"
     std::deque<StringIDRef> pendings;
@@ -243,6 +249,7 @@ int StringHasher::getThreshold() const
 
 long StringHasher::lastID() const
 {
+    // the caller must hold the lock
     if (_hashes->right.empty()) {
         return 0;
     }
@@ -277,9 +284,12 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
         dataID._data = data;
     }
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    {
+        std::shared_lock<std::shared_mutex> lock(_hashes->mutex);
+        auto it = _hashes->left.find(&dataID);
+        if (it != _hashes->left.end()) {
+            return {it->first};
+        }
     }
 
     if (!hashed && !nocopy) {
@@ -294,6 +304,9 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
     if (hashed) {
         flags.setFlag(StringID::Flag::Hashed);
     }
+    // Another thread may have added the same data in the meantime, in which
+    // case insert() returns the existing entry
+    std::unique_lock<std::shared_mutex> lock(_hashes->mutex);
     StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
     return {insert(sid)};
 }
@@ -321,13 +334,16 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
-        if (indexed) {
-            res._index = indexed.getIndex();
+    {
+        std::shared_lock<std::shared_mutex> lock(_hashes->mutex);
+        auto it = _hashes->left.find(&tempID);
+        if (it != _hashes->left.end()) {
+            auto res = StringIDRef(it->first);
+            if (indexed) {
+                res._index = indexed.getIndex();
+            }
+            return res;
         }
-        return res;
     }
 
     if (!indexed && name.isRaw()) {
@@ -348,8 +364,9 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         indexRef = getID(tempID._data);
     }
 
-    // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    // The real StringID object that we are going to insert. Its ID is assigned
+    // when inserting, because other threads may insert in the meantime.
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -429,6 +446,8 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         }
     }
 
+    std::unique_lock<std::shared_mutex> lock(_hashes->mutex);
+    newStringID._id = lastID() + 1;
     return {insert(newStringIDRef), indexed.getIndex()};
 }
 
@@ -437,6 +456,7 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
+    std::shared_lock<std::shared_mutex> lock(_hashes->mutex);
     auto it = _hashes->right.find(id);
     if (it == _hashes->right.end()) {
         return {};
@@ -497,6 +517,7 @@ void StringHasher::SaveDocFile(Base::Writer& writer) const
 void StringHasher::saveStream(std::ostream& stream) const
 {
     Base::TextOutputStream textStreamWrapper(stream);
+    std::shared_lock<std::shared_mutex> lock(_hashes->mutex);
     boost::io::ios_flags_saver ifs(stream);
     stream << std::hex;
 
@@ -597,7 +618,7 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
     std::string ver;
     reader >> marker;
     std::size_t count = 0;
-    _hashes->clear();
+    clear();
     if (marker == "StringTableStart") {
         reader >> ver >> count;
         if (ver != "v1") {
@@ -613,7 +634,7 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
 void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
 {
     Base::TextInputStream asciiStream(stream);
-    _hashes->clear();
+    clear();
     std::string content;
     boost::io::ios_flags_saver ifs(stream);
     stream >> std::hex;
@@ -722,12 +743,14 @@ void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
             }
         }
 
+        std::unique_lock<std::shared_mutex> lock(_hashes->mutex);
         last = insert(sid);
     }
 }
 
 StringID* StringHasher::insert(const StringIDRef& sid)
 {
+    // the caller must hold the lock
     assert(sid && sid._sid->_hasher == nullptr);
     auto& hasher = *sid._sid;
     hasher._hasher = this;
@@ -743,7 +766,8 @@ StringID* StringHasher::insert(const StringIDRef& sid)
 
 void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 {
-    _hashes->clear();
+    clear();
+    std::unique_lock<std::shared_mutex> lock(_hashes->mutex);
     std::string content;
     for (uint32_t i = 0; i < count; ++i) {
         int32_t id = 0;
@@ -762,6 +786,7 @@ void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 
 void StringHasher::clear()
 {
+    std::unique_lock<std::shared_mutex> lock(_hashes->mutex);
     for (auto& hasher : _hashes->right) {
         hasher.second->_hasher = nullptr;
         hasher.second->unref();
@@ -771,11 +796,13 @@ void StringHasher::clear()
 
 size_t StringHasher::size() const
 {
+    std::shared_lock<std::shared_mutex> lock(_hashes->mutex);
     return _hashes->size();
 }
 
 size_t StringHasher::count() const
 {
+    std::shared_lock<std::shared_mutex> lock(_hashes->mutex);
     size_t count = 0;
     for (auto& hasher : _hashes->right) {
         if (hasher.second->isMarked() || hasher.second->isPersistent()) {
@@ -835,6 +862,7 @@ void StringHasher::Restore(Base::XMLReader& reader)
             else {
                 sid = new StringID(id, QByteArray(reader.getAttribute("text")));
             }
+            std::unique_lock<std::shared_mutex> lock(_hashes->mutex);
             insert(sid);
         }
     }
@@ -853,6 +881,7 @@ PyObject* StringHasher::getPyObject()
 
 std::map<long, StringIDRef> StringHasher::getIDMap() const
 {
+    std::shared_lock<std::shared_mutex> lock(_hashes->mutex);
     std::map<long, StringIDRef> ret;
     for (auto& hasher : _hashes->right) {
         ret.emplace_hint(ret.end(), hasher.first, StringIDRef(hasher.second));
@@ -862,6 +891,7 @@ std::map<long, StringIDRef> StringHasher::getIDMap() const
 
 void StringHasher::clearMarks() const
 {
+    std::shared_lock<std::shared_mutex> lock(_hashes->mutex);
     for (auto& hasher : _hashes->right) {
         hasher.second->_flags.setFlag(StringID::Flag::Marked, false);
     }
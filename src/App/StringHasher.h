@@ -630,6 +630,9 @@ private:
 /// If the string is longer than a given threshold, instead of storing the string, its SHA1 hash is
 /// stored (and the original string discarded). This allows an upper threshold on the length of a
 /// stored string, while still effectively guaranteeing uniqueness in the table.
+///
+/// Strings may be added and looked up from multiple threads at the same time, e.g. when generating
+/// element maps in parallel. The reference count of StringID is atomic.
 class AppExport StringHasher: public Base::Persistence, public Base::Handled
 {
 
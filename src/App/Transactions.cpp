@@ -30,13 +30,19 @@
 
 #include <atomic>
 #include <Base/Console.h>
+#include <Base/FileInfo.h>
 #include <Base/Reader.h>
+#include <Base/Stream.h>
 #include <Base/Writer.h>
 
 #include "Transactions.h"
+#include "ComplexGeoData.h"
 #include "Document.h"
 #include "DocumentObject.h"
 #include "Property.h"
+#include "PropertyGeo.h"
+#include "PropertyLinks.h"
+#include "PropertyPythonObject.h"
 
 
 FC_LOG_LEVEL_INIT("App", true, true)
@@ -95,6 +101,9 @@ Transaction::~Transaction()
         }
         delete It.second;
     }
+    if (!spillFile.empty()) {
+        Base::FileInfo(spillFile).deleteFile();
+    }
 }
 
 static std::atomic<int> _TransactionID;
@@ -116,17 +125,110 @@ int Transaction::getLastID()
 
 unsigned int Transaction::getMemSize() const
 {
-    return 0;
+    unsigned int size = 0;
+    for (const auto& It : _Objects.get<0>()) {
+        size += It.second->getMemSize();
+    }
+    return size;
 }
 
-void Transaction::Save(Base::Writer& /*writer*/) const
+void Transaction::Save(Base::Writer& writer) const
 {
-    assert(0);
+    writer.Stream() << writer.ind() << "<Transaction id=\"" << transID << "\" count=\""
+                    << _Objects.size() << "\">" << std::endl;
+    writer.incInd();
+    for (const auto& It : _Objects.get<0>()) {
+        It.second->Save(writer);
+    }
+    writer.decInd();
+    writer.Stream() << writer.ind() << "</Transaction>" << std::endl;
 }
 
-void Transaction::Restore(Base::XMLReader& /*reader*/)
+void Transaction::Restore(Base::XMLReader& reader)
 {
-    assert(0);
+    reader.readElement("Transaction");
+    if (reader.getAttributeAsInteger("id") != transID
+        || reader.getAttributeAsUnsigned("count") != _Objects.size()) {
+        throw Base::FileException("Undo data does not match the transaction", spillFile.c_str());
+    }
+    for (const auto& It : _Objects.get<0>()) {
+        It.second->Restore(reader);
+    }
+    reader.readEndElement("Transaction");
+}
+
+bool Transaction::spill(const std::string& fileName)
+{
+    if (isSpilled()) {
+        return false;
+    }
+
+    auto hasCopies = [this]() {
+        for (const auto& It : _Objects.get<0>()) {
+            for (const auto& v : It.second->_PropChangeMap) {
+                const auto& data = v.second;
+                if (data.property && !data.delta && TransactionObject::canSpill(*data.property)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    if (!hasCopies()) {
+        return false;
+    }
+
+    Base::FileInfo fi(fileName);
+    try {
+        Base::ofstream file(fi, std::ios::out | std::ios::binary);
+        if (!file) {
+            FC_WARN("Cannot open undo file " << fileName);
+            return false;
+        }
+        // no compression, spilling is about memory and not disk space
+        dumpToStream(file, 0);
+        if (!file) {
+            throw Base::FileException("Failed to write undo file", fi);
+        }
+    }
+    catch (Base::Exception& e) {
+        FC_WARN("Cannot spill transaction '" << Name << "': " << e.what());
+        fi.deleteFile();
+        return false;
+    }
+    catch (std::exception& e) {
+        FC_WARN("Cannot spill transaction '" << Name << "': " << e.what());
+        fi.deleteFile();
+        return false;
+    }
+
+    for (const auto& It : _Objects.get<0>()) {
+        It.second->dropSpilled();
+    }
+    spillFile = fileName;
+    return true;
+}
+
+void Transaction::reload()
+{
+    if (!isSpilled()) {
+        return;
+    }
+
+    Base::FileInfo fi(spillFile);
+    Base::ifstream file(fi, std::ios::in | std::ios::binary);
+    if (!file) {
+        throw Base::FileException("Cannot open undo file", fi);
+    }
+    restoreFromStream(file);
+    file.close();
+    fi.deleteFile();
+    spillFile.clear();
+}
+
+bool Transaction::isSpilled() const
+{
+    return !spillFile.empty();
 }
 
 int Transaction::getID() const
@@ -171,6 +273,9 @@ void Transaction::apply(Document& Doc, bool forward)
 {
     std::string errMsg;
     try {
+        // a failure to read the values back in must not leave a half applied transaction
+        reload();
+
         auto& index = _Objects.get<0>();
         for (auto& info : index) {
             info.second->applyDel(Doc, const_cast<TransactionalObject*>(info.first));
@@ -308,6 +413,14 @@ void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj,
             auto& data = v.second;
             auto prop = const_cast<Property*>(data.propertyOrig);
 
+            if (data.delta) {
+                // only recorded for static properties, see setProperty()
+                if (pcObj->getPropertyName(prop)) {
+                    applyDelta(*data.delta, *prop);
+                }
+                continue;
+            }
+
             if (!data.property) {
                 // here means we are undoing/redoing and property add operation
                 pcObj->removeDynamicProperty(v.second.name.c_str());
@@ -376,15 +489,49 @@ void TransactionObject::applyChn(Document& /*Doc*/, TransactionalObject* pcObj,
     }
 }
 
+void TransactionObject::applyDelta(const PropertyDelta& delta, Property& prop)
+{
+    try {
+        delta.apply(prop);
+    }
+    catch (Base::Exception& e) {
+        e.ReportException();
+        FC_ERR("exception while restoring " << prop.getFullName() << ": " << e.what());
+    }
+    catch (std::exception& e) {
+        FC_ERR("exception while restoring " << prop.getFullName() << ": " << e.what());
+    }
+    catch (...) {
+    }
+}
+
 void TransactionObject::setProperty(const Property* pcProp)
 {
     auto& data = _PropChangeMap[pcProp->getID()];
+    if (data.delta) {
+        // Another change of an already recorded property. Extend the record
+        // or turn it into a full copy of the value before the first change.
+        if (!data.delta->merge(*pcProp)) {
+            data.property = pcProp->Copy();
+            data.property->setStatusValue(pcProp->getStatus());
+            applyDelta(*data.delta, *data.property);
+            data.delta.reset();
+        }
+        return;
+    }
     if (!data.property && data.name.empty()) {
         static_cast<DynamicProperty::PropData&>(data) =
             pcProp->getContainer()->getDynamicPropertyData(pcProp);
         data.propertyOrig = pcProp;
-        data.property = pcProp->Copy();
         data.propertyType = pcProp->getTypeId();
+        // Dynamic properties may have to be re-created from a full copy
+        if (data.name.empty()) {
+            data.delta.reset(pcProp->createDelta());
+            if (data.delta) {
+                return;
+            }
+        }
+        data.property = pcProp->Copy();
         data.property->setStatusValue(pcProp->getStatus());
     }
 }
@@ -409,6 +556,7 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
         delete data.property;
         data.property = nullptr;
     }
+    data.delta.reset();
     data.propertyOrig = pcProp;
     static_cast<DynamicProperty::PropData&>(data) =
         pcProp->getContainer()->getDynamicPropertyData(pcProp);
@@ -424,17 +572,100 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize() const
 {
-    return 0;
+    unsigned int size = 0;
+    for (const auto& v : _PropChangeMap) {
+        if (v.second.delta) {
+            size += v.second.delta->getMemSize();
+        }
+        else if (v.second.property) {
+            size += v.second.property->getMemSize();
+        }
+    }
+    return size;
+}
+
+bool TransactionObject::canSpill(const Property& prop)
+{
+    // small values are not worth the trip to the disk
+    constexpr unsigned int minSize = 4096;
+    if (prop.isDerivedFrom<PropertyLinkBase>() || prop.isDerivedFrom<PropertyPythonObject>()) {
+        return false;
+    }
+    // the element map refers to the string hasher of the document
+    if (auto geo = dynamic_cast<const PropertyComplexGeoData*>(&prop)) {
+        auto data = geo->getComplexData();
+        if (data && data->getElementMapSize(false) > 0) {
+            return false;
+        }
+    }
+    return prop.getMemSize() >= minSize;
 }
 
-void TransactionObject::Save(Base::Writer& /*writer*/) const
+void TransactionObject::dropSpilled()
 {
-    assert(0);
+    for (auto& v : _PropChangeMap) {
+        auto& data = v.second;
+        if (data.property && !data.delta && canSpill(*data.property)) {
+            delete data.property;
+            data.property = nullptr;
+            data.spilled = true;
+        }
+    }
 }
 
-void TransactionObject::Restore(Base::XMLReader& /*reader*/)
+void TransactionObject::Save(Base::Writer& writer) const
 {
-    assert(0);
+    std::vector<std::pair<int64_t, const Property*>> props;
+    for (const auto& v : _PropChangeMap) {
+        const auto& data = v.second;
+        if (data.property && !data.delta && canSpill(*data.property)) {
+            props.emplace_back(v.first, data.property);
+        }
+    }
+
+    writer.Stream() << writer.ind() << "<TransactionObject count=\"" << props.size() << "\">"
+                    << std::endl;
+    writer.incInd();
+    for (const auto& [id, prop] : props) {
+        writer.Stream() << writer.ind() << "<Property id=\"" << id << "\" type=\""
+                        << prop->getTypeId().getName() << "\" status=\"" << prop->getStatus()
+                        << "\">" << std::endl;
+        writer.incInd();
+        prop->Save(writer);
+        writer.decInd();
+        writer.Stream() << writer.ind() << "</Property>" << std::endl;
+    }
+    writer.decInd();
+    writer.Stream() << writer.ind() << "</TransactionObject>" << std::endl;
+}
+
+void TransactionObject::Restore(Base::XMLReader& reader)
+{
+    reader.readElement("TransactionObject");
+    long count = reader.getAttributeAsInteger("count");
+    for (long i = 0; i < count; i++) {
+        reader.readElement("Property");
+        int64_t id = reader.getAttributeAsInteger("id");
+        Base::Type type = Base::Type::fromName(reader.getAttribute("type"));
+        unsigned long status = reader.getAttributeAsUnsigned("status");
+
+        auto it = _PropChangeMap.find(id);
+        if (it == _PropChangeMap.end() || !it->second.spilled
+            || !type.isDerivedFrom(Property::getClassTypeId())) {
+            throw Base::FileException("Undo data does not match the transaction");
+        }
+        std::unique_ptr<Property> prop(static_cast<Property*>(type.createInstance()));
+        if (!prop) {
+            throw Base::TypeError("Cannot create property of undo data");
+        }
+        // the data files are read after the XML, so the copy is stored right away
+        prop->Restore(reader);
+        prop->setStatusValue(status);
+        it->second.property = prop.release();
+        it->second.spilled = false;
+        reader.readEndElement("Property");
+    }
+    reader.readEndElement("TransactionObject");
 }
 
 //**************************************************************************
@@ -25,9 +25,11 @@
 #ifndef APP_TRANSACTION_H
 #define APP_TRANSACTION_H
 
+#include <memory>
 #include <unordered_map>
 #include <Base/Factory.h>
 #include <Base/Persistence.h>
+#include <App/Property.h>
 #include <App/PropertyContainer.h>
 
 namespace App
@@ -66,10 +68,24 @@ public:
     std::string Name;
 
     unsigned int getMemSize() const override;
+    /** Saves the copies of the property values that can be moved to the disk.
+     * The objects are not saved, so the data can only be restored into this
+     * very transaction, see spill().
+     */
     void Save(Base::Writer& writer) const override;
     /// This method is used to restore properties from an XML document.
     void Restore(Base::XMLReader& reader) override;
 
+    /** Moves the copies of the property values to the file \a fileName to free
+     * their memory. They are read back in by apply(). Returns true if anything
+     * was moved.
+     */
+    bool spill(const std::string& fileName);
+    /// Reads the property values moved to the disk by spill() back in
+    void reload();
+    /// Check if some property values of the transaction are on the disk
+    bool isSpilled() const;
+
     /// Return the transaction ID
     int getID() const;
 
@@ -89,6 +105,7 @@ public:
 
 private:
     int transID;
+    std::string spillFile;
     using Info = std::pair<const TransactionalObject*, TransactionObject*>;
     bmi::multi_index_container<
         Info,
@@ -116,6 +133,13 @@ public:
 
     void setProperty(const Property* pcProp);
     void addOrRemoveProperty(const Property* pcProp, bool add);
+    static void applyDelta(const PropertyDelta& delta, Property& prop);
+    /** Check if the copy of a property value can be moved to the disk. Copies
+     * depending on their owner, like links or element maps, stay in memory.
+     */
+    static bool canSpill(const Property& prop);
+    /// Deletes the copies saved by Save(), Restore() brings them back
+    void dropSpilled();
 
     unsigned int getMemSize() const override;
     void Save(Base::Writer& writer) const override;
@@ -136,6 +160,10 @@ protected:
     {
         Base::Type propertyType;
         const Property* propertyOrig = nullptr;
+        /// compact record used instead of a full copy in 'property'
+        std::unique_ptr<PropertyDelta> delta;
+        /// the copy in 'property' has been moved to the disk, see Transaction::spill()
+        bool spilled = false;
     };
     std::unordered_map<int64_t, PropData> _PropChangeMap;
 
@@ -33,6 +33,8 @@
 #include <CXX/Objects.hxx>
 #include <boost/bimap.hpp>
 #include <boost/graph/adjacency_list.hpp>
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -91,9 +93,37 @@ struct DocumentP
 #endif  // USE_OLD_DAG
     std::multimap<const App::DocumentObject*, std::unique_ptr<App::DocumentObjectExecReturn>>
         _RecomputeLog;
+    /// guards the recompute log and transaction while recomputing concurrently
+    std::mutex recomputeMutex;
+    /// recompute statistics by object id, guarded by recomputeMutex
+    std::unordered_map<long, RecomputeProfileEntry> recomputeProfile;
+    /// objects enforced to recompute by a recomputed dependency in the running recompute
+    std::unordered_set<const DocumentObject*> recomputeByDependency;
+    /// time in seconds a feature may take in the running recompute, no limit if <= 0
+    double recomputeTimeLimit = 0.0;
 
     StringHasherRef Hasher;
 
+    /// Dependency sorted objects reused by recompute until any link changes,
+    /// see Document::_getDependencyOrder()
+    std::vector<DocumentObject*> dependencyOrder;
+    std::size_t dependencyOrderGeneration = 0;
+    /// Bumped on any change of object dependencies in any document
+    static std::atomic<std::size_t> dependencyGeneration;
+    /// Result of getDependentDocuments() indexed by the sort flag, valid
+    /// as long as the dependency generation matches
+    std::vector<App::Document*> dependentDocuments[2];
+    std::size_t dependentDocumentsGeneration[2] = {0, 0};
+
+    /// Nesting depth of the DocumentChangeBatch alive on the document
+    int changeBatchDepth = 0;
+    /// Set while the coalesced changes are signalled
+    bool flushingChangeBatch = false;
+    /// Changed properties by object, coalesced by the running DocumentChangeBatch
+    std::unordered_map<const DocumentObject*, std::vector<const Property*>> batchedChanges;
+    /// Objects of batchedChanges in the order of their first change
+    std::vector<const DocumentObject*> batchedObjects;
+
     DocumentP();
 
     void addRecomputeLog(const char* why, App::DocumentObject* obj)
@@ -112,11 +142,26 @@ struct DocumentP
             delete returnCode;
             return;
         }
+        std::lock_guard<std::mutex> guard(recomputeMutex);
         _RecomputeLog.emplace(returnCode->Which,
                               std::unique_ptr<DocumentObjectExecReturn>(returnCode));
         returnCode->Which->setStatus(ObjectStatus::Error, true);
     }
 
+    void addRecomputeProfile(const App::DocumentObject* obj,
+                             const std::string& reason,
+                             double seconds)
+    {
+        std::lock_guard<std::mutex> guard(recomputeMutex);
+        auto& entry = recomputeProfile[obj->getID()];
+        if (obj->isAttachedToDocument()) {
+            entry.name = obj->getNameInDocument();
+        }
+        entry.time += seconds;
+        entry.count++;
+        entry.reason = reason;
+    }
+
     void clearRecomputeLog(const App::DocumentObject* obj = nullptr)
     {
         if (!obj) {
@@ -129,6 +174,7 @@ struct DocumentP
 
     void clearDocument()
     {
+        ++dependencyGeneration;
         objectArray.clear();
         for (auto& v : objectMap) {
             v.second->setStatus(ObjectStatus::Destroy, true);
@@ -137,6 +183,7 @@ struct DocumentP
         }
         objectMap.clear();
         objectIdMap.clear();
+        batchedChanges.clear();
     }
 
     const char* findRecomputeLog(const App::DocumentObject* obj)
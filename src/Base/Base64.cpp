@@ -31,6 +31,7 @@ These modifications are Copyright (c) 2019 Zheng Lei (realthunder.dev@gmail.com)
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <cstdint>
 #include <string>
 #endif
 
@@ -72,43 +73,27 @@ std::size_t Base::base64_encode(char* out, void const* in, std::size_t in_len)
 {
     char* ret = out;
     auto const* bytes_to_encode = reinterpret_cast<unsigned char const*>(in);  // NOLINT
-    int char3 {0};
-    int char4 {};
-    std::array<unsigned char, 3> char_array_3 {};
-    std::array<unsigned char, 4> char_array_4 {};
 
-    while ((in_len--) != 0U) {
-        char_array_3[char3++] = *(bytes_to_encode++);
-        if (char3 == 3) {
-            char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-            char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-            char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-            char_array_4[3] = char_array_3[2] & 0x3f;
-
-            for (char3 = 0; (char3 < 4); char3++) {
-                *ret++ = base64_chars[char_array_4[char3]];
-            }
-            char3 = 0;
-        }
+    // Whole groups of three bytes, without the staging arrays or branches per byte
+    for (; in_len >= 3; in_len -= 3, bytes_to_encode += 3, ret += 4) {
+        std::uint32_t group = (std::uint32_t(bytes_to_encode[0]) << 16)
+            | (std::uint32_t(bytes_to_encode[1]) << 8) | std::uint32_t(bytes_to_encode[2]);
+        ret[0] = base64_chars[(group >> 18) & 0x3f];
+        ret[1] = base64_chars[(group >> 12) & 0x3f];
+        ret[2] = base64_chars[(group >> 6) & 0x3f];
+        ret[3] = base64_chars[group & 0x3f];
     }
 
-    if (char3 != 0) {
-        for (char4 = char3; char4 < 3; char4++) {
-            char_array_3[char4] = '\0';
-        }
-
-        char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-        char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-        char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-        char_array_4[3] = char_array_3[2] & 0x3f;
-
-        for (char4 = 0; (char4 < char3 + 1); char4++) {
-            *ret++ = base64_chars[char_array_4[char4]];
-        }
-
-        while ((char3++ < 3)) {
-            *ret++ = '=';
+    if (in_len != 0U) {
+        std::uint32_t group = std::uint32_t(bytes_to_encode[0]) << 16;
+        if (in_len == 2) {
+            group |= std::uint32_t(bytes_to_encode[1]) << 8;
         }
+        ret[0] = base64_chars[(group >> 18) & 0x3f];
+        ret[1] = base64_chars[(group >> 12) & 0x3f];
+        ret[2] = in_len == 2 ? base64_chars[(group >> 6) & 0x3f] : '=';
+        ret[3] = '=';
+        ret += 4;
     }
 
     return ret - out;
@@ -127,6 +112,22 @@ Base::base64_decode(void* _out, char const* in, std::size_t in_len)
 
     static auto table = base64_decode_table();
 
+    // Decode whole groups of four valid characters at once. The first group with padding, white
+    // space or an invalid character is left to the loop below.
+    for (; in_len >= 4; in_len -= 4, in += 4, ret += 3) {
+        int char1 = table[static_cast<unsigned char>(in[0])];
+        int char2 = table[static_cast<unsigned char>(in[1])];
+        int char3 = table[static_cast<unsigned char>(in[2])];
+        int char4 = table[static_cast<unsigned char>(in[3])];
+        if ((char1 | char2 | char3 | char4) < 0) {
+            break;
+        }
+        auto group = std::uint32_t((char1 << 18) | (char2 << 12) | (char3 << 6) | char4);
+        ret[0] = static_cast<unsigned char>(group >> 16);
+        ret[1] = static_cast<unsigned char>(group >> 8);
+        ret[2] = static_cast<unsigned char>(group);
+    }
+
     while (((in_len--) != 0U) && *in != '=') {
         const signed char lookup = table[static_cast<unsigned char>(*in++)];
         if (lookup < 0) {
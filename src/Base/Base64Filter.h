@@ -137,7 +137,7 @@ struct base64_encoder
         pos += end - buf;
         bio::write(dev, buf, end - buf);
         buffer.clear();
-        return n;
+        return res;
     }
 
     std::size_t line_size;
@@ -200,8 +200,31 @@ struct base64_decoder
                 return count ? count : -1;
             }
 
+            // Decode whole groups of four valid characters straight into the output
+            if (pending_in == 0) {
+                for (; n >= 3 && input_size - input_pos >= 4; n -= 3, count += 3, str += 3) {
+                    const char* in = input.data() + input_pos;
+                    int char1 = table[static_cast<unsigned char>(in[0])];
+                    int char2 = table[static_cast<unsigned char>(in[1])];
+                    int char3 = table[static_cast<unsigned char>(in[2])];
+                    int char4 = table[static_cast<unsigned char>(in[3])];
+                    if ((char1 | char2 | char3 | char4) < 0) {
+                        break;
+                    }
+                    auto group =
+                        std::uint32_t((char1 << 18) | (char2 << 12) | (char3 << 6) | char4);
+                    str[0] = static_cast<char>(group >> 16);
+                    str[1] = static_cast<char>(group >> 8);
+                    str[2] = static_cast<char>(group);
+                    input_pos += 4;
+                }
+                if (n == 0) {
+                    return count;
+                }
+            }
+
             for (;;) {
-                int newChar = bio::get(dev);
+                int newChar = nextChar(dev);
                 if (newChar < 0) {
                     eof = true;
                     if (pending_in <= 1) {
@@ -237,7 +260,25 @@ struct base64_decoder
         }
     }
 
+    /// Returns the next character of \a dev, read in blocks, or -1 at its end
+    template<typename Device>
+    int nextChar(Device& dev)
+    {
+        if (input_pos == input_size) {
+            std::streamsize res = bio::read(dev, input.data(), std::streamsize(input.size()));
+            if (res <= 0) {
+                return -1;
+            }
+            input_pos = 0;
+            input_size = res;
+        }
+        return static_cast<unsigned char>(input[input_pos++]);
+    }
+
     std::size_t line_size;
+    std::array<char, 1024> input {};
+    std::streamsize input_pos = 0;
+    std::streamsize input_size = 0;
     std::uint8_t pending_in = 0;
     std::array<char, 4> char_array_4 {};
     std::uint8_t pending_out = 3;
@@ -25,6 +25,7 @@
 #define BASE_BOUNDBOX_H
 
 #include <array>
+#include <cstddef>
 #include <limits>
 #include "Matrix.h"
 #include "Tools2D.h"
@@ -116,6 +117,12 @@ public:
      * @note It's up to the client programmer to make sure that both bounding boxes are valid.
      */
     inline bool IsInBox(const BoundBox2d& rcbb) const;
+    /** Checks the \a count \a points at once and sets the flag of \a inside of each point to 1 if
+     * it lies inside the box and to 0 otherwise, like IsInBox() does for a single point.
+     * @note It's up to the client programmer to make sure that this bounding box is valid.
+     */
+    inline void
+    IsInBox(const Vector3<Precision>* points, std::size_t count, unsigned char* inside) const;
     /** Checks whether the bounding box is valid. */
     bool IsValid() const;
     //@}
@@ -469,6 +476,20 @@ inline bool BoundBox3<Precision>::IsInBox(const BoundBox2d& rcBB) const
     return true;
 }
 
+template<class Precision>
+inline void BoundBox3<Precision>::IsInBox(const Vector3<Precision>* points,
+                                          std::size_t count,
+                                          unsigned char* inside) const
+{
+    // no short-circuit evaluation, so the loop has no branches
+    for (std::size_t i = 0; i < count; i++) {
+        const Vector3<Precision>& v = points[i];
+        inside[i] = static_cast<unsigned char>(
+            (v.x >= this->MinX) & (v.x <= this->MaxX) & (v.y >= this->MinY) & (v.y <= this->MaxY)
+            & (v.z >= this->MinZ) & (v.z <= this->MaxZ));
+    }
+}
+
 template<class Precision>
 inline bool BoundBox3<Precision>::IsValid() const
 {
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#endif
+
+#include "Cancellation.h"
+#include "Exception.h"
+
+
+using namespace Base;
+
+namespace
+{
+using Clock = Cancellation::Clock;
+
+std::atomic<bool> requested {false};
+thread_local Clock::time_point threadDeadline = Clock::time_point::max();
+}  // namespace
+
+void Cancellation::request()
+{
+    requested = true;
+}
+
+void Cancellation::reset()
+{
+    requested = false;
+}
+
+Cancellation::Clock::time_point Cancellation::deadline()
+{
+    return threadDeadline;
+}
+
+bool Cancellation::isRequested()
+{
+    return isRequested(threadDeadline);
+}
+
+bool Cancellation::isRequested(Clock::time_point deadline)
+{
+    return requested || (deadline != Clock::time_point::max() && Clock::now() > deadline);
+}
+
+bool Cancellation::deadlineExceeded()
+{
+    return threadDeadline != Clock::time_point::max() && Clock::now() > threadDeadline;
+}
+
+void Cancellation::check()
+{
+    if (requested) {
+        throw AbortException("Operation canceled");
+    }
+    if (deadlineExceeded()) {
+        throw AbortException("Time limit exceeded");
+    }
+}
+
+Cancellation::Deadline::Deadline(double seconds)
+    : previous(threadDeadline)
+{
+    if (seconds > 0.0) {
+        auto end = Clock::now()
+            + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+        threadDeadline = std::min(previous, end);
+    }
+}
+
+Cancellation::Deadline::~Deadline()
+{
+    threadDeadline = previous;
+}
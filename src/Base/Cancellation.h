@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef BASE_CANCELLATION_H
+#define BASE_CANCELLATION_H
+
+#include <chrono>
+
+#include <FCGlobal.h>
+
+namespace Base
+{
+
+/**
+ * Lets long running operations find out that they should stop early. This is the case if
+ * request() has been called, e.g. from another thread, or if the deadline set for the current
+ * thread has passed. App::Document::recompute() sets a deadline for every feature, if the
+ * RecomputeTimeLimit parameter is set.
+ *
+ * Operations poll isRequested() or call check() in their loops. Algorithms running on helper
+ * threads, like the ones of OCCT, take the deadline of the calling thread with them and poll
+ * isRequested(deadline) instead.
+ */
+class BaseExport Cancellation
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Asks all running operations to stop
+    static void request();
+    /// Clears the request, done at the start of a recompute
+    static void reset();
+
+    /// Returns the deadline of the current thread, Clock::time_point::max() if there is none
+    static Clock::time_point deadline();
+    /// Returns true if the operations of the current thread should stop
+    static bool isRequested();
+    /// Returns true if an operation with the given deadline should stop
+    static bool isRequested(Clock::time_point deadline);
+    /// Returns true if the deadline of the current thread has passed
+    static bool deadlineExceeded();
+    /// Throws an AbortException if the operations of the current thread should stop
+    static void check();
+
+    /// Sets a deadline for the current thread for the lifetime of the object
+    class BaseExport Deadline
+    {
+    public:
+        /// No deadline is set for \a seconds <= 0, an outer one stays in effect in any case
+        explicit Deadline(double seconds);
+        ~Deadline();
+
+        Deadline(const Deadline&) = delete;
+        Deadline(Deadline&&) = delete;
+        Deadline& operator=(const Deadline&) = delete;
+        Deadline& operator=(Deadline&&) = delete;
+
+    private:
+        Clock::time_point previous;
+    };
+};
+
+}  // namespace Base
+
+#endif  // BASE_CANCELLATION_H
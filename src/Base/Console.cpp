@@ -29,8 +29,11 @@
 #elif defined(FC_OS_LINUX) || defined(FC_OS_MACOSX)
 #include <unistd.h>
 #endif
+#include <condition_variable>
 #include <cstring>
 #include <functional>
+#include <thread>
+#include <vector>
 #endif
 
 #include "Console.h"
@@ -143,6 +146,218 @@ private:
 
 ConsoleOutput* ConsoleOutput::instance = nullptr;  // NOLINT
 
+/* Bounded multi-producer queue after Dmitry Vyukov: every cell carries a
+ * sequence number telling producers and the consumer whose turn it is, so that
+ * pushing a message costs a single compare-and-swap and never takes a lock.
+ * A dedicated thread drains the queue and calls the observers.
+ */
+class ConsoleAsyncSink
+{
+public:
+    struct Message
+    {
+        LogStyle category {LogStyle::Log};
+        IntendedRecipient recipient {IntendedRecipient::All};
+        ContentType content {ContentType::Untranslated};
+        std::string notifier;
+        std::string msg;
+
+        bool operator==(const Message& other) const
+        {
+            return category == other.category && recipient == other.recipient
+                && content == other.content && notifier == other.notifier && msg == other.msg;
+        }
+    };
+
+    static constexpr std::size_t Capacity = 4096;
+
+    ConsoleAsyncSink()
+        : cells(Capacity)
+    {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        worker = std::thread([this]() {
+            run();
+        });
+    }
+
+    ~ConsoleAsyncSink()
+    {
+        stopped = true;
+        wake();
+        worker.join();
+    }
+
+    ConsoleAsyncSink(const ConsoleAsyncSink&) = delete;
+    ConsoleAsyncSink& operator=(const ConsoleAsyncSink&) = delete;
+
+    void push(Message&& message)
+    {
+        while (!tryPush(message)) {
+            if (message.category == LogStyle::Log) {
+                // Log messages are not worth blocking the sender when the queue is full
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            wake();
+            std::this_thread::yield();
+        }
+        if (sleeping.load(std::memory_order_acquire)) {
+            wake();
+        }
+    }
+
+    /// wait until all messages pushed so far have been delivered
+    void flush()
+    {
+        std::size_t target = head.load(std::memory_order_acquire);
+        flushRequested = true;
+        while (delivered.load(std::memory_order_acquire) < target) {
+            wake();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        flushRequested = false;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence {0};
+        Message message;
+    };
+
+    bool tryPush(Message& message)
+    {
+        std::size_t pos = head.load(std::memory_order_relaxed);
+        Cell* cell {};
+        for (;;) {
+            cell = &cells[pos & (Capacity - 1)];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+        cell->message = std::move(message);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool hasMessage() const
+    {
+        std::size_t pos = tail.load(std::memory_order_relaxed);
+        const Cell& cell = cells[pos & (Capacity - 1)];
+        return cell.sequence.load(std::memory_order_acquire) == pos + 1;
+    }
+
+    bool tryPop(Message& message)
+    {
+        if (!hasMessage()) {
+            return false;
+        }
+        std::size_t pos = tail.load(std::memory_order_relaxed);
+        Cell& cell = cells[pos & (Capacity - 1)];
+        message = std::move(cell.message);
+        cell.sequence.store(pos + Capacity, std::memory_order_release);
+        tail.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    void wake()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        cond.notify_one();
+    }
+
+    void deliver(const Message& message)
+    {
+        auto& console = Console();
+        std::lock_guard<std::recursive_mutex> lock(console._observerMutex);
+        console.notifyPrivate(message.category,
+                              message.recipient,
+                              message.content,
+                              message.notifier,
+                              message.msg);
+    }
+
+    void flushRepeats(Message& last, std::size_t& repeats)
+    {
+        if (repeats > 0) {
+            Message summary(last);
+            summary.msg = "(last message repeated " + std::to_string(repeats) + " more times)\n";
+            deliver(summary);
+            repeats = 0;
+        }
+        std::size_t lost = dropped.exchange(0, std::memory_order_relaxed);
+        if (lost > 0) {
+            Message summary;
+            summary.category = LogStyle::Warning;
+            summary.msg = std::to_string(lost) + " log messages dropped, console queue is full\n";
+            deliver(summary);
+        }
+    }
+
+    void run()
+    {
+        Message message;
+        Message last;
+        bool hasLast = false;
+        bool idle = false;
+        std::size_t repeats = 0;
+        for (;;) {
+            if (tryPop(message)) {
+                // Collapse runs of the same message, e.g. from a loop, into a single line
+                if (hasLast && message == last) {
+                    ++repeats;
+                    continue;
+                }
+                flushRepeats(last, repeats);
+                deliver(message);
+                last = std::move(message);
+                hasLast = true;
+                continue;
+            }
+            // The repeat count is reported once the sender has been quiet for a while
+            if (idle || stopped || flushRequested) {
+                flushRepeats(last, repeats);
+                delivered.store(tail.load(std::memory_order_relaxed), std::memory_order_release);
+            }
+            if (stopped) {
+                break;
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            sleeping.store(true, std::memory_order_release);
+            idle = !cond.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+                return stopped || flushRequested || hasMessage();
+            });
+            sleeping.store(false, std::memory_order_release);
+        }
+    }
+
+    std::vector<Cell> cells;
+    std::atomic<std::size_t> head {0};
+    std::atomic<std::size_t> tail {0};
+    std::atomic<std::size_t> delivered {0};
+    std::atomic<std::size_t> dropped {0};
+    std::atomic<bool> sleeping {false};
+    std::atomic<bool> stopped {false};
+    std::atomic<bool> flushRequested {false};
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::thread worker;
+};
+
 }  // namespace Base
 
 //**************************************************************************
@@ -160,6 +375,7 @@ ConsoleSingleton::ConsoleSingleton()
 ConsoleSingleton::~ConsoleSingleton()
 {
     ConsoleOutput::destruct();
+    _asyncSink.reset();
     for (ILogger* Iter : _aclObservers) {
         delete Iter;
     }
@@ -283,7 +499,14 @@ bool ConsoleSingleton::IsMsgTypeEnabled(const char* sObs, FreeCAD_ConsoleMsgType
 
 void ConsoleSingleton::SetConnectionMode(ConnectionMode mode)
 {
-    connectionMode = mode;
+    if (mode == Asynchronous && !_asyncSink) {
+        _asyncSink = std::make_unique<ConsoleAsyncSink>();
+    }
+    ConnectionMode previous = connectionMode.exchange(mode);
+    if (previous == Asynchronous && mode != Asynchronous) {
+        // keep the sink, a sender may still be pushing, but deliver what is pending
+        _asyncSink->flush();
+    }
 
     // make sure this method gets called from the main thread
     if (connectionMode == Queued) {
@@ -302,6 +525,7 @@ void ConsoleSingleton::SetConnectionMode(ConnectionMode mode)
  */
 void ConsoleSingleton::AttachObserver(ILogger* pcObserver)
 {
+    std::lock_guard<std::recursive_mutex> lock(_observerMutex);
     // double insert !!
     assert(_aclObservers.find(pcObserver) == _aclObservers.end());
 
@@ -315,6 +539,7 @@ void ConsoleSingleton::AttachObserver(ILogger* pcObserver)
  */
 void ConsoleSingleton::DetachObserver(ILogger* pcObserver)
 {
+    std::lock_guard<std::recursive_mutex> lock(_observerMutex);
     _aclObservers.erase(pcObserver);
 }
 
@@ -345,6 +570,21 @@ void ConsoleSingleton::postEvent(ConsoleSingleton::FreeCAD_ConsoleMsgType type,
                                 new ConsoleEvent(type, recipient, content, notifiername, msg));
 }
 
+void ConsoleSingleton::pushAsync(LogStyle category,
+                                 IntendedRecipient recipient,
+                                 ContentType content,
+                                 const std::string& notifiername,
+                                 std::string&& msg)
+{
+    ConsoleAsyncSink::Message message;
+    message.category = category;
+    message.recipient = recipient;
+    message.content = content;
+    message.notifier = notifiername;
+    message.msg = std::move(msg);
+    _asyncSink->push(std::move(message));
+}
+
 ILogger* ConsoleSingleton::Get(const char* Name) const
 {
     const char* OName {};
@@ -26,8 +26,11 @@
 
 // Std. configurations
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <sstream>
@@ -700,6 +703,8 @@ public:
  *  area) notifications.
  *
  */
+class ConsoleAsyncSink;
+
 class BaseExport ConsoleSingleton
 {
 public:
@@ -792,10 +797,18 @@ public:
     {
         Verbose = 1,  // suppress Log messages
     };
+    /** How messages reach the observers
+     *  Direct calls the observers in the sending thread, Queued delivers through the
+     *  Qt event loop of the main thread. Asynchronous pushes the messages into a
+     *  bounded queue drained by a dedicated thread, so observers must be thread-safe.
+     *  Log messages are dropped if the queue is full, and repeated messages are
+     *  collapsed into one.
+     */
     enum ConnectionMode
     {
         Direct = 0,
-        Queued = 1
+        Queued = 1,
+        Asynchronous = 2
     };
 
     enum FreeCAD_ConsoleMsgType
@@ -817,6 +830,10 @@ public:
     /// Checks if message types of a certain console observer are enabled
     bool IsMsgTypeEnabled(const char* sObs, FreeCAD_ConsoleMsgType type) const;
     void SetConnectionMode(ConnectionMode mode);
+    ConnectionMode GetConnectionMode() const
+    {
+        return connectionMode;
+    }
 
     int* GetLogLevel(const char* tag, bool create = true);
 
@@ -865,7 +882,7 @@ private:
 
     bool _bVerbose {true};
     bool _bCanRefresh {true};
-    ConnectionMode connectionMode {Direct};
+    std::atomic<ConnectionMode> connectionMode {Direct};
 
     // Singleton!
     ConsoleSingleton();
@@ -888,6 +905,11 @@ private:
                        ContentType content,
                        const std::string& notifiername,
                        const std::string& msg);
+    void pushAsync(LogStyle category,
+                   IntendedRecipient recipient,
+                   ContentType content,
+                   const std::string& notifiername,
+                   std::string&& msg);
 
     // singleton
     static void Destruct();
@@ -895,11 +917,15 @@ private:
 
     // observer list
     std::set<ILogger*> _aclObservers;
+    // guards the observer list against the asynchronous drain thread
+    std::recursive_mutex _observerMutex;
+    std::unique_ptr<ConsoleAsyncSink> _asyncSink;
 
     std::map<std::string, int> _logLevels;
     int _defaultLogLevel;
 
     friend class ConsoleOutput;
+    friend class ConsoleAsyncSink;
 };
 
 /** Access to the Console
@@ -1174,6 +1200,9 @@ Base::ConsoleSingleton::Send(const std::string& notifiername, const char* pMsg,
     if (connectionMode == Direct) {
         Notify<category, recipient, contenttype>(notifiername, format);
     }
+    else if (connectionMode == Asynchronous) {
+        pushAsync(category, recipient, contenttype, notifiername, std::move(format));
+    }
     else {
 
         auto type = getConsoleMsg(category);
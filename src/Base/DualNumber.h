@@ -107,6 +107,12 @@ inline DualNumber pow(DualNumber a, double pw)
 {
     return {std::pow(a.re, pw), pw * std::pow(a.re, pw - 1.0) * a.du};
 }
+
+inline DualNumber sqrt(DualNumber a)
+{
+    double root = std::sqrt(a.re);
+    return {root, a.du / (2.0 * root)};
+}
 }  // namespace Base
 // NOLINTEND(readability-identifier-length)
 
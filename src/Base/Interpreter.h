@@ -209,6 +209,13 @@ private:
  * must hold the GIL when instantiating an object of PyGILStateRelease.
  * As PyGILStateLocker it's best to create an instance of PyGILStateRelease on the
  * stack.
+ *
+ * While the GIL is released other Python threads may change or delete any Python
+ * object. So no Python object may be touched and no Python exception may be raised
+ * in this time. A method of a Python wrapper must copy its arguments to C++ values
+ * before releasing the GIL and create the Python objects of the result afterwards.
+ * The C++ object of the wrapper itself stays alive because the caller holds a
+ * reference to it, but it must not be used concurrently by another thread.
  */
 class BaseExport PyGILStateRelease
 {
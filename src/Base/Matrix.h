@@ -26,6 +26,7 @@
 
 #include <string>
 #include <array>
+#include <cstddef>
 
 #include "Vector3D.h"
 #ifndef FC_GLOBAL_H
@@ -98,6 +99,13 @@ public:
     inline Vector3d operator*(const Vector3d& vec) const;
     inline void multVec(const Vector3d& src, Vector3d& dst) const;
     inline void multVec(const Vector3f& src, Vector3f& dst) const;
+    /** Transform the \a count points of the contiguous array \a src into \a dst.
+     * \a src and \a dst may be the same array. \a Vec may be any type derived from
+     * Vector3f or Vector3d, e.g. a mesh point. The coefficients are loaded once and
+     * the loop has no dependencies between iterations, so the compiler can vectorize it.
+     */
+    template<typename Vec>
+    inline void multVec(const Vec* src, Vec* dst, std::size_t count) const;
     inline Matrix4D operator*(double scalar) const;
     inline Matrix4D& operator*=(double scalar);
     /// Comparison
@@ -376,6 +384,27 @@ inline void Matrix4D::multVec(const Vector3f& src, Vector3f& dst) const
     dst.Set(static_cast<float>(dx), static_cast<float>(dy), static_cast<float>(dz));
 }
 
+template<typename Vec>
+inline void Matrix4D::multVec(const Vec* src, Vec* dst, std::size_t count) const
+{
+    using float_type = decltype(src->x);
+
+    const double m00 = dMtrx4D[0][0], m01 = dMtrx4D[0][1], m02 = dMtrx4D[0][2], m03 = dMtrx4D[0][3];
+    const double m10 = dMtrx4D[1][0], m11 = dMtrx4D[1][1], m12 = dMtrx4D[1][2], m13 = dMtrx4D[1][3];
+    const double m20 = dMtrx4D[2][0], m21 = dMtrx4D[2][1], m22 = dMtrx4D[2][2], m23 = dMtrx4D[2][3];
+
+    for (std::size_t i = 0; i < count; i++) {
+        // read the whole point before writing so that src and dst may alias
+        const double sx = static_cast<double>(src[i].x);
+        const double sy = static_cast<double>(src[i].y);
+        const double sz = static_cast<double>(src[i].z);
+
+        dst[i].x = static_cast<float_type>(m00 * sx + m01 * sy + m02 * sz + m03);
+        dst[i].y = static_cast<float_type>(m10 * sx + m11 * sy + m12 * sz + m13);
+        dst[i].z = static_cast<float_type>(m20 * sx + m21 * sy + m22 * sz + m23);
+    }
+}
+
 inline Matrix4D Matrix4D::operator*(double scalar) const
 {
     Matrix4D matrix;
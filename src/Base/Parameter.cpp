@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <xercesc/dom/DOM.hpp>
 #include <xercesc/framework/LocalFileFormatTarget.hpp>
 #include <xercesc/framework/LocalFileInputSource.hpp>
@@ -163,6 +165,65 @@ inline bool DOMTreeErrorReporter::getSawErrors() const
 }
 
 
+/* Values are cached per type and name together with the group node they were
+ * read from. An entry without a value records that the parameter is missing,
+ * so that reading an unset parameter with a default is cheap as well. The
+ * generation counter prevents a value read concurrently with a change from
+ * being cached after the change has invalidated it.
+ */
+struct ParameterGrp::ValueCache
+{
+    template<typename T>
+    using Map = std::map<std::string, std::optional<T>, std::less<>>;
+
+    std::mutex mutex;
+    const DOMElement* node = nullptr;
+    std::size_t generation = 0;
+    Map<bool> bools;
+    Map<long> ints;
+    Map<unsigned long> uints;
+    Map<double> floats;
+    Map<std::string> texts;
+
+    void clear()
+    {
+        bools.clear();
+        ints.clear();
+        uints.clear();
+        floats.clear();
+        texts.clear();
+    }
+
+    template<typename T, typename Read>
+    std::optional<T> get(Map<T>& map, const DOMElement* groupNode, const char* Name, Read read)
+    {
+        if (!Name) {
+            return read();
+        }
+        std::size_t gen {};
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (node != groupNode) {
+                clear();
+                node = groupNode;
+                ++generation;
+            }
+            auto it = map.find(Name);
+            if (it != map.end()) {
+                return it->second;
+            }
+            gen = generation;
+        }
+        std::optional<T> value = read();
+        std::lock_guard<std::mutex> lock(mutex);
+        if (gen == generation) {
+            map.emplace(Name, value);
+        }
+        return value;
+    }
+};
+
+
 //**************************************************************************
 //**************************************************************************
 // ParameterManager
@@ -180,6 +241,7 @@ ParameterGrp::ParameterGrp(XERCES_CPP_NAMESPACE_QUALIFIER DOMElement* GroupNode,
                            ParameterGrp* Parent)
     : _pGroupNode(GroupNode)
     , _Parent(Parent)
+    , _Cache(std::make_unique<ValueCache>())
 {
     if (sName) {
         _cName = sName;
@@ -676,11 +738,50 @@ ParameterGrp::GetAttributeMap(ParamType Type, const char* sFilter) const
 
 void ParameterGrp::_Notify(ParamType Type, const char* Name, const char* Value)
 {
+    _InvalidateCache(Type, Name);
     if (_Manager) {
         _Manager->signalParamChanged(this, Type, Name, Value);
     }
 }
 
+void ParameterGrp::_InvalidateCache(ParamType Type, const char* Name)
+{
+    std::lock_guard<std::mutex> lock(_Cache->mutex);
+    ++_Cache->generation;
+    auto drop = [Name](auto& map) {
+        if (!Name) {
+            map.clear();
+            return;
+        }
+        auto it = map.find(Name);
+        if (it != map.end()) {
+            map.erase(it);
+        }
+    };
+    switch (Type) {
+        case ParamType::FCBool:
+            drop(_Cache->bools);
+            break;
+        case ParamType::FCInt:
+            drop(_Cache->ints);
+            break;
+        case ParamType::FCUInt:
+            drop(_Cache->uints);
+            break;
+        case ParamType::FCFloat:
+            drop(_Cache->floats);
+            break;
+        case ParamType::FCText:
+            drop(_Cache->texts);
+            break;
+        case ParamType::FCGroup:
+            break;
+        default:
+            _Cache->clear();
+            break;
+    }
+}
+
 void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Value)
 {
     const char* Type = TypeName(T);
@@ -723,15 +824,18 @@ bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
         return bPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return preset
-    if (!pcElem) {
-        return bPreset;
-    }
+    auto value = _Cache->get(_Cache->bools, _pGroupNode, Name, [&]() -> std::optional<bool> {
+        // check if Element in group
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
+        // if not return preset
+        if (!pcElem) {
+            return std::nullopt;
+        }
 
-    // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(), "1") == 0);
+        // if yes check the value and return
+        return strcmp(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(), "1") == 0;
+    });
+    return value.value_or(bPreset);
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -799,14 +903,17 @@ long ParameterGrp::GetInt(const char* Name, long lPreset) const
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-    // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    auto value = _Cache->get(_Cache->ints, _pGroupNode, Name, [&]() -> std::optional<long> {
+        // check if Element in group
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
+        // if not return preset
+        if (!pcElem) {
+            return std::nullopt;
+        }
+        // if yes check the value and return
+        return atol(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    });
+    return value.value_or(lPreset);
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -868,16 +975,22 @@ unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset)
         return lPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
+    auto value =
+        _Cache->get(_Cache->uints, _pGroupNode, Name, [&]() -> std::optional<unsigned long> {
+            // check if Element in group
+            DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
+            // if not return preset
+            if (!pcElem) {
+                return std::nullopt;
+            }
 
-    // if yes check the value and return
-    const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(), nullptr, base);
+            // if yes check the value and return
+            const int base = 10;
+            return strtoul(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(),
+                           nullptr,
+                           base);
+        });
+    return value.value_or(lPreset);
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -946,14 +1059,17 @@ double ParameterGrp::GetFloat(const char* Name, double dPreset) const
         return dPreset;
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return preset
-    if (!pcElem) {
-        return dPreset;
-    }
-    // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    auto value = _Cache->get(_Cache->floats, _pGroupNode, Name, [&]() -> std::optional<double> {
+        // check if Element in group
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
+        // if not return preset
+        if (!pcElem) {
+            return std::nullopt;
+        }
+        // if yes check the value and return
+        return atof(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    });
+    return value.value_or(dPreset);
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1058,21 +1174,27 @@ std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
         return pPreset ? pPreset : "";
     }
 
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return preset
-    if (!pcElem) {
-        if (!pPreset) {
-            return {};
+    auto value = _Cache->get(_Cache->texts, _pGroupNode, Name, [&]() -> std::optional<std::string> {
+        // check if Element in group
+        DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
+        // if not return preset
+        if (!pcElem) {
+            return std::nullopt;
+        }
+        // if yes check the value and return
+        DOMNode* pcElem2 = pcElem->getFirstChild();
+        if (pcElem2) {
+            return std::string(StrXUTF8(pcElem2->getNodeValue()).c_str());
         }
-        return {pPreset};
+        return std::string();
+    });
+    if (value) {
+        return *value;
     }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
+    if (!pPreset) {
+        return {};
     }
-    return {};
+    return {pPreset};
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1527,6 +1649,7 @@ void ParameterGrp::NotifyAll()
 void ParameterGrp::_Reset()
 {
     _pGroupNode = nullptr;
+    _InvalidateCache();
     for (auto& v : _GroupMap) {
         v.second->_Reset();
     }
@@ -1856,6 +1979,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE_QUALIFIER InputSou
     }
 
     _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+    _InvalidateCache();
 
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -1981,6 +2105,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStr("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStr("Name").unicodeForm(), XStr("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _InvalidateCache();
 }
 
 void ParameterManager::CheckDocument() const
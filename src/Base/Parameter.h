@@ -50,6 +50,7 @@ using PyObject = struct _object;
 #endif
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <boost_signals2.hpp>
 #include <xercesc/util/XercesDefs.hpp>
@@ -301,6 +302,11 @@ protected:
 
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
+    /** Drop cached values
+     *  Only the value \a Name of the given \a Type is dropped if given,
+     *  otherwise all values of the type, or all values for FCInvalid.
+     */
+    void _InvalidateCache(ParamType Type = ParamType::FCInvalid, const char* Name = nullptr);
 
     XERCES_CPP_NAMESPACE_QUALIFIER DOMElement*
     FindNextElement(XERCES_CPP_NAMESPACE_QUALIFIER DOMNode* Prev, const char* Type) const;
@@ -351,6 +357,11 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+
+private:
+    /// typed values read from the DOM so that repeated reads skip the lookup and transcoding
+    struct ValueCache;
+    std::unique_ptr<ValueCache> _Cache;
 };
 
 /** The parameter serializer class
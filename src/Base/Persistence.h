@@ -112,6 +112,17 @@ public:
      * ostream).
      */
     virtual void SaveDocFile(Writer& /*writer*/) const;
+    /** Returns true if SaveDocFile() may run on a worker thread
+     * A writer that supports it (e.g. Base::ZipWriter) then passes a private
+     * writer which is compressed in the background. An object that returns true
+     * must only stream its data into the given writer, must not call addFile()
+     * and must not touch any state shared with other objects.
+     * The default implementation returns false.
+     */
+    virtual bool canSaveDocFileConcurrently() const
+    {
+        return false;
+    }
     /** This method is used to restore large amounts of data from a file
      * In this method you simply stream in your SaveDocFile() saved data.
      * Again you have to apply for the call of this method in the Restore() call:
@@ -101,6 +101,9 @@ public:
 
     void multVec(const Vector3d& src, Vector3d& dst) const;
     void multVec(const Vector3f& src, Vector3f& dst) const;
+    /// Transform the \a count points of \a src into \a dst, which may be the same array
+    void multVec(const Vector3d* src, Vector3d* dst, std::size_t count) const;
+    void multVec(const Vector3f* src, Vector3f* dst, std::size_t count) const;
     //@}
 
     static Placement slerp(const Placement& p0, const Placement& p1, double t);
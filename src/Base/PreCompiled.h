@@ -43,6 +43,7 @@
 #endif  // FC_OS_WIN32
 #include <cmath>
 #include <climits>
+#include <cstdint>
 #include <codecvt>
 
 #ifdef FC_OS_WIN32
@@ -80,6 +81,7 @@
 #include <algorithm>
 
 // streams
+#include <iomanip>
 #include <iostream>
 #include <fstream>
 #include <sstream>
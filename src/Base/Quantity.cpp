@@ -25,6 +25,10 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <array>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 #endif
 
 #include <fmt/format.h>
@@ -553,6 +557,176 @@ private:
     YY_BUFFER_STATE my_string_buffer;
 };
 
+/** Remembers the results of recently parsed strings and evicts the least recently used one
+ * when full. It also keeps the units the fast path has already looked up.
+ */
+class ParseCache
+{
+public:
+    std::optional<Quantity> find(const std::string& str)
+    {
+        auto it = index.find(str);
+        if (it == index.end()) {
+            return {};
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        // Build a new quantity so that it gets the current default format
+        return Quantity(it->second->value, it->second->unit);
+    }
+
+    void insert(const std::string& str, const Quantity& quantity)
+    {
+        if (index.find(str) != index.end()) {
+            return;
+        }
+        entries.push_front({str, quantity.getValue(), quantity.getUnit()});
+        index.emplace(str, entries.begin());
+        if (entries.size() > maxEntries) {
+            index.erase(entries.back().str);
+            entries.pop_back();
+        }
+    }
+
+    std::unordered_map<std::string, Quantity> units;
+
+private:
+    struct Entry
+    {
+        std::string str;
+        double value;
+        Unit unit;
+    };
+    static constexpr std::size_t maxEntries = 1024;
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+};
+
+/// The scanner and parser keep their state in globals, so only one string can be parsed at a time
+std::mutex& parserMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+ParseCache& parseCache()
+{
+    static ParseCache cache;
+    return cache;
+}
+
+/// Returns the quantity if \a word is exactly one unit token of the scanner
+std::optional<Quantity> lookupUnit(const std::string& word)
+{
+    ParseCache& cache = parseCache();
+    auto it = cache.units.find(word);
+    if (it != cache.units.end()) {
+        return it->second;
+    }
+
+    YY_BUFFER_STATE buffer = yy_scan_string(word.c_str());
+    StringBufferCleaner cleaner(buffer);
+    if (yylex() != UNIT) {
+        return {};
+    }
+    Quantity unit = yylval;
+    if (yylex() != 0) {
+        return {};
+    }
+    cache.units.emplace(word, unit);
+    return unit;
+}
+
+/** Parses the common form "[-]number [unit]" without running the grammar. The number follows
+ * the NUM rules of the scanner. Returns nothing for any other input, which is then left to the
+ * full parser.
+ */
+std::optional<Quantity> parseSimple(const std::string& str)
+{
+    auto isDigit = [](char ch) {
+        return ch >= '0' && ch <= '9';
+    };
+    auto isSpace = [](char ch) {
+        return ch == ' ' || ch == '\t' || ch == '\n';
+    };
+    auto isUnitChar = [](char ch) {
+        // letters, the quotes for foot and inch and multi-byte UTF-8 characters like 'µ' or '°'
+        return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '"' || ch == '\''
+            || static_cast<unsigned char>(ch) >= 0x80;
+    };
+
+    const char* cur = str.c_str();
+    while (isSpace(*cur)) {
+        ++cur;
+    }
+    bool negative = false;
+    if (*cur == '-') {
+        negative = true;
+        ++cur;
+        while (isSpace(*cur)) {
+            ++cur;
+        }
+    }
+
+    const char* number = cur;
+    bool hasDigits = false;
+    char decimal = '.';
+    while (isDigit(*cur)) {
+        ++cur;
+        hasDigits = true;
+    }
+    if (*cur == '.' || *cur == ',') {
+        decimal = *cur++;
+        while (isDigit(*cur)) {
+            ++cur;
+            hasDigits = true;
+        }
+    }
+    if (!hasDigits) {
+        return {};
+    }
+    if (*cur == 'e' || *cur == 'E') {
+        const char* exp = cur + 1;
+        if (*exp == '-' || *exp == '+') {
+            ++exp;
+        }
+        if (isDigit(*exp)) {
+            while (isDigit(*exp)) {
+                ++exp;
+            }
+            cur = exp;
+        }
+    }
+    std::string text(number, cur);
+    double value = num_change(text.data(), decimal, decimal == '.' ? ',' : '.');
+    if (negative) {
+        value = -value;
+    }
+
+    while (isSpace(*cur)) {
+        ++cur;
+    }
+    const char* word = cur;
+    while (isUnitChar(*cur)) {
+        ++cur;
+    }
+    std::string unitWord(word, cur);
+    while (isSpace(*cur)) {
+        ++cur;
+    }
+    if (*cur != '\0') {
+        return {};
+    }
+    if (unitWord.empty()) {
+        return Quantity(value);
+    }
+
+    std::optional<Quantity> unit = lookupUnit(unitWord);
+    if (!unit) {
+        return {};
+    }
+    return Quantity(value) * *unit;
+}
+
 }  // namespace QuantityParser
 
 #if defined(__clang__)
@@ -563,14 +737,26 @@ private:
 
 Quantity Quantity::parse(const std::string& string)
 {
-    // parse from buffer
-    QuantityParser::YY_BUFFER_STATE my_string_buffer =
-        QuantityParser::yy_scan_string(string.c_str());
-    QuantityParser::StringBufferCleaner cleaner(my_string_buffer);
-    // set the global return variables
-    QuantResult = Quantity(DOUBLE_MIN);
-    // run the parser
-    QuantityParser::yyparse();
+    std::lock_guard<std::mutex> lock(QuantityParser::parserMutex());
+    QuantityParser::ParseCache& cache = QuantityParser::parseCache();
+    if (auto cached = cache.find(string)) {
+        return *cached;
+    }
+
+    std::optional<Quantity> result = QuantityParser::parseSimple(string);
+    if (!result) {
+        // parse from buffer
+        QuantityParser::YY_BUFFER_STATE my_string_buffer =
+            QuantityParser::yy_scan_string(string.c_str());
+        QuantityParser::StringBufferCleaner cleaner(my_string_buffer);
+        // set the global return variables
+        QuantResult = Quantity(DOUBLE_MIN);
+        // run the parser
+        QuantityParser::yyparse();
+        result = QuantResult;
+    }
 
-    return QuantResult;
+    // errors are thrown above and never get cached
+    cache.insert(string, *result);
+    return *result;
 }
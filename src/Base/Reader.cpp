@@ -28,7 +28,12 @@
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iterator>
 #include <locale>
+#include <thread>
 
 #include "Reader.h"
 #include "Base64.h"
@@ -43,6 +48,7 @@
 #ifdef _MSC_VER
 #include <zipios++/zipios-config.h>
 #endif
+#include <zipios++/zipfile.h>
 #include <zipios++/zipinputstream.h>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -56,6 +62,324 @@ XERCES_CPP_NAMESPACE_USE
 using namespace std;
 
 
+// ---------------------------------------------------------------------------
+//  Base::XMLReader::BufferParser: in place parser of documents in memory
+// ---------------------------------------------------------------------------
+
+/* The parser only supports the subset of XML written by Base::Writer: elements,
+ * attributes, character data, CDATA sections, comments and processing
+ * instructions. Names and values are terminated and decoded in place inside
+ * the buffer, so attributes are handed out as pointers into it.
+ */
+class Base::XMLReader::BufferParser
+{
+public:
+    explicit BufferParser(std::string&& data)
+        : data(std::move(data))
+    {
+        // make sure there is a terminating character the scanner can rely on
+        this->data.push_back('\0');
+        cur = &this->data[0];
+        end = cur + this->data.size() - 1;
+    }
+
+    bool isValid() const
+    {
+        return cur != end;
+    }
+
+    const char* findAttribute(const char* name) const
+    {
+        for (const auto& attr : attributes) {
+            if (std::strcmp(attr.first, name) == 0) {
+                return attr.second;
+            }
+        }
+        return nullptr;
+    }
+
+    unsigned int attributeCount() const
+    {
+        return static_cast<unsigned int>(attributes.size());
+    }
+
+    void next(XMLReader& reader)
+    {
+        while (cur != end) {
+            if (*cur != '<') {
+                char* text = cur;
+                while (cur != end && *cur != '<') {
+                    ++cur;
+                }
+                // Like with Xerces there is no character data outside of the root element
+                if (reader.Level > 0) {
+                    std::size_t length = decode(text, cur, false);
+                    reader.Characters.assign(text, length);
+                    reader.CharacterCount += static_cast<unsigned int>(length);
+                    reader.ReadType = Chars;
+                    return;
+                }
+                continue;
+            }
+            if (startsWith("<!--")) {
+                skipPast("-->");
+            }
+            else if (startsWith("<?")) {
+                skipPast("?>");
+            }
+            else if (startsWith("<![CDATA[")) {
+                cur += 9;
+                char* text = cur;
+                skipPast("]]>");
+                reader.Characters.assign(text, cur - 3 - text);
+                reader.ReadType = EndCDATA;
+                return;
+            }
+            else if (startsWith("<!")) {
+                skipDeclaration();
+            }
+            else if (cur[1] == '/') {
+                cur += 2;
+                const char* name = readName();
+                reader.LocalName.assign(name, cur - name);
+                skipSpace();
+                expect('>');
+                --reader.Level;
+                reader.ReadType = EndElement;
+                return;
+            }
+            else {
+                ++cur;
+                readStartTag(reader);
+                return;
+            }
+        }
+        reader.ReadType = EndDocument;
+    }
+
+private:
+    bool startsWith(const char* str) const
+    {
+        std::size_t len = std::strlen(str);
+        return static_cast<std::size_t>(end - cur) >= len && std::strncmp(cur, str, len) == 0;
+    }
+
+    void skipPast(const char* str)
+    {
+        const char* pos = std::strstr(cur, str);
+        if (!pos) {
+            fail("unterminated markup");
+        }
+        cur = const_cast<char*>(pos) + std::strlen(str);  // NOLINT
+    }
+
+    void skipDeclaration()
+    {
+        int depth = 0;
+        for (; cur != end; ++cur) {
+            if (*cur == '[') {
+                ++depth;
+            }
+            else if (*cur == ']') {
+                --depth;
+            }
+            else if (*cur == '>' && depth <= 0) {
+                ++cur;
+                return;
+            }
+        }
+        fail("unterminated declaration");
+    }
+
+    void skipSpace()
+    {
+        while (cur != end && (*cur == ' ' || *cur == '\t' || *cur == '\n' || *cur == '\r')) {
+            ++cur;
+        }
+    }
+
+    void expect(char ch)
+    {
+        if (cur == end || *cur != ch) {
+            fail("unexpected character");
+        }
+        ++cur;
+    }
+
+    const char* readName()
+    {
+        char* name = cur;
+        while (cur != end && *cur != ' ' && *cur != '\t' && *cur != '\n' && *cur != '\r'
+               && *cur != '/' && *cur != '>' && *cur != '=') {
+            ++cur;
+        }
+        if (cur == name) {
+            fail("missing name");
+        }
+        return name;
+    }
+
+    /// terminate the name just read by readName() once the start tag is complete
+    void terminateLater()
+    {
+        // the character following the name may still be needed by the scanner
+        pendingTerminators.push_back(cur);
+    }
+
+    void terminate()
+    {
+        for (char* pos : pendingTerminators) {
+            *pos = '\0';
+        }
+        pendingTerminators.clear();
+    }
+
+    void readStartTag(XMLReader& reader)
+    {
+        attributes.clear();
+        const char* name = readName();
+        terminateLater();
+        for (;;) {
+            skipSpace();
+            if (cur == end) {
+                fail("unterminated start tag");
+            }
+            if (*cur == '/' || *cur == '>') {
+                break;
+            }
+            const char* attrName = readName();
+            terminateLater();
+            skipSpace();
+            expect('=');
+            skipSpace();
+            if (cur == end || (*cur != '"' && *cur != '\'')) {
+                fail("missing attribute value");
+            }
+            char quote = *cur++;
+            char* value = cur;
+            while (cur != end && *cur != quote) {
+                ++cur;
+            }
+            if (cur == end) {
+                fail("unterminated attribute value");
+            }
+            value[decode(value, cur, true)] = '\0';
+            ++cur;
+            attributes.emplace_back(attrName, value);
+        }
+
+        bool empty = *cur == '/';
+        if (empty) {
+            ++cur;
+        }
+        expect('>');
+        terminate();
+
+        reader.LocalName = name;
+        // An empty element is reported at once like Xerces does within a single scan
+        reader.ReadType = empty ? StartEndElement : StartElement;
+        if (!empty) {
+            ++reader.Level;
+        }
+    }
+
+    /// decode the character range in place and return the decoded length
+    std::size_t decode(char* begin, const char* stop, bool attribute) const
+    {
+        char* out = begin;
+        for (const char* in = begin; in != stop;) {
+            char ch = *in;
+            if (ch == '&') {
+                in = decodeReference(in + 1, stop, out);
+                continue;
+            }
+            if (ch == '\r') {
+                // normalize line ends
+                ch = '\n';
+                if (in + 1 != stop && in[1] == '\n') {
+                    ++in;
+                }
+            }
+            if (attribute && (ch == '\n' || ch == '\t')) {
+                ch = ' ';
+            }
+            *out++ = ch;
+            ++in;
+        }
+        return out - begin;
+    }
+
+    const char* decodeReference(const char* in, const char* stop, char*& out) const
+    {
+        const char* semicolon = static_cast<const char*>(std::memchr(in, ';', stop - in));
+        if (!semicolon) {
+            fail("unterminated entity reference");
+        }
+        std::string name(in, semicolon);
+        if (name == "lt") {
+            *out++ = '<';
+        }
+        else if (name == "gt") {
+            *out++ = '>';
+        }
+        else if (name == "amp") {
+            *out++ = '&';
+        }
+        else if (name == "quot") {
+            *out++ = '"';
+        }
+        else if (name == "apos") {
+            *out++ = '\'';
+        }
+        else if (name.size() > 1 && name[0] == '#') {
+            unsigned long code = name[1] == 'x' ? std::strtoul(name.c_str() + 2, nullptr, 16)
+                                                : std::strtoul(name.c_str() + 1, nullptr, 10);
+            encodeUtf8(code, out);
+        }
+        else {
+            fail("unknown entity reference");
+        }
+        return semicolon + 1;
+    }
+
+    static void encodeUtf8(unsigned long code, char*& out)
+    {
+        // a character reference is never shorter than its UTF-8 encoding
+        if (code < 0x80) {
+            *out++ = static_cast<char>(code);
+        }
+        else if (code < 0x800) {
+            *out++ = static_cast<char>(0xC0 | (code >> 6));
+            *out++ = static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else if (code < 0x10000) {
+            *out++ = static_cast<char>(0xE0 | (code >> 12));
+            *out++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            *out++ = static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else {
+            *out++ = static_cast<char>(0xF0 | (code >> 18));
+            *out++ = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            *out++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            *out++ = static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    [[noreturn]] void fail(const char* what) const
+    {
+        auto line = std::count(data.c_str(), static_cast<const char*>(cur), '\n') + 1;
+        std::ostringstream msg;
+        msg << "XML parse error: " << what << " at line " << line;
+        throw Base::XMLParseException(msg.str());
+    }
+
+    std::string data;
+    char* cur;
+    char* end;
+    std::vector<std::pair<const char*, const char*>> attributes;
+    std::vector<char*> pendingTerminators;
+};
+
 // ---------------------------------------------------------------------------
 //  Base::XMLReader: Constructors and Destructor
 // ---------------------------------------------------------------------------
@@ -97,6 +421,14 @@ Base::XMLReader::XMLReader(const char* FileName, std::istream& str)
 #endif
 }
 
+Base::XMLReader::XMLReader(const char* FileName, std::string data)
+    : _File(FileName)
+    , bufferParser(std::make_unique<BufferParser>(std::move(data)))
+{
+    _valid = bufferParser->isValid();
+    ReadType = StartDocument;
+}
+
 Base::XMLReader::~XMLReader()
 {
     //  Delete the parser itself.  Must be done prior to calling Terminate, below.
@@ -110,6 +442,9 @@ const char* Base::XMLReader::localName() const
 
 unsigned int Base::XMLReader::getAttributeCount() const
 {
+    if (bufferParser) {
+        return bufferParser->attributeCount();
+    }
     return static_cast<unsigned int>(AttrMap.size());
 }
 
@@ -129,14 +464,24 @@ double Base::XMLReader::getAttributeAsFloat(const char* AttrName, const char* de
     return stod(getAttribute(AttrName, defaultValue), nullptr);
 }
 
-const char* Base::XMLReader::getAttribute(const char* AttrName,            // NOLINT
-                                          const char* defaultValue) const  // NOLINT
+const char* Base::XMLReader::findAttribute(const char* AttrName) const
 {
+    if (bufferParser) {
+        return bufferParser->findAttribute(AttrName);
+    }
     auto pos = AttrMap.find(AttrName);
-
     if (pos != AttrMap.end()) {
         return pos->second.c_str();
     }
+    return nullptr;
+}
+
+const char* Base::XMLReader::getAttribute(const char* AttrName,            // NOLINT
+                                          const char* defaultValue) const  // NOLINT
+{
+    if (const char* value = findAttribute(AttrName)) {
+        return value;
+    }
     if (defaultValue) {
         return defaultValue;
     }
@@ -148,11 +493,16 @@ const char* Base::XMLReader::getAttribute(const char* AttrName,            // NO
 
 bool Base::XMLReader::hasAttribute(const char* AttrName) const
 {
-    return AttrMap.find(AttrName) != AttrMap.end();
+    return findAttribute(AttrName) != nullptr;
 }
 
 bool Base::XMLReader::read()
 {
+    if (bufferParser) {
+        bufferParser->next(*this);
+        return true;
+    }
+
     ReadType = None;
 
     try {
@@ -456,6 +806,154 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
     }
 }
 
+void Base::XMLReader::readFiles(const std::vector<ArchiveEntry>& entries,
+                                std::size_t& index) const
+{
+    // Same matching as for the zip stream above, with the stream position replaced by an index
+    // into the prefetched entries.
+    if (++index >= entries.size()) {
+        return;
+    }
+    std::vector<FileEntry>::const_iterator it = FileList.begin();
+    Base::SequencerLauncher seq("Importing project files...", FileList.size());
+    while (index < entries.size() && it != FileList.end()) {
+        const ArchiveEntry& entry = entries[index];
+        std::vector<FileEntry>::const_iterator jt = it;
+        while (jt != FileList.end() && entry.FileName != jt->FileName) {
+            ++jt;
+        }
+        if (jt != FileList.end()) {
+            try {
+                Base::Streambuf buf(entry.Data);
+                std::istream str(&buf);
+                Base::Reader reader(str, jt->FileName, FileVersion);
+                jt->Object->RestoreDocFile(reader);
+                if (reader.getLocalReader()) {
+                    reader.getLocalReader()->readFiles(entries, index);
+                }
+            }
+            catch (...) {
+                Base::Console().Error("Reading failed from embedded file: %s\n",
+                                      entry.FileName.c_str());
+                FailedFiles.push_back(jt->FileName);
+            }
+            it = jt + 1;
+        }
+
+        seq.next();
+        ++index;
+    }
+}
+
+namespace
+{
+
+/// inflate the entries of the archive one after the other through a single zip stream
+std::vector<Base::ArchiveEntry> readArchiveSequentially(const Base::FileInfo& fi)
+{
+    Base::ifstream file(fi, std::ios::in | std::ios::binary);
+    if (!file) {
+        throw Base::FileException("Failed to open project file", fi);
+    }
+
+    // The zip stream is positioned at the first entry, i.e. Document.xml, on construction
+    zipios::ZipInputStream zipstream(file);
+    std::vector<Base::ArchiveEntry> entries;
+    std::string name("Document.xml");
+    for (;;) {
+        Base::ArchiveEntry entry;
+        entry.FileName = std::move(name);
+        entry.Data.assign(std::istreambuf_iterator<char>(zipstream),
+                          std::istreambuf_iterator<char>());
+        entries.push_back(std::move(entry));
+
+        zipios::ConstEntryPointer next;
+        try {
+            next = zipstream.getNextEntry();
+        }
+        catch (const std::exception&) {
+            break;
+        }
+        if (!next->isValid()) {
+            break;
+        }
+        name = next->getName();
+    }
+    return entries;
+}
+
+}  // namespace
+
+std::vector<Base::ArchiveEntry>
+Base::XMLReader::readArchive(const char* filename, int threads, bool withDocument)
+{
+    Base::FileInfo fi(filename);
+    if (threads <= 0) {
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+
+    // The central directory tells where the entries start, so every thread can inflate entries
+    // through a file stream of its own.
+    std::vector<std::pair<std::string, std::streampos>> offsets;
+    try {
+        zipios::ZipFile zip(fi.filePath());
+        for (const auto& it : zip.entries()) {
+            auto entry = static_cast<const zipios::ZipCDirEntry*>(it.get());
+            offsets.emplace_back(entry->getName(), entry->getLocalHeaderOffset());
+        }
+    }
+    catch (...) {
+        offsets.clear();
+    }
+    // the order of the files matters to readFiles()
+    std::sort(offsets.begin(), offsets.end(), [](const auto& a, const auto& b) {
+        return a.second < b.second;
+    });
+    if (threads < 2 || offsets.size() < 2 || offsets.front().first != "Document.xml") {
+        return readArchiveSequentially(fi);
+    }
+
+    std::vector<ArchiveEntry> entries(offsets.size());
+    std::atomic<std::size_t> next {withDocument ? 0U : 1U};
+    std::atomic<bool> failed {false};
+    entries.front().FileName = offsets.front().first;
+    auto inflate = [&]() {
+        Base::ifstream file(fi, std::ios::in | std::ios::binary);
+        if (!file) {
+            failed = true;
+            return;
+        }
+        for (std::size_t i = next++; i < offsets.size() && !failed; i = next++) {
+            try {
+                zipios::ZipInputStream zip(file, offsets[i].second);
+                entries[i].FileName = offsets[i].first;
+                entries[i].Data.assign(std::istreambuf_iterator<char>(zip),
+                                       std::istreambuf_iterator<char>());
+            }
+            catch (...) {
+                failed = true;
+            }
+            file.clear();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    int count = std::min(threads, static_cast<int>(offsets.size()));
+    for (int i = 1; i < count; i++) {
+        workers.emplace_back(inflate);
+    }
+    inflate();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // let the zip stream report whatever has gone wrong
+    if (failed) {
+        return readArchiveSequentially(fi);
+    }
+    return entries;
+}
+
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
 {
     FileEntry temp;
@@ -28,6 +28,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <xercesc/framework/XMLPScanToken.hpp>
 #include <xercesc/sax2/Attributes.hpp>
@@ -61,6 +62,13 @@ namespace Base
 {
 class Persistence;
 
+/// A file of a project archive that has been inflated into memory
+struct ArchiveEntry
+{
+    std::string FileName;
+    std::string Data;
+};
+
 /** The XML reader class
  * This is an important helper class for the store and retrieval system
  * of objects in FreeCAD. These classes mainly inherit the App::Persitance
@@ -140,6 +148,11 @@ public:
     };
     /// open the file and read the first element
     XMLReader(const char* FileName, std::istream&);
+    /** read from a document that is already in memory
+     * The buffer is parsed in place by a light-weight parser instead of Xerces,
+     * element and attribute names and values are referenced without copying.
+     */
+    XMLReader(const char* FileName, std::string data);
     ~XMLReader() override;
 
     /** @name boost iostream device interface */
@@ -251,6 +264,17 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /** process the requested file reads from an archive inflated by readArchive()
+     * \a index is the position of the current entry, i.e. the one that has
+     * been read last, and is advanced the same way as the zip stream above.
+     */
+    void readFiles(const std::vector<ArchiveEntry>& entries, std::size_t& index) const;
+    /** inflate all entries of the project archive \a filename in archive order
+     * The entries are inflated concurrently by up to \a threads threads, all of them if 0.
+     * If \a withDocument is false the data of the first entry, Document.xml, is left empty.
+     */
+    static std::vector<ArchiveEntry>
+    readArchive(const char* filename, int threads = 0, bool withDocument = true);
     /// get all registered file names
     const std::vector<std::string>& getFilenames() const;
     /// returns true if reading the file \a filename has failed
@@ -283,6 +307,8 @@ public:
 protected:
     /// read the next element
     bool read();
+    /// return the value of the named attribute of the current element, or null
+    const char* findAttribute(const char* AttrName) const;
 
     // -----------------------------------------------------------------------
     //  Handlers for the SAX ContentHandler interface
@@ -350,8 +376,10 @@ private:
 
 
     FileInfo _File;
-    XERCES_CPP_NAMESPACE_QUALIFIER SAX2XMLReader* parser;
+    XERCES_CPP_NAMESPACE_QUALIFIER SAX2XMLReader* parser {nullptr};
     XERCES_CPP_NAMESPACE_QUALIFIER XMLPScanToken token;
+    class BufferParser;
+    std::unique_ptr<BufferParser> bufferParser;
     bool _valid {false};
     bool _verbose {true};
 
@@ -474,6 +474,21 @@ Vector3f Rotation::multVec(const Vector3f& src) const
     return dst;
 }
 
+void Rotation::multVec(const Vector3d* src, Vector3d* dst, std::size_t count) const
+{
+    // convert the quaternion only once for the whole array
+    Matrix4D matrix;
+    getValue(matrix);
+    matrix.multVec(src, dst, count);
+}
+
+void Rotation::multVec(const Vector3f* src, Vector3f* dst, std::size_t count) const
+{
+    Matrix4D matrix;
+    getValue(matrix);
+    matrix.multVec(src, dst, count);
+}
+
 void Rotation::scaleAngle(const double scaleFactor)
 {
     Vector3d axis;
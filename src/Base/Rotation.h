@@ -24,6 +24,8 @@
 #ifndef BASE_ROTATION_H
 #define BASE_ROTATION_H
 
+#include <cstddef>
+
 #include "Vector3D.h"
 #ifndef FC_GLOBAL_H
 #include <FCGlobal.h>
@@ -161,6 +163,9 @@ public:
     Vector3d multVec(const Vector3d& src) const;
     void multVec(const Vector3f& src, Vector3f& dst) const;
     Vector3f multVec(const Vector3f& src) const;
+    /// Rotate the \a count points of \a src into \a dst, which may be the same array
+    void multVec(const Vector3d* src, Vector3d* dst, std::size_t count) const;
+    void multVec(const Vector3f* src, Vector3f* dst, std::size_t count) const;
     void scaleAngle(double scaleFactor);
     //@}
 
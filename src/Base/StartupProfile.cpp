@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <chrono>
+#include <mutex>
+#include <vector>
+#endif
+
+#include "Console.h"
+#include "FileInfo.h"
+#include "Stream.h"
+#include "StartupProfile.h"
+#include "Tools.h"
+
+
+using namespace Base;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct Step
+{
+    std::string name;
+    Clock::time_point start;
+    Clock::time_point end;
+};
+
+struct Profile
+{
+    std::mutex mutex;
+    Clock::time_point origin = Clock::now();
+    std::string fileName;
+    bool recording = true;
+    std::vector<Step> steps;
+    // indices of the steps begun but not ended yet
+    std::vector<std::size_t> open;
+};
+
+Profile& profile()
+{
+    // the steps of the startup may be recorded before main() runs
+    static Profile instance;
+    return instance;
+}
+
+long long microseconds(Clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+}  // namespace
+
+void StartupProfile::setFile(const std::string& fileName)
+{
+    auto& prof = profile();
+    std::lock_guard<std::mutex> lock(prof.mutex);
+    prof.fileName = fileName;
+}
+
+bool StartupProfile::isEnabled()
+{
+    auto& prof = profile();
+    std::lock_guard<std::mutex> lock(prof.mutex);
+    return prof.recording && !prof.fileName.empty();
+}
+
+void StartupProfile::begin(const std::string& name)
+{
+    auto& prof = profile();
+    std::lock_guard<std::mutex> lock(prof.mutex);
+    if (!prof.recording) {
+        return;
+    }
+    prof.open.push_back(prof.steps.size());
+    prof.steps.push_back({name, Clock::now(), {}});
+}
+
+void StartupProfile::end()
+{
+    auto& prof = profile();
+    std::lock_guard<std::mutex> lock(prof.mutex);
+    if (!prof.recording || prof.open.empty()) {
+        return;
+    }
+    prof.steps[prof.open.back()].end = Clock::now();
+    prof.open.pop_back();
+}
+
+void StartupProfile::write()
+{
+    auto& prof = profile();
+    std::lock_guard<std::mutex> lock(prof.mutex);
+    if (!prof.recording) {
+        return;
+    }
+    prof.recording = false;
+
+    // the steps still running, e.g. the one calling write(), end now
+    auto now = Clock::now();
+    for (auto index : prof.open) {
+        prof.steps[index].end = now;
+    }
+
+    if (!prof.fileName.empty()) {
+        Base::FileInfo fi(prof.fileName);
+        Base::ofstream str(fi, std::ios::out | std::ios::trunc);
+        if (!str) {
+            Base::Console().Warning("Cannot write startup profile to '%s'\n",
+                                    prof.fileName.c_str());
+        }
+        else {
+            str << "{\"traceEvents\":[\n";
+            bool first = true;
+            for (const auto& step : prof.steps) {
+                str << (first ? "" : ",\n") << "{\"name\":\"" << Tools::escapeJson(step.name)
+                    << "\",\"cat\":\"startup\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":"
+                    << microseconds(step.start - prof.origin)
+                    << ",\"dur\":" << microseconds(step.end - step.start) << "}";
+                first = false;
+            }
+            str << "\n],\"displayTimeUnit\":\"ms\"}\n";
+            Base::Console().Log("Startup profile written to '%s'\n", prof.fileName.c_str());
+        }
+    }
+
+    prof.steps.clear();
+    prof.open.clear();
+}
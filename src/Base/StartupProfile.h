@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef BASE_STARTUPPROFILE_H
+#define BASE_STARTUPPROFILE_H
+
+#include <string>
+
+#include <FCGlobal.h>
+
+namespace Base
+{
+
+/**
+ * Records how long the steps of the startup take, e.g. parsing the parameter files, registering
+ * the types or running the Init.py of each module.
+ *
+ * The steps are recorded from the start of the process until write() is called, steps begun in
+ * another step are nested in it. If a file was set with setFile(), e.g. by the --startup-profile
+ * command line option, write() saves the steps there in the Chrome trace event format. The file
+ * can be opened with chrome://tracing or https://ui.perfetto.dev.
+ */
+class BaseExport StartupProfile
+{
+public:
+    /// Sets the file the profile is written to, nothing is written if empty
+    static void setFile(const std::string& fileName);
+    /// Returns true if steps are still recorded and will be written to a file
+    static bool isEnabled();
+
+    /// Begins a step with the given name
+    static void begin(const std::string& name);
+    /// Ends the step begun last
+    static void end();
+
+    /// Writes the recorded steps if a file is set and stops recording, later calls do nothing
+    static void write();
+
+    /// Records a step for the lifetime of the object
+    class Scope
+    {
+    public:
+        explicit Scope(const std::string& name)
+        {
+            begin(name);
+        }
+        ~Scope()
+        {
+            end();
+        }
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+    };
+};
+
+}  // namespace Base
+
+#endif  // BASE_STARTUPPROFILE_H
@@ -24,6 +24,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <QBuffer>
 #include <QByteArray>
 #include <QIODevice>
@@ -811,6 +812,14 @@ std::streamsize Streambuf::showmanyc()
     return _end - _cur;
 }
 
+std::streamsize Streambuf::xsgetn(char* s, std::streamsize num)
+{
+    std::streamsize count = std::min<std::streamsize>(num, _end - _cur);
+    std::copy(_cur, _cur + count, s);
+    _cur += count;
+    return count;
+}
+
 std::streambuf::pos_type Streambuf::seekoff(std::streambuf::off_type off,
                                             std::ios_base::seekdir way,
                                             std::ios_base::openmode /*mode*/)
@@ -541,6 +541,7 @@ protected:
     int_type underflow() override;
     int_type pbackfail(int_type ch) override;
     std::streamsize showmanyc() override;
+    std::streamsize xsgetn(char* s, std::streamsize num) override;
     pos_type seekoff(std::streambuf::off_type off,
                      std::ios_base::seekdir way,
                      std::ios_base::openmode which = std::ios::in | std::ios::out) override;
@@ -25,6 +25,7 @@
 #ifndef _PreComp_
 #include <sstream>
 #include <locale>
+#include <iomanip>
 #include <iostream>
 #include <QDateTime>
 #endif
@@ -342,6 +343,33 @@ std::string Base::Tools::escapeEncodeFilename(const std::string& s)
     return result;
 }
 
+std::string Base::Tools::escapeJson(const std::string& s)
+{
+    std::ostringstream out;
+    for (char c : s) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c)
+                        << std::dec;
+                }
+                else {
+                    out << c;
+                }
+        }
+    }
+    return out.str();
+}
+
 std::string Base::Tools::quoted(const char* name)
 {
     std::stringstream str;
@@ -280,6 +280,8 @@ struct BaseExport Tools
     static std::string escapeEncodeString(const std::string& s);
     static QString escapeEncodeFilename(const QString& s);
     static std::string escapeEncodeFilename(const std::string& s);
+    /// Escapes the quotes, backslashes and control characters of a string for a JSON string
+    static std::string escapeJson(const std::string& s);
 
     /**
      * @brief quoted Creates a quoted string.
@@ -111,6 +111,25 @@ bool BoundBox2d::Intersect(const BoundBox2d& rclBB) const
     return (MinX < rclBB.MaxX && rclBB.MinX < MaxX && MinY < rclBB.MaxY && rclBB.MinY < MaxY);
 }
 
+void BoundBox2d::Contains(const Vector2d* points, std::size_t count, unsigned char* inside) const
+{
+    // no short-circuit evaluation, so the loop has no branches
+    for (std::size_t i = 0; i < count; i++) {
+        const Vector2d& v = points[i];
+        inside[i] = static_cast<unsigned char>((v.x >= MinX) & (v.x <= MaxX) & (v.y >= MinY)
+                                               & (v.y <= MaxY));
+    }
+}
+
+void BoundBox2d::Intersect(const BoundBox2d* boxes, std::size_t count, unsigned char* result) const
+{
+    for (std::size_t i = 0; i < count; i++) {
+        const BoundBox2d& bb = boxes[i];
+        result[i] = static_cast<unsigned char>((MinX < bb.MaxX) & (bb.MinX < MaxX)
+                                               & (MinY < bb.MaxY) & (bb.MinY < MaxY));
+    }
+}
+
 bool BoundBox2d::Intersect(const Polygon2d& rclPoly) const
 {
     Line2d clLine;
@@ -338,6 +357,79 @@ bool Polygon2d::Contains(const Vector2d& rclV) const
     return sTorsion != 0;
 }
 
+void Polygon2d::Contains(const Vector2d* points, std::size_t count, unsigned char* inside) const
+{
+    std::fill(inside, inside + count, 0);
+    std::size_t numVct = GetCtVectors();
+    if (numVct < 3) {
+        return;
+    }
+
+    // The same turns as CalcTorsion() counts, written without branches. The slope is only
+    // needed when the points of a line are on different sides of the tested point.
+    struct Edge
+    {
+        double x0, y0, x1, y1, slope;
+    };
+    std::vector<Edge> edges;
+    edges.reserve(numVct);
+    for (std::size_t i = 0; i < numVct; i++) {
+        const Vector2d& v0 = _aclVct[i];
+        const Vector2d& v1 = _aclVct[(i + 1) % numVct];
+        double dx = v1.x - v0.x;
+        double dy = v1.y - v0.y;
+        edges.push_back({v0.x, v0.y, v1.x, v1.y, dx != 0.0 && dy != 0.0 ? dy / dx : 1.0});
+    }
+
+    // Points outside the bounding box have no turns, so only the points inside are tested.
+    // They are gathered in blocks that fit into the cache and the turns of a whole block are
+    // counted for one edge after the other.
+    constexpr std::size_t blockSize = 256;
+    std::array<double, blockSize> px {};
+    std::array<double, blockSize> py {};
+    std::array<std::size_t, blockSize> index {};
+    std::array<int, blockSize> turns {};
+    std::array<unsigned char, blockSize> inBox {};
+    BoundBox2d bbox = CalcBoundBox();
+
+    for (std::size_t start = 0; start < count; start += blockSize) {
+        std::size_t size = std::min(blockSize, count - start);
+        bbox.Contains(points + start, size, inBox.data());
+        std::size_t num = 0;
+        for (std::size_t i = 0; i < size; i++) {
+            if (inBox[i]) {
+                px[num] = points[start + i].x;
+                py[num] = points[start + i].y;
+                index[num] = start + i;
+                num++;
+            }
+        }
+        if (num == 0) {
+            continue;
+        }
+
+        std::fill(turns.begin(), turns.begin() + num, 0);
+        for (const Edge& e : edges) {
+            for (std::size_t k = 0; k < num; k++) {
+                double x = px[k];
+                double y = py[k];
+                bool left0 = e.x0 <= x;
+                bool left1 = e.x1 <= x;
+                bool above0 = e.y0 > y;
+                bool above1 = e.y1 > y;
+                double resX = e.x0 + (y - e.y0) / e.slope;
+                bool cross = (above0 != above1)
+                    & ((left0 & left1) | ((left0 != left1) & (resX < x)));
+                turns[k] += int(cross) * (2 * int(above0) - 1);
+            }
+        }
+
+        for (std::size_t k = 0; k < num; k++) {
+            inside[index[k]] = static_cast<unsigned char>(turns[k] != 0);
+        }
+    }
+}
+
 void Polygon2d::Intersect(const Polygon2d& rclPolygon,
                           std::list<Polygon2d>& rclResultPolygonList) const
 {
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cfloat>
+#include <cstddef>
 #include <cstdio>
 #include <list>
 #include <vector>
@@ -133,6 +134,16 @@ public:
     bool Intersect(const Line2d& rclLine) const;
     bool Intersect(const BoundBox2d& rclBB) const;
     bool Intersect(const Polygon2d& rclPoly) const;
+
+    /** Checks the \a count \a points at once and sets the flag of \a inside of each point to 1 if
+     * the box contains it and to 0 otherwise. This gives the same results as Contains() but
+     * the compiler can vectorize the loop.
+     */
+    void Contains(const Vector2d* points, std::size_t count, unsigned char* inside) const;
+    /** Checks the \a count \a boxes at once and sets the flag of \a result of each box to 1 if
+     * it intersects this box and to 0 otherwise, like Intersect() does for a single box.
+     */
+    void Intersect(const BoundBox2d* boxes, std::size_t count, unsigned char* result) const;
 };
 
 /** Line2d ********************************************/
@@ -197,6 +208,12 @@ public:
     // misc
     BoundBox2d CalcBoundBox() const;
     bool Contains(const Vector2d& rclV) const;
+    /** Checks the \a count \a points at once and sets the flag of \a inside of each point to 1 if
+     * the polygon contains it and to 0 otherwise. This gives the same results as Contains() and
+     * is much faster for many points, because they are tested in blocks against one edge after
+     * the other in loops the compiler can vectorize.
+     */
+    void Contains(const Vector2d* points, std::size_t count, unsigned char* inside) const;
     void Intersect(const Polygon2d& rclPolygon, std::list<Polygon2d>& rclResultPolygonList) const;
     bool Intersect(const Polygon2d& other) const;
     bool Intersect(const Vector2d& rclV, double eps) const;
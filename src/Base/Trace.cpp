@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <memory>
+#include <mutex>
+#include <vector>
+#endif
+
+#include "Console.h"
+#include "FileInfo.h"
+#include "Stream.h"
+#include "Tools.h"
+#include "Trace.h"
+
+
+using namespace Base;
+
+namespace
+{
+
+using Clock = Trace::Clock;
+
+// a runaway loop must not eat up the memory, later zones of the thread are dropped
+constexpr std::size_t maxEventsPerThread = 1 << 22;
+
+struct Event
+{
+    const char* name;
+    std::string detail;
+    Clock::time_point start;
+    Clock::duration duration;
+};
+
+/// The zones of one thread, the thread only competes for the mutex with start() and write()
+struct ThreadEvents
+{
+    int id = 0;
+    std::mutex mutex;
+    std::vector<Event> events;
+    std::size_t dropped = 0;
+};
+
+struct Recorder
+{
+    std::mutex mutex;
+    Clock::time_point origin = Clock::now();
+    std::string fileName;
+    // the events of finished threads are kept until the next start()
+    std::vector<std::shared_ptr<ThreadEvents>> threads;
+    int nextId = 1;
+};
+
+Recorder& recorder()
+{
+    static Recorder instance;
+    return instance;
+}
+
+ThreadEvents& threadEvents()
+{
+    thread_local std::shared_ptr<ThreadEvents> local;
+    if (!local) {
+        local = std::make_shared<ThreadEvents>();
+        auto& rec = recorder();
+        std::lock_guard<std::mutex> lock(rec.mutex);
+        local->id = rec.nextId++;
+        rec.threads.push_back(local);
+    }
+    return *local;
+}
+
+long long microseconds(Clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+}  // namespace
+
+std::atomic<bool> Trace::enabled(false);
+
+void Trace::start()
+{
+    auto& rec = recorder();
+    std::lock_guard<std::mutex> lock(rec.mutex);
+    for (auto it = rec.threads.begin(); it != rec.threads.end();) {
+        // a buffer only held here belongs to a finished thread
+        if (it->use_count() == 1) {
+            it = rec.threads.erase(it);
+            continue;
+        }
+        std::lock_guard<std::mutex> threadLock((*it)->mutex);
+        (*it)->events.clear();
+        (*it)->dropped = 0;
+        ++it;
+    }
+    rec.origin = Clock::now();
+    enabled = true;
+}
+
+void Trace::stop()
+{
+    enabled = false;
+}
+
+bool Trace::write(const std::string& fileName)
+{
+    auto& rec = recorder();
+    std::lock_guard<std::mutex> lock(rec.mutex);
+    Base::FileInfo fi(fileName);
+    Base::ofstream str(fi, std::ios::out | std::ios::trunc);
+    if (!str) {
+        Base::Console().Warning("Cannot write trace to '%s'\n", fileName.c_str());
+        return false;
+    }
+
+    str << "{\"traceEvents\":[\n";
+    str << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"FreeCAD\"}}";
+    std::size_t dropped = 0;
+    for (const auto& thread : rec.threads) {
+        std::lock_guard<std::mutex> threadLock(thread->mutex);
+        str << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->id
+            << ",\"args\":{\"name\":\"Thread " << thread->id << "\"}}";
+        for (const auto& event : thread->events) {
+            // a zone begun before tracing was restarted
+            if (event.start < rec.origin) {
+                continue;
+            }
+            str << ",\n{\"name\":\"" << Tools::escapeJson(event.name)
+                << "\",\"cat\":\"freecad\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread->id
+                << ",\"ts\":" << microseconds(event.start - rec.origin)
+                << ",\"dur\":" << microseconds(event.duration);
+            if (!event.detail.empty()) {
+                str << ",\"args\":{\"detail\":\"" << Tools::escapeJson(event.detail) << "\"}";
+            }
+            str << "}";
+        }
+        dropped += thread->dropped;
+    }
+    str << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    if (dropped > 0) {
+        Base::Console().Warning("Trace is incomplete, %zu zones were dropped\n", dropped);
+    }
+    Base::Console().Log("Trace written to '%s'\n", fileName.c_str());
+    return true;
+}
+
+void Trace::setFile(const std::string& fileName)
+{
+    auto& rec = recorder();
+    std::lock_guard<std::mutex> lock(rec.mutex);
+    rec.fileName = fileName;
+}
+
+void Trace::writeFile()
+{
+    stop();
+    std::string fileName;
+    {
+        auto& rec = recorder();
+        std::lock_guard<std::mutex> lock(rec.mutex);
+        fileName = rec.fileName;
+        rec.fileName.clear();
+    }
+    if (!fileName.empty()) {
+        write(fileName);
+    }
+}
+
+void Trace::Zone::begin(const char* zoneName, const char* zoneDetail)
+{
+    name = zoneName;
+    if (zoneDetail) {
+        detail = zoneDetail;
+    }
+    start = Clock::now();
+}
+
+void Trace::Zone::end()
+{
+    auto now = Clock::now();
+    auto& thread = threadEvents();
+    std::lock_guard<std::mutex> lock(thread.mutex);
+    if (thread.events.size() < maxEventsPerThread) {
+        thread.events.push_back({name, std::move(detail), start, now - start});
+    }
+    else {
+        thread.dropped++;
+    }
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#ifndef BASE_TRACE_H
+#define BASE_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include <FCGlobal.h>
+
+namespace Base
+{
+
+/**
+ * Records the time spent in zones of code of all threads while tracing runs, e.g. the recompute
+ * of a document, the features it executes or the meshing of a shape.
+ *
+ * A zone is marked with FC_TRACE_ZONE(name) and lasts until the end of the enclosing block. The
+ * name must be a string literal, FC_TRACE_ZONE(name, detail) also records a detail copied when
+ * the zone begins, e.g. the name of a feature. While tracing is stopped a zone only costs a
+ * relaxed atomic load.
+ *
+ * write() saves the zones in the Chrome trace event format, one track per thread. The file can
+ * be opened with chrome://tracing or https://ui.perfetto.dev.
+ */
+class BaseExport Trace
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Starts tracing, the zones recorded before are discarded
+    static void start();
+    /// Stops tracing, the recorded zones are kept until the next start()
+    static void stop();
+    /// Returns true while tracing runs
+    static bool isEnabled()
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Writes the recorded zones to \a fileName, returns false if the file cannot be written
+    static bool write(const std::string& fileName);
+
+    /// Sets a file the zones are written to by writeFile(), e.g. by the --trace option
+    static void setFile(const std::string& fileName);
+    /// Stops tracing and writes the zones to the file set by setFile() if any
+    static void writeFile();
+
+    /// Records a zone for the lifetime of the object if tracing runs when it is created
+    class BaseExport Zone
+    {
+    public:
+        explicit Zone(const char* name, const char* detail = nullptr)
+        {
+            if (isEnabled()) {
+                begin(name, detail);
+            }
+        }
+        ~Zone()
+        {
+            if (name) {
+                end();
+            }
+        }
+
+        Zone(const Zone&) = delete;
+        Zone(Zone&&) = delete;
+        Zone& operator=(const Zone&) = delete;
+        Zone& operator=(Zone&&) = delete;
+
+    private:
+        void begin(const char* zoneName, const char* zoneDetail);
+        void end();
+
+        const char* name = nullptr;
+        std::string detail;
+        Clock::time_point start;
+    };
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+}  // namespace Base
+
+#define FC_TRACE_ZONE_CAT2(a, b) a##b
+#define FC_TRACE_ZONE_CAT(a, b) FC_TRACE_ZONE_CAT2(a, b)
+/// Records the rest of the enclosing block as a zone if tracing runs, see Base::Trace
+#define FC_TRACE_ZONE(...) \
+    Base::Trace::Zone FC_TRACE_ZONE_CAT(_fcTraceZone, __LINE__)(__VA_ARGS__)
+
+#endif  // BASE_TRACE_H
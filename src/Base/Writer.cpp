@@ -23,9 +23,15 @@
 
 #include "PreCompiled.h"
 
+#include <algorithm>
+#include <cctype>
+#include <deque>
+#include <future>
 #include <limits>
 #include <locale>
 #include <iomanip>
+#include <thread>
+#include <zlib.h>
 
 #include "Writer.h"
 #include "Base64.h"
@@ -79,6 +85,43 @@ struct cdata_filter
 
 // ---------------------------------------------------------------------------
 //  Writer: Constructors and Destructor
+namespace
+{
+
+// Writer that keeps the content of a single file in memory. It is used to
+// run Persistence::SaveDocFile() of a ZipWriter entry on a worker thread.
+class BufferWriter: public Writer
+{
+public:
+    BufferWriter(const std::set<std::string>& modes, int version)
+    {
+#ifdef _MSC_VER
+        StrStream.imbue(std::locale::empty());
+#else
+        StrStream.imbue(std::locale::classic());
+#endif
+        StrStream.precision(std::numeric_limits<double>::digits10 + 1);
+        StrStream.setf(ios::fixed, ios::floatfield);
+        setModes(modes);
+        setFileVersion(version);
+    }
+    std::ostream& Stream() override
+    {
+        return StrStream;
+    }
+    std::string getString() const
+    {
+        return StrStream.str();
+    }
+    void writeFiles() override
+    {}
+
+private:
+    std::ostringstream StrStream;
+};
+
+}  // namespace
+
 // ---------------------------------------------------------------------------
 
 Writer::Writer()
@@ -358,19 +401,152 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
     ZipStream.putNextEntry(file);
 }
 
+void ZipWriter::setEntryLevel(const std::string& extension, int level)
+{
+    std::string ext(extension);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    entryLevels[ext] = level;
+}
+
+int ZipWriter::getEntryLevel(const std::string& fileName) const
+{
+    if (!entryLevels.empty()) {
+        std::string ext = FileInfo(fileName).extension();
+        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+        auto it = entryLevels.find(ext);
+        if (it != entryLevels.end()) {
+            return it->second;
+        }
+    }
+    return compressionLevel;
+}
+
+void ZipWriter::setThreads(int num)
+{
+    if (num <= 0) {
+        num = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    threads = std::max(num, 1);
+}
+
+ZipWriter::CompressedFile ZipWriter::compressFile(const std::set<std::string>& modes,
+                                                 int version,
+                                                 const std::string& fileName,
+                                                 const Base::Persistence* object,
+                                                 int level)
+{
+    BufferWriter writer(modes, version);
+    writer.putNextEntry(fileName.c_str());
+    object->SaveDocFile(writer);
+
+    CompressedFile file;
+    file.errors = writer.getErrors();
+    if (!writer.getFilenames().empty()) {
+        file.errors.push_back("Additional files requested while saving '" + fileName
+                              + "' concurrently are ignored");
+    }
+
+    std::string raw = writer.getString();
+    if (raw.size() > std::numeric_limits<uint32>::max()) {
+        throw Base::FileException("File too big to be saved into the archive", fileName.c_str());
+    }
+
+    file.size = raw.size();
+    file.crc = crc32(crc32(0L, Z_NULL, 0),
+                     reinterpret_cast<const Bytef*>(raw.data()),  // NOLINT
+                     static_cast<uInt>(raw.size()));
+
+    if (level == Z_NO_COMPRESSION) {
+        file.data = std::move(raw);
+        file.method = zipios::STORED;
+        return file;
+    }
+
+    // raw deflate stream as written by zipios::DeflateOutputStreambuf
+    z_stream zs {};
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw Base::RuntimeError("Failed to initialize compression");
+    }
+    file.data.resize(deflateBound(&zs, static_cast<uLong>(raw.size())));
+    zs.next_in = reinterpret_cast<Bytef*>(raw.data());  // NOLINT
+    zs.avail_in = static_cast<uInt>(raw.size());
+    zs.next_out = reinterpret_cast<Bytef*>(file.data.data());  // NOLINT
+    zs.avail_out = static_cast<uInt>(file.data.size());
+    int ret = deflate(&zs, Z_FINISH);
+    file.data.resize(zs.total_out);
+    deflateEnd(&zs);
+    if (ret != Z_STREAM_END) {
+        throw Base::RuntimeError("Failed to compress " + fileName);
+    }
+
+    return file;
+}
+
+void ZipWriter::putCompressedEntry(const std::string& fileName, const CompressedFile& file)
+{
+    ZipStream.putRawEntry(fileName,
+                          file.data.data(),
+                          static_cast<uint32>(file.data.size()),
+                          static_cast<uint32>(file.crc),
+                          static_cast<uint32>(file.size),
+                          file.method);
+}
+
 void ZipWriter::writeFiles()
 {
+    // Objects supporting it are saved and compressed by worker threads while
+    // this thread writes the finished entries into the archive in their order.
+    std::deque<std::pair<std::string, std::future<CompressedFile>>> pending;
+    auto writePending = [this, &pending]() {
+        auto& front = pending.front();
+        CompressedFile file = front.second.get();
+        for (const auto& msg : file.errors) {
+            addError(msg);
+        }
+        putCompressedEntry(front.first, file);
+        pending.pop_front();
+    };
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
     while (index < FileList.size()) {
         FileEntry entry = FileList[index];
-        putNextEntry(entry.FileName.c_str());
-        indent = 0;
-        indBuf[0] = 0;
-        entry.Object->SaveDocFile(*this);
+        int level = getEntryLevel(entry.FileName);
+        // Stored entries need their size and crc up front, so they are
+        // buffered even if not saved by a worker thread
+        bool concurrent = threads > 1 || level == Z_NO_COMPRESSION;
+        if (concurrent && entry.Object->canSaveDocFileConcurrently()) {
+            if (pending.size() >= static_cast<size_t>(threads)) {
+                writePending();
+            }
+            pending.emplace_back(entry.FileName,
+                                 std::async(threads > 1 ? std::launch::async
+                                                        : std::launch::deferred,
+                                            compressFile,
+                                            Modes,
+                                            fileVersion,
+                                            entry.FileName,
+                                            entry.Object,
+                                            level));
+        }
+        else {
+            while (!pending.empty()) {
+                writePending();
+            }
+            ZipStream.setLevel(level);
+            putNextEntry(entry.FileName.c_str());
+            indent = 0;
+            indBuf[0] = 0;
+            entry.Object->SaveDocFile(*this);
+        }
         index++;
     }
+
+    while (!pending.empty()) {
+        writePending();
+    }
+    ZipStream.setLevel(compressionLevel);
 }
 
 ZipWriter::~ZipWriter()
@@ -27,6 +27,7 @@
 #include <set>
 #include <string>
 #include <sstream>
+#include <map>
 #include <vector>
 #include <cassert>
 #include <memory>
@@ -208,16 +209,54 @@ public:
     void setLevel(int level)
     {
         ZipStream.setLevel(level);
+        compressionLevel = level;
     }
+    /** Set the compression level of the additional files with the given extension.
+     * A level of 0 stores these files uncompressed. Files without an own level
+     * use the one given to setLevel().
+     */
+    void setEntryLevel(const std::string& extension, int level);
+    /** Set the number of threads used to save and compress the additional
+     * files of objects that support it (see Persistence::canSaveDocFileConcurrently()).
+     * A value of 0 uses the number of available cores, 1 saves all files serially.
+     */
+    void setThreads(int num);
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
+    /// An additional file saved and compressed in memory, see compressFile()
+    struct CompressedFile
+    {
+        std::string data;
+        unsigned long crc {0};
+        std::size_t size {0};
+        zipios::StorageMethod method {zipios::DEFLATED};
+        std::vector<std::string> errors;
+    };
+    /** Saves the additional file \a fileName of \a object into memory and compresses it with
+     * \a level. No writer is involved, so this can run on a worker thread for objects that
+     * support it (see Persistence::canSaveDocFileConcurrently()).
+     */
+    static CompressedFile compressFile(const std::set<std::string>& modes,
+                                       int version,
+                                       const std::string& fileName,
+                                       const Base::Persistence* object,
+                                       int level);
+    /// Writes a file returned by compressFile() as the next entry of the archive
+    void putCompressedEntry(const std::string& fileName, const CompressedFile& file);
+
     ZipWriter(const ZipWriter&) = delete;
     ZipWriter(ZipWriter&&) = delete;
     ZipWriter& operator=(const ZipWriter&) = delete;
     ZipWriter& operator=(ZipWriter&&) = delete;
 
+private:
+    int getEntryLevel(const std::string& fileName) const;
+
 private:
     zipios::ZipOutputStream ZipStream;
+    std::map<std::string, int> entryLevels;
+    int compressionLevel {6};
+    int threads {1};
 };
 
 /** The StringWriter class
@@ -0,0 +1,121 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# ***************************************************************************
+# *                                                                         *
+# *   Copyright (c) 2026 FreeCAD Project Association                        *
+# *                                                                         *
+# *   This file is part of FreeCAD.                                         *
+# *                                                                         *
+# *   FreeCAD is free software: you can redistribute it and/or modify it    *
+# *   under the terms of the GNU Lesser General Public License as           *
+# *   published by the Free Software Foundation, either version 2.1 of the  *
+# *   License, or (at your option) any later version.                       *
+# *                                                                         *
+# *   FreeCAD is distributed in the hope that it will be useful, but        *
+# *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+# *   Lesser General Public License for more details.                       *
+# *                                                                         *
+# *   You should have received a copy of the GNU Lesser General Public      *
+# *   License along with FreeCAD. If not, see                               *
+# *   <https://www.gnu.org/licenses/>.                                      *
+# *                                                                         *
+# ***************************************************************************
+
+"""Runs a function on many documents in parallel worker processes.
+
+The workers are forked from the calling process. They inherit the initialized application
+and all modules imported so far, so they don't pay for the startup of FreeCAD. Each worker
+opens one document at a time, passes it to the job and closes it again.
+
+Example, run with FreeCADCmd:
+
+    import glob
+    import Part
+    from freecad import batch
+
+    def export_step(doc):
+        shapes = [obj.Shape for obj in doc.Objects if hasattr(obj, "Shape")]
+        name = doc.FileName[:-6] + ".step"
+        Part.export(shapes, name)
+        return name
+
+    for result in batch.process_documents(glob.glob("/data/*.FCStd"), export_step):
+        if result.error:
+            print(result.path, "failed:", result.error)
+
+Forking is only available on POSIX systems. Elsewhere, or with processes=1, the documents
+are processed one after the other in the calling process. The job runs in a fork of a
+process that may have started threads, so it must not rely on threads of the parent, e.g.
+the GUI. As each worker handles one document at a time, jobs don't have to be thread-safe.
+"""
+
+import collections
+import multiprocessing
+import os
+import traceback
+
+import FreeCAD
+
+JobResult = collections.namedtuple("JobResult", ["path", "result", "error"])
+JobResult.__doc__ = """The outcome of a job for one document. error is None on success,
+otherwise the formatted exception and result is None."""
+
+# the job of the running batch, set before forking so the workers don't need to pickle it
+_job = None
+
+
+def _run_job(path):
+    doc = None
+    try:
+        doc = FreeCAD.openDocument(path, hidden=True)
+        if doc is None:
+            raise IOError("Cannot open " + path)
+        result = _job(doc)
+        return JobResult(path, result, None)
+    except Exception:
+        return JobResult(path, None, traceback.format_exc())
+    finally:
+        if doc is not None:
+            FreeCAD.closeDocument(doc.Name)
+
+
+def _report_progress(done, total, result):
+    state = "done" if result.error is None else "failed"
+    FreeCAD.Console.PrintMessage(f"[{done}/{total}] {result.path} {state}\n")
+
+
+def process_documents(paths, job, processes=None, progress=_report_progress):
+    """process_documents(paths, job, processes=None, progress) -> list of JobResult
+
+    Opens every document of paths, calls job(document) and returns the results in
+    the order of paths. The return value of job must be picklable.
+
+    processes is the number of workers and defaults to the number of CPUs. progress is
+    called in the calling process as progress(done, total, result) after each document,
+    the default prints a line to the console. Pass None to report nothing."""
+    global _job
+    paths = list(paths)
+    if processes is None:
+        processes = os.cpu_count() or 1
+    processes = max(1, min(processes, len(paths)))
+
+    results = []
+    _job = job
+    try:
+        if processes == 1 or "fork" not in multiprocessing.get_all_start_methods():
+            for path in paths:
+                results.append(_run_job(path))
+                if progress:
+                    progress(len(results), len(paths), results[-1])
+            return results
+
+        context = multiprocessing.get_context("fork")
+        with context.Pool(processes) as pool:
+            # imap keeps the order of paths while reporting each document when it's done
+            for result in pool.imap(_run_job, paths):
+                results.append(result)
+                if progress:
+                    progress(len(results), len(paths), result)
+        return results
+    finally:
+        _job = None
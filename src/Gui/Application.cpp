@@ -51,6 +51,7 @@
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Parameter.h>
+#include <Base/StartupProfile.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
 
@@ -2016,6 +2017,7 @@ static void init_resources()
 
 void Application::initApplication()
 {
+    Base::StartupProfile::Scope step("Gui::Application::initApplication");
     static bool init = false;
     if (init) {
         Base::Console().Error("Tried to run Gui::Application::initApplication() twice!\n");
@@ -2279,8 +2281,10 @@ void Application::runApplication()
     StartupProcess process;
     process.execute();
 
+    Base::StartupProfile::begin("Create main window");
     Application app(true);
     MainWindow mw;
+    Base::StartupProfile::end();
     mw.setProperty("QuitOnClosed", true);
 
     // https://forum.freecad.org/viewtopic.php?f=3&t=15540
@@ -2312,6 +2316,7 @@ void Application::runApplication()
     }
 #endif
 
+    Base::StartupProfile::write();
     runEventLoop(mainApp);
 
     Base::Console().Log("Finish: Event loop left\n");
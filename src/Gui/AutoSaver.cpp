@@ -24,6 +24,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <limits>
+# include <mutex>
+# include <sstream>
 # include <QApplication>
 # include <QFile>
 # include <QDir>
@@ -56,6 +59,242 @@ namespace sp = std::placeholders;
 AutoSaver* AutoSaver::self = nullptr;
 const int AutoSaveTimeout = 900000;
 
+namespace Gui {
+
+struct RecoveryCache
+{
+    using FilePtr = std::shared_ptr<const Base::ZipWriter::CompressedFile>;
+    /// file name and compressed content by the address of the property
+    using Files = std::map<std::string, std::pair<std::string, FilePtr>>;
+
+    std::mutex mutex;
+    bool busy = false;
+    Files files;
+};
+
+namespace {
+
+std::string addressOf(const Base::Persistence* object)
+{
+    std::stringstream str;
+    str << static_cast<const void *>(object) << std::ends;
+    return str.str();
+}
+
+void setupStream(std::ostream& str)
+{
+    // the same formatting as Base::ZipWriter
+#ifdef _MSC_VER
+    str.imbue(std::locale::empty());
+#else
+    str.imbue(std::locale::classic());
+#endif
+    str.precision(std::numeric_limits<double>::digits10 + 1);
+    str.setf(std::ios::fixed, std::ios::floatfield);
+}
+
+}
+
+/*!
+ Takes a snapshot of a document for the compressed recovery file on the GUI
+ thread. The XML and the files that cannot be saved concurrently are kept as
+ saved, the other properties are either copied or, if unchanged since the last
+ recovery file, taken from its cache. RecoveryZipRunnable then writes the file
+ in the background while the user continues working.
+ */
+class RecoverySnapshot : public Base::Writer
+{
+public:
+    struct Entry
+    {
+        std::string fileName;
+        std::string address;
+        /// content saved on the GUI thread
+        std::string data;
+        /// copy to be saved by the worker thread
+        std::unique_ptr<App::Property> copy;
+        /// unchanged content of the last recovery file
+        RecoveryCache::FilePtr cached;
+    };
+
+    RecoverySnapshot(const AutoSaveProperty& saver, RecoveryCache::Files files)
+        : saver(saver), lastFiles(std::move(files))
+    {
+        setupStream(xml);
+    }
+
+    std::ostream& Stream() override
+    {
+        return *current;
+    }
+
+    void writeFiles() override
+    {
+        // use a while loop because it is possible that while
+        // processing the files new ones can be added
+        size_t index = 0;
+        while (index < FileList.size()) {
+            FileEntry entry = FileList[index++];
+            Entry file;
+            file.fileName = entry.FileName;
+            if (canCopy(entry.Object)) {
+                file.address = addressOf(entry.Object);
+                auto it = lastFiles.find(file.address);
+                if (it != lastFiles.end() && it->second.first == entry.FileName
+                        && saver.touched.count(file.address) == 0) {
+                    file.cached = it->second.second;
+                }
+                else {
+                    file.copy.reset(static_cast<const App::Property*>(entry.Object)->Copy());
+                }
+            }
+            else {
+                std::ostringstream str;
+                setupStream(str);
+                current = &str;
+                indent = 0;
+                indBuf[0] = 0;
+                entry.Object->SaveDocFile(*this);
+                current = &xml;
+                file.data = str.str();
+            }
+            entries.push_back(std::move(file));
+        }
+    }
+
+    std::string getXml() const
+    {
+        return xml.str();
+    }
+
+    std::vector<Entry>& getEntries()
+    {
+        return entries;
+    }
+
+private:
+    static bool canCopy(const Base::Persistence* object)
+    {
+        // property files of view providers are rather small files
+        if (!object->isDerivedFrom<App::Property>() || !object->canSaveDocFileConcurrently()) {
+            return false;
+        }
+        const auto* prop = static_cast<const App::Property*>(object);
+        const App::PropertyContainer* parent = prop->getContainer();
+        return !parent || !parent->isDerivedFrom<Gui::ViewProvider>();
+    }
+
+private:
+    const AutoSaveProperty& saver;
+    RecoveryCache::Files lastFiles;
+    std::ostringstream xml;
+    std::ostream* current = &xml;
+    std::vector<Entry> entries;
+};
+
+class RecoveryZipRunnable : public QRunnable
+{
+public:
+    RecoveryZipRunnable(std::unique_ptr<RecoverySnapshot> snapshot,
+                        std::shared_ptr<RecoveryCache> cache,
+                        const char* dir)
+        : snapshot(std::move(snapshot))
+        , cache(std::move(cache))
+    {
+        dirName = QString::fromUtf8(dir);
+        tmpName = QString::fromLatin1("fc_recovery_file.fcstd.tmp%1").arg(rand());
+    }
+
+    void run() override
+    {
+        Base::TimeElapsed startTime;
+        RecoveryCache::Files files;
+        bool ok = false;
+        Base::FileInfo tmp((dirName + QLatin1Char('/') + tmpName).toUtf8().constData());
+        try {
+            Base::ofstream file(tmp, std::ios::out | std::ios::binary);
+            if (file.is_open()) {
+                // open extra scope to close ZipWriter properly
+                {
+                    writeFile(file, files);
+                }
+                ok = file.good();
+            }
+        }
+        catch (const Base::Exception& e) {
+            FC_ERR("Failed to write AutoRecovery file: " << e.what());
+        }
+        catch (const std::exception& e) {
+            FC_ERR("Failed to write AutoRecovery file: " << e.what());
+        }
+
+        {
+            // a failed file must not be used as source of unchanged files
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            cache->files = ok ? std::move(files) : RecoveryCache::Files();
+            cache->busy = false;
+        }
+
+        if (!ok) {
+            tmp.deleteFile();
+            return;
+        }
+        Base::Console().Log("Write AutoRecovery file in %fs\n",
+                            Base::TimeElapsed::diffTimeF(startTime, Base::TimeElapsed()));
+        QMetaObject::invokeMethod(AutoSaver::instance(), "renameFile",
+                Qt::QueuedConnection, Q_ARG(QString,dirName)
+                ,Q_ARG(QString,QString::fromLatin1("fc_recovery_file.fcstd"))
+                ,Q_ARG(QString,tmpName));
+    }
+
+private:
+    void writeFile(std::ostream& file, RecoveryCache::Files& files)
+    {
+        const int level = 1; // apparently the fastest compression
+        Base::ZipWriter writer(file);
+        writer.setModes(snapshot->getModes());
+        writer.setComment("AutoRecovery file");
+        writer.setLevel(level);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << snapshot->getXml();
+
+        for (auto& entry : snapshot->getEntries()) {
+            RecoveryCache::FilePtr data = entry.cached;
+            if (entry.copy) {
+                auto compressed = Base::ZipWriter::compressFile(snapshot->getModes(),
+                                                                snapshot->getFileVersion(),
+                                                                entry.fileName,
+                                                                entry.copy.get(),
+                                                                level);
+                for (const auto& msg : compressed.errors) {
+                    FC_WARN("AutoRecovery: " << msg);
+                }
+                compressed.errors.clear();
+                data = std::make_shared<const Base::ZipWriter::CompressedFile>(
+                    std::move(compressed));
+                entry.copy.reset();
+            }
+
+            if (data) {
+                writer.putCompressedEntry(entry.fileName, *data);
+                files[entry.address] = std::make_pair(entry.fileName, data);
+            }
+            else {
+                writer.putNextEntry(entry.fileName.c_str());
+                writer.Stream() << entry.data;
+            }
+        }
+    }
+
+private:
+    std::unique_ptr<RecoverySnapshot> snapshot;
+    std::shared_ptr<RecoveryCache> cache;
+    QString dirName;
+    QString tmpName;
+};
+
+}
+
 AutoSaver::AutoSaver(QObject* parent)
   : QObject(parent)
   , timeout(AutoSaveTimeout)
@@ -133,13 +372,24 @@ void AutoSaver::slotDeleteDocument(const App::Document& Doc)
     }
 }
 
-void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
+bool AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
 {
-    Gui::WaitCursor wc;
     App::Document* doc = App::GetApplication().getDocument(name.c_str());
     if (doc && !doc->testStatus(App::Document::PartialDoc)
             && !doc->testStatus(App::Document::TempDoc))
     {
+        RecoveryCache::Files files;
+        if (this->compressed) {
+            std::lock_guard<std::mutex> lock(saver.cache->mutex);
+            if (saver.cache->busy) {
+                // the last recovery file is still being written
+                return false;
+            }
+            files = saver.cache->files;
+        }
+
+        Gui::WaitCursor wc;
+
         // Set the document's current transient directory
         std::string dirName = doc->TransientDir.getValue();
         dirName += "/fc_recovery_files";
@@ -195,34 +445,34 @@ void AutoSaver::saveDocument(const std::string& name, AutoSaveProperty& saver)
             }
             // only create the file if something has changed
             else if (!saver.touched.empty()) {
-                std::string fn = doc->TransientDir.getValue();
-                fn += "/fc_recovery_file.fcstd";
-                Base::FileInfo tmp(fn);
-                Base::ofstream file(tmp, std::ios::out | std::ios::binary);
-                if (file.is_open())
-                {
-                    Base::ZipWriter writer(file);
-                    if (hGrp->GetBool("SaveBinaryBrep", true))
-                        writer.setMode("BinaryBrep");
+                // Only the snapshot is taken here, the file is written by a
+                // worker thread. Like above, always force binary format
+                // because ASCII is not reentrant.
+                auto snapshot = std::make_unique<RecoverySnapshot>(saver, std::move(files));
+                snapshot->setMode("BinaryBrep");
+                snapshot->putNextEntry("Document.xml");
 
-                    writer.setComment("AutoRecovery file");
-                    writer.setLevel(1); // apparently the fastest compression
-                    writer.putNextEntry("Document.xml");
+                doc->Save(*snapshot);
 
-                    doc->Save(writer);
+                // Special handling for Gui document.
+                doc->signalSaveDocument(*snapshot);
 
-                    // Special handling for Gui document.
-                    doc->signalSaveDocument(writer);
+                // copy or save additional files
+                snapshot->writeFiles();
 
-                    // write additional files
-                    writer.writeFiles();
+                {
+                    std::lock_guard<std::mutex> lock(saver.cache->mutex);
+                    saver.cache->busy = true;
                 }
+                QThreadPool::globalInstance()->start(new RecoveryZipRunnable(
+                    std::move(snapshot), saver.cache, doc->TransientDir.getValue()));
             }
         }
 
         Base::Console().Log("Save AutoRecovery file in %fs\n", Base::TimeElapsed::diffTimeF(startTime,Base::TimeElapsed()));
         hGrp->SetBool("SaveThumbnail",save);
     }
+    return true;
 }
 
 void AutoSaver::timerEvent(QTimerEvent * event)
@@ -231,8 +481,8 @@ void AutoSaver::timerEvent(QTimerEvent * event)
     for (auto & it : saverMap) {
         if (it.second->timerId == id) {
             try {
-                saveDocument(it.first, *it.second);
-                it.second->touched.clear();
+                if (saveDocument(it.first, *it.second))
+                    it.second->touched.clear();
                 break;
             }
             catch (...) {
@@ -244,7 +494,8 @@ void AutoSaver::timerEvent(QTimerEvent * event)
 
 // ----------------------------------------------------------------------------
 
-AutoSaveProperty::AutoSaveProperty(const App::Document* doc) : timerId(-1)
+AutoSaveProperty::AutoSaveProperty(const App::Document* doc)
+  : timerId(-1), cache(std::make_shared<RecoveryCache>())
 {
     //NOLINTBEGIN
     documentNew = const_cast<App::Document*>(doc)->signalNewObject.connect
@@ -274,10 +525,7 @@ void AutoSaveProperty::slotNewObject(const App::DocumentObject& obj)
 
 void AutoSaveProperty::slotChangePropertyData(const App::Property& prop)
 {
-    std::stringstream str;
-    str << static_cast<const void *>(&prop) << std::ends;
-    std::string address = str.str();
-    this->touched.insert(address);
+    this->touched.insert(addressOf(&prop));
 }
 
 // ----------------------------------------------------------------------------
@@ -304,9 +552,7 @@ bool RecoveryWriter::shouldWrite(const std::string& name, const Base::Persistenc
     }
 
     // These are the addresses of touched properties of a document object.
-    std::stringstream str;
-    str << static_cast<const void *>(object) << std::ends;
-    std::string address = str.str();
+    std::string address = addressOf(object);
 
     // Check if the property will be exported to the same file. If the file has changed or if the property hasn't been
     // yet exported then (re-)write the file.
@@ -27,6 +27,7 @@
 #include <QObject>
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <boost_signals2.hpp>
@@ -40,6 +41,7 @@ class Property;
 
 namespace Gui {
 class ViewProvider;
+struct RecoveryCache;
 
 class AutoSaveProperty
 {
@@ -50,6 +52,8 @@ public:
     std::set<std::string> touched;
     std::string dirName;
     std::map<std::string, std::string> fileMap;
+    /// compressed files of the last recovery file, shared with the thread writing it
+    std::shared_ptr<RecoveryCache> cache;
 
 private:
     void slotNewObject(const App::DocumentObject&);
@@ -87,7 +91,11 @@ protected:
     void slotCreateDocument(const App::Document& Doc);
     void slotDeleteDocument(const App::Document& Doc);
     void timerEvent(QTimerEvent * event) override;
-    void saveDocument(const std::string&, AutoSaveProperty&);
+    /*!
+     Returns false if the recovery file is still being written from the last
+     time, so the changes must be kept for the next attempt.
+     */
+    bool saveDocument(const std::string&, AutoSaveProperty&);
 
 public Q_SLOTS:
     void renameFile(QString dirName, QString file, QString tmpFile);
@@ -38,6 +38,7 @@
 #include <Base/Exception.h>
 #include <Base/Interpreter.h>
 #include <Base/Sequencer.h>
+#include <Base/Trace.h>
 
 #include "Action.h"
 #include "BitmapFactory.h"
@@ -47,6 +48,7 @@
 #include "Dialogs/DlgParameterImp.h"
 #include "Dialogs/DlgPreferencesImp.h"
 #include "Dialogs/DlgUnitsCalculatorImp.h"
+#include "FileDialog.h"
 #include "GuiConsole.h"
 #include "MainWindow.h"
 #include "OnlineDocumentation.h"
@@ -972,6 +974,42 @@ void StdCmdReloadStyleSheet::activated(int )
     Gui::Application::Instance->setStyleSheet(qssFile, tiledBackground);
 }
 
+//===========================================================================
+// Std_Trace
+//===========================================================================
+DEF_STD_CMD(StdCmdTrace)
+
+StdCmdTrace::StdCmdTrace()
+  : Command("Std_Trace")
+{
+    sGroup        = "Tools";
+    sMenuText     = QT_TR_NOOP("Start/stop &tracing");
+    sToolTipText  = QT_TR_NOOP("Starts recording where the time is spent, "
+                               "stopping saves the record as a Chrome trace file");
+    sWhatsThis    = "Std_Trace";
+    sStatusTip    = sToolTipText;
+    eType         = 0;
+}
+
+void StdCmdTrace::activated(int iMsg)
+{
+    Q_UNUSED(iMsg);
+    if (!Base::Trace::isEnabled()) {
+        Base::Trace::start();
+        Base::Console().Message("Tracing started, run the command again to save the trace\n");
+        return;
+    }
+
+    Base::Trace::stop();
+    QString format = QString::fromLatin1("%1 (*.json)").arg(QObject::tr("Chrome trace"));
+    QString fn = FileDialog::getSaveFileName(getMainWindow(), QObject::tr("Save trace"),
+                                             QString(), format);
+    if (!fn.isEmpty() && Base::Trace::write(fn.toStdString())) {
+        Base::Console().Message("Trace saved to '%s', open it with https://ui.perfetto.dev\n",
+                                fn.toUtf8().constData());
+    }
+}
+
 namespace Gui {
 
 void CreateStdCommands()
@@ -1005,6 +1043,7 @@ void CreateStdCommands()
     rcCmdMgr.addCommand(new StdCmdUnitsCalculator());
     rcCmdMgr.addCommand(new StdCmdUserEditMode());
     rcCmdMgr.addCommand(new StdCmdReloadStyleSheet());
+    rcCmdMgr.addCommand(new StdCmdTrace());
     //rcCmdMgr.addCommand(new StdCmdDownloadOnlineHelp());
     //rcCmdMgr.addCommand(new StdCmdDescription());
 }
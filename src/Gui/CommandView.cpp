@@ -2817,15 +2817,17 @@ static std::vector<std::string> getBoxSelection(
             size_t count = data->countSubElements(type);
             if(!count)
                 continue;
-            for(size_t i=1;i<=count;++i) {
+            // tessellate all elements in one pass instead of one by one
+            std::vector<Data::IndexedName> names;
+            names.reserve(count);
+            for(size_t i=1;i<=count;++i)
+                names.emplace_back(type, static_cast<int>(i));
+            auto meshes = data->getLinesFromSubElements(names);
+            for(size_t i=0;i<count;++i) {
                 std::string element(type);
-                element += std::to_string(i);
-                std::unique_ptr<Data::Segment> segment(data->getSubElementByName(element.c_str()));
-                if(!segment)
-                    continue;
-                std::vector<Base::Vector3d> points;
-                std::vector<Data::ComplexGeoData::Line> lines;
-                data->getLinesFromSubElement(segment.get(),points,lines);
+                element += std::to_string(i+1);
+                const auto &points = meshes[i].points;
+                const auto &lines = meshes[i].lines;
                 if(lines.empty()) {
                     if(points.empty())
                         continue;
@@ -2929,6 +2931,9 @@ static void doSelect(void* ud, SoEventCallback * cb)
             Gui::Selection().clearSelection(doc->getName());
         }
 
+        // collect everything inside the box first, so the selection observers
+        // get a single notification no matter how many elements are selected
+        std::vector<App::SubObjectT> sels;
         const std::vector<App::DocumentObject*> objects = doc->getObjects();
         for(auto obj : objects) {
             if(App::GeoFeatureGroupExtension::getGroupOfObject(obj))
@@ -2940,8 +2945,9 @@ static void doSelect(void* ud, SoEventCallback * cb)
 
             Base::Matrix4D mat;
             for(auto &sub : getBoxSelection(vp,selectionMode,selectElement,proj,polygon,mat))
-                Gui::Selection().addSelection(doc->getName(), obj->getNameInDocument(), sub.c_str());
+                sels.emplace_back(obj, sub.c_str());
         }
+        Gui::Selection().addSelections(sels);
     }
 }
 
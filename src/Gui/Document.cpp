@@ -507,6 +507,9 @@ Document::Document(App::Document* pcDocument,Application * app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize",20));
+        // limit the memory of the undo stack in MB, 0 means unlimited
+        unsigned long limit = std::min<unsigned long>(hGrp->GetUnsigned("MaxUndoMemory", 0), 4095);
+        d->_pcDocument->setUndoLimit(static_cast<unsigned int>(limit * 1024 * 1024));
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
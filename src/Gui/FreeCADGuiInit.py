@@ -137,6 +137,7 @@ def InitApplications():
     def RunInitGuiPy(Dir) -> bool:
         InstallFile = os.path.join(Dir,"InitGui.py")
         if os.path.exists(InstallFile):
+            FreeCAD.startupProfileBegin(InstallFile)
             try:
                 with open(InstallFile, 'rt', encoding='utf-8') as f:
                     exec(compile(f.read(), InstallFile, 'exec'))
@@ -151,6 +152,8 @@ def InitApplications():
             else:
                 Log('Init:      Initializing ' + Dir + '... done\n')
                 return True
+            finally:
+                FreeCAD.startupProfileEnd()
         else:
             Log('Init:      Initializing ' + Dir + '(InitGui.py not found)... ignore\n')
         return False
@@ -248,6 +251,7 @@ def InitApplications():
 
             if freecad_module_ispkg:
                 Log('Init: Initializing ' + freecad_module_name + '\n')
+                FreeCAD.startupProfileBegin(freecad_module_name + '.init_gui')
                 try:
                     freecad_module = importlib.import_module(freecad_module_name)
                     if any (module_name == 'init_gui' for _, module_name,
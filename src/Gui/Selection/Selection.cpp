@@ -24,7 +24,11 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <array>
+# include <map>
+# include <set>
+# include <unordered_set>
 # include <boost/algorithm/string/predicate.hpp>
 # include <QApplication>
 #endif
@@ -1127,6 +1131,54 @@ bool SelectionSingleton::addSelections(const char* pDocName, const char* pObject
     return true;
 }
 
+bool SelectionSingleton::addSelections(const std::vector<App::SubObjectT>& objs)
+{
+    if(!_PickedList.empty()) {
+        _PickedList.clear();
+        notify(SelectionChanges(SelectionChanges::PickedListChanged));
+    }
+
+    std::set<std::string> docNames;
+    for(const auto &sobjT : objs) {
+        _SelObj temp;
+        int ret = checkSelection(sobjT.getDocumentName().c_str(),
+                                 sobjT.getObjectName().c_str(),
+                                 sobjT.getSubName().c_str(),
+                                 ResolveMode::NoResolve,
+                                 temp);
+        if (ret!=0)
+            continue;
+
+        // check for a Selection Gate, rejected objects are skipped silently
+        if (ActiveGate) {
+            const char *subelement = nullptr;
+            auto pObject = getObjectOfType(temp,App::DocumentObject::getClassTypeId(),gateResolve,&subelement);
+            if (!ActiveGate->allow(pObject?pObject->getDocument():temp.pDoc,pObject,subelement)) {
+                ActiveGate->notAllowedReason.clear();
+                continue;
+            }
+        }
+
+        if(!logDisabled)
+            temp.log(false,false);
+
+        FC_LOG("Add Selection "<<temp.DocName<<'#'<<temp.FeatName<<'.'<<temp.SubName);
+
+        docNames.insert(temp.DocName);
+        _SelList.push_back(std::move(temp));
+    }
+
+    if(docNames.empty())
+        return false;
+
+    _SelStackForward.clear();
+    rmvPreselect();
+    for(const auto &docName : docNames)
+        notify(SelectionChanges(SelectionChanges::SetSelection, docName.c_str()));
+    getMainWindow()->updateActions();
+    return true;
+}
+
 bool SelectionSingleton::updateSelection(bool show, const char* pDocName,
                             const char* pObjectName, const char* pSubName)
 {
@@ -1254,6 +1306,66 @@ void SelectionSingleton::rmvSelection(const char* pDocName, const char* pObjectN
     }
 }
 
+void SelectionSingleton::rmvSelections(const std::vector<App::SubObjectT>& objs)
+{
+    // The sub names to remove for each object: either all of them, the exact
+    // names or those starting with a sub-object path ending with '.'
+    struct Match {
+        bool all = false;
+        std::unordered_set<std::string> names;
+        std::vector<std::string> prefixes;
+    };
+    std::map<std::pair<std::string,std::string>, Match> matches;
+    for(const auto &sobjT : objs) {
+        _SelObj temp;
+        int ret = checkSelection(sobjT.getDocumentName().c_str(),
+                                 sobjT.getObjectName().c_str(),
+                                 sobjT.getSubName().c_str(),
+                                 ResolveMode::NoResolve,
+                                 temp);
+        if (ret<0)
+            continue;
+        auto &match = matches[std::make_pair(temp.DocName,temp.FeatName)];
+        if(temp.SubName.empty())
+            match.all = true;
+        else if(temp.SubName.back()=='.')
+            match.prefixes.push_back(temp.SubName);
+        else
+            match.names.insert(temp.SubName);
+    }
+    if(matches.empty())
+        return;
+
+    std::set<std::string> docNames;
+    for(auto It=_SelList.begin(),ItNext=It;It!=_SelList.end();It=ItNext) {
+        ++ItNext;
+        auto itMatch = matches.find(std::make_pair(It->DocName,It->FeatName));
+        if(itMatch == matches.end())
+            continue;
+        const auto &match = itMatch->second;
+        if(!match.all && match.names.count(It->SubName)==0
+                && std::none_of(match.prefixes.begin(), match.prefixes.end(),
+                    [It](const std::string &prefix) {
+                        return boost::starts_with(It->SubName,prefix);
+                    }))
+            continue;
+
+        It->log(true);
+
+        FC_LOG("Rmv Selection "<<It->DocName<<'#'<<It->FeatName<<'.'<<It->SubName);
+
+        docNames.insert(It->DocName);
+        _SelList.erase(It);
+    }
+
+    // notify after the loop, see rmvSelection()
+    if(!docNames.empty()) {
+        for(const auto &docName : docNames)
+            notify(SelectionChanges(SelectionChanges::SetSelection, docName.c_str()));
+        getMainWindow()->updateActions();
+    }
+}
+
 struct SelInfo {
     std::string DocName;
     std::string FeatName;
@@ -1698,7 +1810,8 @@ PyMethodDef SelectionSingleton::Methods[] = {
      "x : float\n    Coordinate `x` of the point to pick.\n"
      "y : float\n    Coordinate `y` of the point to pick.\n"
      "z : float\n    Coordinate `z` of the point to pick.\n"
-     "subNames : list of str\n    List of subelement names.\n"
+     "subNames : list of str\n    List of subelement names. They are added in one go\n"
+     "    and observers get a single `setSelection` notification.\n"
      "clear : bool\n    Clear preselection."},
     {"updateSelection",      (PyCFunction) SelectionSingleton::sUpdateSelection, METH_VARARGS,
      "updateSelection(show, obj, subName) -> None\n"
@@ -1710,6 +1823,7 @@ PyMethodDef SelectionSingleton::Methods[] = {
      "subName : str\n    Name of the subelement to update."},
     {"removeSelection",      (PyCFunction) SelectionSingleton::sRemoveSelection, METH_VARARGS,
      "removeSelection(obj, subName) -> None\n"
+     "removeSelection(obj, subNames) -> None\n"
      "removeSelection(docName, objName, subName) -> None\n"
      "\n"
      "Remove an object from the selection.\n"
@@ -1717,7 +1831,9 @@ PyMethodDef SelectionSingleton::Methods[] = {
      "docName : str\n    Name of the `App.Document`.\n"
      "objName : str\n    Name of the `App.DocumentObject` to remove.\n"
      "obj : App.DocumentObject\n    Object to remove.\n"
-     "subName : str\n    Name of the subelement to remove."},
+     "subName : str\n    Name of the subelement to remove.\n"
+     "subNames : list of str\n    List of subelement names. They are removed in one go\n"
+     "    and observers get a single `setSelection` notification."},
     {"clearSelection"  ,     (PyCFunction) SelectionSingleton::sClearSelection, METH_VARARGS,
      "clearSelection(docName, clearPreSelect=True) -> None\n"
      "clearSelection(clearPreSelect=True) -> None\n"
@@ -1952,12 +2068,13 @@ PyObject *SelectionSingleton::sAddSelection(PyObject * /*self*/, PyObject *args)
         try {
             if (PyTuple_Check(sequence) || PyList_Check(sequence)) {
                 Py::Sequence list(sequence);
+                std::vector<App::SubObjectT> objs;
+                objs.reserve(list.size());
                 for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
                     std::string subname = static_cast<std::string>(Py::String(*it));
-                    Selection().addSelection(docObj->getDocument()->getName(),
-                                             docObj->getNameInDocument(),
-                                             subname.c_str(), 0, 0, 0, nullptr, Base::asBoolean(clearPreselect));
+                    objs.emplace_back(docObj, subname.c_str());
                 }
+                Selection().addSelections(objs);
                 Py_Return;
             }
         }
@@ -2006,6 +2123,31 @@ PyObject *SelectionSingleton::sRemoveSelection(PyObject * /*self*/, PyObject *ar
 
     PyErr_Clear();
     PyObject *object;
+    PyObject *sequence;
+    if (PyArg_ParseTuple(args, "O!O", &(App::DocumentObjectPy::Type),&object,&sequence)
+            && (PyTuple_Check(sequence) || PyList_Check(sequence))) {
+        auto docObjPy = static_cast<App::DocumentObjectPy*>(object);
+        App::DocumentObject* docObj = docObjPy->getDocumentObjectPtr();
+        if (!docObj || !docObj->isAttachedToDocument()) {
+            PyErr_SetString(Base::PyExc_FC_GeneralError, "Cannot check invalid object");
+            return nullptr;
+        }
+
+        PY_TRY {
+            Py::Sequence list(sequence);
+            std::vector<App::SubObjectT> objs;
+            objs.reserve(list.size());
+            for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+                std::string subname = static_cast<std::string>(Py::String(*it));
+                objs.emplace_back(docObj, subname.c_str());
+            }
+            Selection().rmvSelections(objs);
+            Py_Return;
+        }
+        PY_CATCH;
+    }
+
+    PyErr_Clear();
     subname = nullptr;
     if (!PyArg_ParseTuple(args, "O!|s", &(App::DocumentObjectPy::Type),&object,&subname))
         return nullptr;
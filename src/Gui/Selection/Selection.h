@@ -343,11 +343,23 @@ public:
     bool addSelection(const SelectionObject&, bool clearPreSelect=true);
     /// Add to selection with several sub-elements
     bool addSelections(const char* pDocName, const char* pObjectName, const std::vector<std::string>& pSubNames);
+    /** Add several (sub-)objects to the selection in one go
+     * Unlike addSelection() observers are not notified about each object but
+     * get a single SetSelection message for each document whose selection has
+     * changed, so they have to read the selection again.
+     * @return true if any object has been added
+     */
+    bool addSelections(const std::vector<App::SubObjectT>& objs);
     /// Update a selection
     bool updateSelection(bool show, const char* pDocName, const char* pObjectName=nullptr, const char* pSubName=nullptr);
     /// Remove from selection (for internal use)
     void rmvSelection(const char* pDocName, const char* pObjectName=nullptr, const char* pSubName=nullptr,
             const std::vector<SelObj> *pickedList = nullptr);
+    /** Remove several (sub-)objects from the selection in one go
+     * The matching works as with rmvSelection() but observers get a single
+     * SetSelection message for each document whose selection has changed.
+     */
+    void rmvSelections(const std::vector<App::SubObjectT>& objs);
     /// Set the selection for a document
     void setSelection(const char* pDocName, const std::vector<App::DocumentObject*>&);
     /// Clear the selection of document \a pDocName. If the document name is not given the selection of the active document is cleared.
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <chrono>
 # include <Inventor/SoFullPath.h>
 # include <Inventor/SoPickedPoint.h>
 # include <Inventor/actions/SoCallbackAction.h>
@@ -36,6 +37,7 @@
 # include <Inventor/details/SoLineDetail.h>
 # include <Inventor/elements/SoCacheElement.h>
 # include <Inventor/elements/SoCoordinateElement.h>
+# include <Inventor/elements/SoCullElement.h>
 # include <Inventor/elements/SoDrawStyleElement.h>
 # include <Inventor/elements/SoGLCacheContextElement.h>
 # include <Inventor/elements/SoLazyElement.h>
@@ -392,47 +394,10 @@ void SoFCUnifiedSelection::doAction(SoAction *action)
                 || selaction->SelChange.Type == SelectionChanges::RmvSelection))
         {
             // selection changes inside the 3d view are handled in handleEvent()
-            App::Document* doc = App::GetApplication().getDocument(selaction->SelChange.pDocName);
-            App::DocumentObject* obj = doc->getObject(selaction->SelChange.pObjectName);
-            ViewProvider*vp = Application::Instance->getViewProvider(obj);
-            if (vp && (useNewSelection.getValue()||vp->useNewSelectionModel()) && vp->isSelectable()) {
-                SoDetail *detail = nullptr;
-                detailPath->truncate(0);
-                auto subName = selaction->SelChange.pSubName;
-                App::ElementNamePair elementName;;
-                App::GeoFeature::resolveElement(obj, subName, elementName);
-                if (Data::isMappedElement(subName)
-                    && !elementName.oldName.empty()) {      // If we have a shortened element name
-                    subName = elementName.oldName.c_str();  // use it.
-                }
-                if(!selaction->SelChange.pSubName || !selaction->SelChange.pSubName[0] ||
-                    vp->getDetailPath(subName,detailPath,true,detail))
-                {
-                    SoSelectionElementAction::Type type = SoSelectionElementAction::None;
-                    if (selaction->SelChange.Type == SelectionChanges::AddSelection) {
-                        if (detail)
-                            type = SoSelectionElementAction::Append;
-                        else
-                            type = SoSelectionElementAction::All;
-                    }
-                    else {
-                        if (detail)
-                            type = SoSelectionElementAction::Remove;
-                        else
-                            type = SoSelectionElementAction::None;
-                    }
-
-                    SoSelectionElementAction selectionAction(type);
-                    selectionAction.setColor(this->colorSelection.getValue());
-                    selectionAction.setElement(detail);
-                    if(detailPath->getLength())
-                        selectionAction.apply(detailPath);
-                    else
-                        selectionAction.apply(vp->getRoot());
-                }
-                detailPath->truncate(0);
-                delete detail;
-            }
+            applySelection(selaction->SelChange.pDocName,
+                           selaction->SelChange.pObjectName,
+                           selaction->SelChange.pSubName,
+                           selaction->SelChange.Type == SelectionChanges::AddSelection);
         }
         else if (selaction->SelChange.Type == SelectionChanges::ClrSelection) {
             SoSelectionElementAction selectionAction(SoSelectionElementAction::None);
@@ -441,23 +406,24 @@ void SoFCUnifiedSelection::doAction(SoAction *action)
         }
         else if(selectionMode.getValue() == ON
                     && selaction->SelChange.Type == SelectionChanges::SetSelection) {
+            // Any number of (sub-)elements may have changed at once, see
+            // SelectionSingleton::addSelections(). So clear the highlighting
+            // and apply the current selection of the document again.
             std::vector<ViewProvider*> vps;
             if (this->pcDocument)
                 vps = this->pcDocument->getViewProvidersOfType(ViewProviderDocumentObject::getClassTypeId());
             for (const auto & vp : vps) {
                 auto vpd = static_cast<ViewProviderDocumentObject*>(vp);
                 if (useNewSelection.getValue() || vpd->useNewSelectionModel()) {
-                    SoSelectionElementAction::Type type;
-                    if(Selection().isSelected(vpd->getObject()) && vpd->isSelectable())
-                        type = SoSelectionElementAction::All;
-                    else
-                        type = SoSelectionElementAction::None;
-
-                    SoSelectionElementAction selectionAction(type);
-                    selectionAction.setColor(this->colorSelection.getValue());
+                    SoSelectionElementAction selectionAction(SoSelectionElementAction::None);
                     selectionAction.apply(vpd->getRoot());
                 }
             }
+            if (this->pcDocument) {
+                const char *docName = this->pcDocument->getDocument()->getName();
+                for (const auto &sel : Selection().getSelection(docName, ResolveMode::NoResolve))
+                    applySelection(sel.DocName, sel.FeatName, sel.SubName, true);
+            }
         }
         else if (selaction->SelChange.Type == SelectionChanges::SetPreselectSignal) {
             // selection changes inside the 3d view are handled in handleEvent()
@@ -546,6 +512,57 @@ bool SoFCUnifiedSelection::setHighlight(SoFullPath *path, const SoDetail *det,
     return highlighted;
 }
 
+void SoFCUnifiedSelection::applySelection(const char *pDocName,
+                                          const char *pObjectName,
+                                          const char *pSubName,
+                                          bool add)
+{
+    App::Document* doc = App::GetApplication().getDocument(pDocName);
+    if (!doc)
+        return;
+    App::DocumentObject* obj = doc->getObject(pObjectName);
+    ViewProvider*vp = Application::Instance->getViewProvider(obj);
+    if (!vp || !(useNewSelection.getValue()||vp->useNewSelectionModel()) || !vp->isSelectable())
+        return;
+
+    SoDetail *detail = nullptr;
+    detailPath->truncate(0);
+    auto subName = pSubName;
+    App::ElementNamePair elementName;
+    App::GeoFeature::resolveElement(obj, subName, elementName);
+    if (Data::isMappedElement(subName)
+        && !elementName.oldName.empty()) {      // If we have a shortened element name
+        subName = elementName.oldName.c_str();  // use it.
+    }
+    if(!pSubName || !pSubName[0] ||
+        vp->getDetailPath(subName,detailPath,true,detail))
+    {
+        SoSelectionElementAction::Type type = SoSelectionElementAction::None;
+        if (add) {
+            if (detail)
+                type = SoSelectionElementAction::Append;
+            else
+                type = SoSelectionElementAction::All;
+        }
+        else {
+            if (detail)
+                type = SoSelectionElementAction::Remove;
+            else
+                type = SoSelectionElementAction::None;
+        }
+
+        SoSelectionElementAction selectionAction(type);
+        selectionAction.setColor(this->colorSelection.getValue());
+        selectionAction.setElement(detail);
+        if(detailPath->getLength())
+            selectionAction.apply(detailPath);
+        else
+            selectionAction.apply(vp->getRoot());
+    }
+    detailPath->truncate(0);
+    delete detail;
+}
+
 bool SoFCUnifiedSelection::setSelection(const std::vector<PickedInfo> &infos, bool ctrlDown) {
     if (infos.empty() || !infos[0].vpd)
         return false;
@@ -756,7 +773,10 @@ SoFCUnifiedSelection::handleEvent(SoHandleEventAction * action)
         // set has been selected.
         if (mymode == AUTO || mymode == ON) {
             // check to see if the mouse is over our geometry...
+            auto start = std::chrono::steady_clock::now();
             auto infos = this->getPickedList(action,true);
+            std::chrono::duration<double,std::milli> time = std::chrono::steady_clock::now() - start;
+            preselectTime = time.count();
             if(!infos.empty())
                 setHighlight(infos[0]);
             else {
@@ -776,11 +796,14 @@ SoFCUnifiedSelection::handleEvent(SoHandleEventAction * action)
         const auto e = static_cast<const SoMouseButtonEvent *>(event);
         if (SoMouseButtonEvent::isButtonReleaseEvent(e,SoMouseButtonEvent::BUTTON1)) {
             // check to see if the mouse is over a geometry...
+            auto start = std::chrono::steady_clock::now();
             auto infos = this->getPickedList(action,!Selection().needPickedList());
             bool greedySel = Gui::Selection().getSelectionStyle() == Gui::SelectionSingleton::SelectionStyle::GreedySelection;
             greedySel = greedySel || event->wasCtrlDown();
             if(setSelection(infos, greedySel) || greedySel)
                 action->setHandled();
+            std::chrono::duration<double,std::milli> time = std::chrono::steady_clock::now() - start;
+            pickTime = time.count();
         } // mouse release
     }
 
@@ -1097,6 +1120,7 @@ static void so_bbox_cleanup()
 
 SoFCSelectionRoot::Stack SoFCSelectionRoot::SelStack;
 std::unordered_map<SoAction*,SoFCSelectionRoot::Stack> SoFCSelectionRoot::ActionStacks;
+std::unordered_map<SoNode*,double> *SoFCSelectionRoot::RenderTimes;
 SoFCSelectionRoot::ColorStack SoFCSelectionRoot::SelColorStack;
 SoFCSelectionRoot::ColorStack SoFCSelectionRoot::HlColorStack;
 SoFCSelectionRoot* SoFCSelectionRoot::ShapeColorNode;
@@ -1238,7 +1262,7 @@ std::pair<bool,SoFCSelectionContextBasePtr*> SoFCSelectionRoot::findActionContex
     return res;
 }
 
-bool SoFCSelectionRoot::renderBBox(SoGLRenderAction *action, SoNode *node, SbColor color)
+static SoFCBBoxRenderInfo *getBBoxRenderInfo()
 {
     auto data = static_cast<SoFCBBoxRenderInfo*>(so_bbox_storage->get());
     if (!data->bboxaction) {
@@ -1249,6 +1273,12 @@ bool SoFCSelectionRoot::renderBBox(SoGLRenderAction *action, SoNode *node, SbCol
         data->cube->ref();
         data->packer = new SoColorPacker;
     }
+    return data;
+}
+
+bool SoFCSelectionRoot::renderBBox(SoGLRenderAction *action, SoNode *node, SbColor color)
+{
+    auto data = getBBoxRenderInfo();
 
     SbBox3f bbox;
     data->bboxaction->setViewportRegion(action->getViewportRegion());
@@ -1289,6 +1319,30 @@ bool SoFCSelectionRoot::renderBBox(SoGLRenderAction *action, SoNode *node, SbCol
 
 static std::time_t _CyclicLastReported;
 
+bool SoFCSelectionRoot::cullTest(SoGLRenderAction * action) {
+    // The selection roots don't cache their bounding boxes because the content
+    // depends on the selection context, so Coin can't cull them. Keep a box
+    // here that is computed outside of any context instead. A context can
+    // only hide parts of the content, so the box holds the content of every
+    // path leading to this node. This matters for a node shared by many
+    // links, e.g. the linked object of a link array with thousands of
+    // elements, whose box is computed only once in local coordinates and
+    // then tested for each element under its own transformation.
+    auto state = action->getState();
+    if(!ViewParams::instance()->getCullObjects() || SoCullElement::completelyInside(state))
+        return false;
+
+    if(cullBox.nodeId != getNodeId()) {
+        auto data = getBBoxRenderInfo();
+        data->bboxaction->setViewportRegion(action->getViewportRegion());
+        data->bboxaction->apply(this);
+        cullBox.box = data->bboxaction->getBoundingBox();
+        cullBox.nodeId = getNodeId();
+    }
+
+    return !cullBox.box.isEmpty() && SoCullElement::cullTest(state, cullBox.box, TRUE);
+}
+
 void SoFCSelectionRoot::renderPrivate(SoGLRenderAction * action, bool inPath) {
     if(ViewParams::instance()->getCoinCycleCheck()
             && !SelStack.nodeSet.insert(this).second)
@@ -1301,12 +1355,19 @@ void SoFCSelectionRoot::renderPrivate(SoGLRenderAction * action, bool inPath) {
         return;
     }
     SelStack.push_back(this);
-    if(_renderPrivate(action,inPath)) {
+    std::chrono::steady_clock::time_point start;
+    if(RenderTimes)
+        start = std::chrono::steady_clock::now();
+    if(!cullTest(action) && _renderPrivate(action,inPath)) {
         if(inPath)
             SoSeparator::GLRenderInPath(action);
         else
             SoSeparator::GLRenderBelowPath(action);
     }
+    if(RenderTimes) {
+        std::chrono::duration<double,std::milli> time = std::chrono::steady_clock::now() - start;
+        (*RenderTimes)[this] += time.count();
+    }
     SelStack.pop_back();
     SelStack.nodeSet.erase(this);
 }
@@ -24,9 +24,12 @@
 #define GUI_SOFCUNIFIEDSELECTION_H
 
 #include <list>
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include <Inventor/SbBox3f.h>
 #include <Inventor/elements/SoLazyElement.h>
 #include <Inventor/fields/SoSFBool.h>
 #include <Inventor/fields/SoSFColor.h>
@@ -89,6 +92,15 @@ public:
 
     static bool hasHighlight();
 
+    /// Time in milliseconds taken by the pick of the last preselection
+    double getPreselectTime() const {
+        return preselectTime;
+    }
+    /// Time in milliseconds taken by the pick and selection of the last click
+    double getPickTime() const {
+        return pickTime;
+    }
+
     friend class View3DInventorViewer;
 
 protected:
@@ -113,6 +125,7 @@ private:
     bool setHighlight(SoFullPath *path, const SoDetail *det,
             ViewProviderDocumentObject *vpd, const char *element, float x, float y, float z);
     bool setSelection(const std::vector<PickedInfo> &, bool ctrlDown=false);
+    void applySelection(const char *pDocName, const char *pObjectName, const char *pSubName, bool add);
 
     std::vector<PickedInfo> getPickedList(SoHandleEventAction* action, bool singlePick) const;
 
@@ -122,6 +135,8 @@ private:
     SoFullPath * detailPath;
 
     SbBool setPreSelection;
+    double preselectTime = 0.0;
+    double pickTime = 0.0;
 
     // -1 = not handled, 0 = not selected, 1 = selected
     int32_t preSelection;
@@ -323,11 +338,21 @@ public:
 
     static bool renderBBox(SoGLRenderAction *action, SoNode *node, SbColor color);
 
+    /** Adds the time in milliseconds spent rendering each selection root to
+     * \a times, until called again with nullptr. A root rendered more than
+     * once, e.g. through links, gets the sum.
+     */
+    static void setRenderTimes(std::unordered_map<SoNode*,double> *times) {
+        RenderTimes = times;
+    }
+
 protected:
     ~SoFCSelectionRoot() override;
 
     void renderPrivate(SoGLRenderAction *, bool inPath);
     bool _renderPrivate(SoGLRenderAction *, bool inPath);
+    /// Returns true if the content of this node lies outside of the view volume
+    bool cullTest(SoGLRenderAction *);
 
     class Stack : public std::vector<SoNode*> {
     public:
@@ -344,6 +369,7 @@ protected:
 
     static Stack SelStack;
     static std::unordered_map<SoAction*,Stack> ActionStacks;
+    static std::unordered_map<SoNode*,double> *RenderTimes;
     struct StackComp {
         bool operator()(const Stack &a, const Stack &b) const;
     };
@@ -352,6 +378,12 @@ protected:
     ContextMap contextMap;
     ContextMap contextMap2;//holding secondary context
 
+    struct CullBox {
+        SbBox3f box;
+        SbUniqueId nodeId = 0;
+    };
+    CullBox cullBox;
+
     struct SelContext: SoFCSelectionContextBase {
     public:
         SbColor selColor;
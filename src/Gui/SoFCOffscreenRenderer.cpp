@@ -29,6 +29,7 @@
 # include <Inventor/actions/SoGLRenderAction.h>
 # include <Inventor/elements/SoGLCacheContextElement.h>
 # include <Inventor/fields/SoSFImage.h>
+# include <Inventor/misc/SoContextHandler.h>
 # include <Inventor/nodes/SoNode.h>
 # include <QBuffer>
 # include <QDateTime>
@@ -44,6 +45,7 @@
 #endif
 
 #include <QOffscreenSurface>
+#include <QOpenGLContext>
 
 #include <App/Application.h>
 #include <Base/FileInfo.h>
@@ -415,6 +417,7 @@ void SoQtOffscreenRenderer::init(const SbViewportRegion & vpr,
     this->viewport = vpr; // clazy:exclude=rule-of-two-soft
 
     this->framebuffer = nullptr;
+    this->contextSamples = -1;
     this->numSamples = -1;
     //this->texFormat = GL_RGBA32F_ARB;
     this->texFormat = GL_RGB32F_ARB;
@@ -445,7 +448,7 @@ SoQtOffscreenRenderer::SoQtOffscreenRenderer(SoGLRenderAction * action)
 */
 SoQtOffscreenRenderer::~SoQtOffscreenRenderer()
 {
-    delete framebuffer;
+    destroyContext();
 
     if (this->didallocation) {
         delete this->renderaction;
@@ -574,7 +577,50 @@ SoQtOffscreenRenderer::makeFrameBuffer(int width, int height, int samples)
     fmt.setInternalTextureFormat(this->texFormat);
 
     framebuffer = new QtGLFramebufferObject(width, height, fmt);
-    cache_context = SoGLCacheContextElement::getUniqueCacheContext(); // unique per pixel buffer object, just to be sure
+}
+
+bool
+SoQtOffscreenRenderer::makeContextCurrent()
+{
+    if (context && contextSamples != PRIVATE(this)->numSamples) {
+        destroyContext();
+    }
+
+    if (!context) {
+        QSurfaceFormat format;
+        format.setSamples(PRIVATE(this)->numSamples);
+        auto newContext = std::make_unique<QOpenGLContext>();
+        newContext->setFormat(format);
+        if (!newContext->create()) {
+            return false;
+        }
+        surface = std::make_unique<QOffscreenSurface>();
+        surface->setFormat(format);
+        surface->create();
+        context = std::move(newContext);
+        contextSamples = PRIVATE(this)->numSamples;
+        cache_context = SoGLCacheContextElement::getUniqueCacheContext(); // unique per GL context
+    }
+
+    return context->makeCurrent(surface.get());
+}
+
+void
+SoQtOffscreenRenderer::destroyContext()
+{
+    if (!context) {
+        return;
+    }
+
+    // the framebuffer and the resources Coin created must be freed with the
+    // context being current
+    context->makeCurrent(surface.get());
+    delete framebuffer;
+    framebuffer = nullptr;
+    SoContextHandler::destructingContext(cache_context);
+    context->doneCurrent();
+    context.reset();
+    surface.reset();
 }
 
 SbBool
@@ -582,16 +628,8 @@ SoQtOffscreenRenderer::renderFromBase(SoBase * base)
 {
     const SbVec2s fullsize = this->viewport.getViewportSizePixels();
 
-    QSurfaceFormat format;
-    format.setSamples(PRIVATE(this)->numSamples);
-    QOpenGLContext context;
-    context.setFormat(format);
-    if (!context.create())
+    if (!makeContextCurrent())
         return false;
-    QOffscreenSurface offscreen;
-    offscreen.setFormat(format);
-    offscreen.create();
-    context.makeCurrent(&offscreen);
 
     if (!framebuffer) {
         makeFrameBuffer(fullsize[0], fullsize[1], PRIVATE(this)->numSamples);
@@ -633,7 +671,7 @@ SoQtOffscreenRenderer::renderFromBase(SoBase * base)
     this->renderaction->setCacheContext(oldcontext); // restore old
 
     glImage = framebuffer->toImage();
-    context.doneCurrent();
+    context->doneCurrent();
 
     return true;
 }
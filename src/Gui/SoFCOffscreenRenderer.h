@@ -23,6 +23,7 @@
 #ifndef GUI_SOFCOFFSCREENRENDERER_H
 #define GUI_SOFCOFFSCREENRENDERER_H
 
+#include <memory>
 #include <Inventor/SbColor4f.h>
 #include <Inventor/SbMatrix.h>
 #include <Inventor/SoOffscreenRenderer.h>
@@ -33,6 +34,8 @@
 
 #include <FCGlobal.h>
 
+class QOffscreenSurface;
+class QOpenGLContext;
 
 namespace Gui {
 
@@ -134,8 +137,15 @@ private:
     void init(const SbViewportRegion & vpr, SoGLRenderAction * glrenderaction = nullptr);
     static void pre_render_cb(void * userdata, SoGLRenderAction * action);
     SbBool renderFromBase(SoBase * base);
+    bool makeContextCurrent();
+    void destroyContext();
     void makeFrameBuffer(int width, int height, int samples);
 
+    // The GL context is kept for all renderings, so the GL resources Coin
+    // creates for the scene are reused when rendering many images
+    std::unique_ptr<QOpenGLContext> context;
+    std::unique_ptr<QOffscreenSurface> surface;
+    int contextSamples;
     QtGLFramebufferObject*  framebuffer;
     uint32_t                cache_context; // our unique context id
 
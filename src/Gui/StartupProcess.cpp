@@ -44,6 +44,7 @@
 #include "Language/Translator.h"
 #include <App/Application.h>
 #include <Base/Console.h>
+#include <Base/StartupProfile.h>
 
 
 using namespace Gui;
@@ -111,6 +112,7 @@ void StartupProcess::setupApplication()
 
 void StartupProcess::execute()
 {
+    Base::StartupProfile::Scope step("StartupProcess");
     setLibraryPath();
     setStyleSheetPaths();
     setImagePaths();
@@ -212,6 +214,7 @@ void StartupPostProcess::setLoadFromPythonModule(bool value)
 
 void StartupPostProcess::execute()
 {
+    Base::StartupProfile::Scope step("StartupPostProcess");
     setWindowTitle();
     setProcessMessages();
     setAutoSaving();
@@ -348,6 +351,7 @@ void StartupPostProcess::checkOpenGL()
 
 void StartupPostProcess::loadOpenInventor()
 {
+    Base::StartupProfile::Scope step("Load Open Inventor");
     bool loadedInventor = false;
     if (loadFromPythonModule) {
         loadedInventor = SoDB::isInitialized();
@@ -417,6 +421,7 @@ void StartupPostProcess::showMainWindow()
 
     // running the GUI init script
     try {
+        Base::StartupProfile::Scope step("FreeCADGuiInit.py");
         Base::Console().Log("Run Gui init script\n");
         Application::runInitGuiScript();
         setImportImageFormats();
@@ -436,6 +441,7 @@ void StartupPostProcess::showMainWindow()
 
 void StartupPostProcess::activateWorkbench()
 {
+    Base::StartupProfile::Scope step("Activate start workbench");
     // Activate the correct workbench
     std::string start = App::Application::Config()["StartWorkbench"];
     Base::Console().Log("Init: Activating default workbench %s\n", start.c_str());
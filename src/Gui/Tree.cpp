@@ -978,8 +978,10 @@ Gui::Document* TreeWidget::selectedDocument() {
 }
 
 void TreeWidget::updateStatus(bool delay) {
-    for (auto tree : Instances)
+    for (auto tree : Instances) {
+        tree->fullStatusUpdate = true;
         tree->_updateStatus(delay);
+    }
 }
 
 void TreeWidget::_updateStatus(bool delay) {
@@ -990,10 +992,13 @@ void TreeWidget::_updateStatus(bool delay) {
     }
 
     if (!delay) {
-        if (!ChangedObjects.empty() || !NewObjects.empty())
+        if (!ChangedObjects.empty() || !NewObjects.empty() || !StatusObjects.empty())
             onUpdateStatus();
         return;
     }
+    // a request without any recorded change checks all items
+    if (ChangedObjects.empty() && NewObjects.empty() && StatusObjects.empty())
+        fullStatusUpdate = true;
     int timeout = TreeParams::getStatusTimeout();
     if (timeout < 0)
         timeout = 1;
@@ -3029,6 +3034,10 @@ void TreeWidget::onUpdateStatus()
     // Use a local copy in case of nested calls
     auto localChangedObjects = ChangedObjects;
     ChangedObjects.clear();
+    auto localStatusObjects = StatusObjects;
+    StatusObjects.clear();
+    bool checkAll = fullStatusUpdate;
+    fullStatusUpdate = false;
 
     // Update children of changed objects
     for (auto& v : localChangedObjects) {
@@ -3060,8 +3069,32 @@ void TreeWidget::onUpdateStatus()
 
     FC_LOG("update item status");
     TimingInit();
-    for (auto pos = DocumentMap.begin(); pos != DocumentMap.end(); ++pos) {
-        pos->second->testStatus();
+    if (checkAll) {
+        for (auto pos = DocumentMap.begin(); pos != DocumentMap.end(); ++pos) {
+            pos->second->testStatus();
+        }
+    }
+    else {
+        // Only the items of the changed objects and their direct children, whose
+        // visibility may depend on the parent, are checked. New items are checked
+        // when they are created.
+        for (auto& v : localChangedObjects)
+            localStatusObjects.insert(v.first);
+        for (auto obj : localStatusObjects) {
+            auto iter = ObjectTable.find(obj);
+            if (iter == ObjectTable.end())
+                continue;
+            for (auto& data : iter->second) {
+                data->testStatus();
+                for (auto item : data->items) {
+                    for (int i = 0, count = item->childCount(); i < count; ++i) {
+                        auto child = item->child(i);
+                        if (child->type() == ObjectType)
+                            static_cast<DocumentObjectItem*>(child)->testStatus(false);
+                    }
+                }
+            }
+        }
     }
     TimingPrint();
 
@@ -4162,6 +4195,8 @@ void DocumentItem::populateItem(DocumentObjectItem* item, bool refresh, bool del
             assert(childItem->parent() == item);
             if (checkHidden)
                 updateItemsVisibility(childItem, false);
+            // the visibility of the item may depend on its new parent
+            childItem->testStatus(false);
         }
     }
 
@@ -4323,6 +4358,7 @@ void TreeWidget::slotChangeObject(
     if (itEntry == ObjectTable.end() || itEntry->second.empty())
         return;
 
+    StatusObjects.insert(obj);
     _updateStatus();
 
     // Let's not waste time on the newly added Visibility property in
@@ -25,6 +25,7 @@
 #define GUI_TREE_H
 
 #include <unordered_map>
+#include <unordered_set>
 #include <QElapsedTimer>
 #include <QStyledItemDelegate>
 #include <QTreeWidget>
@@ -264,6 +265,11 @@ private:
 
     std::unordered_map<std::string,std::vector<long> > NewObjects;
 
+    // Objects whose items only need their status checked again
+    std::unordered_set<App::DocumentObject*> StatusObjects;
+    // Set if the status of all items must be checked, e.g. after a recompute
+    bool fullStatusUpdate = false;
+
     static std::set<TreeWidget*> Instances;
 
     std::string myName; // for debugging purpose
@@ -97,8 +97,15 @@ void View3DInventorSelection::checkGroupOnTop(const SelectionChanges &Reason)
 {
     if (Reason.Type == SelectionChanges::SetSelection || Reason.Type == SelectionChanges::ClrSelection) {
         clearGroupOnTop();
-        if(Reason.Type == SelectionChanges::ClrSelection)
+        if(Reason.Type == SelectionChanges::ClrSelection || !getDocument())
             return;
+        // the selection may have changed by any number of elements at once
+        const char *docName = getDocument()->getDocument()->getName();
+        for (const auto &sel : Selection().getSelection(docName, ResolveMode::NoResolve)) {
+            checkGroupOnTop(SelectionChanges(SelectionChanges::AddSelection,
+                                             sel.DocName, sel.FeatName, sel.SubName, sel.TypeName));
+        }
+        return;
     }
     if(Reason.Type == SelectionChanges::RmvPreselect ||
        Reason.Type == SelectionChanges::RmvPreselectSignal)
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <cfloat>
 # ifdef FC_OS_WIN32
 #  include <windows.h>
@@ -42,8 +43,10 @@
 # include <Inventor/SoPickedPoint.h>
 # include <Inventor/actions/SoGetBoundingBoxAction.h>
 # include <Inventor/actions/SoGetMatrixAction.h>
+# include <Inventor/actions/SoGetPrimitiveCountAction.h>
 # include <Inventor/actions/SoHandleEventAction.h>
 # include <Inventor/actions/SoRayPickAction.h>
+# include <Inventor/actions/SoSearchAction.h>
 # include <Inventor/annex/HardCopy/SoVectorizePSAction.h>
 # include <Inventor/details/SoDetail.h>
 # include <Inventor/elements/SoLightModelElement.h>
@@ -92,6 +95,7 @@
 #include <Base/FileInfo.h>
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
+#include <Base/Trace.h>
 #include <Base/UnitsApi.h>
 #include <Base/Tools2D.h>
 #include <Quarter/devices/InputDevice.h>
@@ -1286,6 +1290,123 @@ void View3DInventorViewer::setEnabledFPSCounter(bool on)
     fpsEnabled = on;
 }
 
+void View3DInventorViewer::setEnabledRenderStats(bool on)
+{
+    if (renderStatsEnabled == on) {
+        return;
+    }
+
+    renderStatsEnabled = on;
+    renderTimes.clear();
+    primitiveCounts.clear();
+    redraw();
+}
+
+bool View3DInventorViewer::isEnabledRenderStats() const
+{
+    return renderStatsEnabled;
+}
+
+double View3DInventorViewer::getDrawTime() const
+{
+    return framesPerSecond[0];
+}
+
+double View3DInventorViewer::getFramesPerSecond() const
+{
+    return framesPerSecond[1];
+}
+
+double View3DInventorViewer::getPreselectTime() const
+{
+    return selectionRoot->getPreselectTime();
+}
+
+double View3DInventorViewer::getPickTime() const
+{
+    return selectionRoot->getPickTime();
+}
+
+const View3DInventorViewer::PrimitiveCount& View3DInventorViewer::getPrimitiveCount(ViewProvider* vp) const
+{
+    SoSeparator* root = vp->getRoot();
+    PrimitiveCount& count = primitiveCounts[root];
+    if (count.nodeId == root->getNodeId()) {
+        return count;
+    }
+
+    // Counting traverses the whole sub graph, so only do it again after a change
+    SoGetPrimitiveCountAction action(getSoRenderManager()->getViewportRegion());
+    action.setCanApproximate(true);
+    action.apply(root);
+    count.triangles = action.getTriangleCount();
+    count.lines = action.getLineCount();
+    count.points = action.getPointCount();
+
+    SoSearchAction search;
+    search.setType(SoShape::getClassTypeId());
+    search.setInterest(SoSearchAction::ALL);
+    search.apply(root);
+    count.shapes = search.getPaths().getLength();
+    count.nodeId = root->getNodeId();
+    return count;
+}
+
+std::vector<View3DInventorViewer::ObjectRenderStats> View3DInventorViewer::getRenderStats() const
+{
+    std::vector<ObjectRenderStats> stats;
+    for (auto vp : _ViewProviderSet) {
+        auto it = renderTimes.find(vp->getRoot());
+        if (it == renderTimes.end()) {
+            continue;
+        }
+        const PrimitiveCount& count = getPrimitiveCount(vp);
+        stats.push_back({vp, it->second, count.triangles, count.lines, count.points, count.shapes});
+    }
+
+    std::sort(stats.begin(), stats.end(), [](const ObjectRenderStats& a, const ObjectRenderStats& b) {
+        return a.renderTime > b.renderTime;
+    });
+    return stats;
+}
+
+void View3DInventorViewer::drawRenderStats() const
+{
+    const int maxObjects = 5;
+    const int lineHeight = 15;
+    SbVec2s size = getSoRenderManager()->getViewportRegion().getViewportSizePixels();
+
+    std::vector<std::string> lines;
+    lines.push_back(fmt::format("pick {:.1f} ms / preselect {:.1f} ms",
+                                getPickTime(), getPreselectTime()));
+
+    int triangles = 0;
+    int shapes = 0;
+    std::vector<ObjectRenderStats> stats = getRenderStats();
+    for (const auto& it : stats) {
+        triangles += it.triangles;
+        shapes += it.shapes;
+    }
+    lines.push_back(fmt::format("{} objects / {} triangles / {} shapes",
+                                stats.size(), triangles, shapes));
+
+    for (int i = 0; i < std::min<int>(maxObjects, stats.size()); i++) {
+        const auto& it = stats[i];
+        auto obj = it.viewProvider->isDerivedFrom<ViewProviderDocumentObject>()
+            ? static_cast<ViewProviderDocumentObject*>(it.viewProvider)->getObject() : nullptr;
+        lines.push_back(fmt::format("{:.1f} ms  {} triangles  {} shapes  {}",
+                                    it.renderTime, it.triangles, it.shapes,
+                                    obj && obj->isAttachedToDocument() ? obj->Label.getValue() : "?"));
+    }
+
+    // Stacked above the fps counter
+    short y = 10 + lineHeight * short(lines.size());
+    for (const auto& line : lines) {
+        draw2DString(line.c_str(), size, SbVec2f(10.0F, y));
+        y -= lineHeight;
+    }
+}
+
 void View3DInventorViewer::setEnabledVBO(bool on)
 {
     vboEnabled = on;
@@ -2259,6 +2380,7 @@ void View3DInventorViewer::renderToFramebuffer(QtGLFramebufferObject* fbo)
 
 void View3DInventorViewer::actualRedraw()
 {
+    FC_TRACE_ZONE("View3DInventorViewer::actualRedraw");
     switch (renderType) {
     case Native:
         renderScene();
@@ -2392,6 +2514,11 @@ void View3DInventorViewer::renderScene()
         SoOverrideElement::setLightModelOverride(state, selectionRoot, true);
     }
 
+    if (renderStatsEnabled) {
+        renderTimes.clear();
+        SoFCSelectionRoot::setRenderTimes(&renderTimes);
+    }
+
     try {
         // Render normal scenegraph.
         inherited::actualRedraw();
@@ -2412,6 +2539,8 @@ void View3DInventorViewer::renderScene()
                              QObject::tr("Not enough memory available to display the data."));
     }
 
+    SoFCSelectionRoot::setRenderTimes(nullptr);
+
     if (!this->shading) {
         state->pop();
     }
@@ -2453,6 +2582,10 @@ void View3DInventorViewer::renderScene()
         draw2DString(stream.str().c_str(), SbVec2s(10, 10), SbVec2f(0.1F, 0.1F));  // NOLINT
     }
 
+    if (renderStatsEnabled) {
+        drawRenderStats();
+    }
+
     if (naviCubeEnabled) {
         naviCube->drawNaviCube();
     }
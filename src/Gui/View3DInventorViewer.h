@@ -28,6 +28,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <QCursor>
@@ -426,6 +427,32 @@ public:
     void changeRotationCenterPosition(const SbVec3f& newCenter);
 
     void setEnabledFPSCounter(bool on);
+
+    /// The render statistics of the root node of a view provider
+    struct ObjectRenderStats {
+        ViewProvider* viewProvider;
+        /// CPU time in milliseconds of the last frame, including the claimed children
+        double renderTime;
+        int triangles;
+        int lines;
+        int points;
+        /// Number of shape nodes, each one is at least one draw call
+        int shapes;
+    };
+    /** Enables measuring the render time of each view provider and the pick
+     * times, and shows them in an overlay.
+     */
+    void setEnabledRenderStats(bool on);
+    bool isEnabledRenderStats() const;
+    /// Returns the statistics of the last frame, the slowest view providers first
+    std::vector<ObjectRenderStats> getRenderStats() const;
+    /// Time in milliseconds to draw a frame, averaged over the last frames
+    double getDrawTime() const;
+    double getFramesPerSecond() const;
+    /// Time in milliseconds of the pick of the last preselection
+    double getPreselectTime() const;
+    /// Time in milliseconds of the pick and selection of the last click
+    double getPickTime() const;
     void setEnabledNaviCube(bool on);
     bool isEnabledNaviCube() const;
     void setNaviCubeCorner(int);
@@ -490,6 +517,16 @@ private:
 private:
     NaviCube* naviCube;
     std::set<ViewProvider*> _ViewProviderSet;
+
+    struct PrimitiveCount {
+        uint32_t nodeId = 0;
+        int triangles = 0;
+        int lines = 0;
+        int points = 0;
+        int shapes = 0;
+    };
+    const PrimitiveCount& getPrimitiveCount(ViewProvider* vp) const;
+    void drawRenderStats() const;
     std::map<SoSeparator*,ViewProvider*> _ViewProviderMap;
     std::list<GLGraphicsItem*> graphicsItems;
     ViewProvider* editViewProvider;
@@ -531,6 +568,9 @@ private:
 
     //stuff needed to draw the fps counter
     bool fpsEnabled;
+    bool renderStatsEnabled = false;
+    std::unordered_map<SoNode*,double> renderTimes;
+    mutable std::unordered_map<SoNode*,PrimitiveCount> primitiveCounts;
     bool vboEnabled;
     bool naviCubeEnabled;
 
@@ -200,6 +200,13 @@ void View3DInventorPy::init_type()
     add_varargs_method("setNavigationType",&View3DInventorPy::setNavigationType,"setNavigationType()");
     add_varargs_method("setAxisCross",&View3DInventorPy::setAxisCross,"switch the big axis-cross on and off");
     add_noargs_method("hasAxisCross",&View3DInventorPy::hasAxisCross,"check if the big axis-cross is on or off()");
+    add_varargs_method("setRenderStats",&View3DInventorPy::setRenderStats,
+        "setRenderStats(bool) -> None\n"
+        "Switch measuring the render time of each object and the overlay showing it on and off");
+    add_noargs_method("getRenderStats",&View3DInventorPy::getRenderStats,
+        "getRenderStats() -> dict\n"
+        "Return the frame and pick times in milliseconds and, if enabled with setRenderStats(),\n"
+        "the render time and primitive counts of each object, the slowest first");
     add_varargs_method("addDraggerCallback",&View3DInventorPy::addDraggerCallback,
         "addDraggerCallback(SoDragger, String CallbackType, function)\n"
         "Add a DraggerCalback function to the coin node\n"
@@ -2324,6 +2331,42 @@ Py::Object View3DInventorPy::hasAxisCross()
     return Py::Boolean(ok ? true : false);
 }
 
+Py::Object View3DInventorPy::setRenderStats(const Py::Tuple& args)
+{
+    PyObject* on;
+    if (!PyArg_ParseTuple(args.ptr(), "O!", &PyBool_Type, &on))
+        throw Py::Exception();
+    getView3DInventorPtr()->getViewer()->setEnabledRenderStats(Base::asBoolean(on));
+    return Py::None();
+}
+
+Py::Object View3DInventorPy::getRenderStats()
+{
+    View3DInventorViewer* viewer = getView3DInventorPtr()->getViewer();
+    Py::Dict dict;
+    dict.setItem("drawTime", Py::Float(viewer->getDrawTime()));
+    dict.setItem("fps", Py::Float(viewer->getFramesPerSecond()));
+    dict.setItem("preselectTime", Py::Float(viewer->getPreselectTime()));
+    dict.setItem("pickTime", Py::Float(viewer->getPickTime()));
+
+    Py::List list;
+    for (const auto& it : viewer->getRenderStats()) {
+        auto vp = dynamic_cast<ViewProviderDocumentObject*>(it.viewProvider);
+        if (!vp || !vp->getObject() || !vp->getObject()->isAttachedToDocument())
+            continue;
+        Py::Dict item;
+        item.setItem("object", Py::asObject(vp->getObject()->getPyObject()));
+        item.setItem("time", Py::Float(it.renderTime));
+        item.setItem("triangles", Py::Long(it.triangles));
+        item.setItem("lines", Py::Long(it.lines));
+        item.setItem("points", Py::Long(it.points));
+        item.setItem("shapes", Py::Long(it.shapes));
+        list.append(item);
+    }
+    dict.setItem("objects", list);
+    return dict;
+}
+
 void View3DInventorPy::draggerCallback(void * ud, SoDragger* n)
 {
     Base::PyGILStateLocker lock;
@@ -112,6 +112,8 @@ public:
     Py::Object setNavigationType(const Py::Tuple&);
     Py::Object setAxisCross(const Py::Tuple&);
     Py::Object hasAxisCross();
+    Py::Object setRenderStats(const Py::Tuple&);
+    Py::Object getRenderStats();
     Py::Object addDraggerCallback(const Py::Tuple&);
     Py::Object removeDraggerCallback(const Py::Tuple&);
     Py::Object getViewProvidersOfType(const Py::Tuple&);
@@ -85,6 +85,7 @@ void View3DSettings::applySettings()
     OnChange(*hGrp,"BackgroundColor4");
     OnChange(*hGrp,"UseBackgroundColorMid");
     OnChange(*hGrp,"ShowFPS");
+    OnChange(*hGrp,"ShowRenderStats");
     OnChange(*hGrp,"ShowNaviCube");
     OnChange(*hGrp,"AxisXColor");
     OnChange(*hGrp,"AxisYColor");
@@ -339,6 +340,11 @@ void View3DSettings::OnChange(ParameterGrp::SubjectType &rCaller,ParameterGrp::M
             _viewer->setEnabledFPSCounter(rGrp.GetBool("ShowFPS", false));
         }
     }
+    else if (strcmp(Reason,"ShowRenderStats") == 0) {
+        for (auto _viewer : _viewers) {
+            _viewer->setEnabledRenderStats(rGrp.GetBool("ShowRenderStats", false));
+        }
+    }
     else if (strcmp(Reason,"ShowNaviCube") == 0) {
         for (auto _viewer : _viewers) {
             _viewer->setEnabledNaviCube(rGrp.GetBool("ShowNaviCube", true));
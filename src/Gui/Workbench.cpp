@@ -723,6 +723,7 @@ MenuItem* StdWorkbench::setupMenuBar() const
           << "Separator"
           << "Std_DemoMode"
           << "Std_UnitsCalculator"
+          << "Std_Trace"
           << "Separator"
           << "Std_DlgCustomize";
 #ifdef BUILD_ADDONMGR
@@ -25,6 +25,7 @@
 #ifndef _PreComp_
 #include <boost/core/ignore_unused.hpp>
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <unordered_map>
 #endif
@@ -40,6 +41,7 @@
 #include <App/Link.h>
 #include <App/PropertyPythonObject.h>
 #include <Base/Console.h>
+#include <Base/FileInfo.h>
 #include <Base/Placement.h>
 #include <Base/Rotation.h>
 #include <Base/Tools.h>
@@ -89,6 +91,7 @@
 #include "JointGroup.h"
 #include "ViewGroup.h"
 #include "SimulationGroup.h"
+#include "SimulationFrames.h"
 
 FC_LOG_LEVEL_INIT("Assembly", true, true, true)
 
@@ -140,6 +143,8 @@ int AssemblyObject::solve(bool enableRedo, bool updateJCS)
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
     motions.clear();
+    simulationFrames.reset();
+    simulationParts.clear();
 
     auto groundedObjs = fixGroundedParts();
     if (groundedObjs.empty()) {
@@ -181,6 +186,8 @@ int AssemblyObject::generateSimulation(App::DocumentObject* sim)
 {
     mbdAssembly = makeMbdAssembly();
     objectPartMap.clear();
+    simulationFrames.reset();
+    simulationParts.clear();
 
     motions = getMotionsFromSimulation(sim);
 
@@ -210,9 +217,60 @@ int AssemblyObject::generateSimulation(App::DocumentObject* sim)
 
     motions.clear();
 
+    if (!storeSimulationFrames()) {
+        Base::Console().Warning("The simulation frames could not be written to disk, they are "
+                                "kept in memory\n");
+    }
+
     return 0;
 }
 
+bool AssemblyObject::storeSimulationFrames()
+{
+    std::vector<App::DocumentObject*> parts;
+    std::vector<MbDPartData> partData;
+    for (auto& pair : objectPartMap) {
+        if (!pair.first || !pair.second.part
+            || !dynamic_cast<App::PropertyPlacement*>(
+                pair.first->getPropertyByName("Placement"))) {
+            continue;
+        }
+        parts.push_back(pair.first);
+        partData.push_back(pair.second);
+    }
+
+    std::string fileName =
+        Base::FileInfo::getTempFileName("Simulation", getDocument()->TransientDir.getValue());
+    auto frames = std::make_unique<SimulationFrames>(fileName, parts.size());
+    if (!frames->isValid()) {
+        return false;
+    }
+
+    std::vector<Base::Placement> placements(parts.size());
+    size_t nfrms = mbdAssembly->numberOfFrames();
+    for (size_t index = 0; index < nfrms; ++index) {
+        mbdAssembly->updateForFrame(index);
+        for (size_t i = 0; i < partData.size(); ++i) {
+            placements[i] = getMbdPlacement(partData[i].part);
+            if (!partData[i].offsetPlc.isIdentity()) {
+                placements[i] = placements[i] * partData[i].offsetPlc;
+            }
+        }
+        if (!frames->addFrame(placements)) {
+            return false;
+        }
+    }
+
+    simulationFrames = std::move(frames);
+    simulationParts = std::move(parts);
+
+    // The solver keeps the results of every step, they are not needed any more
+    objectPartMap.clear();
+    mbdAssembly = std::make_shared<ASMTAssembly>();
+    mbdAssembly->externalSystem->freecadAssemblyObject = this;
+    return true;
+}
+
 std::vector<App::DocumentObject*> AssemblyObject::getMotionsFromSimulation(App::DocumentObject* sim)
 {
     if (!sim) {
@@ -229,6 +287,25 @@ std::vector<App::DocumentObject*> AssemblyObject::getMotionsFromSimulation(App::
 
 int Assembly::AssemblyObject::updateForFrame(size_t index, bool updateJCS)
 {
+    if (simulationFrames) {
+        std::vector<Base::Placement> placements;
+        if (!simulationFrames->getFrame(index, placements)) {
+            return -1;
+        }
+
+        for (size_t i = 0; i < simulationParts.size(); ++i) {
+            auto* propPlacement = dynamic_cast<App::PropertyPlacement*>(
+                simulationParts[i]->getPropertyByName("Placement"));
+            if (propPlacement && !propPlacement->getValue().isSame(placements[i])) {
+                propPlacement->setValue(placements[i]);
+                simulationParts[i]->purgeTouched();
+            }
+        }
+        auto jointDocs = getJoints(updateJCS);
+        redrawJointPlacements(jointDocs);
+        return 0;
+    }
+
     if (!mbdAssembly) {
         return -1;
     }
@@ -247,6 +324,9 @@ int Assembly::AssemblyObject::updateForFrame(size_t index, bool updateJCS)
 
 size_t Assembly::AssemblyObject::numberOfFrames()
 {
+    if (simulationFrames) {
+        return simulationFrames->numberOfFrames();
+    }
     return mbdAssembly->numberOfFrames();
 }
 
@@ -282,6 +362,13 @@ void AssemblyObject::preDrag(std::vector<App::DocumentObject*> dragParts)
         draggedParts.push_back(part);
     }
 
+    dragJoints.clear();
+    for (auto* joint : getJoints(false)) {
+        JointParts parts = getJointParts(joint);
+        dragJoints.push_back({joint, parts.part1, parts.part2});
+    }
+    dragGroundedParts = getGroundedParts();
+
     mbdAssembly->runPreDrag();
 }
 
@@ -320,14 +407,17 @@ void AssemblyObject::doDragStep()
         mbdAssembly->runDragStep(dragPartsVec);
 
         // Timing the validation and placement setting
-        if (validateNewPlacements()) {
-            setNewPlacements();
-
-            auto joints = getJoints(false);
-            for (auto* joint : joints) {
-                if (joint->Visibility.getValue()) {
+        if (validateNewPlacements(dragGroundedParts)) {
+            // The dragged parts were moved by the caller already
+            std::unordered_set<App::DocumentObject*> movedObjs(draggedParts.begin(),
+                                                               draggedParts.end());
+            setNewPlacements(&movedObjs);
+
+            for (auto& dragJoint : dragJoints) {
+                if (dragJoint.joint->Visibility.getValue()
+                    && (movedObjs.count(dragJoint.part1) || movedObjs.count(dragJoint.part2))) {
                     // redraw only the moving joint as its quite slow as its python code.
-                    redrawJointPlacement(joint);
+                    redrawJointPlacement(dragJoint.joint);
                 }
             }
         }
@@ -355,9 +445,14 @@ Base::Placement AssemblyObject::getMbdPlacement(std::shared_ptr<ASMTPart> mbdPar
 }
 
 bool AssemblyObject::validateNewPlacements()
+{
+    return validateNewPlacements(getGroundedParts());
+}
+
+bool AssemblyObject::validateNewPlacements(
+    const std::unordered_set<App::DocumentObject*>& groundedParts)
 {
     // First we check if a grounded object has moved. It can happen that they flip.
-    auto groundedParts = getGroundedParts();
     for (auto* obj : groundedParts) {
         auto* propPlacement =
             dynamic_cast<App::PropertyPlacement*>(obj->getPropertyByName("Placement"));
@@ -391,6 +486,9 @@ bool AssemblyObject::validateNewPlacements()
 void AssemblyObject::postDrag()
 {
     mbdAssembly->runPostDrag();  // Do this after last drag
+
+    dragJoints.clear();
+    dragGroundedParts.clear();
 }
 
 void AssemblyObject::savePlacementsForUndo()
@@ -462,7 +560,7 @@ void AssemblyObject::exportAsASMT(std::string fileName)
     mbdAssembly->outputFile(fileName);
 }
 
-void AssemblyObject::setNewPlacements()
+void AssemblyObject::setNewPlacements(std::unordered_set<App::DocumentObject*>* movedObjs)
 {
     for (auto& pair : objectPartMap) {
         App::DocumentObject* obj = pair.first;
@@ -487,6 +585,9 @@ void AssemblyObject::setNewPlacements()
         if (!propPlacement->getValue().isSame(newPlacement)) {
             propPlacement->setValue(newPlacement);
             obj->purgeTouched();
+            if (movedObjs) {
+                movedObjs->insert(obj);
+            }
         }
     }
 }
@@ -578,8 +679,7 @@ App::DocumentObject* AssemblyObject::getJointOfPartConnectingToGround(App::Docum
         if (!joint) {
             continue;
         }
-        App::DocumentObject* part1 = getMovingPartFromRef(this, joint, "Reference1");
-        App::DocumentObject* part2 = getMovingPartFromRef(this, joint, "Reference2");
+        auto [part1, part2] = getJointParts(joint);
         if (!part1 || !part2) {
             continue;
         }
@@ -657,8 +757,7 @@ AssemblyObject::getJoints(bool updateJCS, bool delBadJoints, bool subJoints)
             continue;
         }
 
-        auto* part1 = getMovingPartFromRef(this, joint, "Reference1");
-        auto* part2 = getMovingPartFromRef(this, joint, "Reference2");
+        auto [part1, part2] = getJointParts(joint);
         if (!part1 || !part2 || part1->getFullName() == part2->getFullName()) {
             // Remove incomplete joints. Left-over when the user deletes a part.
             // Remove incoherent joints (self-pointing joints)
@@ -747,8 +846,7 @@ std::vector<App::DocumentObject*> AssemblyObject::getJointsOfPart(App::DocumentO
     std::vector<App::DocumentObject*> jointsOf;
 
     for (auto joint : joints) {
-        App::DocumentObject* part1 = getMovingPartFromRef(this, joint, "Reference1");
-        App::DocumentObject* part2 = getMovingPartFromRef(this, joint, "Reference2");
+        auto [part1, part2] = getJointParts(joint);
         if (part == part1 || part == part2) {
             jointsOf.push_back(joint);
         }
@@ -928,15 +1026,17 @@ void AssemblyObject::removeUnconnectedJoints(std::vector<App::DocumentObject*>&
                                              std::unordered_set<App::DocumentObject*> groundedObjs)
 {
     std::vector<ObjRef> connectedParts;
+    PartGraph graph = makePartGraph(joints);
 
     // Initialize connectedParts with groundedObjs
     for (auto* groundedObj : groundedObjs) {
         connectedParts.push_back({groundedObj, nullptr});
     }
+    std::unordered_set<App::DocumentObject*> visited = groundedObjs;
 
     // Perform a traversal from each grounded object
     for (auto* groundedObj : groundedObjs) {
-        traverseAndMarkConnectedParts(groundedObj, connectedParts, joints);
+        traverseAndMarkConnectedParts(groundedObj, connectedParts, visited, graph);
     }
 
     // Filter out unconnected joints
@@ -945,10 +1045,8 @@ void AssemblyObject::removeUnconnectedJoints(std::vector<App::DocumentObject*>&
             joints.begin(),
             joints.end(),
             [&](App::DocumentObject* joint) {
-                App::DocumentObject* obj1 = getMovingPartFromRef(this, joint, "Reference1");
-                App::DocumentObject* obj2 = getMovingPartFromRef(this, joint, "Reference2");
-                if (!isObjInSetOfObjRefs(obj1, connectedParts)
-                    || !isObjInSetOfObjRefs(obj2, connectedParts)) {
+                auto [obj1, obj2] = getJointParts(joint);
+                if (visited.count(obj1) == 0 || visited.count(obj2) == 0) {
                     Base::Console().Warning(
                         "%s is unconnected to a grounded part so it is ignored.\n",
                         joint->getFullName());
@@ -963,15 +1061,117 @@ void AssemblyObject::traverseAndMarkConnectedParts(App::DocumentObject* currentO
                                                    std::vector<ObjRef>& connectedParts,
                                                    const std::vector<App::DocumentObject*>& joints)
 {
-    // getConnectedParts returns the objs connected to the currentObj by any joint
-    auto connectedObjs = getConnectedParts(currentObj, joints);
-    for (auto& nextObjRef : connectedObjs) {
-        if (!isObjInSetOfObjRefs(nextObjRef.obj, connectedParts)) {
-            // Create a new ObjRef with the nextObj and a nullptr for PropertyXLinkSub*
+    std::unordered_set<App::DocumentObject*> visited;
+    for (auto& objRef : connectedParts) {
+        visited.insert(objRef.obj);
+    }
+    traverseAndMarkConnectedParts(currentObj, connectedParts, visited, makePartGraph(joints));
+}
+
+void AssemblyObject::traverseAndMarkConnectedParts(App::DocumentObject* currentObj,
+                                                   std::vector<ObjRef>& connectedParts,
+                                                   std::unordered_set<App::DocumentObject*>& visited,
+                                                   const PartGraph& graph)
+{
+    auto it = graph.find(currentObj);
+    if (it == graph.end()) {
+        return;
+    }
+    for (auto& nextObjRef : it->second) {
+        if (visited.insert(nextObjRef.obj).second) {
             connectedParts.push_back(nextObjRef);
-            traverseAndMarkConnectedParts(nextObjRef.obj, connectedParts, joints);
+            traverseAndMarkConnectedParts(nextObjRef.obj, connectedParts, visited, graph);
+        }
+    }
+}
+
+AssemblyObject::PartGraph
+AssemblyObject::makePartGraph(const std::vector<App::DocumentObject*>& joints)
+{
+    // The order of the joints is kept, so the traversal finds the parts in the same order
+    // as going through the joints for each part.
+    PartGraph graph;
+    for (auto joint : joints) {
+        if (!isJointTypeConnecting(joint)) {
+            continue;
         }
+
+        auto [obj1, obj2] = getJointParts(joint);
+        if (obj1) {
+            auto* ref =
+                dynamic_cast<App::PropertyXLinkSub*>(joint->getPropertyByName("Reference2"));
+            if (ref) {
+                graph[obj1].push_back({obj2, ref});
+            }
+        }
+        if (obj2 && obj2 != obj1) {
+            auto* ref =
+                dynamic_cast<App::PropertyXLinkSub*>(joint->getPropertyByName("Reference1"));
+            if (ref) {
+                graph[obj2].push_back({obj1, ref});
+            }
+        }
+    }
+    return graph;
+}
+
+std::unordered_set<App::DocumentObject*>
+AssemblyObject::getPartsConnectedToGround(const std::vector<App::DocumentObject*>& joints)
+{
+    std::unordered_set<App::DocumentObject*> groundedObjs = getGroundedParts();
+    std::unordered_set<App::DocumentObject*> visited = groundedObjs;
+    std::vector<ObjRef> connectedParts;
+    PartGraph graph = makePartGraph(joints);
+    for (auto* groundedObj : groundedObjs) {
+        traverseAndMarkConnectedParts(groundedObj, connectedParts, visited, graph);
     }
+    return visited;
+}
+
+AssemblyObject::JointParts AssemblyObject::getJointParts(App::DocumentObject* joint)
+{
+    auto it = jointPartsCache.find(joint);
+    if (it != jointPartsCache.end()) {
+        return it->second;
+    }
+
+    JointParts parts {getMovingPartFromRef(this, joint, "Reference1"),
+                      getMovingPartFromRef(this, joint, "Reference2")};
+
+    // The change notifications of a recompute worker are deferred, so the cache could not
+    // be invalidated in time.
+    App::Document* doc = getDocument();
+    if (!doc || App::Document::isRecomputeWorker()) {
+        return parts;
+    }
+
+    if (!connectChangedObject.connected()) {
+        // The moving part depends on the references of the joint and on the groups,
+        // links and rigid sub-assemblies they go through.
+        connectChangedObject = doc->signalChangedObject.connect(
+            [this](const App::DocumentObject&, const App::Property& prop) {
+                const char* name = prop.getName();
+                if (!name) {
+                    return;
+                }
+                for (const char* propName :
+                     {"Reference1", "Reference2", "Group", "LinkedObject", "ElementList", "Rigid"}) {
+                    if (std::strcmp(name, propName) == 0) {
+                        jointPartsCache.clear();
+                        return;
+                    }
+                }
+            });
+        connectNewObject = doc->signalNewObject.connect([this](const App::DocumentObject&) {
+            jointPartsCache.clear();
+        });
+        connectDeletedObject = doc->signalDeletedObject.connect([this](const App::DocumentObject&) {
+            jointPartsCache.clear();
+        });
+    }
+
+    jointPartsCache[joint] = parts;
+    return parts;
 }
 
 std::vector<ObjRef>
@@ -989,8 +1189,7 @@ AssemblyObject::getConnectedParts(App::DocumentObject* part,
             continue;
         }
 
-        App::DocumentObject* obj1 = getMovingPartFromRef(this, joint, "Reference1");
-        App::DocumentObject* obj2 = getMovingPartFromRef(this, joint, "Reference2");
+        auto [obj1, obj2] = getJointParts(joint);
         if (obj1 == part) {
             auto* ref =
                 dynamic_cast<App::PropertyXLinkSub*>(joint->getPropertyByName("Reference2"));
@@ -1034,28 +1233,7 @@ bool AssemblyObject::isPartConnected(App::DocumentObject* obj)
         return false;
     }
 
-    auto groundedObjs = getGroundedParts();
-    std::vector<App::DocumentObject*> joints = getJoints(false);
-
-    std::vector<ObjRef> connectedParts;
-
-    // Initialize connectedParts with groundedObjs
-    for (auto* groundedObj : groundedObjs) {
-        connectedParts.push_back({groundedObj, nullptr});
-    }
-
-    // Perform a traversal from each grounded object
-    for (auto* groundedObj : groundedObjs) {
-        traverseAndMarkConnectedParts(groundedObj, connectedParts, joints);
-    }
-
-    for (auto& objRef : connectedParts) {
-        if (obj == objRef.obj) {
-            return true;
-        }
-    }
-
-    return false;
+    return getPartsConnectedToGround(getJoints(false)).count(obj) > 0;
 }
 
 void AssemblyObject::jointParts(std::vector<App::DocumentObject*> joints)
@@ -1783,8 +1961,7 @@ AssemblyObject::MbDPartData AssemblyObject::getMbDData(App::DocumentObject* part
             for (auto* joint : joints) {
                 JointType jointType = getJointType(joint);
                 if (jointType == JointType::Fixed) {
-                    App::DocumentObject* part1 = getMovingPartFromRef(this, joint, "Reference1");
-                    App::DocumentObject* part2 = getMovingPartFromRef(this, joint, "Reference2");
+                    auto [part1, part2] = getJointParts(joint);
                     App::DocumentObject* partToAdd = currentPart == part1 ? part2 : part1;
 
                     if (objectPartMap.find(partToAdd) != objectPartMap.end()) {
@@ -1884,9 +2061,10 @@ std::vector<ObjRef> AssemblyObject::getDownstreamParts(App::DocumentObject* part
     std::vector<ObjRef> connectedParts = {{part, nullptr}};
     traverseAndMarkConnectedParts(part, connectedParts, joints);
 
+    std::unordered_set<App::DocumentObject*> connectedToGround = getPartsConnectedToGround(joints);
     std::vector<ObjRef> downstreamParts;
     for (auto& parti : connectedParts) {
-        if (!isPartConnected(parti.obj) && (parti.obj != part)) {
+        if (connectedToGround.count(parti.obj) == 0 && (parti.obj != part)) {
             downstreamParts.push_back(parti);
         }
     }
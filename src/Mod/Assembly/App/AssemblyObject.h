@@ -61,6 +61,7 @@ namespace Assembly
 
 class AssemblyLink;
 class JointGroup;
+class SimulationFrames;
 class ViewGroup;
 enum class JointType;
 
@@ -94,6 +95,8 @@ public:
     being in an active transaction (joint creation).*/
     int solve(bool enableRedo = false, bool updateJCS = true);
     int generateSimulation(App::DocumentObject* sim);
+    // Moves the parts to the placements of the frame, read from the stored frames if the
+    // simulation results could be written to disk.
     int updateForFrame(size_t index, bool updateJCS = true);
     size_t numberOfFrames();
     void preDrag(std::vector<App::DocumentObject*> dragParts);
@@ -107,7 +110,9 @@ public:
 
     Base::Placement getMbdPlacement(std::shared_ptr<MbD::ASMTPart> mbdPart);
     bool validateNewPlacements();
-    void setNewPlacements();
+    bool validateNewPlacements(const std::unordered_set<App::DocumentObject*>& groundedParts);
+    // Adds the objects whose placement changed to movedObjs if given
+    void setNewPlacements(std::unordered_set<App::DocumentObject*>* movedObjs = nullptr);
     static void recomputeJointPlacements(std::vector<App::DocumentObject*> joints);
     static void redrawJointPlacements(std::vector<App::DocumentObject*> joints);
     static void redrawJointPlacement(App::DocumentObject* joint);
@@ -190,6 +195,26 @@ public:
     std::vector<App::DocumentObject*> getMotionsFromSimulation(App::DocumentObject* sim);
 
 private:
+    bool storeSimulationFrames();
+
+    // The moving parts of the references of a joint
+    struct JointParts
+    {
+        App::DocumentObject* part1;
+        App::DocumentObject* part2;
+    };
+    JointParts getJointParts(App::DocumentObject* joint);
+
+    // Maps each part to the parts it is connected to by the connecting joints of a list
+    using PartGraph = std::unordered_map<App::DocumentObject*, std::vector<ObjRef>>;
+    PartGraph makePartGraph(const std::vector<App::DocumentObject*>& joints);
+    void traverseAndMarkConnectedParts(App::DocumentObject* currentPart,
+                                       std::vector<ObjRef>& connectedParts,
+                                       std::unordered_set<App::DocumentObject*>& visited,
+                                       const PartGraph& graph);
+    std::unordered_set<App::DocumentObject*>
+    getPartsConnectedToGround(const std::vector<App::DocumentObject*>& joints);
+
     std::shared_ptr<MbD::ASMTAssembly> mbdAssembly;
 
     std::unordered_map<App::DocumentObject*, MbDPartData> objectPartMap;
@@ -197,6 +222,29 @@ private:
     std::vector<App::DocumentObject*> draggedParts;
     std::vector<App::DocumentObject*> motions;
 
+    // The frames of the last simulation and the parts they hold the placements of
+    std::unique_ptr<SimulationFrames> simulationFrames;
+    std::vector<App::DocumentObject*> simulationParts;
+
+    // The joints with their moving parts and the grounded parts, collected
+    // by preDrag() so the drag steps don't have to resolve the references
+    struct DragJoint
+    {
+        App::DocumentObject* joint;
+        App::DocumentObject* part1;
+        App::DocumentObject* part2;
+    };
+    std::vector<DragJoint> dragJoints;
+    std::unordered_set<App::DocumentObject*> dragGroundedParts;
+
+    // Resolving the moving part of a reference is costly and the connectivity queries
+    // need it for every joint, so it is cached until a reference or the structure of
+    // the document changes.
+    std::unordered_map<App::DocumentObject*, JointParts> jointPartsCache;
+    boost::signals2::scoped_connection connectChangedObject;
+    boost::signals2::scoped_connection connectNewObject;
+    boost::signals2::scoped_connection connectDeletedObject;
+
     std::vector<std::pair<App::DocumentObject*, Base::Placement>> previousPositions;
 
     bool bundleFixed;
@@ -23,6 +23,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #endif
@@ -106,6 +107,7 @@ void BomObject::saveCustomColumnData()
 {
     // This function saves data that is not automatically generated.
     dataElements.clear();
+    dataElementIndex.clear();
     std::tuple<App::CellAddress, App::CellAddress> res = getUsedRange();
     int maxRow = std::get<1>(res).row();
     int nameColIndex = getColumnIndex("Name");
@@ -125,6 +127,8 @@ void BomObject::saveCustomColumnData()
                 if (text != "") {
                     std::string objName = getText(row, nameColIndex);
                     BomDataElement el(objName, columnName, text);
+                    dataElementIndex.emplace(std::make_pair(objName, columnName),
+                                             dataElements.size());
                     dataElements.push_back(el);
                 }
             }
@@ -137,17 +141,13 @@ void BomObject::saveCustomColumnData()
 void BomObject::generateBOM()
 {
     saveCustomColumnData();
-    clearAll();
     obj_list.clear();
-    size_t row = 0;
-    size_t col = 0;
+    childEntries.clear();
+    bomRows.clear();
 
     // Populate headers
-    for (auto& columnName : columnsNames.getValues()) {
-        setCell(App::CellAddress(row, col), columnName.c_str());
-        ++col;
-    }
-    ++row;
+    bomRows.push_back(columnsNames.getValues());
+    size_t row = 1;
 
     auto* assembly = getAssembly();
     if (assembly) {
@@ -156,29 +156,30 @@ void BomObject::generateBOM()
     else {
         addObjectChildrenToBom(getDocument()->getRootObjectsIgnoreLinks(), row, "");
     }
+
+    writeBomRows();
 }
 
-void BomObject::addObjectChildrenToBom(std::vector<App::DocumentObject*> objs,
-                                       size_t& row,
-                                       std::string index)
+std::vector<BomObject::BomEntry>
+BomObject::getBomEntries(const std::vector<App::DocumentObject*>& objs)
 {
-    int quantityColIndex = getColumnIndex("Quantity");
+    // Objects used several times (case of links) are merged into one entry with a quantity.
+    // Note: an object can be used in several parts. In which case we do no want to blindly
+    // increment, only siblings are merged.
     bool hasQuantityCol = hasQuantityColumn();
-
-    size_t siblingsInitialRow = row;
-
-    if (index != "") {
-        index = index + ".";
-    }
-
-    size_t sub_i = 1;
+    std::vector<BomEntry> entries;
+    std::unordered_map<App::DocumentObject*, size_t> entryOfObject;
 
     for (auto* child : objs) {
         if (!child) {
             continue;
         }
+        int quantity = 1;
         if (child->isDerivedFrom<App::Link>()) {
-            child = static_cast<App::Link*>(child)->getLinkedObject();
+            auto* link = static_cast<App::Link*>(child);
+            // The elements of a link array are counted, not visited one by one
+            quantity = std::max(link->getElementCountValue(), 1);
+            child = link->getLinkedObject();
             if (!child) {
                 continue;
             }
@@ -189,67 +190,125 @@ void BomObject::addObjectChildrenToBom(std::vector<App::DocumentObject*> objs,
             continue;
         }
 
-        if (hasQuantityCol && row != siblingsInitialRow) {
-            // Check if the object is not already in (case of links). And if so just increment.
-            // Note: an object can be used in several parts. In which case we do no want to blindly
-            // increment.
-            bool found = false;
-            for (size_t i = siblingsInitialRow; i <= row; ++i) {
-                size_t idInList = i - 1;  // -1 for the header
-                if (idInList < obj_list.size() && child == obj_list[idInList]) {
-
-                    int qty = std::stoi(getText(i, quantityColIndex)) + 1;
-                    setCell(App::CellAddress(i, quantityColIndex), std::to_string(qty).c_str());
-                    found = true;
-                    break;
-                }
-            }
-            if (found) {
+        if (hasQuantityCol) {
+            auto it = entryOfObject.find(child);
+            if (it != entryOfObject.end()) {
+                entries[it->second].quantity += quantity;
                 continue;
             }
+            entryOfObject.emplace(child, entries.size());
         }
+        entries.push_back({child, quantity});
+    }
+
+    return entries;
+}
+
+const std::vector<BomObject::BomEntry>& BomObject::getChildEntries(App::DocumentObject* obj)
+{
+    auto it = childEntries.find(obj);
+    if (it == childEntries.end()) {
+        it = childEntries.emplace(obj, getBomEntries(obj->getOutList())).first;
+    }
+    return it->second;
+}
+
+void BomObject::addObjectChildrenToBom(std::vector<App::DocumentObject*> objs,
+                                       size_t& row,
+                                       std::string index)
+{
+    addEntriesToBom(getBomEntries(objs), row, index);
+}
+
+void BomObject::addEntriesToBom(const std::vector<BomEntry>& entries,
+                                size_t& row,
+                                std::string index)
+{
+    if (index != "") {
+        index = index + ".";
+    }
+
+    size_t sub_i = 1;
+
+    for (const auto& entry : entries) {
+        App::DocumentObject* child = entry.obj;
 
         std::string sub_index = index + std::to_string(sub_i);
         ++sub_i;
 
-        addObjectToBom(child, row, sub_index);
+        addObjectToBom(child, row, sub_index, entry.quantity);
         ++row;
 
         if ((child->isDerivedFrom<AssemblyObject>() && detailSubAssemblies.getValue())
             || (child->isDerivedFrom<App::Part>() && detailParts.getValue())) {
-            addObjectChildrenToBom(child->getOutList(), row, sub_index);
+            addEntriesToBom(getChildEntries(child), row, sub_index);
         }
     }
 }
 
-void BomObject::addObjectToBom(App::DocumentObject* obj, size_t row, std::string index)
+void BomObject::addObjectToBom(App::DocumentObject* obj,
+                               size_t row,
+                               std::string index,
+                               int quantity)
 {
     obj_list.push_back(obj);
-    size_t col = 0;
+    if (bomRows.size() <= row) {
+        bomRows.resize(row + 1);
+    }
+    auto& rowCells = bomRows[row];
     for (auto& columnName : columnsNames.getValues()) {
         if (columnName == "Index") {
-            setCell(App::CellAddress(row, col), (std::string("'") + index).c_str());
+            rowCells.push_back(std::string("'") + index);
         }
         else if (columnName == "Name") {
-            setCell(App::CellAddress(row, col), obj->Label.getValue());
+            rowCells.emplace_back(obj->Label.getValue());
         }
         else if (columnName == "File Name") {
-            setCell(App::CellAddress(row, col), obj->getDocument()->getFileName());
+            rowCells.emplace_back(obj->getDocument()->getFileName());
         }
         else if (columnName == "Quantity") {
-            setCell(App::CellAddress(row, col), std::to_string(1).c_str());
+            rowCells.push_back(std::to_string(quantity));
         }
         else {
             // load custom data if any.
-            for (auto& el : dataElements) {
-                if (el.objName == obj->Label.getValue() && el.columnName == columnName) {
-                    setCell(App::CellAddress(row, col), el.value.c_str());
-                    break;
-                }
+            auto it = dataElementIndex.find(std::make_pair(obj->Label.getStrValue(), columnName));
+            rowCells.push_back(it != dataElementIndex.end() ? dataElements[it->second].value
+                                                            : std::string());
+        }
+    }
+}
+
+void BomObject::writeBomRows()
+{
+    // Only the cells whose content differs are set or cleared, so a small change of a big
+    // assembly does not rebuild the whole sheet.
+    for (const auto& address : cells.getUsedCells()) {
+        auto row = static_cast<size_t>(address.row());
+        auto col = static_cast<size_t>(address.col());
+        if (row >= bomRows.size() || col >= bomRows[row].size()) {
+            clear(address);
+        }
+    }
+
+    std::vector<std::pair<App::CellAddress, std::string>> changes;
+    for (size_t row = 0; row < bomRows.size(); ++row) {
+        for (size_t col = 0; col < bomRows[row].size(); ++col) {
+            const std::string& value = bomRows[row][col];
+            App::CellAddress address(row, col);
+            std::string text = getText(row, col);
+            bool quoted = !value.empty() && value.front() == '\'';
+            if (text == (quoted ? value.substr(1) : value)) {
+                continue;
+            }
+            if (value.empty()) {
+                clear(address);
+            }
+            else {
+                changes.emplace_back(address, value);
             }
         }
-        ++col;
     }
+    setCells(changes);
 }
 
 AssemblyObject* BomObject::getAssembly()
@@ -25,6 +25,9 @@
 #ifndef ASSEMBLY_BomObject_H
 #define ASSEMBLY_BomObject_H
 
+#include <map>
+#include <unordered_map>
+
 #include <App/PropertyFile.h>
 
 #include <Mod/Assembly/AssemblyGlobal.h>
@@ -76,7 +79,7 @@ public:
     App::DocumentObjectExecReturn* execute() override;
 
     void generateBOM();
-    void addObjectToBom(App::DocumentObject* obj, size_t row, std::string index);
+    void addObjectToBom(App::DocumentObject* obj, size_t row, std::string index, int quantity);
     void
     addObjectChildrenToBom(std::vector<App::DocumentObject*> objs, size_t& row, std::string index);
     void saveCustomColumnData();
@@ -94,6 +97,26 @@ public:
 
     std::vector<BomDataElement> dataElements;
     std::vector<App::DocumentObject*> obj_list;
+
+private:
+    // A row of the BOM before merging into the sheet, the part and how many times it is used
+    struct BomEntry
+    {
+        App::DocumentObject* obj;
+        int quantity;
+    };
+
+    std::vector<BomEntry> getBomEntries(const std::vector<App::DocumentObject*>& objs);
+    const std::vector<BomEntry>& getChildEntries(App::DocumentObject* obj);
+    void addEntriesToBom(const std::vector<BomEntry>& entries, size_t& row, std::string index);
+    void writeBomRows();
+
+    // The entries of the sub-assemblies and parts, so one used in many places is walked once
+    std::unordered_map<App::DocumentObject*, std::vector<BomEntry>> childEntries;
+    // The contents of the cells of the generated BOM, the header first
+    std::vector<std::vector<std::string>> bomRows;
+    // Index of the first element of dataElements for an object name and column
+    std::map<std::pair<std::string, std::string>, size_t> dataElementIndex;
 };
 
 
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <vector>
+#endif
+
+#include <Base/FileInfo.h>
+#include <Base/Placement.h>
+
+#include "SimulationFrames.h"
+
+
+using namespace Assembly;
+
+SimulationFrames::SimulationFrames(const std::string& fileName, std::size_t partCount)
+    : fileName(fileName)
+    , partCount(partCount)
+    , output(Base::FileInfo(fileName), std::ios::out | std::ios::trunc | std::ios::binary)
+    , buffer(partCount * valuesPerPart)
+{}
+
+SimulationFrames::~SimulationFrames()
+{
+    output.close();
+    input.close();
+    Base::FileInfo(fileName).deleteFile();
+}
+
+bool SimulationFrames::isValid() const
+{
+    return writing ? output.good() : input.good();
+}
+
+bool SimulationFrames::addFrame(const std::vector<Base::Placement>& placements)
+{
+    if (!writing || placements.size() != partCount) {
+        return false;
+    }
+
+    float* values = buffer.data();
+    for (const auto& plc : placements) {
+        Base::Vector3d pos = plc.getPosition();
+        double q0, q1, q2, q3;
+        plc.getRotation().getValue(q0, q1, q2, q3);
+        for (double value : {pos.x, pos.y, pos.z, q0, q1, q2, q3}) {
+            *values++ = static_cast<float>(value);
+        }
+    }
+
+    output.write(reinterpret_cast<const char*>(buffer.data()),  // NOLINT
+                 static_cast<std::streamsize>(buffer.size() * sizeof(float)));
+    if (!output.good()) {
+        return false;
+    }
+    frameCount++;
+    return true;
+}
+
+bool SimulationFrames::getFrame(std::size_t index, std::vector<Base::Placement>& placements)
+{
+    if (index >= frameCount) {
+        return false;
+    }
+
+    if (writing) {
+        // The first read ends the writing
+        output.close();
+        input.open(Base::FileInfo(fileName), std::ios::in | std::ios::binary);
+        writing = false;
+    }
+
+    auto frameSize = static_cast<std::streamsize>(buffer.size() * sizeof(float));
+    input.seekg(static_cast<std::streamoff>(index) * frameSize);
+    input.read(reinterpret_cast<char*>(buffer.data()), frameSize);  // NOLINT
+    if (!input.good()) {
+        input.clear();
+        return false;
+    }
+
+    placements.resize(partCount);
+    const float* values = buffer.data();
+    for (auto& plc : placements) {
+        plc.setPosition(Base::Vector3d(values[0], values[1], values[2]));
+        Base::Rotation rot;
+        rot.setValue(values[3], values[4], values[5], values[6]);
+        plc.setRotation(rot);
+        values += valuesPerPart;
+    }
+    return true;
+}
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   Copyright (c) 2026 FreeCAD Project Association                         *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+
+#ifndef ASSEMBLY_SimulationFrames_H
+#define ASSEMBLY_SimulationFrames_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <Mod/Assembly/AssemblyGlobal.h>
+
+#include <Base/Stream.h>
+
+namespace Base
+{
+class Placement;
+}
+
+namespace Assembly
+{
+
+/* The placements of the parts of a kinematic simulation, one frame per output step.
+The frames are streamed to a file as they are added, seven floats per part, so long
+simulations don't have to be kept in memory. Any frame can be read back on its own. */
+class AssemblyExport SimulationFrames
+{
+public:
+    // Creates the file, which is removed again when the frames are destroyed.
+    SimulationFrames(const std::string& fileName, std::size_t partCount);
+    ~SimulationFrames();
+
+    SimulationFrames(const SimulationFrames&) = delete;
+    SimulationFrames& operator=(const SimulationFrames&) = delete;
+
+    bool isValid() const;
+    std::size_t numberOfParts() const
+    {
+        return partCount;
+    }
+    std::size_t numberOfFrames() const
+    {
+        return frameCount;
+    }
+
+    // placements holds one placement per part
+    bool addFrame(const std::vector<Base::Placement>& placements);
+    bool getFrame(std::size_t index, std::vector<Base::Placement>& placements);
+
+private:
+    static constexpr std::size_t valuesPerPart = 7;
+
+    std::string fileName;
+    std::size_t partCount;
+    std::size_t frameCount = 0;
+    bool writing = true;
+    Base::ofstream output;
+    Base::ifstream input;
+    std::vector<float> buffer;
+};
+
+}  // namespace Assembly
+
+
+#endif  // ASSEMBLY_SimulationFrames_H
@@ -26,7 +26,10 @@
 #define BOOST_GEOMETRY_DISABLE_DEPRECATED_03_WARNING
 
 #ifndef _PreComp_
+#include <atomic>
 #include <cfloat>
+#include <future>
+#include <thread>
 
 #include <boost_geometry.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
@@ -71,6 +74,7 @@
 
 #include <App/Application.h>
 #include <App/Document.h>
+#include <Base/Cancellation.h>
 #include <Base/Exception.h>
 #include <Mod/Part/App/CrossSection.h>
 #include <Mod/Part/App/FaceMakerBullseye.h>
@@ -171,7 +175,7 @@ CAreaConfig::~CAreaConfig()
 
 TYPESYSTEM_SOURCE(Path::Area, Base::BaseClass)
 
-bool Area::s_aborting;
+std::atomic<bool> Area::s_aborting(false);
 
 Area::Area(const AreaParams* params)
     : myParams(s_params)
@@ -1727,7 +1731,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
         throw Base::ValueError("failed to obtain section plane");
     }
 
-    FC_TIME_INIT2(t, t1);
+    FC_TIME_INIT(t);
 
     TopLoc_Location loc(trsf);
 
@@ -1886,9 +1890,12 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
     bool can_retry = fabs(tolerance) > Precision::Confusion();
     TopLoc_Location locInverse(loc.Inverted());
 
-    for (size_t i = 0; i < heights.size(); ++i) {
+    // The sections are independent of each other, the slicing of the shapes is done in parallel
+    // unless the intermediate shapes are shown for debugging
+    auto makeSection = [&](std::size_t i) -> shared_ptr<Area> {
         double z = heights[i];
         bool retried = !can_retry;
+        FC_TIME_INIT(t1);
         while (true) {
             gp_Pln pln(gp_Pnt(0, 0, z), gp_Dir(0, 0, 1));
             Standard_Real a, b, c, d;
@@ -1907,8 +1914,7 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                     TopLoc_Location wloc(t);
                     area->add(s.shape.Moved(wloc).Moved(locInverse), s.op);
                 }
-                sections.push_back(area);
-                break;
+                return area;
             }
 
             for (auto it = myShapes.begin(); it != myShapes.end(); ++it) {
@@ -1984,14 +1990,13 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                 }
             }
             if (!area->myShapes.empty()) {
-                sections.push_back(area);
                 FC_TIME_LOG(t1, "makeSection " << z);
                 showShape(area->getShape(), nullptr, "section_%u_final", i);
-                break;
+                return area;
             }
             if (retried) {
                 AREA_WARN("Discard empty section");
-                break;
+                return shared_ptr<Area>();
             }
             else {
                 AREA_TRACE("retry section " << z << "->" << z + tolerance);
@@ -1999,6 +2004,40 @@ std::vector<shared_ptr<Area>> Area::makeSections(PARAM_ARGS(PARAM_FARG, AREA_PAR
                 retried = true;
             }
         }
+    };
+
+    std::vector<shared_ptr<Area>> results(heights.size());
+    std::size_t numThreads = std::min<std::size_t>(
+        std::max(std::thread::hardware_concurrency(), 1U), heights.size());
+    if (numThreads <= 1 || FC_LOG_INSTANCE.level() > FC_LOGLEVEL_TRACE) {
+        for (std::size_t i = 0; i < heights.size(); ++i) {
+            results[i] = makeSection(i);
+        }
+    }
+    else {
+        std::atomic<std::size_t> next(0);
+        std::vector<std::future<void>> workers;
+        for (std::size_t k = 0; k < numThreads; ++k) {
+            workers.push_back(std::async(std::launch::async, [&]() {
+                for (std::size_t i = next++; i < heights.size(); i = next++) {
+                    results[i] = makeSection(i);
+                }
+            }));
+        }
+        // wait for all workers before passing on the first exception
+        for (auto& worker : workers) {
+            worker.wait();
+        }
+        for (auto& worker : workers) {
+            worker.get();
+        }
+    }
+
+    // keep the order of the heights
+    for (auto& area : results) {
+        if (area) {
+            sections.push_back(std::move(area));
+        }
     }
     FC_TIME_LOG(t, "makeSection count: " << sections.size() << ", total");
     return sections;
@@ -2097,6 +2136,9 @@ void Area::build()
         const auto& shapes =
             (myParams.Outline && !myProjecting) ? getProjectedShapes(trsf) : myShapes;
         for (const Shape& s : shapes) {
+            if (aborting()) {
+                throw Base::AbortException("Area operation aborted");
+            }
             if (exploding) {
                 exploding = false;
                 explode(s.shape);
@@ -2430,6 +2472,9 @@ void Area::makeOffset(list<shared_ptr<CArea>>& areas,
         }
     }
     for (int i = 0; count < 0 || i < count; ++i, offset += stepover) {
+        if (aborting()) {
+            throw Base::AbortException("Area operation aborted");
+        }
         if (from_center) {
             areas.push_front(make_shared<CArea>());
         }
@@ -2996,6 +3041,9 @@ struct ShapeInfo
     Wires myWires;
     RTree myRTree;
     TopoDS_Shape myShape;
+    Bnd_Box myBounds;
+    bg::model::box<gp_Pnt> myBox;
+    std::size_t myIndex;
     gp_Pnt myBestPt;
     gp_Pnt myStartPt;
     Wires::iterator myBestWire;
@@ -3010,6 +3058,7 @@ struct ShapeInfo
     ShapeInfo(const gp_Pln& pln, const TopoDS_Shape& shape, ShapeParams& params)
         : myPln(pln)
         , myShape(shape)
+        , myIndex(0)
         , myStartPt(1e20, 1e20, 1e20)
         , myParams(params)
         , myBestParameter(0)
@@ -3021,6 +3070,7 @@ struct ShapeInfo
 
     ShapeInfo(const TopoDS_Shape& shape, ShapeParams& params)
         : myShape(shape)
+        , myIndex(0)
         , myStartPt(1e20, 1e20, 1e20)
         , myParams(params)
         , myBestParameter(0)
@@ -3312,6 +3362,27 @@ struct ShapeInfo
     }
 };
 
+struct ShapeBoxGetter
+{
+    using result_type = const bg::model::box<gp_Pnt>&;
+    result_type operator()(std::list<ShapeInfo>::iterator it) const
+    {
+        return it->myBox;
+    }
+};
+using ShapeRTree = bgi::rtree<std::list<ShapeInfo>::iterator, RParameters, ShapeBoxGetter>;
+
+// The square distance of a point to a bound box, zero for points inside
+static double squareDistance(const bg::model::box<gp_Pnt>& box, const gp_Pnt& pt)
+{
+    const gp_Pnt& pmin = box.min_corner();
+    const gp_Pnt& pmax = box.max_corner();
+    double dx = std::max(std::max(pmin.X() - pt.X(), pt.X() - pmax.X()), 0.0);
+    double dy = std::max(std::max(pmin.Y() - pt.Y(), pt.Y() - pmax.Y()), 0.0);
+    double dz = std::max(std::max(pmin.Z() - pt.Z(), pt.Z() - pmax.Z()), 0.0);
+    return dx * dx + dy * dy + dz * dz;
+}
+
 struct ShapeInfoBuilder
 {
     std::list<ShapeInfo>& myList;
@@ -3617,6 +3688,7 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
         }
 
         BRepBndLib::Add(info.myShape, bounds, Standard_False);
+        BRepBndLib::Add(info.myShape, info.myBounds, Standard_False);
     }
 
     if (use_bound || sort_mode == SortMode2D5 || sort_mode == SortModeGreedy) {
@@ -3643,6 +3715,7 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
                     ++itNext;
                 }
                 builder.Add(comp, itNext2->myShape);
+                it->myBounds.Add(itNext2->myBounds);
                 shape_list.erase(itNext2);
                 empty = false;
             }
@@ -3689,6 +3762,30 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
     }
 
 
+    // Index the shapes by their bound boxes. The distance to the box is a lower bound of the
+    // distance to the wires of the shape, so only the shapes whose box is nearer than the best
+    // distance found so far need to be searched.
+    std::vector<std::list<ShapeInfo>::iterator> shape_its;
+    std::size_t num_non_planar = 0;
+    for (auto it = shape_list.begin(); it != shape_list.end(); ++it) {
+        it->myIndex = shape_its.size();
+        if (it->myBounds.IsVoid()) {
+            // always searched
+            const double inf = 1e100;
+            it->myBox = bg::model::box<gp_Pnt>(gp_Pnt(-inf, -inf, -inf), gp_Pnt(inf, inf, inf));
+        }
+        else {
+            Standard_Real x1, y1, z1, x2, y2, z2;
+            it->myBounds.Get(x1, y1, z1, x2, y2, z2);
+            it->myBox = bg::model::box<gp_Pnt>(gp_Pnt(x1, y1, z1), gp_Pnt(x2, y2, z2));
+        }
+        if (!it->myPlanar) {
+            ++num_non_planar;
+        }
+        shape_its.push_back(it);
+    }
+    ShapeRTree shape_rtree(shape_its);
+
     gp_Pln pln;
     double hint = 0.0;
     bool hint_first = true;
@@ -3699,19 +3796,35 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
         AREA_TRACE("sorting " << shape_list.size() << ' ' << AREA_XYZ(pstart));
         double best_d = DBL_MAX;
         auto best_it = shape_list.begin();
-        for (auto it = best_it; it != shape_list.end(); ++it) {
-            double d;
-            gp_Pnt pt;
-            if (it->myPlanar && current_it == shape_list.end()) {
-                d = it->myPln.SquareDistance(pstart);
-            }
-            else {
-                d = it->nearest(pstart);
-            }
-            if (d < best_d) {
+        // the first shape in the list wins on equal distances
+        auto check = [&](std::list<ShapeInfo>::iterator it, double d) {
+            if (d < best_d || (d == best_d && it->myIndex < best_it->myIndex)) {
                 best_it = it;
                 best_d = d;
             }
+        };
+        bool layer_start = current_it == shape_list.end();
+        if (layer_start) {
+            for (auto it = shape_list.begin(); it != shape_list.end(); ++it) {
+                if (it->myPlanar) {
+                    check(it, it->myPln.SquareDistance(pstart));
+                }
+            }
+        }
+        if (!layer_start || num_non_planar) {
+            auto count = static_cast<unsigned>(shape_rtree.size());
+            for (auto rit = shape_rtree.qbegin(bgi::nearest(pstart, count));
+                 rit != shape_rtree.qend();
+                 ++rit) {
+                auto it = *rit;
+                if (layer_start && it->myPlanar) {
+                    continue;
+                }
+                if (squareDistance(it->myBox, pstart) > best_d) {
+                    break;
+                }
+                check(it, it->nearest(pstart));
+            }
         }
         gp_Pnt pentry;
         if (sort_mode == SortModeGreedy) {
@@ -3772,6 +3885,10 @@ std::list<TopoDS_Shape> Area::sortWires(const std::list<TopoDS_Shape>& shapes,
             if (current_it == best_it) {
                 current_it = shape_list.end();
             }
+            if (!best_it->myPlanar) {
+                --num_non_planar;
+            }
+            shape_rtree.remove(best_it);
             shape_list.erase(best_it);
         }
     }
@@ -4194,7 +4311,7 @@ void Area::abort(bool aborting)
 
 bool Area::aborting()
 {
-    return s_aborting;
+    return s_aborting || Base::Cancellation::isRequested();
 }
 
 AreaStaticParams::AreaStaticParams()
@@ -23,6 +23,7 @@
 #ifndef PATH_AREA_H
 #define PATH_AREA_H
 
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <memory>
@@ -141,7 +142,9 @@ protected:
     bool myProjecting;
     mutable int mySkippedShapes;
 
-    static bool s_aborting;
+    /// set by the main thread, also seen by features recomputed concurrently
+    static std::atomic<bool> s_aborting;
+    /// only written by setDefaultParams(), which does not run during a recompute
     static AreaStaticParams s_params;
 
     /** Called internally to combine children shapes for further processing */
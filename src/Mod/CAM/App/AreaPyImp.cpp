@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Mod/Part/App/OCCError.h>
 #include <Mod/Part/App/TopoShapePy.h>
@@ -333,10 +334,17 @@ PyObject* AreaPy::getShape(PyObject* args, PyObject* keywds)
 
     PY_TRY
     {
-        if (Base::asBoolean(pcObj)) {
-            getAreaPtr()->clean();
+        TopoDS_Shape shape;
+        {
+            bool rebuild = Base::asBoolean(pcObj);
+            // the area is built in place, see PyGILStateRelease
+            Base::PyGILStateRelease release;
+            if (rebuild) {
+                getAreaPtr()->clean();
+            }
+            shape = getAreaPtr()->getShape(index);
         }
-        return Py::new_reference_to(Part::shape2pyshape(getAreaPtr()->getShape(index)));
+        return Py::new_reference_to(Part::shape2pyshape(shape));
     }
     PY_CATCH_OCC
 }
@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <cctype>
 #include <cinttypes>
 #include <iomanip>
 #include <boost/algorithm/string.hpp>
@@ -104,9 +105,7 @@ std::string Command::toGCode(int precision, bool padzero) const
     }
     double scale = std::pow(10.0, precision + 1);
     std::int64_t iscale = static_cast<std::int64_t>(scale) / 10;
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin();
-         i != Parameters.end();
-         ++i) {
+    for (auto i = Parameters.begin(); i != Parameters.end(); ++i) {
         if (i->first == "N") {
             continue;
         }
@@ -141,81 +140,80 @@ std::string Command::toGCode(int precision, bool padzero) const
     return str.str();
 }
 
-void Command::setFromGCode(const std::string& str)
+void Command::setFromGCode(std::string_view str)
 {
+    // a single pass over the characters: the command and the parameter names are single letters,
+    // the value collects the digits, skipping anything else as before
+    enum class Mode
+    {
+        None,
+        Command,
+        Argument,
+        Comment
+    };
+    auto upper = [](char c) {
+        return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    };
+
     Parameters.clear();
-    std::string mode = "none";
-    std::string key;
+    Mode mode = Mode::None;
+    char key = 0;
     std::string value;
-    for (unsigned int i = 0; i < str.size(); i++) {
-        if ((isdigit(str[i])) || (str[i] == '-') || (str[i] == '.')) {
-            value += str[i];
+    for (char c : str) {
+        auto uc = static_cast<unsigned char>(c);
+        if (std::isdigit(uc) || (c == '-') || (c == '.')) {
+            value += c;
         }
-        else if (isalpha(str[i])) {
-            if (mode == "command") {
-                if (!key.empty() && !value.empty()) {
-                    std::string cmd = key + value;
-                    boost::to_upper(cmd);
-                    Name = cmd;
-                    key = "";
-                    value = "";
-                    mode = "argument";
-                }
-                else {
+        else if (std::isalpha(uc)) {
+            if (mode == Mode::Command) {
+                if (key == 0 || value.empty()) {
                     throw Base::BadFormatError("Badly formatted GCode command");
                 }
-                mode = "argument";
+                Name.assign(1, upper(key));
+                Name += value;
+                value.clear();
+                mode = Mode::Argument;
             }
-            else if (mode == "none") {
-                mode = "command";
+            else if (mode == Mode::None) {
+                mode = Mode::Command;
             }
-            else if (mode == "argument") {
-                if (!key.empty() && !value.empty()) {
-                    double val = std::atof(value.c_str());
-                    boost::to_upper(key);
-                    Parameters[key] = val;
-                    key = "";
-                    value = "";
-                }
-                else {
+            else if (mode == Mode::Argument) {
+                if (key == 0 || value.empty()) {
                     throw Base::BadFormatError("Badly formatted GCode argument");
                 }
+                Parameters[std::string(1, upper(key))] = std::atof(value.c_str());
+                value.clear();
             }
-            else if (mode == "comment") {
-                value += str[i];
+            else {
+                value += c;
             }
-            key = str[i];
+            key = c;
         }
-        else if (str[i] == '(') {
-            mode = "comment";
+        else if (c == '(') {
+            mode = Mode::Comment;
         }
-        else if (str[i] == ')') {
-            key = "(";
-            value += ")";
+        else if (c == ')') {
+            key = '(';
+            value += ')';
         }
-        else {
+        else if (mode == Mode::Comment) {
             // add non-ascii characters only if this is a comment
-            if (mode == "comment") {
-                value += str[i];
-            }
+            value += c;
         }
     }
-    if (!key.empty() && !value.empty()) {
-        if ((mode == "command") || (mode == "comment")) {
-            std::string cmd = key + value;
-            if (mode == "command") {
-                boost::to_upper(cmd);
-            }
-            Name = cmd;
-        }
-        else {
-            double val = std::atof(value.c_str());
-            boost::to_upper(key);
-            Parameters[key] = val;
-        }
+    if (key == 0 || value.empty()) {
+        throw Base::BadFormatError("Badly formatted GCode argument");
+    }
+    if (mode == Mode::Command) {
+        Name.assign(1, upper(key));
+        Name += value;
+    }
+    else if (mode == Mode::Comment) {
+        Name.assign(1, key);
+        Name += value;
     }
     else {
-        throw Base::BadFormatError("Badly formatted GCode argument");
+        Parameters[std::string(1, upper(key))] = std::atof(value.c_str());
     }
 }
 
@@ -285,9 +283,7 @@ Command Command::transform(const Base::Placement& other)
     plac.getRotation().getYawPitchRoll(aval, bval, cval);
     Command c = Command();
     c.Name = Name;
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin();
-         i != Parameters.end();
-         ++i) {
+    for (auto i = Parameters.begin(); i != Parameters.end(); ++i) {
         std::string k = i->first;
         double v = i->second;
         if (k == "X") {
@@ -315,9 +311,7 @@ Command Command::transform(const Base::Placement& other)
 
 void Command::scaleBy(double factor)
 {
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin();
-         i != Parameters.end();
-         ++i) {
+    for (auto i = Parameters.begin(); i != Parameters.end(); ++i) {
         switch (i->first[0]) {
             case 'X':
             case 'Y':
@@ -24,8 +24,12 @@
 #ifndef PATH_COMMAND_H
 #define PATH_COMMAND_H
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include <Base/Persistence.h>
 #include <Base/Placement.h>
 #include <Base/Vector3D.h>
@@ -33,6 +37,98 @@
 
 namespace Path
 {
+/** The parameters of a command with the interface of a std::map<std::string, double>. A command
+ * has only a few parameters, so they are kept sorted by name in a contiguous array. This needs a
+ * single allocation and a fraction of the memory of the map nodes.
+ */
+class CommandParameters
+{
+public:
+    using value_type = std::pair<std::string, double>;
+    using iterator = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    CommandParameters() = default;
+    CommandParameters(const std::map<std::string, double>& parameters)  // NOLINT
+        : values(parameters.begin(), parameters.end())
+    {}
+
+    iterator begin()
+    {
+        return values.begin();
+    }
+    iterator end()
+    {
+        return values.end();
+    }
+    const_iterator begin() const
+    {
+        return values.begin();
+    }
+    const_iterator end() const
+    {
+        return values.end();
+    }
+    std::size_t size() const
+    {
+        return values.size();
+    }
+    bool empty() const
+    {
+        return values.empty();
+    }
+    void clear()
+    {
+        values.clear();
+    }
+
+    iterator find(const std::string& name)
+    {
+        auto it = lowerBound(values.begin(), values.end(), name);
+        return it != values.end() && it->first == name ? it : values.end();
+    }
+    const_iterator find(const std::string& name) const
+    {
+        auto it = lowerBound(values.begin(), values.end(), name);
+        return it != values.end() && it->first == name ? it : values.end();
+    }
+    std::size_t count(const std::string& name) const
+    {
+        return find(name) != values.end() ? 1 : 0;
+    }
+    double& operator[](const std::string& name)
+    {
+        auto it = lowerBound(values.begin(), values.end(), name);
+        if (it == values.end() || it->first != name) {
+            it = values.emplace(it, name, 0.0);
+        }
+        return it->second;
+    }
+    std::size_t erase(const std::string& name)
+    {
+        auto it = find(name);
+        if (it == values.end()) {
+            return 0;
+        }
+        values.erase(it);
+        return 1;
+    }
+
+private:
+    template<typename It>
+    static It lowerBound(It first, It last, const std::string& name)
+    {
+        return std::lower_bound(first,
+                                last,
+                                name,
+                                [](const value_type& value, const std::string& n) {
+                                    return value.first < n;
+                                });
+    }
+
+    std::vector<value_type> values;
+};
+
 /** The representation of a cnc command in a path */
 class PathExport Command: public Base::Persistence
 {
@@ -58,7 +154,7 @@ public:
     toGCode(int precision = 6,
             bool padzero = true) const;  // returns a GCode string representation of the command
     void setFromGCode(
-        const std::string&);  // sets the parameters from the contents of the given GCode string
+        std::string_view);  // sets the parameters from the contents of the given GCode string
     void setFromPlacement(
         const Base::Placement&);  // sets the parameters from the contents of the given placement
     bool
@@ -76,7 +172,7 @@ public:
 
     // attributes
     std::string Name;
-    std::map<std::string, double> Parameters;
+    CommandParameters Parameters;
 };
 
 }  // namespace Path
@@ -53,6 +53,11 @@ public:
     }
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    /// the area only reads the linked shapes, libarea keeps its settings per thread
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
     PyObject* getPyObject() override;
 
     App::PropertyLinkList Sources;
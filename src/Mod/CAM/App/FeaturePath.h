@@ -51,6 +51,11 @@ public:
     {
         return App::DocumentObject::StdReturn;
     }
+    /// nothing is computed here, Python operations still run on the main thread
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
     short mustExecute() const override;
     PyObject* getPyObject() override;
 
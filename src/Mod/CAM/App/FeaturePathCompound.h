@@ -49,6 +49,11 @@ public:
         return "PathGui::ViewProviderPathCompound";
     }
     App::DocumentObjectExecReturn* execute() override;
+    /// the commands of the grouped paths are only read
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
 
     /// Checks whether the object \a obj is part of this group.
     bool hasObject(const DocumentObject* obj) const;
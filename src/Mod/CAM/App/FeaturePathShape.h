@@ -53,6 +53,11 @@ public:
     //@{
     /// recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
+    /// the path is generated from the linked shapes only
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
     //@}
 
     /// returns the type name of the ViewProvider
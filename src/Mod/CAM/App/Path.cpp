@@ -85,7 +85,11 @@ void Toolpath::addCommand(const Command& Cmd)
 {
     Command* tmp = new Command(Cmd);
     vpcCommands.push_back(tmp);
-    recalculate();
+    // appending does not change the moves before, so the metrics can be extended
+    if (metricsValid) {
+        metrics.add(*tmp);
+    }
+    boundBoxValid = false;
 }
 
 void Toolpath::insertCommand(const Command& Cmd, int pos)
@@ -118,33 +122,64 @@ void Toolpath::deleteCommand(int pos)
     recalculate();
 }
 
-double Toolpath::getLength()
+void Toolpath::Metrics::add(const Command& cmd)
 {
-    if (vpcCommands.empty()) {
-        return 0;
+    const std::string& name = cmd.Name;
+    bool isRapid = (name == "G0") || (name == "G00");
+    bool isFeed = (name == "G1") || (name == "G01");
+    bool isArc = (name == "G2") || (name == "G02") || (name == "G3") || (name == "G03");
+
+    // the length only follows the moves, the cycle time every command
+    if (isRapid || isFeed || isArc) {
+        Vector3d next = cmd.getPlacement(lastMove).getPosition();
+        if (isArc) {
+            Vector3d center = cmd.getCenter();
+            double radius = (lastMove - center).Length();
+            double angle = (next - center).GetAngle(lastMove - center);
+            length += angle * radius;
+        }
+        else {
+            length += (next - lastMove).Length();
+        }
+        lastMove = next;
     }
+
+    Vector3d next = cmd.getPlacement(last).getPosition();
+    bool verticalMove = last.z != next.z;
     double l = 0;
-    Vector3d last(0, 0, 0);
-    Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        next = (*it)->getPlacement(last).getPosition();
-        if ((name == "G0") || (name == "G00") || (name == "G1") || (name == "G01")) {
-            // straight line
-            l += (next - last).Length();
-            last = next;
-        }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
-            // arc
-            Vector3d center = (*it)->getCenter();
-            double radius = (last - center).Length();
-            double angle = (next - center).GetAngle(last - center);
-            l += angle * radius;
-            last = next;
+    if (isArc) {
+        Vector3d center = cmd.getCenter();
+        double radius = (last - center).Length();
+        double angle = (next - center).GetAngle(last - center);
+        l = angle * radius;
+    }
+    else if (isRapid || isFeed) {
+        l = (next - last).Length();
+    }
+    if (isRapid) {
+        (verticalMove ? rapidVerticalLength : rapidLength) += l;
+    }
+    else {
+        (verticalMove ? feedVerticalLength : feedLength) += l;
+    }
+    last = next;
+}
+
+const Toolpath::Metrics& Toolpath::getMetrics() const
+{
+    if (!metricsValid) {
+        metrics = Metrics();
+        for (const Command* cmd : vpcCommands) {
+            metrics.add(*cmd);
         }
+        metricsValid = true;
     }
-    return l;
+    return metrics;
+}
+
+double Toolpath::getLength()
+{
+    return getMetrics().length;
 }
 
 double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double vRapid)
@@ -167,53 +202,9 @@ double Toolpath::getCycleTime(double hFeed, double vFeed, double hRapid, double
         vRapid = vFeed;
     }
 
-    if (vpcCommands.empty()) {
-        return 0;
-    }
-    double l = 0;
-    double time = 0;
-    bool verticalMove = false;
-    Vector3d last(0, 0, 0);
-    Vector3d next;
-    for (std::vector<Command*>::const_iterator it = vpcCommands.begin(); it != vpcCommands.end();
-         ++it) {
-        std::string name = (*it)->Name;
-        float feedrate = (*it)->getParam("F");
-
-        l = 0;
-        verticalMove = false;
-        feedrate = hFeed;
-        next = (*it)->getPlacement(last).getPosition();
-
-        if (last.z != next.z) {
-            verticalMove = true;
-            feedrate = vFeed;
-        }
-
-        if ((name == "G0") || (name == "G00")) {
-            // Rapid Move
-            l += (next - last).Length();
-            feedrate = hRapid;
-            if (verticalMove) {
-                feedrate = vRapid;
-            }
-        }
-        else if ((name == "G1") || (name == "G01")) {
-            // Feed Move
-            l += (next - last).Length();
-        }
-        else if ((name == "G2") || (name == "G02") || (name == "G3") || (name == "G03")) {
-            // Arc Move
-            Vector3d center = (*it)->getCenter();
-            double radius = (last - center).Length();
-            double angle = (next - center).GetAngle(last - center);
-            l += angle * radius;
-        }
-
-        time += l / feedrate;
-        last = next;
-    }
-    return time;
+    const Metrics& m = getMetrics();
+    return m.rapidLength / hRapid + m.rapidVerticalLength / vRapid + m.feedLength / hFeed
+        + m.feedVerticalLength / vFeed;
 }
 
 class BoundBoxSegmentVisitor: public PathSegmentVisitor
@@ -297,15 +288,18 @@ private:
 
 Base::BoundBox3d Toolpath::getBoundBox() const
 {
-    BoundBoxSegmentVisitor visitor;
-    PathSegmentWalker walker(*this);
-    walker.walk(visitor, Vector3d(0, 0, 0));
-
-    return visitor.bb;
+    if (!boundBoxValid) {
+        BoundBoxSegmentVisitor visitor;
+        PathSegmentWalker walker(*this);
+        walker.walk(visitor, Vector3d(0, 0, 0));
+        boundBox = visitor.bb;
+        boundBoxValid = true;
+    }
+    return boundBox;
 }
 
 static void
-bulkAddCommand(const std::string& gcodestr, std::vector<Command*>& commands, bool& inches)
+bulkAddCommand(std::string_view gcodestr, std::vector<Command*>& commands, bool& inches)
 {
     Command* cmd = new Command();
     cmd->setFromGCode(gcodestr);
@@ -325,56 +319,46 @@ bulkAddCommand(const std::string& gcodestr, std::vector<Command*>& commands, boo
     }
 }
 
-void Toolpath::setFromGCode(const std::string instr)
+void Toolpath::setFromGCode(std::string_view str)
 {
     clear();
 
-    // remove comments
-    // boost::regex e("\\(.*?\\)");
-    // std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
-
-    // split input string by () or G or M commands
-    std::string mode = "command";
+    // split input string by () or G or M commands, the commands are parsed from views into it
+    constexpr std::string_view::size_type none = std::string_view::npos;
+    bool comment = false;
     std::size_t found = str.find_first_of("(gGmM");
-    int last = -1;
+    std::size_t last = none;
     bool inches = false;
-    while (found != std::string::npos) {
+    while (found != none) {
         if (str[found] == '(') {
             // start of comment
-            if ((last > -1) && (mode == "command")) {
+            if ((last != none) && !comment) {
                 // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+                bulkAddCommand(str.substr(last, found - last), vpcCommands, inches);
             }
-            mode = "comment";
+            comment = true;
             last = found;
             found = str.find_first_of(')', found + 1);
         }
         else if (str[found] == ')') {
             // end of comment
-            std::string gcodestr = str.substr(last, found - last + 1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-            last = -1;
+            bulkAddCommand(str.substr(last, found - last + 1), vpcCommands, inches);
+            last = none;
             found = str.find_first_of("(gGmM", found + 1);
-            mode = "command";
+            comment = false;
         }
-        else if (mode == "command") {
+        else {
             // command
-            if (last > -1) {
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+            if (last != none) {
+                bulkAddCommand(str.substr(last, found - last), vpcCommands, inches);
             }
             last = found;
             found = str.find_first_of("(gGmM", found + 1);
         }
     }
     // add the last command found, if any
-    if (last > -1) {
-        if (mode == "command") {
-            std::string gcodestr = str.substr(last, std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
-        }
+    if ((last != none) && !comment) {
+        bulkAddCommand(str.substr(last), vpcCommands, inches);
     }
     recalculate();
 }
@@ -392,6 +376,8 @@ std::string Toolpath::toGCode() const
 
 void Toolpath::recalculate()  // recalculates the path cache
 {
+    metricsValid = false;
+    boundBoxValid = false;
 
     if (vpcCommands.empty()) {
         return;
@@ -60,10 +60,10 @@ public:
     void deleteCommand(int);                              // deletes a command
     double getLength();                                   // return the Length (mm) of the Path
     double getCycleTime(double, double, double, double);  // return the Cycle Time (s) of the Path
-    void recalculate();                                   // recalculates the points
+    void recalculate();  // recalculates the points and drops the cached metrics
     void
-    setFromGCode(const std::string);  // sets the path from the contents of the given GCode string
-    std::string toGCode() const;      // gets a gcode string representation from the Path
+    setFromGCode(std::string_view);  // sets the path from the contents of the given GCode string
+    std::string toGCode() const;     // gets a gcode string representation from the Path
     Base::BoundBox3d getBoundBox() const;
 
     // shortcut functions
@@ -92,6 +92,28 @@ public:
 protected:
     std::vector<Command*> vpcCommands;
     Base::Vector3d center;
+
+private:
+    /** The move lengths getLength() and getCycleTime() are based on, collected in one walk over
+     * the commands. Appending a command extends them, any other change drops them.
+     */
+    struct Metrics
+    {
+        double length = 0;
+        double rapidLength = 0;          // G0 moves in a plane
+        double rapidVerticalLength = 0;  // G0 moves changing z
+        double feedLength = 0;           // G1, G2 and G3 moves in a plane
+        double feedVerticalLength = 0;   // G1, G2 and G3 moves changing z
+        Base::Vector3d lastMove;         // end of the last move counted in length
+        Base::Vector3d last;             // end of the last command
+        void add(const Command& cmd);
+    };
+    const Metrics& getMetrics() const;
+
+    mutable Metrics metrics;
+    mutable bool metricsValid = false;
+    mutable Base::BoundBox3d boundBox;
+    mutable bool boundBoxValid = false;
     // KDL::Path_Composite *pcPath;
 
     /*
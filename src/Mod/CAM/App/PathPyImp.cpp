@@ -216,8 +216,7 @@ PyObject* PathPy::setFromGCode(PyObject* args)
 {
     char* pstr = nullptr;
     if (PyArg_ParseTuple(args, "s", &pstr)) {
-        std::string gcode(pstr);
-        getToolpathPtr()->setFromGCode(gcode);
+        getToolpathPtr()->setFromGCode(pstr);
         Py_INCREF(Py_None);
         return Py_None;
     }
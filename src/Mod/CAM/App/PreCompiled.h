@@ -43,11 +43,17 @@
 #ifdef _PreComp_
 
 // standard
+#include <atomic>
+#include <cctype>
 #include <cinttypes>
+#include <cmath>
+#include <future>
 #include <iomanip>
 #include <map>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 // Boost
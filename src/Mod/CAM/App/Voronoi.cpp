@@ -24,6 +24,8 @@
 #ifndef _PreComp_
 #define _USE_MATH_DEFINES
 #include <math.h>
+#include <cmath>
+#include <vector>
 #endif
 
 #include <Base/Vector3D.h>
@@ -38,6 +40,22 @@ TYPESYSTEM_SOURCE(Path::Voronoi, Base::BaseClass)
 
 // Helpers
 
+namespace
+{
+
+// the elements of a diagram are stored in vectors, the index is the offset into them
+template<typename T>
+int indexOf(const std::vector<T>& elements, const T* element)
+{
+    intptr_t offset = intptr_t(element) - intptr_t(elements.data());
+    if (offset < 0 || offset >= intptr_t(elements.size() * sizeof(T)) || offset % sizeof(T)) {
+        return Voronoi::InvalidIndex;
+    }
+    return int(offset / sizeof(T));
+}
+
+}  // namespace
+
 // Voronoi::diagram_type
 
 Voronoi::diagram_type::diagram_type()
@@ -72,48 +90,15 @@ Base::Vector3d Voronoi::diagram_type::scaledVector(const vertex_type& v, double
 
 int Voronoi::diagram_type::index(const Voronoi::diagram_type::cell_type* cell) const
 {
-    auto it = cell_index.find(intptr_t(cell));
-    if (it == cell_index.end()) {
-        return Voronoi::InvalidIndex;
-    }
-    return it->second;
+    return indexOf(cells(), cell);
 }
 int Voronoi::diagram_type::index(const Voronoi::diagram_type::edge_type* edge) const
 {
-    auto it = edge_index.find(intptr_t(edge));
-    if (it == edge_index.end()) {
-        return Voronoi::InvalidIndex;
-    }
-    return it->second;
+    return indexOf(edges(), edge);
 }
 int Voronoi::diagram_type::index(const Voronoi::diagram_type::vertex_type* vertex) const
 {
-    auto it = vertex_index.find(intptr_t(vertex));
-    if (it == vertex_index.end()) {
-        return Voronoi::InvalidIndex;
-    }
-    return it->second;
-}
-
-void Voronoi::diagram_type::reIndex()
-{
-    int idx = 0;
-    cell_index.clear();
-    edge_index.clear();
-    vertex_index.clear();
-
-    idx = 0;
-    for (auto it = cells().begin(); it != cells().end(); ++it, ++idx) {
-        cell_index[intptr_t(&(*it))] = idx;
-    }
-    idx = 0;
-    for (auto it = edges().begin(); it != edges().end(); ++it, ++idx) {
-        edge_index[intptr_t(&(*it))] = idx;
-    }
-    idx = 0;
-    for (auto it = vertices().begin(); it != vertices().end(); ++it, ++idx) {
-        vertex_index[intptr_t(&(*it))] = idx;
-    }
+    return indexOf(vertices(), vertex);
 }
 
 Voronoi::point_type
@@ -204,27 +189,31 @@ void Voronoi::construct()
                       vd->segments.begin(),
                       vd->segments.end(),
                       static_cast<voronoi_diagram_type*>(vd));
-    vd->reIndex();
 }
 
 void Voronoi::colorExterior(const Voronoi::diagram_type::edge_type* edge, std::size_t colorValue)
 {
-    if (edge->color()) {
-        // end recursion
-        return;
-    }
-    edge->color(colorValue);
-    edge->twin()->color(colorValue);
-    auto v = edge->vertex1();
-    if (!v || !edge->is_primary()) {
-        return;
+    // flood fill with an explicit stack, the exterior of a big diagram can be too deep to recurse
+    std::vector<const Voronoi::diagram_type::edge_type*> pending {edge};
+    while (!pending.empty()) {
+        edge = pending.back();
+        pending.pop_back();
+        if (edge->color()) {
+            continue;
+        }
+        edge->color(colorValue);
+        edge->twin()->color(colorValue);
+        auto v = edge->vertex1();
+        if (!v || !edge->is_primary()) {
+            continue;
+        }
+        v->color(colorValue);
+        auto e = v->incident_edge();
+        do {
+            pending.push_back(e);
+            e = e->rot_next();
+        } while (e != v->incident_edge());
     }
-    v->color(colorValue);
-    auto e = v->incident_edge();
-    do {
-        colorExterior(e, colorValue);
-        e = e->rot_next();
-    } while (e != v->incident_edge());
 }
 
 void Voronoi::colorExterior(Voronoi::color_type color)
@@ -282,6 +271,13 @@ static bool pointsMatch(const Voronoi::point_type& p0, const Voronoi::point_type
     return long(p0.x()) == long(p1.x()) && long(p0.y()) == long(p1.y());
 }
 
+static bool pointsAreClose(const Voronoi::point_type& p0,
+                           const Voronoi::point_type& p1,
+                           double scale)
+{
+    return 1e-6 > std::hypot(p0.x() - p1.x(), p0.y() - p1.y()) / scale;
+}
+
 bool Voronoi::diagram_type::segmentsAreConnected(int i, int j) const
 {
     return pointsMatch(low(segments[i]), low(segments[j]))
@@ -290,11 +286,29 @@ bool Voronoi::diagram_type::segmentsAreConnected(int i, int j) const
         || pointsMatch(high(segments[i]), high(segments[j]));
 }
 
+bool Voronoi::diagram_type::isBorderline(const Voronoi::diagram_type::edge_type* edge) const
+{
+    if (edge->is_linear()) {
+        return false;
+    }
+    const cell_type* pointCell = edge->cell()->contains_point() ? edge->cell() : edge->twin()->cell();
+    const cell_type* segmentCell =
+        edge->cell()->contains_point() ? edge->twin()->cell() : edge->cell();
+    Voronoi::point_type point = retrievePoint(pointCell);
+    Voronoi::segment_type segment = retrieveSegment(segmentCell);
+    return pointsAreClose(point, low(segment), scale)
+        || pointsAreClose(point, high(segment), scale);
+}
+
 void Voronoi::colorColinear(Voronoi::color_type color, double degree)
 {
     double rad = degree * M_PI / 180;
 
-    Voronoi::diagram_type::angle_map_t angle;
+    // the angle of every segment is needed several times
+    std::vector<double> angle(vd->segments.size());
+    for (std::size_t i = 0; i < angle.size(); i++) {
+        angle[i] = vd->angleOfSegment(int(i));
+    }
     int psize = vd->points.size();
 
     for (diagram_type::const_edge_iterator it = vd->edges().begin(); it != vd->edges().end();
@@ -303,9 +317,7 @@ void Voronoi::colorColinear(Voronoi::color_type color, double degree)
         int i1 = it->twin()->cell()->source_index() - psize;
         if (it->color() == 0 && it->cell()->contains_segment()
             && it->twin()->cell()->contains_segment() && vd->segmentsAreConnected(i0, i1)) {
-            double a0 = vd->angleOfSegment(i0, &angle);
-            double a1 = vd->angleOfSegment(i1, &angle);
-            double a = a0 - a1;
+            double a = angle[i0] - angle[i1];
             if (a > M_PI_2) {
                 a -= M_PI;
             }
@@ -320,6 +332,23 @@ void Voronoi::colorColinear(Voronoi::color_type color, double degree)
     }
 }
 
+void Voronoi::colorEdges(Voronoi::color_type primary,
+                         Voronoi::color_type secondary,
+                         Voronoi::color_type borderline)
+{
+    for (auto it = vd->edges().begin(); it != vd->edges().end(); ++it) {
+        if (!it->is_primary()) {
+            it->color(secondary);
+        }
+        else if (vd->isBorderline(&(*it))) {
+            it->color(borderline);
+        }
+        else {
+            it->color(primary);
+        }
+    }
+}
+
 void Voronoi::resetColor(Voronoi::color_type color)
 {
     for (auto it = vd->cells().begin(); it != vd->cells().end(); ++it) {
@@ -73,16 +73,10 @@ public:
         Base::Vector3d scaledVector(const point_type& p, double z) const;
         Base::Vector3d scaledVector(const vertex_type& v, double z) const;
 
-        using cell_map_type = std::map<intptr_t, int>;
-        using edge_map_type = std::map<intptr_t, int>;
-        using vertex_map_type = std::map<intptr_t, int>;
-
         int index(const cell_type* cell) const;
         int index(const edge_type* edge) const;
         int index(const vertex_type* vertex) const;
 
-        void reIndex();
-
         std::vector<point_type> points;
         std::vector<segment_type> segments;
 
@@ -92,12 +86,11 @@ public:
         using angle_map_t = std::map<int, double>;
         double angleOfSegment(int i, angle_map_t* angle = nullptr) const;
         bool segmentsAreConnected(int i, int j) const;
+        /// A curved edge between a segment and one of its own end points
+        bool isBorderline(const edge_type* edge) const;
 
     private:
         double scale;
-        cell_map_type cell_index;
-        edge_map_type edge_index;
-        vertex_map_type vertex_index;
     };
 
     void addPoint(const point_type& p);
@@ -114,6 +107,7 @@ public:
     void colorExterior(color_type color);
     void colorTwins(color_type color);
     void colorColinear(color_type color, double degree);
+    void colorEdges(color_type primary, color_type secondary, color_type borderline);
 
     template<typename T>
     T* create(int index)
@@ -184,18 +184,6 @@ bool retrieveDistances(const VoronoiEdge* edge, Py::List* list)
     return false;
 }
 
-bool pointsMatch(const Voronoi::point_type& p0, const Voronoi::point_type& p1, double scale)
-{
-    return 1e-6 > distanceBetween(p0, p1, scale);
-}
-
-bool isPointOnSegment(const Voronoi::point_type& point,
-                      const Voronoi::segment_type& segment,
-                      double scale)
-{
-    return pointsMatch(point, low(segment), scale) || pointsMatch(point, high(segment), scale);
-}
-
 template<typename T>
 PyObject* makeLineSegment(const VoronoiEdge* e, const T& p0, double z0, const T& p1, double z1)
 {
@@ -448,16 +436,8 @@ PyObject* VoronoiEdgePy::isBorderline(PyObject* args)
 {
     VoronoiEdge* e = getVoronoiEdgeFromPy(this, args);
     PyObject* chk = Py_False;
-    if (e->isBound() && !e->ptr->is_linear()) {
-        Voronoi::point_type point = e->ptr->cell()->contains_point()
-            ? e->dia->retrievePoint(e->ptr->cell())
-            : e->dia->retrievePoint(e->ptr->twin()->cell());
-        Voronoi::segment_type segment = e->ptr->cell()->contains_point()
-            ? e->dia->retrieveSegment(e->ptr->twin()->cell())
-            : e->dia->retrieveSegment(e->ptr->cell());
-        if (isPointOnSegment(point, segment, e->dia->getScale())) {
-            chk = Py_True;
-        }
+    if (e->isBound() && e->dia->isBorderline(e->ptr)) {
+        chk = Py_True;
     }
     Py_INCREF(chk);
     return chk;
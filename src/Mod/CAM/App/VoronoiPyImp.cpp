@@ -109,6 +109,27 @@ PyObject* VoronoiPy::addSegment(PyObject* args)
     return Py_None;
 }
 
+PyObject* VoronoiPy::addSegments(PyObject* args)
+{
+    PyObject* obj = nullptr;
+    if (!PyArg_ParseTuple(args, "O", &obj)) {
+        return nullptr;
+    }
+    Voronoi* vo = getVoronoiPtr();
+    Py::Sequence list(obj);
+    for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+        Py::Sequence segment(*it);
+        if (segment.size() != 2) {
+            throw Py::TypeError("Segments must be pairs of points");
+        }
+        auto p0 = getPointFromPy(segment[0].ptr());
+        auto p1 = getPointFromPy(segment[1].ptr());
+        vo->addSegment(Voronoi::segment_type(p0, p1));
+    }
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
 PyObject* VoronoiPy::construct(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -287,6 +308,20 @@ PyObject* VoronoiPy::colorColinear(PyObject* args)
     return Py_None;
 }
 
+PyObject* VoronoiPy::colorEdges(PyObject* args)
+{
+    Voronoi::color_type primary = 0;
+    Voronoi::color_type secondary = 0;
+    Voronoi::color_type borderline = 0;
+    if (!PyArg_ParseTuple(args, "kkk", &primary, &secondary, &borderline)) {
+        throw Py::RuntimeError("colorEdges requires three integer (color) arguments");
+    }
+    getVoronoiPtr()->colorEdges(primary, secondary, borderline);
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
 PyObject* VoronoiPy::resetColor(PyObject* args)
 {
     Voronoi::color_type color = 0;
@@ -300,6 +335,58 @@ PyObject* VoronoiPy::resetColor(PyObject* args)
     return Py_None;
 }
 
+PyObject* VoronoiPy::getEdgesByColor(PyObject* args)
+{
+    Voronoi::color_type color = 0;
+    if (!PyArg_ParseTuple(args, "k", &color)) {
+        throw Py::RuntimeError("getEdgesByColor requires an integer (color) argument");
+    }
+    Voronoi* vo = getVoronoiPtr();
+    Py::List list;
+    int index = 0;
+    for (auto it = vo->vd->edges().begin(); it != vo->vd->edges().end(); ++it, ++index) {
+        if ((it->color() & Voronoi::ColorMask) == color) {
+            list.append(Py::asObject(new VoronoiEdgePy(vo->create<VoronoiEdge>(index))));
+        }
+    }
+    return Py::new_reference_to(list);
+}
+
+PyObject* VoronoiPy::getEdgeVertexIndices(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        throw Py::RuntimeError("no arguments accepted");
+    }
+    Voronoi* vo = getVoronoiPtr();
+    auto vertexIndex = [vo](const Voronoi::vertex_type* v) {
+        return v ? Py::Object(Py::Long(vo->vd->index(v))) : Py::None();
+    };
+    Py::List list(vo->numEdges());
+    int index = 0;
+    for (auto it = vo->vd->edges().begin(); it != vo->vd->edges().end(); ++it, ++index) {
+        Py::Tuple tp(2);
+        tp.setItem(0, vertexIndex(it->vertex0()));
+        tp.setItem(1, vertexIndex(it->vertex1()));
+        list.setItem(index, tp);
+    }
+    return Py::new_reference_to(list);
+}
+
+PyObject* VoronoiPy::getVertexPoints(PyObject* args)
+{
+    double z = 0;
+    if (!PyArg_ParseTuple(args, "|d", &z)) {
+        throw Py::RuntimeError("Optional z argument (double) accepted");
+    }
+    Voronoi* vo = getVoronoiPtr();
+    Py::List list(vo->numVertices());
+    int index = 0;
+    for (auto it = vo->vd->vertices().begin(); it != vo->vd->vertices().end(); ++it, ++index) {
+        list.setItem(index, Py::asObject(new Base::VectorPy(vo->vd->scaledVector(*it, z))));
+    }
+    return Py::new_reference_to(list);
+}
+
 PyObject* VoronoiPy::getPoints(PyObject* args)
 {
     double z = 0;
@@ -134,3 +134,27 @@ G0 Z0.500000
         path = Path.Path(commands)
 
         self.assertEqual(path.Length, 2)
+
+    def test51(self):
+        """Test Path metrics stay up to date when the path changes"""
+        path = Path.Path([Path.Command("G0", {"Z": 5}), Path.Command("G1", {"X": 10, "Z": 5})])
+        self.assertEqual(path.Length, 15)
+        self.assertRoughly(path.getCycleTime(2, 1, 10, 5), 1 + 5)
+        self.assertEqual(path.BoundBox.XMax, 10)
+
+        path.addCommands(Path.Command("G1", {"Y": 4}))
+        self.assertEqual(path.Length, 19)
+        self.assertRoughly(path.getCycleTime(2, 1, 10, 5), 1 + 5 + 2)
+        self.assertEqual(path.BoundBox.YMax, 4)
+
+        path.deleteCommand(1)
+        self.assertEqual(path.Length, 9)
+        self.assertEqual(path.BoundBox.XMax, 0)
+
+        path.insertCommand(Path.Command("G1", {"X": -3}), 1)
+        self.assertEqual(path.Length, 12)
+        self.assertEqual(path.BoundBox.XMin, -3)
+
+        path.setFromGCode("G1 X2\nG1 Y2\n")
+        self.assertEqual(path.Length, 4)
+        self.assertEqual(path.BoundBox.ZMax, 0)
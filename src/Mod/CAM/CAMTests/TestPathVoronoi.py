@@ -188,3 +188,47 @@ class TestPathVoronoi(PathTestUtils.PathTestBase):
         )
         self.assertRoughly(e.valueAt(e.FirstParameter).z, 2.37)
         self.assertRoughly(e.valueAt(e.LastParameter).z, 5.14)
+
+    def test70(self):
+        """Check bulk accessors against the edge and vertex objects"""
+
+        edges = vd.getEdgesByColor(0)
+        self.assertEqual([e.Index for e in edges], [e.Index for e in vd.Edges if e.Color == 0])
+
+        ends = vd.getEdgeVertexIndices()
+        self.assertEqual(len(ends), vd.numEdges())
+        for e in vd.Edges:
+            indices = tuple(v.Index if v else None for v in e.Vertices)
+            self.assertEqual(ends[e.Index], indices)
+
+        points = vd.getVertexPoints(1.5)
+        self.assertEqual(len(points), vd.numVertices())
+        for v in vd.Vertices:
+            self.assertRoughly(points[v.Index].x, v.toPoint().x)
+            self.assertRoughly(points[v.Index].y, v.toPoint().y)
+            self.assertRoughly(points[v.Index].z, 1.5)
+
+    def test71(self):
+        """Check batch construction and edge classification"""
+
+        pts = [FreeCAD.Vector(p[0], p[1]) for p in [(0, 0), (2, 0), (2, 1), (0, 1)]]
+        segs = list(zip(pts, pts[1:] + pts[:1]))
+
+        single = Path.Voronoi.Diagram()
+        for p0, p1 in segs:
+            single.addSegment(p0, p1)
+        single.construct()
+        batch = Path.Voronoi.Diagram()
+        batch.addSegments(segs)
+        batch.construct()
+        self.assertEqual(batch.numSegments(), 4)
+        self.assertEqual(batch.numEdges(), single.numEdges())
+
+        batch.colorEdges(1, 2, 3)
+        for e in batch.Edges:
+            if not e.isPrimary():
+                self.assertEqual(e.Color, 2)
+            elif e.isBorderline():
+                self.assertEqual(e.Color, 3)
+            else:
+                self.assertEqual(e.Color, 1)
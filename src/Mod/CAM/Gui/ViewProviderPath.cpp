@@ -433,6 +433,10 @@ void ViewProviderPath::onChanged(const App::Property* prop)
         pcMarkerColor->rgb.setValue(c.r, c.g, c.b);
     }
     else if (prop == &ShowNodes) {
+        if (ShowNodes.getValue() && pcMarkerCoords->point.getNum() == 0
+            && pcLineCoords->point.getNum() > 0) {
+            updateVisual(true);
+        }
         pcMarkerSwitch->whichChild = ShowNodes.getValue() ? 0 : -1;
     }
     else if (prop == &ShowCount || prop == &StartIndex) {
@@ -449,7 +453,9 @@ void ViewProviderPath::onChanged(const App::Property* prop)
         if (pcLineCoords->point.getNum()) {
             const Base::Vector3d& pt = StartPosition.getValue();
             pcLineCoords->point.set1Value(0, pt.x, pt.y, pt.z);
-            pcMarkerCoords->point.set1Value(0, pt.x, pt.y, pt.z);
+            if (pcMarkerCoords->point.getNum()) {
+                pcMarkerCoords->point.set1Value(0, pt.x, pt.y, pt.z);
+            }
         }
     }
     else {
@@ -540,7 +546,8 @@ public:
                              std::deque<int>& edgeIndices_,
                              std::vector<int>& colorindex_,
                              std::deque<Base::Vector3d>& points_,
-                             std::deque<Base::Vector3d>& markers_)
+                             std::deque<Base::Vector3d>& markers_,
+                             bool collectMarkers_)
         : pcLineCoords(pcLineCoords_)
         , pcMarkerCoords(pcMarkerCoords_)
         , command2Edge(command2Edge_)
@@ -549,6 +556,7 @@ public:
         , colorindex(colorindex_)
         , points(points_)
         , markers(markers_)
+        , collectMarkers(collectMarkers_)
     {
         pcLineCoords->point.deleteValues(0);
         pcMarkerCoords->point.deleteValues(0);
@@ -565,7 +573,7 @@ public:
     void setup(const Base::Vector3d& last) override
     {
         points.push_back(last);
-        markers.push_back(last);
+        addMarker(last);
     }
 
     void g0(int id,
@@ -594,7 +602,7 @@ public:
     {
         (void)last;
         gx(id, &next, pts, 1);
-        markers.push_back(center);
+        addMarker(center);
     }
 
     void g8x(int id,
@@ -609,23 +617,23 @@ public:
         gx(id, nullptr, pts, 0);
 
         points.push_back(p[0]);
-        markers.push_back(p[0]);
+        addMarker(p[0]);
         colorindex.push_back(0);
 
         points.push_back(p[1]);
-        markers.push_back(p[1]);
+        addMarker(p[1]);
         colorindex.push_back(0);
 
         points.push_back(next);
-        markers.push_back(next);
+        addMarker(next);
         colorindex.push_back(1);
 
         for (std::deque<Base::Vector3d>::const_iterator it = q.begin(); q.end() != it; ++it) {
-            markers.push_back(*it);
+            addMarker(*it);
         }
 
         points.push_back(p[2]);
-        markers.push_back(p[2]);
+        addMarker(p[2]);
         colorindex.push_back(0);
 
         pushCommand(id);
@@ -664,6 +672,14 @@ private:
     std::vector<int>& colorindex;
     std::deque<Base::Vector3d>& points;
     std::deque<Base::Vector3d>& markers;
+    bool collectMarkers;
+
+    void addMarker(const Base::Vector3d& pt)
+    {
+        if (collectMarkers) {
+            markers.push_back(pt);
+        }
+    }
 
     virtual void
     gx(int id, const Base::Vector3d* next, const std::deque<Base::Vector3d>& pts, int color)
@@ -675,7 +691,7 @@ private:
 
         if (next) {
             points.push_back(*next);
-            markers.push_back(*next);
+            addMarker(*next);
             colorindex.push_back(color);
 
             pushCommand(id);
@@ -714,7 +730,8 @@ void ViewProviderPath::updateVisual(bool rebuild)
                                          edgeIndices,
                                          colorindex,
                                          points,
-                                         markers);
+                                         markers,
+                                         ShowNodes.getValue());
 
         PathSegmentWalker segments(tp);
         segments.walk(collect, StartPosition.getValue());
@@ -729,10 +746,14 @@ void ViewProviderPath::updateVisual(bool rebuild)
             }
             pcLineCoords->point.finishEditing();
 
+            // the nodes are only collected while they are shown, on big paths there are millions
             pcMarkerCoords->point.setNum(markers.size());
-            for (unsigned int i = 0; i < markers.size(); i++) {
-                pcMarkerCoords->point.set1Value(i, markers[i].x, markers[i].y, markers[i].z);
+            verts = pcMarkerCoords->point.startEditing();
+            i = 0;
+            for (const auto& pt : markers) {
+                verts[i++].setValue(pt.x, pt.y, pt.z);
             }
+            pcMarkerCoords->point.finishEditing();
 
             recomputeBoundingBox();
         }
@@ -800,10 +821,11 @@ void ViewProviderPath::recomputeBoundingBox()
     Path::Feature* pcPathObj = static_cast<Path::Feature*>(pcObject);
     Base::Placement pl = *(&pcPathObj->Placement.getValue());
     Base::Vector3d pt;
+    const SbVec3f* verts = pcLineCoords->point.getValues(0);
     for (int i = 1; i < pcLineCoords->point.getNum(); i++) {
-        pt.x = pcLineCoords->point[i].getValue()[0];
-        pt.y = pcLineCoords->point[i].getValue()[1];
-        pt.z = pcLineCoords->point[i].getValue()[2];
+        pt.x = verts[i][0];
+        pt.y = verts[i][1];
+        pt.z = verts[i][2];
         pl.multVec(pt, pt);
         if (pt.x < MinX) {
             MinX = pt.x;
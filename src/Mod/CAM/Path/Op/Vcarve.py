@@ -54,11 +54,11 @@ translate = FreeCAD.Qt.translate
 
 
 def _collectVoronoiWires(vd):
-    edges = [e for e in vd.Edges if e.Color == PRIMARY]
+    edges = vd.getEdgesByColor(PRIMARY)
+    ends = vd.getEdgeVertexIndices()
     vertex = {}
     for e in edges:
-        for v in e.Vertices:
-            i = v.Index
+        for i in ends[e.Index]:
             j = vertex.get(i, [])
             j.append(e)
             vertex[i] = j
@@ -77,11 +77,12 @@ def _collectVoronoiWires(vd):
         return len(vertex[v]) == 0
 
     def traverse(vStart, edge, edges):
-        if vStart == edge.Vertices[0].Index:
-            vEnd = edge.Vertices[1].Index
+        v0, v1 = ends[edge.Index]
+        if vStart == v0:
+            vEnd = v1
             edges.append(edge)
         else:
-            vEnd = edge.Vertices[0].Index
+            vEnd = v0
             edges.append(edge.Twin)
 
         consume(vStart, edge)
@@ -372,8 +373,7 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
                         del ptv[-1]
                 ptv.append(ptv[0])
 
-                for i in range(len(ptv) - 1):
-                    vd.addSegment(ptv[i], ptv[i + 1])
+                vd.addSegments(list(zip(ptv[:-1], ptv[1:])))
 
         for f in faces:
             voronoiWires = []
@@ -382,14 +382,7 @@ class ObjectVcarve(PathEngraveBase.ObjectOp):
 
             vd.construct()
 
-            for e in vd.Edges:
-                if e.isPrimary():
-                    if e.isBorderline():
-                        e.Color = BORDERLINE
-                    else:
-                        e.Color = PRIMARY
-                else:
-                    e.Color = SECONDARY
+            vd.colorEdges(PRIMARY, SECONDARY, BORDERLINE)
             vd.colorExterior(EXTERIOR1)
             vd.colorExterior(
                 EXTERIOR2,
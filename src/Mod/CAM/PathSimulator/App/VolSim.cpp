@@ -23,6 +23,9 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
 #endif
 
 #include <BRepBndLib.hxx>
@@ -56,13 +59,32 @@ cStock::cStock(float px, float py, float pz, float lx, float ly, float lz, float
             m_attr[x][y] = 0;
         }
     }
+
+    m_tx = (m_x + SIM_TILE_SIZE - 1) / SIM_TILE_SIZE;
+    m_ty = (m_y + SIM_TILE_SIZE - 1) / SIM_TILE_SIZE;
+    m_tiles.resize(m_tx * m_ty);
+    for (int ty = 0; ty < m_ty; ty++) {
+        for (int tx = 0; tx < m_tx; tx++) {
+            cStockTile& tile = m_tiles[ty * m_tx + tx];
+            tile.x0 = tx * SIM_TILE_SIZE;
+            tile.y0 = ty * SIM_TILE_SIZE;
+            tile.x1 = std::min(m_x, tile.x0 + SIM_TILE_SIZE);
+            tile.y1 = std::min(m_y, tile.y0 + SIM_TILE_SIZE);
+            tile.dirty = true;
+        }
+    }
 }
 
 cStock::~cStock()
 {}
 
 
-float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz)
+float cStock::FindRectTop(const cStockTile& tile,
+                          int& xp,
+                          int& yp,
+                          int& x_size,
+                          int& y_size,
+                          bool scanHoriz)
 {
     float z = m_stock[xp][yp];
     bool xr_ok = true;
@@ -75,7 +97,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep right x direction
         if (xr_ok) {
             int tx = xp + x_size;
-            if (tx >= m_x) {
+            if (tx >= tile.x1) {
                 xr_ok = false;
             }
             else {
@@ -94,7 +116,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep left x direction
         if (xl_ok) {
             int tx = xp - 1;
-            if (tx < 0) {
+            if (tx < tile.x0) {
                 xl_ok = false;
             }
             else {
@@ -114,7 +136,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep up y direction
         if (yu_ok) {
             int ty = yp + y_size;
-            if (ty >= m_y) {
+            if (ty >= tile.y1) {
                 yu_ok = false;
             }
             else {
@@ -133,7 +155,7 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
         // sweep down y direction
         if (yd_ok) {
             int ty = yp - 1;
-            if (ty < 0) {
+            if (ty < tile.y0) {
                 yd_ok = false;
             }
             else {
@@ -153,21 +175,21 @@ float cStock::FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanH
     return z;
 }
 
-int cStock::TesselTop(int xp, int yp)
+int cStock::TesselTop(cStockTile& tile, int xp, int yp)
 {
     int x_size, y_size;
-    float z = FindRectTop(xp, yp, x_size, y_size, true);
+    float z = FindRectTop(tile, xp, yp, x_size, y_size, true);
     bool farRect = false;
     while (y_size / x_size > 5) {
         farRect = true;
         yp += x_size * 5;
-        z = FindRectTop(xp, yp, x_size, y_size, true);
+        z = FindRectTop(tile, xp, yp, x_size, y_size, true);
     }
 
     while (x_size / y_size > 5) {
         farRect = true;
         xp += y_size * 5;
-        z = FindRectTop(xp, yp, x_size, y_size, false);
+        z = FindRectTop(tile, xp, yp, x_size, y_size, false);
     }
 
     // mark all points inside
@@ -184,10 +206,10 @@ int cStock::TesselTop(int xp, int yp)
         Point3D ptl(xp, yp + y_size, z);
         Point3D ptr(xp + x_size, yp + y_size, z);
         if (fabs(m_pz + m_lz - z) < SIM_EPSILON) {
-            AddQuad(pbl, pbr, ptr, ptl, facetsOuter);
+            AddQuad(pbl, pbr, ptr, ptl, tile.facetsOuter);
         }
         else {
-            AddQuad(pbl, pbr, ptr, ptl, facetsInner);
+            AddQuad(pbl, pbr, ptr, ptl, tile.facetsInner);
         }
     }
 
@@ -199,7 +221,12 @@ int cStock::TesselTop(int xp, int yp)
 }
 
 
-void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz)
+void cStock::FindRectBot(const cStockTile& tile,
+                         int& xp,
+                         int& yp,
+                         int& x_size,
+                         int& y_size,
+                         bool scanHoriz)
 {
     bool xr_ok = true;
     bool xl_ok = scanHoriz;
@@ -211,7 +238,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep right x direction
         if (xr_ok) {
             int tx = xp + x_size;
-            if (tx >= m_x) {
+            if (tx >= tile.x1) {
                 xr_ok = false;
             }
             else {
@@ -230,7 +257,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep left x direction
         if (xl_ok) {
             int tx = xp - 1;
-            if (tx < 0) {
+            if (tx < tile.x0) {
                 xl_ok = false;
             }
             else {
@@ -250,7 +277,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep up y direction
         if (yu_ok) {
             int ty = yp + y_size;
-            if (ty >= m_y) {
+            if (ty >= tile.y1) {
                 yu_ok = false;
             }
             else {
@@ -269,7 +296,7 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
         // sweep down y direction
         if (yd_ok) {
             int ty = yp - 1;
-            if (ty < 0) {
+            if (ty < tile.y0) {
                 yd_ok = false;
             }
             else {
@@ -289,21 +316,21 @@ void cStock::FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHo
 }
 
 
-int cStock::TesselBot(int xp, int yp)
+int cStock::TesselBot(cStockTile& tile, int xp, int yp)
 {
     int x_size, y_size;
-    FindRectBot(xp, yp, x_size, y_size, true);
+    FindRectBot(tile, xp, yp, x_size, y_size, true);
     bool farRect = false;
     while (y_size / x_size > 5) {
         farRect = true;
         yp += x_size * 5;
-        FindRectTop(xp, yp, x_size, y_size, true);
+        FindRectTop(tile, xp, yp, x_size, y_size, true);
     }
 
     while (x_size / y_size > 5) {
         farRect = true;
         xp += y_size * 5;
-        FindRectTop(xp, yp, x_size, y_size, false);
+        FindRectTop(tile, xp, yp, x_size, y_size, false);
     }
 
     // mark all points inside
@@ -318,7 +345,7 @@ int cStock::TesselBot(int xp, int yp)
     Point3D pbr(xp + x_size, yp, m_pz);
     Point3D ptl(xp, yp + y_size, m_pz);
     Point3D ptr(xp + x_size, yp + y_size, m_pz);
-    AddQuad(pbl, ptl, ptr, pbr, facetsOuter);
+    AddQuad(pbl, ptl, ptr, pbr, tile.facetsOuter);
 
     if (farRect) {
         return -1;
@@ -328,36 +355,37 @@ int cStock::TesselBot(int xp, int yp)
 }
 
 
-int cStock::TesselSidesX(int yp)
+int cStock::TesselSidesX(cStockTile& tile, int yp)
 {
     float lastz1 = m_pz;
     if (yp < m_y) {
-        lastz1 = std::max(m_stock[0][yp], m_pz);
+        lastz1 = std::max(m_stock[tile.x0][yp], m_pz);
     }
     float lastz2 = m_pz;
     if (yp > 0) {
-        lastz2 = std::max(m_stock[0][yp - 1], m_pz);
+        lastz2 = std::max(m_stock[tile.x0][yp - 1], m_pz);
     }
 
-    std::vector<MeshCore::MeshGeomFacet>* facets = &facetsInner;
+    std::vector<MeshCore::MeshGeomFacet>* facets = &tile.facetsInner;
     if (yp == 0 || yp == m_y) {
-        facets = &facetsOuter;
+        facets = &tile.facetsOuter;
     }
 
     // bool lastzclip = (lastz - m_pz) < m_res;
-    int lastpoint = 0;
-    for (int x = 1; x <= m_x; x++) {
+    int lastpoint = tile.x0;
+    for (int x = tile.x0 + 1; x <= tile.x1; x++) {
         float newz1 = m_pz;
-        if (yp < m_y && x < m_x) {
+        if (yp < m_y && x < tile.x1) {
             newz1 = std::max(m_stock[x][yp], m_pz);
         }
         float newz2 = m_pz;
-        if (yp > 0 && x < m_x) {
+        if (yp > 0 && x < tile.x1) {
             newz2 = std::max(m_stock[x][yp - 1], m_pz);
         }
 
         if (fabs(lastz1 - lastz2) > m_res) {
-            if (fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
+            // the side is always closed at the end of the tile
+            if (x < tile.x1 && fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
                 continue;
             }
             Point3D pbl(lastpoint, yp, lastz1);
@@ -373,36 +401,37 @@ int cStock::TesselSidesX(int yp)
     return 0;
 }
 
-int cStock::TesselSidesY(int xp)
+int cStock::TesselSidesY(cStockTile& tile, int xp)
 {
     float lastz1 = m_pz;
     if (xp < m_x) {
-        lastz1 = std::max(m_stock[xp][0], m_pz);
+        lastz1 = std::max(m_stock[xp][tile.y0], m_pz);
     }
     float lastz2 = m_pz;
     if (xp > 0) {
-        lastz2 = std::max(m_stock[xp - 1][0], m_pz);
+        lastz2 = std::max(m_stock[xp - 1][tile.y0], m_pz);
     }
 
-    std::vector<MeshCore::MeshGeomFacet>* facets = &facetsInner;
+    std::vector<MeshCore::MeshGeomFacet>* facets = &tile.facetsInner;
     if (xp == 0 || xp == m_x) {
-        facets = &facetsOuter;
+        facets = &tile.facetsOuter;
     }
 
     // bool lastzclip = (lastz - m_pz) < m_res;
-    int lastpoint = 0;
-    for (int y = 1; y <= m_y; y++) {
+    int lastpoint = tile.y0;
+    for (int y = tile.y0 + 1; y <= tile.y1; y++) {
         float newz1 = m_pz;
-        if (xp < m_x && y < m_y) {
+        if (xp < m_x && y < tile.y1) {
             newz1 = std::max(m_stock[xp][y], m_pz);
         }
         float newz2 = m_pz;
-        if (xp > 0 && y < m_y) {
+        if (xp > 0 && y < tile.y1) {
             newz2 = std::max(m_stock[xp - 1][y], m_pz);
         }
 
         if (fabs(lastz1 - lastz2) > m_res) {
-            if (fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
+            // the side is always closed at the end of the tile
+            if (y < tile.y1 && fabs(newz1 - lastz1) < m_res && fabs(newz2 - lastz2) < m_res) {
                 continue;
             }
             Point3D pbr(xp, lastpoint, lastz1);
@@ -445,46 +474,92 @@ void cStock::AddQuad(Point3D& p1,
     facets.push_back(facet);
 }
 
-void cStock::Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner)
+void cStock::TessellateTile(cStockTile& tile)
 {
     // reset attribs
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
+    for (int y = tile.y0; y < tile.y1; y++) {
+        for (int x = tile.x0; x < tile.x1; x++) {
             m_attr[x][y] = 0;
         }
     }
 
-    facetsOuter.clear();
-    facetsInner.clear();
+    tile.facetsOuter.clear();
+    tile.facetsInner.clear();
 
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
+    for (int y = tile.y0; y < tile.y1; y++) {
+        for (int x = tile.x0; x < tile.x1; x++) {
             int attr = m_attr[x][y];
             if ((attr & SIM_TESSEL_TOP) == 0) {
-                x += TesselTop(x, y);
+                x += TesselTop(tile, x, y);
             }
         }
     }
-    for (int y = 0; y < m_y; y++) {
-        for (int x = 0; x < m_x; x++) {
+    for (int y = tile.y0; y < tile.y1; y++) {
+        for (int x = tile.x0; x < tile.x1; x++) {
             if ((m_stock[x][y] - m_pz) < m_res) {
                 m_attr[x][y] |= SIM_TESSEL_BOT;
             }
             if ((m_attr[x][y] & SIM_TESSEL_BOT) == 0) {
-                x += TesselBot(x, y);
+                x += TesselBot(tile, x, y);
             }
         }
     }
-    for (int y = 0; y <= m_y; y++) {
-        TesselSidesX(y);
+
+    // a tile owns the sides at its lower edges, the last tiles also the outer sides
+    int ye = tile.y1 == m_y ? m_y : tile.y1 - 1;
+    for (int y = tile.y0; y <= ye; y++) {
+        TesselSidesX(tile, y);
+    }
+    int xe = tile.x1 == m_x ? m_x : tile.x1 - 1;
+    for (int x = tile.x0; x <= xe; x++) {
+        TesselSidesY(tile, x);
     }
-    for (int x = 0; x <= m_x; x++) {
-        TesselSidesY(x);
+    tile.dirty = false;
+}
+
+void cStock::Tessellate(Mesh::MeshObject& meshOuter, Mesh::MeshObject& meshInner)
+{
+    std::vector<cStockTile*> dirtyTiles;
+    for (auto& tile : m_tiles) {
+        if (tile.dirty) {
+            dirtyTiles.push_back(&tile);
+        }
+    }
+
+    // Tiles only write their own attribs and facets, so they can be tessellated in parallel
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < dirtyTiles.size(); i = next++) {
+            TessellateTile(*dirtyTiles[i]);
+        }
+    };
+    std::size_t numThreads =
+        std::min<std::size_t>(std::max(1U, std::thread::hardware_concurrency()), dirtyTiles.size());
+    std::vector<std::future<void>> workers;
+    for (std::size_t i = 1; i < numThreads; i++) {
+        workers.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : workers) {
+        future.get();
+    }
+
+    std::size_t numOuter = 0;
+    std::size_t numInner = 0;
+    for (const auto& tile : m_tiles) {
+        numOuter += tile.facetsOuter.size();
+        numInner += tile.facetsInner.size();
+    }
+    std::vector<MeshCore::MeshGeomFacet> facetsOuter;
+    std::vector<MeshCore::MeshGeomFacet> facetsInner;
+    facetsOuter.reserve(numOuter);
+    facetsInner.reserve(numInner);
+    for (const auto& tile : m_tiles) {
+        facetsOuter.insert(facetsOuter.end(), tile.facetsOuter.begin(), tile.facetsOuter.end());
+        facetsInner.insert(facetsInner.end(), tile.facetsInner.begin(), tile.facetsInner.end());
     }
     meshOuter.addFacets(facetsOuter);
     meshInner.addFacets(facetsInner);
-    facetsOuter.clear();
-    facetsInner.clear();
 }
 
 
@@ -501,9 +576,7 @@ void cStock::CreatePocket(float cxf, float cyf, float radf, float height)
     for (int y = ys; y < ye; y++) {
         for (int x = xs; x < xe; x++) {
             if (((x - cx) * (x - cx) + (y - cy) * (y - cy)) < drad) {
-                if (m_stock[x][y] > height) {
-                    m_stock[x][y] = height;
-                }
+                SetMinHeight(x, y, height);
             }
         }
     }
@@ -540,11 +613,7 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
             for (int i = 0; i < lenSteps; i++) {
                 int x = (int)p.x;
                 int y = (int)p.y;
-                if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                    if (m_stock[x][y] > z) {
-                        m_stock[x][y] = z;
-                    }
-                }
+                SetMinHeight(x, y, z);
                 p.Add(mainWay);
                 z += zstep;
             }
@@ -565,11 +634,7 @@ void cStock::ApplyLinearTool(Point3D& p1, Point3D& p2, cSimTool& tool)
         for (float a = 0; a < cupAngle; a += rotang) {
             int x = (int)(pi2.x + cupCirc.x);
             int y = (int)(pi2.y + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
-            }
+            SetMinHeight(x, y, z);
             cupCirc.Rotate();
         }
     }
@@ -627,11 +692,7 @@ void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool
         for (int i = 0; i < ndivs; i++) {
             int x = (int)(cpx + cupCirc.x);
             int y = (int)(cpy + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
-            }
+            SetMinHeight(x, y, z);
             z += zstep;
             cupCirc.Rotate();
         }
@@ -653,11 +714,7 @@ void cStock::ApplyCircularTool(Point3D& p1, Point3D& p2, Point3D& cent, cSimTool
         for (int i = 0; i < ndivs; i++) {
             int x = (int)(pi2.x + cupCirc.x);
             int y = (int)(pi2.y + cupCirc.y);
-            if (x >= 0 && y >= 0 && x < m_x && y < m_y) {
-                if (m_stock[x][y] > z) {
-                    m_stock[x][y] = z;
-                }
-            }
+            SetMinHeight(x, y, z);
             cupCirc.Rotate();
         }
     }
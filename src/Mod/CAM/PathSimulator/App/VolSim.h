@@ -36,6 +36,7 @@
 #define SIM_TESSEL_BOT 2
 #define SIM_WALK_RES                                                                               \
     0.6  // step size in pixel units (to make sure all pixels in the path are visited)
+#define SIM_TILE_SIZE 32  // size of the tessellation tiles in pixel units
 
 struct toolShapePoint
 {
@@ -218,6 +219,16 @@ private:
     int height;
 };
 
+/* A rectangular block of the stock array. The facets of the stock are kept per tile, so only
+   the tiles touched by the tool since the last call have to be tessellated again */
+struct cStockTile
+{
+    int x0, y0, x1, y1;  // pixel range [x0, x1) x [y0, y1)
+    bool dirty;
+    std::vector<MeshCore::MeshGeomFacet> facetsOuter;
+    std::vector<MeshCore::MeshGeomFacet> facetsInner;
+};
+
 class cStock
 {
 public:
@@ -233,18 +244,45 @@ public:
     }
 
 private:
-    float FindRectTop(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
-    void FindRectBot(int& xp, int& yp, int& x_size, int& y_size, bool scanHoriz);
+    inline void SetMinHeight(int x, int y, float z)
+    {
+        if (x >= 0 && y >= 0 && x < m_x && y < m_y && m_stock[x][y] > z) {
+            m_stock[x][y] = z;
+            // the sides between this pixel and its upper neighbours belong to the next tiles
+            int tx = x / SIM_TILE_SIZE;
+            int ty = y / SIM_TILE_SIZE;
+            m_tiles[ty * m_tx + tx].dirty = true;
+            if (x + 1 < m_x && (x + 1) % SIM_TILE_SIZE == 0) {
+                m_tiles[ty * m_tx + tx + 1].dirty = true;
+            }
+            if (y + 1 < m_y && (y + 1) % SIM_TILE_SIZE == 0) {
+                m_tiles[(ty + 1) * m_tx + tx].dirty = true;
+            }
+        }
+    }
+    void TessellateTile(cStockTile& tile);
+    float FindRectTop(const cStockTile& tile,
+                      int& xp,
+                      int& yp,
+                      int& x_size,
+                      int& y_size,
+                      bool scanHoriz);
+    void FindRectBot(const cStockTile& tile,
+                     int& xp,
+                     int& yp,
+                     int& x_size,
+                     int& y_size,
+                     bool scanHoriz);
     void SetFacetPoints(MeshCore::MeshGeomFacet& facet, Point3D& p1, Point3D& p2, Point3D& p3);
     void AddQuad(Point3D& p1,
                  Point3D& p2,
                  Point3D& p3,
                  Point3D& p4,
                  std::vector<MeshCore::MeshGeomFacet>& facets);
-    int TesselTop(int x, int y);
-    int TesselBot(int x, int y);
-    int TesselSidesX(int yp);
-    int TesselSidesY(int xp);
+    int TesselTop(cStockTile& tile, int x, int y);
+    int TesselBot(cStockTile& tile, int x, int y);
+    int TesselSidesX(cStockTile& tile, int yp);
+    int TesselSidesY(cStockTile& tile, int xp);
     Array2D<float> m_stock;
     Array2D<char> m_attr;
     float m_px, m_py, m_pz;  // stock zero position
@@ -252,8 +290,8 @@ private:
     float m_res;             // resoulution
     float m_plane;           // stock plane height
     int m_x, m_y;            // stock array size
-    std::vector<MeshCore::MeshGeomFacet> facetsOuter;
-    std::vector<MeshCore::MeshGeomFacet> facetsInner;
+    int m_tx, m_ty;          // tile array size
+    std::vector<cStockTile> m_tiles;
 };
 
 class cVolSim
@@ -25,6 +25,7 @@
 #include "SimShapes.h"
 #include "linmath.h"
 #include "GlUtils.h"
+#include <algorithm>
 #include <iostream>
 
 #define N_MILL_SLICES 8
@@ -131,6 +132,39 @@ MillPathSegment::MillPathSegment(EndMill* _endmill, MillMotion* from, MillMotion
             mShearMat[0][2] = mDiff[PZ] / mXYDistance;
         }
     }
+    CalcBoundBox();
+}
+
+void MillPathSegment::CalcBoundBox()
+{
+    // extents of the tool around its tip
+    float toolRadius = endmill->radius;
+    float toolBottom = 0;
+    float toolTop = MILL_HEIGHT;
+    for (std::size_t i = 0; i + 1 < endmill->profilePoints.size(); i += 2) {
+        toolRadius = std::max(toolRadius, fabsf(endmill->profilePoints[i]));
+        toolBottom = std::min(toolBottom, endmill->profilePoints[i + 1]);
+        toolTop = std::max(toolTop, endmill->profilePoints[i + 1]);
+    }
+
+    // extents of the tool tip along the path, the whole circle for arcs
+    for (int i = 0; i < 3; i++) {
+        mBoundMin[i] = std::min(mStartPos[i], mStartPos[i] + mDiff[i]);
+        mBoundMax[i] = std::max(mStartPos[i], mStartPos[i] + mDiff[i]);
+    }
+    if (mMotionType == MTCurved) {
+        for (int i = PX; i <= PY; i++) {
+            mBoundMin[i] = std::min(mBoundMin[i], mCenter[i] - mRadius);
+            mBoundMax[i] = std::max(mBoundMax[i], mCenter[i] + mRadius);
+        }
+    }
+
+    for (int i = PX; i <= PY; i++) {
+        mBoundMin[i] -= toolRadius;
+        mBoundMax[i] += toolRadius;
+    }
+    mBoundMin[PZ] += toolBottom;
+    mBoundMax[PZ] += toolTop;
 }
 
 MillPathSegment::~MillPathSegment()
@@ -217,6 +251,16 @@ void MillPathSegment::render(int step)
     }
 }
 
+bool MillPathSegment::IntersectsBox(const vec3 boxMin, const vec3 boxMax)
+{
+    for (int i = 0; i < 3; i++) {
+        if (mBoundMin[i] > boxMax[i] + EPSILON || mBoundMax[i] < boxMin[i] - EPSILON) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void MillPathSegment::GetHeadPosition(vec3 headPos)
 {
     if (mMotionType == MTCurved) {
@@ -58,6 +58,8 @@ public:
     virtual void AppendPathPoints(std::vector<MillPathPosition>& pointsBuffer);
     virtual void render(int substep);
     virtual void GetHeadPosition(vec3 headPos);
+    /// Tells if the tool touches the given box anywhere along the segment
+    bool IntersectsBox(const vec3 boxMin, const vec3 boxMax);
     static float SetQuality(float quality, float maxStockDimension);  // 1 minimum, 10 maximum
 
 public:
@@ -92,7 +94,12 @@ protected:
     vec3 mCenter = {0};
     vec3 mStartPos;
     vec3 mHeadPos = {0};
+    vec3 mBoundMin;
+    vec3 mBoundMax;
     MotionType mMotionType;
+
+private:
+    void CalcBoundBox();
 };
 }  // namespace MillSim
 
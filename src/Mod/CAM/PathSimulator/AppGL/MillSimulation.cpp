@@ -22,6 +22,7 @@
 
 #include "MillSimulation.h"
 #include "OpenGlWrapper.h"
+#include <algorithm>
 #include <vector>
 #include <iostream>
 
@@ -47,6 +48,7 @@ void MillSimulation::ClearMillPathSegments()
         delete MillPathSegments[i];
     }
     MillPathSegments.clear();
+    mCuttingSegments.clear();
 }
 
 void MillSimulation::Clear()
@@ -115,10 +117,26 @@ void MillSimulation::InitSimulation(float quality)
         }
     }
     mNPathSteps = (int)MillPathSegments.size();
+    FindCuttingSegments();
     millPathLine.GenerateModel();
     InitDisplay(quality);
 }
 
+void MillSimulation::FindCuttingSegments()
+{
+    // segments that stay clear of the stock box can not remove any material, leave them out
+    // of the CSG passes as they would make every frame slower for nothing
+    mCuttingSegments.clear();
+    vec3 stockMax;
+    vec3_add(stockMax, mStockObject.position, mStockObject.size);
+    bool hasStock = mStockObject.size[0] > 0 || mStockObject.size[1] > 0;
+    for (int i = 0; i < (int)MillPathSegments.size(); i++) {
+        if (!hasStock || MillPathSegments[i]->IntersectsBox(mStockObject.position, stockMax)) {
+            mCuttingSegments.push_back(i);
+        }
+    }
+}
+
 EndMill* MillSimulation::GetTool(int toolId)
 {
     for (unsigned int i = 0; i < mToolTable.size(); i++) {
@@ -276,20 +294,28 @@ void MillSimulation::RenderSimulation()
 
     GlsimToolStep2();
 
-    for (int i = 0; i <= mPathStep; i++) {
-        renderSegmentForward(i);
+    // number of cutting segments up to the current one, and before it
+    auto curSeg = std::lower_bound(mCuttingSegments.begin(), mCuttingSegments.end(), mPathStep);
+    int nPrevSegs = (int)(curSeg - mCuttingSegments.begin());
+    int nSegs = nPrevSegs;
+    if (curSeg != mCuttingSegments.end() && *curSeg == mPathStep) {
+        nSegs++;
+    }
+
+    for (int i = 0; i < nSegs; i++) {
+        renderSegmentForward(mCuttingSegments[i]);
     }
 
-    for (int i = mPathStep; i >= 0; i--) {
-        renderSegmentForward(i);
+    for (int i = nSegs - 1; i >= 0; i--) {
+        renderSegmentForward(mCuttingSegments[i]);
     }
 
-    for (int i = 0; i < mPathStep; i++) {
-        renderSegmentReversed(i);
+    for (int i = 0; i < nPrevSegs; i++) {
+        renderSegmentReversed(mCuttingSegments[i]);
     }
 
-    for (int i = mPathStep; i >= 0; i--) {
-        renderSegmentReversed(i);
+    for (int i = nSegs - 1; i >= 0; i--) {
+        renderSegmentReversed(mCuttingSegments[i]);
     }
 
     GlsimClipBack();
@@ -303,12 +329,13 @@ void MillSimulation::RenderSimulation()
     // render cuts (back faces of tools)
     simDisplay.StartGeometryPass(cutColor, true);
     GlsimRenderTools();
-    for (int i = 0; i <= mPathStep; i++) {
+    for (int k = 0; k < nSegs; k++) {
+        int i = mCuttingSegments[k];
         MillSim::MillPathSegment* p = MillPathSegments.at(i);
         int step = (i == mPathStep) ? mSubStep : p->numSimSteps;
         int start = p->isMultyPart ? 1 : step;
         for (int j = start; j <= step; j++) {
-            MillPathSegments.at(i)->render(j);
+            p->render(j);
         }
     }
 
@@ -518,12 +545,14 @@ void MillSimulation::SetBoxStock(float x, float y, float z, float l, float w, fl
 {
     mStockObject.GenerateBoxStock(x, y, z, l, w, h);
     simDisplay.ScaleViewToStock(&mStockObject);
+    FindCuttingSegments();
 }
 
 void MillSimulation::SetArbitraryStock(std::vector<Vertex>& verts, std::vector<GLushort>& indices)
 {
     mStockObject.GenerateSolid(verts, indices);
     simDisplay.ScaleViewToStock(&mStockObject);
+    FindCuttingSegments();
 }
 
 void MillSimulation::SetBaseObject(std::vector<Vertex>& verts, std::vector<GLushort>& indices)
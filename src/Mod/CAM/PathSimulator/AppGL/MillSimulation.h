@@ -94,6 +94,7 @@ protected:
     void renderSegmentForward(int iSeg);
     void renderSegmentReversed(int iSeg);
     void CalcSegmentPositions();
+    void FindCuttingSegments();
     EndMill* GetTool(int tool);
     void RemoveTool(int toolId);
 
@@ -105,6 +106,7 @@ protected:
     SimDisplay simDisplay;
     MillPathLine millPathLine;
     std::vector<MillPathSegment*> MillPathSegments;
+    std::vector<int> mCuttingSegments;  // indices of the segments that touch the stock
     std::ostringstream mFpsStream;
 
     MillMotion mZeroPos = {eNop, -1, 0, 0, 100, 0, 0, 0, 0};
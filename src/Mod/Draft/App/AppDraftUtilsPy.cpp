@@ -21,9 +21,17 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#endif
 
 #include <Base/Console.h>
+#include <Base/GeometryPyCXX.h>
 #include <Base/Interpreter.h>
+#include <Base/PlacementPy.h>
+#include <Base/Tools.h>
+#include <Base/VectorPy.h>
 
 
 namespace DraftUtils {
@@ -39,6 +47,18 @@ public:
             "NOTE: DraftUtils.readDXF is removed. "
             "Use Import.readDxf instead."
         );
+        add_varargs_method("rectPlacements",&Module::rectPlacements,
+            "rectPlacements(placement,xvector,yvector,zvector,xnum,ynum,znum): "
+            "Returns the placements of the copies of an orthogonal array."
+        );
+        add_varargs_method("polarPlacements",&Module::polarPlacements,
+            "polarPlacements(placement,center,angle,number,axis,[axisvector]): "
+            "Returns the placements of the copies of a polar array."
+        );
+        add_varargs_method("circPlacements",&Module::circPlacements,
+            "circPlacements(placement,rdistance,tdistance,axis,center,circles,symmetry): "
+            "Returns the placements of the copies of a circular array."
+        );
         initialize("The DraftUtils module contains utility functions for the Draft module."); // register with Python
     }
 
@@ -49,6 +69,175 @@ private:
                                 "Use Import.readDxf instead.\n");
         return Py::None();
     }
+
+    static Py::List toList(const std::vector<Base::Placement>& placements)
+    {
+        Py::List list(placements.size());
+        for (std::size_t i = 0; i < placements.size(); i++) {
+            list.setItem(i, Py::Placement(placements[i]));
+        }
+        return list;
+    }
+
+    // The placements are computed the same way as by the functions of draftobjects.array
+    Py::Object rectPlacements(const Py::Tuple& args)
+    {
+        PyObject* pyPla {};
+        PyObject* pyVecX {};
+        PyObject* pyVecY {};
+        PyObject* pyVecZ {};
+        int numX {};
+        int numY {};
+        int numZ {};
+        if (!PyArg_ParseTuple(args.ptr(), "O!O!O!O!iii",
+                              &Base::PlacementPy::Type, &pyPla,
+                              &Base::VectorPy::Type, &pyVecX,
+                              &Base::VectorPy::Type, &pyVecY,
+                              &Base::VectorPy::Type, &pyVecZ,
+                              &numX, &numY, &numZ)) {
+            throw Py::Exception();
+        }
+
+        const Base::Placement& pla = *static_cast<Base::PlacementPy*>(pyPla)->getPlacementPtr();
+        Base::Vector3d vecX = Py::Vector(pyVecX, false).toVector();
+        Base::Vector3d vecY = Py::Vector(pyVecY, false).toVector();
+        Base::Vector3d vecZ = Py::Vector(pyVecZ, false).toVector();
+
+        std::vector<Base::Placement> placements;
+        placements.reserve(std::size_t(std::max(numX, 1)) * std::max(numY, 1)
+                           * std::max(numZ, 1));
+        placements.push_back(pla);
+        auto addCopy = [&placements, &pla](const Base::Vector3d& offset) {
+            placements.push_back(pla);
+            placements.back().move(offset);
+        };
+
+        for (int x = 0; x < numX; x++) {
+            Base::Vector3d offsetX = vecX * x;
+            if (x != 0) {
+                addCopy(offsetX);
+            }
+            for (int y = 0; y < numY; y++) {
+                Base::Vector3d offsetY = offsetX + vecY * y;
+                if (y != 0) {
+                    addCopy(offsetY);
+                }
+                for (int z = 1; z < numZ; z++) {
+                    addCopy(offsetY + vecZ * z);
+                }
+            }
+        }
+
+        return toList(placements);
+    }
+
+    Py::Object polarPlacements(const Py::Tuple& args)
+    {
+        PyObject* pyPla {};
+        PyObject* pyCenter {};
+        PyObject* pyAxis {};
+        PyObject* pyAxisVec = Py_None;
+        double angle {};
+        int number {};
+        if (!PyArg_ParseTuple(args.ptr(), "O!O!diO!|O",
+                              &Base::PlacementPy::Type, &pyPla,
+                              &Base::VectorPy::Type, &pyCenter,
+                              &angle, &number,
+                              &Base::VectorPy::Type, &pyAxis,
+                              &pyAxisVec)) {
+            throw Py::Exception();
+        }
+
+        const Base::Placement& pla = *static_cast<Base::PlacementPy*>(pyPla)->getPlacementPtr();
+        Base::Vector3d center = Py::Vector(pyCenter, false).toVector();
+        Base::Vector3d axis = Py::Vector(pyAxis, false).toVector();
+        // a null vector for the axis offset is filtered out by the caller
+        Base::Vector3d axisVec;
+        bool hasAxisVec = pyAxisVec != Py_None;
+        if (hasAxisVec) {
+            axisVec = Py::Vector(pyAxisVec, false).toVector();
+        }
+
+        std::vector<Base::Placement> placements;
+        placements.reserve(std::max(number, 1));
+        placements.push_back(pla);
+        if (number <= 1) {
+            return toList(placements);
+        }
+
+        double fraction = angle == 360.0 ? angle / number : angle / (number - 1);
+        for (int i = 0; i < number - 1; i++) {
+            double current = fraction + i * fraction;
+            Base::Placement copy(pla);
+            copy.multLeft(Base::Placement(Base::Vector3d(),
+                                          Base::Rotation(axis, Base::toRadians(current)),
+                                          center));
+            if (hasAxisVec) {
+                copy.move(axisVec * (i + 1));
+            }
+            placements.push_back(copy);
+        }
+
+        return toList(placements);
+    }
+
+    Py::Object circPlacements(const Py::Tuple& args)
+    {
+        PyObject* pyPla {};
+        PyObject* pyAxis {};
+        PyObject* pyCenter {};
+        double radialDistance {};
+        double tangentialDistance {};
+        int circles {};
+        int symmetry {};
+        if (!PyArg_ParseTuple(args.ptr(), "O!ddO!O!ii",
+                              &Base::PlacementPy::Type, &pyPla,
+                              &radialDistance, &tangentialDistance,
+                              &Base::VectorPy::Type, &pyAxis,
+                              &Base::VectorPy::Type, &pyCenter,
+                              &circles, &symmetry)) {
+            throw Py::Exception();
+        }
+        if (tangentialDistance == 0.0) {
+            throw Py::ZeroDivisionError("The tangential distance must not be zero");
+        }
+
+        const Base::Placement& pla = *static_cast<Base::PlacementPy*>(pyPla)->getPlacementPtr();
+        Base::Vector3d axis = Py::Vector(pyAxis, false).toVector();
+        Base::Vector3d center = Py::Vector(pyCenter, false).toVector();
+        symmetry = std::max(1, symmetry);
+
+        Base::Vector3d lead(0, 1, 0);
+        if (axis.x == 0.0 && axis.z == 0.0) {
+            lead = Base::Vector3d(1, 0, 0);
+        }
+        Base::Vector3d direction = axis.Cross(lead).Normalize();
+
+        std::vector<Base::Placement> placements;
+        placements.push_back(pla);
+        for (int i = 1; i < circles; i++) {
+            double radius = i * radialDistance;
+            Base::Vector3d offset = direction * radius;
+            double count = std::floor(2 * radius * M_PI / tangentialDistance);
+            int number = int(std::floor(count / symmetry) * symmetry);
+            if (number <= 0) {
+                continue;
+            }
+
+            double angle = 360.0 / number;
+            placements.reserve(placements.size() + number);
+            for (int j = 0; j < number; j++) {
+                Base::Placement copy(pla);
+                copy.move(offset);
+                copy.multLeft(Base::Placement(Base::Vector3d(),
+                                              Base::Rotation(axis, Base::toRadians(j * angle)),
+                                              center));
+                placements.push_back(copy);
+            }
+        }
+
+        return toList(placements);
+    }
 };
 
 PyObject* initModule()
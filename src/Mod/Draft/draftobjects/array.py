@@ -44,6 +44,11 @@ from draftutils.translate import translate
 
 from draftobjects.draftlink import DraftLink
 
+try:
+    import DraftUtils
+except ImportError:
+    DraftUtils = None
+
 
 class Array(DraftLink):
     """The Draft Array object.
@@ -449,6 +454,11 @@ def rect_placements(base_placement,
                     xvector, yvector, zvector,
                     xnum, ynum, znum):
     """Determine the placements where the rectangular copies will be."""
+    if DraftUtils:
+        return DraftUtils.rectPlacements(base_placement,
+                                         xvector, yvector, zvector,
+                                         xnum, ynum, znum)
+
     pl = base_placement
     placements = [pl.copy()]
 
@@ -485,6 +495,13 @@ def polar_placements(base_placement,
                      number, axis, axisvector):
     """Determine the placements where the polar copies will be."""
     # print("angle ",angle," num ",num)
+    if DraftUtils:
+        if axisvector and DraftVecUtils.isNull(axisvector):
+            axisvector = None
+        return DraftUtils.polarPlacements(base_placement,
+                                          center, angle,
+                                          number, axis, axisvector)
+
     placements = [base_placement.copy()]
 
     if number <= 1:
@@ -512,6 +529,12 @@ def circ_placements(base_placement,
                     axis, center,
                     circle_number, symmetry):
     """Determine the placements where the circular copies will be."""
+    if DraftUtils:
+        return DraftUtils.circPlacements(base_placement,
+                                         r_distance, tan_distance,
+                                         axis, center,
+                                         circle_number, symmetry)
+
     symmetry = max(1, symmetry)
     lead = (0, 1, 0)
 
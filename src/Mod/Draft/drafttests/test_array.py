@@ -30,7 +30,8 @@
 # @{
 
 import Draft
-from FreeCAD import Vector
+from FreeCAD import Placement, Rotation, Vector
+from draftobjects import array as array_module
 from drafttests import test_base
 
 
@@ -64,4 +65,35 @@ class DraftArray(test_base.DraftTestCaseDoc):
         self.doc.recompute(None, True, True)
         self.assertEqual(array.Count, array.NumberX)
 
+    def test_native_placements(self):
+        """Compare the placements computed by DraftUtils with the Python ones."""
+        if not array_module.DraftUtils:
+            self.skipTest("DraftUtils is not available")
+
+        base = Placement(Vector(1.0, 2.0, 3.0), Rotation(Vector(1.0, 1.0, 0.0), 30.0))
+        center = Vector(-5.0, 4.0, 0.0)
+        axis = Vector(0.0, 0.3, 1.0)
+        calls = [("rect_placements",
+                  (base, Vector(10.0, 0.0, 0.0), Vector(0.0, 7.0, 1.0),
+                   Vector(0.0, 0.0, 5.0), 4, 3, 2)),
+                 ("polar_placements",
+                  (base, center, 360.0, 8, axis, Vector(0.0, 0.0, 0.0))),
+                 ("polar_placements",
+                  (base, center, 90.0, 5, axis, Vector(0.0, 0.0, 2.0))),
+                 ("circ_placements",
+                  (base, 10.0, 6.0, axis, center, 4, 3))]
+
+        for name, args in calls:
+            native = getattr(array_module, name)(*args)
+            module = array_module.DraftUtils
+            array_module.DraftUtils = None
+            try:
+                python = getattr(array_module, name)(*args)
+            finally:
+                array_module.DraftUtils = module
+
+            self.assertEqual(len(native), len(python), name)
+            for pla1, pla2 in zip(native, python):
+                self.assertTrue(pla1.isSame(pla2, 1e-9), name)
+
 ## @}
@@ -24,14 +24,28 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <array>
+#include <cctype>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <numeric>
+#include <string_view>
+#include <thread>
 
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
-#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepExtrema_ExtPC.hxx>
+#include <BRepExtrema_ExtPF.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <Precision.hxx>
 #include <SMDS_MeshGroup.hxx>
 #include <SMESHDS_Group.hxx>
 #include <SMESHDS_GroupBase.hxx>
@@ -50,6 +64,11 @@
 #include <StdMeshers_Quadrangle_2D.hxx>
 #include <StdMeshers_Regular_1D.hxx>
 #include <StdMeshers_StartEndLength.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Solid.hxx>
@@ -64,6 +83,7 @@
 #include <Base/Console.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
+#include <Base/Interpreter.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/TimeInfo.h>
@@ -337,6 +357,51 @@ std::set<long> FemMesh::getSurfaceNodes(long /*ElemId*/, short /*FaceId*/, float
     return result;
 }
 
+namespace
+{
+
+/// Checks if all nodes of \a elem are in \a nodes
+bool hasNodesIn(const SMDS_MeshElement* elem, const std::set<int>& nodes)
+{
+    for (int i = 0; i < elem->NbNodes(); i++) {
+        if (nodes.find(elem->GetNode(i)->GetID()) == nodes.end()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Returns the elements of \a type which contain all nodes of \a elem. The candidates are the
+ * inverse elements of its first node, this adjacency is kept up to date by SMDS.
+ */
+std::vector<const SMDS_MeshElement*> getElementsContaining(const SMDS_MeshElement* elem,
+                                                           SMDSAbs_ElementType type,
+                                                           bool firstOnly = false)
+{
+    std::vector<const SMDS_MeshElement*> result;
+    if (elem->NbNodes() == 0) {
+        return result;
+    }
+
+    SMDS_ElemIteratorPtr it = elem->GetNode(0)->GetInverseElementIterator(type);
+    while (it->more()) {
+        const SMDS_MeshElement* other = it->next();
+        bool contains = other != elem;
+        for (int i = 1; i < elem->NbNodes() && contains; i++) {
+            contains = other->GetNodeIndex(elem->GetNode(i)) >= 0;
+        }
+        if (contains) {
+            result.push_back(other);
+            if (firstOnly) {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
 /*! That function returns map containing volume ID and face ID.
  */
 std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face) const
@@ -348,56 +413,19 @@ std::list<std::pair<int, int>> FemMesh::getVolumesByFace(const TopoDS_Face& face
     // to iterate volume faces
     // In SMESH9 this function has been removed
     //
-    std::map<int, std::set<int>> face_nodes;
 
     // get faces that contribute to 'nodes_on_face' with all of its nodes
+    // and the volumes which contain all nodes of such a face
     SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
     while (face_iter && face_iter->more()) {
         const SMDS_MeshFace* face = face_iter->next();
-        SMDS_NodeIteratorPtr node_iter = face->nodeIterator();
-
-        // all nodes of the current face must be part of 'nodes_on_face'
-        std::set<int> node_ids;
-        while (node_iter && node_iter->more()) {
-            const SMDS_MeshNode* node = node_iter->next();
-            node_ids.insert(node->GetID());
-        }
-
-        std::vector<int> element_face_nodes;
-        std::set_intersection(nodes_on_face.begin(),
-                              nodes_on_face.end(),
-                              node_ids.begin(),
-                              node_ids.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_face_nodes));
-
-        if (element_face_nodes.size() == node_ids.size()) {
-            face_nodes[face->GetID()] = node_ids;
-        }
-    }
-
-    // get all nodes of a volume and check which faces contribute to it with all of its nodes
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
-        SMDS_NodeIteratorPtr node_iter = vol->nodeIterator();
-        std::set<int> node_ids;
-        while (node_iter && node_iter->more()) {
-            const SMDS_MeshNode* node = node_iter->next();
-            node_ids.insert(node->GetID());
+        if (!hasNodesIn(face, nodes_on_face)) {
+            continue;
         }
 
-        for (const auto& it : face_nodes) {
-            std::vector<int> element_face_nodes;
-            std::set_intersection(node_ids.begin(),
-                                  node_ids.end(),
-                                  it.second.begin(),
-                                  it.second.end(),
-                                  std::back_insert_iterator<std::vector<int>>(element_face_nodes));
-
-            // For curved faces it is possible that a volume contributes more than one face
-            if (element_face_nodes.size() == it.second.size()) {
-                result.emplace_back(vol->GetID(), it.first);
-            }
+        // For curved faces it is possible that a volume contributes more than one face
+        for (const SMDS_MeshElement* vol : getElementsContaining(face, SMDSAbs_Volume)) {
+            result.emplace_back(vol->GetID(), face->GetID());
         }
     }
     result.sort();
@@ -415,22 +443,9 @@ std::list<int> FemMesh::getFacesByFace(const TopoDS_Face& face) const
     SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
     while (face_iter->more()) {
         const SMDS_MeshFace* face = static_cast<const SMDS_MeshFace*>(face_iter->next());
-        int numNodes = face->NbNodes();
-
-        std::set<int> face_nodes;
-        for (int i = 0; i < numNodes; i++) {
-            face_nodes.insert(face->GetNode(i)->GetID());
-        }
-
-        std::vector<int> element_face_nodes;
-        std::set_intersection(nodes_on_face.begin(),
-                              nodes_on_face.end(),
-                              face_nodes.begin(),
-                              face_nodes.end(),
-                              std::back_insert_iterator<std::vector<int>>(element_face_nodes));
 
         // For curved faces it is possible that a volume contributes more than one face
-        if (element_face_nodes.size() == static_cast<std::size_t>(numNodes)) {
+        if (hasNodesIn(face, nodes_on_face)) {
             result.push_back(face->GetID());
         }
     }
@@ -488,11 +503,20 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
         elem_order.insert(std::make_pair(c3d10.size(), c3d10));
     }
 
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    std::set<int> element_nodes;
+    // only the volumes with a node on the face can have one of their faces on it
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    std::set<const SMDS_MeshElement*> volumes;
+    for (int id : nodes_on_face) {
+        const SMDS_MeshNode* node = meshDS->FindNode(id);
+        SMDS_ElemIteratorPtr vol_iter =
+            node ? node->GetInverseElementIterator(SMDSAbs_Volume) : SMDS_ElemIteratorPtr();
+        while (vol_iter && vol_iter->more()) {
+            volumes.insert(vol_iter->next());
+        }
+    }
+
     int num_of_nodes;
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
+    for (const SMDS_MeshElement* vol : volumes) {
         num_of_nodes = vol->NbNodes();
         std::pair<int, std::vector<int>> apair;
         apair.first = vol->GetID();
@@ -557,65 +581,231 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face& face) const
     return result;
 }
 
-std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
+namespace
 {
-    std::set<int> result;
+/* The classes below tell whether a point is closer than a limit to a shape, like
+ * BRepExtrema_DistShapeShape does. The extrema algorithms of the sub-shapes are initialized
+ * once instead of again for every node. They are not thread-safe, every thread needs its own
+ * instance.
+ */
+class EdgeDistance
+{
+public:
+    EdgeDistance(const TopoDS_Edge& edge, double limit)
+    {
+        BRepBndLib::Add(edge, box);
+        box.Enlarge(limit);
+        if (!BRep_Tool::Degenerated(edge)) {
+            extrema.Initialize(edge);
+            hasCurve = true;
+        }
+        for (TopExp_Explorer xp(edge, TopAbs_VERTEX); xp.More(); xp.Next()) {
+            vertices.push_back(BRep_Tool::Pnt(TopoDS::Vertex(xp.Current())));
+        }
+    }
+
+    bool isOut(const gp_Pnt& pnt) const
+    {
+        return box.IsOut(pnt);
+    }
 
+    double squareDistance(const gp_Pnt& pnt, const TopoDS_Vertex& vertex)
+    {
+        double result = std::numeric_limits<double>::max();
+        for (const gp_Pnt& it : vertices) {
+            result = std::min(result, pnt.SquareDistance(it));
+        }
+        if (hasCurve) {
+            extrema.Perform(vertex);
+            if (extrema.IsDone()) {
+                for (int i = 1; i <= extrema.NbExt(); i++) {
+                    result = std::min(result, extrema.SquareDistance(i));
+                }
+            }
+        }
+        return result;
+    }
+
+private:
     Bnd_Box box;
-    BRepBndLib::Add(solid, box);
+    BRepExtrema_ExtPC extrema;
+    bool hasCurve = false;
+    std::vector<gp_Pnt> vertices;
+};
 
-    // limit where the mesh node belongs to the solid
-    TopAbs_ShapeEnum shapetype = TopAbs_SHAPE;
-    ShapeAnalysis_ShapeTolerance analysis;
-    double limit = analysis.Tolerance(solid, 1, shapetype);
-    Base::Console().Log("The limit if a node is in or out: %.12lf in scientific: %.4e \n",
-                        limit,
-                        limit);
+class FaceDistance
+{
+public:
+    FaceDistance(const TopoDS_Face& shape, double limit)
+        : face(shape)
+    {
+        // https://forum.freecad.org/viewtopic.php?f=18&t=21571&start=70#p221591
+        BRepBndLib::Add(face, box, Standard_False);
+        box.Enlarge(limit);
+        extrema.Initialize(face, Extrema_ExtFlag_MIN);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
+        TopTools_IndexedMapOfShape edgeMap;
+        TopExp::MapShapes(face, TopAbs_EDGE, edgeMap);
+        for (int i = 1; i <= edgeMap.Extent(); i++) {
+            edges.emplace_back(TopoDS::Edge(edgeMap(i)), limit);
+        }
+    }
 
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
+    bool isOut(const gp_Pnt& pnt) const
+    {
+        return box.IsOut(pnt);
     }
 
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
+    bool isWithin(const gp_Pnt& pnt, const TopoDS_Vertex& vertex, double limit)
+    {
+        double square = limit * limit;
+        // the solutions of the extrema lie inside the face, the boundary is checked separately
+        extrema.Perform(vertex, face);
+        if (extrema.IsDone()) {
+            for (int i = 1; i <= extrema.NbExt(); i++) {
+                if (extrema.SquareDistance(i) < square) {
+                    return true;
+                }
+            }
+        }
+        for (EdgeDistance& edge : edges) {
+            if (!edge.isOut(pnt) && edge.squareDistance(pnt, vertex) < square) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool isWithin(const gp_Pnt& pnt, double limit)
+    {
+        return isWithin(pnt, BRepBuilderAPI_MakeVertex(pnt).Vertex(), limit);
+    }
+
+private:
+    TopoDS_Face face;
+    Bnd_Box box;
+    BRepExtrema_ExtPF extrema;
+    std::deque<EdgeDistance> edges;
+};
+
+class EdgeNodeDistance
+{
+public:
+    EdgeNodeDistance(const TopoDS_Edge& shape, double limit)
+        : edge(shape, limit)
+    {}
+
+    bool isWithin(const gp_Pnt& pnt, double limit)
+    {
+        TopoDS_Vertex vertex = BRepBuilderAPI_MakeVertex(pnt).Vertex();
+        return edge.squareDistance(pnt, vertex) < limit * limit;
+    }
+
+private:
+    EdgeDistance edge;
+};
+
+class SolidDistance
+{
+public:
+    SolidDistance(const TopoDS_Solid& solid, double limit)
+        : classifier(solid)
+    {
+        TopTools_IndexedMapOfShape faceMap;
+        TopExp::MapShapes(solid, TopAbs_FACE, faceMap);
+        for (int i = 1; i <= faceMap.Extent(); i++) {
+            faces.emplace_back(TopoDS::Face(faceMap(i)), limit);
+        }
+    }
+
+    bool isWithin(const gp_Pnt& pnt, double limit)
+    {
+        // the distance to a solid is zero inside of it
+        classifier.Perform(pnt, Precision::Confusion());
+        if (classifier.State() == TopAbs_IN) {
+            return true;
+        }
+        TopoDS_Vertex vertex = BRepBuilderAPI_MakeVertex(pnt).Vertex();
+        for (FaceDistance& face : faces) {
+            if (!face.isOut(pnt) && face.isWithin(pnt, vertex, limit)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    BRepClass3d_SolidClassifier classifier;
+    std::deque<FaceDistance> faces;
+};
+
+/* Returns the IDs of the nodes in the box that are closer than limit to the shape. Only the
+ * candidates in the box are classified, in parallel with a Distance instance per thread.
+ */
+template<typename Distance, typename Shape>
+std::set<int> getNodesNearShape(SMESHDS_Mesh* meshds,
+                                const Base::Matrix4D& Mtrx,
+                                const Bnd_Box& box,
+                                const Shape& shape,
+                                double limit)
+{
+    std::vector<std::pair<int, gp_Pnt>> candidates;
+    SMDS_NodeIteratorPtr aNodeIter = meshds->nodesIterator();
+    while (aNodeIter->more()) {
+        const SMDS_MeshNode* aNode = aNodeIter->next();
         double xyz[3];
         aNode->GetXYZ(xyz);
         Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
         // Apply the matrix to hold the BoundBox in absolute space.
         vec = Mtrx * vec;
+        gp_Pnt pnt(vec.x, vec.y, vec.z);
+        if (!box.IsOut(pnt)) {
+            candidates.emplace_back(aNode->GetID(), pnt);
+        }
+    }
 
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
+    std::vector<char> within(candidates.size(), 0);
+#pragma omp parallel
+    {
+        Distance distance(shape, limit);
+#pragma omp for schedule(dynamic)
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            within[i] = distance.isWithin(candidates[i].second, limit) ? 1 : 0;
+        }
+    }
 
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
+    std::set<int> result;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (within[i]) {
+            result.insert(candidates[i].first);
         }
     }
     return result;
 }
+}  // namespace
 
-std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
+std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid& solid) const
 {
-    std::set<int> result;
+    Bnd_Box box;
+    BRepBndLib::Add(solid, box);
+
+    // limit where the mesh node belongs to the solid
+    TopAbs_ShapeEnum shapetype = TopAbs_SHAPE;
+    ShapeAnalysis_ShapeTolerance analysis;
+    double limit = analysis.Tolerance(solid, 1, shapetype);
+    Base::Console().Log("The limit if a node is in or out: %.12lf in scientific: %.4e \n",
+                        limit,
+                        limit);
 
+    return getNodesNearShape<SolidDistance>(myMesh->GetMeshDS(),
+                                            getTransform(),
+                                            box,
+                                            solid,
+                                            limit);
+}
+
+std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
+{
     Bnd_Box box;
     BRepBndLib::Add(
         face,
@@ -625,96 +815,22 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face& face) const
     double limit = BRep_Tool::Tolerance(face);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return getNodesNearShape<FaceDistance>(myMesh->GetMeshDS(), getTransform(), box, face, limit);
 }
 
 std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge& edge) const
 {
-    std::set<int> result;
-
     Bnd_Box box;
     BRepBndLib::Add(edge, box);
     // limit where the mesh node belongs to the edge:
     double limit = BRep_Tool::Tolerance(edge);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    std::vector<const SMDS_MeshNode*> nodes;
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        nodes.push_back(aNode);
-    }
-
-#pragma omp parallel for schedule(dynamic)
-    for (size_t i = 0; i < nodes.size(); ++i) {
-        const SMDS_MeshNode* aNode = nodes[i];
-        double xyz[3];
-        aNode->GetXYZ(xyz);
-        Base::Vector3d vec(xyz[0], xyz[1], xyz[2]);
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x, vec.y, vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x, vec.y, vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge, s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1) {
-                continue;
-            }
-
-            if (measure.Value() < limit)
-#pragma omp critical
-            {
-                result.insert(aNode->GetID());
-            }
-        }
-    }
-
-    return result;
+    return getNodesNearShape<EdgeNodeDistance>(myMesh->GetMeshDS(),
+                                               getTransform(),
+                                               box,
+                                               edge,
+                                               limit);
 }
 
 std::set<int> FemMesh::getNodesByVertex(const TopoDS_Vertex& vertex) const
@@ -786,36 +902,11 @@ std::set<int> FemMesh::getEdgesOnly() const
 {
     std::set<int> resultIDs;
 
-    // edges
+    // an edge belongs to a face if all of its nodes are nodes of the face
     SMDS_EdgeIteratorPtr aEdgeIter = myMesh->GetMeshDS()->edgesIterator();
     while (aEdgeIter->more()) {
         const SMDS_MeshEdge* aEdge = aEdgeIter->next();
-        std::list<int> enodes = getElementNodes(aEdge->GetID());
-        std::set<int> aEdgeNodes(enodes.begin(), enodes.end());  // convert list to set
-        bool edgeBelongsToAFace = false;
-
-        // faces
-        SMDS_FaceIteratorPtr aFaceIter = myMesh->GetMeshDS()->facesIterator();
-        while (aFaceIter->more()) {
-            const SMDS_MeshFace* aFace = aFaceIter->next();
-            std::list<int> fnodes = getElementNodes(aFace->GetID());
-            std::set<int> aFaceNodes(fnodes.begin(), fnodes.end());  // convert list to set
-
-            // if aEdgeNodes is not a subset of any aFaceNodes --> aEdge does not belong to any Face
-            std::vector<int> inodes;
-            std::set_intersection(aFaceNodes.begin(),
-                                  aFaceNodes.end(),
-                                  aEdgeNodes.begin(),
-                                  aEdgeNodes.end(),
-                                  std::back_inserter(inodes));
-            std::set<int> intersection_nodes(inodes.begin(),
-                                             inodes.end());  // convert vector to set
-            if (aEdgeNodes == intersection_nodes) {
-                edgeBelongsToAFace = true;
-                break;
-            }
-        }
-        if (!edgeBelongsToAFace) {
+        if (getElementsContaining(aEdge, SMDSAbs_Face, true).empty()) {
             resultIDs.insert(aEdge->GetID());
         }
     }
@@ -825,62 +916,14 @@ std::set<int> FemMesh::getEdgesOnly() const
 
 std::set<int> FemMesh::getFacesOnly() const
 {
-    // How it works ATM:
-    // for each face
-    //     get the face nodes
-    //     for each volume
-    //         get the volume nodes
-    //         if the face nodes are a subset of the volume nodes
-    //             add the face to the volume faces and break
-    //     if face doesn't belong to a volume
-    //         add it to faces only
-    //
-    // This means it is iterated over a lot of volumes many times, this is quite expensive!
-    //
-    // TODO make this faster
-    // Idea:
-    // for each volume
-    //     get the faces and add them to the volume faces
-    // for each face
-    //     if not in volume faces
-    //     add it to the faces only
-    //
-    // but the volume faces do not seem to know their global mesh ID, I could not find any method in
-    // SMESH
-
     std::set<int> resultIDs;
 
-    // faces
+    // a face belongs to a volume if all of its nodes are nodes of the volume, only the volumes
+    // around one of its nodes have to be checked
     SMDS_FaceIteratorPtr aFaceIter = myMesh->GetMeshDS()->facesIterator();
     while (aFaceIter->more()) {
         const SMDS_MeshFace* aFace = aFaceIter->next();
-        std::list<int> fnodes = getElementNodes(aFace->GetID());
-        std::set<int> aFaceNodes(fnodes.begin(), fnodes.end());  // convert list to set
-        bool faceBelongsToAVolume = false;
-
-        // volumes
-        SMDS_VolumeIteratorPtr aVolIter = myMesh->GetMeshDS()->volumesIterator();
-        while (aVolIter->more()) {
-            const SMDS_MeshVolume* aVol = aVolIter->next();
-            std::list<int> vnodes = getElementNodes(aVol->GetID());
-            std::set<int> aVolNodes(vnodes.begin(), vnodes.end());  // convert list to set
-
-            // if aFaceNodes is not a subset of any aVolNodes --> aFace does not belong to any
-            // Volume
-            std::vector<int> inodes;
-            std::set_intersection(aVolNodes.begin(),
-                                  aVolNodes.end(),
-                                  aFaceNodes.begin(),
-                                  aFaceNodes.end(),
-                                  std::back_inserter(inodes));
-            std::set<int> intersection_nodes(inodes.begin(),
-                                             inodes.end());  // convert vector to set
-            if (aFaceNodes == intersection_nodes) {
-                faceBelongsToAVolume = true;
-                break;
-            }
-        }
-        if (!faceBelongsToAVolume) {
+        if (getElementsContaining(aFace, SMDSAbs_Volume, true).empty()) {
             resultIDs.insert(aFace->GetID());
         }
     }
@@ -890,6 +933,59 @@ std::set<int> FemMesh::getFacesOnly() const
 
 namespace
 {
+// Reads the whole file at once, the parsers work on views of its lines
+std::string readFileContents(const Base::FileInfo& fi)
+{
+    Base::ifstream inputfile(fi, std::ios::in | std::ios::binary);
+    if (!inputfile.is_open()) {
+        throw Base::FileException("Cannot open file", fi);
+    }
+    inputfile.seekg(0, std::ios::end);
+    std::string contents(static_cast<std::size_t>(inputfile.tellg()), '\0');
+    inputfile.seekg(0, std::ios::beg);
+    inputfile.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+    return contents;
+}
+
+// Splits the buffer into lines without their line break, like std::getline() does
+std::vector<std::string_view> splitLines(std::string_view contents)
+{
+    std::vector<std::string_view> lines;
+    std::size_t pos = 0;
+    while (pos < contents.size()) {
+        std::size_t end = contents.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = contents.size();
+        }
+        std::string_view line = contents.substr(pos, end - pos);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        lines.push_back(line);
+        pos = end + 1;
+    }
+    return lines;
+}
+
+// Calls func(begin, end) for consecutive chunks of [0, count), each chunk in its own thread
+template<typename Func>
+void parallelChunks(std::size_t count, Func func)
+{
+    const std::size_t minChunkSize = 10000;
+    std::size_t numThreads = std::max(1U, std::thread::hardware_concurrency());
+    std::size_t chunkSize = std::max(minChunkSize, (count + numThreads - 1) / numThreads);
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t begin = chunkSize; begin < count; begin += chunkSize) {
+        futures.push_back(
+            std::async(std::launch::async, func, begin, std::min(begin + chunkSize, count)));
+    }
+    func(0, std::min(chunkSize, count));
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 class NastranElement
 {
 public:
@@ -1290,6 +1386,461 @@ class CHEXA2Element: public NastranElement
     }
 };
 
+// A card of a Nastran file. The cards are found sequentially because their continuation
+// lines depend on the lines before, then they are read in parallel.
+struct NastranCard
+{
+    NastranElementPtr (*create)() = nullptr;
+    std::string_view line1;
+    std::string_view line2;
+    // the free field format has the continuation appended to the first line
+    bool join = false;
+    bool node = false;
+};
+
+template<typename T>
+NastranElementPtr createElement()
+{
+    return std::make_shared<T>();
+}
+
+std::vector<NastranElementPtr> readCards(const std::vector<NastranCard>& cards)
+{
+    std::vector<NastranElementPtr> elements(cards.size());
+    parallelChunks(cards.size(), [&cards, &elements](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const NastranCard& card = cards[i];
+            NastranElementPtr ptr = card.create();
+            if (card.join) {
+                ptr->read(std::string(card.line1).append(card.line2), "");
+            }
+            else {
+                ptr->read(std::string(card.line1), std::string(card.line2));
+            }
+            if (ptr->isValid()) {
+                elements[i] = ptr;
+            }
+        }
+    });
+    return elements;
+}
+
+// Abaqus/CalculiX
+
+enum AbaqusElementType
+{
+    AbaqusHexa8,
+    AbaqusPenta6,
+    AbaqusTetra4,
+    AbaqusTetra10,
+    AbaqusPenta15,
+    AbaqusHexa20,
+    AbaqusTria3,
+    AbaqusTria6,
+    AbaqusQuad4,
+    AbaqusQuad8,
+    AbaqusSeg2,
+    AbaqusSeg3,
+    AbaqusNumTypes
+};
+
+struct AbaqusElementInfo
+{
+    std::vector<std::string_view> names;
+    // node i of FreeCAD is node order[i] of CalculiX
+    std::vector<int> order;
+};
+
+// The element types in the order they are added to the mesh
+const std::vector<AbaqusElementInfo>& getAbaqusElementInfo()
+{
+    static const std::vector<AbaqusElementInfo> info {
+        {{"C3D8", "C3D8R", "C3D8I"}, {5, 6, 7, 4, 1, 2, 3, 0}},
+        {{"C3D6"}, {4, 5, 3, 1, 2, 0}},
+        {{"C3D4"}, {1, 0, 2, 3}},
+        {{"C3D10"}, {1, 0, 2, 3, 4, 6, 5, 8, 7, 9}},
+        {{"C3D15"}, {4, 5, 3, 1, 2, 0, 10, 11, 9, 7, 8, 6, 13, 14, 12}},
+        {{"C3D20", "C3D20R", "C3D20RI"},
+         {5, 6, 7, 4, 1, 2, 3, 0, 13, 14, 15, 12, 9, 10, 11, 8, 17, 18, 19, 16}},
+        {{"S3", "CPS3", "CPE3", "CAX3"}, {0, 1, 2}},
+        {{"S6", "CPS6", "CPE6", "CAX6"}, {0, 1, 2, 3, 4, 5}},
+        {{"S4", "S4R", "CPS4", "CPS4R", "CPE4", "CPE4R", "CAX4", "CAX4R"}, {0, 1, 2, 3}},
+        {{"S8", "S8R", "CPS8", "CPS8R", "CPE8", "CPE8R", "CAX8", "CAX8R"},
+         {0, 1, 2, 3, 4, 5, 6, 7}},
+        {{"B31", "B31R", "T3D2"}, {0, 1}},
+        {{"B32", "B32R", "T3D3"}, {0, 2, 1}},
+    };
+    return info;
+}
+
+bool isBlank(std::string_view field)
+{
+    return field.find_first_not_of(" \t") == std::string_view::npos;
+}
+
+std::string_view trimmed(std::string_view field)
+{
+    std::size_t begin = field.find_first_not_of(" \t\"");
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    return field.substr(begin, field.find_last_not_of(" \t\"") - begin + 1);
+}
+
+bool hasKeyword(std::string_view line, std::string_view keyword)
+{
+    if (line.size() < keyword.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < keyword.size(); i++) {
+        if (std::toupper(static_cast<unsigned char>(line[i])) != keyword[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void splitFields(std::string_view line, std::vector<std::string_view>& fields)
+{
+    fields.clear();
+    std::size_t pos = 0;
+    for (;;) {
+        std::size_t end = line.find(',', pos);
+        if (end == std::string_view::npos) {
+            fields.push_back(line.substr(pos));
+            return;
+        }
+        fields.push_back(line.substr(pos, end - pos));
+        pos = end + 1;
+    }
+}
+
+template<typename T>
+bool parseNumber(std::string_view field, T& value)
+{
+    // the views are not null terminated
+    std::array<char, 64> buf {};
+    std::size_t len = std::min(field.size(), buf.size() - 1);
+    std::memcpy(buf.data(), field.data(), len);
+    char* end = nullptr;
+    if constexpr (std::is_integral_v<T>) {
+        value = static_cast<T>(std::strtol(buf.data(), &end, 10));
+    }
+    else {
+        value = std::strtod(buf.data(), &end);
+    }
+    return end != buf.data();
+}
+
+/* Reads the nodes and elements of an Abaqus input file like feminout.importInpMesh does.
+ * The lines are classified sequentially, as their meaning depends on the keyword lines
+ * before them, then the numbers are parsed in parallel.
+ */
+class AbaqusReader
+{
+public:
+    void read(const Base::FileInfo& fi)
+    {
+        contents.push_back(readFileContents(fi));
+        for (std::string_view line : splitLines(contents.back())) {
+            if (isBlank(line)) {
+                continue;
+            }
+            if (line[0] == '*') {
+                if (hasKeyword(line, "**")) {
+                    continue;  // comment
+                }
+                if (hasKeyword(line, "*INCLUDE")) {
+                    readInclude(fi, line);
+                    continue;
+                }
+                readNode = false;
+                elementType = -1;
+                missingNodes = 0;
+            }
+
+            if (modelDefinition && hasKeyword(line, "*NODE")) {
+                readNode = true;
+            }
+            else if (readNode) {
+                nodeLines.push_back(line);
+            }
+            else if (hasKeyword(line, "*ELEMENT")) {
+                setElementType(line);
+            }
+            else if (elementType >= 0) {
+                addElementLine(line);
+            }
+            else if (hasKeyword(line, "*STEP")) {
+                modelDefinition = false;
+            }
+        }
+    }
+
+    void parse()
+    {
+        nodes.resize(nodeLines.size());
+        parallelChunks(nodeLines.size(), [this](std::size_t begin, std::size_t end) {
+            std::vector<std::string_view> fields;
+            for (std::size_t i = begin; i < end; i++) {
+                splitFields(nodeLines[i], fields);
+                Node& node = nodes[i];
+                node.valid = fields.size() >= 4 && parseNumber(fields[0], node.id)
+                    && parseNumber(fields[1], node.x) && parseNumber(fields[2], node.y)
+                    && parseNumber(fields[3], node.z);
+            }
+        });
+
+        elementData.resize(elementDataSize);
+        parallelChunks(elements.size(), [this](std::size_t begin, std::size_t end) {
+            std::vector<std::string_view> fields;
+            for (std::size_t i = begin; i < end; i++) {
+                parseElement(elements[i], fields);
+            }
+        });
+    }
+
+    void addToMesh(SMESHDS_Mesh* meshds) const
+    {
+        for (const Node& node : nodes) {
+            if (node.valid) {
+                meshds->AddNodeWithID(node.x, node.y, node.z, node.id);
+            }
+        }
+
+        std::array<int, 20> n {};
+        for (int type = 0; type < AbaqusNumTypes; type++) {
+            const std::vector<int>& order = getAbaqusElementInfo()[type].order;
+            for (const Element& element : elements) {
+                const int* data = &elementData[element.offset];
+                if (element.type != type || data[0] < 0) {
+                    continue;
+                }
+                for (std::size_t i = 0; i < order.size(); i++) {
+                    n[i] = data[1 + order[i]];
+                }
+                addElement(meshds, type, n, data[0]);
+            }
+        }
+
+        for (const std::string& name : unsupported) {
+            Base::Console().Error("Error: %s not supported.\n", name.c_str());
+        }
+    }
+
+private:
+    struct Node
+    {
+        int id = -1;
+        double x = 0.0;
+        double y = 0.0;
+        double z = 0.0;
+        bool valid = false;
+    };
+
+    struct Element
+    {
+        int type;
+        std::size_t firstLine;
+        std::size_t numLines;
+        // index of the id in elementData, the nodes follow it
+        std::size_t offset;
+    };
+
+    void readInclude(const Base::FileInfo& fi, std::string_view line)
+    {
+        std::size_t pos = line.find('=');
+        if (pos == std::string_view::npos) {
+            return;
+        }
+        std::string name(trimmed(line.substr(pos + 1)));
+        Base::FileInfo include(name);
+        if (!include.isFile()) {
+            include.setFile(fi.dirPath() + "/" + name);
+        }
+        read(include);
+    }
+
+    void setElementType(std::string_view line)
+    {
+        std::vector<std::string_view> fields;
+        splitFields(line.substr(std::strlen("*ELEMENT")), fields);
+        std::string name;
+        for (std::string_view field : fields) {
+            std::size_t pos = field.find('=');
+            if (pos != std::string_view::npos && hasKeyword(trimmed(field), "TYPE")) {
+                for (char c : trimmed(field.substr(pos + 1))) {
+                    name += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+                }
+            }
+        }
+
+        const auto& info = getAbaqusElementInfo();
+        for (int type = 0; type < AbaqusNumTypes; type++) {
+            const auto& names = info[type].names;
+            if (std::find(names.begin(), names.end(), name) != names.end()) {
+                elementType = type;
+                return;
+            }
+        }
+        unsupported.insert(name);
+    }
+
+    void addElementLine(std::string_view line)
+    {
+        std::vector<std::string_view>& fields = lineFields;
+        splitFields(line, fields);
+        std::size_t pos = 0;
+        if (missingNodes == 0) {
+            int numNodes = int(getAbaqusElementInfo()[elementType].order.size());
+            elements.push_back({elementType, elementLines.size(), 0, elementDataSize});
+            elementDataSize += 1 + numNodes;
+            missingNodes = numNodes;
+            pos = 1;
+        }
+        elements.back().numLines++;
+        elementLines.push_back(line);
+
+        // an element continues on the next line if this one ends before all its nodes
+        while (missingNodes > 0 && pos < fields.size() && !isBlank(fields[pos])) {
+            missingNodes--;
+            pos++;
+        }
+    }
+
+    void parseElement(const Element& element, std::vector<std::string_view>& fields)
+    {
+        int numNodes = int(getAbaqusElementInfo()[element.type].order.size());
+        int* data = &elementData[element.offset];
+        int id = -1;
+        int count = 0;
+        for (std::size_t line = 0; line < element.numLines; line++) {
+            splitFields(elementLines[element.firstLine + line], fields);
+            std::size_t pos = 0;
+            if (line == 0) {
+                if (!parseNumber(fields[0], id)) {
+                    break;
+                }
+                pos = 1;
+            }
+            for (; pos < fields.size() && count < numNodes; pos++) {
+                if (!parseNumber(fields[pos], data[1 + count])) {
+                    break;
+                }
+                count++;
+            }
+        }
+        // incomplete elements are skipped
+        data[0] = count == numNodes ? id : -1;
+    }
+
+    static void addElement(SMESHDS_Mesh* meshds, int type, const std::array<int, 20>& n, int id)
+    {
+        switch (type) {
+            case AbaqusHexa8:
+                meshds->AddVolumeWithID(n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], id);
+                break;
+            case AbaqusPenta6:
+                meshds->AddVolumeWithID(n[0], n[1], n[2], n[3], n[4], n[5], id);
+                break;
+            case AbaqusTetra4:
+                meshds->AddVolumeWithID(n[0], n[1], n[2], n[3], id);
+                break;
+            case AbaqusTetra10:
+                meshds->AddVolumeWithID(n[0],
+                                        n[1],
+                                        n[2],
+                                        n[3],
+                                        n[4],
+                                        n[5],
+                                        n[6],
+                                        n[7],
+                                        n[8],
+                                        n[9],
+                                        id);
+                break;
+            case AbaqusPenta15:
+                meshds->AddVolumeWithID(n[0],
+                                        n[1],
+                                        n[2],
+                                        n[3],
+                                        n[4],
+                                        n[5],
+                                        n[6],
+                                        n[7],
+                                        n[8],
+                                        n[9],
+                                        n[10],
+                                        n[11],
+                                        n[12],
+                                        n[13],
+                                        n[14],
+                                        id);
+                break;
+            case AbaqusHexa20:
+                meshds->AddVolumeWithID(n[0],
+                                        n[1],
+                                        n[2],
+                                        n[3],
+                                        n[4],
+                                        n[5],
+                                        n[6],
+                                        n[7],
+                                        n[8],
+                                        n[9],
+                                        n[10],
+                                        n[11],
+                                        n[12],
+                                        n[13],
+                                        n[14],
+                                        n[15],
+                                        n[16],
+                                        n[17],
+                                        n[18],
+                                        n[19],
+                                        id);
+                break;
+            case AbaqusTria3:
+                meshds->AddFaceWithID(n[0], n[1], n[2], id);
+                break;
+            case AbaqusTria6:
+                meshds->AddFaceWithID(n[0], n[1], n[2], n[3], n[4], n[5], id);
+                break;
+            case AbaqusQuad4:
+                meshds->AddFaceWithID(n[0], n[1], n[2], n[3], id);
+                break;
+            case AbaqusQuad8:
+                meshds->AddFaceWithID(n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], id);
+                break;
+            case AbaqusSeg2:
+                meshds->AddEdgeWithID(n[0], n[1], id);
+                break;
+            case AbaqusSeg3:
+                meshds->AddEdgeWithID(n[0], n[1], n[2], id);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // the file and its includes, the lines are views into them
+    std::deque<std::string> contents;
+    std::vector<std::string_view> nodeLines;
+    std::vector<std::string_view> elementLines;
+    std::vector<std::string_view> lineFields;
+    std::vector<Node> nodes;
+    std::vector<Element> elements;
+    std::vector<int> elementData;
+    std::size_t elementDataSize = 0;
+    std::set<std::string> unsupported;
+
+    // state of the sequential pass
+    bool modelDefinition = true;
+    bool readNode = false;
+    int elementType = -1;
+    int missingNodes = 0;
+};
+
 }  // namespace
 
 void FemMesh::readNastran(const std::string& Filename)
@@ -1299,12 +1850,9 @@ void FemMesh::readNastran(const std::string& Filename)
 
     _Mtrx = Base::Matrix4D();
 
-    Base::FileInfo fi(Filename);
-    Base::ifstream inputfile;
-    inputfile.open(fi);
-    inputfile.seekg(std::ifstream::beg);
-    std::string line1, line2;
-    std::vector<NastranElementPtr> mesh_elements;
+    std::string contents = readFileContents(Base::FileInfo(Filename));
+    std::vector<std::string_view> lines = splitLines(contents);
+    std::vector<NastranCard> cards;
     enum Format
     {
         FreeField,
@@ -1313,63 +1861,63 @@ void FemMesh::readNastran(const std::string& Filename)
     };
     Format nastranFormat = Format::LongField;
 
-    do {
-        std::getline(inputfile, line1);
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        std::string_view line1 = lines[i];
+        auto nextLine = [&lines, &i]() {
+            return ++i < lines.size() ? lines[i] : std::string_view();
+        };
         if (line1.empty()) {
             continue;
         }
-        if (line1.find(',') != std::string::npos) {
+        if (line1.find(',') != std::string_view::npos) {
             nastranFormat = Format::FreeField;
         }
 
-        NastranElementPtr ptr;
-        if (line1.find("GRID*") != std::string::npos) {  // We found a Grid line
+        NastranCard card;
+        if (line1.find("GRID*") != std::string_view::npos) {  // We found a Grid line
             // Now lets extract the GRID Points = Nodes
             // As each GRID Line consists of two subsequent lines we have to
             // take care of that as well
             if (nastranFormat == Format::LongField) {
-                std::getline(inputfile, line2);
-                ptr = std::make_shared<GRIDLongFieldElement>();
-                ptr->read(line1, line2);
+                card.line2 = nextLine();
+                card.create = createElement<GRIDLongFieldElement>;
             }
         }
-        else if (line1.find("GRID") != std::string::npos) {  // We found a Grid line
+        else if (line1.find("GRID") != std::string_view::npos) {  // We found a Grid line
             if (nastranFormat == Format::FreeField) {
-                ptr = std::make_shared<GRIDFreeFieldElement>();
-                ptr->read(line1, "");
+                card.create = createElement<GRIDFreeFieldElement>;
             }
         }
-        else if (line1.find("CTRIA3") != std::string::npos) {
+        else if (line1.find("CTRIA3") != std::string_view::npos) {
             if (nastranFormat == Format::FreeField) {
-                ptr = std::make_shared<CTRIA3FreeFieldElement>();
-                ptr->read(line1, "");
+                card.create = createElement<CTRIA3FreeFieldElement>;
             }
             else {
-                ptr = std::make_shared<CTRIA3LongFieldElement>();
-                ptr->read(line1, "");
+                card.create = createElement<CTRIA3LongFieldElement>;
             }
         }
-        else if (line1.find("CTETRA") != std::string::npos) {
+        else if (line1.find("CTETRA") != std::string_view::npos) {
             // Lets extract the elements
             // As each Element Line consists of two subsequent lines as well
             // we have to take care of that
             // At a first step we only extract Quadratic Tetrahedral Elements
-            std::getline(inputfile, line2);
+            card.line2 = nextLine();
             if (nastranFormat == Format::FreeField) {
-                ptr = std::make_shared<CTETRAFreeFieldElement>();
-                ptr->read(line1.append(line2), "");
+                card.create = createElement<CTETRAFreeFieldElement>;
+                card.join = true;
             }
             else {
-                ptr = std::make_shared<CTETRALongFieldElement>();
-                ptr->read(line1, line2);
+                card.create = createElement<CTETRALongFieldElement>;
             }
         }
 
-        if (ptr && ptr->isValid()) {
-            mesh_elements.push_back(ptr);
+        if (card.create) {
+            card.line1 = line1;
+            cards.push_back(card);
         }
-    } while (inputfile.good());
-    inputfile.close();
+    }
+
+    std::vector<NastranElementPtr> mesh_elements = readCards(cards);
 
     Base::Console().Log("    %f: File read, start building mesh\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
@@ -1378,8 +1926,10 @@ void FemMesh::readNastran(const std::string& Filename)
     SMESHDS_Mesh* meshds = this->myMesh->GetMeshDS();
     meshds->ClearMesh();
 
-    for (auto it : mesh_elements) {
-        it->addToMesh(meshds);
+    for (const auto& it : mesh_elements) {
+        if (it) {
+            it->addToMesh(meshds);
+        }
     }
 
     Base::Console().Log("    %f: Done \n",
@@ -1393,124 +1943,111 @@ void FemMesh::readNastran95(const std::string& Filename)
 
     _Mtrx = Base::Matrix4D();
 
-    Base::FileInfo fi(Filename);
-    Base::ifstream inputfile;
-    inputfile.open(fi);
-    inputfile.seekg(std::ifstream::beg);
-    std::string line1, line2, tcard;
-
-    std::vector<NastranElementPtr> mesh_nodes;
-    std::vector<NastranElementPtr> mesh_elements;
-
-    do {
-        NastranElementPtr node;
-        NastranElementPtr elem;
-        std::getline(inputfile, line1);
-        // cout << line1 << endl;
+    std::string contents = readFileContents(Base::FileInfo(Filename));
+    std::vector<std::string_view> lines = splitLines(contents);
+    std::vector<NastranCard> cards;
+
+    for (std::size_t i = 0; i < lines.size(); i++) {
+        std::string_view line1 = lines[i];
+        auto nextLine = [&lines, &i]() {
+            return ++i < lines.size() ? lines[i] : std::string_view();
+        };
         if (line1.empty()) {
             continue;
         }
 
-        tcard = line1.substr(0, 8).c_str();
-        // boost::algorithm::trim(tcard);
-        if (line1.find("GRID*") != std::string::npos)  // We found a Grid line
+        NastranCard card;
+        if (line1.find("GRID*") != std::string_view::npos)  // We found a Grid line
         {
             // Now lets extract the GRID Points = Nodes
             // As each GRID Line consists of two subsequent lines we have to
             // take care of that as well
-            std::getline(inputfile, line2);
-            node = std::make_shared<GRIDLongFieldElement>();
-            node->read(line1, line2);
+            card.line2 = nextLine();
+            card.create = createElement<GRIDLongFieldElement>;
+            card.node = true;
         }
-        else if (line1.find("GRID") != std::string::npos)  // We found a Grid line
+        else if (line1.find("GRID") != std::string_view::npos)  // We found a Grid line
         {
-            // Base::Console().Log("Found a GRID\n");
             // D06.inp
             // GRID    109             .9      .7
             // Now lets extract the GRID Points = Nodes
             // Get the Nodal ID
-            node = std::make_shared<GRIDNastran95Element>();
-            node->read(line1, "");
+            card.create = createElement<GRIDNastran95Element>;
+            card.node = true;
         }
 
         // 1D
         else if (line1.substr(0, 6) == "CBAR") {
-            elem = std::make_shared<CBARElement>();
-            elem->read(line1, "");
+            card.create = createElement<CBARElement>;
         }
         // 2d
         else if (line1.substr(0, 6) == "CTRMEM") {
             // D06
             // CTRMEM  322     1       179     180     185
-            elem = std::make_shared<CTRMEMElement>();
-            elem->read(line1, "");
+            card.create = createElement<CTRMEMElement>;
         }
         else if (line1.substr(0, 6) == "CTRIA1") {
             // D06
             // CTRMEM  322     1       179     180     185
-            elem = std::make_shared<CTRIA1Element>();
-            elem->read(line1, "");
+            card.create = createElement<CTRIA1Element>;
         }
         else if (line1.substr(0, 6) == "CQUAD1") {
             // D06
             // CTRMEM  322     1       179     180     185
-            elem = std::make_shared<CQUAD1Element>();
-            elem->read(line1, "");
+            card.create = createElement<CQUAD1Element>;
         }
 
         // 3d element
-        else if (line1.find("CTETRA") != std::string::npos) {
+        else if (line1.find("CTETRA") != std::string_view::npos) {
             // d011121a.inp
             // CTETRA  3       200     104     114     3       103
-            elem = std::make_shared<CTETRANastran95Element>();
-            elem->read(line1, "");
+            card.create = createElement<CTETRANastran95Element>;
         }
-        else if (line1.find("CWEDGE") != std::string::npos) {
+        else if (line1.find("CWEDGE") != std::string_view::npos) {
             // d011121a.inp
             // CWEDGE  11      200     6       17      16      106     117     116
-            elem = std::make_shared<CTETRANastran95Element>();
-            elem->read(line1, "");
+            card.create = createElement<CTETRANastran95Element>;
         }
-        else if (line1.find("CHEXA1") != std::string::npos) {
+        else if (line1.find("CHEXA1") != std::string_view::npos) {
             // d011121a.inp
             // CHEXA1  1       200     1       2       13      12      101     102     +SOL1
             //+SOL1   113     112
-            std::getline(inputfile, line2);
-            elem = std::make_shared<CHEXA1Element>();
-            elem->read(line1, line2);
+            card.line2 = nextLine();
+            card.create = createElement<CHEXA1Element>;
         }
-        else if (line1.find("CHEXA2") != std::string::npos) {
+        else if (line1.find("CHEXA2") != std::string_view::npos) {
             // d011121a.inp
             // CHEXA1  1       200     1       2       13      12      101     102     +SOL1
             //+SOL1   113     112
-            std::getline(inputfile, line2);
-            elem = std::make_shared<CHEXA2Element>();
-            elem->read(line1, line2);
+            card.line2 = nextLine();
+            card.create = createElement<CHEXA2Element>;
         }
 
-        if (node && node->isValid()) {
-            mesh_nodes.push_back(node);
+        if (card.create) {
+            card.line1 = line1;
+            cards.push_back(card);
         }
+    }
 
-        if (elem && elem->isValid()) {
-            mesh_elements.push_back(elem);
-        }
-    } while (inputfile.good());
-    inputfile.close();
+    std::vector<NastranElementPtr> mesh_elements = readCards(cards);
 
     Base::Console().Log("    %f: File read, start building mesh\n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 
-    // Now fill the SMESH datastructure
+    // Now fill the SMESH datastructure, the nodes first
     SMESHDS_Mesh* meshds = this->myMesh->GetMeshDS();
     meshds->ClearMesh();
 
-    for (auto it : mesh_nodes) {
-        it->addToMesh(meshds);
+    for (std::size_t i = 0; i < cards.size(); i++) {
+        if (cards[i].node && mesh_elements[i]) {
+            mesh_elements[i]->addToMesh(meshds);
+        }
     }
 
-    for (auto it : mesh_elements) {
-        it->addToMesh(meshds);
+    for (std::size_t i = 0; i < cards.size(); i++) {
+        if (!cards[i].node && mesh_elements[i]) {
+            mesh_elements[i]->addToMesh(meshds);
+        }
     }
 
     Base::Console().Log("    %f: Done \n",
@@ -1522,37 +2059,19 @@ void FemMesh::readAbaqus(const std::string& FileName)
     Base::TimeElapsed Start;
     Base::Console().Log("Start: FemMesh::readAbaqus() =================================\n");
 
-    /*
-    Python command to read Abaqus inp mesh file from test suite:
-    from feminout.importInpMesh import read as read_inp
-    femmesh = read_inp(FreeCAD.ConfigGet("AppHomePath") +
-    'Mod/Fem/femtest/data/mesh/tetra10_mesh.inp')
-    */
+    _Mtrx = Base::Matrix4D();
+
+    AbaqusReader reader;
+    reader.read(Base::FileInfo(FileName));
+    reader.parse();
+
+    Base::Console().Log("    %f: File read, start building mesh\n",
+                        Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
+
+    SMESHDS_Mesh* meshds = this->myMesh->GetMeshDS();
+    meshds->ClearMesh();
+    reader.addToMesh(meshds);
 
-    PyObject* module = PyImport_ImportModule("feminout.importInpMesh");
-    if (!module) {
-        return;
-    }
-    try {
-        Py::Module abaqusmod(module, true);
-        Py::Callable method(abaqusmod.getAttr("read"));
-        Py::Tuple args(1);
-        args.setItem(0, Py::String(FileName));
-        Py::Object mesh(method.apply(args));
-        if (PyObject_TypeCheck(mesh.ptr(), &FemMeshPy::Type)) {
-            FemMeshPy* fempy = static_cast<FemMeshPy*>(mesh.ptr());
-            FemMesh* fem = fempy->getFemMeshPtr();
-            *this = *fem;  // the deep copy should be avoided, a pointer swap method could be
-                           // implemented see
-                           // https://forum.freecad.org/viewtopic.php?f=10&t=31999&start=10#p274241
-        }
-        else {
-            throw Base::FileException("Problems reading file");
-        }
-    }
-    catch (Py::Exception& e) {
-        e.clear();
-    }
     Base::Console().Log("    %f: Done \n",
                         Base::TimeElapsed::diffTimeF(Start, Base::TimeElapsed()));
 }
@@ -1569,6 +2088,8 @@ void FemMesh::readZ88(const std::string& FileName)
     'Mod/Fem/femtest/data/mesh/tetra10_mesh.z88')
     */
 
+    // FemMeshPy::read() calls this without holding the GIL
+    Base::PyGILStateLocker lock;
     PyObject* module = PyImport_ImportModule("feminout.importZ88Mesh");
     if (!module) {
         return;
@@ -1652,6 +2173,117 @@ void FemMesh::writeVTK(const std::string& fileName, bool highest) const
     FemVTKTools::writeVTKMesh(fileName.c_str(), this, highest);
 }
 
+namespace
+{
+
+struct AbaqusNode
+{
+    int id;
+    Base::Vector3d point;
+};
+
+/** Formats the lines [0, count) with writeLine(buffer, index) and writes them to \a out in
+ * order. The lines are formatted in parallel, batch by batch to limit the size of the buffers.
+ */
+template<typename Func>
+void writeAbaqusLines(std::ostream& out, std::size_t count, Func writeLine)
+{
+    const std::size_t batchSize = 1000000;
+    for (std::size_t first = 0; first < count; first += batchSize) {
+        std::size_t last = std::min(first + batchSize, count);
+        std::mutex mutex;
+        std::map<std::size_t, std::string> chunks;
+        parallelChunks(last - first, [&](std::size_t begin, std::size_t end) {
+            std::string buffer;
+            for (std::size_t i = begin; i < end; i++) {
+                writeLine(buffer, first + i);
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            chunks.emplace(begin, std::move(buffer));
+        });
+        for (const auto& it : chunks) {
+            out.write(it.second.data(), static_cast<std::streamsize>(it.second.size()));
+        }
+    }
+}
+
+/// The elements of one CalculiX element type with their nodes in CalculiX order
+struct AbaqusElements
+{
+    std::size_t numNodes = 0;
+    std::vector<int> ids;
+    std::vector<int> nodes;
+
+    void sort()
+    {
+        if (std::is_sorted(ids.begin(), ids.end())) {
+            return;
+        }
+
+        std::vector<std::size_t> order(ids.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+            return ids[a] < ids[b];
+        });
+
+        std::vector<int> sortedIds;
+        std::vector<int> sortedNodes;
+        sortedIds.reserve(ids.size());
+        sortedNodes.reserve(nodes.size());
+        for (std::size_t i : order) {
+            sortedIds.push_back(ids[i]);
+            auto elemNodes = nodes.begin() + static_cast<std::ptrdiff_t>(i * numNodes);
+            sortedNodes.insert(sortedNodes.end(),
+                               elemNodes,
+                               elemNodes + static_cast<std::ptrdiff_t>(numNodes));
+        }
+        ids.swap(sortedIds);
+        nodes.swap(sortedNodes);
+    }
+
+    /// Writes one element per line, the nodes after the first \a maxNodes go to a second line
+    void write(std::ostream& out, std::size_t maxNodes = 0) const
+    {
+        writeAbaqusLines(out, ids.size(), [this, maxNodes](std::string& buffer, std::size_t i) {
+            auto it = std::back_inserter(buffer);
+            fmt::format_to(it, "{}", ids[i]);
+            const int* elemNodes = &nodes[i * numNodes];
+            for (std::size_t k = 0; k < numNodes; k++) {
+                if (maxNodes > 0 && k == maxNodes) {
+                    fmt::format_to(it, ",\n{}", elemNodes[k]);
+                }
+                else {
+                    fmt::format_to(it, ", {}", elemNodes[k]);
+                }
+            }
+            buffer += '\n';
+        });
+    }
+};
+
+using AbaqusElementsMap = std::map<std::string, AbaqusElements>;
+
+void addAbaqusElement(AbaqusElementsMap& elements,
+                      const std::map<int, std::string>& typeMap,
+                      const std::map<std::string, std::vector<int>>& orderMap,
+                      const SMDS_MeshElement* elem)
+{
+    auto it = typeMap.find(elem->NbNodes());
+    if (it == typeMap.end()) {
+        return;
+    }
+
+    const std::vector<int>& order = orderMap.at(it->second);
+    AbaqusElements& block = elements[it->second];
+    block.numNodes = order.size();
+    block.ids.push_back(elem->GetID());
+    for (int jt : order) {
+        block.nodes.push_back(elem->GetNode(jt)->GetID());
+    }
+}
+
+}  // namespace
+
 void FemMesh::writeABAQUS(const std::string& Filename,
                           int elemParam,
                           bool groupParam,
@@ -1883,118 +2515,74 @@ void FemMesh::writeABAQUS(const std::string& Filename,
 
 
     // get all data --> Extract Nodes and Elements of the current SMESH datastructure
-    using VertexMap = std::map<int, Base::Vector3d>;
-    using NodesMap = std::map<int, std::vector<int>>;
-    using ElementsMap = std::map<std::string, NodesMap>;
+    const SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
 
     // get nodes
-    VertexMap vertexMap;  // empty nodes map
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    Base::Vector3d current_node;
+    std::vector<AbaqusNode> nodes;
+    nodes.reserve(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
     while (aNodeIter->more()) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
-        current_node.Set(aNode->X(), aNode->Y(), aNode->Z());
-        current_node = _Mtrx * current_node;
-        vertexMap[aNode->GetID()] = current_node;
+        Base::Vector3d point(aNode->X(), aNode->Y(), aNode->Z());
+        nodes.push_back({aNode->GetID(), _Mtrx * point});
+    }
+    // This way we get sorted output.
+    // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
+    auto lessId = [](const AbaqusNode& a, const AbaqusNode& b) {
+        return a.id < b.id;
+    };
+    if (!std::is_sorted(nodes.begin(), nodes.end(), lessId)) {
+        std::sort(nodes.begin(), nodes.end(), lessId);
     }
 
     // get volumes
-    ElementsMap elementsMapVol;  // empty volumes map
-    SMDS_VolumeIteratorPtr aVolIter = myMesh->GetMeshDS()->volumesIterator();
+    AbaqusElementsMap elementsMapVol;  // empty volumes map
+    SMDS_VolumeIteratorPtr aVolIter = meshDS->volumesIterator();
     while (aVolIter->more()) {
-        const SMDS_MeshVolume* aVol = aVolIter->next();
-        std::pair<int, std::vector<int>> apair;
-        apair.first = aVol->GetID();
-        int numNodes = aVol->NbNodes();
-        std::map<int, std::string>::iterator it = volTypeMap.find(numNodes);
-        if (it != volTypeMap.end()) {
-            const std::vector<int>& order = elemOrderMap[it->second];
-            for (int jt : order) {
-                apair.second.push_back(aVol->GetNode(jt)->GetID());
-            }
-            elementsMapVol[it->second].insert(apair);
-        }
+        addAbaqusElement(elementsMapVol, volTypeMap, elemOrderMap, aVolIter->next());
     }
 
     // get faces
-    ElementsMap elementsMapFac;  // empty faces map used for elemParam = 1
-                                 // and elementsMapVol is not empty
+    AbaqusElementsMap elementsMapFac;  // empty faces map used for elemParam = 1
+                                       // and elementsMapVol is not empty
     if ((elemParam == 0) || (elemParam == 1 && elementsMapVol.empty())) {
         // for elemParam = 1 we only fill the elementsMapFac if the elmentsMapVol is empty
         // we're going to fill the elementsMapFac with all faces
-        SMDS_FaceIteratorPtr aFaceIter = myMesh->GetMeshDS()->facesIterator();
+        SMDS_FaceIteratorPtr aFaceIter = meshDS->facesIterator();
         while (aFaceIter->more()) {
-            const SMDS_MeshFace* aFace = aFaceIter->next();
-            std::pair<int, std::vector<int>> apair;
-            apair.first = aFace->GetID();
-            int numNodes = aFace->NbNodes();
-            std::map<int, std::string>::iterator it = faceTypeMap.find(numNodes);
-            if (it != faceTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aFace->GetNode(jt)->GetID());
-                }
-                elementsMapFac[it->second].insert(apair);
-            }
+            addAbaqusElement(elementsMapFac, faceTypeMap, elemOrderMap, aFaceIter->next());
         }
     }
     if (elemParam == 2) {
         // we're going to fill the elementsMapFac with the facesOnly
         std::set<int> facesOnly = getFacesOnly();
         for (int itfa : facesOnly) {
-            std::pair<int, std::vector<int>> apair;
-            apair.first = itfa;
-            const SMDS_MeshElement* aFace = myMesh->GetMeshDS()->FindElement(itfa);
-            int numNodes = aFace->NbNodes();
-            std::map<int, std::string>::iterator it = faceTypeMap.find(numNodes);
-            if (it != faceTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aFace->GetNode(jt)->GetID());
-                }
-                elementsMapFac[it->second].insert(apair);
-            }
+            addAbaqusElement(elementsMapFac, faceTypeMap, elemOrderMap, meshDS->FindElement(itfa));
         }
     }
 
     // get edges
-    ElementsMap elementsMapEdg;  // empty edges map used for elemParam == 1
-                                 // and either elementMapVol or elementsMapFac are not empty
+    AbaqusElementsMap elementsMapEdg;  // empty edges map used for elemParam == 1
+                                       // and either elementMapVol or elementsMapFac are not empty
     if ((elemParam == 0) || (elemParam == 1 && elementsMapVol.empty() && elementsMapFac.empty())) {
         // for elemParam = 1 we only fill the elementsMapEdg if the elmentsMapVol
         // and elmentsMapFac are empty we're going to fill the elementsMapEdg with all edges
-        SMDS_EdgeIteratorPtr aEdgeIter = myMesh->GetMeshDS()->edgesIterator();
+        SMDS_EdgeIteratorPtr aEdgeIter = meshDS->edgesIterator();
         while (aEdgeIter->more()) {
-            const SMDS_MeshEdge* aEdge = aEdgeIter->next();
-            std::pair<int, std::vector<int>> apair;
-            apair.first = aEdge->GetID();
-            int numNodes = aEdge->NbNodes();
-            std::map<int, std::string>::iterator it = edgeTypeMap.find(numNodes);
-            if (it != edgeTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aEdge->GetNode(jt)->GetID());
-                }
-                elementsMapEdg[it->second].insert(apair);
-            }
+            addAbaqusElement(elementsMapEdg, edgeTypeMap, elemOrderMap, aEdgeIter->next());
         }
     }
     if (elemParam == 2) {
         // we're going to fill the elementsMapEdg with the edgesOnly
         std::set<int> edgesOnly = getEdgesOnly();
         for (int ited : edgesOnly) {
-            std::pair<int, std::vector<int>> apair;
-            apair.first = ited;
-            const SMDS_MeshElement* aEdge = myMesh->GetMeshDS()->FindElement(ited);
-            int numNodes = aEdge->NbNodes();
-            std::map<int, std::string>::iterator it = edgeTypeMap.find(numNodes);
-            if (it != edgeTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (int jt : order) {
-                    apair.second.push_back(aEdge->GetNode(jt)->GetID());
-                }
-                elementsMapEdg[it->second].insert(apair);
-            }
+            addAbaqusElement(elementsMapEdg, edgeTypeMap, elemOrderMap, meshDS->FindElement(ited));
+        }
+    }
+
+    for (auto* elementsMap : {&elementsMapVol, &elementsMapFac, &elementsMapEdg}) {
+        for (auto& it : *elementsMap) {
+            it.second.sort();
         }
     }
 
@@ -2003,24 +2591,19 @@ void FemMesh::writeABAQUS(const std::string& Filename,
     // https://forum.freecad.org/viewtopic.php?f=10&t=37436
     Base::FileInfo fi(Filename);
     Base::ofstream anABAQUS_Output(fi);
-    // https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
-    anABAQUS_Output.precision(13);
 
     // add some text and make sure one of the known elemParam values is used
-    anABAQUS_Output << "** written by FreeCAD inp file writer for CalculiX,Abaqus meshes"
-                    << std::endl;
+    anABAQUS_Output << "** written by FreeCAD inp file writer for CalculiX,Abaqus meshes\n";
     switch (elemParam) {
         case 0:
-            anABAQUS_Output << "** all mesh elements." << std::endl << std::endl;
+            anABAQUS_Output << "** all mesh elements.\n\n";
             break;
         case 1:
-            anABAQUS_Output << "** highest dimension mesh elements only." << std::endl << std::endl;
+            anABAQUS_Output << "** highest dimension mesh elements only.\n\n";
             break;
         case 2:
             anABAQUS_Output << "** FEM mesh elements only (edges if they do not belong to faces "
-                               "and faces if they do not belong to volumes)."
-                            << std::endl
-                            << std::endl;
+                               "and faces if they do not belong to volumes).\n\n";
             break;
         default:
             anABAQUS_Output << "** Problem on writing" << std::endl;
@@ -2030,8 +2613,8 @@ void FemMesh::writeABAQUS(const std::string& Filename,
     }
 
     // write nodes
-    anABAQUS_Output << "** Nodes" << std::endl;
-    anABAQUS_Output << "*Node, NSET=Nall" << std::endl;
+    anABAQUS_Output << "** Nodes\n";
+    anABAQUS_Output << "*Node, NSET=Nall\n";
 
     // Axisymmetric, plane strain and plane stress elements expect nodes in the plane z=0.
     // Set the z coordinate to 0 to avoid possible rounding errors.
@@ -2043,11 +2626,13 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         case ABAQUS_FaceVariant::Axisymmetric:
         case ABAQUS_FaceVariant::Axisymmetric_Reduced:
             for (const auto& elMap : elementsMapFac) {
-                const NodesMap& nodeMap = elMap.second;
-                for (const auto& nodes : nodeMap) {
-                    for (int n : nodes.second) {
-                        Base::Vector3d& vertex = vertexMap[n];
-                        vertex.z = 0.0;
+                for (int n : elMap.second.nodes) {
+                    auto node = std::lower_bound(nodes.begin(),
+                                                 nodes.end(),
+                                                 AbaqusNode {n, Base::Vector3d()},
+                                                 lessId);
+                    if (node != nodes.end() && node->id == n) {
+                        node->point.z = 0.0;
                     }
                 }
             }
@@ -2056,60 +2641,38 @@ void FemMesh::writeABAQUS(const std::string& Filename,
             break;
     }
 
-    // This way we get sorted output.
-    // See https://forum.freecad.org/viewtopic.php?f=18&t=12646&start=40#p103004
-    for (const auto& it : vertexMap) {
-        anABAQUS_Output << it.first << ", " << it.second.x << ", " << it.second.y << ", "
-                        << it.second.z << std::endl;
-    }
-    anABAQUS_Output << std::endl << std::endl;
-    ;
+    // https://forum.freecad.org/viewtopic.php?f=18&t=22759#p176669
+    writeAbaqusLines(anABAQUS_Output, nodes.size(), [&nodes](std::string& buffer, std::size_t i) {
+        const AbaqusNode& node = nodes[i];
+        fmt::format_to(std::back_inserter(buffer),
+                       "{}, {:.13g}, {:.13g}, {:.13g}\n",
+                       node.id,
+                       node.point.x,
+                       node.point.y,
+                       node.point.z);
+    });
+    anABAQUS_Output << "\n\n";
 
 
     // write volumes to file
     std::string elsetname;
     if (!elementsMapVol.empty()) {
         for (const auto& it : elementsMapVol) {
-            anABAQUS_Output << "** Volume elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                // Calculix allows max 16 entries in one line, a hexa20 has more !
-                int ct = 0;  // counter
-                bool first_line = true;
-                for (auto kt = jt.second.begin(); kt != jt.second.end(); ++kt, ++ct) {
-                    if (ct < 15) {
-                        anABAQUS_Output << ", " << *kt;
-                    }
-                    else {
-                        if (first_line) {
-                            anABAQUS_Output << "," << std::endl << *kt;
-                            first_line = false;
-                        }
-                        else {
-                            anABAQUS_Output << ", " << *kt;
-                        }
-                    }
-                }
-                anABAQUS_Output << std::endl;
-            }
+            anABAQUS_Output << "** Volume elements\n";
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Evolumes\n";
+            // Calculix allows max 16 entries in one line, a hexa20 has more !
+            it.second.write(anABAQUS_Output, 15);
         }
         elsetname += "Evolumes";
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write faces to file
     if (!elementsMapFac.empty()) {
         for (const auto& it : elementsMapFac) {
-            anABAQUS_Output << "** Face elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            anABAQUS_Output << "** Face elements\n";
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Efaces\n";
+            it.second.write(anABAQUS_Output);
         }
         if (elsetname.empty()) {
             elsetname += "Efaces";
@@ -2117,21 +2680,15 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         else {
             elsetname += ", Efaces";
         }
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write edges to file
     if (!elementsMapEdg.empty()) {
         for (const auto& it : elementsMapEdg) {
-            anABAQUS_Output << "** Edge elements" << std::endl;
-            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges" << std::endl;
-            for (const auto& jt : it.second) {
-                anABAQUS_Output << jt.first;
-                for (int kt : jt.second) {
-                    anABAQUS_Output << ", " << kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            anABAQUS_Output << "** Edge elements\n";
+            anABAQUS_Output << "*Element, TYPE=" << it.first << ", ELSET=Eedges\n";
+            it.second.write(anABAQUS_Output);
         }
         if (elsetname.empty()) {
             elsetname += "Eedges";
@@ -2139,13 +2696,13 @@ void FemMesh::writeABAQUS(const std::string& Filename,
         else {
             elsetname += ", Eedges";
         }
-        anABAQUS_Output << std::endl;
+        anABAQUS_Output << '\n';
     }
 
     // write elset Eall
-    anABAQUS_Output << "** Define element set Eall" << std::endl;
-    anABAQUS_Output << "*ELSET, ELSET=Eall" << std::endl;
-    anABAQUS_Output << elsetname << std::endl;
+    anABAQUS_Output << "** Define element set Eall\n";
+    anABAQUS_Output << "*ELSET, ELSET=Eall\n";
+    anABAQUS_Output << elsetname << '\n';
 
     // groups
     if (!groupParam) {
@@ -2153,7 +2710,7 @@ void FemMesh::writeABAQUS(const std::string& Filename,
     }
     else {
         // get and write group data
-        anABAQUS_Output << std::endl << "** Group data" << std::endl;
+        anABAQUS_Output << "\n** Group data\n";
 
         std::list<int> groupIDs = myMesh->GetGroupIds();
         for (int it : groupIDs) {
@@ -2191,28 +2748,31 @@ void FemMesh::writeABAQUS(const std::string& Filename,
             }
             const char* groupName = myMesh->GetGroup(it)->GetName();
             anABAQUS_Output << "** GroupID: " << (it) << " --> GroupName: " << groupName
-                            << " --> GroupElementType: " << groupElementType << std::endl;
+                            << " --> GroupElementType: " << groupElementType << '\n';
 
             if (aElementType == SMDSAbs_Node) {
-                anABAQUS_Output << "*NSET, NSET=" << groupName << std::endl;
+                anABAQUS_Output << "*NSET, NSET=" << groupName << '\n';
             }
             else {
-                anABAQUS_Output << "*ELSET, ELSET=" << groupName << std::endl;
+                anABAQUS_Output << "*ELSET, ELSET=" << groupName << '\n';
             }
 
             // get and write group elements
-            std::set<int> ids;
+            std::vector<int> ids;
             SMDS_ElemIteratorPtr aElemIter = myMesh->GetGroup(it)->GetGroupDS()->GetElements();
             while (aElemIter->more()) {
                 const SMDS_MeshElement* aElement = aElemIter->next();
-                ids.insert(aElement->GetID());
-            }
-            for (int it : ids) {
-                anABAQUS_Output << it << std::endl;
+                ids.push_back(aElement->GetID());
             }
+            std::sort(ids.begin(), ids.end());
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+            auto writeId = [&ids](std::string& buffer, std::size_t i) {
+                fmt::format_to(std::back_inserter(buffer), "{}\n", ids[i]);
+            };
+            writeAbaqusLines(anABAQUS_Output, ids.size(), writeId);
 
             // write newline after each group
-            anABAQUS_Output << std::endl;
+            anABAQUS_Output << '\n';
         }
         anABAQUS_Output.close();
     }
@@ -2405,15 +2965,25 @@ void FemMesh::RestoreDocFile(Base::Reader& reader)
 
 void FemMesh::transformGeometry(const Base::Matrix4D& rclTrf)
 {
-    // We perform a translation and rotation of the current active Mesh object
-    Base::Matrix4D clMatrix(rclTrf);
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    Base::Vector3d current_node;
+    // We perform a translation and rotation of the current active Mesh object.
+    // The nodes are not stored contiguously, so gather their coordinates first
+    // to transform them with the batch kernel in one go.
+    SMESHDS_Mesh* meshDS = myMesh->GetMeshDS();
+    std::vector<const SMDS_MeshNode*> nodes;
+    std::vector<Base::Vector3d> points;
+    nodes.reserve(meshDS->NbNodes());
+    points.reserve(meshDS->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
     for (; aNodeIter->more();) {
         const SMDS_MeshNode* aNode = aNodeIter->next();
-        current_node.Set(aNode->X(), aNode->Y(), aNode->Z());
-        current_node = clMatrix * current_node;
-        myMesh->GetMeshDS()->MoveNode(aNode, current_node.x, current_node.y, current_node.z);
+        nodes.push_back(aNode);
+        points.emplace_back(aNode->X(), aNode->Y(), aNode->Z());
+    }
+
+    rclTrf.multVec(points.data(), points.data(), points.size());
+
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        meshDS->MoveNode(nodes[i], points[i].x, points[i].y, points[i].z);
     }
 }
 
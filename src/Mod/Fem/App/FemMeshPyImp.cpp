@@ -38,6 +38,7 @@
 #endif
 
 #include "Mod/Fem/App/FemMesh.h"
+#include <Base/Interpreter.h>
 #include <Base/PlacementPy.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/QuantityPy.h>
@@ -1098,6 +1099,8 @@ PyObject* FemMeshPy::read(PyObject* args)
     PyMem_Free(Name);
 
     try {
+        // the mesh is read in place, see PyGILStateRelease
+        Base::PyGILStateRelease release;
         getFemMeshPtr()->read(EncodedName.c_str());
     }
     catch (const std::exception& e) {
@@ -25,6 +25,8 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
+#include <thread>
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
 
@@ -76,6 +78,11 @@ FemMeshShapeNetgenObject::FemMeshShapeNetgenObject()
         Prop_None,
         "allows defining the minimum number of mesh segments in which radii will be split");
     ADD_PROPERTY_TYPE(Optimize, (true), "MeshParams", Prop_None, "Optimize the resulting mesh");
+    ADD_PROPERTY_TYPE(ParallelMeshing,
+                      (false),
+                      "MeshParams",
+                      Prop_None,
+                      "Mesh the volumes of the solids of a compound in parallel");
 }
 
 FemMeshShapeNetgenObject::~FemMeshShapeNetgenObject() = default;
@@ -111,6 +118,10 @@ App::DocumentObjectExecReturn* FemMeshShapeNetgenObject::execute()
         tet->SetNbSegPerRadius(NbSegsPerRadius.getValue());
     }
     myNetGenMesher.SetParameters(tet);
+    if (ParallelMeshing.getValue()) {
+        myNetGenMesher.SetNbThreads(
+            static_cast<int>(std::max(1U, std::thread::hardware_concurrency())));
+    }
     newMesh.getSMesh()->ShapeToMesh(shape);
 
     myNetGenMesher.Compute();
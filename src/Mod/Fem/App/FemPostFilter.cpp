@@ -73,21 +73,39 @@ DocumentObjectExecReturn* FemPostFilter::execute()
             return StdReturn;
         }
 
+        vtkAlgorithm* target = nullptr;
         if ((m_activePipeline == "DataAlongLine") || (m_activePipeline == "DataAtPoint")) {
-            pipe.filterSource->SetSourceData(getInputData());
-            pipe.filterTarget->Update();
-            Data.setValue(pipe.filterTarget->GetOutputDataObject(0));
+            pipe.filterSource->SetSourceData(data);
+            target = pipe.filterTarget;
         }
         else {
             pipe.source->SetInputDataObject(data);
-            pipe.target->Update();
-            Data.setValue(pipe.target->GetOutputDataObject(0));
+            target = pipe.target;
+        }
+        target->Update();
+
+        // VTK only re-executes the filters whose input or settings have changed. If nothing
+        // did the output is kept, that saves the copy and keeps the filters downstream valid.
+        vtkDataObject* output = target->GetOutputDataObject(0);
+        if (!isCachedOutput(output)) {
+            Data.setValue(output);
+            m_cachedPipeline = m_activePipeline;
+            m_cachedOutputTime = output->GetMTime();
+            m_cachedDataTime = Data.getValue() ? Data.getValue()->GetMTime() : 0;
         }
     }
 
     return StdReturn;
 }
 
+bool FemPostFilter::isCachedOutput(vtkDataObject* output) const
+{
+    // Data may have been replaced meanwhile, e.g. by undo or when restoring the document
+    const vtkSmartPointer<vtkDataObject>& data = Data.getValue();
+    return output && data && m_cachedPipeline == m_activePipeline
+        && m_cachedOutputTime == output->GetMTime() && m_cachedDataTime == data->GetMTime();
+}
+
 vtkDataObject* FemPostFilter::getInputData()
 {
     if (Input.getValue()) {
@@ -74,9 +74,17 @@ protected:
     FilterPipeline& getFilterPipeline(std::string name);
 
 private:
+    /// Checks if \a output is the one which has already been copied to Data
+    bool isCachedOutput(vtkDataObject* output) const;
+
     // handling of multiple pipelines which can be the filter
     std::map<std::string, FilterPipeline> m_pipelines;
     std::string m_activePipeline;
+
+    // the output of the last execution
+    std::string m_cachedPipeline;
+    vtkMTimeType m_cachedOutputTime = 0;
+    vtkMTimeType m_cachedDataTime = 0;
 };
 
 class FemExport FemPostSmoothFilterExtension: public App::DocumentObjectExtension
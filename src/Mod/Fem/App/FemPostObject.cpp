@@ -31,6 +31,7 @@
 
 #include "FemPostObject.h"
 #include "FemPostObjectPy.h"
+#include "FemVTKTools.h"
 
 
 using namespace Fem;
@@ -83,7 +84,7 @@ void femVTKWriter(const char* filename, const vtkSmartPointer<vtkDataObject>& da
 
     vtkSmartPointer<T> writer = vtkSmartPointer<T>::New();
     writer->SetFileName(filename);
-    writer->SetDataModeToBinary();
+    FemVTKTools::configureXMLWriter(writer);
     writer->SetInputDataObject(dataObject);
     writer->Write();
 }
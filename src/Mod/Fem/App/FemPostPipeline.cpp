@@ -24,12 +24,16 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
+#include <cstring>
 #include <vtkAppendFilter.h>
 #include <vtkDataSetReader.h>
 #include <vtkImageData.h>
 #include <vtkRectilinearGrid.h>
 #include <vtkStructuredGrid.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkXMLDataElement.h>
+#include <vtkXMLDataParser.h>
 #include <vtkXMLImageDataReader.h>
 #include <vtkXMLPUnstructuredGridReader.h>
 #include <vtkXMLPolyDataReader.h>
@@ -75,6 +79,21 @@ FemPostPipeline::FemPostPipeline()
                       "In parallel, every filter gets the pipeline source as input.\n"
                       "In custom, every filter keeps its input set by the user.");
     Mode.setEnums(ModeEnums);
+    ADD_PROPERTY_TYPE(Frame,
+                      (long(0)),
+                      "Pipeline",
+                      App::Prop_None,
+                      "The frame of a time series which is shown");
+    ADD_PROPERTY_TYPE(FrameFiles,
+                      (),
+                      "Pipeline",
+                      App::PropertyType(App::Prop_Hidden | App::Prop_ReadOnly),
+                      "The data files of the time series");
+    ADD_PROPERTY_TYPE(FrameValues,
+                      (),
+                      "Pipeline",
+                      App::PropertyType(App::Prop_Hidden | App::Prop_ReadOnly),
+                      "The time values of the data files of the time series");
 }
 
 FemPostPipeline::~FemPostPipeline() = default;
@@ -98,7 +117,7 @@ bool FemPostPipeline::canRead(Base::FileInfo File)
 {
 
     // from FemResult only unstructural mesh is supported in femvtktoools.cpp
-    return File.hasExtension({"vtk", "vtp", "vts", "vtr", "vti", "vtu", "pvtu"});
+    return File.hasExtension({"vtk", "vtp", "vts", "vtr", "vti", "vtu", "pvtu", "pvd"});
 }
 
 void FemPostPipeline::read(Base::FileInfo File)
@@ -109,39 +128,187 @@ void FemPostPipeline::read(Base::FileInfo File)
         throw Base::FileException("File to load not existing or not readable", File);
     }
 
+    m_frameCache.clear();
+    m_scale = 1.0;
+    if (File.hasExtension("pvd")) {
+        readCollection(File);
+        return;
+    }
+
+    vtkSmartPointer<vtkDataObject> data = readFile(File);
+    FrameValues.setValues(std::vector<double>());
+    FrameFiles.setValues(std::vector<std::string>());
+    Frame.setEnums(std::vector<std::string>());
+    Data.setValue(data);
+}
+
+vtkSmartPointer<vtkDataObject> FemPostPipeline::readFile(Base::FileInfo File)
+{
     if (File.hasExtension("vtu")) {
-        readXMLFile<vtkXMLUnstructuredGridReader>(File.filePath());
+        return readXMLFile<vtkXMLUnstructuredGridReader>(File.filePath());
     }
     else if (File.hasExtension("pvtu")) {
-        readXMLFile<vtkXMLPUnstructuredGridReader>(File.filePath());
+        return readXMLFile<vtkXMLPUnstructuredGridReader>(File.filePath());
     }
     else if (File.hasExtension("vtp")) {
-        readXMLFile<vtkXMLPolyDataReader>(File.filePath());
+        return readXMLFile<vtkXMLPolyDataReader>(File.filePath());
     }
     else if (File.hasExtension("vts")) {
-        readXMLFile<vtkXMLStructuredGridReader>(File.filePath());
+        return readXMLFile<vtkXMLStructuredGridReader>(File.filePath());
     }
     else if (File.hasExtension("vtr")) {
-        readXMLFile<vtkXMLRectilinearGridReader>(File.filePath());
+        return readXMLFile<vtkXMLRectilinearGridReader>(File.filePath());
     }
     else if (File.hasExtension("vti")) {
-        readXMLFile<vtkXMLImageDataReader>(File.filePath());
+        return readXMLFile<vtkXMLImageDataReader>(File.filePath());
     }
     else if (File.hasExtension("vtk")) {
-        readXMLFile<vtkDataSetReader>(File.filePath());
+        return readXMLFile<vtkDataSetReader>(File.filePath());
     }
     else {
         throw Base::FileException("Unknown extension");
     }
 }
 
+void FemPostPipeline::readCollection(Base::FileInfo File)
+{
+    vtkSmartPointer<vtkXMLDataParser> parser = vtkSmartPointer<vtkXMLDataParser>::New();
+    parser->SetFileName(File.filePath().c_str());
+    vtkXMLDataElement* root = parser->Parse() ? parser->GetRootElement() : nullptr;
+    vtkXMLDataElement* collection = root ? root->FindNestedElementWithName("Collection") : nullptr;
+    if (!collection) {
+        throw Base::FileException("File is not a valid ParaView collection", File);
+    }
+
+    // only the index of the data sets is kept, a data set may consist of several parts
+    std::vector<std::string> files;
+    std::vector<double> values;
+    for (int i = 0; i < collection->GetNumberOfNestedElements(); i++) {
+        vtkXMLDataElement* dataSet = collection->GetNestedElement(i);
+        const char* file = dataSet->GetAttribute("file");
+        if (strcmp(dataSet->GetName(), "DataSet") != 0 || !file) {
+            continue;
+        }
+
+        // the paths are relative to the collection file
+        Base::FileInfo part(File.dirPath() + "/" + file);
+        if (!part.exists()) {
+            part.setFile(file);
+        }
+
+        double value = 0.0;
+        dataSet->GetScalarAttribute("timestep", value);
+        files.push_back(part.filePath());
+        values.push_back(value);
+    }
+    if (files.empty()) {
+        throw Base::FileException("ParaView collection contains no data sets", File);
+    }
+
+    FrameValues.setValues(values);
+    FrameFiles.setValues(files);
+
+    std::vector<std::string> frames;
+    for (double value : getFrameValues()) {
+        frames.push_back(fmt::format("{:g}", value));
+    }
+    // setting the frame loads its data
+    Frame.setEnums(frames);
+    Frame.setValue(long(0));
+}
+
+std::vector<double> FemPostPipeline::getFrameValues() const
+{
+    std::vector<double> frames;
+    for (double value : FrameValues.getValues()) {
+        if (std::find(frames.begin(), frames.end(), value) == frames.end()) {
+            frames.push_back(value);
+        }
+    }
+    return frames;
+}
+
+vtkSmartPointer<vtkDataObject> FemPostPipeline::loadFrame(long frame)
+{
+    std::vector<double> frames = getFrameValues();
+    if (frame < 0 || frame >= long(frames.size())) {
+        return nullptr;
+    }
+
+    double time = frames[frame];
+    auto it = std::find_if(m_frameCache.begin(), m_frameCache.end(), [time](const auto& entry) {
+        return entry.first == time;
+    });
+    if (it != m_frameCache.end()) {
+        m_frameCache.splice(m_frameCache.begin(), m_frameCache, it);
+        return it->second;
+    }
+
+    // read all parts of the frame
+    const std::vector<std::string>& files = FrameFiles.getValues();
+    const std::vector<double>& values = FrameValues.getValues();
+    vtkSmartPointer<vtkDataObject> data;
+    vtkSmartPointer<vtkAppendFilter> append;
+    for (std::size_t i = 0; i < files.size() && i < values.size(); i++) {
+        if (values[i] != time) {
+            continue;
+        }
+
+        vtkSmartPointer<vtkDataObject> part = readFile(Base::FileInfo(files[i]));
+        if (!data) {
+            data = part;
+        }
+        else {
+            if (!append) {
+                append = vtkSmartPointer<vtkAppendFilter>::New();
+                append->AddInputData(data);
+            }
+            append->AddInputData(part);
+        }
+    }
+    if (append) {
+        append->Update();
+        data = append->GetOutput();
+    }
+
+    m_frameCache.emplace_front(time, data);
+    if (m_frameCache.size() > FrameCacheSize) {
+        m_frameCache.pop_back();
+    }
+    return data;
+}
+
+void FemPostPipeline::showFrame()
+{
+    if (FrameFiles.getValues().empty() || !Frame.isValid()) {
+        return;
+    }
+
+    Data.setValue(loadFrame(Frame.getValue()));
+    if (m_scale != 1.0) {
+        Data.scale(m_scale);
+    }
+    recomputeChildren();
+}
+
 void FemPostPipeline::scale(double s)
 {
+    // the scale is also applied to the frames loaded later on
+    m_scale *= s;
     Data.scale(s);
 }
 
 void FemPostPipeline::onChanged(const Property* prop)
 {
+    if (prop == &Frame && !isRestoring()) {
+        try {
+            showFrame();
+        }
+        catch (Base::Exception& e) {
+            e.ReportException();
+        }
+    }
+
     if (prop == &Filter || prop == &Mode) {
 
         // if we are in custom mode the user is free to set the input
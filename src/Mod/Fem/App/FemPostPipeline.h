@@ -27,6 +27,8 @@
 #include "FemPostObject.h"
 #include "FemResultObject.h"
 
+#include <list>
+
 #include <vtkSmartPointer.h>
 
 
@@ -45,6 +47,9 @@ public:
     App::PropertyLinkList Filter;
     App::PropertyLink Functions;
     App::PropertyEnumeration Mode;
+    App::PropertyEnumeration Frame;
+    App::PropertyStringList FrameFiles;
+    App::PropertyFloatList FrameValues;
 
     short mustExecute() const override;
     App::DocumentObjectExecReturn* execute() override;
@@ -63,6 +68,10 @@ public:
     // load from results
     void load(FemResultObject* res);
 
+    // time series handling
+    /// Returns the time values of the frames
+    std::vector<double> getFrameValues() const;
+
     // Pipeline handling
     void recomputeChildren();
     FemPostObject* getLastPostObject();
@@ -74,15 +83,32 @@ protected:
 private:
     static const char* ModeEnums[];
 
+    /// Maximum number of frames kept in memory
+    static constexpr std::size_t FrameCacheSize = 4;
+
+    /** Indexes the data sets of a ParaView collection (*.pvd), their time values become the
+     * frames. Only the data of the selected frame is loaded.
+     */
+    void readCollection(Base::FileInfo file);
+    /// Returns the data of a frame, reading and caching it if it isn't in the cache
+    vtkSmartPointer<vtkDataObject> loadFrame(long frame);
+    void showFrame();
+
+    static vtkSmartPointer<vtkDataObject> readFile(Base::FileInfo file);
+
     template<class TReader>
-    void readXMLFile(std::string file)
+    static vtkSmartPointer<vtkDataObject> readXMLFile(std::string file)
     {
 
         vtkSmartPointer<TReader> reader = vtkSmartPointer<TReader>::New();
         reader->SetFileName(file.c_str());
         reader->Update();
-        Data.setValue(reader->GetOutput());
+        return reader->GetOutput();
     }
+
+    /// The most recently used frames first, with their time value
+    std::list<std::pair<double, vtkSmartPointer<vtkDataObject>>> m_frameCache;
+    double m_scale {1.0};
 };
 
 }  // namespace Fem
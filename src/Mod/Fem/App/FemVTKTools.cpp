@@ -25,10 +25,12 @@
 
 #ifndef _PreComp_
 #include <Python.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <type_traits>
 
 #include <SMESHDS_Mesh.hxx>
 #include <SMESH_Mesh.hxx>
@@ -55,10 +57,12 @@
 #include <vtkTriangle.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkVersionMacros.h>
 #include <vtkWedge.h>
 #include <vtkXMLPUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridReader.h>
 #include <vtkXMLUnstructuredGridWriter.h>
+#include <vtkXMLWriter.h>
 #endif
 
 #include <App/Application.h>
@@ -96,6 +100,9 @@ void writeVTKFile(const char* filename, vtkSmartPointer<vtkUnstructuredGrid> dat
     vtkSmartPointer<TWriter> writer = vtkSmartPointer<TWriter>::New();
     writer->SetFileName(filename);
     writer->SetInputData(dataset);
+    if constexpr (std::is_base_of_v<vtkXMLWriter, TWriter>) {
+        FemVTKTools::configureXMLWriter(writer);
+    }
     writer->Write();
 }
 
@@ -694,6 +701,29 @@ void FemVTKTools::writeResult(const char* filename, const App::DocumentObject* r
 }
 
 
+void FemVTKTools::configureXMLWriter(vtkXMLWriter* writer)
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Fem/InOutVtk");
+    std::string compressor = hGrp->GetASCII("Compressor", "ZLib");
+
+    // appended raw data saves the base64 encoding of inline binary data
+    writer->SetDataModeToAppended();
+    writer->EncodeAppendedDataOff();
+    if (compressor == "None") {
+        writer->SetCompressorTypeToNone();
+    }
+#if VTK_MAJOR_VERSION >= 9
+    else if (compressor == "LZ4") {
+        writer->SetCompressorTypeToLZ4();
+    }
+#endif
+    else {
+        writer->SetCompressorTypeToZLib();
+    }
+}
+
+
 std::map<std::string, std::string> _getFreeCADMechResultVectorProperties()
 {
     // see src/Mod/Fem/femobjects/_FemResultMechanical
@@ -810,13 +840,15 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
                 static_cast<App::PropertyVectorList*>(result->getPropertyByName(it.first.c_str()));
             if (vector_list) {
                 std::vector<Base::Vector3d> vec(nPoints);
+                double p[3];
                 for (vtkIdType i = 0; i < nPoints; ++i) {
-                    double* p = vector_field->GetTuple(
-                        i);  // both vtkFloatArray and vtkDoubleArray return double* for GetTuple(i)
-                    vec[i] = (Base::Vector3d(p[0], p[1], p[2]));
+                    // both vtkFloatArray and vtkDoubleArray convert to double
+                    vector_field->GetTuple(i, p);
+                    vec[i].Set(p[0], p[1], p[2]);
                 }
+                // the values are moved, a result with many steps must not be held twice
                 // PropertyVectorList will not show up in PropertyEditor
-                vector_list->setValues(vec);
+                vector_list->setValues(std::move(vec));
                 Base::Console().Log("    A PropertyVectorList has been filled with values: %s\n",
                                     it.first.c_str());
             }
@@ -846,19 +878,12 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset,
                 continue;
             }
 
-            double vmin = 1.0e100, vmax = -1.0e100;
             std::vector<double> values(nPoints, 0.0);
-            for (vtkIdType i = 0; i < vec->GetNumberOfTuples(); i++) {
-                double v = *(vec->GetTuple(i));
-                values[i] = v;
-                if (v > vmax) {
-                    vmax = v;
-                }
-                if (v < vmin) {
-                    vmin = v;
-                }
+            const vtkIdType nTuples = std::min(nPoints, vec->GetNumberOfTuples());
+            for (vtkIdType i = 0; i < nTuples; i++) {
+                values[i] = vec->GetComponent(i, 0);
             }
-            field->setValues(values);
+            field->setValues(std::move(values));
             Base::Console().Log("    A PropertyFloatList has been filled with vales: %s\n",
                                 scalar.first.c_str());
         }
@@ -920,15 +945,13 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result,
             data->SetNumberOfComponents(dim);
             data->SetNumberOfTuples(nPoints);
             data->SetName(it.second.c_str());
+            double* values = data->WritePointer(0, nPoints * dim);
 
             // we need to set values for the unused points.
             // TODO: ensure that the result bar does not include the used 0 if it is not
             // part of the result (e.g. does the result bar show 0 as smallest value?)
             if (nPoints != field->getSize()) {
-                double tuple[] = {0, 0, 0};
-                for (vtkIdType i = 0; i < nPoints; ++i) {
-                    data->SetTuple(i, tuple);
-                }
+                std::fill_n(values, nPoints * dim, 0.0);
             }
 
             if (it.first.compare("DisplacementVectors") == 0) {
@@ -941,8 +964,10 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result,
             SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
             for (const auto& jt : vel) {
                 const SMDS_MeshNode* node = aNodeIter->next();
-                double tuple[] = {jt.x * factor, jt.y * factor, jt.z * factor};
-                data->SetTuple(node->GetID() - 1, tuple);
+                double* tuple = values + (node->GetID() - 1) * dim;
+                tuple[0] = jt.x * factor;
+                tuple[1] = jt.y * factor;
+                tuple[2] = jt.z * factor;
             }
             grid->GetPointData()->AddArray(data);
             Base::Console().Log(
@@ -973,14 +998,13 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result,
             vtkSmartPointer<vtkDoubleArray> data = vtkSmartPointer<vtkDoubleArray>::New();
             data->SetNumberOfValues(nPoints);
             data->SetName(scalar.second.c_str());
+            double* values = data->WritePointer(0, nPoints);
 
             // we need to set values for the unused points.
             // TODO: ensure that the result bar does not include the used 0 if it is not part
             // of the result (e.g. does the result bar show 0 as smallest value?)
             if (nPoints != field->getSize()) {
-                for (vtkIdType i = 0; i < nPoints; ++i) {
-                    data->SetValue(i, 0);
-                }
+                std::fill_n(values, nPoints, 0.0);
             }
 
             if ((scalar.first.compare("MaxShear") == 0)
@@ -1009,7 +1033,7 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result,
                 const SMDS_MeshNode* node = aNodeIter->next();
                 // for the MassFlowRate the last vec entries can be a nullptr, thus check this
                 if (node) {
-                    data->SetValue(node->GetID() - 1, i * factor);
+                    values[node->GetID() - 1] = i * factor;
                 }
             }
 
@@ -31,6 +31,7 @@
 
 #include "FemMeshObject.h"
 
+class vtkXMLWriter;
 
 namespace Fem
 {
@@ -71,6 +72,9 @@ public:
 
     // write FemResult (activeObject if res= NULL) to vtkUnstructuredGrid dataset file
     static void writeResult(const char* filename, const App::DocumentObject* res = nullptr);
+
+    // set up a VTK XML writer for raw appended data compressed as set in the preferences
+    static void configureXMLWriter(vtkXMLWriter* writer);
 };
 }  // namespace Fem
 
@@ -49,6 +49,7 @@
 #include <Base/Writer.h>
 #include <CXX/Objects.hxx>
 
+#include "FemVTKTools.h"
 #include "PropertyPostDataObject.h"
 
 
@@ -320,7 +321,7 @@ void PropertyPostDataObject::SaveDocFile(Base::Writer& writer) const
     vtkSmartPointer<vtkXMLDataSetWriter> xmlWriter = vtkSmartPointer<vtkXMLDataSetWriter>::New();
     xmlWriter->SetInputDataObject(m_dataObject);
     xmlWriter->SetFileName(fi.filePath().c_str());
-    xmlWriter->SetDataModeToBinary();
+    FemVTKTools::configureXMLWriter(xmlWriter);
 
 #ifdef VTK_CELL_ARRAY_V2
     // Looks like an invalid data object that causes a crash with vtk9
@@ -52,6 +52,7 @@ void DlgSettingsFemInOutVtkImp::saveSettings()
 
     ui->comboBoxVtkImportObject->onSave();
     ui->cb_export_level->onSave();
+    ui->cb_compressor->onSave();
 }
 
 void DlgSettingsFemInOutVtkImp::loadSettings()
@@ -68,6 +69,7 @@ void DlgSettingsFemInOutVtkImp::loadSettings()
 
     populateExportLevel();
     ui->cb_export_level->onRestore();
+    ui->cb_compressor->onRestore();
 }
 
 /**
@@ -93,7 +93,7 @@ FreeCAD.addImportType(
 
 if "BUILD_FEM_VTK" in FreeCAD.__cmake__:
     FreeCAD.addImportType(
-        "FEM result VTK (*.vtk *.VTK *.vtu *.VTU *.pvtu *.PVTU)",
+        "FEM result VTK (*.vtk *.VTK *.vtu *.VTU *.pvtu *.PVTU *.pvd *.PVD)",
         "feminout.importVTKResults",
     )
     FreeCAD.addExportType(
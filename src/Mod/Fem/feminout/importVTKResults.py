@@ -85,6 +85,9 @@ def importVtk(filename, object_name=None, object_type=None):
         object_type = vtkinout_prefs.GetInt("ImportObject", 0)
     if not object_name:
         object_name = os.path.splitext(os.path.basename(filename))[0]
+    if filename.lower().endswith(".pvd"):
+        # time series are only supported by vtk result objects
+        object_type = 0
     if object_type == 0:
         # vtk result object
         importVtkVtkResult(filename, object_name)
@@ -30,6 +30,8 @@ __url__ = "https://www.freecad.org"
 #  \ingroup FEM
 #  \brief mechanical result object
 
+import FreeCAD
+
 from . import base_fempythonobject
 
 
@@ -232,6 +234,16 @@ class ResultMechanical(base_fempythonobject.BaseFemPythonObject):
         zero_list = 26 * [0]
         obj.Stats = zero_list
 
+        # halve the size of the node results in the document
+        prefs = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Mod/Fem/General")
+        if prefs.GetBool("ResultSinglePrecision", False):
+            list_types = ("App::PropertyFloatList", "App::PropertyVectorList")
+            for prop in obj.PropertiesList:
+                if obj.getGroupOfProperty(prop) != "NodeData":
+                    continue
+                if obj.getTypeIdOfProperty(prop) in list_types:
+                    obj.setPropertyStatus(prop, "Single")
+
     def onDocumentRestored(self, obj):
         # migrate old result objects, because property "StressValues"
         # was renamed to "vonMises" in commit 8b68ab7
@@ -375,6 +375,21 @@ void ExportOCAF2::exportObjects(std::vector<App::DocumentObject*>& objs, const c
     aShapeTool->UpdateAssemblies();
 }
 
+// Check if the object is an unscaled link to an assembly container, e.g. an
+// App::Part. Containers build a new compound each time their shape is asked
+// for, so such a link never shares the shape of its target, but it can still
+// refer to the assembly exported for the target.
+static bool isAssemblyInstance(App::DocumentObject* obj)
+{
+    auto ext = obj->getExtensionByType<App::LinkBaseExtension>(true);
+    if (!ext || ext->getElementCountValue() || !ext->getSubElements().empty()
+        || !ext->getScaleVector().IsEqual(Base::Vector3d(1, 1, 1), 1e-12)) {
+        return false;
+    }
+    auto linked = obj->getLinkedObject(true);
+    return linked && linked != obj && !linked->getSubObjects().empty();
+}
+
 TDF_Label ExportOCAF2::exportObject(App::DocumentObject* parentObj,
                                     const char* sub,
                                     TDF_Label parent,
@@ -414,12 +429,25 @@ TDF_Label ExportOCAF2::exportObject(App::DocumentObject* parentObj,
     int depth = 0;
     auto linked = obj;
     auto linkedShape = shape;
+    bool assemblyInstance = false;
     while (true) {
-        auto s = Part::Feature::getTopoShape(linked);
-        if (s.isNull() || !s.getShape().IsPartner(shape.getShape())) {
-            break;
+        // Once we know this is an instance of an assembly, there is no need to
+        // build the shapes of the rest of the link chain
+        if (!assemblyInstance) {
+            auto s = Part::Feature::getTopoShape(linked);
+            if (s.isNull()) {
+                break;
+            }
+            if (s.getShape().IsPartner(shape.getShape())) {
+                linkedShape = s;
+            }
+            else if (isAssemblyInstance(linked)) {
+                assemblyInstance = true;
+            }
+            else {
+                break;
+            }
         }
-        linkedShape = s;
         // Search using our own cache. We can't rely on ShapeTool::FindShape()
         // in case this is an assembly. Because FindShape() search among its
         // own computed shape, i.e. its own created compound, and thus will
@@ -26,6 +26,7 @@
 #endif
 #ifndef _PreComp_
 #include <Interface_Static.hxx>
+#include <OSD_Parallel.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Version.hxx>
@@ -281,6 +282,141 @@ ImportOCAF2::expandShape(App::Document* doc, TDF_Label label, const TopoDS_Shape
     return info.obj;
 }
 
+std::vector<ImportOCAF2::SubShapeColor> ImportOCAF2::getSubShapeColors(TDF_Label label,
+                                                                     const TopoDS_Shape& shape)
+{
+    std::vector<SubShapeColor> res;
+    TDF_LabelSequence seq;
+    if (label.IsNull() || !aShapeTool->GetSubShapes(label, seq)) {
+        return res;
+    }
+    bool hasFace = TopExp_Explorer(shape, TopAbs_FACE).More();
+    // Two passes to get sub shape colors. First pass, look for solid, and
+    // second pass look for face and edges. This allows lower level
+    // subshape to override color of higher level ones.
+    for (int j = 0; j < 2; ++j) {
+        for (int i = 1; i <= seq.Length(); ++i) {
+            TDF_Label l = seq.Value(i);
+            SubShapeColor subColor;
+            subColor.shape = aShapeTool->GetShape(l);
+            if (subColor.shape.IsNull()) {
+                continue;
+            }
+            auto type = subColor.shape.ShapeType();
+            if (type == TopAbs_FACE || type == TopAbs_EDGE) {
+                if (j == 0) {
+                    continue;
+                }
+            }
+            else if (j != 0) {
+                continue;
+            }
+
+            Quantity_ColorRGBA aColor;
+            if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
+                || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
+                subColor.faceColor = Tools::convertColor(aColor);
+                subColor.hasFaceColor = true;
+            }
+            if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
+                subColor.edgeColor = Tools::convertColor(aColor);
+                subColor.hasEdgeColor = true;
+                if (j == 0 && subColor.hasFaceColor && hasFace
+                    && subColor.edgeColor == subColor.faceColor) {
+                    // Do not set edge the same color as face
+                    subColor.hasEdgeColor = false;
+                }
+            }
+            if (subColor.hasFaceColor || subColor.hasEdgeColor) {
+                res.push_back(std::move(subColor));
+            }
+        }
+    }
+    return res;
+}
+
+ImportOCAF2::ElementColors
+ImportOCAF2::expandSubShapeColors(const TopoDS_Shape& shape,
+                                  const std::vector<SubShapeColor>& subColors,
+                                  const Info& info)
+{
+    ElementColors res;
+    res.shape = shape;
+    if (subColors.empty()) {
+        return res;
+    }
+
+    TopTools_IndexedMapOfShape faceMap, edgeMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+
+    res.faceColors.assign(faceMap.Extent(), info.faceColor);
+    res.edgeColors.assign(edgeMap.Extent(), info.edgeColor);
+    for (const auto& subColor : subColors) {
+        if (subColor.hasFaceColor) {
+            for (TopExp_Explorer exp(subColor.shape, TopAbs_FACE); exp.More(); exp.Next()) {
+                int idx = faceMap.FindIndex(exp.Current()) - 1;
+                if (idx >= 0 && idx < (int)res.faceColors.size()) {
+                    res.faceColors[idx] = subColor.faceColor;
+                    res.hasFaceColors = true;
+                }
+            }
+        }
+        if (subColor.hasEdgeColor) {
+            for (TopExp_Explorer exp(subColor.shape, TopAbs_EDGE); exp.More(); exp.Next()) {
+                int idx = edgeMap.FindIndex(exp.Current()) - 1;
+                if (idx >= 0 && idx < (int)res.edgeColors.size()) {
+                    res.edgeColors[idx] = subColor.edgeColor;
+                    res.hasEdgeColors = true;
+                }
+            }
+        }
+    }
+    return res;
+}
+
+void ImportOCAF2::prepareElementColors(const TDF_LabelSequence& labels)
+{
+    // Reading the colors from the document is kept on this thread, but mapping
+    // them to the faces and edges of each part is done for all parts at once.
+    struct Task
+    {
+        TDF_Label label;
+        TopoDS_Shape shape;
+        Info info;
+        std::vector<SubShapeColor> subColors;
+        ElementColors colors;
+    };
+    std::vector<Task> tasks;
+    for (Standard_Integer i = 1; i <= labels.Length(); i++) {
+        Task task;
+        task.label = labels.Value(i);
+        if (aShapeTool->IsAssembly(task.label)) {
+            continue;
+        }
+        task.shape = aShapeTool->GetShape(task.label);
+        if (task.shape.IsNull()) {
+            continue;
+        }
+        task.subColors = getSubShapeColors(task.label, task.shape);
+        if (task.subColors.empty()) {
+            continue;
+        }
+        getColor(task.shape, task.info);
+        tasks.push_back(std::move(task));
+    }
+
+    OSD_Parallel::For(0, static_cast<int>(tasks.size()), [&tasks](int i) {
+        auto& task = tasks[i];
+        task.colors = expandSubShapeColors(task.shape, task.subColors, task.info);
+    }, tasks.size() < 2);
+
+    for (auto& task : tasks) {
+        myElementColors.emplace(task.label, std::move(task.colors));
+    }
+    FC_LOG("prepared element colors of " << tasks.size() << " parts");
+}
+
 bool ImportOCAF2::createObject(App::Document* doc,
                                TDF_Label label,
                                const TopoDS_Shape& shape,
@@ -293,80 +429,22 @@ bool ImportOCAF2::createObject(App::Document* doc,
     }
 
     getColor(shape, info);
-    bool hasFaceColors = false;
-    bool hasEdgeColors = false;
 
     Part::TopoShape tshape(shape);
-    std::vector<App::Color> faceColors;
-    std::vector<App::Color> edgeColors;
-
-    TDF_LabelSequence seq;
-    if (!label.IsNull() && aShapeTool->GetSubShapes(label, seq)) {
-
-        TopTools_IndexedMapOfShape faceMap, edgeMap;
-        TopExp::MapShapes(tshape.getShape(), TopAbs_FACE, faceMap);
-        TopExp::MapShapes(tshape.getShape(), TopAbs_EDGE, edgeMap);
-
-        faceColors.assign(faceMap.Extent(), info.faceColor);
-        edgeColors.assign(edgeMap.Extent(), info.edgeColor);
-        // Two passes to get sub shape colors. First pass, look for solid, and
-        // second pass look for face and edges. This allows lower level
-        // subshape to override color of higher level ones.
-        for (int j = 0; j < 2; ++j) {
-            for (int i = 1; i <= seq.Length(); ++i) {
-                TDF_Label l = seq.Value(i);
-                TopoDS_Shape subShape = aShapeTool->GetShape(l);
-                if (subShape.IsNull()) {
-                    continue;
-                }
-                if (subShape.ShapeType() == TopAbs_FACE || subShape.ShapeType() == TopAbs_EDGE) {
-                    if (j == 0) {
-                        continue;
-                    }
-                }
-                else if (j != 0) {
-                    continue;
-                }
-
-                bool foundFaceColor = false, foundEdgeColor = false;
-                App::Color faceColor, edgeColor;
-                Quantity_ColorRGBA aColor;
-                if (aColorTool->GetColor(l, XCAFDoc_ColorSurf, aColor)
-                    || aColorTool->GetColor(l, XCAFDoc_ColorGen, aColor)) {
-                    faceColor = Tools::convertColor(aColor);
-                    foundFaceColor = true;
-                }
-                if (aColorTool->GetColor(l, XCAFDoc_ColorCurv, aColor)) {
-                    edgeColor = Tools::convertColor(aColor);
-                    foundEdgeColor = true;
-                    if (j == 0 && foundFaceColor && !faceColors.empty() && edgeColor == faceColor) {
-                        // Do not set edge the same color as face
-                        foundEdgeColor = false;
-                    }
-                }
-
-                if (foundFaceColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_FACE); exp.More(); exp.Next()) {
-                        int idx = faceMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)faceColors.size()) {
-                            faceColors[idx] = faceColor;
-                            hasFaceColors = true;
-                            info.hasFaceColor = true;
-                        }
-                    }
-                }
-                if (foundEdgeColor) {
-                    for (TopExp_Explorer exp(subShape, TopAbs_EDGE); exp.More(); exp.Next()) {
-                        int idx = edgeMap.FindIndex(exp.Current()) - 1;
-                        if (idx >= 0 && idx < (int)edgeColors.size()) {
-                            edgeColors[idx] = edgeColor;
-                            hasEdgeColors = true;
-                            info.hasEdgeColor = true;
-                        }
-                    }
-                }
-            }
-        }
+    ElementColors colors;
+    auto it = label.IsNull() ? myElementColors.end() : myElementColors.find(label);
+    if (it != myElementColors.end() && it->second.shape.IsEqual(shape)) {
+        colors = std::move(it->second);
+        myElementColors.erase(it);
+    }
+    else if (!label.IsNull()) {
+        colors = expandSubShapeColors(shape, getSubShapeColors(label, shape), info);
+    }
+    if (colors.hasFaceColors) {
+        info.hasFaceColor = true;
+    }
+    if (colors.hasEdgeColors) {
+        info.hasEdgeColor = true;
     }
 
     Part::Feature* feature;
@@ -388,11 +466,11 @@ bool ImportOCAF2::createObject(App::Document* doc,
     }
     applyFaceColors(feature, {info.faceColor});
     applyEdgeColors(feature, {info.edgeColor});
-    if (hasFaceColors) {
-        applyFaceColors(feature, faceColors);
+    if (colors.hasFaceColors) {
+        applyFaceColors(feature, colors.faceColors);
     }
-    if (hasEdgeColors) {
-        applyEdgeColors(feature, edgeColors);
+    if (colors.hasEdgeColors) {
+        applyEdgeColors(feature, colors.edgeColors);
     }
 
     info.propPlacement = &feature->Placement;
@@ -524,10 +602,12 @@ App::DocumentObject* ImportOCAF2::loadShapes()
     FC_LOG("free shape count " << labels.Length());
     sequencer = options.showProgress ? &seq : nullptr;
 
-    labels.Clear();
     myShapes.clear();
     myNames.clear();
     myCollapsedObjects.clear();
+    myElementColors.clear();
+    prepareElementColors(labels);
+    labels.Clear();
 
     std::vector<App::DocumentObject*> objs;
     aShapeTool->GetFreeShapes(labels);
@@ -583,6 +663,7 @@ App::DocumentObject* ImportOCAF2::loadShapes()
         ret = feature;
         ret->recomputeFeature(true);
     }
+    myElementColors.clear();
     sequencer = nullptr;
     return ret;
 }
@@ -30,6 +30,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <TDF_LabelSequence.hxx>
 #include <TDocStd_Document.hxx>
 #include <TopoDS_Shape.hxx>
 #include <XCAFDoc_ColorTool.hxx>
@@ -137,6 +138,26 @@ private:
         int free = true;
     };
 
+    /// Color assigned to a sub shape label of a part
+    struct SubShapeColor
+    {
+        TopoDS_Shape shape;
+        App::Color faceColor;
+        App::Color edgeColor;
+        bool hasFaceColor = false;
+        bool hasEdgeColor = false;
+    };
+
+    /// Sub shape colors of a part expanded to its faces and edges
+    struct ElementColors
+    {
+        TopoDS_Shape shape;
+        std::vector<App::Color> faceColors;
+        std::vector<App::Color> edgeColors;
+        bool hasFaceColors = false;
+        bool hasEdgeColors = false;
+    };
+
     App::DocumentObject* loadShape(App::Document* doc,
                                    TDF_Label label,
                                    const TopoDS_Shape& shape,
@@ -163,6 +184,11 @@ private:
     getColor(const TopoDS_Shape& shape, Info& info, bool check = false, bool noDefault = false);
     void
     getSHUOColors(TDF_Label label, std::map<std::string, App::Color>& colors, bool appendFirst);
+    std::vector<SubShapeColor> getSubShapeColors(TDF_Label label, const TopoDS_Shape& shape);
+    static ElementColors expandSubShapeColors(const TopoDS_Shape& shape,
+                                              const std::vector<SubShapeColor>& subColors,
+                                              const Info& info);
+    void prepareElementColors(const TDF_LabelSequence& labels);
     void setObjectName(Info& info, TDF_Label label);
     std::string getLabelName(TDF_Label label);
     App::DocumentObject*
@@ -208,6 +234,7 @@ private:
     std::unordered_map<TopoDS_Shape, Info, ShapeHasher> myShapes;
     std::unordered_map<TDF_Label, std::string, LabelHasher> myNames;
     std::unordered_map<App::DocumentObject*, App::PropertyPlacement*> myCollapsedObjects;
+    std::unordered_map<TDF_Label, ElementColors, LabelHasher> myElementColors;
 
     Base::SequencerLauncher* sequencer {nullptr};
 };
@@ -38,6 +38,7 @@
 #include <GeomAPI_PointsToBSpline.hxx>
 #include <Geom_BSplineCurve.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <TopLoc_Location.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
@@ -50,6 +51,7 @@
 #include <gp_Dir.hxx>
 #include <gp_Elips.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Trsf.hxx>
 #include <gp_Vec.hxx>
 #endif
 
@@ -475,6 +477,12 @@ void ImpExpDxfRead::ExpandInsert(const std::string& name,
     localTransform.move(point[0], point[1], point[2]);
     localTransform = transform * localTransform;
     CommonEntityAttributes mainAttributes = m_entityAttributes;
+    gp_Trsf trsf = Part::TopoShape::convert(localTransform);
+    // Like TopoShape::makeTransform, an insert without scaling or mirroring only gets a location
+    // and shares the geometry of the block, so inserting a block many times copies nothing.
+    bool copy = trsf.ScaleFactor() * trsf.HVectorialPart().Determinant() < 0.
+        || Abs(Abs(trsf.ScaleFactor()) - 1) > Precision::Confusion();
+    TopLoc_Location location(trsf);
     for (const auto& [attributes, shapes] : block.Shapes) {
         // Put attributes into m_entityAttributes after using the latter to set byblock values in
         // the former.
@@ -482,14 +490,14 @@ void ImpExpDxfRead::ExpandInsert(const std::string& name,
         m_entityAttributes.ResolveByBlockAttributes(mainAttributes);
 
         for (const TopoDS_Shape& shape : shapes) {
-            // TODO???: See the comment in TopoShape::makeTransform regarding calling
-            // Moved(identityTransform) on the new shape
-            Collector->AddObject(
-                BRepBuilderAPI_Transform(shape,
-                                         Part::TopoShape::convert(localTransform),
-                                         Standard_True)
-                    .Shape(),
-                "InsertPart");  // TODO: The collection should contain the nameBase to use
+            // TODO: The collection should contain the nameBase to use
+            if (copy) {
+                Collector->AddObject(BRepBuilderAPI_Transform(shape, trsf, Standard_True).Shape(),
+                                     "InsertPart");
+            }
+            else {
+                Collector->AddObject(shape.Moved(location), "InsertPart");
+            }
         }
     }
     for (const auto& [attributes, featureBuilders] : block.FeatureBuildersList) {
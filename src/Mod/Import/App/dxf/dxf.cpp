@@ -8,10 +8,12 @@
 // required by windows for M_PI definition
 #define _USE_MATH_DEFINES
 #include <cmath>
+#include <cstdlib>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <type_traits>
 
 #include "dxf.h"
 #include <App/Application.h>
@@ -1808,6 +1810,7 @@ CDxfRead::CDxfRead(const std::string& filepath)
         return;
     }
     m_ifs->imbue(std::locale("C"));
+    m_buffer.resize(1 << 20);
 }
 
 CDxfRead::~CDxfRead()
@@ -1870,47 +1873,36 @@ void CDxfRead::SetupValueAttribute(eDXFGroupCode_t record_type, T& destination)
 // Static processing helpers for ProcessCommonEntityAttribute
 void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
-        object->ImportError("Unable to parse value '%s', using zero as its value\n",
-                            object->m_record_data);
-    }
+    ParseValue<double>(object, &value);
     *static_cast<double*>(target) = object->mm(value);
 }
 void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
-        object->ImportError("Unable to parse value '%s', using zero as its value\n",
-                            object->m_record_data);
-    }
+    ParseValue<double>(object, &value);
     static_cast<std::list<double>*>(target)->push_back(object->mm(value));
 }
 template<typename T>
 bool CDxfRead::ParseValue(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
-    ss >> *static_cast<T*>(target);
-    if (ss.fail()) {
+    // A file has millions of values, so they are not parsed with a string stream, which costs
+    // more than the reading of the file. strtod uses the "C" locale FreeCAD sets for numbers.
+    const char* start = object->m_record_data.c_str();
+    char* end = nullptr;
+    if constexpr (std::is_floating_point_v<T>) {
+        *static_cast<T*>(target) = static_cast<T>(std::strtod(start, &end));
+    }
+    else {
+        *static_cast<T*>(target) = static_cast<T>(std::strtol(start, &end, 10));
+    }
+    if (end == start) {
         object->ImportError("Unable to parse value '%s', using zero as its value\n",
                             object->m_record_data);
         *static_cast<T*>(target) = 0;
         return false;
     }
-    // TODO: Verify nothing it left but whitespace in ss.
+    // TODO: Verify nothing it left but whitespace after the value.
     return true;
 }
 void CDxfRead::ProcessStdString(CDxfRead* object, void* target)
@@ -2358,12 +2350,12 @@ bool CDxfRead::get_next_record()
     }
 
     do {
-        if ((*m_ifs).eof()) {
+        if (AtEndOfData()) {
             m_not_eof = false;
             return false;
         }
 
-        std::getline(*m_ifs, m_record_data);
+        ReadRecordLine();
         ++m_line;
         int temp = 0;
         if (!ParseValue<int>(this, &temp)) {
@@ -2372,11 +2364,11 @@ bool CDxfRead::get_next_record()
             return false;
         }
         m_record_type = (eDXFGroupCode_t)temp;
-        if ((*m_ifs).eof()) {
+        if (AtEndOfData()) {
             return false;
         }
 
-        std::getline(*m_ifs, m_record_data);
+        ReadRecordLine();
         ++m_line;
     } while (m_record_type == eComment);
 
@@ -2398,6 +2390,36 @@ void CDxfRead::repeat_last_record()
     m_repeat_last_record = true;
 }
 
+bool CDxfRead::AtEndOfData()
+{
+    if (m_bufferPos < m_bufferEnd) {
+        return false;
+    }
+    m_ifs->read(m_buffer.data(), std::streamsize(m_buffer.size()));
+    m_bufferPos = 0;
+    m_bufferEnd = std::size_t(m_ifs->gcount());
+    return m_bufferEnd == 0;
+}
+
+void CDxfRead::ReadRecordLine()
+{
+    // Like std::getline, but the characters are copied straight out of the block read last
+    m_record_data.clear();
+    while (!AtEndOfData()) {
+        const char* start = m_buffer.data() + m_bufferPos;
+        std::size_t count = m_bufferEnd - m_bufferPos;
+        const void* newline = std::memchr(start, '\n', count);
+        if (newline) {
+            count = static_cast<const char*>(newline) - start;
+            m_record_data.append(start, count);
+            m_bufferPos += count + 1;
+            return;
+        }
+        m_record_data.append(start, count);
+        m_bufferPos = m_bufferEnd;
+    }
+}
+
 //
 //  Intercepts for On... calls to derived class
 //  (These have distinct signatures from the ones they call)
@@ -441,6 +441,10 @@ class ImportExport CDxfRead
 private:
     // Low-level reader members
     std::ifstream* m_ifs;  // TODO: gsl::owner<ifstream>
+    // The file is read in large blocks and split into lines by ReadRecordLine
+    std::vector<char> m_buffer;
+    std::size_t m_bufferPos = 0;
+    std::size_t m_bufferEnd = 0;
     // https://stackoverflow.com/questions/41167119/how-to-fix-a-wsubobject-linkage-warning
     eDXFGroupCode_t m_record_type = eObjectType;
     std::string m_record_data;
@@ -666,6 +670,10 @@ private:
 
     bool get_next_record();
     void repeat_last_record();
+    // Returns true if the whole file has been read
+    bool AtEndOfData();
+    // Reads the next line of the file into m_record_data
+    void ReadRecordLine();
 
     bool (CDxfRead::*stringToUTF8)(std::string&) const = &CDxfRead::UTF8ToUTF8;
 
@@ -24,6 +24,8 @@
 
 #ifndef _PreComp_
 #include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <memory>
 #include <numeric>
 
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -46,6 +48,7 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -283,34 +286,27 @@ private:
 InspectNominalMesh::InspectNominalMesh(const Mesh::MeshObject& rMesh, float offset)
     : _mesh(rMesh.getKernel())
 {
+    // The hierarchy is queried with global coordinates, so a mesh with a placement
+    // is transformed once instead of transforming the candidate facets per point.
     Base::Matrix4D tmp;
-    _clTrf = rMesh.getTransform();
-    _bApply = _clTrf != tmp;
-
-    // Max. limit of grid elements
-    float fMaxGridElements = 8000000.0f;
-    Base::BoundBox3f box = _mesh.GetBoundBox().Transformed(rMesh.getTransform());
-
-    // estimate the minimum allowed grid length
-    float fMinGridLen =
-        (float)pow((box.LengthX() * box.LengthY() * box.LengthZ() / fMaxGridElements), 0.3333f);
-    float fGridLen = 5.0f * MeshCore::MeshAlgorithm(_mesh).GetAverageEdgeLength();
-
-    // We want to avoid to get too small grid elements otherwise building up the grid structure
-    // would take too much time and memory. Having quite a dense grid speeds up more the following
-    // algorithms extremely. Due to the issue above it's always a compromise between speed and
-    // memory usage.
-    fGridLen = std::max<float>(fMinGridLen, fGridLen);
+    const MeshCore::MeshKernel* mesh = &_mesh;
+    if (rMesh.getTransform() != tmp) {
+        _pTransformed = new MeshCore::MeshKernel(_mesh);
+        _pTransformed->Transform(rMesh.getTransform());
+        mesh = _pTransformed;
+    }
 
-    // build up grid structure to speed up algorithms
-    _pGrid = new MeshInspectGrid(_mesh, fGridLen, rMesh.getTransform());
-    _box = box;
+    // Unlike a grid the BVH adapts to the facet sizes, so there is no need to
+    // find a compromise between speed and memory usage.
+    _pBVH = new MeshCore::MeshFacetBVH(*mesh);
+    _box = mesh->GetBoundBox();
     _box.Enlarge(offset);
 }
 
 InspectNominalMesh::~InspectNominalMesh()
 {
-    delete this->_pGrid;
+    delete this->_pBVH;
+    delete this->_pTransformed;
 }
 
 float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
@@ -319,30 +315,16 @@ float InspectNominalMesh::getDistance(const Base::Vector3f& point) const
         return FLT_MAX;  // must be inside bbox
     }
 
-    std::vector<unsigned long> indices;
-    //_pGrid->GetElements(point, indices);
-    if (indices.empty()) {
-        std::set<unsigned long> inds;
-        _pGrid->MeshGrid::SearchNearestFromPoint(point, inds);
-        indices.insert(indices.begin(), inds.begin(), inds.end());
-    }
-
-    float fMinDist = FLT_MAX;
-    bool positive = true;
-    for (unsigned long it : indices) {
-        MeshCore::MeshGeomFacet geomFace = _mesh.GetFacet(it);
-        if (_bApply) {
-            geomFace.Transform(_clTrf);
-        }
-
-        float fDist = geomFace.DistanceToPoint(point);
-        if (fabs(fDist) < fabs(fMinDist)) {
-            fMinDist = fDist;
-            positive = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) > 0;
-        }
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    if (!_pBVH->NearestFacetToPoint(point, FLT_MAX, res, index)) {
+        return FLT_MAX;
     }
 
-    if (!positive) {
+    const MeshCore::MeshKernel& mesh = _pTransformed ? *_pTransformed : _mesh;
+    MeshCore::MeshGeomFacet geomFace = mesh.GetFacet(index);
+    float fMinDist = Base::Distance(point, res);
+    if (point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) <= 0) {
         fMinDist = -fMinDist;
     }
     return fMinDist;
@@ -471,7 +453,16 @@ float InspectNominalPoints::getDistance(const Base::Vector3f& point) const
 
 // ----------------------------------------------------------------
 
-InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radius*/)
+struct InspectNominalShape::Tessellation
+{
+    Part::TopoShape::TessellationLayout layout;
+    MeshCore::MeshKernel mesh;
+    std::unique_ptr<MeshCore::MeshFacetBVH> bvh;
+    float deflection {0.0F};
+    float radius {0.0F};
+};
+
+InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float radius)
     : _rShape(shape)
 {
     distss = new BRepExtrema_DistShapeShape();
@@ -488,15 +479,69 @@ InspectNominalShape::InspectNominalShape(const TopoDS_Shape& shape, float /*radi
         }
     }
     // distss->SetDeflection(radius);
+
+    tessellate(radius);
 }
 
 InspectNominalShape::~InspectNominalShape()
 {
     delete distss;
+    delete tessellation;
+}
+
+void InspectNominalShape::tessellate(float radius)
+{
+    // Shapes without faces are handled by BRepExtrema_DistShapeShape only
+    if (_rShape.IsNull()) {
+        return;
+    }
+    TopExp_Explorer xp(_rShape, TopAbs_FACE);
+    if (!xp.More()) {
+        return;
+    }
+
+    Part::TopoShape shape(_rShape);
+    double deflection = shape.getAccuracy();
+    auto data = std::make_unique<Tessellation>();
+    data->layout = shape.prepareTessellation(deflection);
+    std::size_t numPoints = data->layout.countPoints();
+    std::size_t numTriangles = data->layout.countTriangles();
+    if (numTriangles == 0) {
+        return;
+    }
+
+    std::vector<float> coords(3 * numPoints);
+    std::vector<uint32_t> indices(3 * numTriangles);
+    shape.fillTessellation(data->layout, coords.data(), indices.data());
+
+    MeshCore::MeshPointArray points;
+    points.reserve(numPoints);
+    for (std::size_t i = 0; i < numPoints; i++) {
+        points.emplace_back(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+    }
+    MeshCore::MeshFacetArray facets;
+    facets.reserve(numTriangles);
+    for (std::size_t i = 0; i < numTriangles; i++) {
+        facets.emplace_back(indices[3 * i], indices[3 * i + 1], indices[3 * i + 2]);
+    }
+    data->mesh.Adopt(points, facets, false);
+    data->bvh = std::make_unique<MeshCore::MeshFacetBVH>(data->mesh);
+    data->deflection = static_cast<float>(deflection);
+    data->radius = radius;
+    tessellation = data.release();
+}
+
+bool InspectNominalShape::isThreadSafe() const
+{
+    return tessellation != nullptr;
 }
 
 float InspectNominalShape::getDistance(const Base::Vector3f& point) const
 {
+    if (tessellation) {
+        return getTessellationDistance(point);
+    }
+
     gp_Pnt pnt3d(point.x, point.y, point.z);
     BRepBuilderAPI_MakeVertex mkVert(pnt3d);
     distss->LoadS2(mkVert.Vertex());
@@ -520,6 +565,50 @@ float InspectNominalShape::getDistance(const Base::Vector3f& point) const
     return fMinDist;
 }
 
+/**
+ * The nearest facet of the tessellation is searched with the BVH. Its distance
+ * differs from the exact one by at most the deflection, so only inside the search
+ * radius the distance is refined with the face the facet belongs to. This uses
+ * only local objects and therefore can be done in parallel.
+ */
+float InspectNominalShape::getTessellationDistance(const Base::Vector3f& point) const
+{
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    if (!tessellation->bvh->NearestFacetToPoint(point, FLT_MAX, res, index)) {
+        return FLT_MAX;
+    }
+
+    MeshCore::MeshGeomFacet geomFace = tessellation->mesh.GetFacet(index);
+    float fMinDist = Base::Distance(point, res);
+    bool below = point.DistanceToPlane(geomFace._aclPoints[0], geomFace.GetNormal()) < 0;
+
+    if (fMinDist <= tessellation->radius + tessellation->deflection) {
+        const std::vector<uint32_t>& offsets = tessellation->layout.triangleOffsets;
+        auto it = std::upper_bound(offsets.begin(), offsets.end(), uint32_t(index));
+        const TopoDS_Face& face = tessellation->layout.faces[std::distance(offsets.begin(), it) - 1];
+
+        gp_Pnt pnt3d(point.x, point.y, point.z);
+        BRepExtrema_DistShapeShape dist(BRepBuilderAPI_MakeVertex(pnt3d).Vertex(), face);
+        if (dist.IsDone() && dist.NbSolution() > 0) {
+            fMinDist = static_cast<float>(dist.Value());
+            if (dist.SupportTypeShape2(1) == BRepExtrema_IsInFace) {
+                Standard_Real u {};
+                Standard_Real v {};
+                dist.ParOnFaceS2(1, u, v);
+                BRepGProp_Face props(face);
+                gp_Vec normal;
+                gp_Pnt center;
+                props.Normal(u, v, center, normal);
+                gp_Vec dir(center, pnt3d);
+                below = normal.Dot(dir) < 0;
+            }
+        }
+    }
+
+    return below ? -fMinDist : fMinDist;
+}
+
 bool InspectNominalShape::isInsideSolid(const gp_Pnt& pnt3d) const
 {
     const Standard_Real tol = 0.001;
@@ -832,12 +921,14 @@ App::DocumentObjectExecReturn* Feature::execute()
             nominal = new InspectNominalPoints(pts->Points.getValue(), this->SearchRadius.getValue());
         }
         else if (it->isDerivedFrom<Part::Feature>()) {
-            useMultithreading = false;
             Part::Feature* part = static_cast<Part::Feature*>(it);
             nominal = new InspectNominalShape(part->Shape.getValue(), this->SearchRadius.getValue());
         }
 
         if (nominal) {
+            if (!nominal->isThreadSafe()) {
+                useMultithreading = false;
+            }
             inspectNominal.push_back(nominal);
         }
     }
@@ -900,45 +991,57 @@ App::DocumentObjectExecReturn* Feature::execute()
 #else
     unsigned long count = actual->countPoints();
     std::vector<float> vals(count);
-    std::function<DistanceInspectionRMS(int)> fMap = [&](unsigned int index) {
+    float radius = this->SearchRadius.getValue();
+
+    // The points are processed in blocks to keep the overhead per point low
+    const unsigned long blockSize = 1024;
+    std::function<DistanceInspectionRMS(unsigned long)> fMap = [&](unsigned long begin) {
         DistanceInspectionRMS res;
-        Base::Vector3f pnt = actual->getPoint(index);
+        unsigned long end = std::min(begin + blockSize, count);
+        for (unsigned long index = begin; index < end; index++) {
+            Base::Vector3f pnt = actual->getPoint(index);
+
+            float fMinDist = FLT_MAX;
+            for (auto it : inspectNominal) {
+                float fDist = it->getDistance(pnt);
+                if (fabs(fDist) < fabs(fMinDist)) {
+                    fMinDist = fDist;
+                }
+            }
 
-        float fMinDist = FLT_MAX;
-        for (auto it : inspectNominal) {
-            float fDist = it->getDistance(pnt);
-            if (fabs(fDist) < fabs(fMinDist)) {
-                fMinDist = fDist;
+            if (fMinDist > radius) {
+                fMinDist = FLT_MAX;
+            }
+            else if (-fMinDist > radius) {
+                fMinDist = -FLT_MAX;
+            }
+            else {
+                res.m_sumsq += fMinDist * fMinDist;
+                res.m_numv++;
             }
-        }
 
-        if (fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = FLT_MAX;
-        }
-        else if (-fMinDist > this->SearchRadius.getValue()) {
-            fMinDist = -FLT_MAX;
-        }
-        else {
-            res.m_sumsq += fMinDist * fMinDist;
-            res.m_numv++;
+            vals[index] = fMinDist;
         }
-
-        vals[index] = fMinDist;
         return res;
     };
 
+    // Build vector of the first indices of the blocks
+    std::vector<unsigned long> blocks;
+    blocks.reserve(count / blockSize + 1);
+    for (unsigned long index = 0; index < count; index += blockSize) {
+        blocks.push_back(index);
+    }
+
     DistanceInspectionRMS res;
 
     if (useMultithreading) {
-        // Build vector of increasing indices
-        std::vector<unsigned long> index(count);
-        std::iota(index.begin(), index.end(), 0);
         // Perform map-reduce operation : compute distances and update sum of squares for RMS
         // computation
         QFuture<DistanceInspectionRMS> future =
-            QtConcurrent::mappedReduced(index, fMap, &DistanceInspectionRMS::operator+=);
+            QtConcurrent::mappedReduced(blocks, fMap, &DistanceInspectionRMS::operator+=);
         // Setup progress bar
-        Base::FutureWatcherProgress progress("Inspecting...", actual->countPoints());
+        Base::FutureWatcherProgress progress("Inspecting...",
+                                            static_cast<unsigned int>(blocks.size()));
         QFutureWatcher<DistanceInspectionRMS> watcher;
         QObject::connect(&watcher,
                          &QFutureWatcher<DistanceInspectionRMS>::progressValueChanged,
@@ -958,10 +1061,11 @@ App::DocumentObjectExecReturn* Feature::execute()
         // Single-threaded operation
         std::stringstream str;
         str << "Inspecting " << this->Label.getValue() << "...";
-        Base::SequencerLauncher seq(str.str().c_str(), count);
+        Base::SequencerLauncher seq(str.str().c_str(), blocks.size());
 
-        for (unsigned int i = 0; i < count; i++) {
-            res += fMap(i);
+        for (unsigned long block : blocks) {
+            res += fMap(block);
+            seq.next();
         }
     }
 
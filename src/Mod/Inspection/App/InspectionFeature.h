@@ -38,6 +38,7 @@ namespace MeshCore
 {
 class MeshKernel;
 class MeshGrid;
+class MeshFacetBVH;
 }  // namespace MeshCore
 
 namespace Mesh
@@ -114,6 +115,11 @@ public:
     InspectNominalGeometry() = default;
     virtual ~InspectNominalGeometry() = default;
     virtual float getDistance(const Base::Vector3f&) const = 0;
+    /// Returns true if getDistance() can be called from several threads at once.
+    virtual bool isThreadSafe() const
+    {
+        return true;
+    }
 };
 
 class InspectionExport InspectNominalMesh: public InspectNominalGeometry
@@ -125,10 +131,10 @@ public:
 
 private:
     const MeshCore::MeshKernel& _mesh;
-    MeshCore::MeshGrid* _pGrid;
+    /// copy of the mesh in global coordinates if it has a placement
+    MeshCore::MeshKernel* _pTransformed {nullptr};
+    MeshCore::MeshFacetBVH* _pBVH;
     Base::BoundBox3f _box;
-    bool _bApply;
-    Base::Matrix4D _clTrf;
 };
 
 class InspectionExport InspectNominalFastMesh: public InspectNominalGeometry
@@ -165,13 +171,18 @@ public:
     InspectNominalShape(const TopoDS_Shape&, float offset);
     ~InspectNominalShape() override;
     float getDistance(const Base::Vector3f&) const override;
+    bool isThreadSafe() const override;
 
 private:
     bool isInsideSolid(const gp_Pnt&) const;
     bool isBelowFace(const gp_Pnt&) const;
+    void tessellate(float radius);
+    float getTessellationDistance(const Base::Vector3f&) const;
 
 private:
+    struct Tessellation;
     BRepExtrema_DistShapeShape* distss;
+    Tessellation* tessellation {nullptr};
     const TopoDS_Shape& _rShape;
     bool isSolid {false};
 };
@@ -35,6 +35,8 @@
 #ifdef _PreComp_
 
 // STL
+#include <algorithm>
+#include <memory>
 #include <numeric>
 
 // OCC
@@ -21,12 +21,16 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <QCryptographicHash>
 #include <QDirIterator>
+#include <QFile>
 #include <QFileInfo>
 #include <QList>
 #include <QMetaType>
 #include <QRegularExpression>
 #include <QString>
+#include <QTextStream>
+#include <QtConcurrentMap>
 #endif
 
 #include <App/Application.h>
@@ -167,25 +171,30 @@ std::shared_ptr<Material3DArray> MaterialYamlEntry::read3DArray(const YAML::Node
 void MaterialYamlEntry::addToTree(
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap)
 {
-    std::set<QString> exclude;
-    exclude.insert(QString::fromStdString("General"));
-    exclude.insert(QString::fromStdString("Inherits"));
-
-    auto yamlModel = getModel();
     auto library = getLibrary();
-    auto name = getName();
     auto directory = getDirectory();
     QString uuid = getUUID();
 
+    std::shared_ptr<Material> finalModel =
+        std::make_shared<Material>(library, directory, uuid, getName());
+    readMaterial(*finalModel);
+
+    QString path = QDir(directory).absolutePath();
+    (*materialMap)[uuid] = library->addMaterial(finalModel, path);
+}
+
+void MaterialYamlEntry::readMaterial(Material& finalModel) const
+{
+    auto yamlModel = getModel();
+    auto name = getName();
+
     QString author = yamlValue(yamlModel["General"], "Author", "");
     QString license = yamlValue(yamlModel["General"], "License", "");
     QString description = yamlValue(yamlModel["General"], "Description", "");
 
-    std::shared_ptr<Material> finalModel =
-        std::make_shared<Material>(library, directory, uuid, name);
-    finalModel->setAuthor(author);
-    finalModel->setLicense(license);
-    finalModel->setDescription(description);
+    finalModel.setAuthor(author);
+    finalModel.setLicense(license);
+    finalModel.setDescription(description);
 
     // Add inheritance list
     if (yamlModel["Inherits"]) {
@@ -193,7 +202,7 @@ void MaterialYamlEntry::addToTree(
         for (auto it = inherits.begin(); it != inherits.end(); it++) {
             auto nodeName = it->second["UUID"].as<std::string>();
 
-            finalModel->setParentUUID(
+            finalModel.setParentUUID(
                 QString::fromStdString(nodeName));  // Should only be one. Need to check
         }
     }
@@ -207,37 +216,37 @@ void MaterialYamlEntry::addToTree(
             // Add the model uuid
             auto modelNode = models[modelName];
             auto modelUUID = modelNode["UUID"].as<std::string>();
-            finalModel->addPhysical(QString::fromStdString(modelUUID));
+            finalModel.addPhysical(QString::fromStdString(modelUUID));
 
             // Add the property values
             auto properties = yamlModel["Models"][modelName];
             for (auto itp = properties.begin(); itp != properties.end(); itp++) {
                 auto propertyName = (itp->first).as<std::string>();
-                if (finalModel->hasPhysicalProperty(QString::fromStdString(propertyName))) {
+                if (finalModel.hasPhysicalProperty(QString::fromStdString(propertyName))) {
                     auto prop =
-                        finalModel->getPhysicalProperty(QString::fromStdString(propertyName));
+                        finalModel.getPhysicalProperty(QString::fromStdString(propertyName));
                     auto type = prop->getType();
 
                     try {
                         if (type == MaterialValue::List || type == MaterialValue::FileList) {
                             auto list = readList(itp->second);
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         list);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        list);
                         }
                         else if (type == MaterialValue::ImageList) {
                             auto list = readImageList(itp->second);
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         list);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        list);
                         }
                         else if (type == MaterialValue::Array2D) {
                             auto array2d = read2DArray(itp->second, prop->columns());
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         array2d);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        array2d);
                         }
                         else if (type == MaterialValue::Array3D) {
                             auto array3d = read3DArray(itp->second, prop->columns());
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         array3d);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        array3d);
                         }
                         else {
                             QString propertyValue =
@@ -246,8 +255,8 @@ void MaterialYamlEntry::addToTree(
                                 propertyValue = propertyValue.remove(
                                     QRegularExpression(QString::fromStdString("[\r\n]")));
                             }
-                            finalModel->setPhysicalValue(QString::fromStdString(propertyName),
-                                                         propertyValue);
+                            finalModel.setPhysicalValue(QString::fromStdString(propertyName),
+                                                        propertyValue);
                         }
                     }
                     catch (const YAML::BadConversion& e) {
@@ -274,37 +283,37 @@ void MaterialYamlEntry::addToTree(
             // Add the model uuid
             auto modelNode = models[modelName];
             auto modelUUID = modelNode["UUID"].as<std::string>();
-            finalModel->addAppearance(QString::fromStdString(modelUUID));
+            finalModel.addAppearance(QString::fromStdString(modelUUID));
 
             // Add the property values
             auto properties = yamlModel["AppearanceModels"][modelName];
             for (auto itp = properties.begin(); itp != properties.end(); itp++) {
                 auto propertyName = (itp->first).as<std::string>();
-                if (finalModel->hasAppearanceProperty(QString::fromStdString(propertyName))) {
+                if (finalModel.hasAppearanceProperty(QString::fromStdString(propertyName))) {
                     auto prop =
-                        finalModel->getAppearanceProperty(QString::fromStdString(propertyName));
+                        finalModel.getAppearanceProperty(QString::fromStdString(propertyName));
                     auto type = prop->getType();
 
                     try {
                         if (type == MaterialValue::List || type == MaterialValue::FileList) {
                             auto list = readList(itp->second);
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           list);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          list);
                         }
                         else if (type == MaterialValue::ImageList) {
                             auto list = readImageList(itp->second);
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           list);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          list);
                         }
                         else if (type == MaterialValue::Array2D) {
                             auto array2d = read2DArray(itp->second, prop->columns());
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           array2d);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          array2d);
                         }
                         else if (type == MaterialValue::Array3D) {
                             auto array3d = read3DArray(itp->second, prop->columns());
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           array3d);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          array3d);
                         }
                         else {
                             QString propertyValue =
@@ -313,8 +322,8 @@ void MaterialYamlEntry::addToTree(
                                 propertyValue = propertyValue.remove(
                                     QRegularExpression(QString::fromStdString("[\r\n]")));
                             }
-                            finalModel->setAppearanceValue(QString::fromStdString(propertyName),
-                                                           propertyValue);
+                            finalModel.setAppearanceValue(QString::fromStdString(propertyName),
+                                                          propertyValue);
                         }
                     }
                     catch (const YAML::BadConversion& e) {
@@ -331,15 +340,11 @@ void MaterialYamlEntry::addToTree(
             }
         }
     }
-
-    QString path = QDir(directory).absolutePath();
-    (*materialMap)[uuid] = library->addMaterial(finalModel, path);
 }
 
 //===
 
-std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>>
-    MaterialLoader::_materialEntryMap = nullptr;
+std::weak_ptr<std::map<QString, std::shared_ptr<Material>>> MaterialLoader::_libraryMaterialMap;
 
 MaterialLoader::MaterialLoader(
     const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
@@ -347,6 +352,7 @@ MaterialLoader::MaterialLoader(
     : _materialMap(materialMap)
     , _libraryList(libraryList)
 {
+    _libraryMaterialMap = materialMap;
     loadLibraries();
 }
 
@@ -387,25 +393,14 @@ MaterialLoader::getMaterialFromYAML(const std::shared_ptr<MaterialLibrary>& libr
 }
 
 std::shared_ptr<MaterialEntry>
-MaterialLoader::getMaterialFromPath(const std::shared_ptr<MaterialLibrary>& library,
-                                    const QString& path) const
+MaterialLoader::readMaterialEntry(const std::shared_ptr<MaterialLibrary>& library,
+                                  const QString& path)
 {
     std::shared_ptr<MaterialEntry> model = nullptr;
 
     // Used for debugging
     std::string pathName = path.toStdString();
 
-    if (MaterialConfigLoader::isConfigStyle(path)) {
-        auto material = MaterialConfigLoader::getMaterialFromPath(library, path);
-        if (material) {
-            (*_materialMap)[material->getUUID()] = library->addMaterial(material, path);
-        }
-
-        // Return the nullptr as there are no intermediate steps to take, such
-        // as checking inheritance
-        return model;
-    }
-
     Base::FileInfo info(pathName);
     Base::ifstream fin(info);
     if (!fin) {
@@ -442,13 +437,20 @@ void MaterialLoader::showYaml(const YAML::Node& yaml)
 void MaterialLoader::dereference(
     const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
     const std::shared_ptr<Material>& material)
+{
+    dereference(materialMap, *material);
+}
+
+void MaterialLoader::dereference(
+    const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
+    Material& material)
 {
     // Avoid recursion
-    if (material->getDereferenced()) {
+    if (material.getDereferenced()) {
         return;
     }
 
-    auto parentUUID = material->getParentUUID();
+    auto parentUUID = material.getParentUUID();
     if (parentUUID.size() > 0) {
         std::shared_ptr<Material> parent;
         try {
@@ -457,7 +459,7 @@ void MaterialLoader::dereference(
         catch (std::out_of_range&) {
             Base::Console().Log(
                 "Unable to apply inheritance for material '%s', parent '%s' not found.\n",
-                material->getName().toStdString().c_str(),
+                material.getName().toStdString().c_str(),
                 parentUUID.toStdString().c_str());
             return;
         }
@@ -468,16 +470,16 @@ void MaterialLoader::dereference(
         // Add physical models
         auto modelVector = parent->getPhysicalModels();
         for (auto& model : *modelVector) {
-            if (!material->hasPhysicalModel(model)) {
-                material->addPhysical(model);
+            if (!material.hasPhysicalModel(model)) {
+                material.addPhysical(model);
             }
         }
 
         // Add appearance models
         modelVector = parent->getAppearanceModels();
         for (auto& model : *modelVector) {
-            if (!material->hasAppearanceModel(model)) {
-                material->addAppearance(model);
+            if (!material.hasAppearanceModel(model)) {
+                material.addAppearance(model);
             }
         }
 
@@ -487,8 +489,8 @@ void MaterialLoader::dereference(
             auto name = itp.first;
             auto property = itp.second;
 
-            if (material->getPhysicalProperty(name)->isNull()) {
-                material->getPhysicalProperty(name)->setValue(property->getValue());
+            if (material.getPhysicalProperty(name)->isNull()) {
+                material.getPhysicalProperty(name)->setValue(property->getValue());
             }
         }
 
@@ -497,13 +499,129 @@ void MaterialLoader::dereference(
             auto name = itp.first;
             auto property = itp.second;
 
-            if (material->getAppearanceProperty(name)->isNull()) {
-                material->getAppearanceProperty(name)->setValue(property->getValue());
+            if (material.getAppearanceProperty(name)->isNull()) {
+                material.getAppearanceProperty(name)->setValue(property->getValue());
             }
         }
     }
 
-    material->markDereferenced();
+    material.markDereferenced();
+}
+
+void MaterialLoader::loadMaterial(Material& material, const QString& path)
+{
+    std::string pathName = path.toStdString();
+    Base::FileInfo info(pathName);
+    Base::ifstream fin(info);
+    if (!fin) {
+        Base::Console().Error("YAML file open error: '%s'\n", pathName.c_str());
+        return;
+    }
+
+    YAML::Node yamlroot;
+    try {
+        yamlroot = YAML::Load(fin);
+
+        MaterialYamlEntry entry(material.getLibrary(),
+                                material.getName(),
+                                path,
+                                material.getUUID(),
+                                yamlroot);
+        entry.readMaterial(material);
+    }
+    catch (YAML::Exception const& e) {
+        Base::Console().Error("YAML parsing error: '%s'\n", pathName.c_str());
+        Base::Console().Error("\t'%s'\n", e.what());
+        showYaml(yamlroot);
+    }
+
+    auto materialMap = _libraryMaterialMap.lock();
+    if (materialMap) {
+        dereference(materialMap, material);
+    }
+}
+
+QString MaterialLoader::getIndexPath(const MaterialLibrary& library)
+{
+    std::string cachePath = App::Application::getUserCachePath();
+    if (cachePath.empty()) {
+        return {};
+    }
+
+    QByteArray hash =
+        QCryptographicHash::hash(library.getDirectory().toUtf8(), QCryptographicHash::Sha1);
+    return QString::fromStdString(cachePath + "MaterialIndex/")
+        + QString::fromLatin1(hash.toHex()) + QString::fromStdString(".txt");
+}
+
+MaterialLoader::LibraryIndex MaterialLoader::readIndex(const MaterialLibrary& library)
+{
+    LibraryIndex index;
+
+    QFile file(getIndexPath(library));
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return index;
+    }
+
+    QTextStream stream(&file);
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    stream.setCodec("UTF-8");
+#endif
+    // Each line holds the UUID, size, modification time and path of a card
+    while (!stream.atEnd()) {
+        QStringList fields = stream.readLine().split(QLatin1Char('\t'));
+        if (fields.size() == 4) {
+            index[fields[3]] = {fields[0], fields[1].toLongLong(), fields[2].toLongLong()};
+        }
+    }
+
+    return index;
+}
+
+void MaterialLoader::writeIndex(const MaterialLibrary& library, const LibraryIndex& index)
+{
+    QString indexPath = getIndexPath(library);
+    if (indexPath.isEmpty()) {
+        return;
+    }
+
+    QFileInfo info(indexPath);
+    QDir indexDir(info.path());
+    if (!indexDir.exists() && !indexDir.mkpath(info.path())) {
+        Base::Console().Log("Unable to create material index directory '%s'\n",
+                            info.path().toStdString().c_str());
+        return;
+    }
+
+    QFile file(indexPath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate)) {
+        Base::Console().Log("Unable to write material index '%s'\n",
+                            indexPath.toStdString().c_str());
+        return;
+    }
+
+    QTextStream stream(&file);
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    stream.setCodec("UTF-8");
+#endif
+    for (auto& it : index) {
+        stream << it.second.uuid << '\t' << it.second.size << '\t' << it.second.modified << '\t'
+               << it.first << '\n';
+    }
+}
+
+void MaterialLoader::addIndexedMaterial(const std::shared_ptr<MaterialLibrary>& library,
+                                        const QString& path,
+                                        const QString& uuid)
+{
+    // Always get the name from the filename
+    QFileInfo filepath(path);
+    QString name =
+        filepath.fileName().remove(QString::fromStdString(".FCMat"), Qt::CaseInsensitive);
+
+    auto material = std::make_shared<Material>(library, path, uuid, name);
+    material->setLoadPath(path);
+    (*_materialMap)[uuid] = library->addMaterial(material, path);
 }
 
 void MaterialLoader::dereference(const std::shared_ptr<Material>& material)
@@ -513,9 +631,13 @@ void MaterialLoader::dereference(const std::shared_ptr<Material>& material)
 
 void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibrary>& library)
 {
-    if (_materialEntryMap == nullptr) {
-        _materialEntryMap = std::make_unique<std::map<QString, std::shared_ptr<MaterialEntry>>>();
-    }
+    // The UUIDs of the cards are kept in an index between sessions. The cards that haven't
+    // changed since are only read when their material is first used.
+    LibraryIndex index = readIndex(*library);
+    LibraryIndex newIndex;
+    bool indexChanged = false;
+    std::map<QString, std::shared_ptr<MaterialEntry>> materialEntryMap;
+    std::vector<CardFile> cards;
 
     QDirIterator it(library->getDirectory(), QDirIterator::Subdirectories);
     while (it.hasNext()) {
@@ -523,22 +645,59 @@ void MaterialLoader::loadLibrary(const std::shared_ptr<MaterialLibrary>& library
         QFileInfo file(pathname);
         if (file.isFile()) {
             if (file.suffix().toStdString() == "FCMat") {
-                try {
-                    auto model = getMaterialFromPath(library, file.canonicalFilePath());
-                    if (model) {
-                        (*_materialEntryMap)[model->getUUID()] = model;
-                    }
+                QString path = file.canonicalFilePath();
+                IndexEntry entry {QString(), file.size(), file.lastModified().toMSecsSinceEpoch()};
+                auto indexed = index.find(path);
+                if (indexed != index.end() && indexed->second.size == entry.size
+                    && indexed->second.modified == entry.modified) {
+                    addIndexedMaterial(library, path, indexed->second.uuid);
+                    newIndex[path] = indexed->second;
+                    continue;
                 }
-                catch (const MaterialReadError&) {
-                    // Ignore the file. Error messages should have already been logged
+
+                cards.push_back({path, entry});
+            }
+        }
+    }
+
+    // Reading and parsing the other cards takes most of the time, it is spread over the
+    // threads of the pool. Adding them to the library is done here.
+    QtConcurrent::blockingMap(cards, [&library](CardFile& card) {
+        card.configStyle = MaterialConfigLoader::isConfigStyle(card.path);
+        if (!card.configStyle) {
+            card.model = readMaterialEntry(library, card.path);
+        }
+    });
+
+    for (auto& card : cards) {
+        if (card.configStyle) {
+            // Old format cards have no entry, so they are read again on every load
+            try {
+                auto material = MaterialConfigLoader::getMaterialFromPath(library, card.path);
+                if (material) {
+                    (*_materialMap)[material->getUUID()] =
+                        library->addMaterial(material, card.path);
                 }
             }
+            catch (const MaterialReadError&) {
+                // Ignore the file. Error messages should have already been logged
+            }
+        }
+        else if (card.model) {
+            materialEntryMap[card.model->getUUID()] = card.model;
+            card.entry.uuid = card.model->getUUID();
+            newIndex[card.path] = card.entry;
+            indexChanged = true;
         }
     }
 
-    for (auto& it : *_materialEntryMap) {
+    for (auto& it : materialEntryMap) {
         it.second->addToTree(_materialMap);
     }
+
+    if (indexChanged || newIndex.size() != index.size()) {
+        writeIndex(*library, newIndex);
+    }
 }
 
 void MaterialLoader::loadLibraries()
@@ -550,8 +709,11 @@ void MaterialLoader::loadLibraries()
         }
     }
 
+    // The materials that aren't loaded yet resolve their inheritance when they are
     for (auto& it : *_materialMap) {
-        dereference(it.second);
+        if (it.second->isLoaded()) {
+            dereference(it.second);
+        }
     }
 }
 
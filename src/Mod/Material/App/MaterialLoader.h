@@ -83,6 +83,8 @@ public:
 
     void
     addToTree(std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> materialMap) override;
+    // Sets the properties, models and parent of material from the card
+    void readMaterial(Material& material) const;
 
     const YAML::Node& getModel() const
     {
@@ -120,6 +122,11 @@ public:
     static void
     dereference(const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
                 const std::shared_ptr<Material>& material);
+    static void
+    dereference(const std::shared_ptr<std::map<QString, std::shared_ptr<Material>>>& materialMap,
+                Material& material);
+    // Reads the card at path into a material created from the index of its library
+    static void loadMaterial(Material& material, const QString& path);
     static std::shared_ptr<MaterialEntry>
     getMaterialFromYAML(const std::shared_ptr<MaterialLibrary>& library,
                         YAML::Node& yamlroot,
@@ -128,15 +135,42 @@ public:
 private:
     MaterialLoader();
 
+    // The UUID of a card, valid while the size and modification time of the file match
+    struct IndexEntry
+    {
+        QString uuid;
+        qint64 size;
+        qint64 modified;
+    };
+    using LibraryIndex = std::map<QString, IndexEntry>;
+
+    // A card that isn't in the index, with the results of reading it
+    struct CardFile
+    {
+        QString path;
+        IndexEntry entry;
+        bool configStyle = false;
+        std::shared_ptr<MaterialEntry> model;
+    };
+
+    static QString getIndexPath(const MaterialLibrary& library);
+    static LibraryIndex readIndex(const MaterialLibrary& library);
+    static void writeIndex(const MaterialLibrary& library, const LibraryIndex& index);
+
     void addToTree(std::shared_ptr<MaterialEntry> model);
     void dereference(const std::shared_ptr<Material>& material);
-    std::shared_ptr<MaterialEntry>
-    getMaterialFromPath(const std::shared_ptr<MaterialLibrary>& library, const QString& path) const;
+    // Reads a card in the YAML format, this may be called from any thread
+    static std::shared_ptr<MaterialEntry>
+    readMaterialEntry(const std::shared_ptr<MaterialLibrary>& library, const QString& path);
     void addLibrary(const std::shared_ptr<MaterialLibrary>& model);
+    void addIndexedMaterial(const std::shared_ptr<MaterialLibrary>& library,
+                            const QString& path,
+                            const QString& uuid);
     void loadLibrary(const std::shared_ptr<MaterialLibrary>& library);
     void loadLibraries();
 
-    static std::unique_ptr<std::map<QString, std::shared_ptr<MaterialEntry>>> _materialEntryMap;
+    // The materials the parents of the materials loaded on first use are looked up in
+    static std::weak_ptr<std::map<QString, std::shared_ptr<Material>>> _libraryMaterialMap;
     std::shared_ptr<std::map<QString, std::shared_ptr<Material>>> _materialMap;
     std::shared_ptr<std::list<std::shared_ptr<MaterialLibrary>>> _libraryList;
 };
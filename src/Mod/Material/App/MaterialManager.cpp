@@ -391,16 +391,20 @@ MaterialManager::materialsWithModelComplete(const QString& uuid) const
 
 void MaterialManager::dereference() const
 {
-    // First clear the inheritences
+    // First clear the inheritences. Materials not loaded yet get theirs when they are.
     for (auto& it : *_materialMap) {
         auto material = it.second;
-        material->clearDereferenced();
-        material->clearInherited();
+        if (material->isLoaded()) {
+            material->clearDereferenced();
+            material->clearInherited();
+        }
     }
 
     // Run the dereference again
     for (auto& it : *_materialMap) {
-        dereference(it.second);
+        if (it.second->isLoaded()) {
+            dereference(it.second);
+        }
     }
 }
 
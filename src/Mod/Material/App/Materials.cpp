@@ -32,6 +32,7 @@
 #include "Materials.h"
 
 #include "MaterialLibrary.h"
+#include "MaterialLoader.h"
 #include "MaterialManager.h"
 #include "ModelManager.h"
 #include "ModelUuids.h"
@@ -487,6 +488,7 @@ Material::Material(const Material& other)
     , _dereferenced(other._dereferenced)
     , _oldFormat(other._oldFormat)
     , _editState(other._editState)
+    , _loadPath(other._loadPath)
 {
     for (auto& it : other._tags) {
         _tags.insert(it);
@@ -513,8 +515,18 @@ Material::Material(const Material& other)
     }
 }
 
+void Material::load() const
+{
+    // Clear the path first, reading the card goes through the accessors of the material
+    auto self = const_cast<Material*>(this);
+    QString path = _loadPath;
+    self->_loadPath.clear();
+    MaterialLoader::loadMaterial(*self, path);
+}
+
 QString Material::getAuthorAndLicense() const
 {
+    ensureLoaded();
     QString authorAndLicense;
 
     // Combine the author and license field for backwards compatibility
@@ -533,6 +545,7 @@ QString Material::getAuthorAndLicense() const
 
 void Material::addModel(const QString& uuid)
 {
+    ensureLoaded();
     for (const auto& modelUUID : std::as_const(_allUuids)) {
         if (modelUUID == uuid) {
             return;
@@ -556,6 +569,7 @@ void Material::addModel(const QString& uuid)
 
 void Material::clearModels()
 {
+    ensureLoaded();
     _physicalUuids.clear();
     _appearanceUuids.clear();
     _allUuids.clear();
@@ -565,6 +579,7 @@ void Material::clearModels()
 
 void Material::clearInherited()
 {
+    ensureLoaded();
     _allUuids.clear();
 
     // Rebuild the UUID lists without the inherited UUIDs
@@ -584,36 +599,42 @@ void Material::setName(const QString& name)
 
 void Material::setAuthor(const QString& author)
 {
+    ensureLoaded();
     _author = author;
     setEditStateExtend();
 }
 
 void Material::setLicense(const QString& license)
 {
+    ensureLoaded();
     _license = license;
     setEditStateExtend();
 }
 
 void Material::setParentUUID(const QString& uuid)
 {
+    ensureLoaded();
     _parentUuid = uuid;
     setEditStateExtend();
 }
 
 void Material::setDescription(const QString& description)
 {
+    ensureLoaded();
     _description = description;
     setEditStateExtend();
 }
 
 void Material::setURL(const QString& url)
 {
+    ensureLoaded();
     _url = url;
     setEditStateExtend();
 }
 
 void Material::setReference(const QString& reference)
 {
+    ensureLoaded();
     _reference = reference;
     setEditStateExtend();
 }
@@ -637,6 +658,7 @@ void Material::removeUUID(QSet<QString>& uuidList, const QString& uuid)
 
 void Material::addPhysical(const QString& uuid)
 {
+    ensureLoaded();
     if (hasPhysicalModel(uuid)) {
         return;
     }
@@ -679,6 +701,7 @@ void Material::addPhysical(const QString& uuid)
 
 void Material::removePhysical(const QString& uuid)
 {
+    ensureLoaded();
     if (!hasPhysicalModel(uuid)) {
         return;
     }
@@ -714,6 +737,7 @@ void Material::removePhysical(const QString& uuid)
 
 void Material::addAppearance(const QString& uuid)
 {
+    ensureLoaded();
     if (hasAppearanceModel(uuid)) {
         return;
     }
@@ -750,6 +774,7 @@ void Material::addAppearance(const QString& uuid)
 
 void Material::removeAppearance(const QString& uuid)
 {
+    ensureLoaded();
     if (!hasAppearanceModel(uuid)) {
         return;
     }
@@ -784,6 +809,7 @@ void Material::removeAppearance(const QString& uuid)
 
 void Material::setPropertyEditState(const QString& name)
 {
+    ensureLoaded();
     try {
         if (hasPhysicalProperty(name)) {
             setPhysicalEditState(name);
@@ -798,6 +824,7 @@ void Material::setPropertyEditState(const QString& name)
 
 void Material::setPhysicalEditState(const QString& name)
 {
+    ensureLoaded();
     if (getPhysicalProperty(name)->isNull()) {
         setEditStateExtend();
     }
@@ -808,6 +835,7 @@ void Material::setPhysicalEditState(const QString& name)
 
 void Material::setAppearanceEditState(const QString& name)
 {
+    ensureLoaded();
     try {
         if (getAppearanceProperty(name)->isNull()) {
             setEditStateExtend();
@@ -822,6 +850,7 @@ void Material::setAppearanceEditState(const QString& name)
 
 void Material::setPhysicalValue(const QString& name, const QString& value)
 {
+    ensureLoaded();
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -831,6 +860,7 @@ void Material::setPhysicalValue(const QString& name, const QString& value)
 
 void Material::setPhysicalValue(const QString& name, int value)
 {
+    ensureLoaded();
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -840,6 +870,7 @@ void Material::setPhysicalValue(const QString& name, int value)
 
 void Material::setPhysicalValue(const QString& name, double value)
 {
+    ensureLoaded();
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -849,6 +880,7 @@ void Material::setPhysicalValue(const QString& name, double value)
 
 void Material::setPhysicalValue(const QString& name, const Base::Quantity& value)
 {
+    ensureLoaded();
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -858,6 +890,7 @@ void Material::setPhysicalValue(const QString& name, const Base::Quantity& value
 
 void Material::setPhysicalValue(const QString& name, const std::shared_ptr<MaterialValue>& value)
 {
+    ensureLoaded();
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -867,6 +900,7 @@ void Material::setPhysicalValue(const QString& name, const std::shared_ptr<Mater
 
 void Material::setPhysicalValue(const QString& name, const std::shared_ptr<QList<QVariant>>& value)
 {
+    ensureLoaded();
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -876,6 +910,7 @@ void Material::setPhysicalValue(const QString& name, const std::shared_ptr<QList
 
 void Material::setPhysicalValue(const QString& name, const QVariant& value)
 {
+    ensureLoaded();
     setPhysicalEditState(name);
 
     if (hasPhysicalProperty(name)) {
@@ -885,6 +920,7 @@ void Material::setPhysicalValue(const QString& name, const QVariant& value)
 
 void Material::setAppearanceValue(const QString& name, const QString& value)
 {
+    ensureLoaded();
     setAppearanceEditState(name);
 
     if (hasAppearanceProperty(name)) {
@@ -894,6 +930,7 @@ void Material::setAppearanceValue(const QString& name, const QString& value)
 
 void Material::setAppearanceValue(const QString& name, const std::shared_ptr<MaterialValue>& value)
 {
+    ensureLoaded();
     setAppearanceEditState(name);
 
     if (hasAppearanceProperty(name)) {
@@ -904,6 +941,7 @@ void Material::setAppearanceValue(const QString& name, const std::shared_ptr<Mat
 void Material::setAppearanceValue(const QString& name,
                                   const std::shared_ptr<QList<QVariant>>& value)
 {
+    ensureLoaded();
     setAppearanceEditState(name);
 
     if (hasAppearanceProperty(name)) {
@@ -913,6 +951,7 @@ void Material::setAppearanceValue(const QString& name,
 
 void Material::setAppearanceValue(const QString& name, const QVariant& value)
 {
+    ensureLoaded();
     setAppearanceEditState(name);
 
     if (hasAppearanceProperty(name)) {
@@ -922,6 +961,7 @@ void Material::setAppearanceValue(const QString& name, const QVariant& value)
 
 void Material::setValue(const QString& name, const QString& value)
 {
+    ensureLoaded();
     if (hasPhysicalProperty(name)) {
         setPhysicalValue(name, value);
     }
@@ -935,6 +975,7 @@ void Material::setValue(const QString& name, const QString& value)
 
 void Material::setValue(const QString& name, const QVariant& value)
 {
+    ensureLoaded();
     if (hasPhysicalProperty(name)) {
         setPhysicalValue(name, value);
     }
@@ -945,6 +986,7 @@ void Material::setValue(const QString& name, const QVariant& value)
 
 void Material::setLegacyValue(const QString& name, const QString& value)
 {
+    ensureLoaded();
     setEditStateAlter();
 
     _legacy[name] = value;
@@ -952,6 +994,7 @@ void Material::setLegacyValue(const QString& name, const QString& value)
 
 std::shared_ptr<MaterialProperty> Material::getPhysicalProperty(const QString& name)
 {
+    ensureLoaded();
     try {
         return _physical.at(name);
     }
@@ -962,6 +1005,7 @@ std::shared_ptr<MaterialProperty> Material::getPhysicalProperty(const QString& n
 
 std::shared_ptr<MaterialProperty> Material::getPhysicalProperty(const QString& name) const
 {
+    ensureLoaded();
     try {
         return _physical.at(name);
     }
@@ -972,6 +1016,7 @@ std::shared_ptr<MaterialProperty> Material::getPhysicalProperty(const QString& n
 
 std::shared_ptr<MaterialProperty> Material::getAppearanceProperty(const QString& name)
 {
+    ensureLoaded();
     try {
         return _appearance.at(name);
     }
@@ -982,6 +1027,7 @@ std::shared_ptr<MaterialProperty> Material::getAppearanceProperty(const QString&
 
 std::shared_ptr<MaterialProperty> Material::getAppearanceProperty(const QString& name) const
 {
+    ensureLoaded();
     try {
         return _appearance.at(name);
     }
@@ -992,6 +1038,7 @@ std::shared_ptr<MaterialProperty> Material::getAppearanceProperty(const QString&
 
 std::shared_ptr<MaterialProperty> Material::getProperty(const QString& name)
 {
+    ensureLoaded();
     if (hasPhysicalProperty(name)) {
         return getPhysicalProperty(name);
     }
@@ -1003,6 +1050,7 @@ std::shared_ptr<MaterialProperty> Material::getProperty(const QString& name)
 
 std::shared_ptr<MaterialProperty> Material::getProperty(const QString& name) const
 {
+    ensureLoaded();
     if (hasPhysicalProperty(name)) {
         return getPhysicalProperty(name);
     }
@@ -1057,46 +1105,55 @@ Material::getValueString(const std::map<QString, std::shared_ptr<MaterialPropert
 
 QVariant Material::getPhysicalValue(const QString& name) const
 {
+    ensureLoaded();
     return getValue(_physical, name);
 }
 
 Base::Quantity Material::getPhysicalQuantity(const QString& name) const
 {
+    ensureLoaded();
     return getValue(_physical, name).value<Base::Quantity>();
 }
 
 QString Material::getPhysicalValueString(const QString& name) const
 {
+    ensureLoaded();
     return getValueString(_physical, name);
 }
 
 QVariant Material::getAppearanceValue(const QString& name) const
 {
+    ensureLoaded();
     return getValue(_appearance, name);
 }
 
 Base::Quantity Material::getAppearanceQuantity(const QString& name) const
 {
+    ensureLoaded();
     return getValue(_appearance, name).value<Base::Quantity>();
 }
 
 QString Material::getAppearanceValueString(const QString& name) const
 {
+    ensureLoaded();
     return getValueString(_appearance, name);
 }
 
 bool Material::hasPhysicalProperty(const QString& name) const
 {
+    ensureLoaded();
     return _physical.find(name) != _physical.end();
 }
 
 bool Material::hasAppearanceProperty(const QString& name) const
 {
+    ensureLoaded();
     return _appearance.find(name) != _appearance.end();
 }
 
 bool Material::hasNonLegacyProperty(const QString& name) const
 {
+    ensureLoaded();
     if (hasPhysicalProperty(name) || hasAppearanceProperty(name)) {
         return true;
     }
@@ -1105,21 +1162,25 @@ bool Material::hasNonLegacyProperty(const QString& name) const
 
 bool Material::hasLegacyProperties() const
 {
+    ensureLoaded();
     return !_legacy.empty();
 }
 
 bool Material::hasPhysicalProperties() const
 {
+    ensureLoaded();
     return !_physicalUuids.isEmpty();
 }
 
 bool Material::hasAppearanceProperties() const
 {
+    ensureLoaded();
     return !_appearanceUuids.isEmpty();
 }
 
 bool Material::isInherited(const QString& uuid) const
 {
+    ensureLoaded();
     if (_physicalUuids.contains(uuid)) {
         return false;
     }
@@ -1132,11 +1193,13 @@ bool Material::isInherited(const QString& uuid) const
 
 bool Material::hasModel(const QString& uuid) const
 {
+    ensureLoaded();
     return _allUuids.contains(uuid);
 }
 
 bool Material::hasPhysicalModel(const QString& uuid) const
 {
+    ensureLoaded();
     if (!hasModel(uuid)) {
         return false;
     }
@@ -1157,6 +1220,7 @@ bool Material::hasPhysicalModel(const QString& uuid) const
 
 bool Material::hasAppearanceModel(const QString& uuid) const
 {
+    ensureLoaded();
     if (!hasModel(uuid)) {
         return false;
     }
@@ -1177,6 +1241,7 @@ bool Material::hasAppearanceModel(const QString& uuid) const
 
 bool Material::isPhysicalModelComplete(const QString& uuid) const
 {
+    ensureLoaded();
     if (!hasPhysicalModel(uuid)) {
         return false;
     }
@@ -1203,6 +1268,7 @@ bool Material::isPhysicalModelComplete(const QString& uuid) const
 
 bool Material::isAppearanceModelComplete(const QString& uuid) const
 {
+    ensureLoaded();
     if (!hasAppearanceModel(uuid)) {
         return false;
     }
@@ -1421,6 +1487,7 @@ void Material::newUuid()
 
 QString Material::getModelByName(const QString& name) const
 {
+    ensureLoaded();
     ModelManager manager;
 
     for (auto& it : _allUuids) {
@@ -1439,6 +1506,7 @@ QString Material::getModelByName(const QString& name) const
 
 void Material::save(QTextStream& stream, bool overwrite, bool saveAsCopy, bool saveInherited)
 {
+    ensureLoaded();
     if (saveInherited && !saveAsCopy) {
         // Check to see if we're an original or if we're already in the list of
         // models
@@ -1505,6 +1573,7 @@ Material& Material::operator=(const Material& other)
     _dereferenced = other._dereferenced;
     _oldFormat = other._oldFormat;
     _editState = other._editState;
+    _loadPath = other._loadPath;
 
     _tags.clear();
     for (auto& it : other._tags) {
@@ -1544,6 +1613,7 @@ Material& Material::operator=(const Material& other)
 
 Material& Material::operator=(const App::Material& other)
 {
+    ensureLoaded();
     if (!hasAppearanceModel(ModelUUIDs::ModelUUID_Rendering_Basic)) {
         addAppearance(ModelUUIDs::ModelUUID_Rendering_Basic);
     }
@@ -1611,6 +1681,7 @@ void Material::updateInheritance([[maybe_unused]] const QString& parent)
  */
 QStringList Material::inheritedMissingModels(const Material& parent) const
 {
+    ensureLoaded();
     QStringList missing;
     for (auto& uuid : parent._allUuids) {
         if (!hasModel(uuid)) {
@@ -1626,6 +1697,7 @@ QStringList Material::inheritedMissingModels(const Material& parent) const
  */
 QStringList Material::inheritedAddedModels(const Material& parent) const
 {
+    ensureLoaded();
     QStringList added;
     for (auto& uuid : _allUuids) {
         if (!parent.hasModel(uuid)) {
@@ -1649,6 +1721,7 @@ void Material::inheritedPropertyDiff([[maybe_unused]] const QString& parent)
  */
 App::Material Material::getMaterialAppearance() const
 {
+    ensureLoaded();
     App::Material material(App::Material::DEFAULT);
 
     bool custom = false;
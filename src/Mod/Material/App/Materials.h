@@ -195,26 +195,32 @@ public:
     QString getAuthorAndLicense() const;
     QString getAuthor() const
     {
+        ensureLoaded();
         return _author;
     }
     QString getLicense() const
     {
+        ensureLoaded();
         return _license;
     }
     QString getParentUUID() const
     {
+        ensureLoaded();
         return _parentUuid;
     }
     QString getDescription() const
     {
+        ensureLoaded();
         return _description;
     }
     QString getURL() const
     {
+        ensureLoaded();
         return _url;
     }
     QString getReference() const
     {
+        ensureLoaded();
         return _reference;
     }
     ModelEdit getEditState() const
@@ -223,14 +229,17 @@ public:
     }
     const QSet<QString>& getTags() const
     {
+        ensureLoaded();
         return _tags;
     }
     const QSet<QString>* getPhysicalModels() const
     {
+        ensureLoaded();
         return &_physicalUuids;
     }
     const QSet<QString>* getAppearanceModels() const
     {
+        ensureLoaded();
         return &_appearanceUuids;
     }
 
@@ -347,22 +356,27 @@ public:
 
     std::map<QString, std::shared_ptr<MaterialProperty>>& getPhysicalProperties()
     {
+        ensureLoaded();
         return _physical;
     }
     const std::map<QString, std::shared_ptr<MaterialProperty>>& getPhysicalProperties() const
     {
+        ensureLoaded();
         return _physical;
     }
     std::map<QString, std::shared_ptr<MaterialProperty>>& getAppearanceProperties()
     {
+        ensureLoaded();
         return _appearance;
     }
     const std::map<QString, std::shared_ptr<MaterialProperty>>& getAppearanceProperties() const
     {
+        ensureLoaded();
         return _appearance;
     }
     std::map<QString, QString>& getLegacyProperties()
     {
+        ensureLoaded();
         return _legacy;
     }
 
@@ -370,6 +384,7 @@ public:
 
     bool getDereferenced() const
     {
+        ensureLoaded();
         return _dereferenced;
     }
     void markDereferenced()
@@ -380,8 +395,20 @@ public:
     {
         _dereferenced = false;
     }
+    /*
+     * Materials found in the index of a library read their card when they are first used
+     */
+    bool isLoaded() const
+    {
+        return _loadPath.isEmpty();
+    }
+    void setLoadPath(const QString& path)
+    {
+        _loadPath = path;
+    }
     bool isOldFormat() const
     {
+        ensureLoaded();
         return _oldFormat;
     }
     void setOldFormat(bool isOld)
@@ -452,6 +479,14 @@ protected:
     void saveModels(QTextStream& stream, bool saveInherited) const;
     void saveAppearanceModels(QTextStream& stream, bool saveInherited) const;
 
+    void ensureLoaded() const
+    {
+        if (!_loadPath.isEmpty()) {
+            load();
+        }
+    }
+    void load() const;
+
 private:
     std::shared_ptr<MaterialLibrary> _library;
     QString _directory;
@@ -473,6 +508,7 @@ private:
     bool _dereferenced;
     bool _oldFormat;
     ModelEdit _editState;
+    QString _loadPath;  // The card to read the contents from, empty once loaded
 };
 
 inline QTextStream& operator<<(QTextStream& output, const MaterialProperty& property)
@@ -24,6 +24,7 @@
 #include <QString>
 #include <QDirIterator>
 #include <QFileInfo>
+#include <QtConcurrentMap>
 #endif
 
 #include <App/Application.h>
@@ -318,24 +319,47 @@ void ModelLoader::loadLibrary(std::shared_ptr<ModelLibrary> library)
         _modelEntryMap = std::make_unique<std::map<QString, std::shared_ptr<ModelEntry>>>();
     }
 
+    struct ModelFile
+    {
+        QString path;
+        std::shared_ptr<ModelEntry> model;
+    };
+    std::vector<ModelFile> files;
+
     QDirIterator it(library->getDirectory(), QDirIterator::Subdirectories);
     while (it.hasNext()) {
         auto pathname = it.next();
         QFileInfo file(pathname);
         if (file.isFile()) {
             if (file.suffix().toStdString() == "yml") {
-                try {
-                    auto model = getModelFromPath(library, file.canonicalFilePath());
-                    (*_modelEntryMap)[model->getUUID()] = model;
-                    // showYaml(model->getModel());
-                }
-                catch (InvalidModel const&) {
-                    Base::Console().Log("Invalid model '%s'\n", pathname.toStdString().c_str());
-                }
+                files.push_back({file.canonicalFilePath(), nullptr});
             }
         }
     }
 
+    // The files are parsed by the threads of the pool, the models are added in order below
+    QtConcurrent::blockingMap(files, [this, &library](ModelFile& file) {
+        try {
+            file.model = getModelFromPath(library, file.path);
+        }
+        catch (const InvalidModel&) {
+            // Reported when the models are added
+        }
+        catch (const ModelNotFound&) {
+            // Reported when the models are added
+        }
+    });
+
+    for (auto& file : files) {
+        if (file.model) {
+            (*_modelEntryMap)[file.model->getUUID()] = file.model;
+            // showYaml(model->getModel());
+        }
+        else {
+            Base::Console().Log("Invalid model '%s'\n", file.path.toStdString().c_str());
+        }
+    }
+
     std::map<std::pair<QString, QString>, QString> inheritances;
     for (auto it = _modelEntryMap->begin(); it != _modelEntryMap->end(); it++) {
         dereference(it->second, &inheritances);
@@ -57,7 +57,9 @@
 
 // Qt
 #include <QtGlobal>
+#include <QCryptographicHash>
 #include <QDirIterator>
+#include <QFile>
 #include <QFileInfo>
 #include <QIODevice>
 #include <QList>
@@ -66,6 +68,7 @@
 #include <QRegularExpression>
 #include <QString>
 #include <QTextStream>
+#include <QtConcurrentMap>
 #include <QUuid>
 #include <QVector>
 
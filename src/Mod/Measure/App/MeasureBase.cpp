@@ -20,6 +20,9 @@
  **************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#endif
 
 #include <App/PropertyGeo.h>
 #include <Base/PlacementPy.h>
@@ -188,6 +191,66 @@ QString MeasureBase::getResultString()
     return QString();
 }
 
+//! returns the revisions of everything the elements of the input properties depend on, empty if
+//! the inputs are not linked elements
+ShapeRevisions MeasureBase::getInputRevisions()
+{
+    ShapeRevisions revisions;
+    for (const auto& name : getInputProps()) {
+        App::Property* prop = getPropertyByName(name.c_str());
+        std::vector<App::DocumentObject*> objects;
+        std::vector<std::string> subs;
+        if (auto linkSub = dynamic_cast<App::PropertyLinkSub*>(prop)) {
+            objects.assign(linkSub->getSubValues().size(), linkSub->getValue());
+            subs = linkSub->getSubValues();
+        }
+        else if (auto linkSubList = dynamic_cast<App::PropertyLinkSubList*>(prop)) {
+            objects = linkSubList->getValues();
+            subs = linkSubList->getSubValues();
+        }
+        else {
+            return {};
+        }
+
+        for (std::size_t i = 0; i < objects.size() && i < subs.size(); i++) {
+            if (!objects[i]) {
+                return {};
+            }
+            auto objectRevisions = ShapeFinder::getRevisions(*objects[i], subs[i]);
+            revisions.insert(revisions.end(), objectRevisions.begin(), objectRevisions.end());
+        }
+    }
+    return revisions;
+}
+
+bool MeasureBase::hasTouchedProperty() const
+{
+    std::vector<App::Property*> props;
+    getPropertyList(props);
+    return std::any_of(props.begin(), props.end(), [](const App::Property* prop) {
+        return prop->isTouched();
+    });
+}
+
+App::DocumentObjectExecReturn* MeasureBase::recompute()
+{
+    // The measurement is touched whenever anything it depends on recomputes, e.g. any part of
+    // the assembly holding a measured element.
+    auto revisions = getInputRevisions();
+    if (!revisions.empty() && revisions == inputRevisions && !hasTouchedProperty()) {
+        return DocumentObject::StdReturn;
+    }
+
+    auto ret = DocumentObject::recompute();
+    if (ret == DocumentObject::StdReturn) {
+        inputRevisions = std::move(revisions);
+    }
+    else {
+        inputRevisions.clear();
+    }
+    return ret;
+}
+
 void MeasureBase::onDocumentRestored()
 {
     // Force recompute the measurement
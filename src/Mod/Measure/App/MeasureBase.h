@@ -42,6 +42,8 @@
 #include <Mod/Part/App/MeasureInfo.h>
 #include <Mod/Part/App/MeasureClient.h>  // needed?
 
+#include "ShapeFinder.h"
+
 
 namespace Measure
 {
@@ -77,8 +79,16 @@ public:
     // Return the objects that are measured
     virtual std::vector<App::DocumentObject*> getSubject() const;
 
+    // Skips the computation if none of the measured elements changed
+    App::DocumentObjectExecReturn* recompute() override;
+
 private:
     Py::Object getProxyObject() const;
+    ShapeRevisions getInputRevisions();
+    bool hasTouchedProperty() const;
+
+    // The revisions of the measured elements at the last successful computation
+    ShapeRevisions inputRevisions;
 
 protected:
     void onDocumentRestored() override;
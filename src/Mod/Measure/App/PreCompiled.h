@@ -35,9 +35,12 @@
 
 // STL
 #include <algorithm>
+#include <list>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // OpenCasCade
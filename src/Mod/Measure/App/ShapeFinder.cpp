@@ -28,6 +28,10 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #endif
 
 #include <boost_regex.hpp>
@@ -39,6 +43,7 @@
 #include <BRepBuilderAPI_Copy.hxx>
 #include <TopLoc_Location.hxx>
 
+#include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObjectGroup.h>
 #include <App/Link.h>
@@ -51,11 +56,135 @@
 #include <Mod/Part/App/AttachExtension.h>
 #include <Mod/Part/App/Attacher.h>
 
+#include "Preferences.h"
 #include "ShapeFinder.h"
 
 
 using namespace Measure;
 
+namespace
+{
+
+//! counts the changes of document objects.  Every property change of an object gives it a new
+//! revision, so the revisions of the objects along a path tell if a located shape is still valid.
+class RevisionTracker
+{
+public:
+    static RevisionTracker& instance()
+    {
+        static RevisionTracker tracker;
+        return tracker;
+    }
+
+    std::uint64_t get(const App::DocumentObject* object)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // an object seen for the first time gets a new revision, so an object created at the
+        // address of a deleted one does not match the revisions recorded for the old one
+        auto result = revisions.emplace(object, 0);
+        if (result.second) {
+            result.first->second = ++counter;
+        }
+        return result.first->second;
+    }
+
+private:
+    RevisionTracker()
+    {
+        auto& app = App::GetApplication();
+        // NOLINTBEGIN
+        connections.emplace_back(app.signalChangedObject.connect(
+            [this](const App::DocumentObject& object, const App::Property&) { bump(&object); }));
+        connections.emplace_back(app.signalDeletedObject.connect(
+            [this](const App::DocumentObject& object) { forget(&object); }));
+        connections.emplace_back(app.signalDeleteDocument.connect(
+            [this](const App::Document& doc) {
+                for (auto object : doc.getObjects()) {
+                    forget(object);
+                }
+            }));
+        // NOLINTEND
+    }
+
+    void bump(const App::DocumentObject* object)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        revisions[object] = ++counter;
+    }
+
+    void forget(const App::DocumentObject* object)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        revisions.erase(object);
+    }
+
+    std::mutex mutex;
+    std::uint64_t counter = 0;
+    std::unordered_map<const App::DocumentObject*, std::uint64_t> revisions;
+    std::vector<boost::signals2::scoped_connection> connections;
+};
+
+//! remembers the recently located shapes with the revisions they were found at
+class LocatedShapeCache
+{
+public:
+    struct Entry
+    {
+        ShapeRevisions revisions;
+        TopoDS_Shape shape;
+    };
+
+    static LocatedShapeCache& instance()
+    {
+        static LocatedShapeCache cache;
+        return cache;
+    }
+
+    std::size_t capacity() const
+    {
+        return static_cast<std::size_t>(
+            std::max<long>(Preferences::getPreferenceGroup("General")->GetInt("ShapeCacheSize", 200),
+                           0));
+    }
+
+    bool find(const std::string& key, const ShapeRevisions& revisions, TopoDS_Shape& shape)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key);
+        if (it == index.end() || it->second->second.revisions != revisions) {
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        shape = it->second->second.shape;
+        return true;
+    }
+
+    void insert(const std::string& key, Entry&& entry, std::size_t limit)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key);
+        if (it != index.end()) {
+            entries.erase(it->second);
+            index.erase(it);
+        }
+        entries.emplace_front(key, std::move(entry));
+        index.emplace(key, entries.begin());
+        while (entries.size() > limit) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+
+private:
+    using EntryList = std::list<std::pair<std::string, Entry>>;
+
+    std::mutex mutex;
+    EntryList entries;
+    std::unordered_map<std::string, EntryList::iterator> index;
+};
+
+}  // namespace
+
 //! ResolveResult is a class to hold the result of resolving a selection into the actual target
 //! object and traditional subElement name (Vertex1).
 
@@ -106,6 +235,30 @@ ResolveResult ShapeFinder::resolveSelection(const App::DocumentObject& selectObj
 //       and ShapeFinder::getLinkAttachParent()
 TopoDS_Shape ShapeFinder::getLocatedShape(const App::DocumentObject& rootObject,
                                           const std::string& leafSub)
+{
+    // resolving the path and copying the shape is repeated for every recompute of a dimension
+    // or measurement, even if nothing along the path has changed
+    auto& cache = LocatedShapeCache::instance();
+    std::size_t capacity = cache.capacity();
+    if (capacity == 0) {
+        return findLocatedShape(rootObject, leafSub);
+    }
+
+    std::ostringstream key;
+    key << static_cast<const void*>(&rootObject) << ':' << leafSub;
+    auto revisions = getRevisions(rootObject, leafSub);
+    TopoDS_Shape shape;
+    if (!cache.find(key.str(), revisions, shape)) {
+        shape = findLocatedShape(rootObject, leafSub);
+        cache.insert(key.str(), {std::move(revisions), shape}, capacity);
+    }
+    return shape;
+}
+
+
+//! returns the located shape of rootObject+leafSub without looking at the cache
+TopoDS_Shape ShapeFinder::findLocatedShape(const App::DocumentObject& rootObject,
+                                           const std::string& leafSub)
 {
     auto resolved = resolveSelection(rootObject, leafSub);
     auto target = &resolved.getTarget();
@@ -140,6 +293,36 @@ Part::TopoShape ShapeFinder::getLocatedTopoShape(const App::DocumentObject& root
 }
 
 
+//! returns the revision of object.  The revision changes whenever a property of object changes.
+std::uint64_t ShapeFinder::getRevision(const App::DocumentObject* object)
+{
+    return RevisionTracker::instance().get(object);
+}
+
+
+//! returns the revisions of the objects the located shape of rootObject+leafSub depends on: the
+//! groups holding rootObject, the objects along leafSub and the objects linked by them.
+ShapeRevisions ShapeFinder::getRevisions(const App::DocumentObject& rootObject,
+                                         const std::string& leafSub)
+{
+    ShapeRevisions revisions;
+    auto group = App::GeoFeatureGroupExtension::getGroupOfObject(&rootObject);
+    for (; group; group = App::GeoFeatureGroupExtension::getGroupOfObject(group)) {
+        revisions.emplace_back(group, getRevision(group));
+    }
+
+    auto cleanSub = removeTnpInfo(leafSub);
+    for (auto object : rootObject.getSubObjectList(cleanSub.c_str())) {
+        revisions.emplace_back(object, getRevision(object));
+        auto linked = object->getLinkedObject(true);
+        if (linked && linked != object) {
+            revisions.emplace_back(linked, getRevision(linked));
+        }
+    }
+    return revisions;
+}
+
+
 //! traverse the tree from leafSub up to rootObject, obtaining placements along the way.  Note that
 //! the placements will need to be applied in the reverse order (ie top down) of what is delivered
 //! in plm stack.  leafSub is a dot separated longSubName which DOES NOT include rootObject.  the
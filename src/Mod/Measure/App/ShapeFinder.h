@@ -26,6 +26,10 @@
 
 #include <Mod/Measure/MeasureGlobal.h>
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include <TopoDS_Shape.hxx>
 
 #include <App/DocumentObject.h>
@@ -40,6 +44,10 @@
 namespace Measure
 {
 
+//! the objects a located shape depends on, paired with their revisions at the time the shape
+//! was found.  The pointers are only compared, never dereferenced.
+using ShapeRevisions = std::vector<std::pair<const App::DocumentObject*, std::uint64_t>>;
+
 //! a class to hold the result of resolving a selection into the actual target object
 //! and traditional subElement name (Vertex1)
 
@@ -70,6 +78,10 @@ public:
     static Part::TopoShape getLocatedTopoShape(const App::DocumentObject& rootObject,
                                                const std::string& leafSub);
 
+    static std::uint64_t getRevision(const App::DocumentObject* object);
+    static ShapeRevisions getRevisions(const App::DocumentObject& rootObject,
+                                       const std::string& leafSub);
+
 
     static std::pair<Base::Placement, Base::Matrix4D>
     getGlobalTransform(const App::DocumentObject& rootObject, const std::string& leafSub);
@@ -110,6 +122,8 @@ public:
 
 
 private:
+    static TopoDS_Shape findLocatedShape(const App::DocumentObject& rootObject,
+                                         const std::string& leafSub);
     static bool ignoreModule(const std::string& moduleName);
     static bool ignoreObject(const App::DocumentObject* object);
     static bool ignoreLinkAttachedObject(const App::DocumentObject* object,
@@ -31,6 +31,7 @@
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "BVH.h"
 #include "Elements.h"
 #include "Grid.h"
 #include "Iterator.h"
@@ -142,6 +143,15 @@ bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
     return false;
 }
 
+bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
+                                      const Base::Vector3f& rclDir,
+                                      const MeshFacetBVH& rclBVH,
+                                      Base::Vector3f& rclRes,
+                                      FacetIndex& rulFacet) const
+{
+    return rclBVH.NearestFacetOnRay(rclPt, rclDir, Mathf::PI, rclRes, rulFacet);
+}
+
 bool MeshAlgorithm::NearestFacetOnRay(const Base::Vector3f& rclPt,
                                       const Base::Vector3f& rclDir,
                                       float fMaxSearchArea,
@@ -721,6 +731,63 @@ bool MeshAlgorithm::FillupHole(const std::vector<PointIndex>& boundary,
         }
     }
 
+    std::set<PointIndex> surfPoints;
+    if (pP2FStructure && level > 0) {
+        surfPoints = pP2FStructure->NeighbourPoints(boundary, level);
+    }
+
+    return TriangulateHole(boundary, cTria, rFaces, rPoints, rFace, rTriangle, surfPoints);
+}
+
+bool MeshAlgorithm::FillupHole(const std::vector<PointIndex>& boundary,
+                               AbstractPolygonTriangulator& cTria,
+                               MeshFacetArray& rFaces,
+                               MeshPointArray& rPoints,
+                               int level,
+                               const MeshCornerTable& table) const
+{
+    if (boundary.front() == boundary.back()) {
+        // first and last vertex are identical
+        if (boundary.size() < 4) {
+            return false;  // something strange
+        }
+    }
+    else if (boundary.size() < 3) {
+        return false;  // something strange
+    }
+
+    // Get a facet as reference coordinate system
+    std::vector<FacetIndex> f_int = table.GetFacets(boundary[0], boundary[1]);
+    if (f_int.size() != 1) {
+        return false;  // error, this must be an open edge!
+    }
+
+    const MeshFacet& rFace = _rclMesh._aclFacetArray[f_int.front()];
+    std::set<PointIndex> surfPoints;
+    if (level > 0) {
+        surfPoints = table.NeighbourPoints(boundary, level);
+    }
+
+    return TriangulateHole(boundary,
+                           cTria,
+                           rFaces,
+                           rPoints,
+                           rFace,
+                           _rclMesh.GetFacet(rFace),
+                           surfPoints);
+}
+
+bool MeshAlgorithm::TriangulateHole(const std::vector<PointIndex>& boundary,
+                                    AbstractPolygonTriangulator& cTria,
+                                    MeshFacetArray& rFaces,
+                                    MeshPointArray& rPoints,
+                                    const MeshFacet& rFace,
+                                    const MeshGeomFacet& rTriangle,
+                                    const std::set<PointIndex>& surfPoints) const
+{
+    PointIndex refPoint0 = *(boundary.begin());
+    PointIndex refPoint1 = *(boundary.begin() + 1);
+
     // add points to the polygon
     std::vector<Base::Vector3f> polygon;
     for (PointIndex jt : boundary) {
@@ -744,12 +811,9 @@ bool MeshAlgorithm::FillupHole(const std::vector<PointIndex>& boundary,
     cTria.SetIndices(bounds);
 
     std::vector<Base::Vector3f> surf_pts = cTria.GetPolygon();
-    if (pP2FStructure && level > 0) {
-        std::set<PointIndex> index = pP2FStructure->NeighbourPoints(boundary, level);
-        for (PointIndex it : index) {
-            Base::Vector3f pt(_rclMesh._aclPointArray[it]);
-            surf_pts.push_back(pt);
-        }
+    for (PointIndex it : surfPoints) {
+        Base::Vector3f pt(_rclMesh._aclPointArray[it]);
+        surf_pts.push_back(pt);
     }
 
     if (cTria.TriangulatePolygon()) {
@@ -1191,15 +1255,18 @@ void MeshAlgorithm::CheckFacets(const MeshFacetGrid& rclGrid,
 
     // if true use grid on mesh to speed up search
     if (bInner) {
-        BoundBox3f clBBox3d;
-        BoundBox2d clViewBBox;
+        std::vector<BoundBox2d> aclViewBBoxes;
         std::vector<FacetIndex> aulAllElements;
-        // iterator for the bounding box grids
+        // iterator for the bounding box grids, the projected boxes are tested at once
         MeshGridIterator clGridIter(rclGrid);
         for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-            clBBox3d = clGridIter.GetBoundBox();
-            clViewBBox = clBBox3d.ProjectBox(&fixedProj);
-            if (clViewBBox.Intersect(clPolyBBox)) {
+            aclViewBBoxes.push_back(clGridIter.GetBoundBox().ProjectBox(&fixedProj));
+        }
+        std::vector<unsigned char> hits(aclViewBBoxes.size());
+        clPolyBBox.Intersect(aclViewBBoxes.data(), aclViewBBoxes.size(), hits.data());
+        std::size_t cell = 0;
+        for (clGridIter.Init(); clGridIter.More(); clGridIter.Next(), cell++) {
+            if (hits[cell]) {
                 // collect all elements in aulAllElements
                 clGridIter.GetElements(aulAllElements);
             }
@@ -1262,23 +1329,15 @@ void MeshAlgorithm::CheckFacets(const Base::ViewProjMethod* pclProj,
                                 bool bInner,
                                 std::vector<FacetIndex>& raulFacets) const
 {
-    const MeshPointArray& p = _rclMesh.GetPoints();
     const MeshFacetArray& f = _rclMesh.GetFacets();
-    Base::Vector3f pt2d;
-    // Use a bounding box to reduce number of call to Polygon::Contains
-    Base::BoundBox2d bb = rclPoly.CalcBoundBox();
-    // Precompute the screen projection matrix as Coin's projection function is expensive
-    Base::ViewProjMatrix fixedProj(pclProj->getComposedProjectionMatrix());
+    // Test every point only once instead of once for each of its facets
+    std::vector<unsigned char> inside;
+    CheckPoints(pclProj, rclPoly, inside);
 
     FacetIndex index = 0;
     for (auto it = f.begin(); it != f.end(); ++it, ++index) {
         for (PointIndex ptIndex : it->_aulPoints) {
-            pt2d = fixedProj(p[ptIndex]);
-
-            // First check whether the point is in the bounding box of the polygon
-            if ((bb.Contains(Base::Vector2d(pt2d.x, pt2d.y))
-                 && rclPoly.Contains(Base::Vector2d(pt2d.x, pt2d.y)))
-                ^ !bInner) {
+            if ((inside[ptIndex] != 0) ^ !bInner) {
                 raulFacets.push_back(index);
                 break;
             }
@@ -1286,6 +1345,30 @@ void MeshAlgorithm::CheckFacets(const Base::ViewProjMethod* pclProj,
     }
 }
 
+void MeshAlgorithm::CheckPoints(const Base::ViewProjMethod* pclProj,
+                                const Base::Polygon2d& rclPoly,
+                                std::vector<unsigned char>& inside) const
+{
+    const MeshPointArray& p = _rclMesh.GetPoints();
+    // Precompute the screen projection matrix as Coin's projection function is expensive
+    Base::ViewProjMatrix fixedProj(pclProj->getComposedProjectionMatrix());
+
+    // Project the points in blocks and test a whole block against the polygon at once
+    constexpr std::size_t blockSize = 4096;
+    std::vector<Base::Vector2d> block;
+    block.reserve(blockSize);
+    inside.resize(p.size());
+    for (std::size_t start = 0; start < p.size(); start += blockSize) {
+        std::size_t size = std::min(blockSize, p.size() - start);
+        block.clear();
+        for (std::size_t i = 0; i < size; i++) {
+            Base::Vector3f pt2d = fixedProj(p[start + i]);
+            block.emplace_back(pt2d.x, pt2d.y);
+        }
+        rclPoly.Contains(block.data(), size, inside.data() + start);
+    }
+}
+
 float MeshAlgorithm::Surface() const
 {
     float fTotal = 0.0F;
@@ -1479,6 +1562,14 @@ bool MeshAlgorithm::NearestPointFromPoint(const Base::Vector3f& rclPt,
     return true;
 }
 
+bool MeshAlgorithm::NearestPointFromPoint(const Base::Vector3f& rclPt,
+                                          const MeshFacetBVH& rclBVH,
+                                          FacetIndex& rclResFacetIndex,
+                                          Base::Vector3f& rclResPoint) const
+{
+    return rclBVH.NearestFacetToPoint(rclPt, FLOAT_MAX, rclResPoint, rclResFacetIndex);
+}
+
 bool MeshAlgorithm::NearestPointFromPoint(const Base::Vector3f& rclPt,
                                           const MeshFacetGrid& rclGrid,
                                           FacetIndex& rclResFacetIndex,
@@ -45,9 +45,11 @@ namespace MeshCore
 class MeshGeomFacet;
 class MeshGeomEdge;
 class MeshKernel;
+class MeshFacetBVH;
 class MeshFacetGrid;
 class MeshFacetArray;
 class MeshRefPointToFacets;
+class MeshCornerTable;
 class AbstractPolygonTriangulator;
 
 /**
@@ -99,6 +101,19 @@ public:
                            const MeshFacetGrid& rclGrid,
                            Base::Vector3f& rclRes,
                            FacetIndex& rulFacet) const;
+    /**
+     * Searches for the nearest facet to the ray defined by
+     * (\a rclPt, \a rclDir).
+     * The point \a rclRes holds the intersection point with the ray and the
+     * nearest facet with index \a rulFacet.
+     * \note This method is optimized by using a bounding volume hierarchy and
+     * gives the same result as the brute force search.
+     */
+    bool NearestFacetOnRay(const Base::Vector3f& rclPt,
+                           const Base::Vector3f& rclDir,
+                           const MeshFacetBVH& rclBVH,
+                           Base::Vector3f& rclRes,
+                           FacetIndex& rulFacet) const;
     /**
      * Searches for the nearest facet to the ray defined by
      * (\a rclPt, \a rclDir).
@@ -218,6 +233,16 @@ public:
                     MeshPointArray& rPoints,
                     int level,
                     const MeshRefPointToFacets* pP2FStructure = nullptr) const;
+    /**
+     * Does the same as the method above but uses the corner table \a table of the
+     * mesh for the topological queries.
+     */
+    bool FillupHole(const std::vector<PointIndex>& boundary,
+                    AbstractPolygonTriangulator& cTria,
+                    MeshFacetArray& rFaces,
+                    MeshPointArray& rPoints,
+                    int level,
+                    const MeshCornerTable& table) const;
     /** Sets to all facets in \a raulInds the properties in raulProps.
      * \note Both arrays must have the same size.
      */
@@ -298,6 +323,13 @@ public:
                      const Base::Polygon2d& rclPoly,
                      bool bInner,
                      std::vector<FacetIndex>& facets) const;
+    /**
+     * Projects all points through projection with \a pclProj into the 2D plane and sets their
+     * flags in \a inside to 1 if they lie inside the polygon and to 0 otherwise.
+     */
+    void CheckPoints(const Base::ViewProjMethod* pclProj,
+                     const Base::Polygon2d& rclPoly,
+                     std::vector<unsigned char>& inside) const;
     /**
      * Determines all facets of the given array \a raclFacetIndices that lie at the edge or that
      * have at least neighbour facet that is not inside the array. The resulting array \a
@@ -347,6 +379,10 @@ public:
     bool NearestPointFromPoint(const Base::Vector3f& rclPt,
                                FacetIndex& rclResFacetIndex,
                                Base::Vector3f& rclResPoint) const;
+    bool NearestPointFromPoint(const Base::Vector3f& rclPt,
+                               const MeshFacetBVH& rclBVH,
+                               FacetIndex& rclResFacetIndex,
+                               Base::Vector3f& rclResPoint) const;
     bool NearestPointFromPoint(const Base::Vector3f& rclPt,
                                const MeshFacetGrid& rclGrid,
                                FacetIndex& rclResFacetIndex,
@@ -414,6 +450,18 @@ protected:
      */
     void SplitBoundaryFromOpenEdges(std::list<std::pair<PointIndex, PointIndex>>& openEdges,
                                     std::list<PointIndex>& boundary) const;
+    /**
+     * Triangulates the hole \a boundary whose first edge is an open edge of the
+     * reference facet \a rFace. \a surfPoints are further points of the surface
+     * around the hole that are used to fit the triangulation.
+     */
+    bool TriangulateHole(const std::vector<PointIndex>& boundary,
+                         AbstractPolygonTriangulator& cTria,
+                         MeshFacetArray& rFaces,
+                         MeshPointArray& rPoints,
+                         const MeshFacet& rFace,
+                         const MeshGeomFacet& rTriangle,
+                         const std::set<PointIndex>& surfPoints) const;
 
 private:
     const MeshKernel& _rclMesh; /**< The mesh kernel. */
@@ -0,0 +1,600 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <thread>
+#endif
+
+#include "BVH.h"
+#include "Elements.h"
+#include "Functional.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+namespace
+{
+constexpr std::size_t MaxLeafSize = 4;
+constexpr std::size_t ParallelGrain = 50000;
+constexpr int NumBins = 16;
+// beyond this depth the median split is used to limit the depth of the tree
+constexpr int MaxSAHDepth = 48;
+
+float HalfArea(const Base::BoundBox3f& box)
+{
+    float dx = box.LengthX();
+    float dy = box.LengthY();
+    float dz = box.LengthZ();
+    return dx * dy + dy * dz + dz * dx;
+}
+
+struct Bin
+{
+    Base::BoundBox3f box;
+    std::size_t count {0};
+};
+
+/*
+ * Returns the distance from \a pt to the part of the line (pt, dir) that lies
+ * inside the box, or a negative value if the line misses the box. If \a forward
+ * is true only the half line in direction of \a dir is considered.
+ */
+float LineToBoxDistance(const Base::BoundBox3f& box,
+                        const Base::Vector3f& pt,
+                        const Base::Vector3f& dir,
+                        float len,
+                        bool forward)
+{
+    const float lo[3] = {box.MinX, box.MinY, box.MinZ};
+    const float hi[3] = {box.MaxX, box.MaxY, box.MaxZ};
+    float tmin = forward ? 0.0F : -FLOAT_MAX;
+    float tmax = FLOAT_MAX;
+    for (unsigned short k = 0; k < 3; k++) {
+        if (dir[k] == 0.0F) {
+            if (pt[k] < lo[k] || pt[k] > hi[k]) {
+                return -1.0F;
+            }
+        }
+        else {
+            float t1 = (lo[k] - pt[k]) / dir[k];
+            float t2 = (hi[k] - pt[k]) / dir[k];
+            if (t1 > t2) {
+                std::swap(t1, t2);
+            }
+            tmin = std::max(tmin, t1);
+            tmax = std::min(tmax, t2);
+            if (tmin > tmax) {
+                return -1.0F;
+            }
+        }
+    }
+
+    if (tmin > 0.0F) {
+        return tmin * len;
+    }
+    if (tmax < 0.0F) {
+        return -tmax * len;
+    }
+    return 0.0F;
+}
+
+// BoundBox3::ClosestPoint() moves inner points onto the surface, so clamp here
+float PointToBoxDistance(const Base::BoundBox3f& box, const Base::Vector3f& pt)
+{
+    float dx = std::max({box.MinX - pt.x, 0.0F, pt.x - box.MaxX});
+    float dy = std::max({box.MinY - pt.y, 0.0F, pt.y - box.MaxY});
+    float dz = std::max({box.MinZ - pt.z, 0.0F, pt.z - box.MaxZ});
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+}  // namespace
+
+struct MeshFacetBVH::BuildData
+{
+    struct Primitive
+    {
+        Base::BoundBox3f box;
+        Base::Vector3f centroid;
+        FacetIndex index;
+    };
+    // the primitives are reordered in place so that each subtree works on a contiguous range
+    std::vector<Primitive> prims;
+};
+
+MeshFacetBVH::MeshFacetBVH(const MeshKernel& mesh)
+    : _mesh(mesh)
+{
+    Rebuild();
+}
+
+void MeshFacetBVH::Rebuild()
+{
+    _nodes.clear();
+    _order.clear();
+    _triangles.clear();
+
+    const MeshFacetArray& facets = _mesh.GetFacets();
+    const MeshPointArray& points = _mesh.GetPoints();
+    std::size_t count = facets.size();
+    if (count == 0) {
+        return;
+    }
+
+    int threads = int(std::max(std::thread::hardware_concurrency(), 1U));
+    BuildData data;
+    data.prims.resize(count);
+    parallel_for(count, 10000, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& facet = facets[i];
+            const Base::Vector3f& p0 = points[facet._aulPoints[0]];
+            const Base::Vector3f& p1 = points[facet._aulPoints[1]];
+            const Base::Vector3f& p2 = points[facet._aulPoints[2]];
+            Base::BoundBox3f box;
+            box.Add(p0);
+            box.Add(p1);
+            box.Add(p2);
+            data.prims[i] = {box, (p0 + p1 + p2) / 3.0F, FacetIndex(i)};
+        }
+    });
+
+    // one level of parallel subtrees per doubling of the threads
+    int levels = 0;
+    while ((1 << levels) < threads) {
+        levels++;
+    }
+    _nodes = BuildParallel(data, 0, count, 0, levels);
+    _order.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        _order[i] = data.prims[i].index;
+    }
+
+    // The intersection points of Foraminate() and DistanceToPoint() may lie
+    // slightly outside of the facet boxes due to rounding errors.
+    float tolerance = 1e-5F * _nodes.front().box.CalcDiagonalLength();
+    for (Node& node : _nodes) {
+        node.box.Enlarge(tolerance);
+    }
+
+    _triangles.resize(count);
+    parallel_for(count, 10000, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& facet = facets[_order[i]];
+            _triangles[i] = {points[facet._aulPoints[0]],
+                             points[facet._aulPoints[1]],
+                             points[facet._aulPoints[2]]};
+        }
+    });
+}
+
+std::size_t MeshFacetBVH::Split(BuildData& data,
+                                std::size_t begin,
+                                std::size_t end,
+                                int depth,
+                                Base::BoundBox3f& box)
+{
+    Base::BoundBox3f centroidBox;
+    for (std::size_t i = begin; i < end; i++) {
+        box.Add(data.prims[i].box);
+        centroidBox.Add(data.prims[i].centroid);
+    }
+    if (end - begin <= MaxLeafSize) {
+        return end;
+    }
+
+    using Primitive = BuildData::Primitive;
+    auto first = data.prims.begin() + std::ptrdiff_t(begin);
+    auto last = data.prims.begin() + std::ptrdiff_t(end);
+    const Base::Vector3f cmin = centroidBox.GetMinimum();
+    const Base::Vector3f extent = centroidBox.GetMaximum() - cmin;
+
+    if (depth < MaxSAHDepth) {
+        // binned surface area heuristic, the bins of all axes are filled in one pass
+        const Base::Vector3f scale(extent.x > 0.0F ? float(NumBins) / extent.x : 0.0F,
+                                   extent.y > 0.0F ? float(NumBins) / extent.y : 0.0F,
+                                   extent.z > 0.0F ? float(NumBins) / extent.z : 0.0F);
+        auto binOf = [&](const Primitive& prim, unsigned short axis) {
+            int bin = int((prim.centroid[axis] - cmin[axis]) * scale[axis]);
+            return std::min(bin, NumBins - 1);
+        };
+
+        std::array<std::array<Bin, NumBins>, 3> bins;
+        for (auto it = first; it != last; ++it) {
+            for (unsigned short axis = 0; axis < 3; axis++) {
+                Bin& bin = bins[axis][binOf(*it, axis)];
+                bin.box.Add(it->box);
+                bin.count++;
+            }
+        }
+
+        float bestCost = FLOAT_MAX;
+        unsigned short bestAxis = 0;
+        int bestBin = -1;
+        for (unsigned short axis = 0; axis < 3; axis++) {
+            if (extent[axis] <= 0.0F) {
+                continue;
+            }
+
+            std::array<float, NumBins - 1> leftCost {};
+            std::array<std::size_t, NumBins - 1> leftCount {};
+            Bin left;
+            for (int i = 0; i < NumBins - 1; i++) {
+                if (bins[axis][i].count > 0) {
+                    left.box.Add(bins[axis][i].box);
+                    left.count += bins[axis][i].count;
+                }
+                leftCount[i] = left.count;
+                leftCost[i] = left.count > 0 ? HalfArea(left.box) * float(left.count) : 0.0F;
+            }
+
+            Bin right;
+            for (int i = NumBins - 1; i > 0; i--) {
+                if (bins[axis][i].count > 0) {
+                    right.box.Add(bins[axis][i].box);
+                    right.count += bins[axis][i].count;
+                }
+                if (right.count == 0 || leftCount[i - 1] == 0) {
+                    continue;
+                }
+                float cost = leftCost[i - 1] + HalfArea(right.box) * float(right.count);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = i - 1;
+                }
+            }
+        }
+
+        if (bestBin >= 0) {
+            auto mid = std::partition(first, last, [&](const Primitive& prim) {
+                return binOf(prim, bestAxis) <= bestBin;
+            });
+            return std::size_t(mid - data.prims.begin());
+        }
+    }
+
+    // all centroids coincide or the tree is too deep: split at the median
+    std::size_t half = begin + (end - begin) / 2;
+    unsigned short axis = 0;
+    if (extent.y > extent[axis]) {
+        axis = 1;
+    }
+    if (extent.z > extent[axis]) {
+        axis = 2;
+    }
+    if (extent[axis] > 0.0F) {
+        std::nth_element(first,
+                         data.prims.begin() + std::ptrdiff_t(half),
+                         last,
+                         [axis](const Primitive& a, const Primitive& b) {
+                             return a.centroid[axis] < b.centroid[axis];
+                         });
+    }
+    return half;
+}
+
+void MeshFacetBVH::BuildSerial(BuildData& data,
+                               std::size_t begin,
+                               std::size_t end,
+                               int depth,
+                               std::vector<Node>& nodes)
+{
+    std::size_t index = nodes.size();
+    nodes.emplace_back();
+
+    Base::BoundBox3f box;
+    std::size_t mid = Split(data, begin, end, depth, box);
+    nodes[index].box = box;
+    if (mid == end) {
+        nodes[index].first = begin;
+        nodes[index].count = end - begin;
+        return;
+    }
+
+    // the left child directly follows its parent
+    BuildSerial(data, begin, mid, depth + 1, nodes);
+    nodes[index].first = nodes.size();
+    BuildSerial(data, mid, end, depth + 1, nodes);
+}
+
+std::vector<MeshFacetBVH::Node> MeshFacetBVH::BuildParallel(BuildData& data,
+                                                            std::size_t begin,
+                                                            std::size_t end,
+                                                            int depth,
+                                                            int levels)
+{
+    std::vector<Node> nodes;
+    if (levels <= 0 || end - begin < ParallelGrain) {
+        BuildSerial(data, begin, end, depth, nodes);
+        return nodes;
+    }
+
+    Node root;
+    std::size_t mid = Split(data, begin, end, depth, root.box);
+    if (mid == end) {
+        root.first = begin;
+        root.count = end - begin;
+        nodes.push_back(root);
+        return nodes;
+    }
+
+    // both halves work on disjoint ranges of the primitives
+    auto future = std::async(std::launch::async, [&, begin, mid] {
+        return BuildParallel(data, begin, mid, depth + 1, levels - 1);
+    });
+    std::vector<Node> right = BuildParallel(data, mid, end, depth + 1, levels - 1);
+    std::vector<Node> left = future.get();
+
+    auto append = [&nodes](const std::vector<Node>& subtree) {
+        std::size_t offset = nodes.size();
+        for (Node node : subtree) {
+            if (node.count == 0) {
+                node.first += offset;
+            }
+            nodes.push_back(node);
+        }
+    };
+
+    nodes.reserve(1 + left.size() + right.size());
+    root.first = 1 + left.size();
+    nodes.push_back(root);
+    append(left);
+    append(right);
+    return nodes;
+}
+
+bool MeshFacetBVH::NearestFacetOnRay(const Base::Vector3f& rclPt,
+                                     const Base::Vector3f& rclDir,
+                                     float fMaxAngle,
+                                     Base::Vector3f& rclRes,
+                                     FacetIndex& rulFacet,
+                                     bool bForward) const
+{
+    if (_nodes.empty()) {
+        return false;
+    }
+
+    const float len = rclDir.Length();
+    bool found = false;
+    float bestDist = FLOAT_MAX;
+    FacetIndex bestFacet = FACET_INDEX_MAX;
+    Base::Vector3f bestPoint;
+
+    // stack of node indices with the distance of the line segment inside their box
+    std::vector<std::pair<std::size_t, float>> stack;
+    stack.reserve(64);
+    float rootDist = LineToBoxDistance(_nodes.front().box, rclPt, rclDir, len, bForward);
+    if (rootDist >= 0.0F) {
+        stack.emplace_back(0, rootDist);
+    }
+
+    Base::Vector3f res;
+    while (!stack.empty()) {
+        auto [index, dist] = stack.back();
+        stack.pop_back();
+        if (found && dist > bestDist) {
+            continue;
+        }
+
+        const Node& node = _nodes[index];
+        if (node.count > 0) {
+            for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                const auto& tria = _triangles[i];
+                MeshGeomFacet facet(tria[0], tria[1], tria[2]);
+                if (facet.Foraminate(rclPt, rclDir, res, fMaxAngle)
+                    && (!bForward || (res - rclPt) * rclDir >= 0.0F)) {
+                    // same as the brute force search: nearest first, then lowest index
+                    float fDist = (res - rclPt).Length();
+                    FacetIndex facetIndex = _order[i];
+                    if (!found || fDist < bestDist
+                        || (fDist == bestDist && facetIndex < bestFacet)) {
+                        found = true;
+                        bestDist = fDist;
+                        bestFacet = facetIndex;
+                        bestPoint = res;
+                    }
+                }
+            }
+            continue;
+        }
+
+        std::size_t left = index + 1;
+        std::size_t right = node.first;
+        float leftDist = LineToBoxDistance(_nodes[left].box, rclPt, rclDir, len, bForward);
+        float rightDist = LineToBoxDistance(_nodes[right].box, rclPt, rclDir, len, bForward);
+        // push the farther child first so that the nearer one is visited next
+        if (leftDist < rightDist) {
+            std::swap(left, right);
+            std::swap(leftDist, rightDist);
+        }
+        if (leftDist >= 0.0F) {
+            stack.emplace_back(left, leftDist);
+        }
+        if (rightDist >= 0.0F) {
+            stack.emplace_back(right, rightDist);
+        }
+    }
+
+    if (found) {
+        rclRes = bestPoint;
+        rulFacet = bestFacet;
+    }
+    return found;
+}
+
+bool MeshFacetBVH::NearestFacetToPoint(const Base::Vector3f& rclPt,
+                                       float fMaxDist,
+                                       Base::Vector3f& rclRes,
+                                       FacetIndex& rulFacet) const
+{
+    if (_nodes.empty()) {
+        return false;
+    }
+
+    bool found = false;
+    float bestDist = fMaxDist;
+    FacetIndex bestFacet = FACET_INDEX_MAX;
+    Base::Vector3f bestPoint;
+
+    std::vector<std::pair<std::size_t, float>> stack;
+    stack.reserve(64);
+    stack.emplace_back(0, PointToBoxDistance(_nodes.front().box, rclPt));
+
+    Base::Vector3f res;
+    while (!stack.empty()) {
+        auto [index, dist] = stack.back();
+        stack.pop_back();
+        if (dist > bestDist) {
+            continue;
+        }
+
+        const Node& node = _nodes[index];
+        if (node.count > 0) {
+            for (std::size_t i = node.first; i < node.first + node.count; i++) {
+                const auto& tria = _triangles[i];
+                MeshGeomFacet facet(tria[0], tria[1], tria[2]);
+                float fDist = facet.DistanceToPoint(rclPt, res);
+                FacetIndex facetIndex = _order[i];
+                if (fDist < bestDist || (fDist == bestDist && (!found || facetIndex < bestFacet))) {
+                    found = true;
+                    bestDist = fDist;
+                    bestFacet = facetIndex;
+                    bestPoint = res;
+                }
+            }
+            continue;
+        }
+
+        std::size_t left = index + 1;
+        std::size_t right = node.first;
+        float leftDist = PointToBoxDistance(_nodes[left].box, rclPt);
+        float rightDist = PointToBoxDistance(_nodes[right].box, rclPt);
+        if (leftDist < rightDist) {
+            std::swap(left, right);
+            std::swap(leftDist, rightDist);
+        }
+        stack.emplace_back(left, leftDist);
+        stack.emplace_back(right, rightDist);
+    }
+
+    if (found) {
+        rclRes = bestPoint;
+        rulFacet = bestFacet;
+    }
+    return found;
+}
+
+void MeshFacetBVH::CollectOverlaps(const MeshFacetBVH& other,
+                                   std::vector<std::pair<std::size_t, std::size_t>>& stack,
+                                   std::vector<std::pair<FacetIndex, FacetIndex>>& pairs) const
+{
+    while (!stack.empty()) {
+        auto [index1, index2] = stack.back();
+        stack.pop_back();
+        const Node& node1 = _nodes[index1];
+        const Node& node2 = other._nodes[index2];
+        if (!node1.box.Intersect(node2.box)) {
+            continue;
+        }
+
+        if (node1.count > 0 && node2.count > 0) {
+            for (std::size_t i = node1.first; i < node1.first + node1.count; i++) {
+                Base::BoundBox3f box1(_triangles[i].data(), 3);
+                for (std::size_t j = node2.first; j < node2.first + node2.count; j++) {
+                    Base::BoundBox3f box2(other._triangles[j].data(), 3);
+                    if (box1.Intersect(box2)) {
+                        pairs.emplace_back(_order[i], other._order[j]);
+                    }
+                }
+            }
+        }
+        // descend into the inner node with the larger box
+        else if (node2.count > 0
+                 || (node1.count == 0 && HalfArea(node1.box) >= HalfArea(node2.box))) {
+            stack.emplace_back(index1 + 1, index2);
+            stack.emplace_back(node1.first, index2);
+        }
+        else {
+            stack.emplace_back(index1, index2 + 1);
+            stack.emplace_back(index1, node2.first);
+        }
+    }
+}
+
+std::vector<std::pair<FacetIndex, FacetIndex>>
+MeshFacetBVH::GetOverlappingFacets(const MeshFacetBVH& other) const
+{
+    std::vector<std::pair<FacetIndex, FacetIndex>> pairs;
+    if (_nodes.empty() || other._nodes.empty()) {
+        return pairs;
+    }
+
+    // Expand the node pairs breadth first until there is enough work for all
+    // threads. Pairs of leaves are resolved directly.
+    int threads = int(std::max(std::thread::hardware_concurrency(), 1U));
+    std::vector<std::pair<std::size_t, std::size_t>> tasks;
+    tasks.emplace_back(0, 0);
+    while (!tasks.empty() && tasks.size() < std::size_t(threads) * 16) {
+        std::vector<std::pair<std::size_t, std::size_t>> next;
+        for (const auto& task : tasks) {
+            std::vector<std::pair<std::size_t, std::size_t>> stack {task};
+            const Node& node1 = _nodes[task.first];
+            const Node& node2 = other._nodes[task.second];
+            if (!node1.box.Intersect(node2.box)) {
+                continue;
+            }
+            if (node1.count > 0 && node2.count > 0) {
+                CollectOverlaps(other, stack, pairs);
+            }
+            else if (node2.count > 0
+                     || (node1.count == 0 && HalfArea(node1.box) >= HalfArea(node2.box))) {
+                next.emplace_back(task.first + 1, task.second);
+                next.emplace_back(node1.first, task.second);
+            }
+            else {
+                next.emplace_back(task.first, task.second + 1);
+                next.emplace_back(task.first, node2.first);
+            }
+        }
+        tasks.swap(next);
+    }
+
+    std::vector<std::vector<std::pair<FacetIndex, FacetIndex>>> results(tasks.size());
+    parallel_for(tasks.size(), 1, threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<std::pair<std::size_t, std::size_t>> stack;
+        for (std::size_t i = begin; i < end; i++) {
+            stack.push_back(tasks[i]);
+            CollectOverlaps(other, stack, results[i]);
+        }
+    });
+    for (const auto& result : results) {
+        pairs.insert(pairs.end(), result.begin(), result.end());
+    }
+
+    parallel_sort(pairs.begin(), pairs.end(), std::less<>(), threads);
+    return pairs;
+}
@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef MESH_BVH_H
+#define MESH_BVH_H
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include <Base/BoundBox.h>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+
+/**
+ * The MeshFacetBVH is a bounding volume hierarchy over the facets of a mesh.
+ *
+ * Unlike the MeshFacetGrid its resolution adapts to the distribution of the
+ * facets, so it works equally well for meshes with very different facet sizes.
+ * The tree is built with the surface area heuristic, the top levels are built
+ * in parallel. Like the grid it must be rebuilt after the mesh has changed.
+ */
+class MeshExport MeshFacetBVH
+{
+public:
+    /// Builds the hierarchy for \a mesh.
+    explicit MeshFacetBVH(const MeshKernel& mesh);
+    ~MeshFacetBVH() = default;
+
+    MeshFacetBVH(const MeshFacetBVH&) = delete;
+    MeshFacetBVH(MeshFacetBVH&&) = delete;
+    MeshFacetBVH& operator=(const MeshFacetBVH&) = delete;
+    MeshFacetBVH& operator=(MeshFacetBVH&&) = delete;
+
+    /// Rebuilds the hierarchy from the current state of the mesh.
+    void Rebuild();
+    /// Returns true if the mesh has no facets.
+    bool IsEmpty() const
+    {
+        return _nodes.empty();
+    }
+    /// Returns the number of nodes of the tree.
+    std::size_t CountNodes() const
+    {
+        return _nodes.size();
+    }
+
+    /**
+     * Searches for the facet intersected by the line (\a rclPt, \a rclDir) whose
+     * intersection point is nearest to \a rclPt. The angle between the line and the
+     * normal of the facet must not exceed \a fMaxAngle. The result is the same as with
+     * the brute force search of MeshAlgorithm::NearestFacetOnRay().
+     * If \a bForward is true only intersections in direction of \a rclDir are considered.
+     */
+    bool NearestFacetOnRay(const Base::Vector3f& rclPt,
+                           const Base::Vector3f& rclDir,
+                           float fMaxAngle,
+                           Base::Vector3f& rclRes,
+                           FacetIndex& rulFacet,
+                           bool bForward = false) const;
+    /**
+     * Searches for the facet nearest to \a rclPt with a distance not higher than
+     * \a fMaxDist. \a rclRes is the nearest point on the facet.
+     */
+    bool NearestFacetToPoint(const Base::Vector3f& rclPt,
+                             float fMaxDist,
+                             Base::Vector3f& rclRes,
+                             FacetIndex& rulFacet) const;
+    /**
+     * Returns all pairs of facets of this and the \a other hierarchy whose bounding
+     * boxes overlap, sorted by the facet indices. The trees are traversed in parallel.
+     */
+    std::vector<std::pair<FacetIndex, FacetIndex>>
+    GetOverlappingFacets(const MeshFacetBVH& other) const;
+
+private:
+    struct Node
+    {
+        Base::BoundBox3f box;
+        /// first entry in _order for leaves, index of the right child otherwise
+        std::size_t first {0};
+        /// number of facets for leaves, 0 otherwise
+        std::size_t count {0};
+    };
+    struct BuildData;
+
+    static void BuildSerial(BuildData& data,
+                            std::size_t begin,
+                            std::size_t end,
+                            int depth,
+                            std::vector<Node>& nodes);
+    static std::vector<Node>
+    BuildParallel(BuildData& data, std::size_t begin, std::size_t end, int depth, int levels);
+    static std::size_t
+    Split(BuildData& data, std::size_t begin, std::size_t end, int depth, Base::BoundBox3f& box);
+    void CollectOverlaps(const MeshFacetBVH& other,
+                         std::vector<std::pair<std::size_t, std::size_t>>& stack,
+                         std::vector<std::pair<FacetIndex, FacetIndex>>& pairs) const;
+
+private:
+    const MeshKernel& _mesh;
+    std::vector<Node> _nodes;
+    /// facet indices, the facets of a leaf are contiguous
+    std::vector<FacetIndex> _order;
+    /// corner points of the facets in the order of _order
+    std::vector<std::array<Base::Vector3f, 3>> _triangles;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_BVH_H
@@ -56,6 +56,7 @@ void MeshBuilder::SetTolerance(float fTol)
 
 void MeshBuilder::Initialize(size_t ctFacets, bool deletion)
 {
+    _meshKernel.ReleaseCornerTable();
     if (deletion) {
         // Clear the mesh structure and free all memory
         _meshKernel.Clear();
@@ -358,6 +359,22 @@ void MeshFastBuilder::AddFacet(const MeshGeomFacet& facetPoints)
     }
 }
 
+void MeshFastBuilder::Resize(size_type ctFacets)
+{
+    p->verts.resize(ctFacets * 3);
+}
+
+void MeshFastBuilder::SetFacet(size_type index, const Base::Vector3f* facetPoints)
+{
+    // data() of a not shared vector doesn't detach, so this is safe for distinct facets
+    Private::Vertex* v = p->verts.data() + 3 * index;
+    for (int i = 0; i < 3; i++) {
+        v[i].x = facetPoints[i].x;
+        v[i].y = facetPoints[i].y;
+        v[i].z = facetPoints[i].z;
+    }
+}
+
 void MeshFastBuilder::Finish()
 {
     using size_type = QVector<Private::Vertex>::size_type;
@@ -218,6 +218,13 @@ public:
     /** Add new facet
      */
     void AddFacet(const MeshGeomFacet& facetPoints);
+    /** Resizes the builder to \a ctFacets facets that must all be set with SetFacet().
+     * Unlike AddFacet() different facets can be set from several threads at the same time.
+     */
+    void Resize(size_type ctFacets);
+    /** Sets the points of the facet with index \a index
+     */
+    void SetFacet(size_type index, const Base::Vector3f* facetPoints);
 
     /** Finishes building up the mesh structure. Must be done after adding facets.
      */
@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <iterator>
+#endif
+
+#include "Algorithm.h"
+#include "CornerTable.h"
+#include "MeshKernel.h"
+
+
+using namespace MeshCore;
+
+MeshCornerTable::MeshCornerTable(const MeshKernel& mesh)
+    : _mesh(mesh)
+{
+    Rebuild();
+}
+
+void MeshCornerTable::Rebuild()
+{
+    const MeshFacetArray& rFacets = _mesh.GetFacets();
+    _first.assign(_mesh.CountPoints(), NoCorner);
+    _next.assign(3 * rFacets.size(), NoCorner);
+
+    // link the corners in reverse order so that the lists start with the lowest facet index
+    for (std::size_t corner = _next.size(); corner > 0; corner--) {
+        const MeshFacet& face = rFacets[(corner - 1) / 3];
+        LinkCorner(corner - 1, face._aulPoints[(corner - 1) % 3]);
+    }
+}
+
+std::size_t MeshCornerTable::CountFacets(PointIndex pos) const
+{
+    if (pos >= _first.size()) {
+        return 0;
+    }
+
+    // a degenerated facet may reference a point twice
+    std::size_t count = 0;
+    for (std::size_t corner = _first[pos]; corner != NoCorner; corner = _next[corner]) {
+        std::size_t prev = _first[pos];
+        while (prev != corner && prev / 3 != corner / 3) {
+            prev = _next[prev];
+        }
+        if (prev == corner) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void MeshCornerTable::GetFacets(PointIndex pos, std::vector<FacetIndex>& facets) const
+{
+    facets.clear();
+    VisitFacets(pos, [&facets](FacetIndex facet) {
+        facets.push_back(facet);
+    });
+    std::sort(facets.begin(), facets.end());
+    facets.erase(std::unique(facets.begin(), facets.end()), facets.end());
+}
+
+std::vector<FacetIndex> MeshCornerTable::GetFacets(PointIndex pos1, PointIndex pos2) const
+{
+    std::vector<FacetIndex> ring1, ring2, intersection;
+    GetFacets(pos1, ring1);
+    GetFacets(pos2, ring2);
+    std::set_intersection(ring1.begin(),
+                          ring1.end(),
+                          ring2.begin(),
+                          ring2.end(),
+                          std::back_inserter(intersection));
+    return intersection;
+}
+
+void MeshCornerTable::GetNeighbourPoints(PointIndex pos, std::vector<PointIndex>& points) const
+{
+    points.clear();
+    const MeshFacetArray& rFacets = _mesh.GetFacets();
+    VisitFacets(pos, [&](FacetIndex facet) {
+        for (PointIndex index : rFacets[facet]._aulPoints) {
+            if (index != pos) {
+                points.push_back(index);
+            }
+        }
+    });
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+}
+
+std::set<PointIndex> MeshCornerTable::NeighbourPoints(const std::vector<PointIndex>& pt,
+                                                      int level) const
+{
+    std::set<PointIndex> cp, nb;
+    cp.insert(pt.begin(), pt.end());
+    std::vector<PointIndex> lp(cp.begin(), cp.end());
+    const MeshFacetArray& rFacets = _mesh.GetFacets();
+    for (int i = 0; i < level && !lp.empty(); i++) {
+        std::vector<PointIndex> cur;
+        for (PointIndex it : lp) {
+            VisitFacets(it, [&](FacetIndex facet) {
+                for (PointIndex index : rFacets[facet]._aulPoints) {
+                    if (cp.find(index) == cp.end() && nb.insert(index).second) {
+                        cur.push_back(index);
+                    }
+                }
+            });
+        }
+
+        lp.swap(cur);
+    }
+    return nb;
+}
+
+void MeshCornerTable::Neighbours(FacetIndex ulFacetInd,
+                                 float fMaxDist,
+                                 MeshCollector& collect) const
+{
+    const MeshFacetArray& rFacets = _mesh.GetFacets();
+    Base::Vector3f clCenter = _mesh.GetFacet(ulFacetInd).GetGravityPoint();
+    float fMaxDist2 = fMaxDist * fMaxDist;
+
+    std::set<FacetIndex> visited;
+    std::vector<FacetIndex> stack;
+    stack.push_back(ulFacetInd);
+    while (!stack.empty()) {
+        FacetIndex index = stack.back();
+        stack.pop_back();
+        if (visited.find(index) != visited.end()) {
+            continue;
+        }
+
+        const MeshFacet& face = rFacets[index];
+        if (Base::DistanceP2(clCenter, _mesh.GetFacet(face).GetGravityPoint()) > fMaxDist2) {
+            continue;
+        }
+
+        visited.insert(index);
+        collect.Append(_mesh, index);
+        for (PointIndex ptIndex : face._aulPoints) {
+            VisitFacets(ptIndex, [&](FacetIndex facet) {
+                if (visited.find(facet) == visited.end()) {
+                    stack.push_back(facet);
+                }
+            });
+        }
+    }
+}
+
+std::size_t MeshCornerTable::GetMemSize() const
+{
+    return (_first.capacity() + _next.capacity()) * sizeof(std::size_t);
+}
+
+void MeshCornerTable::AddFacet(FacetIndex facet)
+{
+    if (_next.size() < 3 * (facet + 1)) {
+        _next.resize(std::max<std::size_t>(3 * (facet + 1), 3 * _mesh.CountFacets()), NoCorner);
+    }
+
+    const MeshFacet& face = _mesh.GetFacets()[facet];
+    for (std::size_t i = 0; i < 3; i++) {
+        LinkCorner(3 * facet + i, face._aulPoints[i]);
+    }
+}
+
+void MeshCornerTable::RemoveFacet(FacetIndex facet)
+{
+    const MeshFacet& face = _mesh.GetFacets()[facet];
+    for (PointIndex index : face._aulPoints) {
+        UnlinkCorner(facet, index);
+    }
+}
+
+void MeshCornerTable::ReplacePoint(FacetIndex facet, PointIndex oldPoint, PointIndex newPoint)
+{
+    std::size_t corner = UnlinkCorner(facet, oldPoint);
+    if (corner != NoCorner) {
+        LinkCorner(corner, newPoint);
+    }
+}
+
+void MeshCornerTable::LinkCorner(std::size_t corner, PointIndex pos)
+{
+    if (pos >= _first.size()) {
+        _first.resize(std::max<std::size_t>(pos + 1, _mesh.CountPoints()), NoCorner);
+    }
+
+    _next[corner] = _first[pos];
+    _first[pos] = corner;
+}
+
+std::size_t MeshCornerTable::UnlinkCorner(FacetIndex facet, PointIndex pos)
+{
+    if (pos >= _first.size()) {
+        return NoCorner;
+    }
+
+    std::size_t prev = NoCorner;
+    for (std::size_t corner = _first[pos]; corner != NoCorner; corner = _next[corner]) {
+        if (corner / 3 == facet) {
+            if (prev == NoCorner) {
+                _first[pos] = _next[corner];
+            }
+            else {
+                _next[prev] = _next[corner];
+            }
+            _next[corner] = NoCorner;
+            return corner;
+        }
+        prev = corner;
+    }
+
+    return NoCorner;
+}
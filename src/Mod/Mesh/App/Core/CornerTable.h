@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef MESH_CORNERTABLE_H
+#define MESH_CORNERTABLE_H
+
+#include <limits>
+#include <set>
+#include <vector>
+
+#include "Definitions.h"
+
+
+namespace MeshCore
+{
+
+class MeshKernel;
+class MeshCollector;
+
+/**
+ * The MeshCornerTable gives access to the facets around a point.
+ *
+ * Each of the three corners of a facet is a node of a singly linked list that
+ * holds all corners of the same point. Compared to the set based structures
+ * like MeshRefPointToFacets or MeshRefPointToPoints it uses only a fraction of
+ * the memory and can be updated incrementally when single facets change.
+ * The facets of a mesh kernel share one table, see MeshKernel::GetCornerTable(),
+ * which MeshTopoAlgorithm keeps up to date while it modifies the mesh.
+ */
+class MeshExport MeshCornerTable
+{
+public:
+    /// Builds the table for \a mesh.
+    explicit MeshCornerTable(const MeshKernel& mesh);
+    ~MeshCornerTable() = default;
+
+    MeshCornerTable(const MeshCornerTable&) = delete;
+    MeshCornerTable(MeshCornerTable&&) = delete;
+    MeshCornerTable& operator=(const MeshCornerTable&) = delete;
+    MeshCornerTable& operator=(MeshCornerTable&&) = delete;
+
+    /// Rebuilds the table from the current state of the mesh.
+    void Rebuild();
+
+    /** @name Queries */
+    //@{
+    /// Returns the number of facets referencing the point \a pos.
+    std::size_t CountFacets(PointIndex pos) const;
+    /// Sets \a facets to the facets referencing the point \a pos in ascending order.
+    void GetFacets(PointIndex pos, std::vector<FacetIndex>& facets) const;
+    /// Returns the facets referencing both points in ascending order.
+    std::vector<FacetIndex> GetFacets(PointIndex pos1, PointIndex pos2) const;
+    /// Sets \a points to the points sharing an edge with \a pos in ascending order.
+    void GetNeighbourPoints(PointIndex pos, std::vector<PointIndex>& points) const;
+    /// Returns the points up to \a level rings around \a pt that are not part of \a pt.
+    std::set<PointIndex> NeighbourPoints(const std::vector<PointIndex>& pt, int level) const;
+    /// Collects all facets whose gravity points are within \a fMaxDist of the gravity
+    /// point of the facet \a ulFacetInd and that are connected to it over corners.
+    void Neighbours(FacetIndex ulFacetInd, float fMaxDist, MeshCollector& collect) const;
+    /// Calls \a func for each corner of the point \a pos with the index of its facet.
+    template<typename Func>
+    void VisitFacets(PointIndex pos, Func&& func) const
+    {
+        if (pos < _first.size()) {
+            for (std::size_t corner = _first[pos]; corner != NoCorner; corner = _next[corner]) {
+                func(FacetIndex(corner / 3));
+            }
+        }
+    }
+    /// Returns the memory used by the table in bytes.
+    std::size_t GetMemSize() const;
+    //@}
+
+    /** @name Incremental update */
+    //@{
+    /// Adds the corners of the facet \a facet that has been appended or changed.
+    void AddFacet(FacetIndex facet);
+    /// Removes the corners of the facet \a facet before it gets changed.
+    void RemoveFacet(FacetIndex facet);
+    /// Moves the corner of \a facet at point \a oldPoint to \a newPoint.
+    void ReplacePoint(FacetIndex facet, PointIndex oldPoint, PointIndex newPoint);
+    //@}
+
+private:
+    void LinkCorner(std::size_t corner, PointIndex pos);
+    std::size_t UnlinkCorner(FacetIndex facet, PointIndex pos);
+
+private:
+    static constexpr std::size_t NoCorner = std::numeric_limits<std::size_t>::max();
+
+    const MeshKernel& _mesh;
+    /// first corner of each point
+    std::vector<std::size_t> _first;
+    /// next corner of the same point, the facet of a corner is corner / 3
+    std::vector<std::size_t> _next;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_CORNERTABLE_H
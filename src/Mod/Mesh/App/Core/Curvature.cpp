@@ -24,6 +24,7 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <functional>
+#include <thread>
 #endif
 
 #include <QFuture>
@@ -37,11 +38,14 @@
 #ifdef OPTIMIZE_CURVATURE
 #include <Eigen/Eigenvalues>
 #else
-#include <Mod/Mesh/App/WildMagic4/Wm4MeshCurvature.h>
+#include <Mod/Mesh/App/WildMagic4/Wm4Matrix2.h>
+#include <Mod/Mesh/App/WildMagic4/Wm4Matrix3.h>
 #endif
 
 #include "Approximation.h"
+#include "CornerTable.h"
 #include "Curvature.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
 #include "Tools.h"
@@ -69,7 +73,7 @@ MeshCurvature::MeshCurvature(const MeshKernel& kernel, std::vector<FacetIndex> s
 void MeshCurvature::ComputePerFace(bool parallel)
 {
     myCurvature.clear();
-    MeshRefPointToFacets search(myKernel);
+    const MeshCornerTable& search = myKernel.GetCornerTable();
     FacetCurvature face(myKernel, search, myRadius, myMinPoints);
 
     if (!parallel) {
@@ -293,55 +297,144 @@ void MeshCurvature::ComputePerVertex()
 {
     myCurvature.clear();
 
-    // get all points
-    std::vector<Wm4::Vector3<double>> aPnts;
-    aPnts.reserve(myKernel.CountPoints());
-    MeshPointIterator cPIt(myKernel);
-    for (cPIt.Init(); cPIt.More(); cPIt.Next()) {
-        Wm4::Vector3<double> cP(cPIt->x, cPIt->y, cPIt->z);
-        aPnts.push_back(cP);
-    }
-
-    // get all point connections
-    std::vector<int> aIdx;
-    aIdx.reserve(3 * myKernel.CountFacets());
-    const MeshFacetArray& raFts = myKernel.GetFacets();
-    for (const auto& it : raFts) {
-        for (PointIndex point : it._aulPoints) {
-            aIdx.push_back(int(point));
-        }
-    }
-
     // in case of an empty mesh no curvature can be calculated
     if (myKernel.CountPoints() == 0 || myKernel.CountFacets() == 0) {
         return;
     }
 
-    // compute vertex based curvatures
-    Wm4::MeshCurvature<double> meshCurv(myKernel.CountPoints(),
-                                        aPnts.data(),
-                                        myKernel.CountFacets(),
-                                        aIdx.data());
-
-    // get curvature information now
-    const Wm4::Vector3<double>* aMaxCurvDir = meshCurv.GetMaxDirections();
-    const Wm4::Vector3<double>* aMinCurvDir = meshCurv.GetMinDirections();
-    const double* aMaxCurv = meshCurv.GetMaxCurvatures();
-    const double* aMinCurv = meshCurv.GetMinCurvatures();
+    // This is the algorithm of Wm4::MeshCurvature. Instead of scattering the
+    // contributions of each triangle to its vertices the sums are gathered per
+    // vertex with the corner table of the kernel, so the vertices can be handled
+    // in parallel. The facets of a vertex are visited in ascending order, hence
+    // the sums are built in the same order and the results are identical.
+    using Vector3 = Wm4::Vector3<double>;
+    using Matrix3 = Wm4::Matrix3<double>;
+    const MeshPointArray& rPoints = myKernel.GetPoints();
+    const MeshFacetArray& rFacets = myKernel.GetFacets();
+    const MeshCornerTable& corners = myKernel.GetCornerTable();
+    std::size_t numPoints = rPoints.size();
+
+    auto vertex = [&rPoints](PointIndex index) {
+        const MeshPoint& pnt = rPoints[index];
+        return Vector3(pnt.x, pnt.y, pnt.z);
+    };
+
+    constexpr std::size_t grain = 1024;
+    int threads = int(std::max(std::thread::hardware_concurrency(), 1U));
+
+    // compute normal vectors, the length of each facet normal provides a weighted sum
+    std::vector<Vector3> normals(numPoints);
+    parallel_for(numPoints, grain, threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<FacetIndex> facets;
+        for (std::size_t i = begin; i < end; i++) {
+            Vector3 normal(0, 0, 0);
+            corners.GetFacets(i, facets);
+            for (FacetIndex index : facets) {
+                const MeshFacet& face = rFacets[index];
+                Vector3 kEdge1 = vertex(face._aulPoints[1]) - vertex(face._aulPoints[0]);
+                Vector3 kEdge2 = vertex(face._aulPoints[2]) - vertex(face._aulPoints[0]);
+                Vector3 kNormal = kEdge1.Cross(kEdge2);
+                // a degenerated facet may reference the point more than once
+                for (PointIndex point : face._aulPoints) {
+                    if (point == i) {
+                        normal += kNormal;
+                    }
+                }
+            }
+            normal.Normalize();
+            normals[i] = normal;
+        }
+    });
+
+    myCurvature.resize(numPoints);
+    parallel_for(numPoints, grain, threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<FacetIndex> facets;
+        for (std::size_t i = begin; i < end; i++) {
+            // compute the matrix of normal derivatives
+            Matrix3 akWWTrn(0, 0, 0, 0, 0, 0, 0, 0, 0);
+            Matrix3 akDWTrn(0, 0, 0, 0, 0, 0, 0, 0, 0);
+            auto addEdge = [&](PointIndex iV0, PointIndex iV1) {
+                // Compute edge from V0 to V1, project to tangent plane of vertex,
+                // and compute difference of adjacent normals.
+                Vector3 kE = vertex(iV1) - vertex(iV0);
+                Vector3 kW = kE - (kE.Dot(normals[iV0])) * normals[iV0];
+                Vector3 kD = normals[iV1] - normals[iV0];
+                for (int iRow = 0; iRow < 3; iRow++) {
+                    for (int iCol = 0; iCol < 3; iCol++) {
+                        akWWTrn[iRow][iCol] += kW[iRow] * kW[iCol];
+                        akDWTrn[iRow][iCol] += kD[iRow] * kW[iCol];
+                    }
+                }
+            };
+
+            corners.GetFacets(i, facets);
+            for (FacetIndex index : facets) {
+                const MeshFacet& face = rFacets[index];
+                for (int j = 0; j < 3; j++) {
+                    if (face._aulPoints[j] == i) {
+                        addEdge(face._aulPoints[j], face._aulPoints[(j + 1) % 3]);
+                        addEdge(face._aulPoints[j], face._aulPoints[(j + 2) % 3]);
+                    }
+                }
+            }
 
-    myCurvature.reserve(myKernel.CountPoints());
-    for (unsigned long i = 0; i < myKernel.CountPoints(); i++) {
-        CurvatureInfo ci;
-        ci.cMaxCurvDir = Base::Vector3f((float)aMaxCurvDir[i].X(),
-                                        (float)aMaxCurvDir[i].Y(),
-                                        (float)aMaxCurvDir[i].Z());
-        ci.cMinCurvDir = Base::Vector3f((float)aMinCurvDir[i].X(),
-                                        (float)aMinCurvDir[i].Y(),
-                                        (float)aMinCurvDir[i].Z());
-        ci.fMaxCurvature = (float)aMaxCurv[i];
-        ci.fMinCurvature = (float)aMinCurv[i];
-        myCurvature.push_back(ci);
-    }
+            // Add in N*N^T to W*W^T for numerical stability.  In theory 0*0^T gets
+            // added to D*W^T, but of course no update needed in the implementation.
+            // Compute the matrix of normal derivatives.
+            const Vector3& kN = normals[i];
+            for (int iRow = 0; iRow < 3; iRow++) {
+                for (int iCol = 0; iCol < 3; iCol++) {
+                    akWWTrn[iRow][iCol] = 0.5 * akWWTrn[iRow][iCol] + kN[iRow] * kN[iCol];
+                    akDWTrn[iRow][iCol] *= 0.5;
+                }
+            }
+            Matrix3 akDNormal = akDWTrn * akWWTrn.Inverse();
+
+            // compute U and V given N
+            Vector3 kU, kV;
+            Vector3::GenerateComplementBasis(kU, kV, kN);
+
+            // Compute S = J^T * dN/dX * J.  In theory S is symmetric, but
+            // because we have estimated dN/dX, we must slightly adjust our
+            // calculations to make sure S is symmetric.
+            double fS01 = kU.Dot(akDNormal * kV);
+            double fS10 = kV.Dot(akDNormal * kU);
+            double fSAvr = 0.5 * (fS01 + fS10);
+            Wm4::Matrix2<double> kS(kU.Dot(akDNormal * kU), fSAvr, fSAvr, kV.Dot(akDNormal * kV));
+
+            // compute the eigenvalues of S (min and max curvatures)
+            double fTrace = kS[0][0] + kS[1][1];
+            double fDet = kS[0][0] * kS[1][1] - kS[0][1] * kS[1][0];
+            double fDiscr = fTrace * fTrace - 4.0 * fDet;
+            double fRootDiscr = Wm4::Math<double>::Sqrt(Wm4::Math<double>::FAbs(fDiscr));
+            double minCurvature = 0.5 * (fTrace - fRootDiscr);
+            double maxCurvature = 0.5 * (fTrace + fRootDiscr);
+
+            // compute the eigenvectors of S
+            auto direction = [&](double curvature) {
+                Wm4::Vector2<double> kW0(kS[0][1], curvature - kS[0][0]);
+                Wm4::Vector2<double> kW1(curvature - kS[1][1], kS[1][0]);
+                if (kW0.SquaredLength() >= kW1.SquaredLength()) {
+                    kW0.Normalize();
+                    return kW0.X() * kU + kW0.Y() * kV;
+                }
+                kW1.Normalize();
+                return kW1.X() * kU + kW1.Y() * kV;
+            };
+            Vector3 minDirection = direction(minCurvature);
+            Vector3 maxDirection = direction(maxCurvature);
+
+            CurvatureInfo& ci = myCurvature[i];
+            ci.cMaxCurvDir = Base::Vector3f(float(maxDirection.X()),
+                                            float(maxDirection.Y()),
+                                            float(maxDirection.Z()));
+            ci.cMinCurvDir = Base::Vector3f(float(minDirection.X()),
+                                            float(minDirection.Y()),
+                                            float(minDirection.Z()));
+            ci.fMaxCurvature = float(maxCurvature);
+            ci.fMinCurvature = float(minCurvature);
+        }
+    });
 }
 #endif  // OPTIMIZE_CURVATURE
 
@@ -372,7 +465,7 @@ private:
 // --------------------------------------------------------
 
 FacetCurvature::FacetCurvature(const MeshKernel& kernel,
-                               const MeshRefPointToFacets& search,
+                               const MeshCornerTable& search,
                                float r,
                                unsigned long pt)
     : myKernel(kernel)
@@ -20,8 +20,18 @@
  *                                                                         *
  ***************************************************************************/
 
+
 #include "PreCompiled.h"
 
+#ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <future>
+#include <numeric>
+#include <thread>
+#endif
+
 #include "Decimation.h"
 #include "MeshKernel.h"
 #include "Simplify.h"
@@ -29,42 +39,121 @@
 
 using namespace MeshCore;
 
+namespace
+{
+Simplify::Vertex makeVertex(const Base::Vector3f& p, bool locked)
+{
+    Simplify::Vertex v;
+    v.tstart = 0;
+    v.tcount = 0;
+    v.border = 0;
+    v.locked = locked ? 1 : 0;
+    v.p = p;
+    return v;
+}
+
+Simplify::Triangle makeTriangle(int v0, int v1, int v2)
+{
+    Simplify::Triangle t;
+    t.deleted = 0;
+    t.dirty = 0;
+    for (double& j : t.err) {
+        j = 0.0;
+    }
+    t.v[0] = v0;
+    t.v[1] = v1;
+    t.v[2] = v2;
+    return t;
+}
+
+/*
+ * Splits the facet range [begin, end) of order at the median of the longest
+ * axis of the centroids until there are 2^levels partitions.
+ */
+void splitFacets(std::vector<FacetIndex>& order,
+                 const std::vector<Base::Vector3f>& centroids,
+                 std::size_t begin,
+                 std::size_t end,
+                 int levels)
+{
+    if (levels <= 0 || end - begin < 2) {
+        return;
+    }
+
+    Base::BoundBox3f box;
+    for (std::size_t i = begin; i < end; i++) {
+        box.Add(centroids[order[i]]);
+    }
+    unsigned short axis = 0;
+    if (box.LengthY() > box.LengthX()) {
+        axis = 1;
+    }
+    if (box.LengthZ() > std::max(box.LengthX(), box.LengthY())) {
+        axis = 2;
+    }
+
+    std::size_t mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + std::ptrdiff_t(begin),
+                     order.begin() + std::ptrdiff_t(mid),
+                     order.begin() + std::ptrdiff_t(end),
+                     [&centroids, axis](FacetIndex a, FacetIndex b) {
+                         return centroids[a][axis] < centroids[b][axis];
+                     });
+
+    auto future = std::async(std::launch::async, [&, begin, mid]() {
+        splitFacets(order, centroids, begin, mid, levels - 1);
+    });
+    splitFacets(order, centroids, mid, end, levels - 1);
+    future.get();
+}
+}  // namespace
+
 MeshSimplify::MeshSimplify(MeshKernel& mesh)
     : myKernel(mesh)
 {}
 
 void MeshSimplify::simplify(float tolerance, float reduction)
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    int target_count = static_cast<int>(static_cast<float>(numFacets) * (1.0F - reduction));
+    if (partitionSize > 0 && numFacets > partitionSize) {
+        decimatePartitioned(target_count, tolerance);
+    }
+    else {
+        decimate(target_count, tolerance);
+    }
+}
+
+void MeshSimplify::simplify(int targetSize)
+{
+    if (partitionSize > 0 && myKernel.CountFacets() > partitionSize) {
+        decimatePartitioned(targetSize, FLT_MAX);
+    }
+    else {
+        decimate(targetSize, FLT_MAX);
+    }
+}
+
+void MeshSimplify::decimate(int targetSize, double tolerance)
 {
     Simplify alg;
 
     const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+    alg.vertices.reserve(points.size());
+    for (const auto& point : points) {
+        alg.vertices.push_back(makeVertex(point, false));
     }
 
     const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
-        }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
-        }
-        alg.triangles.push_back(t);
+    alg.triangles.reserve(facets.size());
+    for (const auto& facet : facets) {
+        alg.triangles.push_back(makeTriangle(static_cast<int>(facet._aulPoints[0]),
+                                             static_cast<int>(facet._aulPoints[1]),
+                                             static_cast<int>(facet._aulPoints[2])));
     }
 
-    int target_count = static_cast<int>(static_cast<float>(facets.size()) * (1.0F - reduction));
-
     // Simplification starts
-    alg.simplify_mesh(target_count, tolerance);
+    alg.simplify_mesh(targetSize, tolerance);
 
     // Simplification done
     MeshPointArray new_points;
@@ -94,61 +183,165 @@ void MeshSimplify::simplify(float tolerance, float reduction)
     myKernel.Adopt(new_points, new_facets, true);
 }
 
-void MeshSimplify::simplify(int targetSize)
+void MeshSimplify::decimatePartitioned(int targetSize, double tolerance)
 {
-    Simplify alg;
-
     const MeshPointArray& points = myKernel.GetPoints();
-    for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.tstart = 0;
-        v.tcount = 0;
-        v.border = 0;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+    const MeshFacetArray& facets = myKernel.GetFacets();
+    const std::size_t numFacets = facets.size();
+    const std::size_t numThreads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+    // a power of two of partitions that contain at most partitionSize facets
+    int levels = 0;
+    while ((numFacets >> levels) > partitionSize) {
+        levels++;
     }
+    const std::size_t numParts = std::size_t(1) << levels;
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
-    for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
-        t.deleted = 0;
-        t.dirty = 0;
-        for (double& j : t.err) {
-            j = 0.0;
+    std::vector<FacetIndex> order(numFacets);
+    std::iota(order.begin(), order.end(), FacetIndex(0));
+    {
+        std::vector<Base::Vector3f> centroids(numFacets);
+        for (std::size_t i = 0; i < numFacets; i++) {
+            const MeshFacet& facet = facets[i];
+            centroids[i] = (points[facet._aulPoints[0]] + points[facet._aulPoints[1]]
+                            + points[facet._aulPoints[2]])
+                / 3.0F;
         }
-        for (int j = 0; j < 3; j++) {
-            t.v[j] = facets[i]._aulPoints[j];
-        }
-        alg.triangles.push_back(t);
+        splitFacets(order, centroids, 0, numFacets, levels);
     }
+    auto partBegin = [numFacets, numParts](std::size_t part) {
+        return numFacets * part / numParts;
+    };
 
-    // Simplification starts
-    alg.simplify_mesh(targetSize, FLT_MAX);
+    // points used by several partitions are locked and keep their index
+    const int shared = -2;
+    std::vector<int> owner(points.size(), -1);
+    for (std::size_t part = 0; part < numParts; part++) {
+        for (std::size_t i = partBegin(part); i < partBegin(part + 1); i++) {
+            for (PointIndex index : facets[order[i]]._aulPoints) {
+                int& value = owner[index];
+                if (value == -1) {
+                    value = int(part);
+                }
+                else if (value != int(part)) {
+                    value = shared;
+                }
+            }
+        }
+    }
 
-    // Simplification done
     MeshPointArray new_points;
-    new_points.reserve(alg.vertices.size());
-    for (const auto& vertex : alg.vertices) {
-        new_points.push_back(vertex.p);
+    std::vector<PointIndex> sharedIndex(points.size(), POINT_INDEX_MAX);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (owner[i] == shared) {
+            sharedIndex[i] = new_points.size();
+            new_points.push_back(points[i]);
+        }
     }
+    const PointIndex numShared = new_points.size();
 
-    std::size_t numFacets = 0;
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            numFacets++;
+    // Facets of a partition refer to shared points with their final index and
+    // to their own points with numShared plus the local index.
+    struct Result
+    {
+        std::vector<Base::Vector3f> points;
+        std::vector<MeshFacet> facets;
+    };
+    std::vector<Result> results(numParts);
+    const double ratio = double(targetSize) / double(numFacets);
+
+    auto decimatePart = [&](std::size_t part) {
+        std::size_t begin = partBegin(part);
+        std::size_t end = partBegin(part + 1);
+
+        std::vector<PointIndex> globalIndex;
+        globalIndex.reserve((end - begin) * 3);
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& facet = facets[order[i]];
+            globalIndex.insert(globalIndex.end(),
+                               std::begin(facet._aulPoints),
+                               std::end(facet._aulPoints));
         }
+        std::sort(globalIndex.begin(), globalIndex.end());
+        globalIndex.erase(std::unique(globalIndex.begin(), globalIndex.end()), globalIndex.end());
+        auto localIndex = [&globalIndex](PointIndex index) {
+            return int(std::lower_bound(globalIndex.begin(), globalIndex.end(), index)
+                       - globalIndex.begin());
+        };
+
+        Simplify alg;
+        alg.vertices.reserve(globalIndex.size());
+        for (PointIndex index : globalIndex) {
+            alg.vertices.push_back(makeVertex(points[index], owner[index] == shared));
+        }
+        alg.triangles.reserve(end - begin);
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& facet = facets[order[i]];
+            alg.triangles.push_back(makeTriangle(localIndex(facet._aulPoints[0]),
+                                                 localIndex(facet._aulPoints[1]),
+                                                 localIndex(facet._aulPoints[2])));
+        }
+
+        // keep the local indices to map the locked points back
+        alg.simplify_mesh(int(double(end - begin) * ratio), tolerance, 7, false);
+
+        Result& result = results[part];
+        std::vector<PointIndex> newIndex(alg.vertices.size(), POINT_INDEX_MAX);
+        for (const auto& triangle : alg.triangles) {
+            if (triangle.deleted) {
+                continue;
+            }
+            MeshFacet face;
+            for (int j = 0; j < 3; j++) {
+                int local = triangle.v[j];
+                PointIndex& index = newIndex[local];
+                if (index == POINT_INDEX_MAX) {
+                    if (alg.vertices[local].locked) {
+                        index = sharedIndex[globalIndex[local]];
+                    }
+                    else {
+                        index = numShared + result.points.size();
+                        result.points.push_back(alg.vertices[local].p);
+                    }
+                }
+                face._aulPoints[j] = index;
+            }
+            result.facets.push_back(face);
+        }
+    };
+
+    // only as many partitions as threads are in memory at the same time
+    std::atomic<std::size_t> next {0};
+    std::vector<std::future<void>> workers;
+    for (std::size_t i = 0; i < std::min(numThreads, numParts); i++) {
+        workers.push_back(std::async(std::launch::async, [&]() {
+            for (std::size_t part = next++; part < numParts; part = next++) {
+                decimatePart(part);
+            }
+        }));
     }
+    for (auto& worker : workers) {
+        worker.get();
+    }
+
     MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
-    for (const auto& triangle : alg.triangles) {
-        if (!triangle.deleted) {
-            MeshFacet face;
-            face._aulPoints[0] = triangle.v[0];
-            face._aulPoints[1] = triangle.v[1];
-            face._aulPoints[2] = triangle.v[2];
+    for (Result& result : results) {
+        PointIndex offset = new_points.size() - numShared;
+        for (const auto& point : result.points) {
+            new_points.push_back(point);
+        }
+        for (MeshFacet& face : result.facets) {
+            for (PointIndex& index : face._aulPoints) {
+                if (index >= numShared) {
+                    index += offset;
+                }
+            }
             new_facets.push_back(face);
         }
+        result = Result();
     }
 
-    myKernel.Adopt(new_points, new_facets, true);
+    // a final pass over the reduced mesh also decimates the partition borders
+    myKernel.Adopt(new_points, new_facets, false);
+    decimate(targetSize, tolerance);
 }
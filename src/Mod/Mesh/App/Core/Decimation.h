@@ -24,21 +24,43 @@
 #ifndef MESH_DECIMATION_H
 #define MESH_DECIMATION_H
 
+#include <cstddef>
 #include <Mod/Mesh/MeshGlobal.h>
 
 namespace MeshCore
 {
 class MeshKernel;
 
+/**
+ * Quadric based decimation of a mesh.
+ *
+ * Meshes with more facets than the partition size are split spatially into
+ * partitions that are decimated in parallel. Points shared by several
+ * partitions are locked during this step. A final pass over the already
+ * reduced mesh then removes the remaining facets along the partition borders.
+ * Only a limited number of partitions is processed at the same time, which
+ * keeps the memory consumption of the decimation far below that of a single
+ * pass over the whole mesh.
+ */
 class MeshExport MeshSimplify
 {
 public:
     explicit MeshSimplify(MeshKernel&);
     void simplify(float tolerance, float reduction);
     void simplify(int targetSize);
+    /// Sets the maximum number of facets of a partition, 0 disables the partitioning
+    void setPartitionSize(std::size_t size)
+    {
+        partitionSize = size;
+    }
+
+private:
+    void decimate(int targetSize, double tolerance);
+    void decimatePartitioned(int targetSize, double tolerance);
 
 private:
     MeshKernel& myKernel;
+    std::size_t partitionSize {1000000};
 };
 
 }  // namespace MeshCore
@@ -24,6 +24,8 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <future>
+#include <tuple>
 #include <vector>
 #endif
 
@@ -32,6 +34,7 @@
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Degeneration.h"
 #include "Evaluation.h"
 #include "Functional.h"
 #include "Grid.h"
@@ -473,11 +476,16 @@ bool MeshFixTopology::Fixup()
 
 bool MeshEvalPointManifolds::Evaluate()
 {
-    this->nonManifoldPoints.clear();
-    this->facetsOfNonManifoldPoints.clear();
-
     MeshCore::MeshRefPointToPoints vv_it(_rclMesh);
     MeshCore::MeshRefPointToFacets vf_it(_rclMesh);
+    return Evaluate(vv_it, vf_it);
+}
+
+bool MeshEvalPointManifolds::Evaluate(const MeshRefPointToPoints& vv_it,
+                                      const MeshRefPointToFacets& vf_it)
+{
+    this->nonManifoldPoints.clear();
+    this->facetsOfNonManifoldPoints.clear();
 
     unsigned long ctPoints = _rclMesh.CountPoints();
     for (PointIndex index = 0; index < ctPoints; index++) {
@@ -1212,3 +1220,85 @@ void MeshEigensystem::CalculateLocalSystem()
         _cW = -_cW;  // make a right-handed system
     }
 }
+
+// ----------------------------------------------------
+
+MeshEvalDefects::MeshEvalDefects(const MeshKernel& rclM, float fEps, bool checkPointManifolds)
+    : MeshEvaluation(rclM)
+    , fEpsilon(fEps)
+    , checkPointManifolds(checkPointManifolds)
+{}
+
+bool MeshEvalDefects::Evaluate()
+{
+    // The checks only read the mesh. Except for the orientation, which uses the facet flags,
+    // and the topology and neighbour checks, which use a progress indicator, they can run
+    // in parallel.
+    auto duplFacets = std::async(std::launch::async, [this]() {
+        return MeshEvalDuplicateFacets(_rclMesh).GetIndices();
+    });
+    auto duplPoints = std::async(std::launch::async, [this]() {
+        MeshEvalDuplicatePoints eval(_rclMesh);
+        return eval.Evaluate() ? std::vector<PointIndex>() : eval.GetIndices();
+    });
+    auto degenerated = std::async(std::launch::async, [this]() {
+        return MeshEvalDegeneratedFacets(_rclMesh, fEpsilon).GetIndices();
+    });
+    auto pointManifolds = std::async(std::launch::async, [this]() {
+        std::vector<PointIndex> points;
+        if (checkPointManifolds) {
+            auto vv_it = std::async(std::launch::async, [this]() {
+                return MeshRefPointToPoints(_rclMesh);
+            });
+            MeshRefPointToFacets vf_it(_rclMesh);
+            MeshEvalPointManifolds eval(_rclMesh);
+            if (!eval.Evaluate(vv_it.get(), vf_it)) {
+                points = eval.GetIndices();
+            }
+        }
+        return points;
+    });
+    auto ranges = std::async(std::launch::async, [this]() {
+        std::pair<IndexDefect, std::vector<FacetIndex>> result(IndexDefect::None, {});
+        MeshEvalRangeFacet rf(_rclMesh);
+        MeshEvalRangePoint rp(_rclMesh);
+        MeshEvalCorruptedFacets cf(_rclMesh);
+        if (!rf.Evaluate()) {
+            result = {IndexDefect::FacetRange, rf.GetIndices()};
+        }
+        else if (!rp.Evaluate()) {
+            result.first = IndexDefect::PointRange;
+        }
+        else if (!cf.Evaluate()) {
+            result = {IndexDefect::CorruptedFacets, cf.GetIndices()};
+        }
+        return result;
+    });
+
+    flippedFacets = MeshEvalOrientation(_rclMesh).GetIndices();
+
+    MeshEvalTopology topology(_rclMesh);
+    nonManifoldEdges.clear();
+    if (!topology.Evaluate()) {
+        nonManifoldEdges = topology.GetIndices();
+    }
+
+    // the neighbour check relies on valid indices
+    std::tie(indexDefect, invalidIndices) = ranges.get();
+    if (indexDefect == IndexDefect::None) {
+        MeshEvalNeighbourhood nb(_rclMesh);
+        if (!nb.Evaluate()) {
+            indexDefect = IndexDefect::Neighbourhood;
+            invalidIndices = nb.GetIndices();
+        }
+    }
+
+    duplicatedFacets = duplFacets.get();
+    duplicatedPoints = duplPoints.get();
+    degeneratedFacets = degenerated.get();
+    nonManifoldPoints = pointManifolds.get();
+
+    return flippedFacets.empty() && duplicatedFacets.empty() && duplicatedPoints.empty()
+        && degeneratedFacets.empty() && nonManifoldEdges.empty() && nonManifoldPoints.empty()
+        && indexDefect == IndexDefect::None;
+}
@@ -33,6 +33,9 @@
 namespace MeshCore
 {
 
+class MeshRefPointToFacets;
+class MeshRefPointToPoints;
+
 /**
  * The MeshEvaluation class checks the mesh kernel for correctness with respect to a
  * certain criterion, such as manifoldness, self-intersections, etc.
@@ -263,6 +266,8 @@ public:
         : MeshEvaluation(rclB)
     {}
     bool Evaluate() override;
+    /** Same as Evaluate() but with already built neighbourhoods of the points. */
+    bool Evaluate(const MeshRefPointToPoints& vv_it, const MeshRefPointToFacets& vf_it);
 
     void GetFacetIndices(std::vector<FacetIndex>& facets) const;
     const std::list<std::vector<FacetIndex>>& GetFacetIndices() const
@@ -424,6 +429,88 @@ private:
         _fW; /**< Expansion in \a u, \a v, and \a w direction of the transformed mesh. */
 };
 
+// ----------------------------------------------------
+
+/**
+ * The MeshEvalDefects class runs the standard defect checks of the mesh evaluation in one pass.
+ * The checks that neither use the facet flags nor a progress indicator run in parallel to the
+ * others, and the neighbourhoods of the points needed for the non-manifold points are built once
+ * in parallel, too.
+ * The results are the same as with the single checks.
+ */
+class MeshExport MeshEvalDefects: public MeshEvaluation
+{
+public:
+    /// Kind of the first invalid index found, in the order they are checked
+    enum class IndexDefect
+    {
+        None,
+        FacetRange,
+        PointRange,
+        CorruptedFacets,
+        Neighbourhood
+    };
+
+    /**
+     * Construction. \a fEps is the tolerance for degenerated facets and
+     * \a checkPointManifolds enables the check for non-manifold points.
+     */
+    MeshEvalDefects(const MeshKernel& rclM, float fEps, bool checkPointManifolds);
+    /** Runs all checks and returns true if there is no defect. */
+    bool Evaluate() override;
+
+    /** @name Results */
+    //@{
+    const std::vector<FacetIndex>& GetFlippedFacets() const
+    {
+        return flippedFacets;
+    }
+    const std::vector<FacetIndex>& GetDuplicatedFacets() const
+    {
+        return duplicatedFacets;
+    }
+    const std::vector<PointIndex>& GetDuplicatedPoints() const
+    {
+        return duplicatedPoints;
+    }
+    const std::vector<FacetIndex>& GetDegeneratedFacets() const
+    {
+        return degeneratedFacets;
+    }
+    /** Pairs of the point indices of the non-manifold edges. */
+    const std::vector<std::pair<FacetIndex, FacetIndex>>& GetNonManifoldEdges() const
+    {
+        return nonManifoldEdges;
+    }
+    const std::vector<PointIndex>& GetNonManifoldPoints() const
+    {
+        return nonManifoldPoints;
+    }
+    IndexDefect GetIndexDefect() const
+    {
+        return indexDefect;
+    }
+    /** Facets with invalid indices of the kind GetIndexDefect(). For invalid point
+     * indices it's empty. */
+    const std::vector<FacetIndex>& GetInvalidIndices() const
+    {
+        return invalidIndices;
+    }
+    //@}
+
+private:
+    float fEpsilon;
+    bool checkPointManifolds;
+    std::vector<FacetIndex> flippedFacets;
+    std::vector<FacetIndex> duplicatedFacets;
+    std::vector<PointIndex> duplicatedPoints;
+    std::vector<FacetIndex> degeneratedFacets;
+    std::vector<std::pair<FacetIndex, FacetIndex>> nonManifoldEdges;
+    std::vector<PointIndex> nonManifoldPoints;
+    IndexDefect indexDefect {IndexDefect::None};
+    std::vector<FacetIndex> invalidIndices;
+};
+
 }  // namespace MeshCore
 
 #endif  // MESH_EVALUATION_H
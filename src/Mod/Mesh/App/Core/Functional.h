@@ -24,7 +24,9 @@
 #define MESH_FUNCTIONAL_H
 
 #include <algorithm>
+#include <cstddef>
 #include <future>
+#include <vector>
 
 
 namespace MeshCore
@@ -62,6 +64,32 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/**
+ * Splits the index range [0, count) into up to \a threads ranges of at least \a grain
+ * elements and calls \a func(begin, end) for each of them in parallel.
+ */
+template<class Func>
+static void parallel_for(std::size_t count, std::size_t grain, int threads, Func func)
+{
+    std::size_t tasks = std::min<std::size_t>(threads > 0 ? threads : 1,
+                                              count / std::max<std::size_t>(grain, 1));
+    if (tasks < 2) {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(tasks - 1);
+    for (std::size_t i = 1; i < tasks; i++) {
+        futures.push_back(
+            std::async(std::launch::async, func, count * i / tasks, count * (i + 1) / tasks));
+    }
+    func(std::size_t(0), count / tasks);
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 }  // namespace MeshCore
 
 
@@ -22,12 +22,17 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <array>
 #include <boost/tokenizer.hpp>
+#include <cstdlib>
 #include <memory>
 #include <ostream>
 #include <sstream>
-#include <xercesc/dom/DOM.hpp>
-#include <xercesc/parsers/XercesDOMParser.hpp>
+#include <stdexcept>
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
 #endif
 
 #include "Core/MeshIO.h"
@@ -43,6 +48,326 @@
 using namespace MeshCore;
 using namespace XERCES_CPP_NAMESPACE;
 
+namespace
+{
+
+// The attribute values of vertices and triangles are parsed directly from
+// the parser's buffer without transcoding them into a std::string first
+float toFloat(const XMLCh* value)
+{
+    std::array<char, 64> buf {};
+    std::size_t len = 0;
+    for (; value[len] != 0 && len + 1 < buf.size(); len++) {
+        if (value[len] > 0x7f) {
+            break;
+        }
+        buf[len] = static_cast<char>(value[len]);
+    }
+
+    char* end {};
+    float num = std::strtof(buf.data(), &end);
+    if (end == buf.data()) {
+        throw std::invalid_argument("Invalid floating point number");
+    }
+    return num;
+}
+
+PointIndex toIndex(const XMLCh* value)
+{
+    while (*value == ' ' || *value == '\t' || *value == '\n' || *value == '\r') {
+        value++;
+    }
+    if (*value < '0' || *value > '9') {
+        throw std::invalid_argument("Invalid index");
+    }
+
+    PointIndex num = 0;
+    for (; *value >= '0' && *value <= '9'; value++) {
+        num = num * 10 + static_cast<PointIndex>(*value - '0');  // NOLINT
+    }
+    return num;
+}
+
+}  // namespace
+
+/*!
+ * The ModelHandler reads a model file with a SAX parser. Vertices and triangles
+ * are added to the arrays of the current mesh while the parser walks through
+ * the file, so no document tree of the whole model is built.
+ */
+class Reader3MF::ModelHandler: public DefaultHandler
+{
+public:
+    ModelHandler(Reader3MF& owner, const Component& component)
+        : reader(owner)
+        , comp(component)
+    {}
+
+    bool IsValid() const
+    {
+        return (hasResources && !reader.meshes.empty() && hasBuild);
+    }
+
+    void startElement(const XMLCh* const /*uri*/,
+                      const XMLCh* const /*localname*/,
+                      const XMLCh* const qname,
+                      const Attributes& attrs) override
+    {
+        if (inMesh) {
+            if (XMLString::equals(qname, tagVertex.unicodeForm())) {
+                AddVertex(attrs);
+            }
+            else if (XMLString::equals(qname, tagTriangle.unicodeForm())) {
+                AddTriangle(attrs);
+            }
+            else if (XMLString::equals(qname, tagMesh.unicodeForm())) {
+                depthMesh++;
+            }
+        }
+        else if (inResources) {
+            if (XMLString::equals(qname, tagObject.unicodeForm())) {
+                StartObject(attrs);
+            }
+            else if (XMLString::equals(qname, tagMesh.unicodeForm())) {
+                if (objectId >= 0) {
+                    inMesh = true;
+                    depthMesh = 1;
+                    hasMesh = true;
+                    points.clear();
+                    facets.clear();
+                }
+            }
+            else if (XMLString::equals(qname, tagComponent.unicodeForm())) {
+                if (objectId >= 0) {
+                    AddComponent(attrs);
+                }
+            }
+            else if (XMLString::equals(qname, tagResources.unicodeForm())) {
+                depthResources++;
+            }
+        }
+        else if (inBuild) {
+            if (XMLString::equals(qname, tagItem.unicodeForm())) {
+                AddItem(attrs);
+            }
+            else if (XMLString::equals(qname, tagBuild.unicodeForm())) {
+                depthBuild++;
+            }
+        }
+        else if (depthModel > 0) {
+            // only the first resources and build elements are used
+            if (XMLString::equals(qname, tagResources.unicodeForm())) {
+                if (!hasResources) {
+                    inResources = true;
+                    depthResources = 1;
+                    hasResources = true;
+                }
+            }
+            else if (XMLString::equals(qname, tagBuild.unicodeForm())) {
+                if (!hasBuild) {
+                    inBuild = true;
+                    depthBuild = 1;
+                    hasBuild = true;
+                }
+            }
+            else if (XMLString::equals(qname, tagModel.unicodeForm())) {
+                depthModel++;
+            }
+        }
+        else if (!hasModel && XMLString::equals(qname, tagModel.unicodeForm())) {
+            // only the first model element is used
+            hasModel = true;
+            depthModel = 1;
+        }
+    }
+
+    void endElement(const XMLCh* const /*uri*/,
+                    const XMLCh* const /*localname*/,
+                    const XMLCh* const qname) override
+    {
+        if (inMesh) {
+            if (XMLString::equals(qname, tagMesh.unicodeForm()) && --depthMesh == 0) {
+                inMesh = false;
+                FinishMesh();
+            }
+        }
+        else if (inResources) {
+            if (XMLString::equals(qname, tagObject.unicodeForm())) {
+                FinishObject();
+            }
+            else if (XMLString::equals(qname, tagResources.unicodeForm())
+                     && --depthResources == 0) {
+                inResources = false;
+            }
+        }
+        else if (inBuild) {
+            if (XMLString::equals(qname, tagBuild.unicodeForm()) && --depthBuild == 0) {
+                inBuild = false;
+            }
+        }
+        else if (depthModel > 0) {
+            if (XMLString::equals(qname, tagModel.unicodeForm())) {
+                depthModel--;
+            }
+        }
+    }
+
+    /// Applies the transformations of the build items once all objects are known
+    void endDocument() override
+    {
+        for (const auto& it : items) {
+            auto jt = reader.meshes.find(it.first);
+            if (jt != reader.meshes.end()) {
+                jt->second.second = it.second;
+            }
+
+            for (auto& kt : reader.components) {
+                if (kt.id == it.first) {
+                    kt.transform = it.second;
+                    break;
+                }
+            }
+        }
+    }
+
+private:
+    void StartObject(const Attributes& attrs)
+    {
+        objectId = -1;
+        hasMesh = false;
+        objectComponents.clear();
+        if (const XMLCh* id = attrs.getValue(attrId.unicodeForm())) {
+            objectId = std::stoi(StrX(id).c_str());
+        }
+    }
+
+    void FinishObject()
+    {
+        // an object consists either of a mesh or of components
+        if (!hasMesh) {
+            reader.components.insert(reader.components.end(),
+                                     objectComponents.begin(),
+                                     objectComponents.end());
+        }
+        objectId = -1;
+        objectComponents.clear();
+    }
+
+    void AddVertex(const Attributes& attrs)
+    {
+        const XMLCh* xAttr = attrs.getValue(attrX.unicodeForm());
+        const XMLCh* yAttr = attrs.getValue(attrY.unicodeForm());
+        const XMLCh* zAttr = attrs.getValue(attrZ.unicodeForm());
+        if (xAttr && yAttr && zAttr) {
+            points.emplace_back(toFloat(xAttr), toFloat(yAttr), toFloat(zAttr));
+        }
+    }
+
+    void AddTriangle(const Attributes& attrs)
+    {
+        const XMLCh* v1Attr = attrs.getValue(attrV1.unicodeForm());
+        const XMLCh* v2Attr = attrs.getValue(attrV2.unicodeForm());
+        const XMLCh* v3Attr = attrs.getValue(attrV3.unicodeForm());
+        if (v1Attr && v2Attr && v3Attr) {
+            facets.emplace_back(toIndex(v1Attr), toIndex(v2Attr), toIndex(v3Attr));
+        }
+    }
+
+    void FinishMesh()
+    {
+        MeshCleanup meshCleanup(points, facets);
+        meshCleanup.RemoveInvalids();
+        MeshPointFacetAdjacency meshAdj(points.size(), facets);
+        meshAdj.SetFacetNeighbourhood();
+
+        MeshKernel kernel;
+        kernel.Adopt(points, facets);
+        reader.meshes.emplace(objectId, std::make_pair(kernel, comp.transform));
+    }
+
+    void AddComponent(const Attributes& attrs)
+    {
+        auto validComponent = [](const Component& it) {
+            return (it.id > 0 && it.objectId >= 0 && !it.path.empty());
+        };
+
+        Component component;
+        component.id = objectId;
+        if (const XMLCh* path = attrs.getValue(attrPath.unicodeForm())) {
+            component.path = StrX(path).c_str();
+        }
+        if (const XMLCh* id = attrs.getValue(attrObjectId.unicodeForm())) {
+            component.objectId = std::stoi(StrX(id).c_str());
+        }
+        if (const XMLCh* transform = attrs.getValue(attrTransform.unicodeForm())) {
+            std::optional<Base::Matrix4D> mat = ReadTransform(StrX(transform).c_str());
+            if (mat) {
+                component.transform = mat.value();
+            }
+        }
+        if (validComponent(component)) {
+            objectComponents.push_back(component);
+        }
+    }
+
+    void AddItem(const Attributes& attrs)
+    {
+        const XMLCh* id = attrs.getValue(attrObjectId.unicodeForm());
+        const XMLCh* transform = attrs.getValue(attrTransform.unicodeForm());
+        if (id) {
+            int idValue = std::stoi(StrX(id).c_str());
+            if (transform) {
+                std::optional<Base::Matrix4D> mat = ReadTransform(StrX(transform).c_str());
+                if (mat) {
+                    items.emplace_back(idValue, mat.value());
+                }
+            }
+        }
+    }
+
+private:
+    Reader3MF& reader;
+    const Component& comp;
+
+    bool hasModel = false;
+    bool hasResources = false;
+    bool hasBuild = false;
+    bool inResources = false;
+    bool inBuild = false;
+    bool inMesh = false;
+    bool hasMesh = false;
+    int depthModel = 0;
+    int depthResources = 0;
+    int depthBuild = 0;
+    int depthMesh = 0;
+    int objectId = -1;
+
+    MeshPointArray points;
+    MeshFacetArray facets;
+    std::vector<Component> objectComponents;
+    std::vector<std::pair<int, Base::Matrix4D>> items;
+
+    XStr tagModel {"model"};
+    XStr tagResources {"resources"};
+    XStr tagBuild {"build"};
+    XStr tagObject {"object"};
+    XStr tagMesh {"mesh"};
+    XStr tagVertex {"vertex"};
+    XStr tagTriangle {"triangle"};
+    XStr tagComponent {"component"};
+    XStr tagItem {"item"};
+    XStr attrId {"id"};
+    XStr attrObjectId {"objectid"};
+    XStr attrPath {"p:path"};
+    XStr attrTransform {"transform"};
+    XStr attrX {"x"};
+    XStr attrY {"y"};
+    XStr attrZ {"z"};
+    XStr attrV1 {"v1"};
+    XStr attrV2 {"v2"};
+    XStr attrV3 {"v3"};
+};
+
 Reader3MF::Reader3MF(std::istream& str)
 {
     file = std::make_unique<zipios::ZipHeader>(str);
@@ -107,19 +432,19 @@ bool Reader3MF::LoadModel(std::istream& str, const Component& comp)
     catch (const XMLException&) {
         return false;
     }
-    catch (const DOMException&) {
+    catch (const SAXException&) {
         return false;
     }
 }
 
-std::unique_ptr<XercesDOMParser> Reader3MF::makeDomParser()
+std::unique_ptr<SAX2XMLReader> Reader3MF::makeParser()
 {
-    std::unique_ptr<XercesDOMParser> parser(new XercesDOMParser);
-    parser->setValidationScheme(XercesDOMParser::Val_Auto);
-    parser->setDoNamespaces(false);
-    parser->setDoSchema(false);
-    parser->setValidationSchemaFullChecking(false);
-    parser->setCreateEntityReferenceNodes(false);
+    std::unique_ptr<SAX2XMLReader> parser(XMLReaderFactory::createXMLReader());
+    parser->setFeature(XMLUni::fgSAX2CoreValidation, true);
+    parser->setFeature(XMLUni::fgXercesDynamic, true);
+    parser->setFeature(XMLUni::fgSAX2CoreNameSpaces, false);
+    parser->setFeature(XMLUni::fgXercesSchema, false);
+    parser->setFeature(XMLUni::fgXercesSchemaFullChecking, false);
     return parser;
 }
 
@@ -130,114 +455,15 @@ bool Reader3MF::TryLoadModel(std::istream& str, const Component& comp)
     }
 
     Base::StdInputSource inputSource(str, comp.path.c_str());
-    std::unique_ptr<XercesDOMParser> parser = makeDomParser();
+    std::unique_ptr<SAX2XMLReader> parser = makeParser();
+    ModelHandler handler(*this, comp);
+    parser->setContentHandler(&handler);
+    parser->setErrorHandler(&handler);
     parser->parse(inputSource);
-    std::unique_ptr<DOMDocument> xmlDocument(parser->adoptDocument());
-    return LoadModel(*xmlDocument, comp);
-}
-
-bool Reader3MF::LoadModel(DOMDocument& xmlDocument, const Component& comp)
-{
-    DOMNodeList* nodes = xmlDocument.getElementsByTagName(XStr("model").unicodeForm());
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            return LoadResourcesAndBuild(static_cast<DOMElement*>(node), comp);
-        }
-    }
-
-    return false;
-}
-
-bool Reader3MF::LoadResourcesAndBuild(DOMElement* node, const Component& comp)
-{
-    bool resource =
-        LoadResources(node->getElementsByTagName(XStr("resources").unicodeForm()), comp);
-    bool build = LoadBuild(node->getElementsByTagName(XStr("build").unicodeForm()));
-    return (resource && build);
+    return handler.IsValid();
 }
 
-bool Reader3MF::LoadResources(DOMNodeList* nodes, const Component& comp)
-{
-    if (!nodes) {
-        return false;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            DOMNodeList* objectList = elem->getElementsByTagName(XStr("object").unicodeForm());
-            return LoadObject(objectList, comp);
-        }
-    }
-
-    return false;
-}
-
-bool Reader3MF::LoadBuild(DOMNodeList* nodes)
-{
-    if (!nodes) {
-        return false;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            DOMNodeList* objectList = elem->getElementsByTagName(XStr("item").unicodeForm());
-            return LoadItems(objectList);
-        }
-    }
-
-    return false;
-}
-
-bool Reader3MF::LoadItems(DOMNodeList* nodes)
-{
-    if (!nodes) {
-        return false;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* itemNode = nodes->item(i);
-        DOMNamedNodeMap* nodeMap = itemNode->getAttributes();
-        LoadItem(nodeMap);
-    }
-
-    return true;
-}
-
-void Reader3MF::LoadItem(DOMNamedNodeMap* nodeMap)
-{
-    DOMNode* idAttr = nodeMap->getNamedItem(XStr("objectid").unicodeForm());
-    if (idAttr) {
-        std::string id = StrX(idAttr->getNodeValue()).c_str();
-        int idValue = std::stoi(id);
-
-        DOMNode* transformAttr = nodeMap->getNamedItem(XStr("transform").unicodeForm());
-        if (transformAttr) {
-            std::optional<Base::Matrix4D> mat = ReadTransform(transformAttr);
-            if (mat) {
-                auto it = meshes.find(idValue);
-                if (it != meshes.end()) {
-                    it->second.second = mat.value();
-                }
-
-                auto jt = std::find_if(components.begin(),
-                                       components.end(),
-                                       [idValue](const Component& comp) {
-                                           return comp.id == idValue;
-                                       });
-                if (jt != components.end()) {
-                    jt->transform = mat.value();
-                }
-            }
-        }
-    }
-}
-
-std::optional<Base::Matrix4D> Reader3MF::ReadTransform(DOMNode* transformAttr)
+std::optional<Base::Matrix4D> Reader3MF::ReadTransform(const std::string& transform)
 {
     constexpr const std::size_t numEntries = 12;
     using Pos2d = std::array<std::array<int, 2>, numEntries>;
@@ -250,56 +476,24 @@ std::optional<Base::Matrix4D> Reader3MF::ReadTransform(DOMNode* transformAttr)
     }};
     // clang-format on
 
-    if (transformAttr) {
-        std::string transform = StrX(transformAttr->getNodeValue()).c_str();
-        boost::char_separator<char> sep(" ,");
-        boost::tokenizer<boost::char_separator<char>> tokens(transform, sep);
-        std::vector<std::string> token_results;
-        token_results.assign(tokens.begin(), tokens.end());
-        if (token_results.size() == numEntries) {
-            Base::Matrix4D mat;
-            // NOLINTBEGIN
-            int index = 0;
-            for (const auto& it : pos) {
-                auto [r, c] = it;
-                mat[r][c] = std::stod(token_results[index++]);
-            }
-            // NOLINTEND
-            return mat;
+    boost::char_separator<char> sep(" ,");
+    boost::tokenizer<boost::char_separator<char>> tokens(transform, sep);
+    std::vector<std::string> token_results;
+    token_results.assign(tokens.begin(), tokens.end());
+    if (token_results.size() == numEntries) {
+        Base::Matrix4D mat;
+        // NOLINTBEGIN
+        int index = 0;
+        for (const auto& it : pos) {
+            auto [r, c] = it;
+            mat[r][c] = std::stod(token_results[index++]);
         }
+        // NOLINTEND
+        return mat;
     }
     return {};
 }
 
-bool Reader3MF::LoadObject(DOMNodeList* nodes, const Component& comp)
-{
-    if (!nodes) {
-        return false;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* objectNode = nodes->item(i);
-        if (objectNode->getNodeType() == DOMNode::ELEMENT_NODE) {
-            DOMNode* idAttr = objectNode->getAttributes()->getNamedItem(XStr("id").unicodeForm());
-            auto elem = static_cast<DOMElement*>(objectNode);
-            if (idAttr) {
-                int id = std::stoi(StrX(idAttr->getNodeValue()).c_str());
-                DOMNodeList* meshNode = elem->getElementsByTagName(XStr("mesh").unicodeForm());
-                if (meshNode->getLength() > 0) {
-                    LoadMesh(meshNode, id, comp);
-                }
-                else {
-                    DOMNodeList* compNode =
-                        elem->getElementsByTagName(XStr("components").unicodeForm());
-                    LoadComponents(compNode, id);
-                }
-            }
-        }
-    }
-
-    return (!meshes.empty());
-}
-
 bool Reader3MF::LoadMeshFromComponents()
 {
     for (const auto& it : components) {
@@ -310,170 +504,3 @@ bool Reader3MF::LoadMeshFromComponents()
 
     return (!meshes.empty());
 }
-
-void Reader3MF::LoadComponents(DOMNodeList* nodes, int id)
-{
-    if (!nodes) {
-        return;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* objectNode = nodes->item(i);
-        if (objectNode->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(objectNode);
-            DOMNodeList* compNode = elem->getElementsByTagName(XStr("component").unicodeForm());
-            if (compNode->getLength() > 0) {
-                LoadComponent(compNode, id);
-            }
-        }
-    }
-}
-
-void Reader3MF::LoadComponent(DOMNodeList* nodes, int id)
-{
-    if (!nodes) {
-        return;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* compNode = nodes->item(i);
-        if (compNode->getNodeType() == DOMNode::ELEMENT_NODE) {
-            if (DOMNamedNodeMap* attr = compNode->getAttributes()) {
-                LoadComponent(attr, id);
-            }
-        }
-    }
-}
-
-void Reader3MF::LoadComponent(DOMNamedNodeMap* attr, int id)
-{
-    auto validComponent = [](const Component& comp) {
-        return (comp.id > 0 && comp.objectId >= 0 && !comp.path.empty());
-    };
-
-    Component component;
-    component.id = id;
-    if (DOMNode* pathAttr = attr->getNamedItem(XStr("p:path").unicodeForm())) {
-        component.path = StrX(pathAttr->getNodeValue()).c_str();
-    }
-    if (DOMNode* idAttr = attr->getNamedItem(XStr("objectid").unicodeForm())) {
-        component.objectId = std::stoi(StrX(idAttr->getNodeValue()).c_str());
-    }
-    if (DOMNode* transformAttr = attr->getNamedItem(XStr("transform").unicodeForm())) {
-        std::optional<Base::Matrix4D> mat = ReadTransform(transformAttr);
-        if (mat) {
-            component.transform = mat.value();
-        }
-    }
-    if (validComponent(component)) {
-        components.push_back(component);
-    }
-}
-
-void Reader3MF::LoadMesh(DOMNodeList* nodes, int id, const Component& comp)
-{
-    if (!nodes) {
-        return;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            MeshPointArray points;
-            MeshFacetArray facets;
-            LoadVertices(elem->getElementsByTagName(XStr("vertices").unicodeForm()), points);
-            LoadTriangles(elem->getElementsByTagName(XStr("triangles").unicodeForm()), facets);
-
-            MeshCleanup meshCleanup(points, facets);
-            meshCleanup.RemoveInvalids();
-            MeshPointFacetAdjacency meshAdj(points.size(), facets);
-            meshAdj.SetFacetNeighbourhood();
-
-            Base::Matrix4D mat = comp.transform;
-            MeshKernel kernel;
-            kernel.Adopt(points, facets);
-            meshes.emplace(id, std::make_pair(kernel, mat));
-        }
-    }
-}
-
-void Reader3MF::LoadVertices(DOMNodeList* nodes, MeshPointArray& points)
-{
-    if (!nodes) {
-        return;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            DOMNodeList* vertexList = elem->getElementsByTagName(XStr("vertex").unicodeForm());
-            if (vertexList) {
-                ReadVertices(vertexList, points);
-            }
-        }
-    }
-}
-
-void Reader3MF::ReadVertices(DOMNodeList* vertexList, MeshPointArray& points)
-{
-    XMLSize_t numVertices = vertexList->getLength();
-    points.reserve(numVertices);
-    for (XMLSize_t j = 0; j < numVertices; j++) {
-        DOMNode* vertexNode = vertexList->item(j);
-        DOMNamedNodeMap* attr = vertexNode->getAttributes();
-        if (attr) {
-            DOMNode* xAttr = attr->getNamedItem(XStr("x").unicodeForm());
-            DOMNode* yAttr = attr->getNamedItem(XStr("y").unicodeForm());
-            DOMNode* zAttr = attr->getNamedItem(XStr("z").unicodeForm());
-            if (xAttr && yAttr && zAttr) {
-                // NOLINTBEGIN
-                float x = std::stof(StrX(xAttr->getNodeValue()).c_str());
-                float y = std::stof(StrX(yAttr->getNodeValue()).c_str());
-                float z = std::stof(StrX(zAttr->getNodeValue()).c_str());
-                points.emplace_back(x, y, z);
-                // NOLINTEND
-            }
-        }
-    }
-}
-
-void Reader3MF::LoadTriangles(DOMNodeList* nodes, MeshFacetArray& facets)
-{
-    if (!nodes) {
-        return;
-    }
-
-    for (XMLSize_t i = 0; i < nodes->getLength(); i++) {
-        DOMNode* node = nodes->item(i);
-        if (node->getNodeType() == DOMNode::ELEMENT_NODE) {
-            auto elem = static_cast<DOMElement*>(node);
-            DOMNodeList* triangleList = elem->getElementsByTagName(XStr("triangle").unicodeForm());
-            if (triangleList) {
-                ReadTriangles(triangleList, facets);
-            }
-        }
-    }
-}
-
-void Reader3MF::ReadTriangles(DOMNodeList* triangleList, MeshFacetArray& facets)
-{
-    XMLSize_t numTriangles = triangleList->getLength();
-    facets.reserve(numTriangles);
-    for (XMLSize_t j = 0; j < numTriangles; j++) {
-        DOMNode* triangleNode = triangleList->item(j);
-        DOMNamedNodeMap* attr = triangleNode->getAttributes();
-        if (attr) {
-            DOMNode* v1Attr = attr->getNamedItem(XStr("v1").unicodeForm());
-            DOMNode* v2Attr = attr->getNamedItem(XStr("v2").unicodeForm());
-            DOMNode* v3Attr = attr->getNamedItem(XStr("v3").unicodeForm());
-            if (v1Attr && v2Attr && v3Attr) {
-                PointIndex v1 = std::stoul(StrX(v1Attr->getNodeValue()).c_str());
-                PointIndex v2 = std::stoul(StrX(v2Attr->getNodeValue()).c_str());
-                PointIndex v3 = std::stoul(StrX(v3Attr->getNodeValue()).c_str());
-                facets.emplace_back(v1, v2, v3);
-            }
-        }
-    }
-}
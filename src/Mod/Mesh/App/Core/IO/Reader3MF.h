@@ -34,12 +34,7 @@
 
 namespace XERCES_CPP_NAMESPACE
 {
-class DOMDocument;
-class DOMElement;
-class DOMNode;
-class DOMNodeList;
-class DOMNamedNodeMap;
-class XercesDOMParser;
+class SAX2XMLReader;
 }  // namespace XERCES_CPP_NAMESPACE
 
 namespace zipios
@@ -92,28 +87,14 @@ private:
         std::string path;
         Base::Matrix4D transform;
     };
-    static std::unique_ptr<XERCES_CPP_NAMESPACE::XercesDOMParser> makeDomParser();
+    class ModelHandler;
+    static std::unique_ptr<XERCES_CPP_NAMESPACE::SAX2XMLReader> makeParser();
     bool TryLoad();
     bool LoadModel(std::istream&);
     bool LoadModel(std::istream&, const Component&);
     bool TryLoadModel(std::istream&, const Component&);
-    bool LoadModel(XERCES_CPP_NAMESPACE::DOMDocument&, const Component&);
-    bool LoadResourcesAndBuild(XERCES_CPP_NAMESPACE::DOMElement*, const Component&);
-    bool LoadResources(XERCES_CPP_NAMESPACE::DOMNodeList*, const Component&);
-    bool LoadBuild(XERCES_CPP_NAMESPACE::DOMNodeList*);
-    bool LoadItems(XERCES_CPP_NAMESPACE::DOMNodeList*);
-    void LoadItem(XERCES_CPP_NAMESPACE::DOMNamedNodeMap*);
-    bool LoadObject(XERCES_CPP_NAMESPACE::DOMNodeList*, const Component&);
-    void LoadComponents(XERCES_CPP_NAMESPACE::DOMNodeList*, int id);
-    void LoadComponent(XERCES_CPP_NAMESPACE::DOMNodeList*, int id);
-    void LoadComponent(XERCES_CPP_NAMESPACE::DOMNamedNodeMap*, int id);
-    void LoadMesh(XERCES_CPP_NAMESPACE::DOMNodeList*, int id, const Component&);
-    void LoadVertices(XERCES_CPP_NAMESPACE::DOMNodeList*, MeshPointArray&);
-    void ReadVertices(XERCES_CPP_NAMESPACE::DOMNodeList*, MeshPointArray&);
-    void LoadTriangles(XERCES_CPP_NAMESPACE::DOMNodeList*, MeshFacetArray&);
-    void ReadTriangles(XERCES_CPP_NAMESPACE::DOMNodeList*, MeshFacetArray&);
     bool LoadMeshFromComponents();
-    std::optional<Base::Matrix4D> ReadTransform(XERCES_CPP_NAMESPACE::DOMNode*);
+    static std::optional<Base::Matrix4D> ReadTransform(const std::string&);
 
 private:
     std::vector<Component> components;
@@ -0,0 +1,526 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <array>
+#include <cstring>
+#include <list>
+#endif
+
+#include <QByteArray>
+#include <QFile>
+#include <QUrl>
+
+#include "json.hpp"
+
+#include "Core/Builder.h"
+#include "Core/MeshKernel.h"
+#include <Base/Console.h>
+#include <Base/FileInfo.h>
+#include <Base/Matrix.h>
+#include <Base/Rotation.h>
+
+#include "ReaderGLTF.h"
+
+
+using namespace MeshCore;
+
+// https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html
+namespace
+{
+constexpr uint32_t glbMagic = 0x46546C67;      // "glTF"
+constexpr uint32_t glbChunkJson = 0x4E4F534A;  // "JSON"
+constexpr uint32_t glbChunkBin = 0x004E4942;   // "BIN\0"
+constexpr std::size_t glbHeaderSize = 12;
+constexpr std::size_t glbChunkHeaderSize = 8;
+
+constexpr int componentUnsignedByte = 5121;
+constexpr int componentUnsignedShort = 5123;
+constexpr int componentUnsignedInt = 5125;
+constexpr int componentFloat = 5126;
+
+constexpr int modeTriangles = 4;
+constexpr int modeTriangleStrip = 5;
+constexpr int modeTriangleFan = 6;
+
+/// A read-only view on the data of a file or buffer
+struct ByteView
+{
+    const unsigned char* data = nullptr;
+    std::size_t size = 0;
+};
+
+uint32_t readUInt32(const unsigned char* data)
+{
+    uint32_t value {};
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+std::size_t componentSize(int componentType)
+{
+    switch (componentType) {
+        case componentUnsignedByte:
+            return 1;
+        case componentUnsignedShort:
+            return 2;
+        case componentUnsignedInt:
+        case componentFloat:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+/// Element access to an accessor, honoring the byte stride of its buffer view
+struct AccessorView
+{
+    const unsigned char* data = nullptr;
+    std::size_t count = 0;
+    std::size_t stride = 0;
+    int componentType = 0;
+
+    Base::Vector3f point(std::size_t index) const
+    {
+        std::array<float, 3> xyz {};
+        std::memcpy(xyz.data(), data + index * stride, sizeof(xyz));
+        return {xyz[0], xyz[1], xyz[2]};
+    }
+
+    std::size_t index(std::size_t index) const
+    {
+        const unsigned char* ptr = data + index * stride;
+        switch (componentType) {
+            case componentUnsignedByte:
+                return *ptr;
+            case componentUnsignedShort: {
+                uint16_t value {};
+                std::memcpy(&value, ptr, sizeof(value));
+                return value;
+            }
+            default:
+                return readUInt32(ptr);
+        }
+    }
+};
+
+struct Primitive
+{
+    AccessorView positions;
+    AccessorView indices;
+    bool indexed = false;
+    int mode = modeTriangles;
+    Base::Matrix4D transform;
+
+    std::size_t countVertices() const
+    {
+        return indexed ? indices.count : positions.count;
+    }
+
+    std::size_t countTriangles() const
+    {
+        std::size_t count = countVertices();
+        if (mode == modeTriangles) {
+            return count / 3;
+        }
+        return count > 2 ? count - 2 : 0;
+    }
+
+    /// Returns false if the triangle is degenerated or refers to a missing point
+    bool triangle(std::size_t index, std::array<Base::Vector3f, 3>& points) const
+    {
+        std::array<std::size_t, 3> vertices {};
+        switch (mode) {
+            case modeTriangleStrip:
+                // Every second triangle of a strip is reversed to keep the orientation
+                vertices = {index, index + 1, index + 2};
+                if (index % 2 != 0) {
+                    std::swap(vertices[0], vertices[1]);
+                }
+                break;
+            case modeTriangleFan:
+                vertices = {0, index + 1, index + 2};
+                break;
+            default:
+                vertices = {3 * index, 3 * index + 1, 3 * index + 2};
+                break;
+        }
+        if (indexed) {
+            for (auto& vertex : vertices) {
+                vertex = indices.index(vertex);
+            }
+        }
+        if (vertices[0] == vertices[1] || vertices[1] == vertices[2]
+            || vertices[0] == vertices[2]) {
+            return false;
+        }
+        for (std::size_t i = 0; i < 3; i++) {
+            if (vertices[i] >= positions.count) {
+                return false;
+            }
+            points[i] = transform * positions.point(vertices[i]);
+        }
+        return true;
+    }
+};
+}  // namespace
+
+struct ReaderGLTF::Private
+{
+    std::string dirPath;
+    nlohmann::json doc;
+    ByteView binChunk;
+    std::vector<ByteView> buffers;
+    std::vector<Primitive> primitives;
+    // Keeps the mapped files open and owns the data of buffers that cannot be mapped
+    std::list<QFile> files;
+    std::list<QByteArray> ownedData;
+
+    bool mapFile(const std::string& path, ByteView& view)
+    {
+        QFile& file = files.emplace_back(QString::fromStdString(path));
+        if (!file.open(QIODevice::ReadOnly)) {
+            return false;
+        }
+        view.size = static_cast<std::size_t>(file.size());
+        view.data = view.size > 0 ? file.map(0, file.size()) : nullptr;
+        if (!view.data) {
+            // Not every file can be mapped, so fall back to reading it
+            const QByteArray& data = ownedData.emplace_back(file.readAll());
+            view.data = reinterpret_cast<const unsigned char*>(data.constData());
+            view.size = static_cast<std::size_t>(data.size());
+        }
+        return true;
+    }
+
+    bool parseBinary(const ByteView& file, ByteView& json)
+    {
+        if (file.size < glbHeaderSize + glbChunkHeaderSize) {
+            return false;
+        }
+        uint32_t version = readUInt32(file.data + 4);
+        std::size_t length = readUInt32(file.data + 8);
+        if (version != 2 || length > file.size) {
+            return false;
+        }
+
+        std::size_t offset = glbHeaderSize;
+        std::size_t chunkLength = readUInt32(file.data + offset);
+        if (readUInt32(file.data + offset + 4) != glbChunkJson
+            || offset + glbChunkHeaderSize + chunkLength > length) {
+            return false;
+        }
+        json.data = file.data + offset + glbChunkHeaderSize;
+        json.size = chunkLength;
+
+        offset += glbChunkHeaderSize + chunkLength;
+        if (offset + glbChunkHeaderSize <= length) {
+            chunkLength = readUInt32(file.data + offset);
+            if (readUInt32(file.data + offset + 4) == glbChunkBin
+                && offset + glbChunkHeaderSize + chunkLength <= length) {
+                binChunk.data = file.data + offset + glbChunkHeaderSize;
+                binChunk.size = chunkLength;
+            }
+        }
+        return true;
+    }
+
+    bool loadBuffers()
+    {
+        for (const auto& buffer : doc.value("buffers", nlohmann::json::array())) {
+            auto length = buffer.at("byteLength").get<std::size_t>();
+            ByteView view;
+            if (!buffer.contains("uri")) {
+                // Only the first buffer may refer to the binary chunk of a GLB file
+                if (!buffers.empty()) {
+                    return false;
+                }
+                view = binChunk;
+            }
+            else {
+                auto uri = buffer.at("uri").get<std::string>();
+                if (uri.compare(0, 5, "data:") == 0) {
+                    auto pos = uri.find(',');
+                    if (pos == std::string::npos) {
+                        return false;
+                    }
+                    const QByteArray& data = ownedData.emplace_back(
+                        QByteArray::fromBase64(QByteArray(uri.c_str() + pos + 1)));
+                    view.data = reinterpret_cast<const unsigned char*>(data.constData());
+                    view.size = static_cast<std::size_t>(data.size());
+                }
+                else {
+                    auto name = QUrl::fromPercentEncoding(QByteArray(uri.c_str())).toStdString();
+                    if (!mapFile(dirPath + "/" + name, view)) {
+                        Base::Console().Error("Cannot open glTF buffer '%s'\n", name.c_str());
+                        return false;
+                    }
+                }
+            }
+            if (view.size < length) {
+                return false;
+            }
+            buffers.push_back(view);
+        }
+        return true;
+    }
+
+    bool accessor(std::size_t index, bool isIndex, AccessorView& view) const
+    {
+        const auto& acc = doc.at("accessors").at(index);
+        if (acc.contains("sparse") || !acc.contains("bufferView")) {
+            return false;
+        }
+        auto componentType = acc.at("componentType").get<int>();
+        auto type = acc.at("type").get<std::string>();
+        if (isIndex) {
+            if (type != "SCALAR" || componentType == componentFloat
+                || componentSize(componentType) == 0) {
+                return false;
+            }
+        }
+        else if (type != "VEC3" || componentType != componentFloat
+                 || acc.value("normalized", false)) {
+            return false;
+        }
+
+        const auto& bufferView = doc.at("bufferViews").at(acc.at("bufferView").get<std::size_t>());
+        if (bufferView.contains("extensions")) {
+            // e.g. EXT_meshopt_compression
+            return false;
+        }
+        auto buffer = bufferView.at("buffer").get<std::size_t>();
+        if (buffer >= buffers.size()) {
+            return false;
+        }
+        std::size_t elementSize = componentSize(componentType) * (isIndex ? 1 : 3);
+        auto stride = bufferView.value("byteStride", elementSize);
+        auto viewOffset = bufferView.value("byteOffset", std::size_t(0));
+        auto viewLength = bufferView.at("byteLength").get<std::size_t>();
+        auto offset = acc.value("byteOffset", std::size_t(0));
+        auto count = acc.at("count").get<std::size_t>();
+        if (stride < elementSize || viewOffset + viewLength > buffers[buffer].size) {
+            return false;
+        }
+        if (count > 0 && offset + stride * (count - 1) + elementSize > viewLength) {
+            return false;
+        }
+
+        view.data = buffers[buffer].data + viewOffset + offset;
+        view.count = count;
+        view.stride = stride;
+        view.componentType = componentType;
+        return true;
+    }
+
+    static Base::Matrix4D nodeTransform(const nlohmann::json& node)
+    {
+        Base::Matrix4D mat;
+        if (node.contains("matrix")) {
+            auto values = node.at("matrix").get<std::vector<double>>();
+            if (values.size() == 16) {
+                // glTF matrices are stored column by column
+                for (unsigned short row = 0; row < 4; row++) {
+                    for (unsigned short col = 0; col < 4; col++) {
+                        mat[row][col] = values[col * 4 + row];
+                    }
+                }
+            }
+            return mat;
+        }
+        if (node.contains("scale")) {
+            auto s = node.at("scale").get<std::array<double, 3>>();
+            mat.scale(Base::Vector3d(s[0], s[1], s[2]));
+        }
+        if (node.contains("rotation")) {
+            auto q = node.at("rotation").get<std::array<double, 4>>();
+            Base::Matrix4D rot;
+            Base::Rotation(q[0], q[1], q[2], q[3]).getValue(rot);
+            mat = rot * mat;
+        }
+        if (node.contains("translation")) {
+            auto t = node.at("translation").get<std::array<double, 3>>();
+            mat.move(Base::Vector3d(t[0], t[1], t[2]));
+        }
+        return mat;
+    }
+
+    void collectMesh(std::size_t index, const Base::Matrix4D& transform)
+    {
+        const auto& mesh = doc.at("meshes").at(index);
+        for (const auto& prim : mesh.value("primitives", nlohmann::json::array())) {
+            Primitive primitive;
+            primitive.mode = prim.value("mode", modeTriangles);
+            primitive.transform = transform;
+            if (primitive.mode != modeTriangles && primitive.mode != modeTriangleStrip
+                && primitive.mode != modeTriangleFan) {
+                continue;
+            }
+            const auto& attributes = prim.at("attributes");
+            if (prim.contains("extensions") || !attributes.contains("POSITION")
+                || !accessor(attributes.at("POSITION").get<std::size_t>(),
+                             false,
+                             primitive.positions)) {
+                Base::Console().Warning("Skip unsupported glTF primitive of mesh %d\n",
+                                        static_cast<int>(index));
+                continue;
+            }
+            if (prim.contains("indices")) {
+                primitive.indexed = true;
+                if (!accessor(prim.at("indices").get<std::size_t>(), true, primitive.indices)) {
+                    Base::Console().Warning("Skip unsupported glTF primitive of mesh %d\n",
+                                            static_cast<int>(index));
+                    continue;
+                }
+            }
+            primitives.push_back(primitive);
+        }
+    }
+
+    void collectNode(std::size_t index, const Base::Matrix4D& parent, std::size_t depth)
+    {
+        const auto& nodes = doc.at("nodes");
+        if (depth > nodes.size()) {
+            // The node hierarchy must be a tree, so this is a cycle
+            return;
+        }
+        const auto& node = nodes.at(index);
+        Base::Matrix4D transform = parent * nodeTransform(node);
+        if (node.contains("mesh")) {
+            collectMesh(node.at("mesh").get<std::size_t>(), transform);
+        }
+        for (const auto& child : node.value("children", nlohmann::json::array())) {
+            collectNode(child.get<std::size_t>(), transform, depth + 1);
+        }
+    }
+
+    void collectScene(const Base::Matrix4D& transform)
+    {
+        std::vector<std::size_t> roots;
+        if (doc.contains("scenes") && !doc.at("scenes").empty()) {
+            const auto& scene = doc.at("scenes").at(doc.value("scene", std::size_t(0)));
+            for (const auto& node : scene.value("nodes", nlohmann::json::array())) {
+                roots.push_back(node.get<std::size_t>());
+            }
+        }
+        else if (doc.contains("nodes")) {
+            // Without a scene take all nodes that are not a child of another node
+            const auto& nodes = doc.at("nodes");
+            std::vector<bool> isChild(nodes.size(), false);
+            for (const auto& node : nodes) {
+                for (const auto& child : node.value("children", nlohmann::json::array())) {
+                    auto childIndex = child.get<std::size_t>();
+                    if (childIndex < isChild.size()) {
+                        isChild[childIndex] = true;
+                    }
+                }
+            }
+            for (std::size_t i = 0; i < nodes.size(); i++) {
+                if (!isChild[i]) {
+                    roots.push_back(i);
+                }
+            }
+        }
+        else {
+            // Neither scenes nor nodes, so take the meshes as they are
+            for (std::size_t i = 0; i < doc.value("meshes", nlohmann::json::array()).size(); i++) {
+                collectMesh(i, transform);
+            }
+        }
+
+        for (auto root : roots) {
+            collectNode(root, transform, 0);
+        }
+    }
+};
+
+ReaderGLTF::ReaderGLTF(MeshKernel& kernel)
+    : _kernel(kernel)
+{}
+
+ReaderGLTF::~ReaderGLTF() = default;
+
+bool ReaderGLTF::Load(const std::string& filename)
+{
+    d = std::make_unique<Private>();
+    d->dirPath = Base::FileInfo(filename).dirPath();
+
+    ByteView file;
+    if (!d->mapFile(filename, file) || file.size < 4) {
+        return false;
+    }
+
+    ByteView json = file;
+    if (readUInt32(file.data) == glbMagic && !d->parseBinary(file, json)) {
+        return false;
+    }
+
+    try {
+        const auto* begin = reinterpret_cast<const char*>(json.data);
+        d->doc = nlohmann::json::parse(begin, begin + json.size);
+        auto version = d->doc.at("asset").at("version").get<std::string>();
+        if (version.empty() || version[0] != '2') {
+            Base::Console().Error("Unsupported glTF version %s\n", version.c_str());
+            return false;
+        }
+        if (!d->loadBuffers()) {
+            return false;
+        }
+
+        // glTF is Y-up and uses meters, FreeCAD is Z-up and uses millimeters
+        const double scale = 1000.0;
+        Base::Matrix4D toFreeCAD(scale, 0, 0, 0,
+                                 0, 0, -scale, 0,
+                                 0, scale, 0, 0,
+                                 0, 0, 0, 1);
+        d->collectScene(toFreeCAD);
+    }
+    catch (const nlohmann::json::exception& e) {
+        Base::Console().Error("Invalid glTF file: %s\n", e.what());
+        return false;
+    }
+
+    std::size_t numTriangles = 0;
+    for (const auto& primitive : d->primitives) {
+        numTriangles += primitive.countTriangles();
+    }
+
+    _kernel.Clear();
+    MeshFastBuilder builder(_kernel);
+    builder.Initialize(static_cast<MeshFastBuilder::size_type>(numTriangles));
+    std::array<Base::Vector3f, 3> points;
+    for (const auto& primitive : d->primitives) {
+        std::size_t count = primitive.countTriangles();
+        for (std::size_t i = 0; i < count; i++) {
+            if (primitive.triangle(i, points)) {
+                builder.AddFacet(points.data());
+            }
+        }
+    }
+    builder.Finish();
+
+    // Release the mapped files
+    d.reset();
+    return true;
+}
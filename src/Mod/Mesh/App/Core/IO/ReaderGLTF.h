@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef MESH_IO_READER_GLTF_H
+#define MESH_IO_READER_GLTF_H
+
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/MeshGlobal.h>
+#include <memory>
+#include <string>
+
+namespace MeshCore
+{
+
+/** Loads the mesh object from data in glTF 2.0 format (.gltf or .glb).
+ *
+ * The triangles of all mesh primitives of the default scene are read straight
+ * from the binary buffers, which are memory mapped where possible, and merged
+ * into a single mesh. Points are converted from the Y-up meter based glTF
+ * coordinate system to Z-up millimeters. Compressed or quantized primitives
+ * are not supported and are skipped.
+ */
+class MeshExport ReaderGLTF
+{
+public:
+    explicit ReaderGLTF(MeshKernel& kernel);
+    ~ReaderGLTF();
+
+    ReaderGLTF(const ReaderGLTF&) = delete;
+    ReaderGLTF(ReaderGLTF&&) = delete;
+    ReaderGLTF& operator=(const ReaderGLTF&) = delete;
+    ReaderGLTF& operator=(ReaderGLTF&&) = delete;
+
+    /*!
+     * \brief Load the mesh from the file. External buffers are looked up
+     * relative to the directory of the file.
+     * \return true on success and false otherwise
+     */
+    bool Load(const std::string& filename);
+
+private:
+    MeshKernel& _kernel;
+    struct Private;
+    std::unique_ptr<Private> d;
+};
+
+}  // namespace MeshCore
+
+
+#endif  // MESH_IO_READER_GLTF_H
@@ -23,13 +23,16 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <boost/lexical_cast.hpp>
+#include <cstdint>
+#include <cstring>
 #include <istream>
+#include <limits>
 #endif
 
 #include "Core/MeshIO.h"
 #include "Core/MeshKernel.h"
-#include <Base/Stream.h>
 #include <Base/Tools.h>
 
 #include "ReaderPLY.h"
@@ -37,6 +40,112 @@
 
 using namespace MeshCore;
 
+namespace
+{
+
+inline uint16_t byteSwap(uint16_t value)
+{
+    return uint16_t((value >> 8) | (value << 8));
+}
+
+inline uint32_t byteSwap(uint32_t value)
+{
+    return ((value & 0x000000ffU) << 24) | ((value & 0x0000ff00U) << 8)
+        | ((value & 0x00ff0000U) >> 8) | ((value & 0xff000000U) >> 24);
+}
+
+inline uint64_t byteSwap(uint64_t value)
+{
+    return (uint64_t(byteSwap(uint32_t(value))) << 32) | byteSwap(uint32_t(value >> 32));
+}
+
+// Swaps the byte order of \a count values of type T that are \a stride bytes apart.
+// With stride == sizeof(T) the compiler turns the loop into vector shuffles.
+template<typename T>
+void swapValues(char* data, std::size_t count, std::size_t stride)
+{
+    for (std::size_t i = 0; i < count; i++) {
+        T value {};
+        std::memcpy(&value, data + i * stride, sizeof(T));
+        value = byteSwap(value);
+        std::memcpy(data + i * stride, &value, sizeof(T));
+    }
+}
+
+void swapValues(char* data, std::size_t count, std::size_t stride, std::size_t size)
+{
+    switch (size) {
+        case 2:
+            swapValues<uint16_t>(data, count, stride);
+            break;
+        case 4:
+            swapValues<uint32_t>(data, count, stride);
+            break;
+        case 8:
+            swapValues<uint64_t>(data, count, stride);
+            break;
+        default:
+            break;
+    }
+}
+
+template<typename T>
+inline T readValue(const char* data)
+{
+    T value {};
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+/*!
+ * Reads a binary stream in large blocks instead of value by value.
+ * Not more than \a limit bytes are taken from the stream.
+ */
+class BlockReader
+{
+public:
+    BlockReader(std::istream& str, std::size_t limit)
+        : input(str)
+        , remaining(limit)
+    {}
+    /// Returns the next \a size bytes or null if the stream ends before.
+    char* Next(std::size_t size)
+    {
+        if (end - pos < size && !Fill(size)) {
+            return nullptr;
+        }
+        char* data = buffer.data() + pos;
+        pos += size;
+        return data;
+    }
+
+private:
+    bool Fill(std::size_t size)
+    {
+        constexpr std::size_t blockSize = 1 << 20;
+        std::size_t rest = end - pos;
+        std::memmove(buffer.data(), buffer.data() + pos, rest);
+        pos = 0;
+        end = rest;
+        buffer.resize(std::max(blockSize, size));
+        std::size_t num = std::min(buffer.size() - end, remaining);
+        input.read(buffer.data() + end, static_cast<std::streamsize>(num));
+        std::size_t read = static_cast<std::size_t>(input.gcount());
+        end += read;
+        remaining -= read;
+        return end >= size;
+    }
+
+private:
+    std::istream& input;
+    std::vector<char> buffer;
+    std::size_t remaining;
+    std::size_t pos = 0;
+    std::size_t end = 0;
+};
+
+}  // namespace
+
 // http://local.wasp.uwa.edu.au/~pbourke/dataformats/ply/
 ReaderPLY::ReaderPLY(MeshKernel& kernel, Material* material)
     : _kernel(kernel)
@@ -154,14 +263,8 @@ ReaderPLY::Property ReaderPLY::propertyOfName(const std::string& name)
     return generic;
 }
 
-bool ReaderPLY::ReadVertexProperty(std::istream& str)
+bool ReaderPLY::numberOfType(const std::string& type, Number& number)
 {
-    std::string type;
-    std::string name;
-    char space {};
-    str >> space >> std::ws >> type >> space >> std::ws >> name >> std::ws;
-
-    Number number {};
     if (type == "char" || type == "int8") {
         number = int8;
     }
@@ -191,6 +294,41 @@ bool ReaderPLY::ReadVertexProperty(std::istream& str)
         return false;
     }
 
+    return true;
+}
+
+std::size_t ReaderPLY::sizeOfNumber(Number number)
+{
+    switch (number) {
+        case int8:
+        case uint8:
+            return 1;
+        case int16:
+        case uint16:
+            return 2;
+        case int32:
+        case uint32:
+        case float32:
+            return 4;
+        case float64:
+            return 8;
+    }
+
+    return 0;
+}
+
+bool ReaderPLY::ReadVertexProperty(std::istream& str)
+{
+    std::string type;
+    std::string name;
+    char space {};
+    str >> space >> std::ws >> type >> space >> std::ws >> name >> std::ws;
+
+    Number number {};
+    if (!numberOfType(type, number)) {
+        return false;
+    }
+
     // store the property name and type
     vertex_props.emplace_back(propertyOfName(name), number);
 
@@ -217,38 +355,23 @@ bool ReaderPLY::ReadFaceProperty(std::istream& str)
     }
     if (name != "vertex_indices" && name != "vertex_index") {
         Number number {};
-        if (type == "char" || type == "int8") {
-            number = int8;
-        }
-        else if (type == "uchar" || type == "uint8") {
-            number = uint8;
-        }
-        else if (type == "short" || type == "int16") {
-            number = int16;
-        }
-        else if (type == "ushort" || type == "uint16") {
-            number = uint16;
-        }
-        else if (type == "int" || type == "int32") {
-            number = int32;
-        }
-        else if (type == "uint" || type == "uint32") {
-            number = uint32;
-        }
-        else if (type == "float" || type == "float32") {
-            number = float32;
-        }
-        else if (type == "double" || type == "float64") {
-            number = float64;
-        }
-        else {
-            // no valid number type
+        if (!numberOfType(type, number)) {
             return false;
         }
 
         // store the property name and type
         face_props.push_back(number);
     }
+    else if (list == "list") {
+        // the count must be an integer, keep the default types for anything else
+        Number count {};
+        Number index {};
+        if (numberOfType(uchr, count) && numberOfType(type, index) && count != float32
+            && count != float64 && index != float32 && index != float64) {
+            face_list_count = count;
+            face_list_index = index;
+        }
+    }
     return true;
 }
 
@@ -518,122 +641,136 @@ void ReaderPLY::addVertexProperty(const PropertyArray& prop)
     }
 }
 
-bool ReaderPLY::ReadVertexes(Base::InputStream& is)
+bool ReaderPLY::ReadBinaryVertexes(std::istream& input)
 {
-    for (std::size_t i = 0; i < v_count; i++) {
-        // go through the vertex properties
-        PropertyArray prop_values {};
-        for (const auto& it : vertex_props) {
-            switch (it.second) {
-                case int8: {
-                    int8_t vt {};
-                    is >> vt;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case uint8: {
-                    uint8_t vt {};
-                    is >> vt;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case int16: {
-                    int16_t vt {};
-                    is >> vt;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case uint16: {
-                    uint16_t vt {};
-                    is >> vt;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case int32: {
-                    int32_t vt {};
-                    is >> vt;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case uint32: {
-                    uint32_t vt {};
-                    is >> vt;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                case float32: {
-                    float vt {};
-                    is >> vt;
-                    prop_values[it.first] = vt;
-                } break;
-                case float64: {
-                    double vt {};
-                    is >> vt;
-                    prop_values[it.first] = static_cast<float>(vt);
-                } break;
-                default:
-                    return false;
+    // offsets of the properties inside of a vertex record
+    std::vector<std::size_t> offsets;
+    std::size_t recordSize = 0;
+    bool allFourBytes = true;
+    for (const auto& it : vertex_props) {
+        std::size_t size = sizeOfNumber(it.second);
+        offsets.push_back(recordSize);
+        recordSize += size;
+        allFourBytes = allFourBytes && size == 4;
+    }
+
+    // the common layout of float coordinates optionally followed by byte colors
+    bool packed = (vertex_props.size() == 3 || vertex_props.size() == 6);
+    for (std::size_t i = 0; i < vertex_props.size() && packed; i++) {
+        Number number = i < 3 ? float32 : uint8;
+        packed = (vertex_props[i].first == static_cast<Property>(i)
+                  && vertex_props[i].second == number);
+    }
+
+    bool swap = (format == binary_big_endian);
+    bool colors = (_material && _material->binding == MeshIO::PER_VERTEX);
+    constexpr std::size_t blockSize = 65536;
+    BlockReader reader(input, v_count * recordSize);
+    for (std::size_t start = 0; start < v_count; start += blockSize) {
+        std::size_t count = std::min(blockSize, v_count - start);
+        char* data = reader.Next(count * recordSize);
+        if (!data) {
+            return false;
+        }
+
+        if (swap) {
+            if (allFourBytes) {
+                swapValues<uint32_t>(data, count * recordSize / 4, 4);
+            }
+            else {
+                for (std::size_t j = 0; j < vertex_props.size(); j++) {
+                    std::size_t size = sizeOfNumber(vertex_props[j].second);
+                    swapValues(data + offsets[j], count, recordSize, size);
+                }
             }
         }
 
-        addVertexProperty(prop_values);
+        if (packed) {
+            for (std::size_t i = 0; i < count; i++) {
+                const char* record = data + i * recordSize;
+                meshPoints.push_back(Base::Vector3f(readValue<float>(record),
+                                                    readValue<float>(record + 4),
+                                                    readValue<float>(record + 8)));
+                if (colors) {
+                    float r {}, g {}, b {};
+                    if (recordSize > 12) {
+                        // NOLINTBEGIN
+                        r = float(readValue<uint8_t>(record + 12)) / 255.0F;
+                        g = float(readValue<uint8_t>(record + 13)) / 255.0F;
+                        b = float(readValue<uint8_t>(record + 14)) / 255.0F;
+                        // NOLINTEND
+                    }
+                    _material->diffuseColor.emplace_back(r, g, b);
+                }
+            }
+        }
+        else {
+            for (std::size_t i = 0; i < count; i++) {
+                const char* record = data + i * recordSize;
+                PropertyArray prop_values {};
+                for (std::size_t j = 0; j < vertex_props.size(); j++) {
+                    prop_values[vertex_props[j].first] =
+                        toFloat(record + offsets[j], vertex_props[j].second);
+                }
+                addVertexProperty(prop_values);
+            }
+        }
     }
 
     return true;
 }
 
-bool ReaderPLY::ReadFaces(Base::InputStream& is)
+bool ReaderPLY::ReadBinaryFaces(std::istream& input)
 {
-    unsigned char num {};
-    uint32_t f1 {};
-    uint32_t f2 {};
-    uint32_t f3 {};
+    bool swap = (format == binary_big_endian);
+    std::size_t countSize = sizeOfNumber(face_list_count);
+    std::size_t indexSize = sizeOfNumber(face_list_index);
+    BlockReader reader(input, std::numeric_limits<std::size_t>::max());
     for (std::size_t i = 0; i < f_count; i++) {
-        is >> num;
+        char* data = reader.Next(countSize);
+        if (!data) {
+            return false;
+        }
+        if (swap) {
+            swapValues(data, 1, countSize, countSize);
+        }
+        int64_t num = toInteger(data, face_list_count);
+        if (num < 0) {
+            return false;
+        }
+
+        data = reader.Next(std::size_t(num) * indexSize);
+        if (!data) {
+            return false;
+        }
+        if (swap) {
+            swapValues(data, std::size_t(num), indexSize, indexSize);
+        }
         if (num == 3) {
-            is >> f1 >> f2 >> f3;
-            if (f1 < v_count && f2 < v_count && f3 < v_count) {
-                meshFacets.push_back(MeshFacet(f1, f2, f3));
+            int64_t f1 = toInteger(data, face_list_index);
+            int64_t f2 = toInteger(data + indexSize, face_list_index);
+            int64_t f3 = toInteger(data + 2 * indexSize, face_list_index);
+            auto valid = [this](int64_t index) {
+                return index >= 0 && std::size_t(index) < v_count;
+            };
+            if (valid(f1) && valid(f2) && valid(f3)) {
+                meshFacets.push_back(MeshFacet(PointIndex(f1), PointIndex(f2), PointIndex(f3)));
             }
-            for (auto it : face_props) {
-                switch (it) {
-                    case int8: {
-                        int8_t vt {};
-                        is >> vt;
-                    } break;
-                    case uint8: {
-                        uint8_t vt {};
-                        is >> vt;
-                    } break;
-                    case int16: {
-                        int16_t vt {};
-                        is >> vt;
-                    } break;
-                    case uint16: {
-                        uint16_t vt {};
-                        is >> vt;
-                    } break;
-                    case int32: {
-                        int32_t vt {};
-                        is >> vt;
-                    } break;
-                    case uint32: {
-                        uint32_t vt {};
-                        is >> vt;
-                    } break;
-                    case float32: {
-                        unsigned char cnt {};
-                        is >> cnt;
-                        float vt {};
-                        for (unsigned char j = 0; j < cnt; j++) {
-                            is >> vt;
-                        }
-                    } break;
-                    case float64: {
-                        unsigned char cnt {};
-                        is >> cnt;
-                        double vt {};
-                        for (unsigned char j = 0; j < cnt; j++) {
-                            is >> vt;
-                        }
-                    } break;
-                    default:
-                        return false;
+        }
+
+        // skip the other properties
+        for (auto it : face_props) {
+            std::size_t size = sizeOfNumber(it);
+            std::size_t cnt = 1;
+            if (it == float32 || it == float64) {
+                const char* list = reader.Next(1);
+                if (!list) {
+                    return false;
                 }
+                cnt = readValue<uint8_t>(list);
+            }
+            if (!reader.Next(cnt * size)) {
+                return false;
             }
         }
     }
@@ -641,21 +778,61 @@ bool ReaderPLY::ReadFaces(Base::InputStream& is)
     return true;
 }
 
-bool ReaderPLY::LoadBinary(std::istream& input)
+float ReaderPLY::toFloat(const char* data, Number number)
 {
-    Base::InputStream is(input);
-    if (format == binary_little_endian) {
-        is.setByteOrder(Base::Stream::LittleEndian);
-    }
-    else {
-        is.setByteOrder(Base::Stream::BigEndian);
-    }
+    switch (number) {
+        case int8:
+            return static_cast<float>(readValue<int8_t>(data));
+        case uint8:
+            return static_cast<float>(readValue<uint8_t>(data));
+        case int16:
+            return static_cast<float>(readValue<int16_t>(data));
+        case uint16:
+            return static_cast<float>(readValue<uint16_t>(data));
+        case int32:
+            return static_cast<float>(readValue<int32_t>(data));
+        case uint32:
+            return static_cast<float>(readValue<uint32_t>(data));
+        case float32:
+            return readValue<float>(data);
+        case float64:
+            return static_cast<float>(readValue<double>(data));
+    }
+
+    return 0.0F;
+}
 
-    if (!ReadVertexes(is)) {
+int64_t ReaderPLY::toInteger(const char* data, Number number)
+{
+    switch (number) {
+        case int8:
+            return readValue<int8_t>(data);
+        case uint8:
+            return readValue<uint8_t>(data);
+        case int16:
+            return readValue<int16_t>(data);
+        case uint16:
+            return readValue<uint16_t>(data);
+        case int32:
+            return readValue<int32_t>(data);
+        case uint32:
+            return readValue<uint32_t>(data);
+        case float32:
+            return static_cast<int64_t>(readValue<float>(data));
+        case float64:
+            return static_cast<int64_t>(readValue<double>(data));
+    }
+
+    return 0;
+}
+
+bool ReaderPLY::LoadBinary(std::istream& input)
+{
+    if (!ReadBinaryVertexes(input)) {
         return false;
     }
 
-    if (!ReadFaces(is)) {
+    if (!ReadBinaryFaces(input)) {
         return false;
     }
 
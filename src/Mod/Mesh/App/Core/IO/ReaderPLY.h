@@ -27,13 +27,9 @@
 
 #include <Mod/Mesh/App/Core/MeshKernel.h>
 #include <Mod/Mesh/MeshGlobal.h>
+#include <cstdint>
 #include <iosfwd>
 
-namespace Base
-{
-class InputStream;
-}
-
 namespace MeshCore
 {
 
@@ -66,8 +62,8 @@ private:
     bool ReadFaceProperty(std::istream& str);
     bool ReadVertexes(std::istream& input);
     bool ReadFaces(std::istream& input);
-    bool ReadVertexes(Base::InputStream& is);
-    bool ReadFaces(Base::InputStream& is);
+    bool ReadBinaryVertexes(std::istream& input);
+    bool ReadBinaryFaces(std::istream& input);
     bool LoadAscii(std::istream& input);
     bool LoadBinary(std::istream& input);
     void CleanupMesh();
@@ -101,6 +97,11 @@ private:
         float64
     };
 
+    static bool numberOfType(const std::string& type, Number& number);
+    static std::size_t sizeOfNumber(Number number);
+    static float toFloat(const char* data, Number number);
+    static int64_t toInteger(const char* data, Number number);
+
     struct PropertyComp
     {
         using argument_type_1st = std::pair<Property, int>;
@@ -126,6 +127,9 @@ private:
 
     std::vector<std::pair<Property, Number>> vertex_props;
     std::vector<Number> face_props;
+    /// types of the count and the indices of the vertex index list
+    Number face_list_count = uint8;
+    Number face_list_index = int32;
 
     std::size_t v_count = 0;
     std::size_t f_count = 0;
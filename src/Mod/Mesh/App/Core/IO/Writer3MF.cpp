@@ -22,6 +22,9 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <array>
+#include <charconv>
+#include <cstdio>
 #include <ostream>
 #include <sstream>
 #endif
@@ -35,6 +38,60 @@
 
 using namespace MeshCore;
 
+namespace
+{
+
+/*!
+ * Formats the vertex and triangle records of an object into a buffer that is
+ * written to the zip entry whenever it exceeds the chunk size. The numbers are
+ * formatted as with the default settings of a stream in the classic locale.
+ */
+class ChunkWriter
+{
+public:
+    explicit ChunkWriter(std::ostream& str)
+        : out(str)
+    {
+        buffer.reserve(chunkSize + recordSize);
+    }
+    template<std::size_t N>
+    void Append(const char (&text)[N])
+    {
+        buffer.append(text, N - 1);
+    }
+    void Append(float value)
+    {
+        std::array<char, 32> num {};
+        int len = std::snprintf(num.data(), num.size(), "%g", static_cast<double>(value));
+        buffer.append(num.data(), static_cast<std::size_t>(len));
+    }
+    void Append(PointIndex value)
+    {
+        std::array<char, 24> num {};
+        auto res = std::to_chars(num.data(), num.data() + num.size(), value);
+        buffer.append(num.data(), res.ptr);
+    }
+    /// Must be called after each record
+    bool EndRecord()
+    {
+        return buffer.size() < chunkSize || Flush();
+    }
+    bool Flush()
+    {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+        return out.good();
+    }
+
+private:
+    static constexpr std::size_t chunkSize = 65536;
+    static constexpr std::size_t recordSize = 256;
+    std::ostream& out;
+    std::string buffer;
+};
+
+}  // namespace
+
 Writer3MF::Writer3MF(std::ostream& str)
     : zip(str)
 {
@@ -124,22 +181,43 @@ bool Writer3MF::SaveObject(std::ostream& str, int id, const MeshKernel& mesh) co
     str << Base::blanks(2) << "<object id=\"" << id << "\" type=\"" << GetType(mesh) << "\">\n";
     str << Base::blanks(3) << "<mesh>\n";
 
+    // the records are written in chunks directly into the zip entry
+    ChunkWriter writer(str);
+
     // vertices
-    str << Base::blanks(4) << "<vertices>\n";
-    std::size_t index = 0;
-    for (auto it = rPoints.begin(); it != rPoints.end(); ++it, ++index) {
-        str << Base::blanks(5) << "<vertex x=\"" << it->x << "\" y=\"" << it->y << "\" z=\""
-            << it->z << "\" />\n";
+    writer.Append("    <vertices>\n");
+    for (const auto& it : rPoints) {
+        writer.Append("     <vertex x=\"");
+        writer.Append(it.x);
+        writer.Append("\" y=\"");
+        writer.Append(it.y);
+        writer.Append("\" z=\"");
+        writer.Append(it.z);
+        writer.Append("\" />\n");
+        if (!writer.EndRecord()) {
+            return false;
+        }
     }
-    str << Base::blanks(4) << "</vertices>\n";
+    writer.Append("    </vertices>\n");
 
     // facet indices
-    str << Base::blanks(4) << "<triangles>\n";
+    writer.Append("    <triangles>\n");
     for (const auto& it : rFacets) {
-        str << Base::blanks(5) << "<triangle v1=\"" << it._aulPoints[0] << "\" v2=\""
-            << it._aulPoints[1] << "\" v3=\"" << it._aulPoints[2] << "\" />\n";
+        writer.Append("     <triangle v1=\"");
+        writer.Append(it._aulPoints[0]);
+        writer.Append("\" v2=\"");
+        writer.Append(it._aulPoints[1]);
+        writer.Append("\" v3=\"");
+        writer.Append(it._aulPoints[2]);
+        writer.Append("\" />\n");
+        if (!writer.EndRecord()) {
+            return false;
+        }
+    }
+    writer.Append("    </triangles>\n");
+    if (!writer.Flush()) {
+        return false;
     }
-    str << Base::blanks(4) << "</triangles>\n";
 
     str << Base::blanks(3) << "</mesh>\n";
     str << Base::blanks(2) << "</object>\n";
@@ -21,10 +21,18 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(disable : 4396)
 #endif
 
+#include "Functional.h"
 #include "KDTree.h"
 #include <kdtree++/kdtree.hpp>
 
@@ -83,6 +91,43 @@ class MeshKDTree::Private
 {
 public:
     MyKDTree kd_tree;
+    Base::BoundBox3f bbox;
+
+    /// Adds the points, a balanced tree is built at once if the tree is empty
+    template<class Points>
+    void Insert(const Points& points)
+    {
+        PointIndex index = kd_tree.size();
+        for (const auto& it : points) {
+            bbox.Add(it);
+        }
+        if (kd_tree.empty()) {
+            std::vector<Point3d> data;
+            data.reserve(points.size());
+            for (const auto& it : points) {
+                data.emplace_back(it, index++);
+            }
+            kd_tree.efficient_replace_and_optimise(data);
+        }
+        else {
+            for (const auto& it : points) {
+                kd_tree.insert(Point3d(it, index++));
+            }
+        }
+    }
+
+    /// Calls \a func for each index of \a pts in parallel
+    template<class Func>
+    static void ForEach(const std::vector<Base::Vector3f>& pts, Func func)
+    {
+        constexpr std::size_t grain = 1024;
+        int threads = int(std::max(std::thread::hardware_concurrency(), 1U));
+        parallel_for(pts.size(), grain, threads, [&pts, &func](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                func(i, pts[i]);
+            }
+        });
+    }
 };
 
 MeshKDTree::MeshKDTree()
@@ -92,19 +137,13 @@ MeshKDTree::MeshKDTree()
 MeshKDTree::MeshKDTree(const std::vector<Base::Vector3f>& points)
     : d(new Private)
 {
-    PointIndex index = 0;
-    for (auto it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
-    }
+    d->Insert(points);
 }
 
 MeshKDTree::MeshKDTree(const MeshPointArray& points)
     : d(new Private)
 {
-    PointIndex index = 0;
-    for (const auto& it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
-    }
+    d->Insert(points);
 }
 
 MeshKDTree::~MeshKDTree()
@@ -116,22 +155,17 @@ void MeshKDTree::AddPoint(const Base::Vector3f& point)
 {
     PointIndex index = d->kd_tree.size();
     d->kd_tree.insert(Point3d(point, index));
+    d->bbox.Add(point);
 }
 
 void MeshKDTree::AddPoints(const std::vector<Base::Vector3f>& points)
 {
-    PointIndex index = d->kd_tree.size();
-    for (auto it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
-    }
+    d->Insert(points);
 }
 
 void MeshKDTree::AddPoints(const MeshPointArray& points)
 {
-    PointIndex index = d->kd_tree.size();
-    for (const auto& it : points) {
-        d->kd_tree.insert(Point3d(it, index++));
-    }
+    d->Insert(points);
 }
 
 bool MeshKDTree::IsEmpty() const
@@ -142,6 +176,7 @@ bool MeshKDTree::IsEmpty() const
 void MeshKDTree::Clear()
 {
     d->kd_tree.clear();
+    d->bbox = Base::BoundBox3f();
 }
 
 void MeshKDTree::Optimize()
@@ -198,4 +233,119 @@ void MeshKDTree::FindInRange(const Base::Vector3f& p,
     for (const auto& it : v) {
         indices.push_back(it.i);
     }
+    // the order of the tree nodes depends on how the tree was built
+    std::sort(indices.end() - static_cast<std::ptrdiff_t>(v.size()), indices.end());
+}
+
+void MeshKDTree::FindNearestK(const Base::Vector3f& p,
+                              std::size_t k,
+                              std::vector<PointIndex>& indices) const
+{
+    indices.clear();
+    if (k == 0 || d->kd_tree.empty()) {
+        return;
+    }
+
+    // The range search returns the points of a cube, so all points inside the
+    // sphere with the half edge length as radius are found. The radius is
+    // increased until this sphere contains k points.
+    k = std::min(k, d->kd_tree.size());
+    std::pair<MyKDTree::const_iterator, MyKDTree::distance_type> nearest =
+        d->kd_tree.find_nearest(Point3d(p, 0));
+    float range = nearest.second;
+    if (!(range > 0.0F)) {
+        // the radius of a sphere with k points if they were evenly distributed
+        float ratio = float(k) / float(d->kd_tree.size());
+        range = d->bbox.CalcDiagonalLength() * std::cbrt(ratio);
+    }
+    range = std::max(range, std::numeric_limits<float>::min());
+
+    std::vector<Point3d> v;
+    std::vector<std::pair<float, PointIndex>> found;
+    for (;;) {
+        v.clear();
+        d->kd_tree.find_within_range(Point3d(p, 0), range, std::back_inserter(v));
+        found.clear();
+        for (const auto& it : v) {
+            float dist = Base::Distance(p, it.p);
+            if (dist <= range) {
+                found.emplace_back(dist, it.i);
+            }
+        }
+        if (found.size() >= k || v.size() == d->kd_tree.size() || !std::isfinite(range)) {
+            break;
+        }
+        range *= 2.0F;
+    }
+
+    // points outside the sphere but inside the cube are only taken if all points were found
+    if (found.size() < k) {
+        found.clear();
+        for (const auto& it : v) {
+            found.emplace_back(Base::Distance(p, it.p), it.i);
+        }
+    }
+
+    k = std::min(k, found.size());
+    std::partial_sort(found.begin(), found.begin() + static_cast<std::ptrdiff_t>(k), found.end());
+    indices.reserve(k);
+    for (std::size_t i = 0; i < k; i++) {
+        indices.push_back(found[i].second);
+    }
+}
+
+void MeshKDTree::FindNearest(const std::vector<Base::Vector3f>& pts,
+                             std::vector<PointIndex>& indices,
+                             std::vector<float>& dists) const
+{
+    indices.resize(pts.size());
+    dists.resize(pts.size());
+    Private::ForEach(pts, [this, &indices, &dists](std::size_t i, const Base::Vector3f& p) {
+        Base::Vector3f n;
+        indices[i] = FindNearest(p, n, dists[i]);
+    });
+}
+
+void MeshKDTree::FindNearest(const std::vector<Base::Vector3f>& pts,
+                             float max_dist,
+                             std::vector<PointIndex>& indices,
+                             std::vector<float>& dists) const
+{
+    indices.resize(pts.size());
+    dists.resize(pts.size());
+    Private::ForEach(pts, [this, max_dist, &indices, &dists](std::size_t i, const Base::Vector3f& p) {
+        Base::Vector3f n;
+        indices[i] = FindNearest(p, max_dist, n, dists[i]);
+    });
+}
+
+void MeshKDTree::FindExact(const std::vector<Base::Vector3f>& pts,
+                           std::vector<PointIndex>& indices) const
+{
+    indices.resize(pts.size());
+    Private::ForEach(pts, [this, &indices](std::size_t i, const Base::Vector3f& p) {
+        indices[i] = FindExact(p);
+    });
+}
+
+void MeshKDTree::FindInRange(const std::vector<Base::Vector3f>& pts,
+                             float range,
+                             std::vector<std::vector<PointIndex>>& indices) const
+{
+    indices.clear();
+    indices.resize(pts.size());
+    Private::ForEach(pts, [this, range, &indices](std::size_t i, const Base::Vector3f& p) {
+        FindInRange(p, range, indices[i]);
+    });
+}
+
+void MeshKDTree::FindNearestK(const std::vector<Base::Vector3f>& pts,
+                              std::size_t k,
+                              std::vector<std::vector<PointIndex>>& indices) const
+{
+    indices.clear();
+    indices.resize(pts.size());
+    Private::ForEach(pts, [this, k, &indices](std::size_t i, const Base::Vector3f& p) {
+        FindNearestK(p, k, indices[i]);
+    });
 }
@@ -50,6 +50,29 @@ public:
     FindNearest(const Base::Vector3f& p, float max_dist, Base::Vector3f& n, float&) const;
     PointIndex FindExact(const Base::Vector3f& p) const;
     void FindInRange(const Base::Vector3f&, float, std::vector<PointIndex>&) const;
+    /// Returns the indices of the \a k nearest points sorted by their distance to \a p.
+    void FindNearestK(const Base::Vector3f& p, std::size_t k, std::vector<PointIndex>&) const;
+
+    /** @name Batch queries
+     * The queries for all the points are done in parallel. The results are stored
+     * in the same order as the points, POINT_INDEX_MAX stands for no result.
+     */
+    //@{
+    void FindNearest(const std::vector<Base::Vector3f>& pts,
+                     std::vector<PointIndex>& indices,
+                     std::vector<float>& dists) const;
+    void FindNearest(const std::vector<Base::Vector3f>& pts,
+                     float max_dist,
+                     std::vector<PointIndex>& indices,
+                     std::vector<float>& dists) const;
+    void FindExact(const std::vector<Base::Vector3f>& pts, std::vector<PointIndex>& indices) const;
+    void FindInRange(const std::vector<Base::Vector3f>& pts,
+                     float range,
+                     std::vector<std::vector<PointIndex>>& indices) const;
+    void FindNearestK(const std::vector<Base::Vector3f>& pts,
+                      std::size_t k,
+                      std::vector<std::vector<PointIndex>>& indices) const;
+    //@}
 
     MeshKDTree(const MeshKDTree&) = delete;
     MeshKDTree(MeshKDTree&&) = delete;
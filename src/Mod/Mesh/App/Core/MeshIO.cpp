@@ -25,11 +25,15 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string_view>
+#include <thread>
 #endif
 
+#include <QFile>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/convert.hpp>
 #include <boost/convert/spirit.hpp>
@@ -37,6 +41,7 @@
 #include <boost/regex.hpp>
 
 #include "IO/Reader3MF.h"
+#include "IO/ReaderGLTF.h"
 #include "IO/ReaderOBJ.h"
 #include "IO/ReaderPLY.h"
 #include "IO/Writer3MF.h"
@@ -51,6 +56,7 @@
 #include <Base/Sequencer.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
+#include <Base/Trace.h>
 #include <Base/Writer.h>
 #include <zipios++/gzipoutputstream.h>
 #include <zipios++/zipoutputstream.h>
@@ -58,6 +64,7 @@
 #include "Builder.h"
 #include "Definitions.h"
 #include "Degeneration.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshIO.h"
 #include "MeshKernel.h"
@@ -189,6 +196,8 @@ std::vector<std::string> MeshInput::supportedMeshFormats()
     fmt.emplace_back("bdf");
     fmt.emplace_back("off");
     fmt.emplace_back("smf");
+    fmt.emplace_back("glb");
+    fmt.emplace_back("gltf");
     return fmt;
 }
 
@@ -222,6 +231,7 @@ MeshIO::Format MeshInput::getFormat(const char* FileName)
 
 bool MeshInput::LoadAny(const char* FileName)
 {
+    FC_TRACE_ZONE("MeshInput::LoadAny", FileName);
     // ask for read permission
     Base::FileInfo fi(FileName);
     if (!fi.exists() || !fi.isFile()) {
@@ -241,7 +251,18 @@ bool MeshInput::LoadAny(const char* FileName)
     // read file
     bool ok = false;
     if (fi.hasExtension({"stl", "ast"})) {
-        ok = LoadSTL(str);
+        // Binary files are mapped and decoded in parallel which is much faster for big files
+        QFile file(QString::fromUtf8(FileName));
+        const uchar* data = nullptr;
+        if (file.open(QIODevice::ReadOnly) && file.size() > 84) {
+            data = file.map(0, file.size());
+        }
+        if (data && isBinarySTL(reinterpret_cast<const char*>(data), file.size())) {
+            ok = LoadBinarySTL(reinterpret_cast<const char*>(data), file.size());
+        }
+        else {
+            ok = LoadSTL(str);
+        }
     }
     else if (fi.hasExtension("iv")) {
         ok = LoadInventor(str);
@@ -273,6 +294,11 @@ bool MeshInput::LoadAny(const char* FileName)
     else if (fi.hasExtension("ply")) {
         ok = LoadPLY(str);
     }
+    else if (fi.hasExtension({"glb", "gltf"})) {
+        // The reader maps the file itself and may need its directory for external buffers
+        ReaderGLTF reader(this->_rclMesh);
+        ok = reader.Load(FileName);
+    }
     else {
         throw Base::FileException("File extension not supported", FileName);
     }
@@ -282,6 +308,7 @@ bool MeshInput::LoadAny(const char* FileName)
 
 bool MeshInput::LoadFormat(std::istream& input, MeshIO::Format fmt)
 {
+    FC_TRACE_ZONE("MeshInput::LoadFormat");
     switch (fmt) {
         case MeshIO::BMS:
             _rclMesh.Read(input);
@@ -858,6 +885,63 @@ bool MeshInput::LoadBinarySTL(std::istream& input)
     return true;
 }
 
+bool MeshInput::isBinarySTL(const char* data, std::size_t size)
+{
+    // Same check as in LoadSTL(): look for ASCII keywords after the 80 bytes of the header
+    // and the facet count, but not beyond the end of a file with a single triangle
+    if (size < 84) {
+        return false;
+    }
+    uint32_t ulCt {};
+    std::memcpy(&ulCt, data + 80, sizeof(ulCt));
+    std::size_t ulBytes = std::min<std::size_t>(ulCt > 1 ? 100 : 50, size - 84);
+    if (ulBytes == 0) {
+        return ulCt == 0;
+    }
+
+    std::string szBuf(data + 84, ulBytes);
+    boost::algorithm::to_upper(szBuf);
+    // keywords cannot contain a null byte
+    const char* keywords[] = {"SOLID", "FACET", "NORMAL", "VERTEX", "ENDFACET", "ENDLOOP"};
+    return std::none_of(std::begin(keywords), std::end(keywords), [&szBuf](const char* key) {
+        return strstr(szBuf.c_str(), key) != nullptr;
+    });
+}
+
+bool MeshInput::LoadBinarySTL(const char* data, std::size_t size)
+{
+    if (size < 84) {
+        return false;
+    }
+
+    uint32_t ulCt = 0;
+    std::memcpy(&ulCt, data + 80, sizeof(ulCt));
+
+    // compare with the number of facets that fit into the file
+    if (ulCt > (size - 84) / 50) {
+        return false;  // not a valid STL file
+    }
+
+    MeshFastBuilder builder(this->_rclMesh);
+    builder.Resize(static_cast<MeshFastBuilder::size_type>(ulCt));
+
+    const char* facets = data + 84;
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_for(ulCt, 100000, threads, [&](std::size_t begin, std::size_t end) {
+        Base::Vector3f clVects[4];
+        for (std::size_t i = begin; i < end; i++) {
+            // normal and points, followed by a 2 bytes attribute
+            std::memcpy(clVects, facets + 50 * i, sizeof(clVects));
+            std::swap(clVects[0], clVects[3]);
+            builder.SetFacet(static_cast<MeshFastBuilder::size_type>(i), clVects);
+        }
+    });
+
+    builder.Finish();
+
+    return true;
+}
+
 /** Loads the mesh object from an XML file. */
 void MeshInput::LoadXML(Base::XMLReader& reader)
 {
@@ -1369,6 +1453,7 @@ MeshIO::Format MeshOutput::GetFormat(const char* FileName)
 /// Save in a file, format is decided by the extension if not explicitly given
 bool MeshOutput::SaveAny(const char* FileName, MeshIO::Format format) const
 {
+    FC_TRACE_ZONE("MeshOutput::SaveAny", FileName);
     // ask for write permission
     Base::FileInfo file(FileName);
     Base::FileInfo directory(file.dirPath());
@@ -1529,6 +1614,7 @@ bool MeshOutput::SaveAny(const char* FileName, MeshIO::Format format) const
 
 bool MeshOutput::SaveFormat(std::ostream& str, MeshIO::Format fmt) const
 {
+    FC_TRACE_ZONE("MeshOutput::SaveFormat");
     switch (fmt) {
         case MeshIO::BMS:
             _rclMesh.Write(str);
@@ -1971,38 +2057,53 @@ bool MeshOutput::SaveBinaryPLY(std::ostream& out) const
         << "property list uchar int vertex_index\n"
         << "end_header\n";
 
-    Base::OutputStream os(out);
-    os.setByteOrder(Base::Stream::LittleEndian);
+    // Like Base::OutputStream with little endian byte order the values are written
+    // in the native order, but whole blocks of records are passed to the stream at once
+    constexpr std::size_t blockSize = 65536;
+    std::vector<char> buffer;
+    auto append = [&buffer](const auto& value) {
+        const char* data = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), data, data + sizeof(value));
+    };
 
-    for (std::size_t i = 0; i < v_count; i++) {
-        const MeshPoint& p = rPoints[i];
-        if (this->apply_transform) {
-            Base::Vector3f pt = this->_transform * p;
-            os << pt.x << pt.y << pt.z;
-        }
-        else {
-            os << p.x << p.y << p.z;
-        }
-        if (saveVertexColor) {
-            const App::Color& c = _material->diffuseColor[i];
-            uint8_t r = uint8_t(255.0F * c.r);
-            uint8_t g = uint8_t(255.0F * c.g);
-            uint8_t b = uint8_t(255.0F * c.b);
-            os << r << g << b;
+    std::size_t vertexSize = saveVertexColor ? 15 : 12;
+    buffer.reserve(blockSize * std::max<std::size_t>(vertexSize, 13));
+    for (std::size_t start = 0; start < v_count; start += blockSize) {
+        std::size_t end = std::min(start + blockSize, v_count);
+        buffer.clear();
+        for (std::size_t i = start; i < end; i++) {
+            Base::Vector3f pt = rPoints[i];
+            if (this->apply_transform) {
+                pt = this->_transform * pt;
+            }
+            append(pt.x);
+            append(pt.y);
+            append(pt.z);
+            if (saveVertexColor) {
+                const App::Color& c = _material->diffuseColor[i];
+                append(uint8_t(255.0F * c.r));
+                append(uint8_t(255.0F * c.g));
+                append(uint8_t(255.0F * c.b));
+            }
         }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
     }
+
     unsigned char n = 3;
-    int f1 {}, f2 {}, f3 {};
-    for (std::size_t i = 0; i < f_count; i++) {
-        const MeshFacet& f = rFacets[i];
-        f1 = (int)f._aulPoints[0];
-        f2 = (int)f._aulPoints[1];
-        f3 = (int)f._aulPoints[2];
-        os << n;
-        os << f1 << f2 << f3;
+    for (std::size_t start = 0; start < f_count; start += blockSize) {
+        std::size_t end = std::min(start + blockSize, f_count);
+        buffer.clear();
+        for (std::size_t i = start; i < end; i++) {
+            const MeshFacet& f = rFacets[i];
+            append(n);
+            append((int)f._aulPoints[0]);
+            append((int)f._aulPoints[1]);
+            append((int)f._aulPoints[2]);
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
     }
 
-    return true;
+    return out.good();
 }
 
 bool MeshOutput::SaveAsciiPLY(std::ostream& out) const
@@ -131,6 +131,10 @@ public:
     bool LoadAsciiSTL(std::istream& input);
     /** Loads a binary STL file. */
     bool LoadBinarySTL(std::istream& input);
+    /** Loads a binary STL file from a memory buffer, e.g. a mapped file.
+     * The facets are decoded in parallel.
+     */
+    bool LoadBinarySTL(const char* data, std::size_t size);
     /** Loads an OBJ Mesh file. */
     bool LoadOBJ(std::istream& input);
     /** Loads an OBJ Mesh file. */
@@ -157,6 +161,9 @@ public:
     static std::vector<std::string> supportedMeshFormats();
     static MeshIO::Format getFormat(const char* FileName);
 
+private:
+    static bool isBinarySTL(const char* data, std::size_t size);
+
 private:
     MeshKernel& _rclMesh; /**< reference to mesh data structure */
     Material* _material;
@@ -28,6 +28,7 @@
 #include <map>
 #include <queue>
 #include <stdexcept>
+#include <thread>
 #endif
 
 #include <Base/Exception.h>
@@ -37,6 +38,7 @@
 #include "Algorithm.h"
 #include "Builder.h"
 #include "Evaluation.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshIO.h"
 #include "MeshKernel.h"
@@ -63,6 +65,7 @@ MeshKernel::MeshKernel(MeshKernel&& rclMesh)
 MeshKernel& MeshKernel::operator=(const MeshKernel& rclMesh)
 {
     if (this != &rclMesh) {  // must be a different instance
+        ReleaseCornerTable();
         this->_aclPointArray = rclMesh._aclPointArray;
         this->_aclFacetArray = rclMesh._aclFacetArray;
         this->_clBoundBox = rclMesh._clBoundBox;
@@ -74,6 +77,8 @@ MeshKernel& MeshKernel::operator=(const MeshKernel& rclMesh)
 MeshKernel& MeshKernel::operator=(MeshKernel&& rclMesh)
 {
     if (this != &rclMesh) {  // must be a different instance
+        ReleaseCornerTable();
+        rclMesh.ReleaseCornerTable();
         this->_aclPointArray = std::move(rclMesh._aclPointArray);
         this->_aclFacetArray = std::move(rclMesh._aclFacetArray);
         this->_clBoundBox = rclMesh._clBoundBox;
@@ -100,6 +105,7 @@ void MeshKernel::Assign(const MeshPointArray& rPoints,
                         const MeshFacetArray& rFacets,
                         bool checkNeighbourHood)
 {
+    ReleaseCornerTable();
     _aclPointArray = rPoints;
     _aclFacetArray = rFacets;
     RecalcBoundBox();
@@ -110,6 +116,7 @@ void MeshKernel::Assign(const MeshPointArray& rPoints,
 
 void MeshKernel::Adopt(MeshPointArray& rPoints, MeshFacetArray& rFacets, bool checkNeighbourHood)
 {
+    ReleaseCornerTable();
     _aclPointArray.swap(rPoints);
     _aclFacetArray.swap(rFacets);
     RecalcBoundBox();
@@ -120,6 +127,8 @@ void MeshKernel::Adopt(MeshPointArray& rPoints, MeshFacetArray& rFacets, bool ch
 
 void MeshKernel::Swap(MeshKernel& mesh)
 {
+    ReleaseCornerTable();
+    mesh.ReleaseCornerTable();
     this->_aclPointArray.swap(mesh._aclPointArray);
     this->_aclFacetArray.swap(mesh._aclFacetArray);
     this->_clBoundBox = mesh._clBoundBox;
@@ -133,6 +142,7 @@ MeshKernel& MeshKernel::operator+=(const MeshGeomFacet& rclSFacet)
 
 void MeshKernel::AddFacet(const MeshGeomFacet& rclSFacet)
 {
+    ReleaseCornerTable();
     MeshFacet clFacet;
 
     // set corner points
@@ -192,6 +202,7 @@ void MeshKernel::AddFacets(const std::vector<MeshGeomFacet>& rclFAry)
 
 unsigned long MeshKernel::AddFacets(const std::vector<MeshFacet>& rclFAry, bool checkManifolds)
 {
+    ReleaseCornerTable();
     // Build map of edges of the referencing facets we want to append
 #ifdef FC_DEBUG
     unsigned long countPoints = CountPoints();
@@ -382,6 +393,7 @@ void MeshKernel::Merge(const MeshPointArray& rPoints, const MeshFacetArray& rFac
     if (rPoints.empty() || rFaces.empty()) {
         return;  // nothing to do
     }
+    ReleaseCornerTable();
     std::vector<PointIndex> increments(rPoints.size());
 
     FacetIndex countFacets = this->_aclFacetArray.size();
@@ -435,12 +447,14 @@ void MeshKernel::Merge(const MeshPointArray& rPoints, const MeshFacetArray& rFac
 
 void MeshKernel::Cleanup()
 {
+    ReleaseCornerTable();
     MeshCleanup meshCleanup(_aclPointArray, _aclFacetArray);
     meshCleanup.RemoveInvalids();
 }
 
 void MeshKernel::Clear()
 {
+    ReleaseCornerTable();
     _aclPointArray.clear();
     _aclFacetArray.clear();
 
@@ -459,6 +473,8 @@ bool MeshKernel::DeleteFacet(const MeshFacetIterator& rclIter)
         return false;
     }
 
+    ReleaseCornerTable();
+
     // index of the facet to delete
     ulInd = rclIter._clIter - _aclFacetArray.begin();
 
@@ -667,6 +683,7 @@ void MeshKernel::ErasePoint(PointIndex ulIndex, FacetIndex ulFacetIndex, bool bO
 
 void MeshKernel::RemoveInvalids()
 {
+    ReleaseCornerTable();
     std::vector<unsigned long> aulDecrements;
     std::vector<unsigned long>::iterator pDIter;
     unsigned long ulDec {};
@@ -921,6 +938,8 @@ void MeshKernel::Read(std::istream& rclIn)
         return;
     }
 
+    ReleaseCornerTable();
+
     // get header
     Base::InputStream str(rclIn);
 
@@ -1105,14 +1124,8 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
-    auto clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
-
-    _clBoundBox.SetVoid();
-    while (clPIter < clPEIter) {
-        *clPIter *= rclMat;
-        _clBoundBox.Add(*clPIter);
-        clPIter++;
-    }
+    _aclPointArray.Transform(rclMat);
+    RecalcBoundBox();
 }
 
 void MeshKernel::Smooth(int iterations, float stepsize)
@@ -1121,12 +1134,30 @@ void MeshKernel::Smooth(int iterations, float stepsize)
     LaplaceSmoothing(*this).Smooth(iterations);
 }
 
-void MeshKernel::RecalcBoundBox() const
+const MeshCornerTable& MeshKernel::GetCornerTable() const
 {
-    _clBoundBox.SetVoid();
-    for (const auto& pI : _aclPointArray) {
-        _clBoundBox.Add(pI);
+    std::lock_guard<std::mutex> lock(_cornerTableMutex);
+    if (!_cornerTable) {
+        _cornerTable = std::make_unique<MeshCornerTable>(*this);
     }
+    return *_cornerTable;
+}
+
+bool MeshKernel::HasCornerTable() const
+{
+    std::lock_guard<std::mutex> lock(_cornerTableMutex);
+    return _cornerTable != nullptr;
+}
+
+void MeshKernel::ReleaseCornerTable()
+{
+    std::lock_guard<std::mutex> lock(_cornerTableMutex);
+    _cornerTable.reset();
+}
+
+void MeshKernel::RecalcBoundBox() const
+{
+    _clBoundBox = _aclPointArray.GetBoundBox();
 }
 
 std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
@@ -1135,15 +1166,25 @@ std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
 
     normals.resize(CountPoints());
 
-    PointIndex p1 {}, p2 {}, p3 {};
-    unsigned int ct = CountFacets();
-    for (unsigned int pFIter = 0; pFIter < ct; pFIter++) {
-        GetFacetPoints(pFIter, p1, p2, p3);
-        Base::Vector3f Norm = (GetPoint(p2) - GetPoint(p1)) % (GetPoint(p3) - GetPoint(p1));
+    // The facet normals are independent of each other and computed in parallel,
+    // only accumulating them at the shared points is done sequentially
+    std::vector<Base::Vector3f> facetNormals(CountFacets());
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_for(facetNormals.size(), 100000, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& face = _aclFacetArray[i];
+            const Base::Vector3f& p1 = _aclPointArray[face._aulPoints[0]];
+            const Base::Vector3f& p2 = _aclPointArray[face._aulPoints[1]];
+            const Base::Vector3f& p3 = _aclPointArray[face._aulPoints[2]];
+            facetNormals[i] = (p2 - p1) % (p3 - p1);
+        }
+    });
 
-        normals[p1] += Norm;
-        normals[p2] += Norm;
-        normals[p3] += Norm;
+    for (std::size_t i = 0; i < facetNormals.size(); i++) {
+        const MeshFacet& face = _aclFacetArray[i];
+        normals[face._aulPoints[0]] += facetNormals[i];
+        normals[face._aulPoints[1]] += facetNormals[i];
+        normals[face._aulPoints[2]] += facetNormals[i];
     }
 
     return normals;
@@ -1151,20 +1192,22 @@ std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
 
 std::vector<Base::Vector3f> MeshKernel::GetFacetNormals(const std::vector<FacetIndex>& facets) const
 {
-    std::vector<Base::Vector3f> normals;
-    normals.reserve(facets.size());
+    std::vector<Base::Vector3f> normals(facets.size());
 
-    for (FacetIndex it : facets) {
-        const MeshFacet& face = _aclFacetArray[it];
+    int threads = int(std::thread::hardware_concurrency());
+    MeshCore::parallel_for(facets.size(), 100000, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& face = _aclFacetArray[facets[i]];
 
-        const Base::Vector3f& p1 = _aclPointArray[face._aulPoints[0]];
-        const Base::Vector3f& p2 = _aclPointArray[face._aulPoints[1]];
-        const Base::Vector3f& p3 = _aclPointArray[face._aulPoints[2]];
+            const Base::Vector3f& p1 = _aclPointArray[face._aulPoints[0]];
+            const Base::Vector3f& p2 = _aclPointArray[face._aulPoints[1]];
+            const Base::Vector3f& p3 = _aclPointArray[face._aulPoints[2]];
 
-        Base::Vector3f n = (p2 - p1) % (p3 - p1);
-        n.Normalize();
-        normals.emplace_back(n);
-    }
+            Base::Vector3f n = (p2 - p1) % (p3 - p1);
+            n.Normalize();
+            normals[i] = n;
+        }
+    });
 
     return normals;
 }
@@ -25,10 +25,13 @@
 
 #include <cassert>
 #include <iosfwd>
+#include <memory>
+#include <mutex>
 
 #include <Base/BoundBox.h>
 #include <Base/Matrix.h>
 
+#include "CornerTable.h"
 #include "Helpers.h"
 
 
@@ -190,9 +193,20 @@ public:
     /** Returns a modifier for the facet array */
     MeshFacetModifier ModifyFacets()
     {
+        ReleaseCornerTable();
         return MeshFacetModifier(_aclFacetArray);
     }
 
+    /** Returns the corner table of the mesh which is built on the first call. The table
+     * is released by all methods that change the facets, except for those of
+     * MeshTopoAlgorithm which update it incrementally.
+     */
+    const MeshCornerTable& GetCornerTable() const;
+    /** Returns true if the corner table is currently built. */
+    bool HasCornerTable() const;
+    /** Releases the memory of the corner table. */
+    void ReleaseCornerTable();
+
     /** Returns the array of all edges.
      *  Notice: The Edgelist will be temporary generated. Changes on the mesh
      * structure does not affect the Edgelist
@@ -486,6 +500,8 @@ private:
     MeshFacetArray _aclFacetArray;        /**< Holds the array of facets. */
     mutable Base::BoundBox3f _clBoundBox; /**< The current calculated bounding box. */
     bool _bValid {true};                  /**< Current state of validality. */
+    mutable std::unique_ptr<MeshCornerTable> _cornerTable; /**< Built on demand. */
+    mutable std::mutex _cornerTableMutex;
 
     // friends
     friend class MeshPointIterator;
@@ -24,10 +24,14 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <cmath>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #endif
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Functional.h"
 #include "Segmentation.h"
 
 using namespace MeshCore;
@@ -573,6 +577,11 @@ void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm
         cAlgo.ResetFacetsFlag(resetVisited, MeshCore::MeshFacet::VISIT);
         resetVisited.clear();
 
+        if (it->IsLocal()) {
+            FindLocalSegments(*it, resetVisited);
+            continue;
+        }
+
         MeshCore::MeshIsNotFlag<MeshCore::MeshFacet> flag;
         iCur = std::find_if(iBeg, iEnd, [flag](const MeshFacet& f) {
             return flag(f, MeshFacet::VISIT);
@@ -614,3 +623,143 @@ void MeshSegmentAlgorithm::FindSegments(std::vector<MeshSurfaceSegmentPtr>& segm
         }
     }
 }
+
+void MeshSegmentAlgorithm::FindLocalSegments(MeshSurfaceSegment& segm,
+                                             std::vector<FacetIndex>& resetVisited)
+{
+    // This gives the same segments as growing them one after another from the first
+    // not visited facet. Because the test of a facet doesn't depend on the segment
+    // the accepted facets form fixed connected components. A component is taken by
+    // the first start facet that touches it, i.e. by its lowest facet or by a lower
+    // rejected facet next to it. A rejected start facet takes all components it
+    // touches first.
+    const MeshFacetArray& rFAry = myKernel.GetFacets();
+    std::size_t numFacets = rFAry.size();
+    int threads = int(std::max(std::thread::hardware_concurrency(), 1U));
+    constexpr std::size_t grain = 4096;
+
+    enum State : char
+    {
+        Visited,
+        Rejected,
+        Accepted
+    };
+    std::vector<char> state(numFacets);
+    parallel_for(numFacets, grain, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            const MeshFacet& face = rFAry[i];
+            if (face.IsFlag(MeshFacet::VISIT)) {
+                state[i] = Visited;
+            }
+            else {
+                state[i] = segm.TestFacet(face) ? Accepted : Rejected;
+            }
+        }
+    });
+
+    // Union-find of the accepted facets, the root of a component is its lowest facet.
+    // Each block of facets is merged in parallel, edges between blocks afterwards.
+    std::vector<FacetIndex> parent(numFacets);
+    std::iota(parent.begin(), parent.end(), FacetIndex(0));
+    auto find = [&parent](FacetIndex index) {
+        while (parent[index] != index) {
+            parent[index] = parent[parent[index]];
+            index = parent[index];
+        }
+        return index;
+    };
+    auto unite = [&parent, &find](FacetIndex index1, FacetIndex index2) {
+        index1 = find(index1);
+        index2 = find(index2);
+        if (index1 < index2) {
+            parent[index2] = index1;
+        }
+        else if (index2 < index1) {
+            parent[index1] = index2;
+        }
+    };
+
+    std::mutex mutex;
+    std::vector<std::pair<FacetIndex, FacetIndex>> crossEdges;
+    parallel_for(numFacets, grain, threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<std::pair<FacetIndex, FacetIndex>> edges;
+        for (std::size_t i = begin; i < end; i++) {
+            if (state[i] != Accepted) {
+                continue;
+            }
+            for (FacetIndex nb : rFAry[i]._aulNeighbours) {
+                if (nb >= numFacets || nb == i || state[nb] != Accepted) {
+                    continue;
+                }
+                if (nb >= begin && nb < end) {
+                    unite(i, nb);
+                }
+                else {
+                    edges.emplace_back(i, nb);
+                }
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        crossEdges.insert(crossEdges.end(), edges.begin(), edges.end());
+    });
+    for (const auto& it : crossEdges) {
+        unite(it.first, it.second);
+    }
+    // a parent always has a lower index, so in ascending order one step reaches the root
+    for (std::size_t i = 0; i < numFacets; i++) {
+        if (state[i] == Accepted) {
+            parent[i] = parent[parent[i]];
+        }
+    }
+
+    // the start facet that takes each component
+    std::vector<FacetIndex> start(parent);
+    for (std::size_t i = 0; i < numFacets; i++) {
+        if (state[i] != Rejected) {
+            continue;
+        }
+        for (FacetIndex nb : rFAry[i]._aulNeighbours) {
+            if (nb < numFacets && state[nb] == Accepted) {
+                FacetIndex& root = start[parent[nb]];
+                root = std::min<FacetIndex>(root, i);
+            }
+        }
+    }
+
+    // group the facets by their start facet
+    std::vector<FacetIndex> owner(numFacets, FACET_INDEX_MAX);
+    std::vector<std::size_t> offsets(numFacets + 1, 0);
+    for (std::size_t i = 0; i < numFacets; i++) {
+        if (state[i] == Rejected) {
+            owner[i] = i;
+        }
+        else if (state[i] == Accepted) {
+            owner[i] = start[parent[i]];
+        }
+        if (owner[i] != FACET_INDEX_MAX) {
+            offsets[owner[i] + 1]++;
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<FacetIndex> indices(offsets.back());
+    std::vector<std::size_t> pos(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < numFacets; i++) {
+        if (owner[i] != FACET_INDEX_MAX) {
+            indices[pos[owner[i]]++] = i;
+            rFAry[i].SetFlag(MeshFacet::VISIT);
+        }
+    }
+
+    // add or discard the segments in the order of their start facets
+    for (std::size_t i = 0; i < numFacets; i++) {
+        std::size_t count = offsets[i + 1] - offsets[i];
+        if (count == 1) {
+            resetVisited.push_back(i);
+        }
+        else if (count > 1) {
+            auto first = indices.begin() + std::ptrdiff_t(offsets[i]);
+            segm.AddSegment(std::vector<FacetIndex>(first, first + std::ptrdiff_t(count)));
+        }
+    }
+}
@@ -58,6 +58,14 @@ public:
     virtual void Initialize(FacetIndex);
     virtual bool TestInitialFacet(FacetIndex) const;
     virtual void AddFacet(const MeshFacet& rclFacet);
+    /** Returns true if TestFacet() only depends on the tested facet and not on the
+     * facets added so far. The segments are then grown in parallel and Initialize(),
+     * TestInitialFacet() and AddFacet() are not called.
+     */
+    virtual bool IsLocal() const
+    {
+        return false;
+    }
     void AddSegment(const std::vector<FacetIndex>&);
     const std::vector<MeshSegment>& GetSegments() const
     {
@@ -270,6 +278,10 @@ public:
     {
         return info.at(pos);
     }
+    bool IsLocal() const override
+    {
+        return true;
+    }
 
 private:
     const std::vector<CurvatureInfo>& info;
@@ -392,6 +404,9 @@ public:
     {}
     void FindSegments(std::vector<MeshSurfaceSegmentPtr>&);
 
+private:
+    void FindLocalSegments(MeshSurfaceSegment&, std::vector<FacetIndex>& resetVisited);
+
 private:
     const MeshKernel& myKernel;
 };
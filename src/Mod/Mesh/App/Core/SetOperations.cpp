@@ -23,17 +23,23 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <algorithm>
 #include <fstream>
+#include <future>
 #include <ios>
+#include <memory>
+#include <thread>
 #endif
 
 #include <Base/Builder3D.h>
 #include <Base/Sequencer.h>
 
 #include "Algorithm.h"
+#include "BVH.h"
 #include "Builder.h"
 #include "Definitions.h"
 #include "Elements.h"
+#include "Functional.h"
 #include "Grid.h"
 #include "Iterator.h"
 #include "SetOperations.h"
@@ -171,227 +177,158 @@ void SetOperations::Do()
     MeshDefinitions::SetMinPointDistance(saveMinMeshDistance);
 }
 
-void SetOperations::Cut(std::set<FacetIndex>& facetsCuttingEdge0,
-                        std::set<FacetIndex>& facetsCuttingEdge1)
+namespace
 {
-    MeshFacetGrid grid1(_cutMesh0, 20);
-    MeshFacetGrid grid2(_cutMesh1, 20);
-
-    unsigned long ctGx1 {}, ctGy1 {}, ctGz1 {};
-    grid1.GetCtGrids(ctGx1, ctGy1, ctGz1);
-
-    for (auto gx1 = 0UL; gx1 < ctGx1; gx1++) {
-        for (auto gy1 = 0UL; gy1 < ctGy1; gy1++) {
-            for (auto gz1 = 0UL; gz1 < ctGz1; gz1++) {
-                if (grid1.GetCtElements(gx1, gy1, gz1) > 0) {
-                    std::vector<FacetIndex> vecFacets2;
-                    grid2.Inside(grid1.GetBoundBox(gx1, gy1, gz1), vecFacets2);
-
-                    if (!vecFacets2.empty()) {
-                        std::set<FacetIndex> vecFacets1;
-                        grid1.GetElements(gx1, gy1, gz1, vecFacets1);
-
-                        std::set<FacetIndex>::iterator it1;
-                        for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1) {
-                            FacetIndex fidx1 = *it1;
-                            MeshGeomFacet f1 = _cutMesh0.GetFacet(*it1);
-
-                            std::vector<FacetIndex>::iterator it2;
-                            for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2) {
-                                FacetIndex fidx2 = *it2;
-                                MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
-
-                                MeshPoint p0, p1;
-
-                                int isect = f1.IntersectWithFacet(f2, p0, p1);
-                                if (isect > 0) {
-                                    // optimize cut line if distance to nearest point is too small
-                                    float minDist1 = _minDistanceToPoint,
-                                          minDist2 = _minDistanceToPoint;
-                                    MeshPoint np0 = p0, np1 = p1;
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f1._aclPoints[i] - p0).Length();
-                                        float d2 = (f1._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f1._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            p1 = f1._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    // optimize cut line if distance to nearest point is too small
-                                    for (int i = 0; i < 3; i++)  // NOLINT
-                                    {
-                                        float d1 = (f2._aclPoints[i] - p0).Length();
-                                        float d2 = (f2._aclPoints[i] - p1).Length();
-                                        if (d1 < minDist1) {
-                                            minDist1 = d1;
-                                            np0 = f2._aclPoints[i];
-                                        }
-                                        if (d2 < minDist2) {
-                                            minDist2 = d2;
-                                            np1 = f2._aclPoints[i];
-                                        }
-                                    }  // for (int i = 0; i < 3; i++)
-
-                                    MeshPoint mp0 = np0;
-                                    MeshPoint mp1 = np1;
-
-                                    if (mp0 != mp1) {
-                                        facetsCuttingEdge0.insert(fidx1);
-                                        facetsCuttingEdge1.insert(fidx2);
-
-                                        _cutPoints.insert(mp0);
-                                        _cutPoints.insert(mp1);
-
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit0 =
-                                            _cutPoints.insert(mp0);
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit1 =
-                                            _cutPoints.insert(mp1);
-
-                                        _edges[Edge(mp0, mp1)] = EdgeInfo();
-
-                                        _facet2points[0][fidx1].push_back(pit0.first);
-                                        _facet2points[0][fidx1].push_back(pit1.first);
-                                        _facet2points[1][fidx2].push_back(pit0.first);
-                                        _facet2points[1][fidx2].push_back(pit1.first);
-                                    }
-                                    else {
-                                        std::pair<std::set<MeshPoint>::iterator, bool> pit =
-                                            _cutPoints.insert(mp0);
-
-                                        // do not insert a facet when only one corner point cuts the
-                                        // edge if (!((mp0 == f1._aclPoints[0]) || (mp0 ==
-                                        // f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge0.insert(fidx1);
-                                            _facet2points[0][fidx1].push_back(pit.first);
-                                        }
-
-                                        // if (!((mp0 == f2._aclPoints[0]) || (mp0 ==
-                                        // f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
-                                        {
-                                            facetsCuttingEdge1.insert(fidx2);
-                                            _facet2points[1][fidx2].push_back(pit.first);
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
+/*
+ * Intersects the two facets and moves the end points of the cut line to a
+ * corner point of the facets if it is closer than minDistanceToPoint.
+ */
+bool CutFacets(const MeshGeomFacet& f1,
+               const MeshGeomFacet& f2,
+               float minDistanceToPoint,
+               MeshPoint& mp0,
+               MeshPoint& mp1)
+{
+    MeshPoint p0, p1;
+
+    int isect = f1.IntersectWithFacet(f2, p0, p1);
+    if (isect <= 0) {
+        return false;
     }
-}
 
-void SetOperations::TriangulateMesh(const MeshKernel& cutMesh, int side)
-{
-    // Triangulate Mesh
-    std::map<FacetIndex, std::list<std::set<MeshPoint>::iterator>>::iterator it1;
-    for (it1 = _facet2points[side].begin(); it1 != _facet2points[side].end(); ++it1) {
-        std::vector<Vector3f> points;
-        std::set<MeshPoint> pointsSet;
-
-        FacetIndex fidx = it1->first;
-        MeshGeomFacet f = cutMesh.GetFacet(fidx);
-
-        // if (side == 1)
-        //     _builder.addSingleTriangle(f._aclPoints[0], f._aclPoints[1], f._aclPoints[2], 3, 0,
-        //     1, 1);
-
-        // facet corner points
-        // const MeshFacet& mf = cutMesh._aclFacetArray[fidx];
-        for (int i = 0; i < 3; i++)  // NOLINT
-        {
-            pointsSet.insert(f._aclPoints[i]);
-            points.push_back(f._aclPoints[i]);
+    // optimize cut line if distance to nearest point is too small
+    float minDist1 = minDistanceToPoint, minDist2 = minDistanceToPoint;
+    MeshPoint np0 = p0, np1 = p1;
+    for (int i = 0; i < 3; i++)  // NOLINT
+    {
+        float d1 = (f1._aclPoints[i] - p0).Length();
+        float d2 = (f1._aclPoints[i] - p1).Length();
+        if (d1 < minDist1) {
+            minDist1 = d1;
+            np0 = f1._aclPoints[i];
+        }
+        if (d2 < minDist2) {
+            minDist2 = d2;
+            p1 = f1._aclPoints[i];
+        }
+    }  // for (int i = 0; i < 3; i++)
+
+    // optimize cut line if distance to nearest point is too small
+    for (int i = 0; i < 3; i++)  // NOLINT
+    {
+        float d1 = (f2._aclPoints[i] - p0).Length();
+        float d2 = (f2._aclPoints[i] - p1).Length();
+        if (d1 < minDist1) {
+            minDist1 = d1;
+            np0 = f2._aclPoints[i];
+        }
+        if (d2 < minDist2) {
+            minDist2 = d2;
+            np1 = f2._aclPoints[i];
         }
+    }  // for (int i = 0; i < 3; i++)
 
-        // triangulated facets
-        std::list<std::set<MeshPoint>::iterator>::iterator it2;
-        for (it2 = it1->second.begin(); it2 != it1->second.end(); ++it2) {
-            if (pointsSet.find(*(*it2)) == pointsSet.end()) {
-                pointsSet.insert(*(*it2));
-                points.push_back(*(*it2));
-            }
+    mp0 = np0;
+    mp1 = np1;
+    return true;
+}
+}  // namespace
+
+void SetOperations::Cut(std::set<FacetIndex>& facetsCuttingEdge0,
+                        std::set<FacetIndex>& facetsCuttingEdge1)
+{
+    // the candidate pairs are the facets with overlapping bounding boxes
+    auto bvh0 = std::async(std::launch::async, [this]() {
+        return std::make_unique<MeshFacetBVH>(_cutMesh0);
+    });
+    MeshFacetBVH bvh1(_cutMesh1);
+    std::vector<std::pair<FacetIndex, FacetIndex>> pairs = bvh0.get()->GetOverlappingFacets(bvh1);
+
+    // intersect the facet pairs in parallel
+    struct CutLine
+    {
+        bool cut {false};
+        MeshPoint p0, p1;
+    };
+    std::vector<CutLine> lines(pairs.size());
+    int threads = int(std::max(std::thread::hardware_concurrency(), 1U));
+    parallel_for(pairs.size(), 1000, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            MeshGeomFacet f1 = _cutMesh0.GetFacet(pairs[i].first);
+            MeshGeomFacet f2 = _cutMesh1.GetFacet(pairs[i].second);
+            CutLine& line = lines[i];
+            line.cut = CutFacets(f1, f2, _minDistanceToPoint, line.p0, line.p1);
         }
+    });
 
-        Vector3f normal = f.GetNormal();
-        Vector3f base = points[0];
-        Vector3f dirX = points[1] - points[0];
-        dirX.Normalize();
-        Vector3f dirY = dirX % normal;
-
-        // project points to 2D plane
-        std::vector<Vector3f>::iterator it;
-        std::vector<Vector3f> vertices;
-        for (it = points.begin(); it != points.end(); ++it) {
-            Vector3f pv = *it;
-            pv.TransformToCoordinateSystem(base, dirX, dirY);
-            vertices.push_back(pv);
+    // collect the cut lines in the order of the pairs
+    for (std::size_t i = 0; i < pairs.size(); i++) {
+        if (!lines[i].cut) {
+            continue;
         }
 
-        DelaunayTriangulator tria;
-        tria.SetPolygon(vertices);
-        tria.TriangulatePolygon();
+        FacetIndex fidx1 = pairs[i].first;
+        FacetIndex fidx2 = pairs[i].second;
+        const MeshPoint& mp0 = lines[i].p0;
+        const MeshPoint& mp1 = lines[i].p1;
 
-        std::vector<MeshFacet> facets = tria.GetFacets();
-        for (auto& it : facets) {
-            if ((it._aulPoints[0] == it._aulPoints[1]) || (it._aulPoints[1] == it._aulPoints[2])
-                || (it._aulPoints[2] == it._aulPoints[0])) {  // two same triangle corner points
-                continue;
-            }
+        if (mp0 != mp1) {
+            facetsCuttingEdge0.insert(fidx1);
+            facetsCuttingEdge1.insert(fidx2);
 
-            MeshGeomFacet facet(points[it._aulPoints[0]],
-                                points[it._aulPoints[1]],
-                                points[it._aulPoints[2]]);
-
-            // if (side == 1)
-            //  _builder.addSingleTriangle(facet._aclPoints[0], facet._aclPoints[1],
-            //  facet._aclPoints[2], true, 3, 0, 1, 1);
-
-            // if (facet.Area() < 0.0001f)
-            //{ // too small facet
-            //   continue;
-            // }
-
-            float dist0 =
-                facet._aclPoints[0].DistanceToLine(facet._aclPoints[1],
-                                                   facet._aclPoints[1] - facet._aclPoints[2]);
-            float dist1 =
-                facet._aclPoints[1].DistanceToLine(facet._aclPoints[0],
-                                                   facet._aclPoints[0] - facet._aclPoints[2]);
-            float dist2 =
-                facet._aclPoints[2].DistanceToLine(facet._aclPoints[0],
-                                                   facet._aclPoints[0] - facet._aclPoints[1]);
-
-            if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint)
-                || (dist2 < _minDistanceToPoint)) {
-                continue;
-            }
+            std::pair<std::set<MeshPoint>::iterator, bool> pit0 = _cutPoints.insert(mp0);
+            std::pair<std::set<MeshPoint>::iterator, bool> pit1 = _cutPoints.insert(mp1);
 
-            // dist0 = (facet._aclPoints[0] - facet._aclPoints[1]).Length();
-            // dist1 = (facet._aclPoints[1] - facet._aclPoints[2]).Length();
-            // dist2 = (facet._aclPoints[2] - facet._aclPoints[3]).Length();
+            _edges[Edge(mp0, mp1)] = EdgeInfo();
 
-            // if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint) || (dist2 <
-            // _minDistanceToPoint))
-            //{
-            //   continue;
-            // }
+            _facet2points[0][fidx1].push_back(pit0.first);
+            _facet2points[0][fidx1].push_back(pit1.first);
+            _facet2points[1][fidx2].push_back(pit0.first);
+            _facet2points[1][fidx2].push_back(pit1.first);
+        }
+        else {
+            std::pair<std::set<MeshPoint>::iterator, bool> pit = _cutPoints.insert(mp0);
+
+            // do not insert a facet when only one corner point cuts the
+            // edge if (!((mp0 == f1._aclPoints[0]) || (mp0 ==
+            // f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
+            {
+                facetsCuttingEdge0.insert(fidx1);
+                _facet2points[0][fidx1].push_back(pit.first);
+            }
 
-            facet.CalcNormal();
-            if ((facet.GetNormal() * f.GetNormal()) < 0.0F) {  // adjust normal
-                std::swap(facet._aclPoints[0], facet._aclPoints[1]);
-                facet.CalcNormal();
+            // if (!((mp0 == f2._aclPoints[0]) || (mp0 ==
+            // f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
+            {
+                facetsCuttingEdge1.insert(fidx2);
+                _facet2points[1][fidx2].push_back(pit.first);
             }
+        }
+    }
+}
+
+void SetOperations::TriangulateMesh(const MeshKernel& cutMesh, int side)
+{
+    // Triangulate the cut facets in parallel
+    std::vector<std::pair<FacetIndex, const std::list<std::set<MeshPoint>::iterator>*>> cutFacets;
+    cutFacets.reserve(_facet2points[side].size());
+    for (const auto& it : _facet2points[side]) {
+        cutFacets.emplace_back(it.first, &it.second);
+    }
 
+    std::vector<std::vector<MeshGeomFacet>> triangulated(cutFacets.size());
+    int threads = int(std::max(std::thread::hardware_concurrency(), 1U));
+    parallel_for(cutFacets.size(), 100, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            triangulated[i] =
+                TriangulateFacet(cutMesh.GetFacet(cutFacets[i].first), *cutFacets[i].second);
+        }
+    });
 
+    // connect the new facets with the cut edges
+    for (std::size_t i = 0; i < cutFacets.size(); i++) {
+        FacetIndex fidx = cutFacets[i].first;
+        for (MeshGeomFacet& facet : triangulated[i]) {
             for (int j = 0; j < 3; j++) {
                 auto eit = _edges.find(Edge(facet._aclPoints[j], facet._aclPoints[(j + 1) % 3]));
 
@@ -416,6 +353,82 @@ void SetOperations::TriangulateMesh(const MeshKernel& cutMesh, int side)
     }
 }
 
+std::vector<MeshGeomFacet>
+SetOperations::TriangulateFacet(const MeshGeomFacet& f,
+                                const std::list<std::set<MeshPoint>::iterator>& cutPoints) const
+{
+    std::vector<Vector3f> points;
+    std::set<MeshPoint> pointsSet;
+
+    // facet corner points
+    for (int i = 0; i < 3; i++)  // NOLINT
+    {
+        pointsSet.insert(f._aclPoints[i]);
+        points.push_back(f._aclPoints[i]);
+    }
+
+    // triangulated facets
+    for (const auto& it : cutPoints) {
+        if (pointsSet.find(*it) == pointsSet.end()) {
+            pointsSet.insert(*it);
+            points.push_back(*it);
+        }
+    }
+
+    Vector3f normal = f.GetNormal();
+    Vector3f base = points[0];
+    Vector3f dirX = points[1] - points[0];
+    dirX.Normalize();
+    Vector3f dirY = dirX % normal;
+
+    // project points to 2D plane
+    std::vector<Vector3f> vertices;
+    for (const auto& it : points) {
+        Vector3f pv = it;
+        pv.TransformToCoordinateSystem(base, dirX, dirY);
+        vertices.push_back(pv);
+    }
+
+    DelaunayTriangulator tria;
+    tria.SetPolygon(vertices);
+    tria.TriangulatePolygon();
+
+    std::vector<MeshGeomFacet> result;
+    std::vector<MeshFacet> facets = tria.GetFacets();
+    for (auto& it : facets) {
+        if ((it._aulPoints[0] == it._aulPoints[1]) || (it._aulPoints[1] == it._aulPoints[2])
+            || (it._aulPoints[2] == it._aulPoints[0])) {  // two same triangle corner points
+            continue;
+        }
+
+        MeshGeomFacet facet(points[it._aulPoints[0]],
+                            points[it._aulPoints[1]],
+                            points[it._aulPoints[2]]);
+
+        float dist0 = facet._aclPoints[0].DistanceToLine(facet._aclPoints[1],
+                                                         facet._aclPoints[1] - facet._aclPoints[2]);
+        float dist1 = facet._aclPoints[1].DistanceToLine(facet._aclPoints[0],
+                                                         facet._aclPoints[0] - facet._aclPoints[2]);
+        float dist2 = facet._aclPoints[2].DistanceToLine(facet._aclPoints[0],
+                                                         facet._aclPoints[0] - facet._aclPoints[1]);
+
+        if ((dist0 < _minDistanceToPoint) || (dist1 < _minDistanceToPoint)
+            || (dist2 < _minDistanceToPoint)) {
+            continue;
+        }
+
+        facet.CalcNormal();
+        if ((facet.GetNormal() * f.GetNormal()) < 0.0F) {  // adjust normal
+            std::swap(facet._aclPoints[0], facet._aclPoints[1]);
+            facet.CalcNormal();
+        }
+
+        result.push_back(facet);
+    }
+
+    return result;
+}
+
 void SetOperations::CollectFacets(int side, float mult)
 {
     // float distSave = MeshDefinitions::_fMinPointDistance;
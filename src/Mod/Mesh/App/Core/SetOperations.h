@@ -185,6 +185,11 @@ private:
     void Cut(std::set<FacetIndex>& facetsCuttingEdge0, std::set<FacetIndex>& facetsCuttingEdge1);
     /** Trianglute each facets cut with its cutting points */
     void TriangulateMesh(const MeshKernel& cutMesh, int side);
+    /** Triangulates the facet \a f with the cut points lying on it. Can be called from
+     * several threads. */
+    std::vector<MeshGeomFacet>
+    TriangulateFacet(const MeshGeomFacet& f,
+                     const std::list<std::set<MeshPoint>::iterator>& cutPoints) const;
     /** search facets for adding (with region growing) */
     void CollectFacets(int side, float mult);
     /** close gap in the mesh */
@@ -10,6 +10,7 @@
 // * Comment out printf statements
 // * Fix compiler warnings
 // * Remove macros loop,i,j,k
+// * Allow to lock vertices and to keep the vertex indices (no final compaction)
 
 #include <vector>
 
@@ -85,13 +86,13 @@ class Simplify
 {
 public:
     struct Triangle { int v[3];double err[4];int deleted,dirty;vec3f n; };
-    struct Vertex { vec3f p;int tstart,tcount;SymmetricMatrix q;int border;};
+    struct Vertex { vec3f p;int tstart,tcount;SymmetricMatrix q;int border;int locked=0;};
     struct Ref { int tid,tvertex; };
     std::vector<Triangle> triangles;
     std::vector<Vertex> vertices;
     std::vector<Ref> refs;
 
-    void simplify_mesh(int target_count, double tolerance, double aggressiveness=7);
+    void simplify_mesh(int target_count, double tolerance, double aggressiveness=7, bool compact=true);
 
 private:
     // Helper functions
@@ -112,12 +113,16 @@ private:
 // aggressiveness : sharpness to increase the threshold.
 //                  5..8 are good numbers
 //                  more iterations yield higher quality
+// compact        : remove deleted triangles and unused vertices at the end.
+//                  If false the vertex indices stay valid and the deleted
+//                  triangles are only marked
 // If the passed tolerance is > 0 then this will be used to check
 // the quadratic error metric of all triangles. If none of them is below
 // the tolerance the algorithm will stop at this point. The number of the
 // remaining triangles usually will be higher than \a target_count
+// Edges with a locked vertex are never collapsed.
 //
-void Simplify::simplify_mesh(int target_count, double tolerance, double aggressiveness)
+void Simplify::simplify_mesh(int target_count, double tolerance, double aggressiveness, bool compact)
 {
     // init
     //printf("%s - start\n",__FUNCTION__);
@@ -198,6 +203,8 @@ void Simplify::simplify_mesh(int target_count, double tolerance, double aggressi
                     // Border check
                     if (v0.border != v1.border)
                         continue;
+                    if (v0.locked || v1.locked)
+                        continue;
 
                     // Compute vertex to collapse to
                     vec3f p;
@@ -246,7 +253,8 @@ void Simplify::simplify_mesh(int target_count, double tolerance, double aggressi
     }
 
     // clean up mesh
-    compact_mesh();
+    if (compact)
+        compact_mesh();
 
     // ready
     //int timeEnd=timeGetTime();
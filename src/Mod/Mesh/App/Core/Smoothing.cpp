@@ -22,13 +22,18 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
 #include <cmath>
+#include <numeric>
+#include <thread>
 #endif
 
 #include <Base/Tools.h>
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "CornerTable.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshKernel.h"
 #include "Smoothing.h"
@@ -169,98 +174,152 @@ LaplaceSmoothing::LaplaceSmoothing(MeshKernel& m)
     : AbstractSmoothing(m)
 {}
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it,
-                                double stepsize)
+struct LaplaceSmoothing::Neighbourhood
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_it, v_beg = points.begin(), v_end = points.end();
+    /// the neighbours of point i are indices[offsets[i]] to indices[offsets[i + 1] - 1]
+    std::vector<std::size_t> offsets;
+    std::vector<PointIndex> indices;
+    /// the new positions of a pass
+    std::vector<Base::Vector3f> moved;
+};
 
-    PointIndex pos = 0;
-    for (v_it = points.begin(); v_it != v_end; ++v_it, ++pos) {
-        const std::set<PointIndex>& cv = vv_it[pos];
-        if (cv.size() < 3) {
-            continue;
-        }
-        if (cv.size() != vf_it[pos].size()) {
-            // do nothing for border points
-            continue;
-        }
+namespace
+{
+constexpr std::size_t smoothingGrain = 4096;
 
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
+int smoothingThreads()
+{
+    return int(std::max(std::thread::hardware_concurrency(), 1U));
+}
 
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - v_it->x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - v_it->y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - v_it->z);
-        }
+Base::Vector3f umbrellaPoint(const MeshPointArray& points,
+                             PointIndex pos,
+                             const PointIndex* begin,
+                             const PointIndex* end,
+                             double stepsize)
+{
+    const MeshPoint& pnt = points[pos];
+    if (begin == end) {
+        return pnt;
+    }
 
-        float x = static_cast<float>(static_cast<double>(v_it->x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>(v_it->y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>(v_it->z) + stepsize * delz);
-        kernel.SetPoint(pos, x, y, z);
+    double w = 1.0 / double(end - begin);
+    double delx = 0.0, dely = 0.0, delz = 0.0;
+    for (const PointIndex* it = begin; it != end; ++it) {
+        delx += w * static_cast<double>(points[*it].x - pnt.x);
+        dely += w * static_cast<double>(points[*it].y - pnt.y);
+        delz += w * static_cast<double>(points[*it].z - pnt.z);
     }
+
+    float x = static_cast<float>(static_cast<double>(pnt.x) + stepsize * delx);
+    float y = static_cast<float>(static_cast<double>(pnt.y) + stepsize * dely);
+    float z = static_cast<float>(static_cast<double>(pnt.z) + stepsize * delz);
+    return Base::Vector3f(x, y, z);
 }
+}  // namespace
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it,
-                                double stepsize,
-                                const std::vector<PointIndex>& point_indices)
+void LaplaceSmoothing::InitNeighbourhood(Neighbourhood& nb) const
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_beg = points.begin();
+    const MeshCornerTable& table = kernel.GetCornerTable();
+    std::size_t numPoints = kernel.CountPoints();
+    int threads = smoothingThreads();
+
+    // border points and points with less than three neighbours are not moved
+    auto neighbours = [&table](PointIndex pos, std::vector<PointIndex>& cv) {
+        table.GetNeighbourPoints(pos, cv);
+        if (cv.size() < 3 || cv.size() != table.CountFacets(pos)) {
+            cv.clear();
+        }
+    };
 
-    for (PointIndex it : point_indices) {
-        const std::set<PointIndex>& cv = vv_it[it];
-        if (cv.size() < 3) {
-            continue;
+    nb.offsets.assign(numPoints + 1, 0);
+    parallel_for(numPoints, smoothingGrain, threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<PointIndex> cv;
+        for (std::size_t pos = begin; pos < end; pos++) {
+            neighbours(pos, cv);
+            nb.offsets[pos + 1] = cv.size();
         }
-        if (cv.size() != vf_it[it].size()) {
-            // do nothing for border points
-            continue;
+    });
+    std::partial_sum(nb.offsets.begin(), nb.offsets.end(), nb.offsets.begin());
+
+    nb.indices.resize(nb.offsets.back());
+    parallel_for(numPoints, smoothingGrain, threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<PointIndex> cv;
+        for (std::size_t pos = begin; pos < end; pos++) {
+            neighbours(pos, cv);
+            std::copy(cv.begin(), cv.end(), nb.indices.begin() + nb.offsets[pos]);
         }
+    });
+}
 
-        size_t n_count = cv.size();
-        double w {};
-        w = 1.0 / double(n_count);
-
-        double delx = 0.0, dely = 0.0, delz = 0.0;
-        std::set<PointIndex>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it != cv.end(); ++cv_it) {
-            delx += w * static_cast<double>((v_beg[*cv_it]).x - (v_beg[it]).x);
-            dely += w * static_cast<double>((v_beg[*cv_it]).y - (v_beg[it]).y);
-            delz += w * static_cast<double>((v_beg[*cv_it]).z - (v_beg[it]).z);
+void LaplaceSmoothing::Umbrella(Neighbourhood& nb, double stepsize)
+{
+    const MeshCore::MeshPointArray& points = kernel.GetPoints();
+    std::size_t numPoints = points.size();
+    int threads = smoothingThreads();
+
+    // all points of a pass are computed from the old positions
+    nb.moved.resize(numPoints);
+    parallel_for(numPoints, smoothingGrain, threads, [&](std::size_t begin, std::size_t end) {
+        const PointIndex* indices = nb.indices.data();
+        for (std::size_t pos = begin; pos < end; pos++) {
+            nb.moved[pos] = umbrellaPoint(points,
+                                          pos,
+                                          indices + nb.offsets[pos],
+                                          indices + nb.offsets[pos + 1],
+                                          stepsize);
         }
+    });
+    parallel_for(numPoints, smoothingGrain, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t pos = begin; pos < end; pos++) {
+            kernel.SetPoint(pos, nb.moved[pos]);
+        }
+    });
+}
 
-        float x = static_cast<float>(static_cast<double>((v_beg[it]).x) + stepsize * delx);
-        float y = static_cast<float>(static_cast<double>((v_beg[it]).y) + stepsize * dely);
-        float z = static_cast<float>(static_cast<double>((v_beg[it]).z) + stepsize * delz);
-        kernel.SetPoint(it, x, y, z);
+void LaplaceSmoothing::Umbrella(Neighbourhood& nb,
+                                double stepsize,
+                                const std::vector<PointIndex>& point_indices)
+{
+    const MeshCore::MeshPointArray& points = kernel.GetPoints();
+    int threads = smoothingThreads();
+
+    std::size_t count = point_indices.size();
+    nb.moved.resize(count);
+    parallel_for(count, smoothingGrain, threads, [&](std::size_t begin, std::size_t end) {
+        const PointIndex* indices = nb.indices.data();
+        for (std::size_t i = begin; i < end; i++) {
+            PointIndex pos = point_indices[i];
+            nb.moved[i] = umbrellaPoint(points,
+                                        pos,
+                                        indices + nb.offsets[pos],
+                                        indices + nb.offsets[pos + 1],
+                                        stepsize);
+        }
+    });
+    for (std::size_t i = 0; i < count; i++) {
+        kernel.SetPoint(point_indices[i], nb.moved[i]);
     }
 }
 
 void LaplaceSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    Neighbourhood nb;
+    InitNeighbourhood(nb);
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
+        Umbrella(nb, lambda);
     }
 }
 
 void LaplaceSmoothing::SmoothPoints(unsigned int iterations,
                                     const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    Neighbourhood nb;
+    InitNeighbourhood(nb);
 
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
+        Umbrella(nb, lambda, point_indices);
     }
 }
 
@@ -270,28 +329,28 @@ TaubinSmoothing::TaubinSmoothing(MeshKernel& m)
 
 void TaubinSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    Neighbourhood nb;
+    InitNeighbourhood(nb);
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda());
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro));
+        Umbrella(nb, GetLambda());
+        Umbrella(nb, -(GetLambda() + micro));
     }
 }
 
 void TaubinSmoothing::SmoothPoints(unsigned int iterations,
                                    const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    Neighbourhood nb;
+    InitNeighbourhood(nb);
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations + 1) / 2;  // two steps per iteration
     for (unsigned int i = 0; i < iterations; i++) {
-        Umbrella(vv_it, vf_it, GetLambda(), point_indices);
-        Umbrella(vv_it, vf_it, -(GetLambda() + micro), point_indices);
+        Umbrella(nb, GetLambda(), point_indices);
+        Umbrella(nb, -(GetLambda() + micro), point_indices);
     }
 }
 
@@ -329,92 +388,112 @@ void MedianFilterSmoothing::Smooth(unsigned int iterations)
 {
     std::vector<unsigned long> point_indices(kernel.CountPoints());
     std::generate(point_indices.begin(), point_indices.end(), Base::iotaGen<unsigned long>(0));
-    MeshCore::MeshRefFacetToFacets ff_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    const MeshCore::MeshCornerTable& table = kernel.GetCornerTable();
 
     for (unsigned int i = 0; i < iterations; i++) {
-        UpdatePoints(ff_it, vf_it, point_indices);
+        UpdatePoints(table, point_indices);
     }
 }
 
 void MedianFilterSmoothing::SmoothPoints(unsigned int iterations,
                                          const std::vector<PointIndex>& point_indices)
 {
-    MeshCore::MeshRefFacetToFacets ff_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    const MeshCore::MeshCornerTable& table = kernel.GetCornerTable();
 
     for (unsigned int i = 0; i < iterations; i++) {
-        UpdatePoints(ff_it, vf_it, point_indices);
+        UpdatePoints(table, point_indices);
     }
 }
 
-void MedianFilterSmoothing::UpdatePoints(const MeshRefFacetToFacets& ff_it,
-                                         const MeshRefPointToFacets& vf_it,
+void MedianFilterSmoothing::UpdatePoints(const MeshCornerTable& table,
                                          const std::vector<PointIndex>& point_indices)
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
     const MeshCore::MeshFacetArray& facets = kernel.GetFacets();
-
-    // Initialize the array with the real normals
-    std::vector<Base::Vector3d> faceNormals;
-    faceNormals.reserve(facets.size());
-    MeshCore::MeshFacetIterator iter(kernel);
-    for (iter.Init(); iter.More(); iter.Next()) {
-        faceNormals.emplace_back(Base::toVector<double>(iter->GetNormal()));
-    }
+    int threads = smoothingThreads();
+
+    // The geometry of the facets before any point is moved
+    std::vector<Base::Vector3d> realNormals(facets.size());
+    std::vector<Base::Vector3d> gravityPoints(facets.size());
+    std::vector<double> areas(facets.size());
+    parallel_for(facets.size(), smoothingGrain, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t pos = begin; pos < end; pos++) {
+            MeshGeomFacet face = kernel.GetFacet(pos);
+            realNormals[pos] = Base::toVector<double>(face.GetNormal());
+            gravityPoints[pos] = Base::toVector<double>(face.GetGravityPoint());
+            areas[pos] = face.Area();
+        }
+    });
 
     // Step 1: determine face normals
-    for (FacetIndex pos = 0; pos < facets.size(); pos++) {
-        iter.Set(pos);
-        Base::Vector3d refNormal = Base::toVector<double>(iter->GetNormal());
-        const std::set<FacetIndex>& cv = ff_it[pos];
-        const MeshCore::MeshFacet& facet = facets[pos];
-
+    std::vector<Base::Vector3d> faceNormals(facets.size());
+    parallel_for(facets.size(), smoothingGrain, threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<FacetIndex> cv;
         std::vector<AngleNormal> anglesWithFaces;
-        for (auto fi : cv) {
-            iter.Set(fi);
-            Base::Vector3d faceNormal = Base::toVector<double>(iter->GetNormal());
-            double angle = refNormal.GetAngle(faceNormal);
-
-            int absWeight = std::abs(weights);
-            if (absWeight > 1 && facet.IsNeighbour(fi)) {
-                if (weights < 0) {
-                    angle = -angle;
+        for (std::size_t pos = begin; pos < end; pos++) {
+            const Base::Vector3d& refNormal = realNormals[pos];
+            const MeshCore::MeshFacet& facet = facets[pos];
+
+            // all facets sharing a point with this facet
+            cv.clear();
+            for (PointIndex ptIndex : facet._aulPoints) {
+                table.VisitFacets(ptIndex, [&cv](FacetIndex fi) {
+                    cv.push_back(fi);
+                });
+            }
+            std::sort(cv.begin(), cv.end());
+            cv.erase(std::unique(cv.begin(), cv.end()), cv.end());
+
+            anglesWithFaces.clear();
+            for (auto fi : cv) {
+                const Base::Vector3d& faceNormal = realNormals[fi];
+                double angle = refNormal.GetAngle(faceNormal);
+
+                int absWeight = std::abs(weights);
+                if (absWeight > 1 && facet.IsNeighbour(fi)) {
+                    if (weights < 0) {
+                        angle = -angle;
+                    }
+                    for (int i = 0; i < absWeight; i++) {
+                        anglesWithFaces.emplace_back(angle, faceNormal);
+                    }
                 }
-                for (int i = 0; i < absWeight; i++) {
+                else {
                     anglesWithFaces.emplace_back(angle, faceNormal);
                 }
             }
-            else {
-                anglesWithFaces.emplace_back(angle, faceNormal);
-            }
-        }
 
-        faceNormals[pos] = find_median(anglesWithFaces);
-    }
+            faceNormals[pos] = find_median(anglesWithFaces);
+        }
+    });
 
     // Step 2: move vertices
-    for (auto pos : point_indices) {
-        Base::Vector3d P = Base::toVector<double>(points[pos]);
-        const std::set<FacetIndex>& cv = vf_it[pos];
-
-        double totalArea = 0.0;
-        Base::Vector3d totalvT;
-        for (auto it : cv) {
-            iter.Set(it);
-
-            double faceArea = iter->Area();
-            totalArea += faceArea;
-
-            Base::Vector3d C = Base::toVector<double>(iter->GetGravityPoint());
+    std::size_t count = point_indices.size();
+    std::vector<Base::Vector3f> moved(count);
+    parallel_for(count, smoothingGrain, threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<FacetIndex> cv;
+        for (std::size_t i = begin; i < end; i++) {
+            PointIndex pos = point_indices[i];
+            Base::Vector3d P = Base::toVector<double>(points[pos]);
+            table.GetFacets(pos, cv);
+
+            double totalArea = 0.0;
+            Base::Vector3d totalvT;
+            for (auto it : cv) {
+                double faceArea = areas[it];
+                totalArea += faceArea;
+
+                Base::Vector3d PC = gravityPoints[it] - P;
+                Base::Vector3d mT = faceNormals[it];
+                Base::Vector3d vT = (PC * mT) * mT;
+                totalvT += vT * faceArea;
+            }
 
-            Base::Vector3d PC = C - P;
-            Base::Vector3d mT = faceNormals[it];
-            Base::Vector3d vT = (PC * mT) * mT;
-            totalvT += vT * faceArea;
+            P = P + totalvT / totalArea;
+            moved[i] = Base::toVector<float>(P);
         }
-
-        P = P + totalvT / totalArea;
-        kernel.SetPoint(pos, Base::toVector<float>(P));
+    });
+    for (std::size_t i = 0; i < count; i++) {
+        kernel.SetPoint(point_indices[i], moved[i]);
     }
 }
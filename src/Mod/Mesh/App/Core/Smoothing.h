@@ -32,9 +32,7 @@
 namespace MeshCore
 {
 class MeshKernel;
-class MeshRefPointToPoints;
-class MeshRefPointToFacets;
-class MeshRefFacetToFacets;
+class MeshCornerTable;
 
 /** Base class for smoothing algorithms. */
 class MeshExport AbstractSmoothing
@@ -107,11 +105,12 @@ public:
     }
 
 protected:
-    void Umbrella(const MeshRefPointToPoints&, const MeshRefPointToFacets&, double);
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&,
-                  double,
-                  const std::vector<PointIndex>&);
+    /// flat neighbourhood of the points and the buffer with their new positions
+    struct Neighbourhood;
+    void InitNeighbourhood(Neighbourhood&) const;
+    /// Moves all points at once, each pass only uses the positions of the previous one
+    void Umbrella(Neighbourhood&, double);
+    void Umbrella(Neighbourhood&, double, const std::vector<PointIndex>&);
 
 private:
     double lambda {0.6307};
@@ -149,9 +148,7 @@ public:
     void SmoothPoints(unsigned int, const std::vector<PointIndex>&) override;
 
 private:
-    void UpdatePoints(const MeshRefFacetToFacets&,
-                      const MeshRefPointToFacets&,
-                      const std::vector<PointIndex>&);
+    void UpdatePoints(const MeshCornerTable&, const std::vector<PointIndex>&);
 
 private:
     int weights {1};
@@ -93,6 +93,7 @@ bool MeshTopoAlgorithm::InsertVertex(FacetIndex ulFacetPos, const Base::Vector3f
         _rclMesh._aclFacetArray[rclF._aulNeighbours[2]].ReplaceNeighbour(ulFacetPos, ulSize + 1);
     }
     // original facet
+    PointIndex ulOldPt = rclF._aulPoints[2];
     rclF._aulPoints[2] = ulPtInd;
     rclF._aulNeighbours[1] = ulSize;
     rclF._aulNeighbours[2] = ulSize + 1;
@@ -101,6 +102,10 @@ bool MeshTopoAlgorithm::InsertVertex(FacetIndex ulFacetPos, const Base::Vector3f
     _rclMesh._aclFacetArray.push_back(clNewFacet1);
     _rclMesh._aclFacetArray.push_back(clNewFacet2);
 
+    UpdateCornerTable(ulFacetPos, ulOldPt, ulPtInd);
+    UpdateCornerTable(ulSize);
+    UpdateCornerTable(ulSize + 1);
+
     return true;
 }
 
@@ -132,6 +137,7 @@ bool MeshTopoAlgorithm::SnapVertex(FacetIndex ulFacetPos, const Base::Vector3f&
                 cTria._aulNeighbours[1] = ulFacetPos;
                 rFace._aulNeighbours[i] = _rclMesh.CountFacets();
                 _rclMesh._aclFacetArray.push_back(cTria);
+                UpdateCornerTable(_rclMesh.CountFacets() - 1);
                 return true;
             }
         }
@@ -702,12 +708,17 @@ void MeshTopoAlgorithm::SwapEdge(FacetIndex ulFacetPos, FacetIndex ulNeighbour)
     }
 
     // swap the point and neighbour indices
+    PointIndex uOldF = rclF._aulPoints[(uFSide + 1) % 3];
+    PointIndex uOldN = rclN._aulPoints[(uNSide + 1) % 3];
     rclF._aulPoints[(uFSide + 1) % 3] = rclN._aulPoints[(uNSide + 2) % 3];
     rclN._aulPoints[(uNSide + 1) % 3] = rclF._aulPoints[(uFSide + 2) % 3];
     rclF._aulNeighbours[uFSide] = rclN._aulNeighbours[(uNSide + 1) % 3];
     rclN._aulNeighbours[uNSide] = rclF._aulNeighbours[(uFSide + 1) % 3];
     rclF._aulNeighbours[(uFSide + 1) % 3] = ulNeighbour;
     rclN._aulNeighbours[(uNSide + 1) % 3] = ulFacetPos;
+
+    UpdateCornerTable(ulFacetPos, uOldF, rclF._aulPoints[(uFSide + 1) % 3]);
+    UpdateCornerTable(ulNeighbour, uOldN, rclN._aulPoints[(uNSide + 1) % 3]);
 }
 
 bool MeshTopoAlgorithm::SplitEdge(FacetIndex ulFacetPos,
@@ -760,6 +771,8 @@ bool MeshTopoAlgorithm::SplitEdge(FacetIndex ulFacetPos,
     cNew2._aulNeighbours[2] = rclN._aulNeighbours[(uNSide + 2) % 3];
 
     // adjust the facets
+    PointIndex uOldF = rclF._aulPoints[(uFSide + 1) % 3];
+    PointIndex uOldN = rclN._aulPoints[uNSide];
     rclF._aulPoints[(uFSide + 1) % 3] = uPtInd;
     rclF._aulNeighbours[(uFSide + 1) % 3] = ulSize;
     rclN._aulPoints[uNSide] = uPtInd;
@@ -769,6 +782,11 @@ bool MeshTopoAlgorithm::SplitEdge(FacetIndex ulFacetPos,
     _rclMesh._aclFacetArray.push_back(cNew1);
     _rclMesh._aclFacetArray.push_back(cNew2);
 
+    UpdateCornerTable(ulFacetPos, uOldF, uPtInd);
+    UpdateCornerTable(ulNeighbour, uOldN, uPtInd);
+    UpdateCornerTable(ulSize);
+    UpdateCornerTable(ulSize + 1);
+
     return true;
 }
 
@@ -810,6 +828,9 @@ bool MeshTopoAlgorithm::SplitOpenEdge(FacetIndex ulFacetPos,
 
     // insert new facets
     _rclMesh._aclFacetArray.push_back(cNew);
+
+    UpdateCornerTable(ulFacetPos, cNew._aulPoints[1], uPtInd);
+    UpdateCornerTable(ulSize);
     return true;
 }
 
@@ -896,6 +917,22 @@ std::vector<FacetIndex> MeshTopoAlgorithm::GetFacetsToPoint(FacetIndex uFacetPos
     return aRefs;
 }
 
+void MeshTopoAlgorithm::UpdateCornerTable(FacetIndex facet)
+{
+    if (_rclMesh._cornerTable) {
+        _rclMesh._cornerTable->AddFacet(facet);
+    }
+}
+
+void MeshTopoAlgorithm::UpdateCornerTable(FacetIndex facet,
+                                          PointIndex oldPoint,
+                                          PointIndex newPoint)
+{
+    if (_rclMesh._cornerTable) {
+        _rclMesh._cornerTable->ReplacePoint(facet, oldPoint, newPoint);
+    }
+}
+
 void MeshTopoAlgorithm::Cleanup()
 {
     _rclMesh.RemoveInvalids();
@@ -950,6 +987,7 @@ bool MeshTopoAlgorithm::CollapseVertex(const VertexCollapse& vc)
 
     // adjust point and neighbour indices
     rFace1.Transpose(vc._point, ptIndex);
+    UpdateCornerTable(vc._circumFacets[0], vc._point, ptIndex);
     rFace1.ReplaceNeighbour(vc._circumFacets[1], neighbour1);
     rFace1.ReplaceNeighbour(vc._circumFacets[2], neighbour2);
 
@@ -997,6 +1035,7 @@ bool MeshTopoAlgorithm::CollapseEdge(FacetIndex ulFacetPos, FacetIndex ulNeighbo
     for (FacetIndex it : aRefs) {
         MeshFacet& rFace = _rclMesh._aclFacetArray[it];
         rFace.Transpose(ulPointPos, ulPointNew);
+        UpdateCornerTable(it, ulPointPos, ulPointNew);
     }
 
     // set the new neighbourhood
@@ -1128,6 +1167,7 @@ bool MeshTopoAlgorithm::CollapseEdge(const EdgeCollapse& ec)
     for (it = ec._changeFacets.begin(); it != ec._changeFacets.end(); ++it) {
         MeshFacet& f = _rclMesh._aclFacetArray[*it];
         f.Transpose(ec._fromPoint, ec._toPoint);
+        UpdateCornerTable(*it, ec._fromPoint, ec._toPoint);
     }
 
     _rclMesh._aclPointArray[ec._fromPoint].SetInvalid();
@@ -1157,12 +1197,14 @@ bool MeshTopoAlgorithm::CollapseFacet(FacetIndex ulFacetPos)
     for (FacetIndex it : aRefs) {
         MeshFacet& rFace = _rclMesh._aclFacetArray[it];
         rFace.Transpose(ulPointInd1, ulPointInd0);
+        UpdateCornerTable(it, ulPointInd1, ulPointInd0);
     }
 
     aRefs = GetFacetsToPoint(ulFacetPos, ulPointInd2);
     for (FacetIndex it : aRefs) {
         MeshFacet& rFace = _rclMesh._aclFacetArray[it];
         rFace.Transpose(ulPointInd2, ulPointInd0);
+        UpdateCornerTable(it, ulPointInd2, ulPointInd0);
     }
 
     // set the neighbourhood of the circumjacent facets
@@ -1337,6 +1379,8 @@ void MeshTopoAlgorithm::SplitFacetOnTwoEdges(FacetIndex ulFacetPos,
     rFace._aulPoints[v0] = cntPts2;
     rFace._aulPoints[v1] = cntPts1;
     rFace._aulNeighbours[v0] = cntFts + 1;
+    UpdateCornerTable(ulFacetPos, p0, cntPts2);
+    UpdateCornerTable(ulFacetPos, p1, cntPts1);
 
     float dist1 = Base::DistanceP2(_rclMesh._aclPointArray[p0], cP1);
     float dist2 = Base::DistanceP2(_rclMesh._aclPointArray[p1], cP2);
@@ -1399,6 +1443,7 @@ void MeshTopoAlgorithm::SplitFacet(FacetIndex ulFacetPos,
         FacetIndex size = _rclMesh._aclFacetArray.size();
 
         rFace._aulPoints[(side + 1) % 3] = Pn;
+        UpdateCornerTable(ulFacetPos, V1, Pn);
         FacetIndex N1 = rFace._aulNeighbours[(side + 1) % 3];
         if (N1 != FACET_INDEX_MAX) {
             _rclMesh._aclFacetArray[N1].ReplaceNeighbour(ulFacetPos, size);
@@ -1417,6 +1462,7 @@ void MeshTopoAlgorithm::AddFacet(PointIndex P1, PointIndex P2, PointIndex P3)
     facet._aulPoints[2] = P3;
 
     _rclMesh._aclFacetArray.push_back(facet);
+    UpdateCornerTable(_rclMesh._aclFacetArray.size() - 1);
 }
 
 void MeshTopoAlgorithm::AddFacet(PointIndex P1,
@@ -1435,6 +1481,7 @@ void MeshTopoAlgorithm::AddFacet(PointIndex P1,
     facet._aulNeighbours[2] = N3;
 
     _rclMesh._aclFacetArray.push_back(facet);
+    UpdateCornerTable(_rclMesh._aclFacetArray.size() - 1);
 }
 
 void MeshTopoAlgorithm::HarmonizeNeighbours(const std::vector<FacetIndex>& ulFacets)
@@ -1500,6 +1547,9 @@ void MeshTopoAlgorithm::SplitNeighbourFacet(FacetIndex ulFacetPos,
 
     // insert new facet
     _rclMesh._aclFacetArray.push_back(cNew);
+
+    UpdateCornerTable(ulNeighbour, cNew._aulPoints[1], uPtInd);
+    UpdateCornerTable(ulSize);
 }
 
 #if 0
@@ -1574,8 +1624,12 @@ bool MeshTopoAlgorithm::RemoveDegeneratedFacet(FacetIndex index)
                 unsigned short side = rNb.Side(index);
 
                 // bend the point indices
+                PointIndex uOldF = rFace._aulPoints[(j + 2) % 3];
+                PointIndex uOldN = rNb._aulPoints[(side + 1) % 3];
                 rFace._aulPoints[(j + 2) % 3] = rNb._aulPoints[(side + 2) % 3];
                 rNb._aulPoints[(side + 1) % 3] = rFace._aulPoints[j];
+                UpdateCornerTable(index, uOldF, rFace._aulPoints[(j + 2) % 3]);
+                UpdateCornerTable(uN1, uOldN, rNb._aulPoints[(side + 1) % 3]);
 
                 // set correct neighbourhood
                 FacetIndex uN2 = rFace._aulNeighbours[(j + 2) % 3];
@@ -1663,7 +1717,7 @@ void MeshTopoAlgorithm::FillupHoles(int level,
                                     std::list<std::vector<PointIndex>>& aFailed)
 {
     // get the facets to a point
-    MeshRefPointToFacets cPt2Fac(_rclMesh);
+    const MeshCornerTable& cornerTable = _rclMesh.GetCornerTable();
     MeshAlgorithm cAlgo(_rclMesh);
 
     MeshFacetArray newFacets;
@@ -1673,7 +1727,7 @@ void MeshTopoAlgorithm::FillupHoles(int level,
         MeshFacetArray cFacets;
         MeshPointArray cPoints;
         std::vector<PointIndex> bound = aBorder;
-        if (cAlgo.FillupHole(bound, cTria, cFacets, cPoints, level, &cPt2Fac)) {
+        if (cAlgo.FillupHole(bound, cTria, cFacets, cPoints, level, cornerTable)) {
             if (bound.front() == bound.back()) {
                 bound.pop_back();
             }
@@ -308,6 +308,11 @@ private:
     std::vector<FacetIndex> GetFacetsToPoint(FacetIndex uFacetPos, PointIndex uPointPos) const;
     /** \internal */
     PointIndex GetOrAddIndex(const MeshPoint& rclPoint);
+    /** Adds the appended facet \a facet to the corner table of the mesh if it exists. */
+    void UpdateCornerTable(FacetIndex facet);
+    /** Moves the corner of \a facet from \a oldPoint to \a newPoint in the corner table
+     * of the mesh if it exists. */
+    void UpdateCornerTable(FacetIndex facet, PointIndex oldPoint, PointIndex newPoint);
 
 private:
     MeshKernel& _rclMesh;
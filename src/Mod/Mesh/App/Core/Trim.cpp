@@ -24,6 +24,7 @@
 #ifndef _PreComp_
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 #endif
 
 #include <Base/Sequencer.h>
@@ -63,18 +64,22 @@ void MeshTrimming::CheckFacets(const MeshFacetGrid& rclGrid,
 
     // cut inner: use grid to accelerate search
     if (myInner) {
-        Base::BoundBox3f clBBox3d;
-        Base::BoundBox2d clViewBBox, clPolyBBox;
+        Base::BoundBox2d clPolyBBox;
+        std::vector<Base::BoundBox2d> aclViewBBoxes;
         std::vector<FacetIndex> aulAllElements;
 
         // BBox of polygon
         clPolyBBox = myPoly.CalcBoundBox();
         MeshGridIterator clGridIter(rclGrid);
-        // traverse all BBoxes
+        // project all BBoxes and test them at once
         for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-            clBBox3d = clGridIter.GetBoundBox();
-            clViewBBox = clBBox3d.ProjectBox(myProj);
-            if (clViewBBox.Intersect(clPolyBBox)) {
+            aclViewBBoxes.push_back(clGridIter.GetBoundBox().ProjectBox(myProj));
+        }
+        std::vector<unsigned char> hits(aclViewBBoxes.size());
+        clPolyBBox.Intersect(aclViewBBoxes.data(), aclViewBBoxes.size(), hits.data());
+        std::size_t cell = 0;
+        for (clGridIter.Init(); clGridIter.More(); clGridIter.Next(), cell++) {
+            if (hits[cell]) {
                 // save all elements in AllElements
                 clGridIter.GetElements(aulAllElements);
             }
@@ -85,11 +90,13 @@ void MeshTrimming::CheckFacets(const MeshFacetGrid& rclGrid,
         aulAllElements.erase(std::unique(aulAllElements.begin(), aulAllElements.end()),
                              aulAllElements.end());
 
+        std::vector<unsigned char> inside;
+        CheckPoints(myMesh.GetFacetPoints(aulAllElements), inside);
+
         Base::SequencerLauncher seq("Check facets for intersection...", aulAllElements.size());
 
         for (it = aulAllElements.begin(); it != aulAllElements.end(); ++it) {
-            MeshGeomFacet clFacet = myMesh.GetFacet(*it);
-            if (HasIntersection(clFacet)) {
+            if (HasIntersection(*it, inside)) {
                 raulFacets.push_back(*it);
             }
             seq.next();
@@ -97,9 +104,14 @@ void MeshTrimming::CheckFacets(const MeshFacetGrid& rclGrid,
     }
     // cut outer
     else {
+        std::vector<PointIndex> points(myMesh.CountPoints());
+        std::iota(points.begin(), points.end(), PointIndex(0));
+        std::vector<unsigned char> inside;
+        CheckPoints(points, inside);
+
         Base::SequencerLauncher seq("Check facets for intersection...", myMesh.CountFacets());
         for (clIter.Init(); clIter.More(); clIter.Next()) {
-            if (HasIntersection(*clIter)) {
+            if (HasIntersection(clIter.Position(), inside)) {
                 raulFacets.push_back(clIter.Position());
             }
             seq.next();
@@ -107,18 +119,45 @@ void MeshTrimming::CheckFacets(const MeshFacetGrid& rclGrid,
     }
 }
 
-bool MeshTrimming::HasIntersection(const MeshGeomFacet& rclFacet) const
+void MeshTrimming::CheckPoints(const std::vector<PointIndex>& points,
+                               std::vector<unsigned char>& inside) const
+{
+    // project every point only once and test them in blocks against the polygon
+    constexpr std::size_t blockSize = 4096;
+    std::vector<Base::Vector2d> block;
+    block.reserve(blockSize);
+    std::vector<unsigned char> flags(blockSize);
+    inside.assign(myMesh.CountPoints(), 0);
+    for (std::size_t start = 0; start < points.size(); start += blockSize) {
+        std::size_t size = std::min(blockSize, points.size() - start);
+        block.clear();
+        for (std::size_t i = 0; i < size; i++) {
+            Base::Vector3f clPt2d = myProj->operator()(myMesh._aclPointArray[points[start + i]]);
+            block.emplace_back(clPt2d.x, clPt2d.y);
+        }
+        myPoly.Contains(block.data(), size, flags.data());
+        for (std::size_t i = 0; i < size; i++) {
+            inside[points[start + i]] = flags[i];
+        }
+    }
+}
+
+bool MeshTrimming::HasIntersection(FacetIndex ulIndex,
+                                   const std::vector<unsigned char>& inside) const
 {
-    Base::Polygon2d clPoly;
-    Base::Line2d clFacLine, clPolyLine;
-    Base::Vector2d S;
     // is corner of facet inside the polygon
-    for (auto pnt : rclFacet._aclPoints) {
-        Base::Vector3f clPt2d = myProj->operator()(pnt);
-        if (myPoly.Contains(Base::Vector2d(clPt2d.x, clPt2d.y)) == myInner) {
+    const MeshFacet& rclFacet = myMesh._aclFacetArray[ulIndex];
+    for (PointIndex ptIndex : rclFacet._aulPoints) {
+        if ((inside[ptIndex] != 0) == myInner) {
             return true;
         }
+    }
 
+    Base::Polygon2d clPoly;
+    Base::Line2d clFacLine, clPolyLine;
+    Base::Vector2d S;
+    for (PointIndex ptIndex : rclFacet._aulPoints) {
+        Base::Vector3f clPt2d = myProj->operator()(myMesh._aclPointArray[ptIndex]);
         clPoly.Add(Base::Vector2d(clPt2d.x, clPt2d.y));
     }
 
@@ -67,9 +67,16 @@ public:
 
 private:
     /**
-     * Checks if the polygon cuts the facet
+     * Projects the given points and sets their flags in \a inside to 1 if they lie inside the
+     * polygon and to 0 otherwise. \a inside has a flag for every point of the mesh.
      */
-    bool HasIntersection(const MeshGeomFacet& rclFacet) const;
+    void CheckPoints(const std::vector<PointIndex>& points,
+                     std::vector<unsigned char>& inside) const;
+
+    /**
+     * Checks if the polygon cuts the facet, \a inside holds the flags set by CheckPoints()
+     */
+    bool HasIntersection(FacetIndex ulIndex, const std::vector<unsigned char>& inside) const;
 
     /**
      * Checks if a facet lies totally within a polygon
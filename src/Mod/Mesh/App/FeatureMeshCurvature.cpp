@@ -44,6 +44,10 @@ short Curvature::mustExecute() const
     if (Source.isTouched()) {
         return 1;
     }
+    // changes of other properties of the mesh feature don't affect the curvature
+    if (auto feat = dynamic_cast<Mesh::Feature*>(Source.getValue())) {
+        return feat->Mesh.isTouched() ? 1 : 0;
+    }
     if (Source.getValue() && Source.getValue()->isTouched()) {
         return 1;
     }
@@ -57,8 +61,14 @@ App::DocumentObjectExecReturn* Curvature::execute()
         return new App::DocumentObjectExecReturn("No mesh object attached.");
     }
 
-    // get all points
+    // the values are still valid if the mesh hasn't been modified since the last run
     const MeshCore::MeshKernel& rMesh = pcFeat->Mesh.getValue().getKernel();
+    if (meshRevision == pcFeat->Mesh.getRevision()
+        && CurvInfo.getSize() == static_cast<int>(rMesh.CountPoints())) {
+        return App::DocumentObject::StdReturn;
+    }
+
+    // get all points
     MeshCore::MeshCurvature meshCurv(rMesh);
     meshCurv.ComputePerVertex();
     const std::vector<MeshCore::CurvatureInfo>& curv = meshCurv.GetCurvature();
@@ -75,6 +85,7 @@ App::DocumentObjectExecReturn* Curvature::execute()
     }
 
     CurvInfo.setValues(values);
+    meshRevision = pcFeat->Mesh.getRevision();
 
     return App::DocumentObject::StdReturn;
 }
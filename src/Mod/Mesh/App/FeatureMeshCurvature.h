@@ -57,6 +57,10 @@ public:
         return "MeshGui::ViewProviderMeshCurvature";
     }
     //@}
+
+private:
+    /// revision of the mesh the curvature was computed for
+    unsigned long meshRevision {0};
 };
 
 }  // namespace Mesh
@@ -21,6 +21,9 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <atomic>
+#endif
 
 #include <Base/Converter.h>
 #include <Base/Exception.h>
@@ -45,6 +48,11 @@ TYPESYSTEM_SOURCE(Mesh::PropertyCurvatureList, App::PropertyLists)
 TYPESYSTEM_SOURCE(Mesh::PropertyMaterial, App::Property)
 TYPESYSTEM_SOURCE(Mesh::PropertyMeshKernel, App::PropertyComplexGeoData)
 
+namespace
+{
+std::atomic<unsigned long> meshRevision {0};
+}
+
 PropertyNormalList::PropertyNormalList() = default;
 
 void PropertyNormalList::setSize(int newSize)
@@ -209,9 +217,7 @@ void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
     aboutToSetValue();
 
     // Rotate the normal vectors
-    for (int ii = 0; ii < getSize(); ii++) {
-        set1Value(ii, rot * operator[](ii));
-    }
+    rot.multVec(_lValueList.data(), _lValueList.data(), _lValueList.size());
 
     hasSetValue();
 }
@@ -721,6 +727,7 @@ bool PropertyMaterial::isSame(const App::Property& other) const
 
 PropertyMeshKernel::PropertyMeshKernel()
     : _meshObject(new MeshObject())
+    , _revision(++meshRevision)
 {
     // Note: Normally this property is a member of a document object, i.e. the setValue()
     // method gets called in the constructor of a subclass of DocumentObject, e.g. Mesh::Feature.
@@ -738,6 +745,12 @@ PropertyMeshKernel::~PropertyMeshKernel()
     }
 }
 
+void PropertyMeshKernel::hasSetValue()
+{
+    _revision = ++meshRevision;
+    PropertyComplexGeoData::hasSetValue();
+}
+
 void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 {
     // use the tmp. object to guarantee that the referenced mesh is not destroyed
@@ -268,6 +268,14 @@ public:
     const MeshObject& getValue() const;
     const MeshObject* getValuePtr() const;
     unsigned int getMemSize() const override;
+    /** Returns a number that changes whenever the mesh has been modified. No two
+     * mesh properties share the same number, so it can be used as key for data
+     * derived from the mesh.
+     */
+    unsigned long getRevision() const
+    {
+        return _revision;
+    }
     //@}
 
     /** @name Getting basic geometric entities */
@@ -315,14 +323,22 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canSaveDocFileConcurrently() const override
+    {
+        return true;
+    }
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
     //@}
 
+protected:
+    void hasSetValue() override;
+
 private:
     Base::Reference<MeshObject> _meshObject;
     MeshPy* meshPyObject {nullptr};
+    unsigned long _revision;
 };
 
 }  // namespace Mesh
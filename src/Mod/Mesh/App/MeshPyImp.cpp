@@ -24,6 +24,7 @@
 
 #include <Base/Converter.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <Base/MatrixPy.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Stream.h>
@@ -69,10 +70,135 @@ private:
     FC_DISABLE_COPY_MOVE(MeshPropertyLock)
 };
 
+namespace
+{
+
+/** Creates a writable memoryview of shape (rows, 3) over a new bytearray. \a fill writes the
+ * 3 * rows values of type \a T to the passed pointer.
+ */
+template<typename T, typename Fill>
+Py::Object makeArray(std::size_t rows, const char* format, Fill fill)
+{
+    Py::Object bytes(PyByteArray_FromStringAndSize(nullptr, Py_ssize_t(3 * rows * sizeof(T))),
+                     true);
+    fill(reinterpret_cast<T*>(PyByteArray_AsString(bytes.ptr())));  // NOLINT
+
+    Py::Object view(PyMemoryView_FromObject(bytes.ptr()), true);
+    Py::Callable cast(view.getAttr("cast"));
+    if (rows == 0) {
+        // memoryview cannot cast to a shape with zeros
+        Py::Tuple castArgs(1);
+        castArgs.setItem(0, Py::String(format));
+        return cast.apply(castArgs);
+    }
+
+    Py::Tuple shape(2);
+    shape.setItem(0, Py::Long(static_cast<unsigned long>(rows)));
+    shape.setItem(1, Py::Long(3));
+    Py::Tuple castArgs(2);
+    castArgs.setItem(0, Py::String(format));
+    castArgs.setItem(1, shape);
+    return cast.apply(castArgs);
+}
+
+template<typename S, typename T>
+void copyValues(const Py_buffer& buf, std::vector<T>& values)
+{
+    const S* data = static_cast<const S*>(buf.buf);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<T>(data[i]);  // NOLINT
+    }
+}
+
+/** Reads the numbers of a C contiguous buffer with a multiple of three items. NumPy arrays of the
+ * common number types can be passed without conversion.
+ */
+template<typename T>
+std::vector<T> readArray(PyObject* obj, bool integral)
+{
+    Py_buffer buf;
+    if (PyObject_GetBuffer(obj, &buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        throw Py::Exception();
+    }
+
+    std::string format = buf.format ? buf.format : "B";
+    if (format.size() == 2 && format[0] == '@') {
+        format.erase(0, 1);
+    }
+
+    std::vector<T> values;
+    std::size_t count = buf.itemsize > 0 ? std::size_t(buf.len / buf.itemsize) : 0;
+    if (count % 3 != 0) {
+        PyBuffer_Release(&buf);
+        throw Py::ValueError("The number of items of the array must be a multiple of three");
+    }
+
+    values.resize(count);
+    bool ok = format.size() == 1;
+    if (ok) {
+        // clang-format off
+        switch (format[0]) {
+            case 'f': ok = !integral; if (ok) { copyValues<float>(buf, values); } break;
+            case 'd': ok = !integral; if (ok) { copyValues<double>(buf, values); } break;
+            case 'b': copyValues<signed char>(buf, values); break;
+            case 'B': copyValues<unsigned char>(buf, values); break;
+            case 'h': copyValues<short>(buf, values); break;
+            case 'H': copyValues<unsigned short>(buf, values); break;
+            case 'i': copyValues<int>(buf, values); break;
+            case 'I': copyValues<unsigned int>(buf, values); break;
+            case 'l': copyValues<long>(buf, values); break;
+            case 'L': copyValues<unsigned long>(buf, values); break;
+            case 'q': copyValues<long long>(buf, values); break;
+            case 'Q': copyValues<unsigned long long>(buf, values); break;
+            default: ok = false; break;
+        }
+        // clang-format on
+    }
+
+    PyBuffer_Release(&buf);
+    if (!ok) {
+        throw Py::TypeError(std::string("Unsupported item type of the array: ") + format);
+    }
+    return values;
+}
+
+void setArrays(MeshObject* mesh, PyObject* pyPoints, PyObject* pyFacets)
+{
+    std::vector<float> coords = readArray<float>(pyPoints, false);
+    std::vector<long long> indices = readArray<long long>(pyFacets, true);
+
+    MeshCore::MeshPointArray points;
+    points.reserve(coords.size() / 3);
+    for (std::size_t i = 0; i < coords.size(); i += 3) {
+        points.emplace_back(coords[i], coords[i + 1], coords[i + 2]);
+    }
+
+    auto numPoints = static_cast<long long>(points.size());
+    MeshCore::MeshFacetArray facets;
+    facets.reserve(indices.size() / 3);
+    for (std::size_t i = 0; i < indices.size(); i += 3) {
+        for (std::size_t j = i; j < i + 3; j++) {
+            if (indices[j] < 0 || indices[j] >= numPoints) {
+                throw Py::IndexError("Point index of a facet out of range");
+            }
+        }
+        facets.emplace_back(MeshCore::PointIndex(indices[i]),
+                            MeshCore::PointIndex(indices[i + 1]),
+                            MeshCore::PointIndex(indices[i + 2]));
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+    mesh->swapKernel(kernel, {});
+}
+
+}  // namespace
+
 int MeshPy::PyInit(PyObject* args, PyObject*)
 {
     PyObject* pcObj = nullptr;
-    if (!PyArg_ParseTuple(args, "|O", &pcObj)) {
+    PyObject* pcFacets = nullptr;
+    if (!PyArg_ParseTuple(args, "|OO", &pcObj, &pcFacets)) {
         return -1;
     }
 
@@ -85,6 +211,9 @@ int MeshPy::PyInit(PyObject* args, PyObject*)
         if (PyObject_TypeCheck(pcObj, &(MeshPy::Type))) {
             getMeshObjectPtr()->operator=(*static_cast<MeshPy*>(pcObj)->getMeshObjectPtr());
         }
+        else if (pcFacets && PyObject_CheckBuffer(pcObj) && PyObject_CheckBuffer(pcFacets)) {
+            setArrays(getMeshObjectPtr(), pcObj, pcFacets);
+        }
         else if (PyList_Check(pcObj)) {
             PyObject* ret = addFacets(args);
             bool ok = (ret != nullptr);
@@ -939,6 +1068,92 @@ PyObject* MeshPy::movePoint(PyObject* args)
     Py_Return;
 }
 
+PyObject* MeshPy::getPointArray(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const MeshObject* mesh = getMeshObjectPtr();
+        const MeshCore::MeshPointArray& points = mesh->getKernel().GetPoints();
+        Base::Matrix4D mat = mesh->getTransform();
+        bool identity = mat == Base::Matrix4D();
+        Py::Object array = makeArray<float>(points.size(), "f", [&](float* data) {
+            for (const auto& pnt : points) {
+                Base::Vector3f pos = pnt;
+                if (!identity) {
+                    pos = mat * pos;
+                }
+                *data++ = pos.x;  // NOLINT
+                *data++ = pos.y;  // NOLINT
+                *data++ = pos.z;  // NOLINT
+            }
+        });
+        return Py::new_reference_to(array);
+    }
+    PY_CATCH;
+}
+
+PyObject* MeshPy::getFacetArray(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const MeshCore::MeshFacetArray& facets = getMeshObjectPtr()->getKernel().GetFacets();
+        Py::Object array = makeArray<unsigned int>(facets.size(), "I", [&](unsigned int* data) {
+            for (const auto& face : facets) {
+                for (auto index : face._aulPoints) {
+                    *data++ = static_cast<unsigned int>(index);  // NOLINT
+                }
+            }
+        });
+        return Py::new_reference_to(array);
+    }
+    PY_CATCH;
+}
+
+PyObject* MeshPy::getFacetNormalArray(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const MeshObject* mesh = getMeshObjectPtr();
+        const MeshCore::MeshPointArray& points = mesh->getKernel().GetPoints();
+        const MeshCore::MeshFacetArray& facets = mesh->getKernel().GetFacets();
+
+        // compute the normals from the placed points so that a scaling is taken into account
+        Base::Matrix4D mat = mesh->getTransform();
+        std::vector<Base::Vector3f> placed(points.begin(), points.end());
+        if (mat != Base::Matrix4D()) {
+            for (auto& pnt : placed) {
+                pnt = mat * pnt;
+            }
+        }
+
+        Py::Object array = makeArray<float>(facets.size(), "f", [&](float* data) {
+            for (const auto& face : facets) {
+                const Base::Vector3f& p0 = placed[face._aulPoints[0]];
+                Base::Vector3f normal =
+                    (placed[face._aulPoints[1]] - p0) % (placed[face._aulPoints[2]] - p0);
+                normal.Normalize();
+                *data++ = normal.x;  // NOLINT
+                *data++ = normal.y;  // NOLINT
+                *data++ = normal.z;  // NOLINT
+            }
+        });
+        return Py::new_reference_to(array);
+    }
+    PY_CATCH;
+}
+
 PyObject* MeshPy::getPointNormals(PyObject* args)
 {
     if (!PyArg_ParseTuple(args, "")) {
@@ -2020,36 +2235,41 @@ PyObject* MeshPy::smooth(PyObject* args, PyObject* kwds)
     {
         MeshPropertyLock lock(this->parentProperty);
         MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
+        std::unique_ptr<MeshCore::AbstractSmoothing> smooth;
         if (strcmp(method, "Laplace") == 0) {
-            MeshCore::LaplaceSmoothing smooth(kernel);
+            auto laplace = std::make_unique<MeshCore::LaplaceSmoothing>(kernel);
             if (lambda > 0) {
-                smooth.SetLambda(lambda);
+                laplace->SetLambda(lambda);
             }
-            smooth.Smooth(iter);
+            smooth = std::move(laplace);
         }
         else if (strcmp(method, "Taubin") == 0) {
-            MeshCore::TaubinSmoothing smooth(kernel);
+            auto taubin = std::make_unique<MeshCore::TaubinSmoothing>(kernel);
             if (lambda > 0) {
-                smooth.SetLambda(lambda);
+                taubin->SetLambda(lambda);
             }
             if (micro > 0) {
-                smooth.SetMicro(micro);
+                taubin->SetMicro(micro);
             }
-            smooth.Smooth(iter);
+            smooth = std::move(taubin);
         }
         else if (strcmp(method, "PlaneFit") == 0) {
-            MeshCore::PlaneFitSmoothing smooth(kernel);
-            smooth.SetMaximum(maximum);
-            smooth.Smooth(iter);
+            auto planeFit = std::make_unique<MeshCore::PlaneFitSmoothing>(kernel);
+            planeFit->SetMaximum(maximum);
+            smooth = std::move(planeFit);
         }
         else if (strcmp(method, "MedianFilter") == 0) {
-            MeshCore::MedianFilterSmoothing smooth(kernel);
-            smooth.SetWeight(weight);
-            smooth.Smooth(iter);
+            auto median = std::make_unique<MeshCore::MedianFilterSmoothing>(kernel);
+            median->SetWeight(weight);
+            smooth = std::move(median);
         }
         else {
             throw Py::ValueError("No such smoothing algorithm");
         }
+
+        // the mesh is smoothed in place, see PyGILStateRelease
+        Base::PyGILStateRelease release;
+        smooth->Smooth(iter);
     }
     PY_CATCH;
 
@@ -4,6 +4,7 @@
 #  Copyright (c) 2007 Jürgen Riegel <juergen.riegel@web.de>
 #  LGPL
 
+import array
 import os
 import sys
 import io
@@ -708,6 +709,51 @@ class MeshSubElement(unittest.TestCase):
         pass
 
 
+class MeshArrays(unittest.TestCase):
+    def setUp(self):
+        self.mesh = Mesh.createBox(1.0, 2.0, 3.0)
+
+    def testPointArray(self):
+        points = self.mesh.getPointArray()
+        self.assertEqual(points.shape, (self.mesh.CountPoints, 3))
+        self.assertEqual(points.format, "f")
+        for i, p in enumerate(self.mesh.Points):
+            self.assertAlmostEqual(points[i, 0], p.x, 6)
+            self.assertAlmostEqual(points[i, 1], p.y, 6)
+            self.assertAlmostEqual(points[i, 2], p.z, 6)
+
+    def testPlacedPointArray(self):
+        self.mesh.Placement = FreeCAD.Placement(FreeCAD.Vector(10, 0, 0), FreeCAD.Rotation())
+        points = self.mesh.getPointArray()
+        self.assertAlmostEqual(points[0, 0], self.mesh.Points[0].x, 6)
+
+    def testFacetArray(self):
+        facets = self.mesh.getFacetArray()
+        normals = self.mesh.getFacetNormalArray()
+        self.assertEqual(facets.shape, (self.mesh.CountFacets, 3))
+        self.assertEqual(normals.shape, (self.mesh.CountFacets, 3))
+        for i, f in enumerate(self.mesh.Facets):
+            self.assertEqual(tuple(facets[i, k] for k in range(3)), f.PointIndices)
+            self.assertAlmostEqual(normals[i, 0], f.Normal.x, 6)
+            self.assertAlmostEqual(normals[i, 1], f.Normal.y, 6)
+            self.assertAlmostEqual(normals[i, 2], f.Normal.z, 6)
+
+    def testCreateFromArrays(self):
+        mesh = Mesh.Mesh(self.mesh.getPointArray(), self.mesh.getFacetArray())
+        self.assertEqual(mesh.CountPoints, self.mesh.CountPoints)
+        self.assertEqual(mesh.CountFacets, self.mesh.CountFacets)
+        self.assertAlmostEqual(mesh.Volume, self.mesh.Volume, 5)
+
+    def testCreateFromInvalidArrays(self):
+        points = array.array("d", [0, 0, 0, 1, 0, 0, 0, 1, 0])
+        with self.assertRaises(IndexError):
+            Mesh.Mesh(points, array.array("i", [0, 1, 3]))
+        with self.assertRaises(ValueError):
+            Mesh.Mesh(points, array.array("i", [0, 1]))
+        with self.assertRaises(TypeError):
+            Mesh.Mesh(points, points)
+
+
 class MeshProperty(unittest.TestCase):
     def setUp(self):
         self.doc = FreeCAD.newDocument("MeshTest")
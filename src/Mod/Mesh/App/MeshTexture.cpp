@@ -93,8 +93,7 @@ void MeshTexture::apply(const Mesh::MeshObject& mesh,
 
         if (binding == MeshCore::MeshIO::PER_VERTEX) {
             diffuseColor.reserve(points.size());
-            for (size_t index = 0; index < points.size(); index++) {
-                PointIndex pos = findIndex(points[index], max_dist);
+            for (PointIndex pos : findIndices(points, max_dist)) {
                 if (pos < countPointsRefMesh) {
                     diffuseColor.push_back(textureColor[pos]);
                 }
@@ -112,8 +111,7 @@ void MeshTexture::apply(const Mesh::MeshObject& mesh,
             // the values of the map give the point indices of the original mesh
             std::vector<PointIndex> pointMap;
             pointMap.reserve(points.size());
-            for (size_t index = 0; index < points.size(); index++) {
-                PointIndex pos = findIndex(points[index], max_dist);
+            for (PointIndex pos : findIndices(points, max_dist)) {
                 if (pos < countPointsRefMesh) {
                     pointMap.push_back(pos);
                 }
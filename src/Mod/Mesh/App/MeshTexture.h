@@ -83,15 +83,19 @@ private:
                const App::Color& defaultColor,
                float max_dist,
                MeshCore::Material& material);
-    PointIndex findIndex(const Base::Vector3f& p, float max_dist) const
+    std::vector<PointIndex> findIndices(const MeshCore::MeshPointArray& points,
+                                        float max_dist) const
     {
+        std::vector<Base::Vector3f> pts(points.begin(), points.end());
+        std::vector<PointIndex> indices;
         if (max_dist < 0.0F) {
-            return kdTree->FindExact(p);
+            kdTree->FindExact(pts, indices);
         }
-
-        Base::Vector3f n;
-        float dist {};
-        return kdTree->FindNearest(p, max_dist, n, dist);
+        else {
+            std::vector<float> dists;
+            kdTree->FindNearest(pts, max_dist, indices, dists);
+        }
+        return indices;
     }
 
 private:
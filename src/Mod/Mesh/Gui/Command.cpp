@@ -332,7 +332,7 @@ void CmdMeshImport::activated(int)
 {
     // use current path as default
     QStringList filter;
-    filter << QString::fromLatin1("%1 (*.stl *.ast *.bms *.obj *.off *.iv *.ply *.nas *.bdf)")
+    filter << QString::fromLatin1("%1 (*.stl *.ast *.bms *.obj *.off *.iv *.ply *.nas *.bdf *.glb *.gltf)")
                   .arg(QObject::tr("All Mesh Files"));
     filter << QString::fromLatin1("%1 (*.stl)").arg(QObject::tr("Binary STL"));
     filter << QString::fromLatin1("%1 (*.ast)").arg(QObject::tr("ASCII STL"));
@@ -342,6 +342,7 @@ void CmdMeshImport::activated(int)
     filter << QString::fromLatin1("%1 (*.iv)").arg(QObject::tr("Inventor V2.1 ASCII"));
     filter << QString::fromLatin1("%1 (*.ply)").arg(QObject::tr("Stanford Polygon"));
     filter << QString::fromLatin1("%1 (*.nas *.bdf)").arg(QObject::tr("NASTRAN"));
+    filter << QString::fromLatin1("%1 (*.glb *.gltf)").arg(QObject::tr("glTF Mesh"));
     filter << QString::fromLatin1("%1 (*.*)").arg(QObject::tr("All Files"));
 
     // Allow multi selection
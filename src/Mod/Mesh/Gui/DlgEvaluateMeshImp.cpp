@@ -518,27 +518,30 @@ void DlgEvaluateMeshImp::onAnalyzeOrientationButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalOrientation eval(rMesh);
-        std::vector<MeshCore::FacetIndex> inds = eval.GetIndices();
-
-        if (inds.empty()) {
-            d->ui.checkOrientationButton->setText(tr("No flipped normals"));
-            d->ui.checkOrientationButton->setChecked(false);
-            d->ui.repairOrientationButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshOrientation");
-        }
-        else {
-            d->ui.checkOrientationButton->setText(tr("%1 flipped normals").arg(inds.size()));
-            d->ui.checkOrientationButton->setChecked(true);
-            d->ui.repairOrientationButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshOrientation", eval.GetIndices());
-        }
+        showOrientationResult(eval.GetIndices());
 
         qApp->restoreOverrideCursor();
         d->ui.analyzeOrientationButton->setEnabled(true);
     }
 }
 
+void DlgEvaluateMeshImp::showOrientationResult(const std::vector<Mesh::FacetIndex>& inds)
+{
+    if (inds.empty()) {
+        d->ui.checkOrientationButton->setText(tr("No flipped normals"));
+        d->ui.checkOrientationButton->setChecked(false);
+        d->ui.repairOrientationButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshOrientation");
+    }
+    else {
+        d->ui.checkOrientationButton->setText(tr("%1 flipped normals").arg(inds.size()));
+        d->ui.checkOrientationButton->setChecked(true);
+        d->ui.repairOrientationButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+        addViewProvider("MeshGui::ViewProviderMeshOrientation", inds);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairOrientationButtonClicked()
 {
     if (d->meshFeature) {
@@ -600,53 +603,58 @@ void DlgEvaluateMeshImp::onAnalyzeNonmanifoldsButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalTopology f_eval(rMesh);
-        bool ok1 = f_eval.Evaluate();
-        bool ok2 = true;
-        std::vector<Mesh::PointIndex> point_indices;
+        std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>> edges;
+        if (!f_eval.Evaluate()) {
+            edges = f_eval.GetIndices();
+        }
 
+        std::vector<Mesh::PointIndex> point_indices;
         if (d->checkNonManfoldPoints) {
             MeshEvalPointManifolds p_eval(rMesh);
-            ok2 = p_eval.Evaluate();
-            if (!ok2) {
+            if (!p_eval.Evaluate()) {
                 point_indices = p_eval.GetIndices();
             }
         }
 
-        if (ok1 && ok2) {
-            d->ui.checkNonmanifoldsButton->setText(tr("No non-manifolds"));
-            d->ui.checkNonmanifoldsButton->setChecked(false);
-            d->ui.repairNonmanifoldsButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshNonManifolds");
-            removeViewProvider("MeshGui::ViewProviderMeshNonManifoldPoints");
-        }
-        else {
-            d->ui.checkNonmanifoldsButton->setText(
-                tr("%1 non-manifolds").arg(f_eval.CountManifolds() + point_indices.size()));
-            d->ui.checkNonmanifoldsButton->setChecked(true);
-            d->ui.repairNonmanifoldsButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
+        showNonmanifoldsResult(edges, point_indices);
 
-            if (!ok1) {
-                const std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>& inds =
-                    f_eval.GetIndices();
-                std::vector<Mesh::FacetIndex> indices;
-                indices.reserve(2 * inds.size());
-                std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>::const_iterator it;
-                for (it = inds.begin(); it != inds.end(); ++it) {
-                    indices.push_back(it->first);
-                    indices.push_back(it->second);
-                }
+        qApp->restoreOverrideCursor();
+        d->ui.analyzeNonmanifoldsButton->setEnabled(true);
+    }
+}
 
-                addViewProvider("MeshGui::ViewProviderMeshNonManifolds", indices);
-            }
+void DlgEvaluateMeshImp::showNonmanifoldsResult(
+    const std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>& edges,
+    const std::vector<Mesh::PointIndex>& point_indices)
+{
+    if (edges.empty() && point_indices.empty()) {
+        d->ui.checkNonmanifoldsButton->setText(tr("No non-manifolds"));
+        d->ui.checkNonmanifoldsButton->setChecked(false);
+        d->ui.repairNonmanifoldsButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshNonManifolds");
+        removeViewProvider("MeshGui::ViewProviderMeshNonManifoldPoints");
+    }
+    else {
+        d->ui.checkNonmanifoldsButton->setText(
+            tr("%1 non-manifolds").arg(edges.size() + point_indices.size()));
+        d->ui.checkNonmanifoldsButton->setChecked(true);
+        d->ui.repairNonmanifoldsButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
 
-            if (!ok2) {
-                addViewProvider("MeshGui::ViewProviderMeshNonManifoldPoints", point_indices);
+        if (!edges.empty()) {
+            std::vector<Mesh::FacetIndex> indices;
+            indices.reserve(2 * edges.size());
+            for (const auto& it : edges) {
+                indices.push_back(it.first);
+                indices.push_back(it.second);
             }
+
+            addViewProvider("MeshGui::ViewProviderMeshNonManifolds", indices);
         }
 
-        qApp->restoreOverrideCursor();
-        d->ui.analyzeNonmanifoldsButton->setEnabled(true);
+        if (!point_indices.empty()) {
+            addViewProvider("MeshGui::ViewProviderMeshNonManifoldPoints", point_indices);
+        }
     }
 }
 
@@ -715,38 +723,20 @@ void DlgEvaluateMeshImp::onAnalyzeIndicesButtonClicked()
         MeshEvalNeighbourhood nb(rMesh);
 
         if (!rf.Evaluate()) {
-            d->ui.checkIndicesButton->setText(tr("Invalid face indices"));
-            d->ui.checkIndicesButton->setChecked(true);
-            d->ui.repairIndicesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshIndices", rf.GetIndices());
+            showIndicesResult(tr("Invalid face indices"), rf.GetIndices());
         }
         else if (!rp.Evaluate()) {
-            d->ui.checkIndicesButton->setText(tr("Invalid point indices"));
-            d->ui.checkIndicesButton->setChecked(true);
-            d->ui.repairIndicesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
             // addViewProvider("MeshGui::ViewProviderMeshIndices", rp.GetIndices());
+            showIndicesResult(tr("Invalid point indices"), {});
         }
         else if (!cf.Evaluate()) {
-            d->ui.checkIndicesButton->setText(tr("Multiple point indices"));
-            d->ui.checkIndicesButton->setChecked(true);
-            d->ui.repairIndicesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshIndices", cf.GetIndices());
+            showIndicesResult(tr("Multiple point indices"), cf.GetIndices());
         }
         else if (!nb.Evaluate()) {
-            d->ui.checkIndicesButton->setText(tr("Invalid neighbour indices"));
-            d->ui.checkIndicesButton->setChecked(true);
-            d->ui.repairIndicesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshIndices", nb.GetIndices());
+            showIndicesResult(tr("Invalid neighbour indices"), nb.GetIndices());
         }
         else {
-            d->ui.checkIndicesButton->setText(tr("No invalid indices"));
-            d->ui.checkIndicesButton->setChecked(false);
-            d->ui.repairIndicesButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshIndices");
+            showIndicesResult(QString(), {});
         }
 
         qApp->restoreOverrideCursor();
@@ -754,6 +744,26 @@ void DlgEvaluateMeshImp::onAnalyzeIndicesButtonClicked()
     }
 }
 
+void DlgEvaluateMeshImp::showIndicesResult(const QString& defect,
+                                           const std::vector<Mesh::FacetIndex>& indices)
+{
+    if (!defect.isEmpty()) {
+        d->ui.checkIndicesButton->setText(defect);
+        d->ui.checkIndicesButton->setChecked(true);
+        d->ui.repairIndicesButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+        if (!indices.empty()) {
+            addViewProvider("MeshGui::ViewProviderMeshIndices", indices);
+        }
+    }
+    else {
+        d->ui.checkIndicesButton->setText(tr("No invalid indices"));
+        d->ui.checkIndicesButton->setChecked(false);
+        d->ui.repairIndicesButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshIndices");
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairIndicesButtonClicked()
 {
     if (d->meshFeature) {
@@ -802,27 +812,30 @@ void DlgEvaluateMeshImp::onAnalyzeDegeneratedButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalDegeneratedFacets eval(rMesh, d->epsilonDegenerated);
-        std::vector<Mesh::FacetIndex> degen = eval.GetIndices();
-
-        if (degen.empty()) {
-            d->ui.checkDegenerationButton->setText(tr("No degenerations"));
-            d->ui.checkDegenerationButton->setChecked(false);
-            d->ui.repairDegeneratedButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshDegenerations");
-        }
-        else {
-            d->ui.checkDegenerationButton->setText(tr("%1 degenerated faces").arg(degen.size()));
-            d->ui.checkDegenerationButton->setChecked(true);
-            d->ui.repairDegeneratedButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshDegenerations", degen);
-        }
+        showDegeneratedResult(eval.GetIndices());
 
         qApp->restoreOverrideCursor();
         d->ui.analyzeDegeneratedButton->setEnabled(true);
     }
 }
 
+void DlgEvaluateMeshImp::showDegeneratedResult(const std::vector<Mesh::FacetIndex>& degen)
+{
+    if (degen.empty()) {
+        d->ui.checkDegenerationButton->setText(tr("No degenerations"));
+        d->ui.checkDegenerationButton->setChecked(false);
+        d->ui.repairDegeneratedButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshDegenerations");
+    }
+    else {
+        d->ui.checkDegenerationButton->setText(tr("%1 degenerated faces").arg(degen.size()));
+        d->ui.checkDegenerationButton->setChecked(true);
+        d->ui.repairDegeneratedButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+        addViewProvider("MeshGui::ViewProviderMeshDegenerations", degen);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairDegeneratedButtonClicked()
 {
     if (d->meshFeature) {
@@ -872,28 +885,31 @@ void DlgEvaluateMeshImp::onAnalyzeDuplicatedFacesButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalDuplicateFacets eval(rMesh);
-        std::vector<Mesh::FacetIndex> dupl = eval.GetIndices();
-
-        if (dupl.empty()) {
-            d->ui.checkDuplicatedFacesButton->setText(tr("No duplicated faces"));
-            d->ui.checkDuplicatedFacesButton->setChecked(false);
-            d->ui.repairDuplicatedFacesButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshDuplicatedFaces");
-        }
-        else {
-            d->ui.checkDuplicatedFacesButton->setText(tr("%1 duplicated faces").arg(dupl.size()));
-            d->ui.checkDuplicatedFacesButton->setChecked(true);
-            d->ui.repairDuplicatedFacesButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-
-            addViewProvider("MeshGui::ViewProviderMeshDuplicatedFaces", dupl);
-        }
+        showDuplicatedFacesResult(eval.GetIndices());
 
         qApp->restoreOverrideCursor();
         d->ui.analyzeDuplicatedFacesButton->setEnabled(true);
     }
 }
 
+void DlgEvaluateMeshImp::showDuplicatedFacesResult(const std::vector<Mesh::FacetIndex>& dupl)
+{
+    if (dupl.empty()) {
+        d->ui.checkDuplicatedFacesButton->setText(tr("No duplicated faces"));
+        d->ui.checkDuplicatedFacesButton->setChecked(false);
+        d->ui.repairDuplicatedFacesButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshDuplicatedFaces");
+    }
+    else {
+        d->ui.checkDuplicatedFacesButton->setText(tr("%1 duplicated faces").arg(dupl.size()));
+        d->ui.checkDuplicatedFacesButton->setChecked(true);
+        d->ui.repairDuplicatedFacesButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+
+        addViewProvider("MeshGui::ViewProviderMeshDuplicatedFaces", dupl);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairDuplicatedFacesButtonClicked()
 {
     if (d->meshFeature) {
@@ -943,26 +959,31 @@ void DlgEvaluateMeshImp::onAnalyzeDuplicatedPointsButtonClicked()
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
         MeshEvalDuplicatePoints eval(rMesh);
-
-        if (eval.Evaluate()) {
-            d->ui.checkDuplicatedPointsButton->setText(tr("No duplicated points"));
-            d->ui.checkDuplicatedPointsButton->setChecked(false);
-            d->ui.repairDuplicatedPointsButton->setEnabled(false);
-            removeViewProvider("MeshGui::ViewProviderMeshDuplicatedPoints");
-        }
-        else {
-            d->ui.checkDuplicatedPointsButton->setText(tr("Duplicated points"));
-            d->ui.checkDuplicatedPointsButton->setChecked(true);
-            d->ui.repairDuplicatedPointsButton->setEnabled(true);
-            d->ui.repairAllTogether->setEnabled(true);
-            addViewProvider("MeshGui::ViewProviderMeshDuplicatedPoints", eval.GetIndices());
-        }
+        showDuplicatedPointsResult(eval.Evaluate() ? std::vector<Mesh::PointIndex>()
+                                                   : eval.GetIndices());
 
         qApp->restoreOverrideCursor();
         d->ui.analyzeDuplicatedPointsButton->setEnabled(true);
     }
 }
 
+void DlgEvaluateMeshImp::showDuplicatedPointsResult(const std::vector<Mesh::PointIndex>& dupl)
+{
+    if (dupl.empty()) {
+        d->ui.checkDuplicatedPointsButton->setText(tr("No duplicated points"));
+        d->ui.checkDuplicatedPointsButton->setChecked(false);
+        d->ui.repairDuplicatedPointsButton->setEnabled(false);
+        removeViewProvider("MeshGui::ViewProviderMeshDuplicatedPoints");
+    }
+    else {
+        d->ui.checkDuplicatedPointsButton->setText(tr("Duplicated points"));
+        d->ui.checkDuplicatedPointsButton->setChecked(true);
+        d->ui.repairDuplicatedPointsButton->setEnabled(true);
+        d->ui.repairAllTogether->setEnabled(true);
+        addViewProvider("MeshGui::ViewProviderMeshDuplicatedPoints", dupl);
+    }
+}
+
 void DlgEvaluateMeshImp::onRepairDuplicatedPointsButtonClicked()
 {
     if (d->meshFeature) {
@@ -1156,12 +1177,43 @@ void DlgEvaluateMeshImp::onRepairFoldsButtonClicked()
 
 void DlgEvaluateMeshImp::onAnalyzeAllTogetherClicked()
 {
-    onAnalyzeOrientationButtonClicked();
-    onAnalyzeDuplicatedFacesButtonClicked();
-    onAnalyzeDuplicatedPointsButtonClicked();
-    onAnalyzeNonmanifoldsButtonClicked();
-    onAnalyzeDegeneratedButtonClicked();
-    onAnalyzeIndicesButtonClicked();
+    // Run the standard checks in one parallel pass
+    if (d->meshFeature) {
+        d->ui.analyzeAllTogether->setEnabled(false);
+        qApp->processEvents();
+        qApp->setOverrideCursor(Qt::WaitCursor);
+
+        const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
+        MeshEvalDefects eval(rMesh, d->epsilonDegenerated, d->checkNonManfoldPoints);
+        eval.Evaluate();
+
+        showOrientationResult(eval.GetFlippedFacets());
+        showDuplicatedFacesResult(eval.GetDuplicatedFacets());
+        showDuplicatedPointsResult(eval.GetDuplicatedPoints());
+        showNonmanifoldsResult(eval.GetNonManifoldEdges(), eval.GetNonManifoldPoints());
+        showDegeneratedResult(eval.GetDegeneratedFacets());
+        switch (eval.GetIndexDefect()) {
+            case MeshEvalDefects::IndexDefect::FacetRange:
+                showIndicesResult(tr("Invalid face indices"), eval.GetInvalidIndices());
+                break;
+            case MeshEvalDefects::IndexDefect::PointRange:
+                showIndicesResult(tr("Invalid point indices"), {});
+                break;
+            case MeshEvalDefects::IndexDefect::CorruptedFacets:
+                showIndicesResult(tr("Multiple point indices"), eval.GetInvalidIndices());
+                break;
+            case MeshEvalDefects::IndexDefect::Neighbourhood:
+                showIndicesResult(tr("Invalid neighbour indices"), eval.GetInvalidIndices());
+                break;
+            default:
+                showIndicesResult(QString(), {});
+                break;
+        }
+
+        qApp->restoreOverrideCursor();
+        d->ui.analyzeAllTogether->setEnabled(true);
+    }
+
     onAnalyzeSelfIntersectionButtonClicked();
     if (d->enableFoldsCheck) {
         onAnalyzeFoldsButtonClicked();
@@ -24,6 +24,7 @@
 #define MESHGUI_DLG_EVALUATE_MESH_IMP_H
 
 #include <map>
+#include <vector>
 
 #include <QDialog>
 
@@ -137,6 +138,19 @@ protected:
     void removeViewProviders();
     void changeEvent(QEvent* e) override;
 
+    /** @name Show the results of the checks */
+    //@{
+    void showOrientationResult(const std::vector<Mesh::FacetIndex>& inds);
+    void showDuplicatedFacesResult(const std::vector<Mesh::FacetIndex>& dupl);
+    void showDuplicatedPointsResult(const std::vector<Mesh::PointIndex>& dupl);
+    void showNonmanifoldsResult(
+        const std::vector<std::pair<Mesh::FacetIndex, Mesh::FacetIndex>>& edges,
+        const std::vector<Mesh::PointIndex>& point_indices);
+    void showDegeneratedResult(const std::vector<Mesh::FacetIndex>& degen);
+    /// An empty \a defect means that all indices are valid
+    void showIndicesResult(const QString& defect, const std::vector<Mesh::FacetIndex>& indices);
+    //@}
+
 private:
     class Private;
     Private* d;
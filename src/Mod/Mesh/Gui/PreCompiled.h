@@ -40,9 +40,11 @@
 // standard
 #include <ios>
 #include <cfloat>
+#include <cstring>
 
 // STL
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <list>
 #include <map>
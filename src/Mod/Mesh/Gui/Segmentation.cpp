@@ -31,6 +31,7 @@
 #include <Mod/Mesh/App/Core/Curvature.h>
 #include <Mod/Mesh/App/Core/Segmentation.h>
 #include <Mod/Mesh/App/Core/Smoothing.h>
+#include <Mod/Mesh/App/FeatureMeshCurvature.h>
 #include <Mod/Mesh/App/MeshFeature.h>
 
 #include "Segmentation.h"
@@ -39,6 +40,43 @@
 
 using namespace MeshGui;
 
+namespace
+{
+// Takes the curvature of an up-to-date curvature object of the mesh or
+// computes it if there is none
+std::vector<MeshCore::CurvatureInfo> getCurvature(const Mesh::Feature* feature,
+                                                  const MeshCore::MeshKernel& kernel)
+{
+    for (auto obj : feature->getInList()) {
+        auto curv = dynamic_cast<Mesh::Curvature*>(obj);
+        if (!curv || curv->Source.getValue() != feature || curv->isTouched()
+            || curv->mustExecute()) {
+            continue;
+        }
+        const std::vector<Mesh::CurvatureInfo>& values = curv->CurvInfo.getValues();
+        if (values.size() != kernel.CountPoints()) {
+            continue;
+        }
+
+        std::vector<MeshCore::CurvatureInfo> info;
+        info.reserve(values.size());
+        for (const auto& it : values) {
+            MeshCore::CurvatureInfo ci;
+            ci.fMaxCurvature = it.fMaxCurvature;
+            ci.fMinCurvature = it.fMinCurvature;
+            ci.cMaxCurvDir = it.cMaxCurvDir;
+            ci.cMinCurvDir = it.cMinCurvDir;
+            info.push_back(ci);
+        }
+        return info;
+    }
+
+    MeshCore::MeshCurvature meshCurv(kernel);
+    meshCurv.ComputePerVertex();
+    return meshCurv.GetCurvature();
+}
+}  // namespace
+
 Segmentation::Segmentation(Mesh::Feature* mesh, QWidget* parent, Qt::WindowFlags fl)
     : QWidget(parent, fl)
     , ui(new Ui_Segmentation)
@@ -73,19 +111,25 @@ void Segmentation::accept()
     // make a copy because we might smooth the mesh before
     MeshCore::MeshKernel kernel = mesh->getKernel();
 
+    std::vector<MeshCore::CurvatureInfo> curvature;
     if (ui->checkBoxSmooth->isChecked()) {
         MeshCore::LaplaceSmoothing smoother(kernel);
         smoother.Smooth(ui->smoothSteps->value());
+        MeshCore::MeshCurvature meshCurv(kernel);
+        meshCurv.ComputePerVertex();
+        curvature = meshCurv.GetCurvature();
+    }
+    else {
+        // the curvature of the unmodified mesh might be known already
+        curvature = getCurvature(myMesh, kernel);
     }
 
     MeshCore::MeshSegmentAlgorithm finder(kernel);
-    MeshCore::MeshCurvature meshCurv(kernel);
-    meshCurv.ComputePerVertex();
 
     std::vector<MeshCore::MeshSurfaceSegmentPtr> segm;
     if (ui->groupBoxFree->isChecked()) {
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvatureFreeformSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvatureFreeformSegment>(curvature,
                                                                      ui->numFree->value(),
                                                                      ui->tol1Free->value(),
                                                                      ui->tol2Free->value(),
@@ -94,7 +138,7 @@ void Segmentation::accept()
     }
     if (ui->groupBoxCyl->isChecked()) {
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvatureCylindricalSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvatureCylindricalSegment>(curvature,
                                                                         ui->numCyl->value(),
                                                                         ui->tol1Cyl->value(),
                                                                         ui->tol2Cyl->value(),
@@ -102,14 +146,14 @@ void Segmentation::accept()
     }
     if (ui->groupBoxSph->isChecked()) {
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvatureSphericalSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvatureSphericalSegment>(curvature,
                                                                       ui->numSph->value(),
                                                                       ui->tolSph->value(),
                                                                       ui->crvSph->value()));
     }
     if (ui->groupBoxPln->isChecked()) {
         segm.emplace_back(
-            std::make_shared<MeshCore::MeshCurvaturePlanarSegment>(meshCurv.GetCurvature(),
+            std::make_shared<MeshCore::MeshCurvaturePlanarSegment>(curvature,
                                                                    ui->numPln->value(),
                                                                    ui->tolPln->value()));
     }
@@ -30,7 +30,10 @@
 
 #ifndef _PreComp_
 #include <algorithm>
+#include <array>
 #include <climits>
+#include <cstring>
+#include <map>
 #ifdef FC_OS_MACOSX
 #include <OpenGL/gl.h>
 #include <OpenGL/glext.h>
@@ -74,29 +77,49 @@ class MeshRenderer::Private
 {
 public:
     Gui::OpenGLMultiBuffer vertices;
+    Gui::OpenGLMultiBuffer colors;
     Gui::OpenGLMultiBuffer indices;
+    Gui::OpenGLMultiBuffer lodIndices;
     const SbColor* pcolors {nullptr};
     SoMaterialBindingElement::Binding matbinding {SoMaterialBindingElement::OVERALL};
     bool initialized {false};
+    bool sharedVertices {false};
+    std::size_t numIndices {0};
+    std::size_t numLodIndices {0};
+    float lodPointSize {1.0F};
+    // the colors as uploaded last, a context whose revision is out of date
+    // gets a copy of the whole array
+    std::vector<uint32_t> colorArray;
+    std::map<uint32_t, std::size_t> colorRevisions;
+    std::size_t colorRevision {0};
 
     Private();
     bool canRenderGLArray(SoGLRenderAction*) const;
     void generateGLArrays(SoGLRenderAction* action,
-                          SoMaterialBindingElement::Binding matbind,
                           std::vector<float>& vertex,
-                          std::vector<int32_t>& index);
+                          std::vector<int32_t>& index,
+                          bool shared,
+                          unsigned int triangleLimit);
+    void generateGLColors(SoGLRenderAction* action,
+                          SoMaterialBindingElement::Binding matbind,
+                          std::vector<uint32_t>& color);
     void renderFacesGLArray(SoGLRenderAction*);
     void renderCoordsGLArray(SoGLRenderAction*);
+    void renderLevelOfDetailGLArray(SoGLRenderAction*);
+    bool hasLevelOfDetail(SoGLRenderAction*) const;
     void update();
     bool needUpdate(SoGLRenderAction*);
 
 private:
-    void renderGLArray(SoGLRenderAction*, GLenum);
+    void setupColors(uint32_t ctx);
+    void renderGLArray(SoGLRenderAction*, Gui::OpenGLMultiBuffer&, std::size_t, GLenum);
 };
 
 MeshRenderer::Private::Private()
     : vertices(GL_ARRAY_BUFFER)
+    , colors(GL_ARRAY_BUFFER)
     , indices(GL_ELEMENT_ARRAY_BUFFER)
+    , lodIndices(GL_ELEMENT_ARRAY_BUFFER)
 {}
 
 bool MeshRenderer::Private::canRenderGLArray(SoGLRenderAction* action) const
@@ -116,17 +139,20 @@ bool MeshRenderer::Private::canRenderGLArray(SoGLRenderAction* action) const
 }
 
 void MeshRenderer::Private::generateGLArrays(SoGLRenderAction* action,
-                                             SoMaterialBindingElement::Binding matbind,
                                              std::vector<float>& vertex,
-                                             std::vector<int32_t>& index)
+                                             std::vector<int32_t>& index,
+                                             bool shared,
+                                             unsigned int triangleLimit)
 {
     if (vertex.empty() || index.empty()) {
         return;
     }
 
     // lazy initialization
-    vertices.setCurrentContext(action->getCacheContext());
-    indices.setCurrentContext(action->getCacheContext());
+    uint32_t ctx = action->getCacheContext();
+    vertices.setCurrentContext(ctx);
+    indices.setCurrentContext(ctx);
+    lodIndices.setCurrentContext(ctx);
 
     initialized = true;
     vertices.create();
@@ -139,37 +165,141 @@ void MeshRenderer::Private::generateGLArrays(SoGLRenderAction* action,
     indices.bind();
     indices.allocate(index.data(), index.size() * sizeof(int32_t));
     indices.release();
+    this->numIndices = index.size();
+    this->sharedVertices = shared;
+
+    // For interactive rendering of huge meshes only the points of every n-th
+    // triangle are drawn
+    std::size_t numTria = index.size() / 3;
+    this->numLodIndices = 0;
+    if (numTria > triangleLimit) {
+        std::size_t mod = numTria / triangleLimit + 1;
+        std::vector<int32_t> lod;
+        lod.reserve(3 * (numTria / mod + 1));
+        for (std::size_t i = 0; i < numTria; i += mod) {
+            lod.insert(lod.end(), index.begin() + 3 * i, index.begin() + 3 * i + 3);
+        }
+
+        lodIndices.create();
+        lodIndices.bind();
+        lodIndices.allocate(lod.data(), lod.size() * sizeof(int32_t));
+        lodIndices.release();
+        this->numLodIndices = lod.size();
+        this->lodPointSize = std::min<float>(static_cast<float>(mod), 3.0F);
+    }
+}
+
+void MeshRenderer::Private::generateGLColors(SoGLRenderAction* action,
+                                             SoMaterialBindingElement::Binding matbind,
+                                             std::vector<uint32_t>& color)
+{
     this->matbinding = matbind;
+    if (matbind == SoMaterialBindingElement::OVERALL) {
+        // the buffer doesn't contain color information
+        colorArray.clear();
+        colorRevision++;
+        return;
+    }
+
+    uint32_t ctx = action->getCacheContext();
+    colors.setCurrentContext(ctx);
+
+    auto it = colorRevisions.find(ctx);
+    bool partial = colors.isCreated(ctx) && it != colorRevisions.end()
+        && it->second == colorRevision && color.size() == colorArray.size();
+
+    colors.create();
+    colors.bind();
+    if (partial) {
+        // Upload the ranges of changed colors. Ranges that are only separated
+        // by a few unchanged colors are merged to reduce the number of calls.
+        const std::size_t maxGap = 1024;
+        std::size_t num = color.size();
+        std::size_t i = 0;
+        while (i < num) {
+            if (color[i] == colorArray[i]) {
+                i++;
+                continue;
+            }
+
+            std::size_t first = i;
+            std::size_t last = i;
+            for (std::size_t j = i + 1; j < num && j - last <= maxGap; j++) {
+                if (color[j] != colorArray[j]) {
+                    last = j;
+                }
+            }
+
+            colors.write(first * sizeof(uint32_t),
+                         color.data() + first,
+                         (last - first + 1) * sizeof(uint32_t));
+            i = last + 1;
+        }
+    }
+    else {
+        colors.allocate(color.data(), color.size() * sizeof(uint32_t));
+    }
+    colors.release();
+
+    colorArray.swap(color);
+    colorRevisions[ctx] = ++colorRevision;
 }
 
-void MeshRenderer::Private::renderGLArray(SoGLRenderAction* action, GLenum mode)
+void MeshRenderer::Private::setupColors(uint32_t ctx)
+{
+    colors.setCurrentContext(ctx);
+
+    // the colors have been changed in another context
+    auto it = colorRevisions.find(ctx);
+    if (!colors.isCreated(ctx) || it == colorRevisions.end() || it->second != colorRevision) {
+        colors.create();
+        colors.bind();
+        colors.allocate(colorArray.data(), colorArray.size() * sizeof(uint32_t));
+        colorRevisions[ctx] = colorRevision;
+    }
+    else {
+        colors.bind();
+    }
+
+    glEnableClientState(GL_COLOR_ARRAY);
+    glColorPointer(4, GL_UNSIGNED_BYTE, 0, nullptr);
+    colors.release();
+}
+
+void MeshRenderer::Private::renderGLArray(SoGLRenderAction* action,
+                                          Gui::OpenGLMultiBuffer& elements,
+                                          std::size_t count,
+                                          GLenum mode)
 {
     if (!initialized) {
         SoDebugError::postWarning("MeshRenderer", "not initialized");
         return;
     }
 
-    vertices.setCurrentContext(action->getCacheContext());
-    indices.setCurrentContext(action->getCacheContext());
+    uint32_t ctx = action->getCacheContext();
+    vertices.setCurrentContext(ctx);
+    elements.setCurrentContext(ctx);
 
     glEnableClientState(GL_VERTEX_ARRAY);
     glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_COLOR_ARRAY);
 
+    // normal and point of a vertex are interleaved, the colors are kept in
+    // their own buffer so that they can be changed independently
     vertices.bind();
-    indices.bind();
+    glNormalPointer(GL_FLOAT, 6 * sizeof(float), nullptr);
+    glVertexPointer(3,
+                    GL_FLOAT,
+                    6 * sizeof(float),
+                    reinterpret_cast<const GLvoid*>(3 * sizeof(float)));  // NOLINT
+    vertices.release();
 
     if (matbinding != SoMaterialBindingElement::OVERALL) {
-        glInterleavedArrays(GL_C4F_N3F_V3F, 0, nullptr);
-    }
-    else {
-        glInterleavedArrays(GL_N3F_V3F, 0, nullptr);
+        setupColors(ctx);
     }
 
-    glDrawElements(mode, indices.size() / sizeof(uint32_t), GL_UNSIGNED_INT, nullptr);
-
-    vertices.release();
-    indices.release();
+    elements.bind();
+    glDrawElements(mode, static_cast<GLsizei>(count), GL_UNSIGNED_INT, nullptr);
+    elements.release();
 
     glDisableClientState(GL_COLOR_ARRAY);
     glDisableClientState(GL_NORMAL_ARRAY);
@@ -178,18 +308,32 @@ void MeshRenderer::Private::renderGLArray(SoGLRenderAction* action, GLenum mode)
 
 void MeshRenderer::Private::renderFacesGLArray(SoGLRenderAction* action)
 {
-    renderGLArray(action, GL_TRIANGLES);
+    renderGLArray(action, indices, numIndices, GL_TRIANGLES);
 }
 
 void MeshRenderer::Private::renderCoordsGLArray(SoGLRenderAction* action)
 {
-    renderGLArray(action, GL_POINTS);
+    renderGLArray(action, indices, numIndices, GL_POINTS);
+}
+
+void MeshRenderer::Private::renderLevelOfDetailGLArray(SoGLRenderAction* action)
+{
+    glPointSize(lodPointSize);
+    renderGLArray(action, lodIndices, numLodIndices, GL_POINTS);
+}
+
+bool MeshRenderer::Private::hasLevelOfDetail(SoGLRenderAction* action) const
+{
+    return numLodIndices > 0 && lodIndices.isCreated(action->getCacheContext());
 }
 
 void MeshRenderer::Private::update()
 {
     vertices.destroy();
+    colors.destroy();
     indices.destroy();
+    lodIndices.destroy();
+    colorRevisions.clear();
 }
 
 bool MeshRenderer::Private::needUpdate(SoGLRenderAction* action)
@@ -203,6 +347,7 @@ class MeshRenderer::Private
 public:
     std::vector<int32_t> index_array;
     std::vector<float> vertex_array;
+    std::vector<uint32_t> color_array;
     const SbColor* pcolors;
     SoMaterialBindingElement::Binding matbinding;
 
@@ -213,17 +358,30 @@ public:
 
     bool canRenderGLArray(SoGLRenderAction*) const;
     void generateGLArrays(SoGLRenderAction* action,
-                          SoMaterialBindingElement::Binding matbind,
                           std::vector<float>& vertex,
-                          std::vector<int32_t>& index);
+                          std::vector<int32_t>& index,
+                          bool shared,
+                          unsigned int triangleLimit);
+    void generateGLColors(SoGLRenderAction* action,
+                          SoMaterialBindingElement::Binding matbind,
+                          std::vector<uint32_t>& color);
     void renderFacesGLArray(SoGLRenderAction* action);
     void renderCoordsGLArray(SoGLRenderAction* action);
+    void renderLevelOfDetailGLArray(SoGLRenderAction*)
+    {}
+    bool hasLevelOfDetail(SoGLRenderAction*) const
+    {
+        return false;
+    }
     void update()
     {}
     bool needUpdate(SoGLRenderAction*)
     {
         return false;
     }
+
+private:
+    void renderGLArray(GLenum mode);
 };
 
 bool MeshRenderer::Private::canRenderGLArray(SoGLRenderAction*) const
@@ -232,9 +390,10 @@ bool MeshRenderer::Private::canRenderGLArray(SoGLRenderAction*) const
 }
 
 void MeshRenderer::Private::generateGLArrays(SoGLRenderAction*,
-                                             SoMaterialBindingElement::Binding matbind,
                                              std::vector<float>& vertex,
-                                             std::vector<int32_t>& index)
+                                             std::vector<int32_t>& index,
+                                             bool,
+                                             unsigned int)
 {
     if (vertex.empty() || index.empty()) {
         return;
@@ -245,46 +404,43 @@ void MeshRenderer::Private::generateGLArrays(SoGLRenderAction*,
 
     this->index_array.swap(index);
     this->vertex_array.swap(vertex);
+}
+
+void MeshRenderer::Private::generateGLColors(SoGLRenderAction*,
+                                             SoMaterialBindingElement::Binding matbind,
+                                             std::vector<uint32_t>& color)
+{
+    this->color_array.swap(color);
     this->matbinding = matbind;
 }
 
-void MeshRenderer::Private::renderFacesGLArray(SoGLRenderAction* action)
+void MeshRenderer::Private::renderGLArray(GLenum mode)
 {
-    (void)action;
     int cnt = index_array.size();
 
     glEnableClientState(GL_NORMAL_ARRAY);
     glEnableClientState(GL_VERTEX_ARRAY);
 
+    glInterleavedArrays(GL_N3F_V3F, 0, &(vertex_array[0]));
     if (matbinding != SoMaterialBindingElement::OVERALL) {
-        glInterleavedArrays(GL_C4F_N3F_V3F, 0, &(vertex_array[0]));
-    }
-    else {
-        glInterleavedArrays(GL_N3F_V3F, 0, &(vertex_array[0]));
+        glEnableClientState(GL_COLOR_ARRAY);
+        glColorPointer(4, GL_UNSIGNED_BYTE, 0, &(color_array[0]));
     }
-    glDrawElements(GL_TRIANGLES, cnt, GL_UNSIGNED_INT, &(index_array[0]));
+    glDrawElements(mode, cnt, GL_UNSIGNED_INT, &(index_array[0]));
 
+    glDisableClientState(GL_COLOR_ARRAY);
     glDisableClientState(GL_VERTEX_ARRAY);
     glDisableClientState(GL_NORMAL_ARRAY);
 }
 
-void MeshRenderer::Private::renderCoordsGLArray(SoGLRenderAction*)
+void MeshRenderer::Private::renderFacesGLArray(SoGLRenderAction*)
 {
-    int cnt = index_array.size();
-
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-    if (matbinding != SoMaterialBindingElement::OVERALL) {
-        glInterleavedArrays(GL_C4F_N3F_V3F, 0, &(vertex_array[0]));
-    }
-    else {
-        glInterleavedArrays(GL_N3F_V3F, 0, &(vertex_array[0]));
-    }
-    glDrawElements(GL_POINTS, cnt, GL_UNSIGNED_INT, &(index_array[0]));
+    renderGLArray(GL_TRIANGLES);
+}
 
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
+void MeshRenderer::Private::renderCoordsGLArray(SoGLRenderAction*)
+{
+    renderGLArray(GL_POINTS);
 }
 #else
 class MeshRenderer::Private
@@ -303,14 +459,25 @@ public:
         return false;
     }
     void generateGLArrays(SoGLRenderAction*,
-                          SoMaterialBindingElement::Binding,
                           std::vector<float>&,
-                          std::vector<int32_t>&)
+                          std::vector<int32_t>&,
+                          bool,
+                          unsigned int)
+    {}
+    void generateGLColors(SoGLRenderAction*,
+                          SoMaterialBindingElement::Binding,
+                          std::vector<uint32_t>&)
     {}
     void renderFacesGLArray(SoGLRenderAction*)
     {}
     void renderCoordsGLArray(SoGLRenderAction*)
     {}
+    void renderLevelOfDetailGLArray(SoGLRenderAction*)
+    {}
+    bool hasLevelOfDetail(SoGLRenderAction*) const
+    {
+        return false;
+    }
     void update()
     {}
     bool needUpdate(SoGLRenderAction*)
@@ -340,15 +507,23 @@ bool MeshRenderer::needUpdate(SoGLRenderAction* action)
 }
 
 void MeshRenderer::generateGLArrays(SoGLRenderAction* action,
-                                    SoMaterialBindingElement::Binding matbind,
                                     std::vector<float>& vertex,
-                                    std::vector<int32_t>& index)
+                                    std::vector<int32_t>& index,
+                                    bool sharedVertices,
+                                    unsigned int triangleLimit)
+{
+    p->generateGLArrays(action, vertex, index, sharedVertices, triangleLimit);
+}
+
+void MeshRenderer::generateGLColors(SoGLRenderAction* action,
+                                    SoMaterialBindingElement::Binding matbind,
+                                    std::vector<uint32_t>& color)
 {
     SoGLLazyElement* gl = SoGLLazyElement::getInstance(action->getState());
     if (gl) {
         p->pcolors = gl->getDiffusePointer();
     }
-    p->generateGLArrays(action, matbind, vertex, index);
+    p->generateGLColors(action, matbind, color);
 }
 
 // Implementation                            | FPS
@@ -381,6 +556,17 @@ void MeshRenderer::renderFacesGLArray(SoGLRenderAction* action)
     p->renderFacesGLArray(action);
 }
 
+// Renders the points of every n-th triangle if the mesh exceeds the triangle limit
+void MeshRenderer::renderLevelOfDetailGLArray(SoGLRenderAction* action)
+{
+    p->renderLevelOfDetailGLArray(action);
+}
+
+bool MeshRenderer::hasLevelOfDetail(SoGLRenderAction* action) const
+{
+    return p->hasLevelOfDetail(action);
+}
+
 bool MeshRenderer::canRenderGLArray(SoGLRenderAction* action) const
 {
     return p->canRenderGLArray(action);
@@ -465,6 +651,8 @@ SoFCIndexedFaceSet::SoFCIndexedFaceSet()
     SO_NODE_CONSTRUCTOR(SoFCIndexedFaceSet);
     SO_NODE_ADD_FIELD(updateGLArray, (false));
     updateGLArray.setFieldType(SoField::EVENTOUT_FIELD);
+    SO_NODE_ADD_FIELD(updateGLColor, (false));
+    updateGLColor.setFieldType(SoField::EVENTOUT_FIELD);
     setName(SoFCIndexedFaceSet::getClassTypeId().getName());
 }
 
@@ -504,17 +692,31 @@ void SoFCIndexedFaceSet::GLRender(SoGLRenderAction* action)
     if (useVBO) {
         if (updateGLArray.getValue()) {
             updateGLArray.setValue(false);
+            updateGLColor.setValue(false);
             render.update();
             generateGLArrays(action);
         }
         else if (render.needUpdate(action)) {
+            updateGLColor.setValue(false);
             generateGLArrays(action);
         }
+        else if (updateGLColor.getValue()) {
+            // the geometry is unchanged, only upload the modified colors
+            updateGLColor.setValue(false);
+            generateGLColors(action);
+        }
 
         if (render.matchMaterial(state)) {
             SoMaterialBundle mb(action);
             mb.sendFirst();
-            render.renderFacesGLArray(action);
+            unsigned int num = this->coordIndex.getNum() / 4;
+            if (Gui::SoFCInteractiveElement::get(state) && num > this->renderTriangleLimit
+                && render.hasLevelOfDetail(action)) {
+                render.renderLevelOfDetailGLArray(action);
+            }
+            else {
+                render.renderFacesGLArray(action);
+            }
         }
         else {
             drawFaces(action);
@@ -723,9 +925,7 @@ void SoFCIndexedFaceSet::generateGLArrays(SoGLRenderAction* action)
     const SoCoordinateElement* coords = nullptr;
     const SbVec3f* normals = nullptr;
     const int32_t* cindices = nullptr;
-    const SbColor* pcolors = nullptr;
-    const float* transp = nullptr;
-    int numindices = 0, numcolors = 0, numtransp = 0;
+    int numindices = 0;
     const int32_t* nindices = nullptr;
     const int32_t* tindices = nullptr;
     const int32_t* mindices = nullptr;
@@ -747,144 +947,43 @@ void SoFCIndexedFaceSet::generateGLArrays(SoGLRenderAction* action)
 
     const SbVec3f* points = coords->getArrayPtr3();
 
-    SoMaterialBindingElement::Binding matbind = SoMaterialBindingElement::get(state);
-    SoGLLazyElement* gl = SoGLLazyElement::getInstance(state);
-    if (gl) {
-        pcolors = gl->getDiffusePointer();
-        numcolors = gl->getNumDiffuse();
-        transp = gl->getTransparencyPointer();
-        numtransp = gl->getNumTransparencies();
-        Q_UNUSED(numtransp);
-    }
-
     std::vector<float> face_vertices;
     std::vector<int32_t> face_indices;
+    bool shared = false;
 
     std::size_t numTria = numindices / 4;
 
-    if (!mindices && matbind == SoMaterialBindingElement::PER_VERTEX_INDEXED) {
-        mindices = cindices;
-    }
-
     SoNormalBindingElement::Binding normbind = SoNormalBindingElement::get(state);
     if (normbind == SoNormalBindingElement::PER_VERTEX_INDEXED) {
-        if (matbind == SoMaterialBindingElement::PER_FACE) {
-            face_vertices.reserve(3 * numTria
-                                  * 10);  // duplicate each vertex (rgba, normal, vertex)
-            face_indices.resize(3 * numTria);
-
-            if (numcolors != static_cast<int>(numTria)) {
-                SoDebugError::postWarning(
-                    "SoFCIndexedFaceSet::generateGLArrays",
-                    "The number of faces (%d) doesn't match with the number of colors (%d).",
-                    numTria,
-                    numcolors);
-            }
-
-            // the nindices must have the length of numindices
-            int32_t vertex = 0;
-            int index = 0;
-            float t = transp ? transp[0] : 0;
-            for (std::size_t i = 0; i < numTria; i++) {
-                const SbColor& c = pcolors[i];
-                for (int j = 0; j < 3; j++) {
-                    face_vertices.push_back(c[0]);
-                    face_vertices.push_back(c[1]);
-                    face_vertices.push_back(c[2]);
-                    face_vertices.push_back(t);
-
-                    const SbVec3f& n = normals[nindices[index]];
-                    face_vertices.push_back(n[0]);
-                    face_vertices.push_back(n[1]);
-                    face_vertices.push_back(n[2]);
-
-                    const SbVec3f& p = points[cindices[index]];
-                    face_vertices.push_back(p[0]);
-                    face_vertices.push_back(p[1]);
-                    face_vertices.push_back(p[2]);
-
-                    face_indices[vertex] = vertex;
-                    vertex++;
-                    index++;
-                }
-                index++;
-            }
-        }
-        else if (matbind == SoMaterialBindingElement::PER_VERTEX_INDEXED) {
-            face_vertices.reserve(3 * numTria
-                                  * 10);  // duplicate each vertex (rgba, normal, vertex)
-            face_indices.resize(3 * numTria);
-
-            if (numcolors != coords->getNum()) {
-                SoDebugError::postWarning(
-                    "SoFCIndexedFaceSet::generateGLArrays",
-                    "The number of points (%d) doesn't match with the number of colors (%d).",
-                    coords->getNum(),
-                    numcolors);
-            }
+        // duplicate each vertex (normal, vertex) so that colors can be set per face
+        face_vertices.reserve(3 * numTria * 6);
+        face_indices.resize(3 * numTria);
 
-            // the nindices must have the length of numindices
-            int32_t vertex = 0;
-            int index = 0;
-            float t = transp ? transp[0] : 0;
-            for (std::size_t i = 0; i < numTria; i++) {
-                for (int j = 0; j < 3; j++) {
-                    const SbColor& c = pcolors[mindices[index]];
-                    face_vertices.push_back(c[0]);
-                    face_vertices.push_back(c[1]);
-                    face_vertices.push_back(c[2]);
-                    face_vertices.push_back(t);
-
-                    const SbVec3f& n = normals[nindices[index]];
-                    face_vertices.push_back(n[0]);
-                    face_vertices.push_back(n[1]);
-                    face_vertices.push_back(n[2]);
-
-                    const SbVec3f& p = points[cindices[index]];
-                    face_vertices.push_back(p[0]);
-                    face_vertices.push_back(p[1]);
-                    face_vertices.push_back(p[2]);
-
-                    face_indices[vertex] = vertex;
-                    vertex++;
-                    index++;
-                }
-                index++;
-            }
-        }
-        else {
-            // only an overall material
-            matbind = SoMaterialBindingElement::OVERALL;
-
-            face_vertices.reserve(3 * numTria * 6);  // duplicate each vertex (normal, vertex)
-            face_indices.resize(3 * numTria);
-
-            // the nindices must have the length of numindices
-            int32_t vertex = 0;
-            int index = 0;
-            for (std::size_t i = 0; i < numTria; i++) {
-                for (int j = 0; j < 3; j++) {
-                    const SbVec3f& n = normals[nindices[index]];
-                    face_vertices.push_back(n[0]);
-                    face_vertices.push_back(n[1]);
-                    face_vertices.push_back(n[2]);
-
-                    const SbVec3f& p = points[cindices[index]];
-                    face_vertices.push_back(p[0]);
-                    face_vertices.push_back(p[1]);
-                    face_vertices.push_back(p[2]);
-
-                    face_indices[vertex] = vertex;
-                    vertex++;
-                    index++;
-                }
+        // the nindices must have the length of numindices
+        int32_t vertex = 0;
+        int index = 0;
+        for (std::size_t i = 0; i < numTria; i++) {
+            for (int j = 0; j < 3; j++) {
+                const SbVec3f& n = normals[nindices[index]];
+                face_vertices.push_back(n[0]);
+                face_vertices.push_back(n[1]);
+                face_vertices.push_back(n[2]);
+
+                const SbVec3f& p = points[cindices[index]];
+                face_vertices.push_back(p[0]);
+                face_vertices.push_back(p[1]);
+                face_vertices.push_back(p[2]);
+
+                face_indices[vertex] = vertex;
+                vertex++;
                 index++;
             }
+            index++;
         }
     }
     else if (normbind == SoNormalBindingElement::PER_VERTEX) {
         // only an overall material
-        matbind = SoMaterialBindingElement::OVERALL;
+        shared = true;
 
         std::size_t numPts = coords->getNum();
         face_vertices.reserve(6 * numPts);
@@ -912,7 +1011,7 @@ void SoFCIndexedFaceSet::generateGLArrays(SoGLRenderAction* action)
         }
     }
 
-    render.generateGLArrays(action, matbind, face_vertices, face_indices);
+    render.generateGLArrays(action, face_vertices, face_indices, shared, renderTriangleLimit);
 
     // getVertexData() internally calls readLockNormalCache() that read locks
     // the normal cache. When the cache is not needed any more we must call
@@ -920,6 +1019,98 @@ void SoFCIndexedFaceSet::generateGLArrays(SoGLRenderAction* action)
     if (normalCacheUsed) {
         this->readUnlockNormalCache();
     }
+
+    generateGLColors(action);
+}
+
+namespace
+{
+// RGBA in the byte order expected by glColorPointer
+uint32_t packColor(const SbColor& c, float t)
+{
+    std::array<unsigned char, 4> rgba {static_cast<unsigned char>(c[0] * 255.0F + 0.5F),
+                                       static_cast<unsigned char>(c[1] * 255.0F + 0.5F),
+                                       static_cast<unsigned char>(c[2] * 255.0F + 0.5F),
+                                       static_cast<unsigned char>(t * 255.0F + 0.5F)};
+    uint32_t value {};
+    std::memcpy(&value, rgba.data(), sizeof(value));
+    return value;
+}
+}  // namespace
+
+void SoFCIndexedFaceSet::generateGLColors(SoGLRenderAction* action)
+{
+    SoState* state = action->getState();
+
+    const SbColor* pcolors = nullptr;
+    const float* transp = nullptr;
+    int numcolors = 0;
+    SoMaterialBindingElement::Binding matbind = SoMaterialBindingElement::get(state);
+    SoGLLazyElement* gl = SoGLLazyElement::getInstance(state);
+    if (gl) {
+        pcolors = gl->getDiffusePointer();
+        numcolors = gl->getNumDiffuse();
+        transp = gl->getTransparencyPointer();
+    }
+
+    // colors per face or vertex require a vertex per triangle corner
+    SoNormalBindingElement::Binding normbind = SoNormalBindingElement::get(state);
+    if (!pcolors || numcolors < 1 || normbind != SoNormalBindingElement::PER_VERTEX_INDEXED) {
+        matbind = SoMaterialBindingElement::OVERALL;
+    }
+
+    const int32_t* cindices = this->coordIndex.getValues(0);
+    const int32_t* mindices = this->materialIndex.getValues(0);
+    if (this->materialIndex.getNum() <= 0 || mindices[0] < 0) {
+        mindices = cindices;
+    }
+
+    std::vector<uint32_t> face_colors;
+    std::size_t numTria = this->coordIndex.getNum() / 4;
+    float t = transp ? transp[0] : 0;
+
+    if (matbind == SoMaterialBindingElement::PER_FACE) {
+        if (numcolors != static_cast<int>(numTria)) {
+            SoDebugError::postWarning(
+                "SoFCIndexedFaceSet::generateGLColors",
+                "The number of faces (%d) doesn't match with the number of colors (%d).",
+                numTria,
+                numcolors);
+        }
+
+        face_colors.reserve(3 * numTria);
+        for (std::size_t i = 0; i < numTria; i++) {
+            uint32_t c = packColor(pcolors[std::min<std::size_t>(i, numcolors - 1)], t);
+            face_colors.insert(face_colors.end(), 3, c);
+        }
+    }
+    else if (matbind == SoMaterialBindingElement::PER_VERTEX_INDEXED) {
+        const SoCoordinateElement* coords = SoCoordinateElement::getInstance(state);
+        if (numcolors != coords->getNum()) {
+            SoDebugError::postWarning(
+                "SoFCIndexedFaceSet::generateGLColors",
+                "The number of points (%d) doesn't match with the number of colors (%d).",
+                coords->getNum(),
+                numcolors);
+        }
+
+        face_colors.reserve(3 * numTria);
+        int index = 0;
+        for (std::size_t i = 0; i < numTria; i++) {
+            for (int j = 0; j < 3; j++) {
+                int32_t m = std::min<int32_t>(mindices[index], numcolors - 1);
+                face_colors.push_back(packColor(pcolors[m], t));
+                index++;
+            }
+            index++;
+        }
+    }
+    else {
+        // only an overall material
+        matbind = SoMaterialBindingElement::OVERALL;
+    }
+
+    render.generateGLColors(action, matbind, face_colors);
 }
 
 void SoFCIndexedFaceSet::doAction(SoAction* action)
@@ -1116,19 +1307,34 @@ void SoFCIndexedFaceSet::renderVisibleFaces(const SbVec3f* coords3d)
     uint32_t numfaces = this->coordIndex.getNum() / 4;
     const int32_t* cindices = this->coordIndex.getValues(0);
 
-    int32_t v1 {}, v2 {}, v3 {};
-    for (uint32_t index = 0; index < numfaces; index++, cindices++) {
-        glBegin(GL_TRIANGLES);
-        float t {};
-        SbColor c;
-        c.setPackedValue(index << 8, t);
-        glColor3f(c[0], c[1], c[2]);
-        v1 = *cindices++;
-        glVertex3fv((const GLfloat*)(coords3d + v1));
-        v2 = *cindices++;
-        glVertex3fv((const GLfloat*)(coords3d + v2));
-        v3 = *cindices++;
-        glVertex3fv((const GLfloat*)(coords3d + v3));
-        glEnd();
+    // The faces are drawn with their index encoded as color. Instead of an
+    // immediate mode call per face they are drawn in chunks from vertex arrays.
+    const uint32_t chunkSize = 65536;
+    std::vector<SbVec3f> vertices;
+    std::vector<uint32_t> colors;
+    vertices.reserve(3 * chunkSize);
+    colors.reserve(3 * chunkSize);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    for (uint32_t first = 0; first < numfaces; first += chunkSize) {
+        vertices.clear();
+        colors.clear();
+        uint32_t last = std::min(first + chunkSize, numfaces);
+        for (uint32_t index = first; index < last; index++, cindices++) {
+            float t {};
+            SbColor c;
+            c.setPackedValue(index << 8, t);
+            colors.insert(colors.end(), 3, packColor(c, 1.0F));
+            vertices.push_back(coords3d[*cindices++]);
+            vertices.push_back(coords3d[*cindices++]);
+            vertices.push_back(coords3d[*cindices++]);
+        }
+
+        glVertexPointer(3, GL_FLOAT, 0, vertices.data());
+        glColorPointer(4, GL_UNSIGNED_BYTE, 0, colors.data());
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices.size()));
     }
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
 }
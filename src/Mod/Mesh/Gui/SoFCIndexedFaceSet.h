@@ -27,6 +27,7 @@
 #include <Inventor/fields/SoMFColor.h>
 #include <Inventor/fields/SoSFBool.h>
 #include <Inventor/nodes/SoIndexedFaceSet.h>
+#include <cstdint>
 #include <vector>
 #ifndef MESH_GLOBAL_H
 #include <Mod/Mesh/MeshGlobal.h>
@@ -49,12 +50,28 @@ class MeshRenderer
 public:
     MeshRenderer();
     ~MeshRenderer();
+    /**
+     * Uploads the normals and points in \a vertex and the triangles in \a index.
+     * If there are more than \a triangleLimit triangles a reduced set of points is
+     * created for interactive rendering. If \a sharedVertices is true the vertices
+     * are shared by several triangles and thus no colors per face can be set.
+     */
     void generateGLArrays(SoGLRenderAction*,
-                          SoMaterialBindingElement::Binding binding,
                           std::vector<float>& vertex,
-                          std::vector<int32_t>& index);
+                          std::vector<int32_t>& index,
+                          bool sharedVertices,
+                          unsigned int triangleLimit);
+    /**
+     * Uploads an RGBA color per vertex. Unless the number of vertices has changed
+     * only the ranges that differ from the previous colors are written.
+     */
+    void generateGLColors(SoGLRenderAction*,
+                          SoMaterialBindingElement::Binding binding,
+                          std::vector<uint32_t>& color);
     void renderFacesGLArray(SoGLRenderAction* action);
     void renderCoordsGLArray(SoGLRenderAction* action);
+    void renderLevelOfDetailGLArray(SoGLRenderAction* action);
+    bool hasLevelOfDetail(SoGLRenderAction* action) const;
     bool canRenderGLArray(SoGLRenderAction* action) const;
     bool matchMaterial(SoState*) const;
     void update();
@@ -108,6 +125,7 @@ public:
     SoFCIndexedFaceSet();
 
     SoSFBool updateGLArray;
+    SoSFBool updateGLColor;
     unsigned int renderTriangleLimit;
 
     void invalidate();
@@ -139,6 +157,7 @@ private:
     void renderVisibleFaces(const SbVec3f*);
 
     void generateGLArrays(SoGLRenderAction* action);
+    void generateGLColors(SoGLRenderAction* action);
 
 private:
     MeshRenderer render;
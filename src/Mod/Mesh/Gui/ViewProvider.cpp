@@ -1921,7 +1921,7 @@ void ViewProviderMesh::fillHole(Mesh::FacetIndex uFacet)
     // get the boundary to the picked facet
     std::list<Mesh::PointIndex> aBorder;
     const MeshCore::MeshKernel& rKernel = getMeshObject().getKernel();
-    MeshCore::MeshRefPointToFacets cPt2Fac(rKernel);
+    const MeshCore::MeshCornerTable& cornerTable = rKernel.GetCornerTable();
     MeshCore::MeshAlgorithm meshAlg(rKernel);
     meshAlg.GetFacetBorder(uFacet, aBorder);
     std::vector<Mesh::PointIndex> boundary(aBorder.begin(), aBorder.end());
@@ -1941,7 +1941,7 @@ void ViewProviderMesh::fillHole(Mesh::FacetIndex uFacet)
         MeshCore::MeshPointArray points;
         MeshCore::QuasiDelaunayTriangulator cTria /*(0.05f)*/;
         cTria.SetVerifier(new MeshCore::TriangulationVerifierV2);
-        if (meshAlg.FillupHole(boundary, cTria, faces, points, level, &cPt2Fac)) {
+        if (meshAlg.FillupHole(boundary, cTria, faces, points, level, cornerTable)) {
             if (boundary.front() == boundary.back()) {
                 boundary.pop_back();
             }
@@ -64,10 +64,11 @@ ViewProviderMeshFaceSet::ViewProviderMeshFaceSet()
     pcMeshFaces->ref();
 
     // setup engine to notify 'pcMeshFaces' node about material changes.
+    // Only the colors are uploaded again, the geometry is kept.
     // When the affected nodes are deleted the engine will be deleted, too.
     SoFCMaterialEngine* engine = new SoFCMaterialEngine();
     engine->diffuseColor.connectFrom(&pcShapeMaterial->diffuseColor);
-    pcMeshFaces->updateGLArray.connectFrom(&engine->trigger);
+    pcMeshFaces->updateGLColor.connectFrom(&engine->trigger);
     // NOLINTEND
 }
 
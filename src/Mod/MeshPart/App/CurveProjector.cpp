@@ -25,6 +25,9 @@
 #ifdef FC_OS_LINUX
 #include <unistd.h>
 #endif
+#include <algorithm>
+#include <thread>
+
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
@@ -50,6 +53,8 @@
 #include <Base/Stream.h>
 
 #include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Functional.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 #include <Mod/Mesh/App/Core/Iterator.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -66,6 +71,34 @@ using MeshCore::MeshFacetIterator;
 using MeshCore::MeshKernel;
 using MeshCore::MeshPointIterator;
 
+namespace
+{
+
+using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
+
+/**
+ * Projects all \a points along \a dir onto the mesh in parallel. For a point that misses the
+ * mesh the facet index of the hit point is FACET_INDEX_MAX.
+ */
+std::vector<HitPoint> projectOnRays(const MeshAlgorithm& clAlg,
+                                    const MeshCore::MeshFacetBVH& bvh,
+                                    const std::vector<Base::Vector3f>& points,
+                                    const Base::Vector3f& dir)
+{
+    std::vector<HitPoint> hits(points.size());
+    int threads = int(std::max(std::thread::hardware_concurrency(), 1U));
+    MeshCore::parallel_for(points.size(), 64, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            if (!clAlg.NearestFacetOnRay(points[i], dir, bvh, hits[i].first, hits[i].second)) {
+                hits[i].second = MeshCore::FACET_INDEX_MAX;
+            }
+        }
+    });
+    return hits;
+}
+
+}  // namespace
+
 CurveProjector::CurveProjector(const TopoDS_Shape& aShape, const MeshKernel& pMesh)
     : _Shape(aShape)
     , _Mesh(pMesh)
@@ -98,6 +131,8 @@ CurveProjectorShape::CurveProjectorShape(const TopoDS_Shape& aShape, const MeshK
     CurveProjectorShape::Do();
 }
 
+CurveProjectorShape::~CurveProjectorShape() = default;
+
 void CurveProjectorShape::Do()
 {
     TopExp_Explorer Ex;
@@ -237,6 +272,26 @@ bool CurveProjectorShape::findStartPoint(const MeshKernel& MeshK,
     float MinLength = FLOAT_MAX;
     bool bHit = false;
 
+    // If the point can be projected along the normal onto the nearest facet, the projected point
+    // is the nearest point of the facet and no other facet has a closer projection. Otherwise all
+    // facets must be checked.
+    if (&MeshK == &_Mesh) {
+        if (!_pBVH) {
+            _pBVH = std::make_unique<MeshCore::MeshFacetBVH>(_Mesh);
+        }
+
+        Base::Vector3f NearestPoint;
+        MeshCore::FacetIndex NearestFacet {};
+        if (_pBVH->NearestFacetToPoint(Pnt, FLOAT_MAX, NearestPoint, NearestFacet)) {
+            MeshGeomFacet Facet = MeshK.GetFacet(NearestFacet);
+            if (Facet.Foraminate(Pnt, Facet.GetNormal(), TempResultPoint)) {
+                Rslt = TempResultPoint;
+                FaceIndex = NearestFacet;
+                return true;
+            }
+        }
+    }
+
     // go through the whole Mesh
     MeshFacetIterator It(MeshK);
     for (It.Init(); It.More(); It.Next()) {
@@ -664,10 +719,8 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
                                    float tolerance,
                                    std::vector<Base::Vector3f>& pointsOut) const
 {
-    // calculate the average edge length and create a grid
     MeshAlgorithm clAlg(_rcMesh);
-    float fAvgLen = clAlg.GetAverageEdgeLength();
-    MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    MeshCore::MeshFacetBVH bvh(_rcMesh);
 
     // get all boundary points and edges of the mesh
     std::vector<Base::Vector3f> boundaryPoints;
@@ -691,10 +744,12 @@ void MeshProjection::projectOnMesh(const std::vector<Base::Vector3f>& pointsIn,
 
     Base::SequencerLauncher seq("Project points on mesh", pointsIn.size());
 
-    for (auto it : pointsIn) {
-        Base::Vector3f result;
-        MeshCore::FacetIndex index;
-        if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
+    std::vector<HitPoint> hits = projectOnRays(clAlg, bvh, pointsIn, dir);
+    for (std::size_t i = 0; i < pointsIn.size(); i++) {
+        const Base::Vector3f& it = pointsIn[i];
+        Base::Vector3f result = hits[i].first;
+        MeshCore::FacetIndex index = hits[i].second;
+        if (index != MeshCore::FACET_INDEX_MAX) {
             MeshCore::MeshGeomFacet geomFacet = _rcMesh.GetFacet(index);
             if (tolerance > 0 && geomFacet.IntersectPlaneWithLine(it, dir, result)) {
                 if (geomFacet.IsPointOfFace(result, tolerance)) {
@@ -744,10 +799,11 @@ void MeshProjection::projectParallelToMesh(const TopoDS_Shape& aShape,
                                            const Base::Vector3f& dir,
                                            std::vector<PolyLine>& rPolyLines) const
 {
-    // calculate the average edge length and create a grid
+    // calculate the average edge length and create a grid for the walk along the mesh
     MeshAlgorithm clAlg(_rcMesh);
     float fAvgLen = clAlg.GetAverageEdgeLength();
     MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    MeshCore::MeshFacetBVH bvh(_rcMesh);
     TopExp_Explorer Ex;
 
     int iCnt = 0;
@@ -762,15 +818,12 @@ void MeshProjection::projectParallelToMesh(const TopoDS_Shape& aShape,
         std::vector<Base::Vector3f> points;
         discretize(aEdge, points, 5);
 
-        using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
         std::vector<HitPoint> hitPoints;
         using HitPoints = std::pair<HitPoint, HitPoint>;
         std::vector<HitPoints> hitPointPairs;
-        for (auto it : points) {
-            Base::Vector3f result;
-            MeshCore::FacetIndex index;
-            if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-                hitPoints.emplace_back(result, index);
+        for (const auto& hit : projectOnRays(clAlg, bvh, points, dir)) {
+            if (hit.second != MeshCore::FACET_INDEX_MAX) {
+                hitPoints.push_back(hit);
 
                 if (hitPoints.size() > 1) {
                     HitPoint p1 = hitPoints[hitPoints.size() - 2];
@@ -804,25 +857,23 @@ void MeshProjection::projectParallelToMesh(const std::vector<PolyLine>& aEdges,
                                            const Base::Vector3f& dir,
                                            std::vector<PolyLine>& rPolyLines) const
 {
-    // calculate the average edge length and create a grid
+    // calculate the average edge length and create a grid for the walk along the mesh
     MeshAlgorithm clAlg(_rcMesh);
     float fAvgLen = clAlg.GetAverageEdgeLength();
     MeshFacetGrid cGrid(_rcMesh, 5.0f * fAvgLen);
+    MeshCore::MeshFacetBVH bvh(_rcMesh);
 
     Base::SequencerLauncher seq("Project curve on mesh", aEdges.size());
 
     for (const auto& it : aEdges) {
         std::vector<Base::Vector3f> points = it.points;
 
-        using HitPoint = std::pair<Base::Vector3f, MeshCore::FacetIndex>;
         std::vector<HitPoint> hitPoints;
         using HitPoints = std::pair<HitPoint, HitPoint>;
         std::vector<HitPoints> hitPointPairs;
-        for (auto it : points) {
-            Base::Vector3f result;
-            MeshCore::FacetIndex index;
-            if (clAlg.NearestFacetOnRay(it, dir, cGrid, result, index)) {
-                hitPoints.emplace_back(result, index);
+        for (const auto& hit : projectOnRays(clAlg, bvh, points, dir)) {
+            if (hit.second != MeshCore::FACET_INDEX_MAX) {
+                hitPoints.push_back(hit);
 
                 if (hitPoints.size() > 1) {
                     HitPoint p1 = hitPoints[hitPoints.size() - 2];
@@ -23,6 +23,8 @@
 #ifndef _CurveProjector_h_
 #define _CurveProjector_h_
 
+#include <memory>
+
 #include <TopoDS_Edge.hxx>
 
 #include <Mod/Mesh/App/Mesh.h>
@@ -35,6 +37,7 @@ namespace MeshCore
 class MeshKernel;
 class MeshGeomFacet;
 class MeshFacetGrid;
+class MeshFacetBVH;
 }  // namespace MeshCore
 
 using MeshCore::MeshGeomFacet;
@@ -95,7 +98,7 @@ class MeshPartExport CurveProjectorShape: public CurveProjector
 {
 public:
     CurveProjectorShape(const TopoDS_Shape& aShape, const MeshKernel& pMesh);
-    ~CurveProjectorShape() override = default;
+    ~CurveProjectorShape() override;
 
     void projectCurve(const TopoDS_Edge& aEdge, std::vector<FaceSplitEdge>& vSplitEdges);
 
@@ -107,6 +110,10 @@ public:
 
 protected:
     void Do() override;
+
+private:
+    /// built on the first search of a start point on the projection mesh
+    std::unique_ptr<MeshCore::MeshFacetBVH> _pBVH;
 };
 
 
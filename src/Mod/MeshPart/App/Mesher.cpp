@@ -23,17 +23,29 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <cmath>
+#include <thread>
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
 #include <Standard_Version.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #endif
 
 #include <Base/Console.h>
 #include <Base/Tools.h>
 #include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Mesh/App/Core/Functional.h>
 #include <Mod/Part/App/BRepMesh.h>
+#include <Mod/Part/App/ProgressIndicator.h>
+#include <Mod/Part/App/Tools.h>
 #include <Mod/Part/App/TopoShape.h>
 
 #include "Mesher.h"
@@ -124,6 +136,77 @@ int MeshingOutput::sync()
 namespace MeshPart
 {
 
+namespace
+{
+
+/**
+ * Checks whether all faces of \a shape have a triangulation of the absolute linear
+ * \a deflection, e.g. from an earlier export with the same settings. The angular deflection
+ * is not stored by the triangulation and cannot be checked.
+ */
+bool hasTriangulation(const TopoDS_Shape& shape, double deflection)
+{
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        TopLoc_Location loc;
+        const TopoDS_Face& face = TopoDS::Face(xp.Current());
+        Handle(Poly_Triangulation) tria = BRep_Tool::Triangulation(face, loc);
+        if (tria.IsNull() || std::fabs(tria->Deflection() - deflection) > Precision::Confusion()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Does the same as Part::TopoShape::getDomains() but copies the triangulations of the faces in
+ * parallel.
+ */
+void getDomains(const TopoDS_Shape& shape, std::vector<Part::TopoShape::Domain>& domains)
+{
+    std::vector<TopoDS_Face> faces;
+    for (TopExp_Explorer xp(shape, TopAbs_FACE); xp.More(); xp.Next()) {
+        faces.push_back(TopoDS::Face(xp.Current()));
+    }
+
+    // a face that cannot be meshed gets an empty domain, so the numbers of faces and domains
+    // match
+    domains.resize(faces.size());
+    int threads = int(std::max(std::thread::hardware_concurrency(), 1U));
+    MeshCore::parallel_for(faces.size(), 16, threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<gp_Pnt> points;
+        std::vector<Poly_Triangle> facets;
+        for (std::size_t i = begin; i < end; i++) {
+            points.clear();
+            facets.clear();
+            if (!Part::Tools::getTriangulation(faces[i], points, facets)) {
+                continue;
+            }
+
+            Part::TopoShape::Domain& domain = domains[i];
+            domain.points.reserve(points.size());
+            for (const auto& it : points) {
+                domain.points.emplace_back(it.X(), it.Y(), it.Z());
+            }
+
+            domain.facets.reserve(facets.size());
+            for (const auto& it : facets) {
+                Standard_Integer n1 {};
+                Standard_Integer n2 {};
+                Standard_Integer n3 {};
+                it.Get(n1, n2, n3);
+
+                Part::TopoShape::Facet tria;
+                tria.I1 = n1;
+                tria.I2 = n2;
+                tria.I3 = n3;
+                domain.facets.push_back(tria);
+            }
+        }
+    });
+}
+
+}  // namespace
+
 class BrepMesh
 {
     bool segments;
@@ -223,13 +306,26 @@ Mesher::~Mesher() = default;
 
 Mesh::MeshObject* Mesher::createStandard() const
 {
-    if (!shape.IsNull()) {
+    // a triangulation made with the same settings is reused, the relative deflection of a face
+    // depends on its size so it can only be compared with the absolute deflection
+    if (!shape.IsNull() && (relative || !hasTriangulation(shape, deflection))) {
         BRepTools::Clean(shape);
-        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection);
+#if OCC_VERSION_HEX >= 0x070500
+        IMeshTools_Parameters params;
+        params.Deflection = deflection;
+        params.Angle = angularDeflection;
+        params.Relative = relative;
+        params.InParallel = true;
+        Handle(Part::CancelIndicator) pi = new Part::CancelIndicator();
+        BRepMesh_IncrementalMesh aMesh(shape, params, pi->Start());
+        pi->check();
+#else
+        BRepMesh_IncrementalMesh aMesh(shape, deflection, relative, angularDeflection, true);
+#endif
     }
 
     std::vector<Part::TopoShape::Domain> domains;
-    Part::TopoShape(shape).getDomains(domains);
+    getDomains(shape, domains);
 
     BrepMesh brepmesh(this->segments, this->colors);
     return brepmesh.create(domains);
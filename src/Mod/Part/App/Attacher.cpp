@@ -822,6 +822,19 @@ GProp_GProps AttachEngine::getInertialPropsOfShape(const std::vector<const TopoS
  * \param storage is a buffer storing what some of the pointers in shapes point to. It is needed, since
  * subshapes are copied in the process (but copying a whole shape of an object can potentially be slow).
  */
+static thread_local AttachEngine::ReferenceCache* _ActiveReferenceCache = nullptr;
+
+AttachEngine::ReferenceCache::ReferenceCache()
+    : previous(_ActiveReferenceCache)
+{
+    _ActiveReferenceCache = this;
+}
+
+AttachEngine::ReferenceCache::~ReferenceCache()
+{
+    _ActiveReferenceCache = previous;
+}
+
 void AttachEngine::readLinks(const std::vector<App::DocumentObject*>& objs,
                              const std::vector<std::string> &subs,
                              std::vector<const TopoShape*> &shapes,
@@ -833,6 +846,16 @@ void AttachEngine::readLinks(const std::vector<App::DocumentObject*>& objs,
     types.resize(objs.size());
 
     for (std::size_t i = 0; i < objs.size(); i++) {
+        if (_ActiveReferenceCache) {
+            auto it = _ActiveReferenceCache->entries.find(std::make_pair(objs[i], subs[i]));
+            if (it != _ActiveReferenceCache->entries.end()) {
+                storage.emplace_back(it->second.first);
+                shapes[i] = &(storage.back());
+                types[i] = it->second.second;
+                continue;
+            }
+        }
+
         auto geof = extractGeoFeature(objs[i]);
         if (!geof) {
             FC_THROWM(AttachEngineException,
@@ -857,6 +880,11 @@ void AttachEngine::readLinks(const std::vector<App::DocumentObject*>& objs,
         if (subs[i].length() == 0) {
             types[i] = eRefType(types[i] | rtFlagHasPlacement);
         }
+
+        if (_ActiveReferenceCache) {
+            _ActiveReferenceCache->entries.emplace(std::make_pair(objs[i], subs[i]),
+                                                   std::make_pair(shape, types[i]));
+        }
     }
 }
 
@@ -1035,6 +1063,23 @@ Base::Placement AttachEngine::calculateAttachedPlacement(const Base::Placement&
     return _calculateAttachedPlacement(objs, subnames, origPlacement);
 }
 
+std::vector<Base::Placement>
+AttachEngine::calculateAttachedPlacements(const std::vector<AttachEngine*>& engines,
+                                          const std::vector<Base::Placement>& origPlacements)
+{
+    if (engines.size() != origPlacements.size()) {
+        throw Base::ValueError("AttachEngine: number of attachers and placements differ");
+    }
+
+    ReferenceCache cache;
+    std::vector<Base::Placement> result;
+    result.reserve(engines.size());
+    for (std::size_t i = 0; i < engines.size(); ++i) {
+        result.push_back(engines[i]->calculateAttachedPlacement(origPlacements[i]));
+    }
+    return result;
+}
+
 
 //=================================================================================
 
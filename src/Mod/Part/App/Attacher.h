@@ -28,6 +28,7 @@
 #ifndef PARTATTACHER_H
 #define PARTATTACHER_H
 
+#include <map>
 #include <GProp_GProps.hxx>
 
 #include <App/DocumentObserver.h>
@@ -234,6 +235,38 @@ public: //methods
     Base::Placement calculateAttachedPlacement(
         const Base::Placement &origPlacement, bool *subChanged=0);
 
+    /**
+     * @brief ReferenceCache: while an instance is alive, the sub-shapes referenced by attachments
+     * evaluated in the same thread are resolved and classified only once per object and
+     * subname. The referenced objects must not change while the cache is in use.
+     */
+    class PartExport ReferenceCache
+    {
+    public:
+        ReferenceCache();
+        ~ReferenceCache();
+
+        ReferenceCache(const ReferenceCache&) = delete;
+        ReferenceCache& operator=(const ReferenceCache&) = delete;
+
+    private:
+        friend class AttachEngine;
+        std::map<std::pair<const App::DocumentObject*, std::string>,
+                 std::pair<Part::TopoShape, eRefType>> entries;
+        ReferenceCache* previous;
+    };
+
+    /**
+     * @brief calculateAttachedPlacements: calculates the placements of many attachments in one
+     * pass, resolving the references they share only once.
+     * @param engines: the attachers to evaluate.
+     * @param origPlacements: the current placement of each attached object.
+     * @return the attached placement of each attacher, in the order of \a engines.
+     */
+    static std::vector<Base::Placement>
+    calculateAttachedPlacements(const std::vector<AttachEngine*> &engines,
+                                const std::vector<Base::Placement> &origPlacements);
+
     virtual Base::Placement _calculateAttachedPlacement(
         const std::vector<App::DocumentObject*> &objs,
         const std::vector<std::string> &subs,
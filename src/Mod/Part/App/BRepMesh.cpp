@@ -25,6 +25,9 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <unordered_map>
 #include <Precision.hxx>
 #endif
 
@@ -34,35 +37,23 @@
 using namespace Part;
 
 namespace {
-struct MeshVertex
+struct VertexHash
 {
-    Base::Vector3d p;
-    std::size_t i = 0;
-
-    explicit MeshVertex(const Base::Vector3d& p)
-        : p(p)
+    std::size_t operator()(const Base::Vector3d& p) const
     {
+        std::hash<double> hasher;
+        std::size_t seed = hasher(p.x);
+        seed ^= hasher(p.y) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        seed ^= hasher(p.z) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
     }
+};
 
-    Base::Vector3d toPoint() const
+struct VertexEqual
+{
+    bool operator()(const Base::Vector3d& p, const Base::Vector3d& q) const
     {
-        return p;
-    }
-
-    bool operator < (const MeshVertex &v) const
-    {
-        if (p.x != v.p.x) {
-            return p.x < v.p.x;
-        }
-        if (p.y != v.p.y) {
-            return p.y < v.p.y;
-        }
-        if (p.z != v.p.z) {
-            return p.z < v.p.z;
-        }
-
-        // points are equal
-        return false;
+        return p.x == q.x && p.y == q.y && p.z == q.z;
     }
 };
 
@@ -100,14 +91,14 @@ public:
         reset();
     }
 
-    std::vector<Base::Vector3d> getPoints() const
+    std::vector<Base::Vector3d> takePoints()
     {
-        return points;
+        return std::move(points);
     }
 
-    std::vector<Facet> getFacets() const
+    std::vector<Facet> takeFacets()
     {
-        return faces;
+        return std::move(faces);
     }
 
 private:
@@ -253,32 +244,46 @@ void BRepMesh::getFacesFromDomains(const std::vector<Domain>& domains,
                                    std::vector<Facet>& faces)
 {
     std::size_t numFaces = 0;
+    std::size_t numPoints = 0;
     for (const auto& it : domains) {
         numFaces += it.facets.size();
+        numPoints += it.points.size();
     }
     faces.reserve(numFaces);
 
-    std::set<MeshVertex> vertices;
-    auto addVertex = [&vertices](const Base::Vector3d& pnt, uint32_t& pointIndex) {
-        MeshVertex vertex(pnt);
-        vertex.i = vertices.size();
-        auto it = vertices.insert(vertex);
-        pointIndex = it.first->i;
+    // Points equal to an already added one get its index. Only the first use of a point of a
+    // domain needs a look-up, later uses of it are resolved through the index map of the domain.
+    const uint32_t unset = std::numeric_limits<uint32_t>::max();
+    std::vector<Base::Vector3d> meshPoints;
+    std::unordered_map<Base::Vector3d, uint32_t, VertexHash, VertexEqual> vertices;
+    std::vector<uint32_t> domainIndex;
+    meshPoints.reserve(numPoints);
+    vertices.reserve(numPoints);
+    auto addVertex = [&](const Base::Vector3d& pnt, uint32_t& index, uint32_t& pointIndex) {
+        if (index == unset) {
+            auto it = vertices.emplace(pnt, uint32_t(meshPoints.size()));
+            if (it.second) {
+                meshPoints.push_back(pnt);
+            }
+            index = it.first->second;
+        }
+        pointIndex = index;
     };
 
     for (const auto & domain : domains) {
+        domainIndex.assign(domain.points.size(), unset);
         std::size_t numDomainFaces = 0;
         for (const Facet& df : domain.facets) {
             Facet face;
 
             // 1st vertex
-            addVertex(domain.points[df.I1], face.I1);
+            addVertex(domain.points[df.I1], domainIndex[df.I1], face.I1);
 
             // 2nd vertex
-            addVertex(domain.points[df.I2], face.I2);
+            addVertex(domain.points[df.I2], domainIndex[df.I2], face.I2);
 
             // 3rd vertex
-            addVertex(domain.points[df.I3], face.I3);
+            addVertex(domain.points[df.I3], domainIndex[df.I3], face.I3);
 
             // make sure that we don't insert invalid facets
             if (face.I1 != face.I2 &&
@@ -292,19 +297,10 @@ void BRepMesh::getFacesFromDomains(const std::vector<Domain>& domains,
         domainSizes.push_back(numDomainFaces);
     }
 
-    std::vector<Base::Vector3d> meshPoints;
-    meshPoints.resize(vertices.size());
-    for (const auto & vertex : vertices) {
-        meshPoints[vertex.i] = vertex.toPoint();
-    }
-    points.swap(meshPoints);
-
-    MergeVertex merge(points, faces, Precision::Confusion());
-    if (merge.hasDuplicatedPoints()) {
-        merge.mergeDuplicatedPoints();
-        points = merge.getPoints();
-        faces = merge.getFacets();
-    }
+    MergeVertex merge(std::move(meshPoints), std::move(faces), Precision::Confusion());
+    merge.mergeDuplicatedPoints();
+    points = merge.takePoints();
+    faces = merge.takeFacets();
 }
 
 std::vector<BRepMesh::Segment> BRepMesh::createSegments() const
@@ -23,7 +23,10 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 # include <algorithm>
+# include <memory>
+# include <Bnd_Box.hxx>
 # include <BRepAdaptor_Surface.hxx>
+# include <BRepBndLib.hxx>
 # include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 # include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
 # include <Mod/Part/App/FCBRepAlgoAPI_Section.h>
@@ -31,6 +34,8 @@
 # include <BRepBuilderAPI_MakeWire.hxx>
 # include <BRepPrimAPI_MakeHalfSpace.hxx>
 # include <gp_Pln.hxx>
+# include <OSD_Parallel.hxx>
+# include <OSD_ThreadPool.hxx>
 # include <Precision.hxx>
 # include <ShapeAnalysis_FreeBounds.hxx>
 # include <ShapeFix_Wire.hxx>
@@ -257,6 +262,121 @@ TopoShape TopoCrossSection::slice(int idx, double d) const
         TopoShape::SingleShapeCompoundCreationPolicy::returnShape);
 }
 
+std::vector<std::vector<TopoShape>> TopoCrossSection::slices(const std::vector<double>& distances) const
+{
+    // The sub-shapes to slice and their extent along the plane normal are the same for all
+    // levels, so they are collected once
+    bool solids = true;
+    std::vector<TopoShape> subShapes = shape.getSubTopoShapes(TopAbs_SOLID);
+    if (subShapes.empty()) {
+        solids = false;
+        subShapes = shape.getSubTopoShapes(TopAbs_SHELL);
+        if (subShapes.empty()) {
+            subShapes = shape.getSubTopoShapes(TopAbs_FACE);
+        }
+    }
+
+    std::vector<std::pair<double, double>> ranges;
+    ranges.reserve(subShapes.size());
+    for (const auto& subShape : subShapes) {
+        Bnd_Box box;
+        BRepBndLib::Add(subShape.getShape(), box);
+        if (box.IsVoid()) {
+            ranges.emplace_back(1.0, -1.0);
+            continue;
+        }
+        box.Enlarge(Precision::Confusion());
+        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+        box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        double low = std::min(a * xMin, a * xMax) + std::min(b * yMin, b * yMax)
+            + std::min(c * zMin, c * zMax);
+        double high = std::max(a * xMin, a * xMax) + std::max(b * yMin, b * yMax)
+            + std::max(c * zMin, c * zMax);
+        ranges.emplace_back(low, high);
+    }
+
+    struct Task
+    {
+        int level;
+        std::size_t subShape;
+        TopoShape halfSpace;
+        std::unique_ptr<BRepAlgoAPI_BooleanOperation> mkShape;
+        std::string error;
+    };
+
+    std::vector<std::vector<TopoShape>> result(distances.size());
+
+    // The booleans of several levels run in parallel while the element maps, which share the
+    // source shape, are made afterwards in the calling thread. The tasks are processed in
+    // chunks to limit the memory held by the finished booleans.
+    std::size_t chunkSize =
+        std::max(2 * OSD_ThreadPool::DefaultPool()->NbThreads(), 1);
+    std::vector<Task> tasks;
+    for (std::size_t level = 0; level < distances.size();) {
+        tasks.clear();
+        for (; level < distances.size() && tasks.size() < chunkSize; ++level) {
+            double d = distances[level];
+            for (std::size_t i = 0; i < subShapes.size(); ++i) {
+                // A sub-shape that doesn't reach the plane has no section
+                if (d < ranges[i].first || d > ranges[i].second) {
+                    continue;
+                }
+                Task task;
+                task.level = static_cast<int>(level);
+                task.subShape = i;
+                if (solids) {
+                    task.halfSpace = makeHalfSpace(task.level + 1, d);
+                }
+                tasks.push_back(std::move(task));
+            }
+        }
+
+        OSD_Parallel::For(0, static_cast<int>(tasks.size()), [&](int i) {
+            auto& task = tasks[i];
+            const TopoDS_Shape& subShape = subShapes[task.subShape].getShape();
+            try {
+                if (solids) {
+                    task.mkShape =
+                        std::make_unique<FCBRepAlgoAPI_Cut>(subShape, task.halfSpace.getShape());
+                }
+                else {
+                    double d = distances[task.level];
+                    task.mkShape =
+                        std::make_unique<FCBRepAlgoAPI_Section>(subShape, gp_Pln(a, b, c, -d));
+                }
+            }
+            catch (const Standard_Failure& e) {
+                task.error = e.GetMessageString();
+            }
+        });
+
+        for (auto& task : tasks) {
+            if (!task.error.empty()) {
+                FC_THROWM(Base::CADKernelError,
+                          "Failed to slice at " << distances[task.level] << ": " << task.error);
+            }
+            if (!task.mkShape->IsDone()) {
+                continue;
+            }
+            auto& wires = result[task.level];
+            const TopoShape& subShape = subShapes[task.subShape];
+            if (solids) {
+                addSolidSectionWires(task.level + 1,
+                                     distances[task.level],
+                                     *task.mkShape,
+                                     subShape,
+                                     task.halfSpace,
+                                     wires);
+            }
+            else {
+                addSectionWires(task.level + 1, *task.mkShape, subShape, wires);
+            }
+            task.mkShape.reset();
+        }
+    }
+    return result;
+}
+
 void TopoCrossSection::sliceNonSolid(int idx,
                                      double d,
                                      const TopoShape& shape,
@@ -264,20 +384,38 @@ void TopoCrossSection::sliceNonSolid(int idx,
 {
     FCBRepAlgoAPI_Section cs(shape.getShape(), gp_Pln(a, b, c, -d));
     if (cs.IsDone()) {
-        std::string prefix(op);
-        prefix += Data::indexSuffix(idx);
-        auto res = TopoShape()
-                       .makeElementShape(cs, shape, prefix.c_str())
-                       .makeElementWires()
-                       .getSubTopoShapes(TopAbs_WIRE);
-        wires.insert(wires.end(), res.begin(), res.end());
+        addSectionWires(idx, cs, shape, wires);
     }
 }
 
+void TopoCrossSection::addSectionWires(int idx,
+                                       BRepAlgoAPI_BooleanOperation& cs,
+                                       const TopoShape& shape,
+                                       std::vector<TopoShape>& wires) const
+{
+    std::string prefix(op);
+    prefix += Data::indexSuffix(idx);
+    auto res = TopoShape()
+                   .makeElementShape(cs, shape, prefix.c_str())
+                   .makeElementWires()
+                   .getSubTopoShapes(TopAbs_WIRE);
+    wires.insert(wires.end(), res.begin(), res.end());
+}
+
 void TopoCrossSection::sliceSolid(int idx,
                                   double d,
                                   const TopoShape& shape,
                                   std::vector<TopoShape>& wires) const
+{
+    TopoShape solid = makeHalfSpace(idx, d);
+    FCBRepAlgoAPI_Cut mkCut(shape.getShape(), solid.getShape());
+
+    if (mkCut.IsDone()) {
+        addSolidSectionWires(idx, d, mkCut, shape, solid, wires);
+    }
+}
+
+TopoShape TopoCrossSection::makeHalfSpace(int idx, double d) const
 {
     gp_Pln slicePlane(a, b, c, -d);
     BRepBuilderAPI_MakeFace mkFace(slicePlane);
@@ -296,27 +434,36 @@ void TopoCrossSection::sliceSolid(int idx,
     std::string prefix(op);
     prefix += Data::indexSuffix(idx);
     solid.makeElementShape(mkSolid, face, prefix.c_str());
-    FCBRepAlgoAPI_Cut mkCut(shape.getShape(), solid.getShape());
+    return solid;
+}
 
-    if (mkCut.IsDone()) {
-        TopoShape res(shape.Tag, shape.Hasher);
-        std::vector<TopoShape> shapes;
-        shapes.push_back(shape);
-        shapes.push_back(solid);
-        res.makeElementShape(mkCut, shapes, prefix.c_str());
-        for (auto& face : res.getSubTopoShapes(TopAbs_FACE)) {
-            BRepAdaptor_Surface adapt(TopoDS::Face(face.getShape()));
-            if (adapt.GetType() == GeomAbs_Plane) {
-                gp_Pln plane = adapt.Plane();
-                if (plane.Axis().IsParallel(slicePlane.Axis(), Precision::Confusion())
-                    && plane.Distance(slicePlane.Location()) < Precision::Confusion()) {
-                    auto repaired_wires = TopoShape(face.Tag)
-                                              .makeElementWires(face.getSubTopoShapes(TopAbs_EDGE),
-                                                                prefix.c_str(),
-                                                                true)
-                                              .getSubTopoShapes(TopAbs_WIRE);
-                    wires.insert(wires.end(), repaired_wires.begin(), repaired_wires.end());
-                }
+void TopoCrossSection::addSolidSectionWires(int idx,
+                                            double d,
+                                            BRepAlgoAPI_BooleanOperation& mkCut,
+                                            const TopoShape& shape,
+                                            const TopoShape& solid,
+                                            std::vector<TopoShape>& wires) const
+{
+    gp_Pln slicePlane(a, b, c, -d);
+    std::string prefix(op);
+    prefix += Data::indexSuffix(idx);
+    TopoShape res(shape.Tag, shape.Hasher);
+    std::vector<TopoShape> shapes;
+    shapes.push_back(shape);
+    shapes.push_back(solid);
+    res.makeElementShape(mkCut, shapes, prefix.c_str());
+    for (auto& face : res.getSubTopoShapes(TopAbs_FACE)) {
+        BRepAdaptor_Surface adapt(TopoDS::Face(face.getShape()));
+        if (adapt.GetType() == GeomAbs_Plane) {
+            gp_Pln plane = adapt.Plane();
+            if (plane.Axis().IsParallel(slicePlane.Axis(), Precision::Confusion())
+                && plane.Distance(slicePlane.Location()) < Precision::Confusion()) {
+                auto repaired_wires = TopoShape(face.Tag)
+                                          .makeElementWires(face.getSubTopoShapes(TopAbs_EDGE),
+                                                            prefix.c_str(),
+                                                            true)
+                                          .getSubTopoShapes(TopAbs_WIRE);
+                wires.insert(wires.end(), repaired_wires.begin(), repaired_wires.end());
             }
         }
     }
@@ -29,6 +29,7 @@
 #include "TopoShape.h"
 
 
+class BRepAlgoAPI_BooleanOperation;
 class TopoDS_Shape;
 class TopoDS_Wire;
 
@@ -59,10 +60,26 @@ public:
     TopoCrossSection(double a, double b, double c, const TopoShape& s, const char* op = 0);
     void slice(int idx, double d, std::vector<TopoShape>& wires) const;
     TopoShape slice(int idx, double d) const;
+    /** Slices the shape at all \a distances, running the booleans of several levels in
+     * parallel. The slice of distance i gets the index i + 1.
+     * @return The wires of each level in the order of \a distances.
+     */
+    std::vector<std::vector<TopoShape>> slices(const std::vector<double>& distances) const;
 
 private:
     void sliceNonSolid(int idx, double d, const TopoShape&, std::vector<TopoShape>& wires) const;
     void sliceSolid(int idx, double d, const TopoShape&, std::vector<TopoShape>& wires) const;
+    TopoShape makeHalfSpace(int idx, double d) const;
+    void addSectionWires(int idx,
+                         BRepAlgoAPI_BooleanOperation& cs,
+                         const TopoShape& shape,
+                         std::vector<TopoShape>& wires) const;
+    void addSolidSectionWires(int idx,
+                              double d,
+                              BRepAlgoAPI_BooleanOperation& mkCut,
+                              const TopoShape& shape,
+                              const TopoShape& solid,
+                              std::vector<TopoShape>& wires) const;
 
 private:
     double a, b, c;
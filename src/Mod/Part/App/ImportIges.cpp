@@ -29,7 +29,10 @@
 # include <IGESControl_Controller.hxx>
 # include <IGESControl_Reader.hxx>
 # include <IGESSolid_ManifoldSolid.hxx>
+# include <Interface_InterfaceModel.hxx>
 # include <Message_MsgFile.hxx>
+# include <OSD_Parallel.hxx>
+# include <OSD_ThreadPool.hxx>
 # include <Standard_Version.hxx>
 # include <TColStd_HSequenceOfTransient.hxx>
 # include <TopoDS.hxx>
@@ -38,9 +41,12 @@
 # include <Transfer_TransientProcess.hxx>
 # include <XSControl_TransferReader.hxx>
 # include <XSControl_WorkSession.hxx>
+# include <algorithm>
 #endif
 
+#include <App/Application.h>
 #include <App/Document.h>
+#include <Base/Console.h>
 #include <Base/Sequencer.h>
 
 #include "ImportIges.h"
@@ -50,6 +56,67 @@
 
 using namespace Part;
 
+namespace {
+
+/*!
+ * Translates the roots of \a reader with several independent readers.
+ *
+ * The transfer process of a reader is not thread safe, so each task opens the
+ * file with its own reader and translates a contiguous range of the roots.
+ * The results are concatenated in root order so the created objects are the
+ * same as with a serial transfer. Entities that are referenced by roots of
+ * different ranges are translated once per range.
+ */
+std::vector<TopoDS_Shape> transferRootsParallel(IGESControl_Reader& reader,
+                                                const char* FileName,
+                                                int numTasks)
+{
+    Standard_Integer nbRoots = reader.NbRootsForTransfer();
+    Handle(Interface_InterfaceModel) model = reader.Model();
+    std::vector<Standard_Integer> roots;
+    roots.reserve(nbRoots);
+    for (Standard_Integer i=1; i<=nbRoots; i++) {
+        roots.push_back(model->Number(reader.RootForTransfer(i)));
+    }
+
+    numTasks = std::min<int>(numTasks, nbRoots);
+    std::vector<std::vector<TopoDS_Shape>> results(numTasks);
+    std::vector<std::string> errors(numTasks);
+    OSD_Parallel::For(0, numTasks, [&](int task) {
+        try {
+            IGESControl_Reader taskReader;
+            if (taskReader.ReadFile((Standard_CString)FileName) != IFSelect_RetDone) {
+                errors[task] = "Error in reading IGES";
+                return;
+            }
+            taskReader.SetReadVisible(Standard_True);
+            taskReader.ClearShapes();
+            std::size_t first = roots.size() * task / numTasks;
+            std::size_t last = roots.size() * (task + 1) / numTasks;
+            for (std::size_t i=first; i<last; i++) {
+                taskReader.TransferOne(roots[i]);
+            }
+            for (Standard_Integer i=1; i<=taskReader.NbShapes(); i++) {
+                results[task].push_back(taskReader.Shape(i));
+            }
+        }
+        catch (Standard_Failure& e) {
+            errors[task] = e.GetMessageString();
+        }
+    });
+
+    std::vector<TopoDS_Shape> shapes;
+    for (int task=0; task<numTasks; task++) {
+        if (!errors[task].empty()) {
+            throw Base::CADKernelError(errors[task]);
+        }
+        shapes.insert(shapes.end(), results[task].begin(), results[task].end());
+    }
+    return shapes;
+}
+
+}
+
 int Part::ImportIgesParts(App::Document *pcDoc, const char* FileName)
 {
     try {
@@ -82,10 +149,30 @@ int Part::ImportIgesParts(App::Document *pcDoc, const char* FileName)
         aReader.WS()->MapReader()->SetProgress(pi);
 #endif
 
+        // Translating the roots, which includes the shape healing of each
+        // root, dominates the import of large files. Optionally spread it
+        // over several readers (0 = one per thread of the pool).
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Part/IGES");
+        int numTasks = hGrp->GetInt("TransferThreads", 1);
+        if (numTasks <= 0) {
+            numTasks = OSD_ThreadPool::DefaultPool()->NbThreads();
+        }
+
         // make model
-        aReader.ClearShapes();
-        //Standard_Integer nbRootsForTransfer = aReader.NbRootsForTransfer();
-        aReader.TransferRoots();
+        std::vector<TopoDS_Shape> shapes;
+        if (numTasks > 1 && aReader.NbRootsForTransfer() > 1) {
+            Base::Console().Log("Translating %d IGES roots with %d readers\n",
+                                aReader.NbRootsForTransfer(), numTasks);
+            shapes = transferRootsParallel(aReader, FileName, numTasks);
+        }
+        else {
+            aReader.ClearShapes();
+            aReader.TransferRoots();
+            for (Standard_Integer i=1; i<=aReader.NbShapes(); i++) {
+                shapes.push_back(aReader.Shape(i));
+            }
+        }
 #if OCC_VERSION_HEX < 0x070500
         pi->EndScope();
 #endif
@@ -96,9 +183,7 @@ int Part::ImportIgesParts(App::Document *pcDoc, const char* FileName)
         TopoDS_Compound comp;
         builder.MakeCompound(comp);
 
-        Standard_Integer nbShapes = aReader.NbShapes();
-        for (Standard_Integer i=1; i<=nbShapes; i++) {
-            TopoDS_Shape aShape = aReader.Shape(i);
+        for (const TopoDS_Shape& aShape : shapes) {
             if (!aShape.IsNull()) {
                 if (aShape.ShapeType() == TopAbs_SOLID ||
                     aShape.ShapeType() == TopAbs_COMPOUND ||
@@ -23,7 +23,12 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
+# include <list>
+# include <mutex>
 # include <sstream>
+# include <unordered_map>
+# include <QCryptographicHash>
 # include <Bnd_Box.hxx>
 # include <BRepAdaptor_Curve.hxx>
 # include <Mod/Part/App/FCBRepAlgoAPI_Fuse.h>
@@ -70,12 +75,14 @@
 #include <Base/Rotation.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
+#include <Base/Writer.h>
 #include <Mod/Material/App/MaterialManager.h>
 
 #include "Geometry.h"
 #include "PartFeature.h"
 #include "PartFeaturePy.h"
 #include "PartPyCXX.h"
+#include "TopoShapeMapper.h"
 #include "TopoShapePy.h"
 #include "Tools.h"
 
@@ -86,6 +93,217 @@ FC_LOG_LEVEL_INIT("Part",true,true)
 
 PROPERTY_SOURCE(Part::Feature, App::GeoFeature)
 
+namespace
+{
+
+/** Keeps the results of recent recomputes, keyed by a hash of the inputs of the feature.
+ *
+ * An entry holds copies of the properties the recompute changed, which are pasted back when a
+ * later recompute finds the same inputs. The least recently used entries are dropped when the
+ * size of the stored properties exceeds the budget.
+ */
+class ResultCache
+{
+public:
+    struct Entry
+    {
+        const Feature* owner = nullptr;
+        /// Keeps the input shapes alive so that their addresses, which are part of the key,
+        /// cannot be reused by another shape
+        std::vector<TopoDS_Shape> inputs;
+        std::vector<std::pair<std::string, std::unique_ptr<App::Property>>> outputs;
+        std::size_t size = 0;
+    };
+
+    static ResultCache& instance()
+    {
+        static ResultCache cache;
+        return cache;
+    }
+
+    static bool isEnabled()
+    {
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Part/General");
+        return hGrp->GetBool("ResultCache", false);
+    }
+
+    const Entry* find(const std::string& key)
+    {
+        auto it = index.find(key);
+        if (it == index.end()) {
+            return nullptr;
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        return &it->second->second;
+    }
+
+    void insert(const std::string& key, Entry&& entry)
+    {
+        auto it = index.find(key);
+        if (it != index.end()) {
+            erase(it->second);
+        }
+        for (const auto& output : entry.outputs) {
+            entry.size += output.second->getMemSize();
+        }
+        totalSize += entry.size;
+        entries.emplace_front(key, std::move(entry));
+        index.emplace(key, entries.begin());
+
+        ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Part/General");
+        std::size_t budget = std::max<long>(hGrp->GetInt("ResultCacheSize", 256), 0) * 1024 * 1024;
+        while (totalSize > budget && !entries.empty()) {
+            erase(std::prev(entries.end()));
+        }
+    }
+
+    void removeOwner(const Feature* owner)
+    {
+        for (auto it = entries.begin(); it != entries.end();) {
+            auto next = std::next(it);
+            if (it->second.owner == owner) {
+                erase(it);
+            }
+            it = next;
+        }
+    }
+
+private:
+    using EntryList = std::list<std::pair<std::string, Entry>>;
+
+    void erase(EntryList::iterator it)
+    {
+        totalSize -= it->second.size;
+        index.erase(it->first);
+        entries.erase(it);
+    }
+
+    EntryList entries;
+    std::unordered_map<std::string, EntryList::iterator> index;
+    std::size_t totalSize = 0;
+};
+
+/** Remembers the results of recent Feature::getTopoShape() calls, so that the same lookup
+ * repeated, e.g. by preselection or expressions, does not resolve links and placements again.
+ *
+ * A lookup may depend on any object along its sub-object path and on linked objects in other
+ * documents, so any change of any document object drops all entries.
+ */
+class ShapeLookupCache
+{
+public:
+    struct Entry
+    {
+        TopoShape shape;
+        Base::Matrix4D mat;
+        App::DocumentObject* owner = nullptr;
+    };
+
+    static ShapeLookupCache& instance()
+    {
+        static ShapeLookupCache cache;
+        return cache;
+    }
+
+    std::size_t capacity() const
+    {
+        return static_cast<std::size_t>(std::max<long>(hGrp->GetInt("ShapeLookupCacheSize", 1000), 0));
+    }
+
+    bool find(const std::string& key, Entry& entry)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key);
+        if (it == index.end()) {
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        entry = it->second->second;
+        return true;
+    }
+
+    void insert(const std::string& key, Entry&& entry, std::size_t limit)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key);
+        if (it != index.end()) {
+            entries.erase(it->second);
+            index.erase(it);
+        }
+        entries.emplace_front(key, std::move(entry));
+        index.emplace(key, entries.begin());
+        while (entries.size() > limit) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        index.clear();
+        entries.clear();
+    }
+
+private:
+    ShapeLookupCache()
+    {
+        hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Mod/Part/General");
+
+        auto& app = App::GetApplication();
+        // NOLINTBEGIN
+        connections.emplace_back(app.signalChangedObject.connect(
+            [this](const App::DocumentObject&, const App::Property&) { clear(); }));
+        connections.emplace_back(app.signalNewObject.connect(
+            [this](const App::DocumentObject&) { clear(); }));
+        connections.emplace_back(app.signalDeletedObject.connect(
+            [this](const App::DocumentObject&) { clear(); }));
+        connections.emplace_back(app.signalRelabelObject.connect(
+            [this](const App::DocumentObject&) { clear(); }));
+        connections.emplace_back(app.signalDeleteDocument.connect(
+            [this](const App::Document&) { clear(); }));
+        connections.emplace_back(app.signalAppendDynamicProperty.connect(
+            [this](const App::Property&) { clear(); }));
+        connections.emplace_back(app.signalRemoveDynamicProperty.connect(
+            [this](const App::Property&) { clear(); }));
+        // NOLINTEND
+    }
+
+    using EntryList = std::list<std::pair<std::string, Entry>>;
+
+    std::mutex mutex;
+    EntryList entries;
+    std::unordered_map<std::string, EntryList::iterator> index;
+    ParameterGrp::handle hGrp;
+    std::vector<boost::signals2::scoped_connection> connections;
+};
+
+/** Returns a digest of the geometry, placement and element map of \a shape, used to tell if a
+ * recompute reproduced the previous result.
+ */
+QByteArray getShapeDigest(const TopoShape& shape)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    auto addData = [&hash](const std::string& data) {
+        hash.addData(data.c_str(), int(data.size() + 1));
+    };
+
+    std::ostringstream str;
+    shape.exportBrep(str);
+    addData(str.str());
+    addData(std::to_string(shape.Tag));
+    for (const auto& element : shape.getElementMap()) {
+        addData(element.name.toString());
+        addData(element.index.toString());
+    }
+    return hash.result();
+}
+
+}  // namespace
+
 
 Feature::Feature()
 {
@@ -94,17 +312,131 @@ Feature::Feature()
     ADD_PROPERTY(ShapeMaterial, (*mat));
 }
 
-Feature::~Feature() = default;
+Feature::~Feature()
+{
+    ResultCache::instance().removeOwner(this);
+}
 
 short Feature::mustExecute() const
 {
     return GeoFeature::mustExecute();
 }
 
+std::string Feature::getResultCacheKey(std::vector<TopoDS_Shape>& inputs) const
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    auto addData = [&hash](const std::string& data) {
+        hash.addData(data.c_str(), int(data.size() + 1));
+    };
+
+    // The element map of the result depends on the document and the ID of the owner, too
+    addData(getTypeId().getName());
+    addData(getFullName());
+    addData(std::to_string(getID()));
+
+    std::vector<App::Property*> props;
+    getPropertyList(props);
+    for (auto prop : props) {
+        if (prop == &Label || prop == &Label2 || prop == &Visibility || prop == &ExpressionEngine
+            || prop->testStatus(App::Property::Output) || (prop->getType() & App::Prop_Output)
+            || prop->isDerivedFrom<App::PropertyComplexGeoData>()) {
+            continue;
+        }
+        Base::StringWriter writer;
+        prop->Save(writer);
+        addData(prop->getName());
+        addData(writer.getString());
+    }
+
+    // Linked shapes are identified by their TShape and location. An unchanged upstream feature
+    // keeps its shape, and so does one that got its result from this cache.
+    for (auto obj : getOutList()) {
+        addData(obj->getFullName());
+        auto feature = Base::freecad_dynamic_cast<Feature>(obj);
+        if (feature) {
+            const TopoShape& shape = feature->Shape.getShape();
+            addData(std::to_string(
+                reinterpret_cast<std::uintptr_t>(shape.getShape().TShape().get())));
+            addData(std::to_string(ShapeHasher()(shape)));
+            addData(std::to_string(int(shape.getShape().Orientation())));
+            addData(std::to_string(shape.Tag));
+            inputs.push_back(shape.getShape());
+        }
+        else if (obj->getPropertyOfGeometry()) {
+            // there is no cheap way to tell if other kinds of geometry changed
+            return {};
+        }
+        else if (auto geoFeature = Base::freecad_dynamic_cast<App::GeoFeature>(obj)) {
+            Base::StringWriter writer;
+            geoFeature->Placement.Save(writer);
+            addData(writer.getString());
+        }
+    }
+
+    QByteArray result = hash.result();
+    return {result.constData(), std::size_t(result.size())};
+}
+
 App::DocumentObjectExecReturn *Feature::recompute()
 {
     try {
-        return App::GeoFeature::recompute();
+        std::string key;
+        std::vector<TopoDS_Shape> inputs;
+        if (ResultCache::isEnabled()) {
+            key = getResultCacheKey(inputs);
+        }
+        if (!key.empty()) {
+            if (auto entry = ResultCache::instance().find(key)) {
+                for (const auto& output : entry->outputs) {
+                    if (auto prop = getPropertyByName(output.first.c_str())) {
+                        prop->Paste(*output.second);
+                    }
+                }
+                FC_LOG(getFullName() << " result taken from cache");
+                return App::DocumentObject::StdReturn;
+            }
+        }
+
+        // A recompute that reproduces the previous result keeps the previous shape, so that
+        // dependent features find their input unchanged and can take their result from the cache
+        TopoShape previous;
+        if (ResultCache::isEnabled()) {
+            previous = Shape.getShape();
+        }
+
+        std::vector<const App::Property*> changed;
+        _changedByRecompute = key.empty() ? nullptr : &changed;
+        App::DocumentObjectExecReturn* ret {};
+        try {
+            // Temporary shapes made during execute() only get their element
+            // map if something asks for it
+            ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+                "User parameter:BaseApp/Preferences/Mod/Part/General");
+            TopoShape::DeferElementMap deferGuard(hGrp->GetBool("DeferElementMap", false));
+            ret = App::GeoFeature::recompute();
+        }
+        catch (...) {
+            _changedByRecompute = nullptr;
+            throw;
+        }
+        _changedByRecompute = nullptr;
+
+        if (!ret && !previous.isNull() && !Shape.getShape().getShape().IsSame(previous.getShape())
+            && getShapeDigest(Shape.getShape()) == getShapeDigest(previous)) {
+            FC_LOG(getFullName() << " reproduced its previous shape");
+            Shape.setValue(previous);
+        }
+
+        if (!ret && !key.empty()) {
+            ResultCache::Entry entry;
+            entry.owner = this;
+            entry.inputs = std::move(inputs);
+            for (auto prop : changed) {
+                entry.outputs.emplace_back(prop->getName(), prop->Copy());
+            }
+            ResultCache::instance().insert(key, std::move(entry));
+        }
+        return ret;
     }
     catch (Standard_Failure& e) {
 
@@ -974,7 +1306,7 @@ static TopoShape _getTopoShape(const App::DocumentObject* obj,
                     if (obj->getDocument() != linked->getDocument()
                         || mat.hasScale() != Base::ScaleType::NoScaling
                         || (linked != owner && linkMat.hasScale() != Base::ScaleType::NoScaling)) {
-                        PropertyShapeCache::setShape(obj, shape, subname);
+                        PropertyShapeCache::setShape(obj, shape, subname, linked);
                     }
                 }
                 if (noElementMap) {
@@ -1074,7 +1406,7 @@ static TopoShape _getTopoShape(const App::DocumentObject* obj,
             bool scaled = shape.transformShape(mat, false, true);
             if (owner->getDocument() != obj->getDocument()) {
                 shape.reTagElementMap(obj->getID(), obj->getDocument()->getStringHasher());
-                PropertyShapeCache::setShape(obj, shape, subname);
+                PropertyShapeCache::setShape(obj, shape, subname, owner);
             }
             else if (scaled
                      || (linked != owner && linkMat.hasScale() != Base::ScaleType::NoScaling)) {
@@ -1231,7 +1563,7 @@ static TopoShape _getTopoShape(const App::DocumentObject* obj,
             scaled = true;  // force cache
         }
         if (canCache(obj) && scaled) {
-            PropertyShapeCache::setShape(obj, shape, subname);
+            PropertyShapeCache::setShape(obj, shape, subname, owner);
         }
     }
     if (noElementMap) {
@@ -1244,19 +1576,15 @@ static TopoShape _getTopoShape(const App::DocumentObject* obj,
     return shape;
 }
 
-TopoShape Feature::getTopoShape(const App::DocumentObject* obj,
-                                const char* subname,
-                                bool needSubElement,
-                                Base::Matrix4D* pmat,
-                                App::DocumentObject** powner,
-                                bool resolveLink,
-                                bool transform,
-                                bool noElementMap)
+static TopoShape getTopoShapeUncached(const App::DocumentObject* obj,
+                                      const char* subname,
+                                      bool needSubElement,
+                                      Base::Matrix4D* pmat,
+                                      App::DocumentObject** powner,
+                                      bool resolveLink,
+                                      bool transform,
+                                      bool noElementMap)
 {
-    if (!obj || !obj->getNameInDocument()) {
-        return TopoShape();
-    }
-
     const App::DocumentObject* lastLink = 0;
     std::set<std::string> hiddens;
     // Toponaming project March 2024:  This appears to be a non toponaming feature:
@@ -1347,6 +1675,60 @@ TopoShape Feature::getTopoShape(const App::DocumentObject* obj,
     return shape;
 }
 
+TopoShape Feature::getTopoShape(const App::DocumentObject* obj,
+                                const char* subname,
+                                bool needSubElement,
+                                Base::Matrix4D* pmat,
+                                App::DocumentObject** powner,
+                                bool resolveLink,
+                                bool transform,
+                                bool noElementMap)
+{
+    if (!obj || !obj->getNameInDocument()) {
+        return TopoShape();
+    }
+
+    // The input value of pmat is part of the lookup, so only the identity is cached. Asking
+    // for the matrix at all changes how the top level transformation is applied, so that is
+    // part of the key.
+    auto& cache = ShapeLookupCache::instance();
+    std::size_t capacity = cache.capacity();
+    if (capacity == 0 || (pmat && *pmat != Base::Matrix4D())) {
+        return getTopoShapeUncached(obj,
+                                    subname,
+                                    needSubElement,
+                                    pmat,
+                                    powner,
+                                    resolveLink,
+                                    transform,
+                                    noElementMap);
+    }
+
+    std::ostringstream key;
+    key << static_cast<const void*>(obj) << ':' << needSubElement << resolveLink << transform
+        << noElementMap << (pmat != nullptr) << ':' << (subname ? subname : "");
+
+    ShapeLookupCache::Entry entry;
+    if (!cache.find(key.str(), entry)) {
+        entry.shape = getTopoShapeUncached(obj,
+                                           subname,
+                                           needSubElement,
+                                           pmat ? &entry.mat : nullptr,
+                                           &entry.owner,
+                                           resolveLink,
+                                           transform,
+                                           noElementMap);
+        cache.insert(key.str(), ShapeLookupCache::Entry(entry), capacity);
+    }
+    if (pmat) {
+        *pmat = entry.mat;
+    }
+    if (powner) {
+        *powner = entry.owner;
+    }
+    return entry.shape;
+}
+
 App::DocumentObject *Feature::getShapeOwner(const App::DocumentObject *obj, const char *subname)
 {
     if(!obj)
@@ -1473,6 +1855,12 @@ void Feature::onBeforeChange(const App::Property* prop)
 
 void Feature::onChanged(const App::Property* prop)
 {
+    if (_changedByRecompute && prop->getContainer() == this
+        && std::find(_changedByRecompute->begin(), _changedByRecompute->end(), prop)
+            == _changedByRecompute->end()) {
+        _changedByRecompute->push_back(prop);
+    }
+
     // if the placement has changed apply the change to the point data as well
     if (prop == &this->Placement) {
         TopoShape shape = this->Shape.getShape();
@@ -196,8 +196,15 @@ protected:
         const TopoDS_Shape& newS, const TopoDS_Shape& oldS);
     ShapeHistory joinHistory(const ShapeHistory&, const ShapeHistory&);
 private:
+    /** Returns the key of the result cache for the current input values, or an empty string if
+     * the inputs cannot be identified. The linked input shapes are returned in \a inputs.
+     */
+    std::string getResultCacheKey(std::vector<TopoDS_Shape>& inputs) const;
+
     struct ElementCache;
     std::map<std::string, ElementCache> _elementCache;
+    /// Collects the properties changed during a recompute, for the result cache
+    std::vector<const App::Property*>* _changedByRecompute = nullptr;
     std::vector<std::pair<std::string, PropertyPartShape*>> _elementCachePrefixMap;
 };
 
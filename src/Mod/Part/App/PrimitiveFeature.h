@@ -43,6 +43,10 @@ public:
     /// recalculate the feature
     App::DocumentObjectExecReturn *execute() override;
     short mustExecute() const override;
+    /// primitives only build their shape with OCCT, thus are safe to recompute concurrently
+    bool canRecomputeConcurrently() const override {
+        return true;
+    }
     PyObject* getPyObject() override;
     //@}
 
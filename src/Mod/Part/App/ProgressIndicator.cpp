@@ -22,6 +22,8 @@
 
 #include "PreCompiled.h"
 
+#include <Base/Exception.h>
+
 #include "ProgressIndicator.h"
 
 
@@ -82,4 +84,31 @@ Standard_Boolean ProgressIndicator::UserBreak()
 {
     return myProgress->wasCanceled();
 }
+#else
+CancelIndicator::CancelIndicator()
+  : myDeadline(Base::Cancellation::deadline())
+{
+}
+
+Standard_Boolean CancelIndicator::UserBreak()
+{
+    // may be called by any thread of the algorithm
+    if (Base::Cancellation::isRequested(myDeadline)) {
+        myBreak = true;
+    }
+    return myBreak;
+}
+
+void CancelIndicator::check() const
+{
+    if (myBreak) {
+        Base::Cancellation::check();
+        // the deadline of the thread may have been lifted meanwhile
+        throw Base::AbortException("Operation canceled");
+    }
+}
+
+void CancelIndicator::Show(const Message_ProgressScope&, const Standard_Boolean)
+{
+}
 #endif
@@ -23,11 +23,13 @@
 #ifndef PART_PROGRESSINDICATOR_H
 #define PART_PROGRESSINDICATOR_H
 
+#include <atomic>
 #include <memory>
 
 #include <Message_ProgressIndicator.hxx>
 #include <Standard_Version.hxx>
 
+#include <Base/Cancellation.h>
 #include <Base/Sequencer.h>
 #include <Mod/Part/PartGlobal.h>
 
@@ -47,6 +49,33 @@ public:
 private:
     std::unique_ptr<Base::SequencerLauncher> myProgress;
 };
+#else
+/** Lets OCCT algorithms stop when the running operation is canceled, e.g. if the feature
+ * exceeds the recompute time limit. See Base::Cancellation. The deadline of the thread
+ * creating the indicator is used, so the threads of a parallel algorithm honour it as well.
+ *
+ *  \code
+ *  Handle(CancelIndicator) pi = new CancelIndicator();
+ *  mkFillet.Build(pi->Start());
+ *  pi->check();
+ *  \endcode
+ */
+class PartExport CancelIndicator : public Message_ProgressIndicator
+{
+public:
+    CancelIndicator();
+
+    Standard_Boolean UserBreak() override;
+    /// Throws a Base::AbortException if the algorithm has been stopped
+    void check() const;
+
+protected:
+    void Show(const Message_ProgressScope& theScope, const Standard_Boolean isForce) override;
+
+private:
+    Base::Cancellation::Clock::time_point myDeadline;
+    std::atomic<bool> myBreak {false};
+};
 #endif
 
 }
@@ -23,7 +23,12 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <deque>
+# include <functional>
+# include <mutex>
 # include <sstream>
+# include <thread>
+# include <unordered_map>
 # include <Bnd_Box.hxx>
 # include <BRepBndLib.hxx>
 # include <BRepBuilderAPI_Copy.hxx>
@@ -59,14 +64,133 @@ using namespace Part;
 
 TYPESYSTEM_SOURCE(Part::PropertyPartShape , App::PropertyComplexGeoData)
 
+/// Shape data read from the document file but not yet parsed
+struct PropertyPartShape::LazyShape
+{
+    std::string data;
+    std::string fileName;
+    bool binary = false;
+
+    std::mutex mutex;
+    bool loaded = false;
+    TopoDS_Shape shape;
+
+    const TopoDS_Shape& load()
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (loaded) {
+            return shape;
+        }
+        loaded = true;
+        try {
+            std::istringstream stream(data);
+            if (binary) {
+                TopoShape res;
+                res.importBinary(stream);
+                shape = res.getShape();
+            }
+            else {
+                BRep_Builder builder;
+                BRepTools::Read(shape, stream, builder);
+            }
+        }
+        catch (const Standard_Failure& e) {
+            FC_ERR("Failed to load BRep file " << fileName << ": " << e.GetMessageString());
+        }
+        catch (const std::exception& e) {
+            FC_ERR("Failed to load BRep file " << fileName << ": " << e.what());
+        }
+        // release the raw data as early as possible
+        std::string().swap(data);
+        return shape;
+    }
+};
+
+namespace {
+
+/// Small pool of background threads parsing lazily restored shapes
+class LazyShapeLoader
+{
+public:
+    template<class T>
+    void push(const std::shared_ptr<T>& lazy)
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        queue.emplace_back([lazy]() {
+            lazy->load();
+        });
+        unsigned maxThreads = std::max(1U, std::thread::hardware_concurrency() / 2);
+        if (running < maxThreads) {
+            ++running;
+            std::thread(&LazyShapeLoader::run, this).detach();
+        }
+    }
+
+    static LazyShapeLoader& instance()
+    {
+        static auto loader = new LazyShapeLoader;
+        return *loader;
+    }
+
+private:
+    void run()
+    {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                if (queue.empty()) {
+                    --running;
+                    return;
+                }
+                task = std::move(queue.front());
+                queue.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex;
+    std::deque<std::function<void()>> queue;
+    unsigned running = 0;
+};
+
+}
+
 PropertyPartShape::PropertyPartShape() = default;
 
 PropertyPartShape::~PropertyPartShape() = default;
 
+void PropertyPartShape::ensureRestored() const
+{
+    if (!_LazyShape) {
+        return;
+    }
+    auto lazy = std::move(_LazyShape);
+    _LazyShape.reset();
+    // Silently set the shape without notification, the same as if it were
+    // restored with the document, and keep the restored element map
+    const_cast<TopoShape&>(_Shape).setShape(lazy->load(), false);
+}
+
+void PropertyPartShape::prefetch() const
+{
+    if (_LazyShape) {
+        LazyShapeLoader::instance().push(_LazyShape);
+    }
+}
+
 void PropertyPartShape::setValue(const TopoShape& sh)
 {
+    // Reset the lazy data only after aboutToSetValue(), so that a copy taken
+    // for undo still has access to the unparsed shape
     aboutToSetValue();
+    _LazyShape.reset();
     _Shape = sh;
+    if (_Shape.hasDeferredElementMap()) {
+        // Build the names now so that the recorded history can be released
+        _Shape.flushElementMap();
+    }
     auto obj = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
     if(obj) {
         auto tag = obj->getID();
@@ -87,6 +211,7 @@ void PropertyPartShape::setValue(const TopoShape& sh)
 void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 {
     aboutToSetValue();
+    _LazyShape.reset();
     auto obj = dynamic_cast<App::DocumentObject*>(getContainer());
     if(obj)
         _Shape.Tag = obj->getID();
@@ -97,11 +222,13 @@ void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    ensureRestored();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    ensureRestored();
     _Shape.initCache(-1);
     // March, 2024 Toponaming project:  There was originally an unused feature to disable
     // elementMapping that has not been kept:
@@ -118,6 +245,7 @@ const TopoShape& PropertyPartShape::getShape() const
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 {
+    ensureRestored();
     _Shape.initCache(-1);
     return &(this->_Shape);
 }
@@ -125,6 +253,7 @@ const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
     Base::BoundBox3d box;
+    ensureRestored();
     if (_Shape.getShape().IsNull())
         return box;
     try {
@@ -150,16 +279,19 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D &rclTrf)
 {
+    ensureRestored();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    ensureRestored();
     return _Shape.getTransform();
 }
 
 void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 {
+    ensureRestored();
     aboutToSetValue();
     _Shape.transformGeometry(rclTrf);
     hasSetValue();
@@ -167,6 +299,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D &rclTrf)
 
 PyObject *PropertyPartShape::getPyObject()
 {
+    ensureRestored();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop)
         prop->setConst();
@@ -204,6 +337,14 @@ void PropertyPartShape::setPyObject(PyObject *value)
 App::Property *PropertyPartShape::Copy() const
 {
     PropertyPartShape *prop = new PropertyPartShape();
+    if (_LazyShape) {
+        // Share the not yet parsed data instead of forcing a parse, e.g. when
+        // the copy is only kept for undo
+        prop->_LazyShape = _LazyShape;
+        prop->_Shape = this->_Shape;
+        prop->_Ver = this->_Ver;
+        return prop;
+    }
 
     // March, 2024 Toponaming project:  There was originally a feature to enable making an element
     // copy ( new geometry and map ) that has not been kept:
@@ -221,6 +362,7 @@ void PropertyPartShape::Paste(const App::Property &from)
 {
     auto prop = Base::freecad_dynamic_cast<const PropertyPartShape>(&from);
     if(prop) {
+        prop->ensureRestored();
         setValue(prop->_Shape);
         _Ver = prop->_Ver;
     }
@@ -228,6 +370,10 @@ void PropertyPartShape::Paste(const App::Property &from)
 
 unsigned int PropertyPartShape::getMemSize () const
 {
+    if (_LazyShape) {
+        std::lock_guard<std::mutex> guard(_LazyShape->mutex);
+        return _Shape.getMemSize() + _LazyShape->data.size();
+    }
     return _Shape.getMemSize();
 }
 
@@ -250,7 +396,7 @@ void PropertyPartShape::beforeSave() const
     _HasherIndex = 0;
     _SaveHasher = false;
     auto owner = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
-    if(owner && !_Shape.isNull() && _Shape.getElementMapSize()>0) {
+    if(owner && !isShapeNull() && _Shape.getElementMapSize()>0) {
         auto ret = owner->getDocument()->addStringHasher(_Shape.Hasher);
         _HasherIndex = ret.second;
         _SaveHasher = ret.first;
@@ -262,7 +408,7 @@ void PropertyPartShape::Save (Base::Writer &writer) const
     //See SaveDocFile(), RestoreDocFile()
     writer.Stream() << writer.ind() << "<Part";
     auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
-    if(owner && !_Shape.isNull()
+    if(owner && !isShapeNull()
         && _Shape.getElementMapSize()>0
         && !_Shape.Hasher.isNull()) {
         writer.Stream() << " HasherIndex=\"" << _HasherIndex << '"';
@@ -280,6 +426,9 @@ void PropertyPartShape::Save (Base::Writer &writer) const
 
     bool binary = writer.getMode("BinaryBrep");
     bool toXML = writer.isForceXML();
+    if(toXML) {
+        ensureRestored();
+    }
     if(!toXML) {
         writer.Stream() << " file=\""
                         << writer.addFile(getFileName(binary?".bin":".brp").c_str(), this)
@@ -318,6 +467,7 @@ std::string PropertyPartShape::getElementMapVersion(bool restored) const {
 
 void PropertyPartShape::Restore(Base::XMLReader &reader)
 {
+    _LazyShape.reset();
     reader.readElement("Part");
 
     auto owner = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
@@ -420,10 +570,11 @@ void PropertyPartShape::afterRestore()
 }
 
 // The following function is copied from OCCT BRepTools.cxx and modified
-// to disable saving of triangulation
+// to make saving of triangulation optional
 //
 
-static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_CString File)
+static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_CString File,
+                                         Standard_Boolean withTriangles)
 {
   std::ofstream os;
   OSD_OpenStream(os, File, std::ios::out);
@@ -442,7 +593,7 @@ static Standard_Boolean  BRepTools_Write(const TopoDS_Shape& Sh, const Standard_
       VERSION_3 = 3
   };
 
-  BRepTools_ShapeSet SS(Standard_False);
+  BRepTools_ShapeSet SS(withTriangles);
   SS.SetFormatNb(VERSION_1);
   // SS.SetProgress(PR);
   SS.Add(Sh);
@@ -470,7 +621,8 @@ void PropertyPartShape::saveToFile(Base::Writer &writer) const
     static Base::FileInfo fi(App::Application::getTempFileName());
 
     TopoDS_Shape myShape = _Shape.getShape();
-    if (!BRepTools_Write(myShape,static_cast<Standard_CString>(fi.filePath().c_str()))) {
+    Standard_Boolean withTriangles = saveTessellation() ? Standard_True : Standard_False;
+    if (!BRepTools_Write(myShape,static_cast<Standard_CString>(fi.filePath().c_str()),withTriangles)) {
         // Note: Do NOT throw an exception here because if the tmp. file could
         // not be created we should not abort.
         // We only print an error message but continue writing the next files to the
@@ -561,6 +713,18 @@ void PropertyPartShape::loadFromStream(Base::Reader &reader)
 
 void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
 {
+    // If the shape is still not parsed since restore and is to be saved in
+    // the same format, simply write back the original data
+    if (_LazyShape) {
+        std::lock_guard<std::mutex> guard(_LazyShape->mutex);
+        if (!_LazyShape->loaded && _LazyShape->binary == writer.getMode("BinaryBrep")) {
+            writer.Stream().write(_LazyShape->data.c_str(),
+                                  static_cast<std::streamsize>(_LazyShape->data.size()));
+            return;
+        }
+    }
+    ensureRestored();
+
     // If the shape is empty we simply store nothing. The file size will be 0 which
     // can be checked when reading in the data.
     if (_Shape.getShape().IsNull())
@@ -569,7 +733,7 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
     if (writer.getMode("BinaryBrep")) {
         TopoShape shape;
         shape.setShape(myShape);
-        shape.exportBinary(writer.Stream());
+        shape.exportBinary(writer.Stream(), saveTessellation());
     }
     else {
         bool direct = App::GetApplication().GetParameterGroupByPath
@@ -580,14 +744,51 @@ void PropertyPartShape::SaveDocFile (Base::Writer &writer) const
         else {
             TopoShape shape;
             shape.setShape(myShape);
-            shape.exportBrep(writer.Stream());
+            shape.exportBrep(writer.Stream(), saveTessellation());
         }
     }
 }
 
+bool PropertyPartShape::saveTessellation()
+{
+    // The triangulation is stored inside the BREP data, so it is always restored together with
+    // the faces it belongs to. BRepMesh_IncrementalMesh keeps a triangulation whose deflection
+    // is fine enough, so the view does not need to mesh the shape again after opening.
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("SaveTessellation", false);
+}
+
+bool PropertyPartShape::canSaveDocFileConcurrently() const
+{
+    return App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("DirectAccess", true);
+}
+
 void PropertyPartShape::RestoreDocFile(Base::Reader &reader)
 {
     Base::FileInfo brep(reader.getFileName());
+    bool lazy = App::GetApplication().GetParameterGroupByPath
+        ("User parameter:BaseApp/Preferences/Mod/Part/General")->GetBool("LazyRestore", false);
+    if (lazy) {
+        auto data = std::make_shared<LazyShape>();
+        data->fileName = reader.getFileName();
+        data->binary = brep.hasExtension("bin");
+        std::ostringstream ss;
+        ss << reader.rdbuf();
+        data->data = ss.str();
+        // An empty file means an empty shape, which is cheap to restore
+        if (!data->data.empty()) {
+            _Shape.setShape(TopoDS_Shape(), false);
+            _LazyShape = data;
+            // Start parsing the shapes that are going to be displayed anyway while the other
+            // files of the document are still read. Visibility is restored by now.
+            auto owner = Base::freecad_dynamic_cast<App::DocumentObject>(getContainer());
+            if (owner && owner->Visibility.getValue()) {
+                prefetch();
+            }
+            return;
+        }
+    }
     if (brep.hasExtension("bin")) {
         TopoShape shape;
         shape.importBinary(reader);
@@ -890,7 +1091,7 @@ void PropertyShapeCache::Restore(Base::XMLReader &)
 PyObject *PropertyShapeCache::getPyObject() {
     Py::List res;
     for(auto &v : cache)
-        res.append(Py::TupleN(Py::String(v.first),shape2pyshape(v.second)));
+        res.append(Py::TupleN(Py::String(v.first),shape2pyshape(v.second.shape)));
     return Py::new_reference_to(res);
 }
 
@@ -911,6 +1112,105 @@ void PropertyShapeCache::setPyObject(PyObject *value) {
         cache.erase(sub);
 }
 
+namespace {
+
+/**
+ * The generations of the objects that other documents take shapes from, shared by all open
+ * documents. A cache entry made from such an object is valid as long as its generation has not
+ * changed. The generation of an object changes when its shape changes, and it is forgotten when
+ * its document is saved or closed. Generations are never reused.
+ */
+class SourceGenerations
+{
+public:
+    static SourceGenerations& instance()
+    {
+        static SourceGenerations generations;
+        return generations;
+    }
+
+    static std::string key(const App::DocumentObject* obj)
+    {
+        if (!obj->isAttachedToDocument()) {
+            return {};
+        }
+        auto doc = obj->getDocument();
+        const char* file = doc->FileName.getValue();
+        return std::string(file && *file ? file : doc->getName()) + '#'
+            + obj->getNameInDocument();
+    }
+
+    long add(const std::string& key)
+    {
+        return generations.emplace(key, ++counter).first->second;
+    }
+
+    /// The generation of the object of \a key, or 0 if it has been forgotten
+    long get(const std::string& key) const
+    {
+        auto it = generations.find(key);
+        return it == generations.end() ? 0 : it->second;
+    }
+
+private:
+    SourceGenerations()
+    {
+        auto& app = App::GetApplication();
+        connChanged = app.signalChangedObject.connect(
+            [this](const App::DocumentObject& obj, const App::Property& prop) {
+                if (!generations.empty() && isShapeProperty(prop)) {
+                    auto it = generations.find(key(&obj));
+                    if (it != generations.end()) {
+                        it->second = ++counter;
+                    }
+                }
+            });
+        connDeleted = app.signalDeletedObject.connect([this](const App::DocumentObject& obj) {
+            if (!generations.empty()) {
+                generations.erase(key(&obj));
+            }
+        });
+        connSave = app.signalStartSaveDocument.connect(
+            [this](const App::Document& doc, const std::string&) {
+                forget(doc);
+            });
+        connClose = app.signalDeleteDocument.connect([this](const App::Document& doc) {
+            forget(doc);
+        });
+    }
+
+    static bool isShapeProperty(const App::Property& prop)
+    {
+        auto name = prop.getName();
+        return name
+            && (strcmp(name, "Group") == 0 || strcmp(name, "Shape") == 0
+                || strstr(name, "Touched") != nullptr);
+    }
+
+    void forget(const App::Document& doc)
+    {
+        const char* file = doc.FileName.getValue();
+        std::string prefix = std::string(file && *file ? file : doc.getName()) + '#';
+        for (auto it = generations.begin(); it != generations.end();) {
+            if (it->first.compare(0, prefix.size(), prefix) == 0) {
+                it = generations.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    std::unordered_map<std::string, long> generations;
+    long counter = 0;
+    boost::signals2::scoped_connection connChanged;
+    boost::signals2::scoped_connection connDeleted;
+    boost::signals2::scoped_connection connSave;
+    boost::signals2::scoped_connection connClose;
+};
+
+}  // namespace
+
 #define SHAPE_CACHE_NAME "_Part_ShapeCache"
 /**
  * Find or create the shape cache for a document object
@@ -956,7 +1256,13 @@ bool PropertyShapeCache::getShape(const App::DocumentObject *obj, TopoShape &sha
     if(!subname) subname = "";
     auto it = prop->cache.find(subname);
     if(it!=prop->cache.end()) {
-        shape = it->second;
+        const CacheEntry &entry = it->second;
+        if(!entry.source.empty()
+                && SourceGenerations::instance().get(entry.source) != entry.generation) {
+            prop->cache.erase(it);
+            return false;
+        }
+        shape = entry.shape;
         return !shape.isNull();
     }
     return false;
@@ -967,9 +1273,12 @@ bool PropertyShapeCache::getShape(const App::DocumentObject *obj, TopoShape &sha
  * @param obj The Object
  * @param shape The shape to cache
  * @param subname The key to point at that shape
+ * @param source The object of another document the shape is taken from, if any
  */
-void PropertyShapeCache::setShape(
-    const App::DocumentObject *obj, const TopoShape &shape, const char *subname)
+void PropertyShapeCache::setShape(const App::DocumentObject *obj,
+                                  const TopoShape &shape,
+                                  const char *subname,
+                                  const App::DocumentObject *source)
 {
 // March, 2024 Toponaming project:  There was originally a feature to disable shape cache
 // that has not been kept:
@@ -979,7 +1288,14 @@ void PropertyShapeCache::setShape(
     if(!prop)
         return;
     if(!subname) subname = "";
-    prop->cache[subname] = shape;
+    CacheEntry &entry = prop->cache[subname];
+    entry.shape = shape;
+    entry.source.clear();
+    entry.generation = 0;
+    if(source && source->getDocument() != obj->getDocument() && source->isAttachedToDocument()) {
+        entry.source = SourceGenerations::key(source);
+        entry.generation = SourceGenerations::instance().add(entry.source);
+    }
 }
 
 void PropertyShapeCache::slotChanged(const App::DocumentObject &, const App::Property &prop) {
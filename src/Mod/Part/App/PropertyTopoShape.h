@@ -24,6 +24,7 @@
 #define PART_PROPERTYTOPOSHAPE_H
 
 #include <map>
+#include <memory>
 #include <vector>
 
 #include <App/PropertyGeo.h>
@@ -90,6 +91,8 @@ public:
 
     void SaveDocFile (Base::Writer &writer) const override;
     void RestoreDocFile(Base::Reader &reader) override;
+    /// Only without the temporary file used if 'DirectAccess' is disabled
+    bool canSaveDocFileConcurrently() const override;
 
     App::Property *Copy() const override;
     void Paste(const App::Property &from) override;
@@ -104,14 +107,36 @@ public:
 
     void afterRestore() override;
 
+    /** @name Lazy restore
+     * If enabled in the preferences, the shape data of a restored document is
+     * only read into memory, and parsed on first access to the shape.
+     */
+    //@{
+    /// Check if the restored shape data is not yet parsed
+    bool isLazyRestored() const {
+        return static_cast<bool>(_LazyShape);
+    }
+    /// Parse the restored shape data in the background, if not done yet
+    void prefetch() const;
+    //@}
+
     friend class Feature;
 
 private:
     void saveToFile(Base::Writer &writer) const;
     void loadFromFile(Base::Reader &reader);
     void loadFromStream(Base::Reader &reader);
+    /// Whether the face triangulations are saved together with the shape
+    static bool saveTessellation();
+    /// Parse the lazily restored shape data, if any
+    void ensureRestored() const;
+    bool isShapeNull() const {
+        return !_LazyShape && _Shape.isNull();
+    }
 
 private:
+    struct LazyShape;
+    mutable std::shared_ptr<LazyShape> _LazyShape;
     TopoShape _Shape;
     std::string _Ver;
     mutable int _HasherIndex = 0;
@@ -274,13 +299,24 @@ public:
 
     static PropertyShapeCache *get(const App::DocumentObject *obj, bool create);
     static bool getShape(const App::DocumentObject *obj, TopoShape &shape, const char *subname=0);
-    static void setShape(const App::DocumentObject *obj, const TopoShape &shape, const char *subname=0);
+    /** Add a shape to the cache of \a obj. If the shape is taken from an object of another
+     * document, pass it as \a source, the entry is then dropped as soon as \a source changes,
+     * its document is saved or closed.
+     */
+    static void setShape(const App::DocumentObject *obj, const TopoShape &shape,
+                         const char *subname=0, const App::DocumentObject *source=nullptr);
 
 private:
     void slotChanged(const App::DocumentObject &, const App::Property &prop);
 
 private:
-    std::unordered_map<std::string, TopoShape> cache;
+    struct CacheEntry {
+        TopoShape shape;
+        /// The document file and name of the object of another document the shape comes from
+        std::string source;
+        long generation = 0;
+    };
+    std::unordered_map<std::string, CacheEntry> cache;
     boost::signals2::scoped_connection connChanged;
 };
 
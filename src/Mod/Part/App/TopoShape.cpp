@@ -24,9 +24,13 @@
 
 #ifndef _PreComp_
 # include <array>
+# include <atomic>
 # include <cmath>
 # include <cstdlib>
+# include <future>
 # include <sstream>
+# include <thread>
+# include <unordered_map>
 # include <boost/regex.hpp>
 
 # include <APIHeaderSection_MakeHeader.hxx>
@@ -44,6 +48,7 @@
 # include <Mod/Part/App/FCBRepAlgoAPI_Section.h>
 # include <BRepBndLib.hxx>
 # include <BRepBuilderAPI_Copy.hxx>
+# include <BRepTools_History.hxx>
 # include <BRepBuilderAPI_FaceError.hxx>
 # include <BRepBuilderAPI_GTransform.hxx>
 # include <BRepBuilderAPI_MakeEdge.hxx>
@@ -121,7 +126,9 @@
 # include <Law_BSpline.hxx>
 # include <Law_BSpFunc.hxx>
 # include <Law_Constant.hxx>
+# include <Poly_Triangulation.hxx>
 # include <ShapeAnalysis_FreeBoundsProperties.hxx>
+# include <ShapeBuild_ReShape.hxx>
 # include <ShapeExtend_Explorer.hxx>
 # include <ShapeFix_Shape.hxx>
 # include <ShapeUpgrade_RemoveInternalWires.hxx>
@@ -138,6 +145,7 @@
 # include <TopoDS_Vertex.hxx>
 # include <TopExp.hxx>
 # include <TopExp_Explorer.hxx>
+# include <TopTools_IndexedMapOfShape.hxx>
 # include <TopTools_ListIteratorOfListOfShape.hxx>
 # include <TopTools_HSequenceOfShape.hxx>
 # include <Transfer_FinderProcess.hxx>
@@ -943,7 +951,7 @@ void TopoShape::exportBrep(const char *filename) const
 #endif
 }
 
-void TopoShape::exportBrep(std::ostream& out) const
+void TopoShape::exportBrep(std::ostream& out, bool withTriangles) const
 {
     // See TopTools_FormatVersion of OCCT 7.6
     enum {
@@ -951,14 +959,14 @@ void TopoShape::exportBrep(std::ostream& out) const
         VERSION_2 = 2,
         VERSION_3 = 3
     };
-    BRepTools_ShapeSet SS(Standard_False);
+    BRepTools_ShapeSet SS(withTriangles ? Standard_True : Standard_False);
     SS.SetFormatNb(VERSION_1);
     SS.Add(this->_Shape);
     SS.Write(out);
     SS.Write(this->_Shape, out);
 }
 
-void TopoShape::exportBinary(std::ostream& out) const
+void TopoShape::exportBinary(std::ostream& out, bool withTriangles) const
 {
     // See BinTools_FormatVersion of OCCT 7.6
     enum {
@@ -969,7 +977,12 @@ void TopoShape::exportBinary(std::ostream& out) const
     };
 
     // An example how to use BinTools_ShapeSet can be found in BinMNaming_NamedShapeDriver.cxx
+#if OCC_VERSION_HEX < 0x070600
+    BinTools_ShapeSet theShapeSet(withTriangles ? Standard_True : Standard_False);
+#else
     BinTools_ShapeSet theShapeSet;
+    theShapeSet.SetWithTriangles(withTriangles ? Standard_True : Standard_False);
+#endif
     theShapeSet.SetFormatNb(VERSION_3);
     if (this->_Shape.IsNull()) {
         theShapeSet.Add(this->_Shape);
@@ -3156,6 +3169,171 @@ bool TopoShape::fix(double precision, double mintol, double maxtol)
     return isValid();
 }
 
+namespace {
+
+/// Groups the sub-shapes that share vertices, the groups can be healed independently
+std::vector<std::vector<std::size_t>> groupSharingShapes(const std::vector<TopoDS_Shape>& shapes)
+{
+    std::vector<std::size_t> parent(shapes.size());
+    for (std::size_t i = 0; i < parent.size(); i++) {
+        parent[i] = i;
+    }
+    auto root = [&parent](std::size_t i) {
+        while (parent[i] != i) {
+            i = parent[i] = parent[parent[i]];
+        }
+        return i;
+    };
+
+    std::unordered_map<const TopoDS_TShape*, std::size_t> owners;
+    for (std::size_t i = 0; i < shapes.size(); i++) {
+        for (TopExp_Explorer xp(shapes[i], TopAbs_VERTEX); xp.More(); xp.Next()) {
+            auto res = owners.emplace(xp.Current().TShape().get(), i);
+            if (!res.second) {
+                parent[root(i)] = root(res.first->second);
+            }
+        }
+    }
+
+    std::vector<std::vector<std::size_t>> groups;
+    std::unordered_map<std::size_t, std::size_t> groupOfRoot;
+    for (std::size_t i = 0; i < shapes.size(); i++) {
+        auto res = groupOfRoot.emplace(root(i), groups.size());
+        if (res.second) {
+            groups.emplace_back();
+        }
+        groups[res.first->second].push_back(i);
+    }
+    return groups;
+}
+
+/** Heals one sub-shape the way TopoShape::fix() does, the history of the fix is merged into
+ * \a history. Returns the input if it cannot be healed.
+ */
+TopoDS_Shape fixSubShape(const TopoDS_Shape& shape,
+                         TopoShape::FixReport& report,
+                         const Handle(BRepTools_History)& history)
+{
+    try {
+        // a failed fix may damage its input, so try with a copy first
+        TopoDS_Shape copy = BRepBuilderAPI_Copy(shape).Shape();
+        ShapeFix_Shape fixCopy(copy);
+        fixCopy.Perform();
+        if (!BRepCheck_Analyzer(fixCopy.Shape()).IsValid()) {
+            report.valid = false;
+            return shape;
+        }
+
+        ShapeFix_Shape fixThis(shape);
+        fixThis.Perform();
+        if (BRepCheck_Analyzer(fixThis.Shape()).IsValid()) {
+            if (fixThis.Context() && fixThis.Context()->History()) {
+                history->Merge(fixThis.Context()->History());
+            }
+            report.fixed = !fixThis.Shape().IsSame(shape);
+            return fixThis.Shape();
+        }
+        // the elements of this sub-shape get new names
+        report.fixed = true;
+        return fixCopy.Shape();
+    }
+    catch (const Standard_Failure&) {
+        report.valid = false;
+        return shape;
+    }
+}
+
+}  // namespace
+
+std::vector<TopoShape::FixReport> TopoShape::fixParallel()
+{
+    std::vector<FixReport> reports;
+    if (this->_Shape.IsNull()) {
+        return reports;
+    }
+
+    std::vector<TopoDS_Shape> shapes;
+    if (this->_Shape.ShapeType() == TopAbs_COMPOUND) {
+        for (TopoDS_Iterator it(this->_Shape); it.More(); it.Next()) {
+            shapes.push_back(it.Value());
+        }
+    }
+    else {
+        shapes.push_back(this->_Shape);
+    }
+    reports.resize(shapes.size());
+    for (std::size_t i = 0; i < reports.size(); i++) {
+        reports[i].index = int(i + 1);
+    }
+
+    // Each group is checked and healed on one thread, so no shape data is shared between
+    // threads. The groups are handed out one by one, so a big group does not hold up the
+    // small ones.
+    std::vector<std::vector<std::size_t>> groups = groupSharingShapes(shapes);
+    std::vector<TopoDS_Shape> results(shapes);
+    std::vector<Handle(BRepTools_History)> histories(groups.size());
+    auto heal = [&](std::size_t g) {
+        histories[g] = new BRepTools_History;
+        for (auto i : groups[g]) {
+            try {
+                reports[i].invalid = !BRepCheck_Analyzer(shapes[i]).IsValid();
+            }
+            catch (const Standard_Failure&) {
+                reports[i].invalid = true;
+            }
+            if (reports[i].invalid) {
+                results[i] = fixSubShape(shapes[i], reports[i], histories[g]);
+            }
+        }
+    };
+
+    std::atomic<std::size_t> next {0};
+    auto worker = [&]() {
+        for (std::size_t g = next++; g < groups.size(); g = next++) {
+            heal(g);
+        }
+    };
+    std::size_t threads = std::max(std::thread::hardware_concurrency(), 1U);
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < std::min(threads, groups.size()); i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    bool changed = false;
+    for (const auto& report : reports) {
+        changed = changed || report.fixed;
+    }
+    if (!changed) {
+        return reports;
+    }
+
+    TopoDS_Shape result;
+    if (this->_Shape.ShapeType() == TopAbs_COMPOUND) {
+        BRep_Builder builder;
+        TopoDS_Compound comp;
+        builder.MakeCompound(comp);
+        for (const auto& shape : results) {
+            builder.Add(comp, shape);
+        }
+        result = comp;
+    }
+    else {
+        result = results.front();
+    }
+
+    Handle(BRepTools_History) history = new BRepTools_History;
+    for (const auto& h : histories) {
+        history->Merge(h);
+    }
+    // remap the element names like fix(), healing may remove or modify elements
+    makeShapeWithElementMap(result, MapperHistory(history), {*this});
+    return reports;
+}
+
 bool TopoShape::removeInternalWires(double minArea)
 {
     ShapeUpgrade_RemoveInternalWires fix(this->_Shape);
@@ -3341,6 +3519,108 @@ void TopoShape::getFaces(std::vector<Base::Vector3d> &aPoints,
     getFacesFromDomains(domains, aPoints, aTopo);
 }
 
+TopoShape::TessellationLayout TopoShape::prepareTessellation(double accuracy) const
+{
+    TessellationLayout layout;
+    if (this->_Shape.IsNull())
+        return layout;
+
+    BRepMesh_IncrementalMesh aMesh(this->_Shape, accuracy,
+                                   /*isRelative*/ Standard_False,
+                                   /*theAngDeflection*/
+                                   defaultAngularDeflection(accuracy),
+                                   /*isInParallel*/ true);
+
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(this->_Shape, TopAbs_FACE, faceMap);
+    layout.faces.reserve(faceMap.Extent());
+    layout.pointOffsets.reserve(faceMap.Extent() + 1);
+    layout.triangleOffsets.reserve(faceMap.Extent() + 1);
+
+    uint32_t numPoints = 0;
+    uint32_t numTriangles = 0;
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+        layout.faces.push_back(face);
+        layout.pointOffsets.push_back(numPoints);
+        layout.triangleOffsets.push_back(numTriangles);
+
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+        if (!mesh.IsNull()) {
+            numPoints += mesh->NbNodes();
+            numTriangles += mesh->NbTriangles();
+        }
+    }
+    layout.pointOffsets.push_back(numPoints);
+    layout.triangleOffsets.push_back(numTriangles);
+    return layout;
+}
+
+void TopoShape::fillTessellation(const TessellationLayout& layout,
+                                 float* points,
+                                 uint32_t* triangles) const
+{
+    for (std::size_t i = 0; i < layout.faces.size(); i++) {
+        const TopoDS_Face& face = layout.faces[i];
+        uint32_t pointOffset = layout.pointOffsets[i];
+        uint32_t numPoints = layout.pointOffsets[i + 1] - pointOffset;
+        uint32_t numTriangles = layout.triangleOffsets[i + 1] - layout.triangleOffsets[i];
+
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+        if (mesh.IsNull()) {
+            if (numPoints != 0 || numTriangles != 0)
+                FC_THROWM(Base::CADKernelError, "Triangulation of face " << i + 1 << " has changed");
+            continue;
+        }
+        if (mesh->NbNodes() != static_cast<int>(numPoints)
+            || mesh->NbTriangles() != static_cast<int>(numTriangles)) {
+            FC_THROWM(Base::CADKernelError, "Triangulation of face " << i + 1 << " has changed");
+        }
+
+        gp_Trsf transf;
+        bool identity = loc.IsIdentity();
+        if (!identity)
+            transf = loc.Transformation();
+
+#if OCC_VERSION_HEX < 0x070600
+        const TColgp_Array1OfPnt& nodes = mesh->Nodes();
+        const Poly_Array1OfTriangle& facets = mesh->Triangles();
+#endif
+        float* pnt = points + 3 * static_cast<std::size_t>(pointOffset);
+        for (int j = 1; j <= mesh->NbNodes(); j++) {
+#if OCC_VERSION_HEX < 0x070600
+            gp_Pnt p = nodes(j);
+#else
+            gp_Pnt p = mesh->Node(j);
+#endif
+            if (!identity)
+                p.Transform(transf);
+            *pnt++ = static_cast<float>(p.X());
+            *pnt++ = static_cast<float>(p.Y());
+            *pnt++ = static_cast<float>(p.Z());
+        }
+
+        // flip the triangles of reversed faces so that they point outwards
+        bool reversed = face.Orientation() != TopAbs_FORWARD;
+        uint32_t* tria = triangles + 3 * static_cast<std::size_t>(layout.triangleOffsets[i]);
+        for (int j = 1; j <= mesh->NbTriangles(); j++) {
+            Standard_Integer n1, n2, n3;
+#if OCC_VERSION_HEX < 0x070600
+            facets(j).Get(n1, n2, n3);
+#else
+            mesh->Triangle(j).Get(n1, n2, n3);
+#endif
+            if (reversed)
+                std::swap(n1, n2);
+            *tria++ = pointOffset + n1 - 1;
+            *tria++ = pointOffset + n2 - 1;
+            *tria++ = pointOffset + n3 - 1;
+        }
+    }
+}
+
 void TopoShape::setFaces(const std::vector<Base::Vector3d> &Points,
                          const std::vector<Facet> &Topo, double tolerance)
 {
@@ -3466,17 +3746,13 @@ void TopoShape::setFaces(const std::vector<Base::Vector3d> &Points,
         _Shape = aComp;
 }
 
-void TopoShape::getLinesFromSubShape(const TopoDS_Shape& shape,
-                                     std::vector<Base::Vector3d> &vertices,
-                                     std::vector<Line> &lines) const
-{
-    if (shape.IsNull())
-        return;
-
-    // build up map edge->face
-    TopTools_IndexedDataMapOfShapeListOfShape edge2Face;
-    TopExp::MapShapesAndAncestors(this->_Shape, TopAbs_EDGE, TopAbs_FACE, edge2Face);
+namespace {
 
+void getLinesFromEdges(const TopoDS_Shape& shape,
+                       const TopTools_IndexedDataMapOfShapeListOfShape& edge2Face,
+                       std::vector<Base::Vector3d> &vertices,
+                       std::vector<Data::ComplexGeoData::Line> &lines)
+{
     for (TopExp_Explorer exp(shape, TopAbs_EDGE); exp.More(); exp.Next()) {
         TopoDS_Edge aEdge = TopoDS::Edge(exp.Current());
         std::vector<gp_Pnt> points;
@@ -3513,6 +3789,52 @@ void TopoShape::getLinesFromSubShape(const TopoDS_Shape& shape,
     }
 }
 
+// Looks up sub-shapes by name, each map of a shape type is built on first use
+class SubShapeMaps
+{
+public:
+    explicit SubShapeMaps(const TopoDS_Shape& shape)
+        : shape(shape)
+    {
+    }
+
+    TopoDS_Shape find(const Data::IndexedName& name)
+    {
+        if (!name || shape.IsNull())
+            return {};
+        TopAbs_ShapeEnum type = TopoShape::shapeType(name.getType(), true);
+        if (type == TopAbs_SHAPE)
+            return {};
+        auto it = maps.find(type);
+        if (it == maps.end()) {
+            it = maps.emplace(type, TopTools_IndexedMapOfShape()).first;
+            TopExp::MapShapes(shape, type, it->second);
+        }
+        if (name.getIndex() < 1 || name.getIndex() > it->second.Extent())
+            return {};
+        return it->second.FindKey(name.getIndex());
+    }
+
+private:
+    const TopoDS_Shape& shape;
+    std::map<TopAbs_ShapeEnum, TopTools_IndexedMapOfShape> maps;
+};
+
+}
+
+void TopoShape::getLinesFromSubShape(const TopoDS_Shape& shape,
+                                     std::vector<Base::Vector3d> &vertices,
+                                     std::vector<Line> &lines) const
+{
+    if (shape.IsNull())
+        return;
+
+    // build up map edge->face
+    TopTools_IndexedDataMapOfShapeListOfShape edge2Face;
+    TopExp::MapShapesAndAncestors(this->_Shape, TopAbs_EDGE, TopAbs_FACE, edge2Face);
+    getLinesFromEdges(shape, edge2Face, vertices, lines);
+}
+
 void TopoShape::getLines(std::vector<Base::Vector3d> &vertices,
                          std::vector<TopoShape::Line> &lines,
                          double /*Accuracy*/, uint16_t /*flags*/) const
@@ -3666,6 +3988,63 @@ void TopoShape::getFacesFromSubElement(const Data::Segment* element,
     }
 }
 
+std::vector<Data::ComplexGeoData::Tessellation>
+TopoShape::getLinesFromSubElements(const std::vector<Data::IndexedName>& names) const
+{
+    std::vector<Tessellation> result(names.size());
+    if (_Shape.IsNull())
+        return result;
+
+    // getLinesFromSubElement() builds these for every single element
+    TopTools_IndexedDataMapOfShapeListOfShape edge2Face;
+    TopExp::MapShapesAndAncestors(this->_Shape, TopAbs_EDGE, TopAbs_FACE, edge2Face);
+    SubShapeMaps subShapes(_Shape);
+
+    for (std::size_t i = 0; i < names.size(); i++) {
+        TopoDS_Shape shape = subShapes.find(names[i]);
+        if (!shape.IsNull())
+            getLinesFromEdges(shape, edge2Face, result[i].points, result[i].lines);
+    }
+    return result;
+}
+
+std::vector<Data::ComplexGeoData::Tessellation>
+TopoShape::getFacesFromSubElements(const std::vector<Data::IndexedName>& names) const
+{
+    std::vector<Tessellation> result(names.size());
+    SubShapeMaps subShapes(_Shape);
+
+    for (std::size_t i = 0; i < names.size(); i++) {
+        TopoDS_Shape shape = subShapes.find(names[i]);
+        if (shape.IsNull() || shape.ShapeType() != TopAbs_FACE)
+            continue;
+
+        // A single face has no duplicated points, so unlike getFacesFromSubElement()
+        // the triangulation is taken as is. A face without one stays empty.
+        std::vector<gp_Pnt> points;
+        std::vector<Poly_Triangle> facets;
+        if (!Tools::getTriangulation(TopoDS::Face(shape), points, facets))
+            continue;
+        std::vector<gp_Vec> normals;
+        Tools::getPointNormals(points, facets, normals);
+
+        Tessellation& mesh = result[i];
+        mesh.points.reserve(points.size());
+        for (const auto& it : points)
+            mesh.points.push_back(Base::convertTo<Base::Vector3d>(it));
+        mesh.normals.reserve(normals.size());
+        for (const auto& it : normals)
+            mesh.normals.emplace_back(it.X(), it.Y(), it.Z());
+        mesh.facets.reserve(facets.size());
+        for (const auto& it : facets) {
+            Standard_Integer n1, n2, n3;
+            it.Get(n1, n2, n3);
+            mesh.facets.push_back({uint32_t(n1), uint32_t(n2), uint32_t(n3)});
+        }
+    }
+    return result;
+}
+
 TopoDS_Shape TopoShape::defeaturing(const std::vector<TopoDS_Shape>& s) const
 {
     if (this->_Shape.IsNull())
@@ -355,6 +355,39 @@ public:
                   const std::vector<Facet>& faces,
                   double tolerance = 1.0e-06);  // NOLINT
     void getDomains(std::vector<Domain>&) const;
+
+    /** Sizes of the buffers filled by fillTessellation()
+     *
+     * The offset tables have one entry per face, in the order of the face indices of the shape,
+     * followed by the total count. The points of a face are not shared with other faces.
+     */
+    struct TessellationLayout
+    {
+        std::vector<TopoDS_Face> faces;
+        std::vector<uint32_t> pointOffsets;
+        std::vector<uint32_t> triangleOffsets;
+
+        std::size_t countPoints() const
+        {
+            return pointOffsets.empty() ? 0 : pointOffsets.back();
+        }
+        std::size_t countTriangles() const
+        {
+            return triangleOffsets.empty() ? 0 : triangleOffsets.back();
+        }
+    };
+    /// Tessellate the shape with the given accuracy and return the layout of the result
+    TessellationLayout prepareTessellation(double accuracy) const;
+    /** Write the tessellation described by \a layout into caller provided buffers
+     *
+     * @param layout: the result of prepareTessellation()
+     * @param points: receives x, y, z of each point, must hold 3 * layout.countPoints() values
+     * @param triangles: receives the three point indices of each triangle, must hold
+     * 3 * layout.countTriangles() values
+     */
+    void fillTessellation(const TessellationLayout& layout,
+                          float* points,
+                          uint32_t* triangles) const;
     //@}
 
     /** @name Subelement management */
@@ -381,6 +414,12 @@ public:
                                 std::vector<Base::Vector3d>& Points,
                                 std::vector<Base::Vector3d>& PointNormals,
                                 std::vector<Facet>& faces) const override;
+    /** Get lines from many sub-shapes, the maps of the sub-shapes are built once for all */
+    std::vector<Tessellation>
+    getLinesFromSubElements(const std::vector<Data::IndexedName>& names) const override;
+    /** Get faces from many sub-shapes, taken from the existing triangulation of the faces */
+    std::vector<Tessellation>
+    getFacesFromSubElements(const std::vector<Data::IndexedName>& names) const override;
     //@}
     /**
      * Locate the TopoDS_Shape associated with a Topo"sub"Shape of the given name
@@ -474,8 +513,10 @@ public:
     void exportIges(const char* FileName) const;
     void exportStep(const char* FileName) const;
     void exportBrep(const char* FileName) const;
-    void exportBrep(std::ostream&) const;
-    void exportBinary(std::ostream&) const;
+    /// Writes the shape in BREP format, optionally including the face triangulations
+    void exportBrep(std::ostream&, bool withTriangles = false) const;
+    /// Writes the shape in binary BREP format, optionally including the face triangulations
+    void exportBinary(std::ostream&, bool withTriangles = false) const;
     void exportStl(const char* FileName, double deflection) const;
     void exportFaceSet(double, double, const std::vector<App::Color>&, std::ostream&) const;
     void exportLineSet(std::ostream&) const;
@@ -618,6 +659,25 @@ public:
     void sewShape(double tolerance = 1.0e-06);
     bool fix();
     bool fix(double, double, double);
+    /// The outcome of healing one sub-shape of a compound with fixParallel()
+    struct FixReport
+    {
+        /// The index of the sub-shape in the compound, starting at 1
+        int index = 0;
+        /// True if the sub-shape failed the check before healing
+        bool invalid = false;
+        /// True if healing replaced the sub-shape
+        bool fixed = false;
+        /// True if the sub-shape is valid afterwards
+        bool valid = true;
+    };
+    /** Heals the sub-shapes of a compound that fail BRepCheck_Analyzer, valid ones are kept
+     * as they are. Sub-shapes that share no vertex are independent and are checked and healed
+     * on several threads, sub-shapes sharing vertices, e.g. instances of a part, are handled
+     * together on one thread. A shape that is no compound is handled as a single sub-shape.
+     * @return The report of each sub-shape
+     */
+    std::vector<FixReport> fixParallel();
     bool fixSolidOrientation();
     bool removeInternalWires(double);
     TopoDS_Shape removeSplitter() const;
@@ -1646,6 +1706,31 @@ public:
                                        const Mapper &mapper,
                                        const std::vector<TopoShape> &sources,
                                        const char *op=nullptr);
+
+    /** Defer element map generation on the current thread
+     *
+     * While an instance is alive, makeShapeWithElementMap() only records the
+     * shape history reported by the mapper. The element map is built from
+     * that record the first time the names are accessed, or not at all if
+     * the shape is discarded before that. Instances can be nested.
+     */
+    class PartExport DeferElementMap
+    {
+    public:
+        explicit DeferElementMap(bool enable = true);
+        ~DeferElementMap();
+
+        DeferElementMap(const DeferElementMap&) = delete;
+        DeferElementMap& operator=(const DeferElementMap&) = delete;
+
+    private:
+        bool _previous;
+    };
+    /// Check if element map generation is deferred on the current thread
+    static bool isElementMapDeferred();
+    /// Check if the element map of this shape is built on demand
+    bool hasDeferredElementMap() const;
+
     /**
      * When given a single shape to create a compound, two results are possible: either to simply
      * return the shape as given, or to force it to be placed in a Compound.
@@ -2007,6 +2092,19 @@ public:
     {
         return TopoShape(0, Hasher).makeElementSlices(*this, dir, distances, op);
     }
+    /** Make multiple cross section slices, slicing several levels in parallel
+     *
+     * @param dir: direction of the normal of the section plane
+     * @param distances: distances to move the section plane for making slices
+     * @param op: optional string to be encoded into topo naming for indicating
+     *            the operation
+     *
+     * @return Return the wires of each slice, in the order of \a distances.
+     *         The TopoShape itself is not modified.
+     */
+    std::vector<std::vector<TopoShape>> makeElementSlicesPerLevel(const Base::Vector3d& dir,
+                                                                  const std::vector<double>& distances,
+                                                                  const char* op = nullptr) const;
 
     /* Make fillet shape
      *
@@ -2569,8 +2667,11 @@ public:
     friend class TopoShapeCache;
 
 private:
+    struct DeferredElementMap;
+
     // Cache storage
     mutable std::shared_ptr<TopoShapeCache> _parentCache;
+    mutable std::shared_ptr<DeferredElementMap> _deferredMap;
     mutable std::shared_ptr<TopoShapeCache> _cache;
     mutable TopLoc_Location _subLocation;
 
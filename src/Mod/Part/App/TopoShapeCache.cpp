@@ -23,6 +23,13 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#endif
+
 #include "TopoShapeCache.h"
 
 using namespace Part;
@@ -45,7 +52,8 @@ TopoShape TopoShapeCache::Ancestry::_getTopoShape(const TopoShape& parent, int i
     auto& ts = topoShapes[index - 1];
     if (ts.isNull()) {
         ts.setShape(shapes.FindKey(index), true);
-        ts.initCache();
+        // The sub-location below is specific to this parent, so do not share the cache
+        ts.initCache(1);
         ts._cache->subLocation = ts._Shape.Location();
     }
 
@@ -152,10 +160,73 @@ int TopoShapeCache::Ancestry::count() const
 }
 
 
+namespace
+{
+
+/// Caches handed out by TopoShapeCache::acquire(), indexed by their TopoDS_TShape. The entries
+/// are removed by the destructor of the cache, which keeps the TShape alive until then.
+struct CacheRegistry
+{
+    std::mutex mutex;
+    std::unordered_map<const TopoDS_TShape*, std::vector<std::weak_ptr<TopoShapeCache>>> caches;
+
+    static CacheRegistry& instance()
+    {
+        static CacheRegistry registry;
+        return registry;
+    }
+};
+
+}  // namespace
+
 TopoShapeCache::TopoShapeCache(const TopoDS_Shape& tds)
     : shape(tds.Located(TopLoc_Location()))
 {}
 
+TopoShapeCache::~TopoShapeCache()
+{
+    if (!shared) {
+        return;
+    }
+    auto& registry = CacheRegistry::instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto it = registry.caches.find(shape.TShape().get());
+    if (it == registry.caches.end()) {
+        return;
+    }
+    auto& entries = it->second;
+    entries.erase(std::remove_if(entries.begin(),
+                                 entries.end(),
+                                 [](const std::weak_ptr<TopoShapeCache>& entry) {
+                                     return entry.expired();
+                                 }),
+                  entries.end());
+    if (entries.empty()) {
+        registry.caches.erase(it);
+    }
+}
+
+std::shared_ptr<TopoShapeCache> TopoShapeCache::acquire(const TopoDS_Shape& tds,
+                                                        const Data::ElementMapPtr& elementMap)
+{
+    if (tds.IsNull()) {
+        return std::make_shared<TopoShapeCache>(tds);
+    }
+    auto& registry = CacheRegistry::instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto& entries = registry.caches[tds.TShape().get()];
+    for (const auto& entry : entries) {
+        auto cache = entry.lock();
+        if (cache && !cache->isTouched(tds) && cache->cachedElementMap == elementMap) {
+            return cache;
+        }
+    }
+    auto cache = std::make_shared<TopoShapeCache>(tds);
+    cache->shared = true;
+    entries.push_back(cache);
+    return cache;
+}
+
 void TopoShapeCache::insertRelation(const ShapeRelationKey& key,
                                     const QVector<Data::MappedElement>& value)
 {
@@ -37,6 +37,7 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopTools_ListIteratorOfListOfShape.hxx>
+#include <memory>
 #include <utility>
 #endif
 
@@ -119,6 +120,23 @@ public:
     };
 
     explicit TopoShapeCache(const TopoDS_Shape& tds);
+    ~TopoShapeCache();
+    TopoShapeCache(const TopoShapeCache&) = delete;
+    TopoShapeCache& operator=(const TopoShapeCache&) = delete;
+
+    /// Returns a cache for the given shape that is shared by all TopoShape instances holding the
+    /// same TopoDS_TShape with the same orientation and element map, so that the sub-shape and
+    /// ancestor maps survive copying the TopoDS_Shape out of a property.
+    static std::shared_ptr<TopoShapeCache> acquire(const TopoDS_Shape& tds,
+                                                   const Data::ElementMapPtr& elementMap);
+
+    /// Whether this cache was obtained through acquire() and may be in use by unrelated
+    /// TopoShape instances
+    bool isShared() const
+    {
+        return shared;
+    }
+
     void insertRelation(const ShapeRelationKey& key, const QVector<Data::MappedElement>& value);
     bool isTouched(const TopoDS_Shape& tds) const;
     Ancestry& getAncestry(TopAbs_ShapeEnum type);
@@ -141,6 +159,9 @@ public:
     std::array<Ancestry, TopAbs_SHAPE + 1> shapeAncestryCache;
 
     std::map<ShapeRelationKey, QVector<Data::MappedElement>> relations;
+
+private:
+    bool shared = false;
 };
 
 }  // namespace Part
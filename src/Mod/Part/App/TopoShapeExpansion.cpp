@@ -34,6 +34,7 @@
 #include <BRepAdaptor_HCompCurve.hxx>
 #endif
 
+#include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepFill.hxx>
@@ -57,6 +58,7 @@
 #include <BRepFilletAPI_MakeChamfer.hxx>
 #include <BRepFilletAPI_MakeFillet.hxx>
 #include <BRepLib.hxx>
+#include <Bnd_Box.hxx>
 #include <BRepOffsetAPI_DraftAngle.hxx>
 #include <BRepOffsetAPI_MakeFilling.hxx>
 #include <BRepOffsetAPI_MakePipe.hxx>
@@ -79,6 +81,7 @@
 #include <ShapeFix_ShapeTolerance.hxx>
 #include <gp_Pln.hxx>
 
+#include <mutex>
 #include <utility>
 
 #endif
@@ -94,9 +97,12 @@
 #include "TopoShapeCache.h"
 #include "TopoShapeMapper.h"
 #include "FaceMaker.h"
+#include "FuzzyHelper.h"
 #include "Geometry.h"
+#include "ProgressIndicator.h"
 #include "BRepOffsetAPI_MakeOffsetFix.h"
 #include "Base/Tools.h"
+#include "Base/Trace.h"
 #include "Base/BoundBox.h"
 
 #include <App/ElementMap.h>
@@ -131,6 +137,69 @@ static void expandCompound(const TopoShape& shape, std::vector<TopoShape>& res)
     }
 }
 
+namespace
+{
+thread_local bool _DeferElementMap = false;
+
+/// Mapper replaying the shape history recorded by a deferred makeShapeWithElementMap()
+struct RecordedMapper: TopoShape::Mapper
+{
+    using ShapeMap =
+        std::unordered_map<TopoDS_Shape, std::vector<TopoDS_Shape>, ShapeHasher, ShapeHasher>;
+    ShapeMap generatedShapes;
+    ShapeMap modifiedShapes;
+
+    const std::vector<TopoDS_Shape>& generated(const TopoDS_Shape& s) const override
+    {
+        auto it = generatedShapes.find(s);
+        return it != generatedShapes.end() ? it->second : _res;
+    }
+
+    const std::vector<TopoDS_Shape>& modified(const TopoDS_Shape& s) const override
+    {
+        auto it = modifiedShapes.find(s);
+        return it != modifiedShapes.end() ? it->second : _res;
+    }
+};
+}  // namespace
+
+/// Everything makeShapeWithElementMap() needs to build the element map later
+struct TopoShape::DeferredElementMap
+{
+    TopoDS_Shape shape;
+    std::vector<TopoShape> sources;
+    RecordedMapper mapper;
+    std::string op;
+    long tag = 0;
+    App::StringHasherRef hasher;
+
+    std::mutex mutex;
+    bool done = false;
+    Data::ElementMapPtr result;
+    App::StringHasherRef resultHasher;
+};
+
+TopoShape::DeferElementMap::DeferElementMap(bool enable)
+    : _previous(_DeferElementMap)
+{
+    _DeferElementMap = enable;
+}
+
+TopoShape::DeferElementMap::~DeferElementMap()
+{
+    _DeferElementMap = _previous;
+}
+
+bool TopoShape::isElementMapDeferred()
+{
+    return _DeferElementMap;
+}
+
+bool TopoShape::hasDeferredElementMap() const
+{
+    return static_cast<bool>(_deferredMap);
+}
+
 void TopoShape::initCache(int reset) const
 {
     if (reset > 0 || !_cache || _cache->isTouched(_Shape)) {
@@ -138,12 +207,23 @@ void TopoShape::initCache(int reset) const
             _parentCache.reset();
             _subLocation.Identity();
         }
-        _cache = std::make_shared<TopoShapeCache>(_Shape);
+        if (reset > 0) {
+            _cache = std::make_shared<TopoShapeCache>(_Shape);
+        }
+        else {
+            _cache = TopoShapeCache::acquire(_Shape, elementMap(false));
+        }
     }
 }
 
 Data::ElementMapPtr TopoShape::resetElementMap(Data::ElementMapPtr elementMap)
 {
+    _deferredMap.reset();
+    if (_cache && _cache->isShared() && elementMap && _cache->cachedElementMap != elementMap
+        && _cache.use_count() > 1) {
+        // Do not hand our element map to unrelated shapes sharing the same TShape
+        _cache = TopoShapeCache::acquire(_Shape, elementMap);
+    }
     if (_cache && elementMap != this->elementMap(false)) {
         for (auto& info : _cache->shapeAncestryCache) {
             info.clear();
@@ -163,6 +243,32 @@ Data::ElementMapPtr TopoShape::resetElementMap(Data::ElementMapPtr elementMap)
 
 void TopoShape::flushElementMap() const
 {
+    if (_deferredMap) {
+        auto deferred = std::move(_deferredMap);
+        _deferredMap.reset();
+        std::lock_guard<std::mutex> lock(deferred->mutex);
+        if (!deferred->done) {
+            // Copies of this shape share the record, so build the map only once
+            DeferElementMap guard(false);
+            TopoShape res(deferred->tag, deferred->hasher);
+            res.makeShapeWithElementMap(deferred->shape,
+                                        deferred->mapper,
+                                        deferred->sources,
+                                        deferred->op.c_str());
+            deferred->result = res.elementMap();
+            deferred->resultHasher = res.Hasher;
+            deferred->done = true;
+            // Release the history, it is no longer needed
+            deferred->sources.clear();
+            deferred->mapper = RecordedMapper();
+        }
+        auto self = const_cast<TopoShape*>(this);
+        if (!self->Hasher) {
+            self->Hasher = deferred->resultHasher;
+        }
+        self->resetElementMap(deferred->result);
+        return;
+    }
     initCache();
     if (!elementMap(false) && this->_cache) {
         if (this->_cache->cachedElementMap) {
@@ -281,6 +387,7 @@ void TopoShape::operator=(const TopoShape& sh)
         this->_parentCache = sh._parentCache;
         this->_subLocation = sh._subLocation;
         resetElementMap(sh.elementMap(false));
+        this->_deferredMap = sh._deferredMap;
     }
 }
 
@@ -714,6 +821,9 @@ std::vector<TopoDS_Shape> TopoShape::findAncestorsShapes(const TopoDS_Shape& sub
 
 bool TopoShape::hasPendingElementMap() const
 {
+    if (_deferredMap) {
+        return true;
+    }
     return !elementMap(false) && this->_cache
         && (this->_parentCache || this->_cache->cachedElementMap);
 }
@@ -881,6 +991,9 @@ void TopoShape::mapSubElementForShape(const TopoShape& other, const char* op)
 
 void TopoShape::mapSubElement(const TopoShape& other, const char* op, bool forceHasher)
 {
+    if (_deferredMap) {
+        flushElementMap();
+    }
     if (!canMapElement(other)) {
         return;
     }
@@ -1043,6 +1156,9 @@ void TopoShape::mapSubElement(const std::vector<TopoShape>& shapes, const char*
     if (shapes.empty()) {
         return;
     }
+    if (_deferredMap) {
+        flushElementMap();
+    }
 
     if (shapeType(true) == TopAbs_COMPOUND) {
         int count = 0;
@@ -1390,6 +1506,7 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
                                               const std::vector<TopoShape>& shapes,
                                               const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeShapeWithElementMap");
     setShape(shape);
     if (shape.IsNull()) {
         FC_THROWM(NullShapeException, "Null shape");
@@ -1415,6 +1532,38 @@ TopoShape& TopoShape::makeShapeWithElementMap(const TopoDS_Shape& shape,
     if (!op) {
         op = Part::OpCodes::Maker;
     }
+
+    if (_DeferElementMap) {
+        // Only record the history here, flushElementMap() builds the names
+        auto deferred = std::make_shared<DeferredElementMap>();
+        deferred->shape = shape;
+        deferred->sources = shapes;
+        deferred->op = op;
+        deferred->tag = Tag;
+        deferred->hasher = Hasher;
+        for (const auto& incomingShape : shapes) {
+            if (!canMapElement(incomingShape)) {
+                continue;
+            }
+            for (auto type : {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE}) {
+                auto& otherMap = incomingShape._cache->getAncestry(type);
+                for (int i = 1; i <= otherMap.count(); i++) {
+                    const auto& otherElement = otherMap.find(incomingShape._Shape, i);
+                    const auto& modified = mapper.modified(otherElement);
+                    if (!modified.empty()) {
+                        deferred->mapper.modifiedShapes.emplace(otherElement, modified);
+                    }
+                    const auto& generated = mapper.generated(otherElement);
+                    if (!generated.empty()) {
+                        deferred->mapper.generatedShapes.emplace(otherElement, generated);
+                    }
+                }
+            }
+        }
+        _deferredMap = std::move(deferred);
+        return *this;
+    }
+
     std::string _op = op;
     _op += '_';
 
@@ -2355,6 +2504,7 @@ TopoShape& TopoShape::makeElementPipeShell(const std::vector<TopoShape>& shapes,
                                            double tolBound,
                                            double tolAngular)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementPipeShell");
     if (!op) {
         op = Part::OpCodes::PipeShell;
     }
@@ -2427,6 +2577,7 @@ TopoShape& TopoShape::makeElementOffset(const TopoShape& shape,
                                         FillType fill,
                                         const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementOffset");
     if (!op) {
         op = Part::OpCodes::Offset;
     }
@@ -2959,6 +3110,7 @@ TopoShape& TopoShape::makeElementThickSolid(const TopoShape& shape,
                                             JoinType join,
                                             const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementThickSolid");
     if (!op) {
         op = Part::OpCodes::Thicken;
     }
@@ -3622,6 +3774,7 @@ TopoShape& TopoShape::makeElementFilledFace(const std::vector<TopoShape>& _shape
                                             const BRepFillingParams& params,
                                             const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementFilledFace");
     if (!op) {
         op = Part::OpCodes::FilledFace;
     }
@@ -3907,14 +4060,21 @@ TopoShape& TopoShape::makeElementSlices(const TopoShape& shape,
                                         const char* op)
 {
     std::vector<TopoShape> wires;
-    TopoCrossSection cs(dir.x, dir.y, dir.z, shape, op);
-    int index = 0;
-    for (auto& distance : distances) {
-        cs.slice(++index, distance, wires);
+    for (auto& levelWires : shape.makeElementSlicesPerLevel(dir, distances, op)) {
+        wires.insert(wires.end(), levelWires.begin(), levelWires.end());
     }
     return makeElementCompound(wires, op, SingleShapeCompoundCreationPolicy::returnShape);
 }
 
+std::vector<std::vector<TopoShape>>
+TopoShape::makeElementSlicesPerLevel(const Base::Vector3d& dir,
+                                     const std::vector<double>& distances,
+                                     const char* op) const
+{
+    TopoCrossSection cs(dir.x, dir.y, dir.z, *this, op);
+    return cs.slices(distances);
+}
+
 TopoShape& TopoShape::replaceElementShape(const TopoShape& shape,
                                           const std::vector<std::pair<TopoShape, TopoShape>>& s)
 {
@@ -3963,6 +4123,7 @@ TopoShape& TopoShape::makeElementFillet(const TopoShape& shape,
                                         double radius2,
                                         const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementFillet");
     if (!op) {
         op = Part::OpCodes::Fillet;
     }
@@ -3984,6 +4145,11 @@ TopoShape& TopoShape::makeElementFillet(const TopoShape& shape,
         }
         mkFillet.Add(radius1, radius2, TopoDS::Edge(edge));
     }
+#if OCC_VERSION_HEX >= 0x070500
+    Handle(CancelIndicator) pi = new CancelIndicator();
+    mkFillet.Build(pi->Start());
+    pi->check();
+#endif
     return makeElementShape(mkFillet, shape, op);
 }
 
@@ -3995,6 +4161,7 @@ TopoShape& TopoShape::makeElementChamfer(const TopoShape& shape,
                                          const char* op,
                                          Flip flipDirection)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementChamfer");
     if (!op) {
         op = Part::OpCodes::Chamfer;
     }
@@ -4036,6 +4203,11 @@ TopoShape& TopoShape::makeElementChamfer(const TopoShape& shape,
                 break;
         }
     }
+#if OCC_VERSION_HEX >= 0x070500
+    Handle(CancelIndicator) pi = new CancelIndicator();
+    mkChamfer.Build(pi->Start());
+    pi->check();
+#endif
     return makeElementShape(mkChamfer, shape, op);
 }
 
@@ -4044,6 +4216,7 @@ TopoShape& TopoShape::makeElementGeneralFuse(const std::vector<TopoShape>& _shap
                                              double tol,
                                              const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementGeneralFuse");
     if (!op) {
         op = Part::OpCodes::GeneralFuse;
     }
@@ -4147,6 +4320,7 @@ TopoShape& TopoShape::makeElementLoft(const std::vector<TopoShape>& shapes,
                                       Standard_Integer maxDegree,
                                       const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementLoft");
     if (!op) {
         op = Part::OpCodes::Loft;
     }
@@ -4237,6 +4411,7 @@ TopoShape& TopoShape::makeElementPrismUntil(const TopoShape& _base,
                                             Standard_Boolean checkLimits,
                                             const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementPrismUntil");
     if (!op) {
         op = Part::OpCodes::Prism;
     }
@@ -4458,6 +4633,7 @@ TopoShape& TopoShape::makeElementRevolution(const TopoShape& _base,
                                             Standard_Boolean Modify,
                                             const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementRevolution");
     if (!op) {
         op = Part::OpCodes::Revolve;
     }
@@ -4500,6 +4676,7 @@ TopoShape& TopoShape::makeElementDraft(const TopoShape& shape,
                                        bool retry,
                                        const char* op)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementDraft");
     if (!op) {
         op = Part::OpCodes::Draft;
     }
@@ -4637,6 +4814,7 @@ public:
 
 TopoShape& TopoShape::makeElementRefine(const TopoShape& shape, const char* op, RefineFail no_fail)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementRefine");
     if (shape.isNull()) {
         if (no_fail == RefineFail::throwException) {
             FC_THROWM(NullShapeException, "Null shape");
@@ -5549,6 +5727,36 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
     return makeElementBoolean(maker, std::vector<TopoShape>(1, shape), op, tolerance);
 }
 
+/** Returns the argument of a cut followed by the tools whose bounding box overlaps the one of
+ * the argument, enlarged by the fuzzy value. The other tools cannot touch the argument and so
+ * cannot change the result, skipping them saves intersecting them in the boolean.
+ */
+static std::vector<TopoShape> getCutToolsTouchingArgument(const std::vector<TopoShape>& inputs,
+                                                          double tolerance)
+{
+    std::vector<Bnd_Box> boxes(inputs.size());
+    Bnd_Box bounds;
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        BRepBndLib::Add(inputs[i].getShape(), boxes[i]);
+        bounds.Add(boxes[i]);
+    }
+
+    // same as FCBRepAlgoAPIHelper::setAutoFuzzy()
+    double gap = tolerance;
+    if (tolerance < 0.0 && !bounds.IsVoid()) {
+        gap = FuzzyHelper::getBooleanFuzzy() * sqrt(bounds.SquareExtent()) * Precision::Confusion();
+    }
+    Bnd_Box argument = boxes[0];
+    argument.Enlarge(std::max(gap, 0.0) + Precision::Confusion());
+
+    std::vector<TopoShape> result {inputs[0]};
+    for (std::size_t i = 1; i < inputs.size(); ++i) {
+        if (!argument.IsOut(boxes[i])) {
+            result.push_back(inputs[i]);
+        }
+    }
+    return result;
+}
 
 // TODO: Refactor this so that each OpCode type is a separate method to reduce size
 TopoShape& TopoShape::makeElementBoolean(const char* maker,
@@ -5556,6 +5764,7 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
                                          const char* op,
                                          double tolerance)
 {
+    FC_TRACE_ZONE("TopoShape::makeElementBoolean", maker);
     if (!maker) {
         FC_THROWM(Base::CADKernelError, "no maker");
     }
@@ -5674,10 +5883,21 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
         _shapes = shapes;
     }
 
-    const auto& inputs = _shapes.size() ? _shapes : shapes;
-    if (inputs.empty()) {
+    const auto& allInputs = _shapes.size() ? _shapes : shapes;
+    if (allInputs.empty()) {
         FC_THROWM(NullShapeException, "Null input shape");
     }
+
+    std::vector<TopoShape> touchingInputs;
+    if (strcmp(maker, Part::OpCodes::Cut) == 0 && allInputs.size() > 2) {
+        // Patterns and holes hand in many tools, which often lie partly outside the argument
+        touchingInputs = getCutToolsTouchingArgument(allInputs, tolerance);
+        if (touchingInputs.size() == 1) {
+            *this = touchingInputs[0];
+            return *this;
+        }
+    }
+    const auto& inputs = touchingInputs.empty() ? allInputs : touchingInputs;
     if (inputs.size() == 1) {
         *this = inputs[0];
         if (shapes.size() == 1) {
@@ -5735,12 +5955,23 @@ TopoShape& TopoShape::makeElementBoolean(const char* maker,
 
     mk->SetArguments(shapeArguments);
     mk->SetTools(shapeTools);
+    if (shapeTools.Extent() > 1) {
+        // Let OCCT reject non-interfering sub-shape pairs by their oriented bounding boxes. These
+        // are much tighter than the axis-aligned ones for the rotated tools of a pattern.
+        mk->SetUseOBB(Standard_True);
+    }
     if (tolerance > 0.0) {
         mk->SetFuzzyValue(tolerance);
     } else if (tolerance < 0.0) {
         FCBRepAlgoAPIHelper::setAutoFuzzy(mk.get());
     }
+#if OCC_VERSION_HEX >= 0x070500
+    Handle(CancelIndicator) pi = new CancelIndicator();
+    mk->Build(pi->Start());
+    pi->check();
+#else
     mk->Build();
+#endif
     makeElementShape(*mk, inputs, op);
 
     if (buildShell) {
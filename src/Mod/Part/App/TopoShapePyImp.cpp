@@ -70,6 +70,7 @@
 #include <App/StringHasherPy.h>
 #include <Base/FileInfo.h>
 #include <Base/GeometryPyCXX.h>
+#include <Base/Interpreter.h>
 #include <Base/MatrixPy.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Base/Rotation.h>
@@ -682,7 +683,13 @@ static PyObject *makeShape(const char *op,const TopoShape &shape, PyObject *args
         std::vector<TopoShape> shapes;
         shapes.push_back(shape);
         getPyShapes(pcObj,shapes);
-        return Py::new_reference_to(shape2pyshape(TopoShape().makeElementBoolean(op,shapes,0,tol)));
+        TopoShape res;
+        {
+            // the operation works on copies of the shapes, see PyGILStateRelease
+            Base::PyGILStateRelease release;
+            res.makeElementBoolean(op,shapes,0,tol);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     } PY_CATCH_OCC
 }
 
@@ -780,6 +787,40 @@ PyObject*  TopoShapePy::slices(PyObject *args)
     }
 }
 
+PyObject*  TopoShapePy::slicesParallel(PyObject *args)
+{
+    PyObject *dir, *dist;
+    if (!PyArg_ParseTuple(args, "O!O", &(Base::VectorPy::Type), &dir, &dist))
+        return nullptr;
+
+    try {
+        Base::Vector3d vec = Py::Vector(dir, false).toVector();
+        Py::Sequence list(dist);
+        std::vector<double> d;
+        d.reserve(list.size());
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it)
+            d.push_back((double)Py::Float(*it));
+
+        Py::List levels;
+        for (auto& wires : getTopoShapePtr()->makeElementSlicesPerLevel(vec, d)) {
+            Py::List level;
+            for (auto& w : wires) {
+                level.append(shape2pyshape(w));
+            }
+            levels.append(level);
+        }
+        return Py::new_reference_to(levels);
+    }
+    catch (Standard_Failure& e) {
+        PyErr_SetString(PartExceptionOCCError, e.GetMessageString());
+        return nullptr;
+    }
+    catch (const std::exception& e) {
+        PyErr_SetString(PartExceptionOCCError, e.what());
+        return nullptr;
+    }
+}
+
 PyObject*  TopoShapePy::cut(PyObject *args)
 {
     return makeShape(Part::OpCodes::Cut, *getTopoShapePtr(), args);
@@ -798,7 +839,10 @@ PyObject*  TopoShapePy::generalFuse(PyObject *args)
     try {
         getPyShapes(pcObj, shapes);
         TopoShape res;
-        res.makeElementGeneralFuse(shapes, modifies, tolerance);
+        {
+            Base::PyGILStateRelease release;
+            res.makeElementGeneralFuse(shapes, modifies, tolerance);
+        }
         Py::List mapPy;
         for (auto& mod : modifies) {
             Py::List shapesPy;
@@ -1156,8 +1200,14 @@ PyObject* TopoShapePy::makeFillet(PyObject *args)
     }
     PY_TRY
     {
-        return Py::new_reference_to(shape2pyshape(
-            getTopoShapePtr()->makeElementFillet(getPyShapes(obj), radius1, radius2)));
+        TopoShape shape(*getTopoShapePtr());
+        std::vector<TopoShape> edges = getPyShapes(obj);
+        TopoShape res;
+        {
+            Base::PyGILStateRelease release;
+            res = shape.makeElementFillet(edges, radius1, radius2);
+        }
+        return Py::new_reference_to(shape2pyshape(res));
     }
     PY_CATCH_OCC
     PyErr_Clear();
@@ -1522,6 +1572,24 @@ PyObject*  TopoShapePy::fix(PyObject *args)
     }
 }
 
+PyObject* TopoShapePy::fixParallel(PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return nullptr;
+
+    try {
+        Py::List list;
+        for (const auto& report : getTopoShapePtr()->fixParallel()) {
+            list.append(Py::TupleN(Py::Long(report.index),
+                                   Py::Boolean(report.invalid),
+                                   Py::Boolean(report.fixed),
+                                   Py::Boolean(report.valid)));
+        }
+        return Py::new_reference_to(list);
+    }
+    PY_CATCH_OCC
+}
+
 PyObject* TopoShapePy::hashCode(PyObject *args)
 {
     int upper = IntegerLast();
@@ -1542,9 +1610,16 @@ PyObject* TopoShapePy::tessellate(PyObject *args)
     try {
         std::vector<Base::Vector3d> Points;
         std::vector<Data::ComplexGeoData::Facet> Facets;
-        if (Base::asBoolean(ok))
-            BRepTools::Clean(getTopoShapePtr()->getShape());
-        getTopoShapePtr()->getFaces(Points, Facets,tolerance);
+        {
+            // the triangulation is stored in the shape, so the same shape must not be
+            // tessellated by two threads at once
+            TopoShape shape(*getTopoShapePtr());
+            bool clean = Base::asBoolean(ok);
+            Base::PyGILStateRelease release;
+            if (clean)
+                BRepTools::Clean(shape.getShape());
+            shape.getFaces(Points, Facets,tolerance);
+        }
         Py::Tuple tuple(2);
         Py::List vertex;
         for (const auto & Point : Points)
@@ -1567,6 +1642,37 @@ PyObject* TopoShapePy::tessellate(PyObject *args)
     }
 }
 
+PyObject* TopoShapePy::tessellateToBuffers(PyObject *args)
+{
+    double tolerance;
+    if (!PyArg_ParseTuple(args, "d", &tolerance))
+        return nullptr;
+
+    try {
+        const TopoShape& shape = *getTopoShapePtr();
+        TopoShape::TessellationLayout layout = shape.prepareTessellation(tolerance);
+
+        // fill the Python owned memory directly
+        Py::Object points(PyByteArray_FromStringAndSize(nullptr,
+            static_cast<Py_ssize_t>(3 * sizeof(float) * layout.countPoints())), true);
+        Py::Object triangles(PyByteArray_FromStringAndSize(nullptr,
+            static_cast<Py_ssize_t>(3 * sizeof(uint32_t) * layout.countTriangles())), true);
+        shape.fillTessellation(layout,
+                               reinterpret_cast<float*>(PyByteArray_AsString(points.ptr())),
+                               reinterpret_cast<uint32_t*>(PyByteArray_AsString(triangles.ptr())));
+
+        Py::List pointOffsets;
+        for (auto offset : layout.pointOffsets)
+            pointOffsets.append(Py::Long(static_cast<unsigned long>(offset)));
+        Py::List triangleOffsets;
+        for (auto offset : layout.triangleOffsets)
+            triangleOffsets.append(Py::Long(static_cast<unsigned long>(offset)));
+
+        return Py::new_reference_to(Py::TupleN(points, triangles, pointOffsets, triangleOffsets));
+    }
+    PY_CATCH_OCC
+}
+
 PyObject* TopoShapePy::project(PyObject *args)
 {
     PyObject *obj;
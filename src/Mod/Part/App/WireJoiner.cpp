@@ -43,6 +43,7 @@
 # include <GeomAdaptor_Curve.hxx>
 # include <GeomLProp_CLProps.hxx>
 # include <GProp_GProps.hxx>
+# include <OSD_Parallel.hxx>
 # include <ShapeAnalysis_Wire.hxx>
 # include <ShapeFix_ShapeTolerance.hxx>
 # include <ShapeExtend_WireData.hxx>
@@ -1000,6 +1001,13 @@ public:
         }
     };
 
+    struct IntersectRecord {
+        double param;
+        gp_Pnt point;
+        TopoDS_Shape intersectShape;
+    };
+    using IntersectRecords = std::vector<IntersectRecord>;
+
     void checkSelfIntersection(const EdgeInfo &info, std::set<IntersectInfo> &params) const
     {
         // Early return if checking for self intersection (only for non linear spline curves)
@@ -1044,8 +1052,8 @@ public:
     // cognitive complexity
     bool checkIntersectionPlanar(const EdgeInfo& info,
                                  const EdgeInfo& other,
-                                 std::set<IntersectInfo>& params1,
-                                 std::set<IntersectInfo>& params2)
+                                 IntersectRecords& params1,
+                                 IntersectRecords& params2)
     {
         gp_Pln pln;
         bool planar = TopoShape(info.edge).findPlane(pln);
@@ -1069,11 +1077,11 @@ public:
                     auto s2 = extss.SupportOnShape2(i);
                     if (s1.ShapeType() == TopAbs_EDGE) {
                         extss.ParOnEdgeS1(i, par);
-                        pushIntersection(params1, par, extss.PointOnShape1(i), other.edge);
+                        params1.push_back({par, extss.PointOnShape1(i), other.edge});
                     }
                     if (s2.ShapeType() == TopAbs_EDGE) {
                         extss.ParOnEdgeS2(i, par);
-                        pushIntersection(params2, par, extss.PointOnShape2(i), info.edge);
+                        params2.push_back({par, extss.PointOnShape2(i), info.edge});
                     }
                 }
                 return false;
@@ -1166,10 +1174,12 @@ public:
         return true;
     }
 
+    // Collects the intersections of two edges. The results are merged with pushIntersection()
+    // afterwards, so that the checks of different edge pairs can run in parallel.
     void checkIntersection(const EdgeInfo &info,
                            const EdgeInfo &other,
-                           std::set<IntersectInfo> &params1,
-                           std::set<IntersectInfo> &params2)
+                           IntersectRecords &params1,
+                           IntersectRecords &params2)
     {
         if(!checkIntersectionPlanar(info, other, params1, params2)){
             return;
@@ -1205,8 +1215,8 @@ public:
 
         assert(points2d.Length() == points3d.Length());
         for (int i=1; i<=points2d.Length(); ++i) {
-            pushIntersection(params1, points2d(i).ParamOnFirst(), points3d(i), other.edge);
-            pushIntersection(params2, points2d(i).ParamOnSecond(), points3d(i), info.edge);
+            params1.push_back({points2d(i).ParamOnFirst(), points3d(i), other.edge});
+            params2.push_back({points2d(i).ParamOnSecond(), points3d(i), info.edge});
         }
     }
 
@@ -1305,22 +1315,64 @@ public:
         std::unique_ptr<Base::SequencerLauncher> seq(
                 new Base::SequencerLauncher("Splitting edges", edges.size()));
 
+        FC_TIME_INIT(t);
+
+        // One task for the self intersection of each edge, followed by one for each edge after
+        // it whose bounding box overlaps
+        struct IntersectTask {
+            const EdgeInfo* info;
+            const EdgeInfo* other;
+            std::set<IntersectInfo> selfParams;
+            IntersectRecords params1;
+            IntersectRecords params2;
+        };
+        std::vector<IntersectTask> tasks;
+
         idx = 0;
         for (auto& info : edges) {
-            seq->next(true);
             ++idx;
-            auto &params = intersects[&info];
-            checkSelfIntersection(info, params);
-
+            tasks.push_back({&info, nullptr, {}, {}, {}});
             for (auto vit=boxMap.qbegin(bgi::intersects(info.box)); vit!=boxMap.qend(); ++vit) {
                 const auto &other = *(*vit);
                 if (other.iteration <= idx) {
                     // means the edge is before us, and we've already checked intersection
                     continue;
                 }
-                checkIntersection(info, other, params, intersects[&other]);
+                tasks.push_back({&info, &other, {}, {}, {}});
+            }
+        }
+        FC_TIME_LOG(t, "Collect " << tasks.size() << " intersection candidates");
+
+        const std::size_t parallelThreshold {64};
+        OSD_Parallel::For(0, static_cast<int>(tasks.size()), [this, &tasks](int i) {
+            auto& task = tasks[i];
+            if (task.other) {
+                checkIntersection(*task.info, *task.other, task.params1, task.params2);
+            }
+            else {
+                checkSelfIntersection(*task.info, task.selfParams);
+            }
+        }, tasks.size() < parallelThreshold);
+        FC_TIME_LOG(t, "Check intersections");
+
+        // Merge in the same order as the checks would have run serially, because
+        // pushIntersection() skips points close to the ones already found
+        for (auto& task : tasks) {
+            auto &params = intersects[task.info];
+            if (!task.other) {
+                seq->next(true);
+                params.insert(task.selfParams.begin(), task.selfParams.end());
+                continue;
+            }
+            for (const auto& record : task.params1) {
+                pushIntersection(params, record.param, record.point, record.intersectShape);
+            }
+            auto &otherParams = intersects[task.other];
+            for (const auto& record : task.params2) {
+                pushIntersection(otherParams, record.param, record.point, record.intersectShape);
             }
         }
+        FC_TIME_LOG(t, "Merge intersections");
 
         idx=0;
         std::vector<SplitInfo> splits;
@@ -2944,18 +2996,22 @@ public:
 
     void build()
     {
+        FC_TIME_INIT(t);
         clear();
         sourceEdges.clear();
         sourceEdges.insert(sourceEdgeArray.begin(), sourceEdgeArray.end());
         for (const auto& edge : sourceEdgeArray) {
             add(TopoDS::Edge(edge.getShape()), true);
         }
+        FC_TIME_LOG(t, "Add " << sourceEdgeArray.size() << " edges");
 
         if (doTightBound || doSplitEdge) {
             splitEdges();
+            FC_TIME_LOG(t, "Split edges");
         }
 
         buildAdjacentList();
+        FC_TIME_LOG(t, "Build adjacent list");
 
         if (!doTightBound && !doOutline) {
             findClosedWires();
@@ -2963,6 +3019,7 @@ public:
         else {
             buildClosedWire();
         }
+        FC_TIME_LOG(t, "Find closed wires");
 
         // TODO: We choose to put open wires in a separated shape from the final
         // result shape, so the history may contains some entries that are not
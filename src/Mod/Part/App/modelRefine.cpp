@@ -24,6 +24,7 @@
 
 #ifndef _PreComp_
 # include <algorithm>
+# include <deque>
 # include <iterator>
 # include <Bnd_Box.hxx>
 # include <BRep_Builder.hxx>
@@ -63,6 +64,8 @@
 # include <TopExp_Explorer.hxx>
 # include <TopTools_DataMapIteratorOfDataMapOfIntegerListOfShape.hxx>
 # include <TopTools_DataMapIteratorOfDataMapOfShapeShape.hxx>
+# include <TopTools_DataMapOfShapeInteger.hxx>
+# include <TopTools_IndexedMapOfShape.hxx>
 # include <TopTools_ListIteratorOfListOfShape.hxx>
 # include <TopTools_ListOfShape.hxx>
 #endif // _PreComp_
@@ -85,7 +88,11 @@ void ModelRefine::getFaceEdges(const TopoDS_Face &face, EdgeVectorType &edges)
 void ModelRefine::boundaryEdges(const FaceVectorType &faces, EdgeVectorType &edgesOut)
 {
     //this finds all the boundary edges. Maybe more than one boundary.
-    std::list<TopoDS_Edge> edges;
+    //an edge shared by two of the faces cancels out. positions maps the edges currently
+    //found an odd number of times to their place in the edges vector.
+    EdgeVectorType edges;
+    std::vector<bool> removed;
+    TopTools_DataMapOfShapeInteger positions;
     FaceVectorType::const_iterator faceIt;
     for (faceIt = faces.begin(); faceIt != faces.end(); ++faceIt)
     {
@@ -94,24 +101,24 @@ void ModelRefine::boundaryEdges(const FaceVectorType &faces, EdgeVectorType &edg
         getFaceEdges(*faceIt, faceEdges);
         for (faceEdgesIt = faceEdges.begin(); faceEdgesIt != faceEdges.end(); ++faceEdgesIt)
         {
-            bool foundSignal(false);
-            std::list<TopoDS_Edge>::iterator edgesIt;
-            for (edgesIt = edges.begin(); edgesIt != edges.end(); ++edgesIt)
+            if (positions.IsBound(*faceEdgesIt))
             {
-                if ((*edgesIt).IsSame(*faceEdgesIt))
-                {
-                    edgesIt = edges.erase(edgesIt);
-                    foundSignal = true;
-                    break;
-                }
+                removed[positions.Find(*faceEdgesIt)] = true;
+                positions.UnBind(*faceEdgesIt);
+                continue;
             }
-            if (!foundSignal)
-                edges.push_back(*faceEdgesIt);
+            positions.Bind(*faceEdgesIt, static_cast<Standard_Integer>(edges.size()));
+            edges.push_back(*faceEdgesIt);
+            removed.push_back(false);
         }
     }
 
-    edgesOut.reserve(edges.size());
-    std::copy(edges.begin(), edges.end(), back_inserter(edgesOut));
+    edgesOut.reserve(positions.Extent());
+    for (std::size_t index = 0; index < edges.size(); ++index)
+    {
+        if (!removed[index])
+            edgesOut.push_back(edges[index]);
+    }
 }
 
 TopoDS_Shell ModelRefine::removeFaces(const TopoDS_Shell &shell, const FaceVectorType &faces)
@@ -302,15 +309,45 @@ void FaceTypedBase::boundarySplit(const FaceVectorType &facesIn, std::vector<Edg
     EdgeVectorType bEdges;
     boundaryEdges(facesIn, bEdges);
 
-    std::list<TopoDS_Edge> edges;
-    std::copy(bEdges.begin(), bEdges.end(), back_inserter(edges));
-    while(!edges.empty())
+    //index the edges by their first vertex, so the next edge of a boundary is found without
+    //scanning all remaining edges. the queues keep the edge order, so the first unused entry is
+    //the edge a scan from the start of the remaining edges would have found.
+    TopTools_IndexedMapOfShape vertexMap;
+    std::vector<std::deque<std::size_t>> edgesByFirstVertex;
+    for (std::size_t index = 0; index < bEdges.size(); ++index)
+    {
+        int vertexIndex = vertexMap.Add(TopExp::FirstVertex(bEdges[index], Standard_True));
+        if (vertexIndex > static_cast<int>(edgesByFirstVertex.size()))
+            edgesByFirstVertex.resize(vertexIndex);
+        edgesByFirstVertex[vertexIndex - 1].push_back(index);
+    }
+
+    std::vector<bool> used(bEdges.size(), false);
+    auto takeEdgeStartingAt = [&](const TopoDS_Vertex& vertex) -> int
     {
-        TopoDS_Vertex destination = TopExp::FirstVertex(edges.front(), Standard_True);
-        TopoDS_Vertex lastVertex = TopExp::LastVertex(edges.front(), Standard_True);
+        int vertexIndex = vertexMap.FindIndex(vertex);
+        if (vertexIndex == 0)
+            return -1;
+        std::deque<std::size_t>& candidates = edgesByFirstVertex[vertexIndex - 1];
+        while (!candidates.empty() && used[candidates.front()])
+            candidates.pop_front();
+        if (candidates.empty())
+            return -1;
+        std::size_t index = candidates.front();
+        candidates.pop_front();
+        used[index] = true;
+        return static_cast<int>(index);
+    };
+
+    for (std::size_t start = 0; start < bEdges.size(); ++start)
+    {
+        if (used[start])
+            continue;
+        used[start] = true;
+        TopoDS_Vertex destination = TopExp::FirstVertex(bEdges[start], Standard_True);
+        TopoDS_Vertex lastVertex = TopExp::LastVertex(bEdges[start], Standard_True);
         EdgeVectorType boundary;
-        boundary.push_back(edges.front());
-        edges.pop_front();
+        boundary.push_back(bEdges[start]);
         //single edge closed check.
         if (destination.IsSame(lastVertex))
         {
@@ -319,24 +356,15 @@ void FaceTypedBase::boundarySplit(const FaceVectorType &facesIn, std::vector<Edg
         }
 
         bool closedSignal(false);
-        std::list<TopoDS_Edge>::iterator it;
-        for (it = edges.begin(); it != edges.end();)
+        for (int next = takeEdgeStartingAt(lastVertex); next >= 0; next = takeEdgeStartingAt(lastVertex))
         {
-            TopoDS_Vertex currentVertex = TopExp::FirstVertex(*it, Standard_True);
-            if (lastVertex.IsSame(currentVertex))
+            boundary.push_back(bEdges[next]);
+            lastVertex = TopExp::LastVertex(bEdges[next], Standard_True);
+            if (lastVertex.IsSame(destination))
             {
-                boundary.push_back(*it);
-                lastVertex = TopExp::LastVertex(*it, Standard_True);
-                edges.erase(it);
-                it = edges.begin();
-                if (lastVertex.IsSame(destination))
-                {
-                    closedSignal = true;
-                    break;
-                }
-                continue;
+                closedSignal = true;
+                break;
             }
-            ++it;
         }
         if (closedSignal)
             boundariesOut.push_back(boundary);
@@ -1032,6 +1060,7 @@ bool FaceUniter::process()
         return false;
     modifiedShapes.clear();
     deletedShapes.clear();
+    mergedGroups.clear();
     typeObjects.push_back(&getPlaneObject());
     typeObjects.push_back(&getCylinderObject());
     typeObjects.push_back(&getBSplineObject());
@@ -1071,6 +1100,7 @@ bool FaceUniter::process()
                         checkFinalShell = true;
                     }
                     facesToSew.push_back(newFace);
+                    mergedGroups.push_back({(*typeIt)->getType(), faces.size()});
                     if (facesToRemove.capacity() <= facesToRemove.size() + adjacencySplitter.getGroup(adjacentIndex).size())
                         facesToRemove.reserve(facesToRemove.size() + adjacencySplitter.getGroup(adjacentIndex).size());
                     FaceVectorType temp = adjacencySplitter.getGroup(adjacentIndex);
@@ -1091,6 +1121,9 @@ bool FaceUniter::process()
     }
     if (!facesToSew.empty())
     {
+        for (const auto& group : mergedGroups)
+            Base::Console().Log("Refine: united %d faces of surface type %d\n",
+                                static_cast<int>(group.faceCount), static_cast<int>(group.type));
         modifiedSignal = true;
         workShell = ModelRefine::removeFaces(workShell, facesToRemove);
         TopExp_Explorer xp;
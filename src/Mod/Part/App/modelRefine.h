@@ -170,11 +170,21 @@ namespace ModelRefine
         const ShapeVectorType& getDeletedShapes() const
         {return deletedShapes;}
 
+        struct MergedGroup
+        {
+            GeomAbs_SurfaceType type;
+            std::size_t faceCount;
+        };
+        /// The groups of faces united into a single face by the last call of process()
+        const std::vector<MergedGroup>& getMergedGroups() const
+        {return mergedGroups;}
+
     private:
         TopoDS_Shell workShell;
         std::vector<FaceTypedBase *> typeObjects;
         std::vector<ShapePairType> modifiedShapes;
         ShapeVectorType deletedShapes;
+        std::vector<MergedGroup> mergedGroups;
         bool modifiedSignal;
     };
 }
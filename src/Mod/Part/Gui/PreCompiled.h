@@ -47,10 +47,13 @@
 // standard
 #include <cfloat>
 #include <cmath>
+#include <cstddef>
 
 // STL
 #include <algorithm>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -86,6 +89,9 @@
 #ifndef __QtAll__
 # include <Gui/QtAll.h>
 #endif
+#include <QFutureWatcher>
+#include <QtConcurrentMap>
+#include <QtConcurrentRun>
 
 // Inventor includes OpenGL
 #ifndef __InventorAll__
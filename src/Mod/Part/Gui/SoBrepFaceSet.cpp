@@ -31,11 +31,17 @@
 #ifndef _PreComp_
 # include <algorithm>
 # include <cfloat>
+# include <cmath>
+# include <cstddef>
+# include <iterator>
 # include <map>
+# include <memory>
+# include <vector>
 # include <Inventor/SoPickedPoint.h>
 # include <Inventor/SoPrimitiveVertex.h>
 # include <Inventor/actions/SoGetBoundingBoxAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
 # include <Inventor/bundles/SoTextureCoordinateBundle.h>
 # include <Inventor/elements/SoLazyElement.h>
@@ -50,6 +56,9 @@
 # include <Inventor/misc/SoContextHandler.h>
 # include <Inventor/elements/SoCacheElement.h>
 # include <Inventor/elements/SoTextureEnabledElement.h>
+# include <Inventor/elements/SoModelMatrixElement.h>
+# include <Inventor/elements/SoViewVolumeElement.h>
+# include <Inventor/elements/SoViewportRegionElement.h>
 
 # ifdef FC_OS_WIN32
 #  include <windows.h>
@@ -81,37 +90,229 @@ SO_NODE_SOURCE(SoBrepFaceSet)
 
 #define PRIVATE(p) ((p)->pimpl)
 
+namespace {
+
+/// The layout of a vertex in the shared buffers, the color is packed to bytes
+struct SharedVertex {
+    float position[3];
+    float normal[3];
+    uint8_t color[4];
+};
+
+/** The vertex buffers shared by all face sets of one GL context. Each face set owns a range
+ * of vertexes in one of the pages instead of a pair of buffer objects, so a scene of many
+ * small parts does not need thousands of tiny GL allocations and the nodes can release
+ * their data without the GL context being current.
+ */
+class SharedVertexBuffer {
+public:
+    struct Range {
+        GLuint buffer = 0;
+        GLint first = 0;
+        GLsizei count = 0;
+    };
+
+    /// Returns the buffers of \a context, their pages are deleted together with the context
+    static SharedVertexBuffer& instance(uint32_t context)
+    {
+        auto& buffers = allBuffers();
+        auto it = buffers.find(context);
+        if (it == buffers.end()) {
+            it = buffers.emplace(context, std::unique_ptr<SharedVertexBuffer>(
+                                          new SharedVertexBuffer(context))).first;
+        }
+        return *it->second;
+    }
+
+    /// Gives back \a range of \a context, nothing happens if the context is gone already
+    static void release(uint32_t context, Range& range)
+    {
+        auto& buffers = allBuffers();
+        auto it = buffers.find(context);
+        if (it != buffers.end() && range.count > 0) {
+            it->second->free(range);
+        }
+        range = Range();
+    }
+
+    /// Allocates a range for \a vertexes and uploads them, the context must be current
+    Range upload(const std::vector<SharedVertex>& vertexes)
+    {
+        Range range = allocate(static_cast<GLsizei>(vertexes.size()));
+        if (range.count > 0) {
+            cc_glglue_glBindBuffer(glue, GL_ARRAY_BUFFER_ARB, range.buffer);
+            cc_glglue_glBufferSubData(glue, GL_ARRAY_BUFFER_ARB,
+                                      static_cast<intptr_t>(range.first) * sizeof(SharedVertex),
+                                      static_cast<intptr_t>(range.count) * sizeof(SharedVertex),
+                                      vertexes.data());
+            cc_glglue_glBindBuffer(glue, GL_ARRAY_BUFFER_ARB, 0);
+        }
+        return range;
+    }
+
+    /// Draws the triangles of \a range, the context must be current
+    void draw(const Range& range) const
+    {
+        if (range.count == 0)
+            return;
+
+        cc_glglue_glBindBuffer(glue, GL_ARRAY_BUFFER_ARB, range.buffer);
+
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_NORMAL_ARRAY);
+        glEnableClientState(GL_COLOR_ARRAY);
+
+        glVertexPointer(3, GL_FLOAT, sizeof(SharedVertex),
+                        reinterpret_cast<GLvoid*>(offsetof(SharedVertex, position)));
+        glNormalPointer(GL_FLOAT, sizeof(SharedVertex),
+                        reinterpret_cast<GLvoid*>(offsetof(SharedVertex, normal)));
+        glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(SharedVertex),
+                       reinterpret_cast<GLvoid*>(offsetof(SharedVertex, color)));
+
+        glDrawArrays(GL_TRIANGLES, range.first, range.count);
+
+        glDisableClientState(GL_COLOR_ARRAY);
+        glDisableClientState(GL_NORMAL_ARRAY);
+        glDisableClientState(GL_VERTEX_ARRAY);
+        cc_glglue_glBindBuffer(glue, GL_ARRAY_BUFFER_ARB, 0);
+    }
+
+private:
+    // 256k vertexes make pages of 7 MB, bigger shapes get a page of their own
+    static constexpr GLsizei pageCapacity = 1 << 18;
+
+    struct Page {
+        GLuint buffer = 0;
+        GLsizei capacity = 0;
+        GLsizei used = 0;
+        /// The free ranges of the page by their first vertex
+        std::map<GLint, GLsizei> freeRanges;
+    };
+
+    explicit SharedVertexBuffer(uint32_t context)
+        : context(context)
+        , glue(cc_glglue_instance(static_cast<int>(context)))
+    {
+        SoContextHandler::addContextDestructionCallback(context_destruction_cb, this);
+    }
+
+    static std::map<uint32_t, std::unique_ptr<SharedVertexBuffer>>& allBuffers()
+    {
+        static std::map<uint32_t, std::unique_ptr<SharedVertexBuffer>> buffers;
+        return buffers;
+    }
+
+    Range allocate(GLsizei count)
+    {
+        if (count == 0)
+            return {};
+
+        for (auto& page : pages) {
+            for (auto it = page.freeRanges.begin(); it != page.freeRanges.end(); ++it) {
+                if (it->second < count)
+                    continue;
+                Range range {page.buffer, it->first, count};
+                if (it->second > count)
+                    page.freeRanges.emplace(it->first + count, it->second - count);
+                page.freeRanges.erase(it);
+                page.used += count;
+                return range;
+            }
+        }
+
+        // the pages of big shapes are only kept while they are in use
+        pages.erase(std::remove_if(pages.begin(), pages.end(), [this](const Page& page) {
+            if (page.used > 0 || page.capacity <= pageCapacity)
+                return false;
+            cc_glglue_glDeleteBuffers(glue, 1, &page.buffer);
+            return true;
+        }), pages.end());
+
+        Page page;
+        page.capacity = std::max(count, pageCapacity);
+        page.used = count;
+        if (page.capacity > count)
+            page.freeRanges.emplace(count, page.capacity - count);
+        cc_glglue_glGenBuffers(glue, 1, &page.buffer);
+        cc_glglue_glBindBuffer(glue, GL_ARRAY_BUFFER_ARB, page.buffer);
+        cc_glglue_glBufferData(glue, GL_ARRAY_BUFFER_ARB,
+                               static_cast<intptr_t>(page.capacity) * sizeof(SharedVertex),
+                               nullptr, GL_STATIC_DRAW_ARB);
+        cc_glglue_glBindBuffer(glue, GL_ARRAY_BUFFER_ARB, 0);
+        pages.push_back(std::move(page));
+        return {pages.back().buffer, 0, count};
+    }
+
+    void free(const Range& range)
+    {
+        auto page = std::find_if(pages.begin(), pages.end(), [&range](const Page& p) {
+            return p.buffer == range.buffer;
+        });
+        if (page == pages.end())
+            return;
+
+        page->used -= range.count;
+        GLint first = range.first;
+        GLsizei count = range.count;
+        // merge with the free neighbours
+        auto next = page->freeRanges.lower_bound(first);
+        if (next != page->freeRanges.end() && next->first == first + count) {
+            count += next->second;
+            next = page->freeRanges.erase(next);
+        }
+        if (next != page->freeRanges.begin()) {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == first) {
+                first = prev->first;
+                count += prev->second;
+                page->freeRanges.erase(prev);
+            }
+        }
+        page->freeRanges.emplace(first, count);
+    }
+
+    static void context_destruction_cb(uint32_t context, void * userdata)
+    {
+        auto self = static_cast<SharedVertexBuffer*>(userdata);
+        if (self->context != context)
+            return;
+
+        // the ranges still held by nodes are not found in the pages any more
+        for (auto& page : self->pages)
+            cc_glglue_glDeleteBuffers(self->glue, 1, &page.buffer);
+        self->pages.clear();
+    }
+
+    uint32_t context;
+    const cc_glglue * glue;
+    std::vector<Page> pages;
+};
+
+}
+
 class SoBrepFaceSet::VBO {
 public:
     struct Buffer {
-        uint32_t myvbo[2];
-        std::size_t vertex_array_size;
-        std::size_t index_array_size;
-        bool updateVbo;
-        bool vboLoaded;
+        SharedVertexBuffer::Range range;
+        std::size_t index_count = 0;
+        bool updateVbo = false;
+        bool vboLoaded = false;
     };
 
     static SbBool vboAvailable;
-    uint32_t indice_array;
     std::map<uint32_t, Buffer> vbomap;
 
     VBO()
     {
         SoContextHandler::addContextDestructionCallback(context_destruction_cb, this);
-        indice_array = 0;
     }
     ~VBO()
     {
         SoContextHandler::removeContextDestructionCallback(context_destruction_cb, this);
 
-        // schedule delete for all allocated GL resources
-        std::map<uint32_t, Buffer>::iterator it;
-        for (it = vbomap.begin(); it != vbomap.end(); ++it) {
-            void * ptr0 = (void*) ((uintptr_t) it->second.myvbo[0]);
-            SoGLCacheContextElement::scheduleDeleteCallback(it->first, VBO::vbo_delete, ptr0);
-            void * ptr1 = (void*) ((uintptr_t) it->second.myvbo[1]);
-            SoGLCacheContextElement::scheduleDeleteCallback(it->first, VBO::vbo_delete, ptr1);
-        }
+        // the ranges go back to the shared buffers, no GL call is needed for this
+        for (auto& it : vbomap)
+            SharedVertexBuffer::release(it.first, it.second.range);
     }
 
     void render(SoGLRenderAction * action,
@@ -136,25 +337,182 @@ public:
 
         std::map<uint32_t, Buffer>::iterator it = self->vbomap.find(context);
         if (it != self->vbomap.end()) {
-#ifdef FC_OS_WIN32
-            const cc_glglue * glue = cc_glglue_instance((int) context);
-            PFNGLDELETEBUFFERSARBPROC glDeleteBuffersARB = (PFNGLDELETEBUFFERSARBPROC)cc_glglue_getprocaddress(glue, "glDeleteBuffersARB");
-#endif
-            auto &buffer = it->second;
-            glDeleteBuffersARB(2, buffer.myvbo);
+            SharedVertexBuffer::release(context, it->second.range);
             self->vbomap.erase(it);
         }
     }
+};
+
+SbBool SoBrepFaceSet::VBO::vboAvailable = false;
+
+/** A bounding volume hierarchy over the triangles of the faces. Picking a big shape tests
+ * the boxes on the way down to the few triangles near the ray instead of generating all
+ * primitives of the node.
+ */
+class SoBrepFaceSet::PickTree {
+public:
+    struct Triangle {
+        int32_t v[3];
+        /// the position of the first vertex in coordIndex
+        int32_t pos;
+        /// the index of the triangle in the node, i.e. the face index of the detail
+        int32_t face;
+        int32_t part;
+    };
+
+    /// Returns whether the tree was built for the current fields and coordinates
+    bool isValid(SbUniqueId nodeId, SbUniqueId coordId) const
+    {
+        return built && nodeId == this->nodeId && coordId == this->coordId;
+    }
 
-    static void vbo_delete(void * closure, uint32_t contextid)
+    /// Returns false if the faces have polygons which the tree does not handle
+    bool isUsable() const
     {
-        const cc_glglue * glue = cc_glglue_instance((int) contextid);
-        GLuint id = (GLuint) ((uintptr_t) closure);
-        cc_glglue_glDeleteBuffers(glue, 1, &id);
+        return usable;
     }
-};
 
-SbBool SoBrepFaceSet::VBO::vboAvailable = false;
+    void build(SbUniqueId nodeId, SbUniqueId coordId,
+               const SoCoordinateElement * coords,
+               const int32_t * cindices, int numindices,
+               const int32_t * pindices, int numparts)
+    {
+        this->nodeId = nodeId;
+        this->coordId = coordId;
+        built = true;
+        usable = true;
+        triangles.clear();
+        nodes.clear();
+
+        int numverts = coords->getNum();
+        int32_t part = 0;
+        int32_t partEnd = numparts > 0 ? pindices[0] : 0;
+        for (int pos = 0; pos + 2 < numindices; pos += 4) {
+            const int32_t * v = cindices + pos;
+            if (v[0] < 0 || v[1] < 0 || v[2] < 0)
+                break;
+            if (pos + 3 < numindices && v[3] >= 0) {
+                usable = false;
+                break;
+            }
+            if (v[0] >= numverts || v[1] >= numverts || v[2] >= numverts) {
+                usable = false;
+                break;
+            }
+            auto face = static_cast<int32_t>(triangles.size());
+            // the same rule as in createTriangleDetail()
+            while (part < numparts && face >= partEnd) {
+                if (++part < numparts)
+                    partEnd += pindices[part];
+            }
+            triangles.push_back({{v[0], v[1], v[2]}, pos, face, part < numparts ? part : 0});
+        }
+
+        if (!usable || triangles.empty()) {
+            triangles.clear();
+            return;
+        }
+
+        std::vector<SbVec3f> centers;
+        centers.reserve(triangles.size());
+        for (const auto& tri : triangles) {
+            centers.push_back((coords->get3(tri.v[0]) + coords->get3(tri.v[1])
+                               + coords->get3(tri.v[2])) / 3.0F);
+        }
+        std::vector<int32_t> order(triangles.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = static_cast<int32_t>(i);
+
+        nodes.reserve(2 * triangles.size() / leafSize + 1);
+        buildNode(coords, centers, order, 0, static_cast<int32_t>(order.size()));
+
+        std::vector<Triangle> sorted;
+        sorted.reserve(triangles.size());
+        for (int32_t i : order)
+            sorted.push_back(triangles[i]);
+        triangles.swap(sorted);
+    }
+
+    /// Calls \a func with each triangle whose box is hit by the object space ray of \a action
+    template<typename Func>
+    void query(SoRayPickAction * action, Func func) const
+    {
+        if (nodes.empty())
+            return;
+
+        std::vector<int32_t> stack {0};
+        while (!stack.empty()) {
+            const Node& node = nodes[stack.back()];
+            stack.pop_back();
+            if (!action->intersect(node.box, TRUE))
+                continue;
+            if (node.count > 0) {
+                for (int32_t i = node.first; i < node.first + node.count; ++i)
+                    func(triangles[i]);
+            }
+            else {
+                stack.push_back(node.right);
+                stack.push_back(static_cast<int32_t>(&node - nodes.data()) + 1);
+            }
+        }
+    }
+
+private:
+    static constexpr int32_t leafSize = 4;
+
+    struct Node {
+        SbBox3f box;
+        /// the range of the triangles of a leaf, count is 0 for inner nodes
+        int32_t first = 0;
+        int32_t count = 0;
+        /// the second child of an inner node, the first one follows the node
+        int32_t right = 0;
+    };
+
+    void buildNode(const SoCoordinateElement * coords, const std::vector<SbVec3f>& centers,
+                   std::vector<int32_t>& order, int32_t first, int32_t last)
+    {
+        auto index = static_cast<int32_t>(nodes.size());
+        nodes.emplace_back();
+
+        SbBox3f box;
+        SbBox3f centerBox;
+        for (int32_t i = first; i < last; ++i) {
+            const Triangle& tri = triangles[order[i]];
+            for (int32_t v : tri.v)
+                box.extendBy(coords->get3(v));
+            centerBox.extendBy(centers[order[i]]);
+        }
+        nodes[index].box = box;
+
+        if (last - first <= leafSize) {
+            nodes[index].first = first;
+            nodes[index].count = last - first;
+            return;
+        }
+
+        // split at the median of the longest axis of the centers
+        float dx {}, dy {}, dz {};
+        centerBox.getSize(dx, dy, dz);
+        int axis = dx >= dy && dx >= dz ? 0 : (dy >= dz ? 1 : 2);
+        int32_t mid = first + (last - first) / 2;
+        std::nth_element(order.begin() + first, order.begin() + mid, order.begin() + last,
+                         [&centers, axis](int32_t a, int32_t b) {
+            return centers[a][axis] < centers[b][axis];
+        });
+
+        buildNode(coords, centers, order, first, mid);
+        nodes[index].right = static_cast<int32_t>(nodes.size());
+        buildNode(coords, centers, order, mid, last);
+    }
+
+    std::vector<Triangle> triangles;
+    std::vector<Node> nodes;
+    SbUniqueId nodeId = 0;
+    SbUniqueId coordId = 0;
+    bool built = false;
+    bool usable = false;
+};
 
 void SoBrepFaceSet::initClass()
 {
@@ -175,6 +533,36 @@ SoBrepFaceSet::SoBrepFaceSet()
 
 SoBrepFaceSet::~SoBrepFaceSet() = default;
 
+void SoBrepFaceSet::setProjectedSizeCallback(const SbBox3f& box, ProjectedSizeCallback callback)
+{
+    projectedBox = box;
+    projectedSizeCallback = std::move(callback);
+}
+
+void SoBrepFaceSet::reportProjectedSize(SoGLRenderAction *action) const
+{
+    if (!projectedSizeCallback || projectedBox.isEmpty())
+        return;
+
+    SoState * state = action->getState();
+    SbBox3f box = projectedBox;
+    box.transform(SoModelMatrixElement::get(state));
+
+    float dx {}, dy {}, dz {};
+    box.getSize(dx, dy, dz);
+    SbVec3f center = box.getCenter();
+    float radius = 0.5F * std::sqrt(dx * dx + dy * dy + dz * dz);
+
+    // the world size that corresponds to the whole normalized screen at the box center
+    const SbViewVolume& vv = SoViewVolumeElement::get(state);
+    float scale = vv.getWorldToScreenScale(center, 1.0F);
+    if (scale <= 0.0F)
+        return;
+
+    const SbVec2s& pixels = SoViewportRegionElement::get(state).getViewportSizePixels();
+    projectedSizeCallback(2.0F * radius / scale * std::max(pixels[0], pixels[1]));
+}
+
 void SoBrepFaceSet::doAction(SoAction* action)
 {
     if (action->getTypeId() == Gui::SoHighlightElementAction::getClassTypeId()) {
@@ -505,6 +893,8 @@ void SoBrepFaceSet::GLRender(SoGLRenderAction *action)
     if (this->coordIndex.getNum() < 3)
         return;
 
+    reportProjectedSize(action);
+
     SelContextPtr ctx2;
     std::vector<SelContextPtr> ctxs;
     SelContextPtr ctx = Gui::SoFCSelectionRoot::getRenderContext(this,selContext,ctx2);
@@ -1176,6 +1566,150 @@ void SoBrepFaceSet::generatePrimitives(SoAction * action)
 
 #undef DO_VERTEX
 
+void SoBrepFaceSet::rayPick(SoRayPickAction * action)
+{
+    if (this->coordIndex.getNum() < 3 || !this->shouldRayPick(action))
+        return;
+
+    SoState * state = action->getState();
+    // texture coordinates of the picked points are only computed by generatePrimitives()
+    SoTextureCoordinateBundle tb(action, false, false);
+    if (this->vertexProperty.getValue() || tb.needCoordinates()) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    const SoCoordinateElement * coords = SoCoordinateElement::getInstance(state);
+    if (!pickTree)
+        pickTree = std::make_unique<PickTree>();
+    if (!pickTree->isValid(this->getNodeId(), coords->getNodeId())) {
+        pickTree->build(this->getNodeId(), coords->getNodeId(), coords,
+                        this->coordIndex.getValues(0), this->coordIndex.getNum(),
+                        this->partIndex.getValues(0), this->partIndex.getNum());
+    }
+    if (!pickTree->isUsable()) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    Binding mbind = this->findMaterialBinding(state);
+    Binding nbind = this->findNormalBinding(state);
+
+    const SbVec3f * normals;
+    const int32_t * cindices;
+    int numindices;
+    const int32_t * nindices;
+    const int32_t * tindices;
+    const int32_t * mindices;
+    SbBool sendNormals = true;
+    SbBool normalCacheUsed;
+
+    this->getVertexData(state, coords, normals, cindices,
+                        nindices, tindices, mindices, numindices,
+                        sendNormals, normalCacheUsed);
+
+    // the same bindings as in generatePrimitives()
+    if (!sendNormals || !normals) nbind = OVERALL;
+    else if (normalCacheUsed && nbind == PER_VERTEX) {
+        nbind = PER_VERTEX_INDEXED;
+    }
+    else if (normalCacheUsed && nbind == PER_FACE_INDEXED) {
+        nbind = PER_FACE;
+    }
+    if (!nindices) nindices = cindices;
+    if (!mindices) mindices = cindices;
+
+    this->computeObjectSpaceRay(action);
+
+    pickTree->query(action, [&](const PickTree::Triangle& tri) {
+        SbVec3f p0 = coords->get3(tri.v[0]);
+        SbVec3f p1 = coords->get3(tri.v[1]);
+        SbVec3f p2 = coords->get3(tri.v[2]);
+        SbVec3f intersection;
+        SbVec3f barycentric;
+        SbBool front {};
+        if (!action->intersect(p0, p1, p2, intersection, barycentric, front))
+            return;
+        if (!action->isBetweenPlanes(intersection))
+            return;
+        SoPickedPoint * pp = action->addIntersection(intersection, front);
+        if (!pp)
+            return;
+
+        int32_t normalIndex[3] = {0, 0, 0};
+        int32_t materialIndex[3] = {0, 0, 0};
+        for (int k = 0; k < 3; ++k) {
+            switch (nbind) {
+            case PER_VERTEX:
+                normalIndex[k] = 3 * tri.face + k;
+                break;
+            case PER_VERTEX_INDEXED:
+                normalIndex[k] = nindices[tri.pos + k];
+                break;
+            case PER_FACE:
+                normalIndex[k] = tri.face;
+                break;
+            case PER_FACE_INDEXED:
+                normalIndex[k] = nindices[tri.face];
+                break;
+            default:
+                break;
+            }
+            switch (mbind) {
+            case PER_PART:
+                materialIndex[k] = tri.part;
+                break;
+            case PER_PART_INDEXED:
+                materialIndex[k] = mindices[tri.part];
+                break;
+            case PER_VERTEX:
+                materialIndex[k] = 3 * tri.face + k;
+                break;
+            case PER_VERTEX_INDEXED:
+                materialIndex[k] = mindices[tri.pos + k];
+                break;
+            case PER_FACE:
+                materialIndex[k] = tri.face;
+                break;
+            case PER_FACE_INDEXED:
+                materialIndex[k] = mindices[tri.face];
+                break;
+            default:
+                break;
+            }
+        }
+
+        SbVec3f normal;
+        if (nbind == OVERALL) {
+            normal = normals ? normals[0] : (p1 - p0).cross(p2 - p0);
+        }
+        else {
+            normal = normals[normalIndex[0]] * barycentric[0]
+                   + normals[normalIndex[1]] * barycentric[1]
+                   + normals[normalIndex[2]] * barycentric[2];
+        }
+        normal.normalize();
+        pp->setObjectNormal(normal);
+        pp->setMaterialIndex(materialIndex[0]);
+
+        auto detail = new SoFaceDetail;
+        detail->setNumPoints(3);
+        for (int k = 0; k < 3; ++k) {
+            SoPointDetail point;
+            point.setCoordinateIndex(tri.v[k]);
+            point.setNormalIndex(normalIndex[k]);
+            point.setMaterialIndex(materialIndex[k]);
+            detail->setPoint(k, &point);
+        }
+        detail->setFaceIndex(tri.face);
+        detail->setPartIndex(tri.part);
+        pp->setDetail(detail, this);
+    });
+
+    if (normalCacheUsed)
+        this->readUnlockNormalCache();
+}
+
 void SoBrepFaceSet::renderHighlight(SoGLRenderAction *action, SelContextPtr ctx)
 {
     if(!ctx || ctx->highlightIndex < 0)
@@ -1394,62 +1928,40 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
     int matnr = 0;
     int trinr = 0;
 
-    float * vertex_array = nullptr;
-    GLuint * index_array = nullptr;
+    std::vector<SharedVertex> vertex_array;
     SbColor  mycolor1,mycolor2,mycolor3;
     SbVec3f *mynormal1 = const_cast<SbVec3f *>(currnormal);
     SbVec3f *mynormal2 = const_cast<SbVec3f *>(currnormal);
     SbVec3f *mynormal3 = const_cast<SbVec3f *>(currnormal);
-    int indice=0;
-    uint32_t RGBA,R,G,B,A;
-    float Rf,Gf,Bf,Af;
+
+    auto addVertex = [&vertex_array](const SbVec3f& point, const SbVec3f& normal, const SbColor& color) {
+        SharedVertex vertex;
+        point.getValue(vertex.position[0], vertex.position[1], vertex.position[2]);
+        normal.getValue(vertex.normal[0], vertex.normal[1], vertex.normal[2]);
+        uint32_t RGBA = color.getPackedValue();
+        vertex.color[0] = static_cast<uint8_t>((RGBA & 0xFF000000) >> 24);
+        vertex.color[1] = static_cast<uint8_t>((RGBA & 0xFF0000) >> 16);
+        vertex.color[2] = static_cast<uint8_t>((RGBA & 0xFF00) >> 8);
+        vertex.color[3] = static_cast<uint8_t>(RGBA & 0xFF);
+        vertex_array.push_back(vertex);
+    };
 
     uint32_t contextId = action->getCacheContext();
-    auto res = this->vbomap.insert(std::make_pair(contextId,VBO::Buffer()));
-    VBO::Buffer &buf = res.first->second;
-    if (res.second) {
-#ifdef FC_OS_WIN32
-        const cc_glglue * glue = cc_glglue_instance(action->getCacheContext());
-        PFNGLGENBUFFERSPROC glGenBuffersARB = (PFNGLGENBUFFERSPROC)cc_glglue_getprocaddress(glue, "glGenBuffersARB");
-#endif
-        glGenBuffersARB(2, buf.myvbo);
-        buf.vertex_array_size = 0;
-        buf.index_array_size = 0;
-        buf.vboLoaded = false;
-    }
+    VBO::Buffer &buf = this->vbomap[contextId];
 
-    if ((buf.vertex_array_size != (sizeof(float) * num_indices * 10)) ||
-        (buf.index_array_size != (sizeof(GLuint) * num_indices))) {
-        if ((buf.vertex_array_size != 0 ) && ( buf.index_array_size != 0))
-            buf.updateVbo = true;
-    }
+    // a changed number of indexes means the shape has changed
+    if (buf.vboLoaded && buf.index_count != static_cast<std::size_t>(num_indices))
+        buf.updateVbo = true;
 
-    // vbo loaded is defining if we must pre-load data into the VBO. When the variable is set to 0
-    // it means that the VBO has not been initialized
-    // updateVbo is tracking the need to update the content of the VBO which act as a buffer within
-    // the graphic card
+    // vboLoaded is defining if we must pre-load data into the VBO, updateVbo is tracking the
+    // need to update the content of the VBO which act as a buffer within the graphic card
     // TODO FINISHING THE COLOR SUPPORT !
 
+    SharedVertexBuffer& shared = SharedVertexBuffer::instance(contextId);
     if (!buf.vboLoaded || buf.updateVbo) {
-#ifdef FC_OS_WIN32
-        const cc_glglue * glue = cc_glglue_instance(action->getCacheContext());
-
-        PFNGLBINDBUFFERARBPROC glBindBufferARB = (PFNGLBINDBUFFERARBPROC) cc_glglue_getprocaddress(glue, "glBindBufferARB");
-      //PFNGLMAPBUFFERARBPROC glMapBufferARB = (PFNGLMAPBUFFERARBPROC) cc_glglue_getprocaddress(glue, "glMapBufferARB");
-        PFNGLGENBUFFERSPROC glGenBuffersARB = (PFNGLGENBUFFERSPROC)cc_glglue_getprocaddress(glue, "glGenBuffersARB");
-        PFNGLDELETEBUFFERSARBPROC glDeleteBuffersARB = (PFNGLDELETEBUFFERSARBPROC)cc_glglue_getprocaddress(glue, "glDeleteBuffersARB");
-        PFNGLBUFFERDATAARBPROC glBufferDataARB = (PFNGLBUFFERDATAARBPROC)cc_glglue_getprocaddress(glue, "glBufferDataARB");
-#endif
-        // We must manage buffer size increase let's clear everything and re-init to test the
-        // clearing process
-        glDeleteBuffersARB(2, buf.myvbo);
-        glGenBuffersARB(2, buf.myvbo);
-        vertex_array = ( float * ) malloc ( sizeof(float) * num_indices * 10 );
-        index_array = ( GLuint *) malloc ( sizeof(GLuint) * num_indices );
-        buf.vertex_array_size = sizeof(float) * num_indices * 10;
-        buf.index_array_size = sizeof(GLuint) * num_indices;
-        this->vbomap[contextId] = buf;
-        this->indice_array = 0;
+        SharedVertexBuffer::release(contextId, buf.range);
+        vertex_array.reserve(static_cast<std::size_t>(num_indices / 4) * 3);
+        buf.index_count = static_cast<std::size_t>(num_indices);
 
         // Get the initial colors
         SoState * state = action->getState();
@@ -1541,89 +2053,10 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
             if (nbind == PER_VERTEX_INDEXED)
                 normalindices++;
 
-            /* We building the Vertex dataset there and push it to a VBO */
-            /* The Vertex array shall contain per element vertex_coordinates[3],
-            normal_coordinates[3], color_value[3] (RGBA format) */
-
-            index_array[this->indice_array] =   this->indice_array;
-            index_array[this->indice_array+1] = this->indice_array + 1;
-            index_array[this->indice_array+2] = this->indice_array + 2;
-            this->indice_array += 3;
-
-
-            ((SbVec3f *)(cur_coords3d+v1 ))->getValue(vertex_array[indice+0],
-                                                      vertex_array[indice+1],
-                                                      vertex_array[indice+2]);
-
-            ((SbVec3f *)(mynormal1))->getValue(vertex_array[indice+3],
-                                               vertex_array[indice+4],
-                                               vertex_array[indice+5]);
-
-            /* We decode the Vertex1 color */
-            RGBA = mycolor1.getPackedValue();
-            R = ( RGBA & 0xFF000000 ) >> 24 ;
-            G = ( RGBA & 0xFF0000 ) >> 16;
-            B = ( RGBA & 0xFF00 ) >> 8;
-            A = ( RGBA & 0xFF );
-
-            Rf = (((float )R) / 255.0);
-            Gf = (((float )G) / 255.0);
-            Bf = (((float )B) / 255.0);
-            Af = (((float )A) / 255.0);
-
-            vertex_array[indice+6] = Rf;
-            vertex_array[indice+7] = Gf;
-            vertex_array[indice+8] = Bf;
-            vertex_array[indice+9] = Af;
-            indice+=10;
-
-            ((SbVec3f *)(cur_coords3d+v2))->getValue(vertex_array[indice+0],
-                                                     vertex_array[indice+1],
-                                                     vertex_array[indice+2]);
-            ((SbVec3f *)(mynormal2))->getValue(vertex_array[indice+3],
-                                               vertex_array[indice+4],
-                                               vertex_array[indice+5]);
-
-            RGBA = mycolor2.getPackedValue();
-            R = ( RGBA & 0xFF000000 ) >> 24 ;
-            G = ( RGBA & 0xFF0000 ) >> 16;
-            B = ( RGBA & 0xFF00 ) >> 8;
-            A = ( RGBA & 0xFF );
-
-            Rf = (((float )R) / 255.0);
-            Gf = (((float )G) / 255.0);
-            Bf = (((float )B) / 255.0);
-            Af = (((float )A) / 255.0);
-
-            vertex_array[indice+6] = Rf;
-            vertex_array[indice+7] = Gf;
-            vertex_array[indice+8] = Bf;
-            vertex_array[indice+9] = Af;
-            indice+=10;
-
-            ((SbVec3f *)(cur_coords3d+v3))->getValue(vertex_array[indice+0],
-                                                     vertex_array[indice+1],
-                                                     vertex_array[indice+2]);
-            ((SbVec3f *)(mynormal3))->getValue(vertex_array[indice+3],
-                                               vertex_array[indice+4],
-                                               vertex_array[indice+5]);
-
-            RGBA = mycolor3.getPackedValue();
-            R = ( RGBA & 0xFF000000 ) >> 24 ;
-            G = ( RGBA & 0xFF0000 ) >> 16;
-            B = ( RGBA & 0xFF00 ) >> 8;
-            A = ( RGBA & 0xFF );
-
-            Rf = (((float )R) / 255.0);
-            Gf = (((float )G) / 255.0);
-            Bf = (((float )B) / 255.0);
-            Af = (((float )A) / 255.0);
-
-            vertex_array[indice+6] = Rf;
-            vertex_array[indice+7] = Gf;
-            vertex_array[indice+8] = Bf;
-            vertex_array[indice+9] = Af;
-            indice+=10;
+            /* We building the Vertex dataset there and push it to the shared VBO */
+            addVertex(cur_coords3d[v1], *mynormal1, mycolor1);
+            addVertex(cur_coords3d[v2], *mynormal2, mycolor2);
+            addVertex(cur_coords3d[v3], *mynormal3, mycolor3);
 
             /* ============================================================ */
             trinr++;
@@ -1641,49 +2074,13 @@ void SoBrepFaceSet::VBO::render(SoGLRenderAction * action,
             }
         }
 
-        glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
-        glBufferDataARB(GL_ARRAY_BUFFER_ARB, sizeof(float) * indice , vertex_array, GL_DYNAMIC_DRAW_ARB);
-
-        glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, buf.myvbo[1]);
-        glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, sizeof(GLuint) * this->indice_array , &index_array[0], GL_DYNAMIC_DRAW_ARB);
-
-        glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
-        glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
-
+        buf.range = shared.upload(vertex_array);
         buf.vboLoaded = true;
         buf.updateVbo = false;
-        free(vertex_array);
-        free(index_array);
     }
 
     // This is the VBO rendering code
-#ifdef FC_OS_WIN32
-    const cc_glglue * glue = cc_glglue_instance(action->getCacheContext());
-    PFNGLBINDBUFFERARBPROC glBindBufferARB = (PFNGLBINDBUFFERARBPROC)cc_glglue_getprocaddress(glue, "glBindBufferARB");
-#endif
-
-    if (!buf.updateVbo) {
-        glBindBufferARB(GL_ARRAY_BUFFER_ARB, buf.myvbo[0]);
-        glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, buf.myvbo[1]);
-    }
-
-    glEnableClientState(GL_VERTEX_ARRAY);
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_COLOR_ARRAY);
-
-    glVertexPointer(3,GL_FLOAT,10*sizeof(GLfloat),nullptr);
-    glNormalPointer(GL_FLOAT,10*sizeof(GLfloat),(GLvoid *)(3*sizeof(GLfloat)));
-    glColorPointer(4,GL_FLOAT,10*sizeof(GLfloat),(GLvoid *)(6*sizeof(GLfloat)));
-
-    glDrawElements(GL_TRIANGLES, this->indice_array, GL_UNSIGNED_INT, (void *)nullptr);
-
-    glDisableClientState(GL_COLOR_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
-    glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
-    buf.updateVbo = false;
-    // The data is within the VBO we can clear it at application level
+    shared.draw(buf.range);
 }
 
 void SoBrepFaceSet::renderShape(SoGLRenderAction * action,
@@ -25,7 +25,9 @@
 
 #include <Inventor/fields/SoMFInt32.h>
 #include <Inventor/fields/SoSFInt32.h>
+#include <Inventor/SbBox3f.h>
 #include <Inventor/nodes/SoIndexedFaceSet.h>
+#include <functional>
 #include <memory>
 #include <vector>
 #include <Gui/Selection/SoFCSelectionContext.h>
@@ -82,6 +84,14 @@ public:
 
     SoMFInt32 partIndex;
 
+    /// Called while rendering with the size in pixels the faces cover on the screen
+    using ProjectedSizeCallback = std::function<void(float)>;
+    /** Sets the local bounding box of the faces and a callback that reports its
+     * projected size at every render. It lets the owner pick the level of detail
+     * of the tessellation without traversing the coordinates again.
+     */
+    void setProjectedSizeCallback(const SbBox3f& box, ProjectedSizeCallback callback);
+
 protected:
     ~SoBrepFaceSet() override;
     void GLRender(SoGLRenderAction *action) override;
@@ -95,6 +105,7 @@ protected:
         SoPickedPoint * pp) override;
     void generatePrimitives(SoAction * action) override;
     void getBoundingBox(SoGetBoundingBoxAction * action) override;
+    void rayPick(SoRayPickAction * action) override;
 
 private:
     enum Binding {
@@ -133,6 +144,7 @@ private:
     void renderSelection(SoGLRenderAction *action, SelContextPtr, bool push=true);
 
     bool overrideMaterialBinding(SoGLRenderAction *action, SelContextPtr ctx, SelContextPtr ctx2);
+    void reportProjectedSize(SoGLRenderAction *action) const;
 
 #ifdef RENDER_GLARRAYS
     void renderSimpleArray();
@@ -150,10 +162,16 @@ private:
     std::vector<uint32_t> packedColors;
     uint32_t packedColor;
     Gui::SoFCSelectionCounter selCounter;
+    SbBox3f projectedBox;
+    ProjectedSizeCallback projectedSizeCallback;
 
     // Define some VBO pointer for the current mesh
     class VBO;
     std::unique_ptr<VBO> pimpl;
+
+    // The bounding volume hierarchy of the triangles for picking, built on the first pick
+    class PickTree;
+    std::unique_ptr<PickTree> pickTree;
 };
 
 } // namespace PartGui
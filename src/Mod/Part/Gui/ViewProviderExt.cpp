@@ -27,6 +27,7 @@
 # include <BRep_Tool.hxx>
 # include <BRepBndLib.hxx>
 # include <BRepBuilderAPI_MakeVertex.hxx>
+# include <BRepBuilderAPI_Copy.hxx>
 # include <BRepExtrema_DistShapeShape.hxx>
 # include <BRepMesh_IncrementalMesh.hxx>
 # include <gp_Trsf.hxx>
@@ -49,6 +50,9 @@
 # include <TopTools_IndexedMapOfShape.hxx>
 
 # include <QAction>
+# include <QFutureWatcher>
+# include <QtConcurrentMap>
+# include <QtConcurrentRun>
 # include <QMenu>
 # include <sstream>
 
@@ -76,9 +80,11 @@
 #include <Base/Parameter.h>
 #include <Base/TimeInfo.h>
 #include <Base/Tools.h>
+#include <Base/Trace.h>
 
 #include <Gui/BitmapFactory.h>
 #include <Gui/Control.h>
+#include <Gui/Selection/Selection.h>
 #include <Gui/Selection/SoFCSelectionAction.h>
 #include <Gui/Selection/SoFCUnifiedSelection.h>
 #include <Gui/ViewParams.h>
@@ -112,6 +118,17 @@ long toPercent(float value)
 
 PROPERTY_SOURCE(PartGui::ViewProviderPartExt, Gui::ViewProviderGeometryObject)
 
+struct ViewProviderPartExt::Tessellation
+{
+    std::vector<SbVec3f> points;
+    std::vector<SbVec3f> normals;
+    std::vector<int32_t> faceIndex;
+    std::vector<int32_t> partIndex;
+    std::vector<int32_t> lineIndex;
+    int32_t nodeStart = 0;
+    SbBox3f box;
+};
+
 
 //**************************************************************************
 // Construction/Destruction
@@ -147,6 +164,16 @@ ViewProviderPartExt::ViewProviderPartExt()
         ("User parameter:BaseApp/Preferences/Mod/Part");
     NormalsFromUV = hPart->GetBool("NormalsFromUVNodes", NormalsFromUV);
 
+    lodFactor = hPart->GetFloat("LevelOfDetailFactor", 1.0);
+    lodSize = static_cast<float>(hPart->GetFloat("LevelOfDetailSize", 100.0));
+    lodProjectedSize = 0.0F;
+    lodLastProjectedSize = 0.0F;
+    lodCoarse = false;
+    lodSensor.setFunction(&ViewProviderPartExt::levelOfDetailCB);
+    lodSensor.setData(this);
+
+    asyncTessellation = hPart->GetBool("AsyncTessellation", false);
+
     long twoside = hPart->GetBool("TwoSideRendering", true) ? 1 : 0;
 
     // Let the user define a custom lower limit but a value less than
@@ -256,6 +283,11 @@ ViewProviderPartExt::ViewProviderPartExt()
 
 ViewProviderPartExt::~ViewProviderPartExt()
 {
+    tessellationWatcher.reset();
+    lodSensor.setData(nullptr);
+    lodSensor.unschedule();
+    faceset->setProjectedSizeCallback(SbBox3f(), nullptr);
+
     pcFaceBind->unref();
     pcLineBind->unref();
     pcPointBind->unref();
@@ -286,14 +318,16 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
     // The lower limit of the deviation has been increased to avoid
     // to freeze the GUI
     // https://forum.freecad.org/viewtopic.php?f=3&t=24912&p=195613
+    // While restoring, the shape is meshed and the colour lists are applied
+    // once in finishRestoring(), after all properties are known
     if (prop == &Deviation) {
-        if(isUpdateForced()||Visibility.getValue())
+        if(!isRestoring() && (isUpdateForced()||Visibility.getValue()))
             updateVisual();
         else
             VisualTouched = true;
     }
     if (prop == &AngularDeflection) {
-        if(isUpdateForced()||Visibility.getValue())
+        if(!isRestoring() && (isUpdateForced()||Visibility.getValue()))
             updateVisual();
         else
             VisualTouched = true;
@@ -341,10 +375,12 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
         pcPointMaterial->transparency.setValue(Mat.transparency);
     }
     else if (prop == &PointColorArray) {
-        setHighlightedPoints(PointColorArray.getValues());
+        if (!isRestoring())
+            setHighlightedPoints(PointColorArray.getValues());
     }
     else if (prop == &LineColorArray) {
-        setHighlightedEdges(LineColorArray.getValues());
+        if (!isRestoring())
+            setHighlightedEdges(LineColorArray.getValues());
     }
     else if (prop == &_diffuseColor) {
         // Used to load the old DiffuseColor values asynchronously
@@ -359,7 +395,8 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
         ShapeAppearance.setTransparencies(transparencies);
     }
     else if (prop == &ShapeAppearance) {
-        setHighlightedFaces(ShapeAppearance);
+        if (!isRestoring())
+            setHighlightedFaces(ShapeAppearance);
         ViewProviderGeometryObject::onChanged(prop);
     }
     else if (prop == &Transparency) {
@@ -388,7 +425,8 @@ void ViewProviderPartExt::onChanged(const App::Property* prop)
     }
     else {
         // if the object was invisible and has been changed, recreate the visual
-        if (prop == &Visibility && (isUpdateForced() || Visibility.getValue()) && VisualTouched) {
+        if (prop == &Visibility && !isRestoring()
+                && (isUpdateForced() || Visibility.getValue()) && VisualTouched) {
             updateVisual();
             // updateVisual() may not be triggered by any change (e.g.
             // triggered by an external object through forceUpdate()). And
@@ -858,7 +896,7 @@ void ViewProviderPartExt::updateData(const App::Property* prop)
     const char *propName = prop->getName();
     if (propName && (strcmp(propName, "Shape") == 0 || strstr(propName, "Touched"))) {
         // calculate the visual only if visible
-        if (isUpdateForced() || Visibility.getValue())
+        if (!isRestoring() && (isUpdateForced() || Visibility.getValue()))
             updateVisual();
         else
             VisualTouched = true;
@@ -887,6 +925,16 @@ void ViewProviderPartExt::finishRestoring()
     if (_diffuseColor.getSize() > 1) {
         onChanged(&_diffuseColor);
     }
+
+    // Build the visual of a visible object once, with the restored deviation,
+    // which also applies the colours. Hidden objects are meshed when shown.
+    if (VisualTouched) {
+        if (isUpdateForced() || Visibility.getValue())
+            updateVisual();
+    }
+    else {
+        applyVisualHighlight();
+    }
     Gui::ViewProviderGeometryObject::finishRestoring();
 }
 
@@ -934,7 +982,132 @@ void ViewProviderPartExt::unsetEdit(int ModNum)
     }
 }
 
-void ViewProviderPartExt::updateVisual()
+namespace {
+
+/// Triangulation of a face and the position of its data in the Inventor arrays
+struct FaceTriangulation
+{
+    TopoDS_Face face;
+    Handle(Poly_Triangulation) mesh;
+    TopLoc_Location location;
+    int part = 0;
+    int nodeOffset = 0;
+    int triaOffset = 0;
+};
+
+void fillFaceTriangulation(const FaceTriangulation& faceMesh, bool normalsFromUV,
+                           SbVec3f* verts, SbVec3f* norms, int32_t* index, int32_t* parts)
+{
+    const TopoDS_Face &actFace = faceMesh.face;
+    const Handle(Poly_Triangulation)& mesh = faceMesh.mesh;
+    if (mesh.IsNull()) {
+        parts[faceMesh.part] = 0;
+        return;
+    }
+
+    // getting the transformation of the shape/face
+    gp_Trsf myTransf;
+    Standard_Boolean identity = true;
+    if (!faceMesh.location.IsIdentity()) {
+        identity = false;
+        myTransf = faceMesh.location.Transformation();
+    }
+
+    int nodeOffset = faceMesh.nodeOffset;
+    int triaOffset = faceMesh.triaOffset;
+
+    // getting size of triangle array of this face
+    int nbTriInFace   = mesh->NbTriangles();
+    // check orientation
+    TopAbs_Orientation orient = actFace.Orientation();
+
+    // cycling through the poly mesh
+#if OCC_VERSION_HEX < 0x070600
+    const Poly_Array1OfTriangle& Triangles = mesh->Triangles();
+    const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
+    TColgp_Array1OfDir Normals (Nodes.Lower(), Nodes.Upper());
+#else
+    int numNodes =  mesh->NbNodes();
+    TColgp_Array1OfDir Normals (1, numNodes);
+#endif
+    if (normalsFromUV)
+        Part::Tools::getPointNormals(actFace, mesh, Normals);
+
+    for (int g=1;g<=nbTriInFace;g++) {
+        // Get the triangle
+        Standard_Integer N1,N2,N3;
+#if OCC_VERSION_HEX < 0x070600
+        Triangles(g).Get(N1,N2,N3);
+#else
+        mesh->Triangle(g).Get(N1,N2,N3);
+#endif
+
+        // change orientation of the triangle if the face is reversed
+        if ( orient != TopAbs_FORWARD ) {
+            Standard_Integer tmp = N1;
+            N1 = N2;
+            N2 = tmp;
+        }
+
+        // get the 3 points of this triangle
+#if OCC_VERSION_HEX < 0x070600
+        gp_Pnt V1(Nodes(N1)), V2(Nodes(N2)), V3(Nodes(N3));
+#else
+        gp_Pnt V1(mesh->Node(N1)), V2(mesh->Node(N2)), V3(mesh->Node(N3));
+#endif
+
+        // get the 3 normals of this triangle
+        gp_Vec NV1, NV2, NV3;
+        if (normalsFromUV) {
+            NV1.SetXYZ(Normals(N1).XYZ());
+            NV2.SetXYZ(Normals(N2).XYZ());
+            NV3.SetXYZ(Normals(N3).XYZ());
+        }
+        else {
+            gp_Vec v1(V1.X(),V1.Y(),V1.Z()),
+                   v2(V2.X(),V2.Y(),V2.Z()),
+                   v3(V3.X(),V3.Y(),V3.Z());
+            gp_Vec normal = (v2-v1)^(v3-v1);
+            NV1 = normal;
+            NV2 = normal;
+            NV3 = normal;
+        }
+
+        // transform the vertices and normals to the place of the face
+        if (!identity) {
+            V1.Transform(myTransf);
+            V2.Transform(myTransf);
+            V3.Transform(myTransf);
+            if (normalsFromUV) {
+                NV1.Transform(myTransf);
+                NV2.Transform(myTransf);
+                NV3.Transform(myTransf);
+            }
+        }
+
+        // add the normals for all points of this triangle
+        norms[nodeOffset+N1-1] += SbVec3f(NV1.X(),NV1.Y(),NV1.Z());
+        norms[nodeOffset+N2-1] += SbVec3f(NV2.X(),NV2.Y(),NV2.Z());
+        norms[nodeOffset+N3-1] += SbVec3f(NV3.X(),NV3.Y(),NV3.Z());
+
+        // set the vertices
+        verts[nodeOffset+N1-1].setValue((float)(V1.X()),(float)(V1.Y()),(float)(V1.Z()));
+        verts[nodeOffset+N2-1].setValue((float)(V2.X()),(float)(V2.Y()),(float)(V2.Z()));
+        verts[nodeOffset+N3-1].setValue((float)(V3.X()),(float)(V3.Y()),(float)(V3.Z()));
+
+        // set the index vector with the 3 point indexes and the end delimiter
+        index[triaOffset*4+4*(g-1)]   = nodeOffset+N1-1;
+        index[triaOffset*4+4*(g-1)+1] = nodeOffset+N2-1;
+        index[triaOffset*4+4*(g-1)+2] = nodeOffset+N3-1;
+        index[triaOffset*4+4*(g-1)+3] = SO_END_FACE_INDEX;
+    }
+
+    parts[faceMesh.part] = nbTriInFace; // new part
+}
+
+} // namespace
+
+void ViewProviderPartExt::clearVisualHighlight()
 {
     Gui::SoUpdateVBOAction action;
     action.apply(this->faceset);
@@ -950,391 +1123,503 @@ void ViewProviderPartExt::updateVisual()
     haction.apply(this->faceset);
     haction.apply(this->lineset);
     haction.apply(this->nodeset);
+}
+
+void ViewProviderPartExt::applyVisualHighlight()
+{
+    // The material has to be checked again
+    setHighlightedFaces(ShapeAppearance.getValues());
+    setHighlightedEdges(LineColorArray.getValues());
+    setHighlightedPoints(PointColorArray.getValue());
+}
+
+void ViewProviderPartExt::updateVisual()
+{
+    FC_TRACE_ZONE("ViewProviderPartExt::updateVisual", pcObject->getNameInDocument());
+    lodCoarseData.reset();
+
+    // Start with the coarse tessellation unless the shape was big on the screen before
+    double deflectionFactor = 1.0;
+    if (lodFactor > 1.0 && lodLastProjectedSize < lodSize) {
+        deflectionFactor = lodFactor;
+    }
+
+    if (!asyncTessellation || isUpdateForced() || !startTessellation(deflectionFactor)) {
+        // a pending result would replace this newer one
+        tessellationWatcher.reset();
+        buildVisual(deflectionFactor);
+    }
+}
+
+void ViewProviderPartExt::buildVisual(double deflectionFactor)
+{
+    clearVisualHighlight();
+    lodCoarse = false;
 
     TopoDS_Shape cShape = Part::Feature::getShape(getObject());
     if (cShape.IsNull()) {
-        coords  ->point      .setNum(0);
-        norm    ->vector     .setNum(0);
-        faceset ->coordIndex .setNum(0);
-        faceset ->partIndex  .setNum(0);
-        lineset ->coordIndex .setNum(0);
-        nodeset ->startIndex .setValue(0);
+        applyTessellation(Tessellation());
         VisualTouched = false;
         return;
     }
 
     // time measurement and book keeping
     Base::TimeElapsed start_time;
-    int numTriangles=0,numNodes=0,numNorms=0,numFaces=0,numEdges=0,numLines=0;
-    std::set<int> faceEdges;
 
     try {
-        // calculating the deflection value
-        Bnd_Box bounds;
-        BRepBndLib::Add(cShape, bounds);
-        bounds.SetGap(0.0);
-        Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
-        bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
-        Standard_Real deflection = ((xMax-xMin)+(yMax-yMin)+(zMax-zMin))/300.0 * Deviation.getValue();
-
-        // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single vertex
-        // should be displayed.
-        if (deflection < gp::Resolution()) {
-            deflection = Precision::Confusion();
+        // The coarse tessellation is made on a copy of the topology so that it
+        // neither replaces nor is limited by the triangulation stored in the shape
+        if (deflectionFactor > 1.0) {
+            cShape = BRepBuilderAPI_Copy(cShape, Standard_False).Shape();
+        }
+
+        std::shared_ptr<Tessellation> data = tessellate(cShape,
+                                                        Deviation.getValue(),
+                                                        AngularDeflection.getValue(),
+                                                        deflectionFactor,
+                                                        NormalsFromUV);
+        applyTessellation(*data);
+        if (deflectionFactor > 1.0) {
+            lodCoarseData = std::move(data);
+            lodCoarse = true;
         }
+    }
+    catch (const Standard_Failure& e) {
+        FC_ERR("Cannot compute Inventor representation for the shape of "
+               << pcObject->getFullName() << ": " << e.GetMessageString());
+    }
+    catch (...) {
+        FC_ERR("Cannot compute Inventor representation for the shape of " << pcObject->getFullName());
+    }
 
-        // For very big objects the computed deflection can become very high and thus leads to a useless
-        // tessellation. To avoid this the upper limit is set to 20.0
-        // See also forum: https://forum.freecad.org/viewtopic.php?t=77521
-        //deflection = std::min(deflection, 20.0);
+#   ifdef FC_DEBUG
+        // printing some information
+        Base::Console().Log("ViewProvider update time: %f s\n",Base::TimeElapsed::diffTimeF(start_time,Base::TimeElapsed()));
+#   else
+    (void)start_time;
+#   endif
+    VisualTouched = false;
 
-        // create or use the mesh on the data structure
-        Standard_Real AngDeflectionRads = AngularDeflection.getValue() / 180.0 * M_PI;
+    applyVisualHighlight();
+}
 
-#if OCC_VERSION_HEX >= 0x070500
-        IMeshTools_Parameters meshParams;
-        meshParams.Deflection = deflection;
-        meshParams.Relative = Standard_False;
-        meshParams.Angle = AngDeflectionRads;
-        meshParams.InParallel = Standard_True;
-        meshParams.AllowQualityDecrease = Standard_True;
-
-        BRepMesh_IncrementalMesh(cShape, meshParams);
-#else
-        BRepMesh_IncrementalMesh(cShape, deflection, Standard_False, AngDeflectionRads, Standard_True);
-#endif
+bool ViewProviderPartExt::startTessellation(double deflectionFactor)
+{
+    TopoDS_Shape shape = Part::Feature::getShape(getObject());
+    if (shape.IsNull()) {
+        return false;
+    }
 
-        // We must reset the location here because the transformation data
-        // are set in the placement property
-        TopLoc_Location aLoc;
-        cShape.Location(aLoc);
-
-        // count triangles and nodes in the mesh
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(cShape, TopAbs_FACE, faceMap);
-        for (int i=1; i <= faceMap.Extent(); i++) {
-            Handle (Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(faceMap(i)), aLoc);
-            if (mesh.IsNull()) {
-                mesh = Part::Tools::triangulationOfFace(TopoDS::Face(faceMap(i)));
-            }
-            // Note: we must also count empty faces
-            if (!mesh.IsNull()) {
-                numTriangles += mesh->NbTriangles();
-                numNodes     += mesh->NbNodes();
-                numNorms     += mesh->NbNodes();
-            }
+    // The worker meshes a copy of the topology, so it neither races with
+    // anyone else reading or meshing the shape of the feature nor stores its
+    // triangulation there. The geometry is shared, an existing triangulation
+    // is kept for the regular tessellation.
+    try {
+        shape = BRepBuilderAPI_Copy(shape, Standard_False, deflectionFactor <= 1.0).Shape();
+    }
+    catch (const Standard_Failure&) {
+        return false;
+    }
 
-            TopExp_Explorer xp;
-            for (xp.Init(faceMap(i),TopAbs_EDGE);xp.More();xp.Next()) {
-                faceEdges.insert(Part::ShapeMapHasher{}(xp.Current()));
-            }
-            numFaces++;
+    double deviation = Deviation.getValue();
+    double angularDeflection = AngularDeflection.getValue();
+    bool normalsFromUV = NormalsFromUV;
+    std::string name = getObject()->getFullName();
+    QFuture<std::shared_ptr<Tessellation>> future = QtConcurrent::run([=]() {
+        std::shared_ptr<Tessellation> data;
+        try {
+            data = tessellate(shape, deviation, angularDeflection, deflectionFactor, normalsFromUV);
+        }
+        catch (const Standard_Failure& e) {
+            FC_ERR("Cannot compute Inventor representation for the shape of "
+                   << name << ": " << e.GetMessageString());
         }
+        catch (...) {
+            FC_ERR("Cannot compute Inventor representation for the shape of " << name);
+        }
+        return data;
+    });
+
+    // Replacing the watcher drops the result of a tessellation still running
+    tessellationWatcher = std::make_unique<QFutureWatcher<std::shared_ptr<Tessellation>>>();
+    QObject::connect(tessellationWatcher.get(), &QFutureWatcherBase::finished, [this]() {
+        finishTessellation();
+    });
+    tessellationWatcher->setFuture(future);
+    tessellationFactor = deflectionFactor;
+
+    // the current tessellation stays on the screen until the new one is ready
+    VisualTouched = false;
+    return true;
+}
 
-        // get an indexed map of edges
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(cShape, TopAbs_EDGE, edgeMap);
-
-         // key is the edge number, value the coord indexes. This is needed to keep the same order as the edges.
-        std::map<int, std::vector<int32_t> > lineSetMap;
-        std::set<int>          edgeIdxSet;
-        std::vector<int32_t>   edgeVector;
-
-        // count and index the edges
-        for (int i=1; i <= edgeMap.Extent(); i++) {
-            edgeIdxSet.insert(i);
-            numEdges++;
-
-            const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
-            TopLoc_Location aLoc;
-
-            // handling of the free edge that are not associated to a face
-            // Note: The assumption that if for an edge BRep_Tool::Polygon3D
-            // returns a valid object is wrong. This e.g. happens for ruled
-            // surfaces which gets created by two edges or wires.
-            // So, we have to store the hashes of the edges associated to a face.
-            // If the hash of a given edge is not in this list we know it's really
-            // a free edge.
-            int hash = Part::ShapeMapHasher{}(aEdge);
-            if (faceEdges.find(hash) == faceEdges.end()) {
-                Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
-                if (!aPoly.IsNull()) {
-                    int nbNodesInEdge = aPoly->NbNodes();
-                    numNodes += nbNodesInEdge;
-                }
-            }
+void ViewProviderPartExt::finishTessellation()
+{
+    std::shared_ptr<Tessellation> data = tessellationWatcher->result();
+    double deflectionFactor = tessellationFactor;
+    tessellationWatcher.release()->deleteLater();
+
+    clearVisualHighlight();
+    lodCoarse = false;
+    if (data) {
+        applyTessellation(*data);
+        if (deflectionFactor > 1.0) {
+            lodCoarseData = std::move(data);
+            lodCoarse = true;
         }
+    }
+    applyVisualHighlight();
+}
 
-        // handling of the vertices
-        TopTools_IndexedMapOfShape vertexMap;
-        TopExp::MapShapes(cShape, TopAbs_VERTEX, vertexMap);
-        numNodes += vertexMap.Extent();
-
-        // create memory for the nodes and indexes
-        coords  ->point      .setNum(numNodes);
-        norm    ->vector     .setNum(numNorms);
-        faceset ->coordIndex .setNum(numTriangles*4);
-        faceset ->partIndex  .setNum(numFaces);
-        // get the raw memory for fast fill up
-        SbVec3f* verts = coords  ->point       .startEditing();
-        SbVec3f* norms = norm    ->vector      .startEditing();
-        int32_t* index = faceset ->coordIndex  .startEditing();
-        int32_t* parts = faceset ->partIndex   .startEditing();
-
-        // preset the normal vector with null vector
-        for (int i=0;i < numNorms;i++)
-            norms[i]= SbVec3f(0.0,0.0,0.0);
-
-        int ii = 0,faceNodeOffset=0,faceTriaOffset=0;
-        for (int i=1; i <= faceMap.Extent(); i++, ii++) {
-            TopLoc_Location aLoc;
-            const TopoDS_Face &actFace = TopoDS::Face(faceMap(i));
-            // get the mesh of the shape
-            Handle (Poly_Triangulation) mesh = BRep_Tool::Triangulation(actFace,aLoc);
-            if (mesh.IsNull()) {
-                mesh = Part::Tools::triangulationOfFace(actFace);
-            }
-            if (mesh.IsNull()) {
-                parts[ii] = 0;
-                continue;
-            }
+void ViewProviderPartExt::applyTessellation(const Tessellation& data)
+{
+    coords  ->point      .setNum(static_cast<int>(data.points.size()));
+    coords  ->point      .setValues(0, static_cast<int>(data.points.size()), data.points.data());
+    norm    ->vector     .setNum(static_cast<int>(data.normals.size()));
+    norm    ->vector     .setValues(0, static_cast<int>(data.normals.size()), data.normals.data());
+    faceset ->coordIndex .setNum(static_cast<int>(data.faceIndex.size()));
+    faceset ->coordIndex .setValues(0, static_cast<int>(data.faceIndex.size()), data.faceIndex.data());
+    faceset ->partIndex  .setNum(static_cast<int>(data.partIndex.size()));
+    faceset ->partIndex  .setValues(0, static_cast<int>(data.partIndex.size()), data.partIndex.data());
+    lineset ->coordIndex .setNum(static_cast<int>(data.lineIndex.size()));
+    lineset ->coordIndex .setValues(0, static_cast<int>(data.lineIndex.size()), data.lineIndex.data());
+    nodeset ->startIndex .setValue(data.nodeStart);
+
+    if (lodFactor > 1.0 && !data.points.empty()) {
+        faceset->setProjectedSizeCallback(data.box, [this](float pixels) {
+            onProjectedSize(pixels);
+        });
+    }
+    else {
+        faceset->setProjectedSizeCallback(SbBox3f(), nullptr);
+    }
+}
 
-            // getting the transformation of the shape/face
-            gp_Trsf myTransf;
-            Standard_Boolean identity = true;
-            if (!aLoc.IsIdentity()) {
-                identity = false;
-                myTransf = aLoc.Transformation();
-            }
+std::shared_ptr<ViewProviderPartExt::Tessellation>
+ViewProviderPartExt::tessellate(TopoDS_Shape cShape,
+                                double deviation,
+                                double angularDeflection,
+                                double deflectionFactor,
+                                bool normalsFromUV)
+{
+    auto data = std::make_shared<Tessellation>();
+    int numTriangles=0,numNodes=0,numNorms=0,numFaces=0,numEdges=0,numLines=0;
+    std::set<int> faceEdges;
 
-            // getting size of node and triangle array of this face
-            int nbNodesInFace = mesh->NbNodes();
-            int nbTriInFace   = mesh->NbTriangles();
-            // check orientation
-            TopAbs_Orientation orient = actFace.Orientation();
+    // calculating the deflection value
+    Bnd_Box bounds;
+    BRepBndLib::Add(cShape, bounds);
+    bounds.SetGap(0.0);
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    Standard_Real deflection = ((xMax-xMin)+(yMax-yMin)+(zMax-zMin))/300.0 * deviation;
+    deflection *= deflectionFactor;
+
+    // Since OCCT 7.6 a value of equal 0 is not allowed any more, this can happen if a single vertex
+    // should be displayed.
+    if (deflection < gp::Resolution()) {
+        deflection = Precision::Confusion();
+    }
 
+    // For very big objects the computed deflection can become very high and thus leads to a useless
+    // tessellation. To avoid this the upper limit is set to 20.0
+    // See also forum: https://forum.freecad.org/viewtopic.php?t=77521
+    //deflection = std::min(deflection, 20.0);
 
-            // cycling through the poly mesh
-#if OCC_VERSION_HEX < 0x070600
-            const Poly_Array1OfTriangle& Triangles = mesh->Triangles();
-            const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
-            TColgp_Array1OfDir Normals (Nodes.Lower(), Nodes.Upper());
-#else
-            int numNodes =  mesh->NbNodes();
-            TColgp_Array1OfDir Normals (1, numNodes);
-#endif
-            if (NormalsFromUV)
-                Part::Tools::getPointNormals(actFace, mesh, Normals);
+    // create or use the mesh on the data structure
+    if (deflectionFactor > 1.0) {
+        angularDeflection = std::max(angularDeflection, std::min(angularDeflection * deflectionFactor, 60.0));
+    }
+    Standard_Real AngDeflectionRads = angularDeflection / 180.0 * M_PI;
 
-            for (int g=1;g<=nbTriInFace;g++) {
-                // Get the triangle
-                Standard_Integer N1,N2,N3;
-#if OCC_VERSION_HEX < 0x070600
-                Triangles(g).Get(N1,N2,N3);
+#if OCC_VERSION_HEX >= 0x070500
+    IMeshTools_Parameters meshParams;
+    meshParams.Deflection = deflection;
+    meshParams.Relative = Standard_False;
+    meshParams.Angle = AngDeflectionRads;
+    meshParams.InParallel = Standard_True;
+    meshParams.AllowQualityDecrease = Standard_True;
+
+    BRepMesh_IncrementalMesh(cShape, meshParams);
 #else
-                mesh->Triangle(g).Get(N1,N2,N3);
+    BRepMesh_IncrementalMesh(cShape, deflection, Standard_False, AngDeflectionRads, Standard_True);
 #endif
 
-                // change orientation of the triangle if the face is reversed
-                if ( orient != TopAbs_FORWARD ) {
-                    Standard_Integer tmp = N1;
-                    N1 = N2;
-                    N2 = tmp;
-                }
+    // We must reset the location here because the transformation data
+    // are set in the placement property
+    TopLoc_Location aLoc;
+    cShape.Location(aLoc);
+
+    // count triangles and nodes in the mesh
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(cShape, TopAbs_FACE, faceMap);
+    std::vector<FaceTriangulation> faceMeshes(faceMap.Extent());
+    for (int i=1; i <= faceMap.Extent(); i++) {
+        FaceTriangulation& faceMesh = faceMeshes[i-1];
+        faceMesh.face = TopoDS::Face(faceMap(i));
+        faceMesh.part = i-1;
+        faceMesh.nodeOffset = numNodes;
+        faceMesh.triaOffset = numTriangles;
+        faceMesh.mesh = BRep_Tool::Triangulation(faceMesh.face, faceMesh.location);
+        if (faceMesh.mesh.IsNull()) {
+            faceMesh.mesh = Part::Tools::triangulationOfFace(faceMesh.face);
+        }
+        // Note: we must also count empty faces
+        if (!faceMesh.mesh.IsNull()) {
+            numTriangles += faceMesh.mesh->NbTriangles();
+            numNodes     += faceMesh.mesh->NbNodes();
+            numNorms     += faceMesh.mesh->NbNodes();
+        }
 
-                // get the 3 points of this triangle
-#if OCC_VERSION_HEX < 0x070600
-                gp_Pnt V1(Nodes(N1)), V2(Nodes(N2)), V3(Nodes(N3));
-#else
-                gp_Pnt V1(mesh->Node(N1)), V2(mesh->Node(N2)), V3(mesh->Node(N3));
-#endif
+        TopExp_Explorer xp;
+        for (xp.Init(faceMap(i),TopAbs_EDGE);xp.More();xp.Next()) {
+            faceEdges.insert(Part::ShapeMapHasher{}(xp.Current()));
+        }
+        numFaces++;
+    }
 
-                // get the 3 normals of this triangle
-                gp_Vec NV1, NV2, NV3;
-                if (NormalsFromUV) {
-                    NV1.SetXYZ(Normals(N1).XYZ());
-                    NV2.SetXYZ(Normals(N2).XYZ());
-                    NV3.SetXYZ(Normals(N3).XYZ());
-                }
-                else {
-                    gp_Vec v1(V1.X(),V1.Y(),V1.Z()),
-                           v2(V2.X(),V2.Y(),V2.Z()),
-                           v3(V3.X(),V3.Y(),V3.Z());
-                    gp_Vec normal = (v2-v1)^(v3-v1);
-                    NV1 = normal;
-                    NV2 = normal;
-                    NV3 = normal;
-                }
+    // get an indexed map of edges
+    TopTools_IndexedMapOfShape edgeMap;
+    TopExp::MapShapes(cShape, TopAbs_EDGE, edgeMap);
 
-                // transform the vertices and normals to the place of the face
-                if (!identity) {
-                    V1.Transform(myTransf);
-                    V2.Transform(myTransf);
-                    V3.Transform(myTransf);
-                    if (NormalsFromUV) {
-                        NV1.Transform(myTransf);
-                        NV2.Transform(myTransf);
-                        NV3.Transform(myTransf);
-                    }
-                }
+     // key is the edge number, value the coord indexes. This is needed to keep the same order as the edges.
+    std::map<int, std::vector<int32_t> > lineSetMap;
+    std::set<int>          edgeIdxSet;
+    std::vector<int32_t>   edgeVector;
 
-                // add the normals for all points of this triangle
-                norms[faceNodeOffset+N1-1] += SbVec3f(NV1.X(),NV1.Y(),NV1.Z());
-                norms[faceNodeOffset+N2-1] += SbVec3f(NV2.X(),NV2.Y(),NV2.Z());
-                norms[faceNodeOffset+N3-1] += SbVec3f(NV3.X(),NV3.Y(),NV3.Z());
-
-                // set the vertices
-                verts[faceNodeOffset+N1-1].setValue((float)(V1.X()),(float)(V1.Y()),(float)(V1.Z()));
-                verts[faceNodeOffset+N2-1].setValue((float)(V2.X()),(float)(V2.Y()),(float)(V2.Z()));
-                verts[faceNodeOffset+N3-1].setValue((float)(V3.X()),(float)(V3.Y()),(float)(V3.Z()));
-
-                // set the index vector with the 3 point indexes and the end delimiter
-                index[faceTriaOffset*4+4*(g-1)]   = faceNodeOffset+N1-1;
-                index[faceTriaOffset*4+4*(g-1)+1] = faceNodeOffset+N2-1;
-                index[faceTriaOffset*4+4*(g-1)+2] = faceNodeOffset+N3-1;
-                index[faceTriaOffset*4+4*(g-1)+3] = SO_END_FACE_INDEX;
-            }
+    // count and index the edges
+    for (int i=1; i <= edgeMap.Extent(); i++) {
+        edgeIdxSet.insert(i);
+        numEdges++;
 
-            parts[ii] = nbTriInFace; // new part
-
-            // handling the edges lying on this face
-            TopExp_Explorer Exp;
-            for(Exp.Init(actFace,TopAbs_EDGE);Exp.More();Exp.Next()) {
-                const TopoDS_Edge &curEdge = TopoDS::Edge(Exp.Current());
-                // get the overall index of this edge
-                int edgeIndex = edgeMap.FindIndex(curEdge);
-                edgeVector.push_back((int32_t)edgeIndex-1);
-                // already processed this index ?
-                if (edgeIdxSet.find(edgeIndex)!=edgeIdxSet.end()) {
-
-                    // this holds the indices of the edge's triangulation to the current polygon
-                    Handle(Poly_PolygonOnTriangulation) aPoly = BRep_Tool::PolygonOnTriangulation(curEdge, mesh, aLoc);
-                    if (aPoly.IsNull())
-                        continue; // polygon does not exist
-
-                    // getting the indexes of the edge polygon
-                    const TColStd_Array1OfInteger& indices = aPoly->Nodes();
-                    for (Standard_Integer i=indices.Lower();i <= indices.Upper();i++) {
-                        int nodeIndex = indices(i);
-                        int index = faceNodeOffset+nodeIndex-1;
-                        lineSetMap[edgeIndex].push_back(index);
-
-                        // usually the coordinates for this edge are already set by the
-                        // triangles of the face this edge belongs to. However, there are
-                        // rare cases where some points are only referenced by the polygon
-                        // but not by any triangle. Thus, we must apply the coordinates to
-                        // make sure that everything is properly set.
-#if OCC_VERSION_HEX < 0x070600
-                        gp_Pnt p(Nodes(nodeIndex));
-#else
-                        gp_Pnt p(mesh->Node(nodeIndex));
-#endif
-                        if (!identity)
-                            p.Transform(myTransf);
-                        verts[index].setValue((float)(p.X()),(float)(p.Y()),(float)(p.Z()));
-                    }
+        const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
+        TopLoc_Location aLoc;
 
-                    // remove the handled edge index from the set
-                    edgeIdxSet.erase(edgeIndex);
-                }
+        // handling of the free edge that are not associated to a face
+        // Note: The assumption that if for an edge BRep_Tool::Polygon3D
+        // returns a valid object is wrong. This e.g. happens for ruled
+        // surfaces which gets created by two edges or wires.
+        // So, we have to store the hashes of the edges associated to a face.
+        // If the hash of a given edge is not in this list we know it's really
+        // a free edge.
+        int hash = Part::ShapeMapHasher{}(aEdge);
+        if (faceEdges.find(hash) == faceEdges.end()) {
+            Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
+            if (!aPoly.IsNull()) {
+                int nbNodesInEdge = aPoly->NbNodes();
+                numNodes += nbNodesInEdge;
             }
+        }
+    }
 
-            edgeVector.push_back(-1);
+    // handling of the vertices
+    TopTools_IndexedMapOfShape vertexMap;
+    TopExp::MapShapes(cShape, TopAbs_VERTEX, vertexMap);
+    numNodes += vertexMap.Extent();
+
+    // create memory for the nodes and indexes, the normals are preset with null vectors
+    data->points.resize(numNodes);
+    data->normals.assign(numNorms, SbVec3f(0.0F, 0.0F, 0.0F));
+    data->faceIndex.resize(numTriangles*4);
+    data->partIndex.resize(numFaces);
+    SbVec3f* verts = data->points.data();
+    SbVec3f* norms = data->normals.data();
+    int32_t* index = data->faceIndex.data();
+    int32_t* parts = data->partIndex.data();
+
+    // Each face writes into its own slices of the arrays, so the triangles of all faces
+    // can be filled in parallel
+    QtConcurrent::blockingMap(faceMeshes, [&](const FaceTriangulation& faceMesh) {
+        fillFaceTriangulation(faceMesh, normalsFromUV, verts, norms, index, parts);
+    });
+
+    // The edges must be collected in the order of the faces
+    int faceNodeOffset=0;
+    for (const auto& faceMesh : faceMeshes) {
+        const TopoDS_Face &actFace = faceMesh.face;
+        const Handle(Poly_Triangulation)& mesh = faceMesh.mesh;
+        if (mesh.IsNull()) {
+            continue;
+        }
 
-            // counting up the per Face offsets
-            faceNodeOffset += nbNodesInFace;
-            faceTriaOffset += nbTriInFace;
+        TopLoc_Location aLoc = faceMesh.location;
+        gp_Trsf myTransf;
+        Standard_Boolean identity = true;
+        if (!aLoc.IsIdentity()) {
+            identity = false;
+            myTransf = aLoc.Transformation();
         }
+#if OCC_VERSION_HEX < 0x070600
+        const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
+#endif
 
-        // handling of the free edges
-        for (int i=1; i <= edgeMap.Extent(); i++) {
-            const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
-            Standard_Boolean identity = true;
-            gp_Trsf myTransf;
-            TopLoc_Location aLoc;
-
-            // handling of the free edge that are not associated to a face
-            int hash = Part::ShapeMapHasher{}(aEdge);
-            if (faceEdges.find(hash) == faceEdges.end()) {
-                Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
-                if (!aPoly.IsNull()) {
-                    if (!aLoc.IsIdentity()) {
-                        identity = false;
-                        myTransf = aLoc.Transformation();
-                    }
-
-                    const TColgp_Array1OfPnt& aNodes = aPoly->Nodes();
-                    int nbNodesInEdge = aPoly->NbNodes();
-
-                    gp_Pnt pnt;
-                    for (Standard_Integer j=1;j <= nbNodesInEdge;j++) {
-                        pnt = aNodes(j);
-                        if (!identity)
-                            pnt.Transform(myTransf);
-                        int index = faceNodeOffset+j-1;
-                        verts[index].setValue((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
-                        lineSetMap[i].push_back(index);
-                    }
-
-                    faceNodeOffset += nbNodesInEdge;
+        // handling the edges lying on this face
+        TopExp_Explorer Exp;
+        for(Exp.Init(actFace,TopAbs_EDGE);Exp.More();Exp.Next()) {
+            const TopoDS_Edge &curEdge = TopoDS::Edge(Exp.Current());
+            // get the overall index of this edge
+            int edgeIndex = edgeMap.FindIndex(curEdge);
+            edgeVector.push_back((int32_t)edgeIndex-1);
+            // already processed this index ?
+            if (edgeIdxSet.find(edgeIndex)!=edgeIdxSet.end()) {
+
+                // this holds the indices of the edge's triangulation to the current polygon
+                Handle(Poly_PolygonOnTriangulation) aPoly = BRep_Tool::PolygonOnTriangulation(curEdge, mesh, aLoc);
+                if (aPoly.IsNull())
+                    continue; // polygon does not exist
+
+                // getting the indexes of the edge polygon
+                const TColStd_Array1OfInteger& indices = aPoly->Nodes();
+                for (Standard_Integer i=indices.Lower();i <= indices.Upper();i++) {
+                    int nodeIndex = indices(i);
+                    int index = faceNodeOffset+nodeIndex-1;
+                    lineSetMap[edgeIndex].push_back(index);
+
+                    // usually the coordinates for this edge are already set by the
+                    // triangles of the face this edge belongs to. However, there are
+                    // rare cases where some points are only referenced by the polygon
+                    // but not by any triangle. Thus, we must apply the coordinates to
+                    // make sure that everything is properly set.
+#if OCC_VERSION_HEX < 0x070600
+                    gp_Pnt p(Nodes(nodeIndex));
+#else
+                    gp_Pnt p(mesh->Node(nodeIndex));
+#endif
+                    if (!identity)
+                        p.Transform(myTransf);
+                    verts[index].setValue((float)(p.X()),(float)(p.Y()),(float)(p.Z()));
                 }
+
+                // remove the handled edge index from the set
+                edgeIdxSet.erase(edgeIndex);
             }
         }
 
-        nodeset->startIndex.setValue(faceNodeOffset);
-        for (int i=0; i<vertexMap.Extent(); i++) {
-            const TopoDS_Vertex& aVertex = TopoDS::Vertex(vertexMap(i+1));
-            gp_Pnt pnt = BRep_Tool::Pnt(aVertex);
-            verts[faceNodeOffset+i].setValue((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
-        }
+        edgeVector.push_back(-1);
 
-        // normalize all normals
-        for (int i = 0; i< numNorms ;i++)
-            norms[i].normalize();
+        // counting up the per Face offsets
+        faceNodeOffset += mesh->NbNodes();
+    }
 
-        std::vector<int32_t> lineSetCoords;
-        for (const auto & it : lineSetMap) {
-            lineSetCoords.insert(lineSetCoords.end(), it.second.begin(), it.second.end());
-            lineSetCoords.push_back(-1);
-        }
+    // handling of the free edges
+    for (int i=1; i <= edgeMap.Extent(); i++) {
+        const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
+        Standard_Boolean identity = true;
+        gp_Trsf myTransf;
+        TopLoc_Location aLoc;
 
-        // preset the index vector size
-        numLines =  lineSetCoords.size();
-        lineset ->coordIndex .setNum(numLines);
-        int32_t* lines = lineset ->coordIndex  .startEditing();
+        // handling of the free edge that are not associated to a face
+        int hash = Part::ShapeMapHasher{}(aEdge);
+        if (faceEdges.find(hash) == faceEdges.end()) {
+            Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
+            if (!aPoly.IsNull()) {
+                if (!aLoc.IsIdentity()) {
+                    identity = false;
+                    myTransf = aLoc.Transformation();
+                }
 
-        int l=0;
-        for (std::vector<int32_t>::const_iterator it=lineSetCoords.begin();it!=lineSetCoords.end();++it,l++)
-            lines[l] = *it;
+                const TColgp_Array1OfPnt& aNodes = aPoly->Nodes();
+                int nbNodesInEdge = aPoly->NbNodes();
+
+                gp_Pnt pnt;
+                for (Standard_Integer j=1;j <= nbNodesInEdge;j++) {
+                    pnt = aNodes(j);
+                    if (!identity)
+                        pnt.Transform(myTransf);
+                    int index = faceNodeOffset+j-1;
+                    verts[index].setValue((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
+                    lineSetMap[i].push_back(index);
+                }
 
-        // end the editing of the nodes
-        coords  ->point       .finishEditing();
-        norm    ->vector      .finishEditing();
-        faceset ->coordIndex  .finishEditing();
-        faceset ->partIndex   .finishEditing();
-        lineset ->coordIndex  .finishEditing();
+                faceNodeOffset += nbNodesInEdge;
+            }
+        }
     }
-    catch (const Standard_Failure& e) {
-        FC_ERR("Cannot compute Inventor representation for the shape of "
-               << pcObject->getFullName() << ": " << e.GetMessageString());
+
+    data->nodeStart = faceNodeOffset;
+    for (int i=0; i<vertexMap.Extent(); i++) {
+        const TopoDS_Vertex& aVertex = TopoDS::Vertex(vertexMap(i+1));
+        gp_Pnt pnt = BRep_Tool::Pnt(aVertex);
+        verts[faceNodeOffset+i].setValue((float)(pnt.X()),(float)(pnt.Y()),(float)(pnt.Z()));
     }
-    catch (...) {
-        FC_ERR("Cannot compute Inventor representation for the shape of " << pcObject->getFullName());
+
+    // normalize all normals
+    for (int i = 0; i< numNorms ;i++)
+        norms[i].normalize();
+
+    for (int i = 0; i < numNodes; i++)
+        data->box.extendBy(verts[i]);
+
+    std::vector<int32_t> lineSetCoords;
+    for (const auto & it : lineSetMap) {
+        lineSetCoords.insert(lineSetCoords.end(), it.second.begin(), it.second.end());
+        lineSetCoords.push_back(-1);
     }
 
+    numLines = lineSetCoords.size();
+    data->lineIndex = std::move(lineSetCoords);
+
 #   ifdef FC_DEBUG
-        // printing some information
-        Base::Console().Log("ViewProvider update time: %f s\n",Base::TimeElapsed::diffTimeF(start_time,Base::TimeElapsed()));
         Base::Console().Log("Shape tria info: Faces:%d Edges:%d Nodes:%d Triangles:%d IdxVec:%d\n",numFaces,numEdges,numNodes,numTriangles,numLines);
 #   else
     (void)numEdges;
+    (void)numLines;
 #   endif
-    VisualTouched = false;
+    return data;
+}
 
-    // The material has to be checked again
-    setHighlightedFaces(ShapeAppearance.getValues());
-    setHighlightedEdges(LineColorArray.getValues());
-    setHighlightedPoints(PointColorArray.getValue());
+void ViewProviderPartExt::onProjectedSize(float pixels)
+{
+    // Called while rendering, so only remember the size of all views and
+    // change the tessellation later on
+    lodProjectedSize = std::max(lodProjectedSize, pixels);
+    bool coarse = lodCoarse ? lodProjectedSize < lodSize : lodProjectedSize < 0.5F * lodSize;
+    if (coarse != lodCoarse && !lodSensor.isScheduled()) {
+        lodSensor.schedule();
+    }
+}
+
+void ViewProviderPartExt::levelOfDetailCB(void * data, SoSensor * sensor)
+{
+    Q_UNUSED(sensor);
+    auto self = static_cast<ViewProviderPartExt*>(data);
+    if (self) {
+        self->applyLevelOfDetail();
+    }
+}
+
+void ViewProviderPartExt::applyLevelOfDetail()
+{
+    float pixels = lodProjectedSize;
+    lodProjectedSize = 0.0F;
+    lodLastProjectedSize = pixels;
+
+    // Keep some hysteresis so that the tessellation doesn't toggle at the threshold
+    bool coarse = lodCoarse ? pixels < lodSize : pixels < 0.5F * lodSize;
+    if (coarse == lodCoarse || VisualTouched || tessellationWatcher) {
+        return;
+    }
+
+    // The selected vertices are identified by their index in the coordinates
+    // which differ between the tessellations
+    if (Gui::Selection().isSelected(getObject())) {
+        return;
+    }
+
+    if (!coarse) {
+        buildVisual(1.0);
+        return;
+    }
+
+    if (!lodCoarseData) {
+        buildVisual(lodFactor);
+        return;
+    }
+
+    clearVisualHighlight();
+    applyTessellation(*lodCoarseData);
+    lodCoarse = true;
+    applyVisualHighlight();
 }
 
 void ViewProviderPartExt::forceUpdate(bool enable) {
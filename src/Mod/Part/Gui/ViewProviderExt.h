@@ -24,6 +24,9 @@
 #define PARTGUI_VIEWPROVIDERPARTEXT_H
 
 #include <map>
+#include <memory>
+
+#include <Inventor/sensors/SoIdleSensor.h>
 
 #include <App/PropertyUnits.h>
 #include <Gui/ViewProviderGeometryObject.h>
@@ -53,6 +56,7 @@ class SoNormal;
 class SoNormalBinding;
 class SoMaterialBinding;
 class SoIndexedLineSet;
+template <typename T> class QFutureWatcher;
 
 namespace PartGui {
 
@@ -163,6 +167,10 @@ protected:
     void onChanged(const App::Property* prop) override;
     bool loadParameter();
     void updateVisual();
+    /// Tessellates the shape with the deflections scaled by \a deflectionFactor
+    void buildVisual(double deflectionFactor);
+    /// Starts tessellating the shape in a worker thread, returns false if it can't be done
+    bool startTessellation(double deflectionFactor);
     void handleChangedPropertyName(Base::XMLReader& reader,
                                    const char* TypeName,
                                    const char* PropName) override;
@@ -188,6 +196,57 @@ protected:
     bool NormalsFromUV;
 
 private:
+    void clearVisualHighlight();
+    void applyVisualHighlight();
+
+    struct Tessellation;
+    /** Tessellates \a shape without touching the scene graph, so it can run in any
+     * thread. The triangulation is stored in \a shape, throws if meshing fails.
+     */
+    static std::shared_ptr<Tessellation> tessellate(TopoDS_Shape shape,
+                                                    double deviation,
+                                                    double angularDeflection,
+                                                    double deflectionFactor,
+                                                    bool normalsFromUV);
+    /// Puts the arrays of \a data into the scene graph
+    void applyTessellation(const Tessellation& data);
+    /// Swaps in the result of the tessellation started by startTessellation()
+    void finishTessellation();
+
+    /** @name Level of detail
+     * If the parameter LevelOfDetailFactor is greater than 1 the shape is first
+     * tessellated with the deflections multiplied by this factor. The coarse
+     * tessellation is kept while the shape covers less than LevelOfDetailSize
+     * pixels on the screen and is refined from an idle sensor once it gets bigger.
+     * Both tessellations have the same faces, edges and vertices, so the element
+     * names used for selection don't change.
+     */
+    //@{
+    void onProjectedSize(float pixels);
+    void applyLevelOfDetail();
+    static void levelOfDetailCB(void * data, SoSensor * sensor);
+
+    double lodFactor;
+    float lodSize;
+    float lodProjectedSize;
+    float lodLastProjectedSize;
+    bool lodCoarse;
+    std::shared_ptr<Tessellation> lodCoarseData;
+    SoIdleSensor lodSensor;
+    //@}
+
+    /** @name Asynchronous tessellation
+     * If the parameter AsyncTessellation is set the shape is tessellated in a
+     * worker thread after it has changed. The previous tessellation stays on the
+     * screen until the new one is swapped in, so the 3D view keeps responding
+     * while several shapes are being tessellated. Forced updates stay synchronous.
+     */
+    //@{
+    bool asyncTessellation;
+    double tessellationFactor = 1.0;
+    std::unique_ptr<QFutureWatcher<std::shared_ptr<Tessellation>>> tessellationWatcher;
+    //@}
+
     Gui::ViewProviderFaceTexture texture;
     // settings stuff
     int forceUpdateCount;
@@ -23,6 +23,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <sstream>
 # include <gp_Dir.hxx>
 # include <BRep_Builder.hxx>
 # include <Mod/Part/App/FCBRepAlgoAPI_Cut.h>
@@ -52,6 +53,7 @@
 #include <Base/Reader.h>
 #include <Base/Stream.h>
 #include <Base/Tools.h>
+#include <Base/Writer.h>
 #include <Mod/Part/App/FaceMakerCheese.h>
 #include <Mod/Part/App/TopoShapeMapper.h>
 #include <Mod/Part/App/TopoShapeOpCode.h>
@@ -2045,15 +2047,28 @@ App::DocumentObjectExecReturn* Hole::execute()
 
         // Make thread
         if (Threaded.getValue() && ModelThread.getValue()) {
-            TopoDS_Shape protoThread = makeThread(xDir, zDir, length);
+            // The helical sweep is expensive, so the threaded hole is kept for as long as the
+            // plain hole and the thread parameters don't change
+            std::string threadKey = getThreadCacheKey(protoHole, xDir, zDir, length);
+            if (!cachedThreadKey.empty() && threadKey == cachedThreadKey) {
+                protoHole = cachedThreadHole;
+            }
+            else {
+                TopoDS_Shape plainHole = protoHole;
+                TopoDS_Shape protoThread = makeThread(xDir, zDir, length);
 
-            // fuse the thread to the hole
-            FCBRepAlgoAPI_Fuse mkFuse(protoHole, protoThread);
-            if (!mkFuse.IsDone())
-                return new App::DocumentObjectExecReturn(QT_TRANSLATE_NOOP("Exception", "Error: Adding the thread failed"));
+                // fuse the thread to the hole
+                FCBRepAlgoAPI_Fuse mkFuse(protoHole, protoThread);
+                if (!mkFuse.IsDone())
+                    return new App::DocumentObjectExecReturn(QT_TRANSLATE_NOOP("Exception", "Error: Adding the thread failed"));
 
-            // we reuse the name protoHole (only now it is threaded)
-            protoHole = mkFuse.Shape();
+                // we reuse the name protoHole (only now it is threaded)
+                protoHole = mkFuse.Shape();
+
+                // makeThread() may have updated ThreadDepth, so take the key again
+                cachedThreadKey = getThreadCacheKey(plainHole, xDir, zDir, length);
+                cachedThreadHole = protoHole;
+            }
         }
         std::vector<TopoShape> holes;
         auto compound = findHoles(holes, profileshape, protoHole);
@@ -2204,6 +2219,7 @@ TopoShape Hole::findHoles(std::vector<TopoShape> &holes,
                           const TopoDS_Shape& protoHole) const
 {
     TopoShape result(0);
+    std::vector<TopoShape> protoFaces = TopoShape(protoHole).getSubTopoShapes(TopAbs_FACE);
 
     int i = 0;
     for(const auto &profileEdge : profileshape.getSubTopoShapes(TopAbs_EDGE)) {
@@ -2226,7 +2242,7 @@ TopoShape Hole::findHoles(std::vector<TopoShape> &holes,
                                                   gp_Pnt(loc.X(), loc.Y(), loc.Z()) );
 
         Part::ShapeMapper mapper;
-        mapper.populate(Part::MappingStatus::Modified, profileEdge, TopoShape(protoHole).getSubTopoShapes(TopAbs_FACE));
+        mapper.populate(Part::MappingStatus::Modified, profileEdge, protoFaces);
 
         TopoShape hole(-getID());
         hole.makeShapeWithElementMap(protoHole, mapper, {profileEdge});
@@ -2238,6 +2254,29 @@ TopoShape Hole::findHoles(std::vector<TopoShape> &holes,
     return TopoShape().makeElementCompound(holes);
 }
 
+std::string Hole::getThreadCacheKey(const TopoDS_Shape& protoHole,
+                                    const gp_Vec& xDir,
+                                    const gp_Vec& zDir,
+                                    double length) const
+{
+    std::ostringstream str;
+    str.precision(17);
+    TopoShape(protoHole).exportBrep(str);
+    str << xDir.X() << ' ' << xDir.Y() << ' ' << xDir.Z() << ' ' << zDir.X() << ' ' << zDir.Y()
+        << ' ' << zDir.Z() << ' ' << length << '\n';
+
+    const App::Property* props[] = {&ThreadPitch, &ThreadType, &ThreadSize, &ThreadClass,
+                                    &ThreadFit, &Diameter, &ThreadDirection, &DepthType, &Depth,
+                                    &ThreadDepthType, &ThreadDepth, &Tapered, &TaperedAngle,
+                                    &UseCustomThreadClearance, &CustomThreadClearance};
+    for (auto prop : props) {
+        Base::StringWriter writer;
+        prop->Save(writer);
+        str << writer.getString();
+    }
+    return str.str();
+}
+
 TopoDS_Shape Hole::makeThread(const gp_Vec& xDir, const gp_Vec& zDir, double length)
 {
     int threadType = ThreadType.getValue();
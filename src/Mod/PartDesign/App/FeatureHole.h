@@ -234,12 +234,19 @@ private:
     void rotateToNormal(const gp_Dir& helixAxis, const gp_Dir& normalAxis, TopoDS_Shape& helixShape) const;
     gp_Vec computePerpendicular(const gp_Vec&) const;
     TopoDS_Shape makeThread(const gp_Vec&, const gp_Vec&, double);
+    /// Returns a key that identifies the threaded hole made from \a protoHole
+    std::string getThreadCacheKey(const TopoDS_Shape& protoHole, const gp_Vec& xDir,
+                                  const gp_Vec& zDir, double length) const;
     TopoShape findHoles(std::vector<TopoShape> &holes, const TopoShape& profileshape, const TopoDS_Shape& protohole) const;
 
     // helpers for nlohmann json
     friend void from_json(const nlohmann::json &j, CounterBoreDimension &t);
     friend void from_json(const nlohmann::json &j, CounterSinkDimension &t);
     friend void from_json(const nlohmann::json &j, CutDimensionSet &t);
+
+    /// The threaded hole of the last execute and the key of its inputs
+    std::string cachedThreadKey;
+    TopoDS_Shape cachedThreadHole;
 };
 
 } //namespace PartDesign
@@ -29,10 +29,12 @@
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Copy.hxx>
 #include <BRepBuilderAPI_Transform.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <TopExp_Explorer.hxx>
 #endif
 
+#include <algorithm>
 #include <array>
 
 #include <Base/Console.h>
@@ -176,6 +178,75 @@ bool Transformed::isMultiTransformChild() const
     return false;
 }
 
+/** Returns true if the bounding boxes of any two of the shapes, starting at \a first, overlap.
+ * The boxes are computed in parallel and compared after sorting them along the X axis.
+ */
+static bool haveOverlappingBounds(const std::vector<TopoShape>& shapes, std::size_t first)
+{
+    if (shapes.size() < first + 2) {
+        return false;
+    }
+
+    std::vector<Bnd_Box> boxes(shapes.size() - first);
+    OSD_Parallel::For(0, static_cast<int>(boxes.size()), [&](int i) {
+        BRepBndLib::Add(shapes[first + i].getShape(), boxes[i]);
+        boxes[i].Enlarge(Precision::Confusion());
+    });
+
+    auto eraseIter = std::remove_if(boxes.begin(), boxes.end(), [](const Bnd_Box& box) {
+        return box.IsVoid();
+    });
+    boxes.erase(eraseIter, boxes.end());
+    std::sort(boxes.begin(), boxes.end(), [](const Bnd_Box& box1, const Bnd_Box& box2) {
+        return box1.CornerMin().X() < box2.CornerMin().X();
+    });
+
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+        double xmax = boxes[i].CornerMax().X();
+        for (std::size_t j = i + 1; j < boxes.size() && boxes[j].CornerMin().X() <= xmax; ++j) {
+            if (!boxes[i].IsOut(boxes[j])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/** Applies the boolean \a maker to the support, which is the first shape, and all transformed
+ * copies in one go. This is much faster than one boolean per instance for large patterns. If the
+ * batched boolean fails, or gives an invalid result while the copies overlap each other, the
+ * copies are applied one by one instead, which is slower but more forgiving.
+ */
+static TopoShape makeTransformedBoolean(const char* maker, const std::vector<TopoShape>& shapes)
+{
+    bool overlapping = haveOverlappingBounds(shapes, 1);
+
+    TopoShape result(shapes.front());
+    try {
+        result.makeElementBoolean(maker, shapes);
+        if (!result.isNull() && (!overlapping || result.isValid())) {
+            return result;
+        }
+        Base::Console().Log("Transformed: batched %s gave an invalid shape, "
+                            "applying the instances one by one\n", maker);
+    }
+    catch (const Standard_Failure& e) {
+        Base::Console().Log("Transformed: batched %s failed (%s), "
+                            "applying the instances one by one\n", maker, e.GetMessageString());
+    }
+    catch (const Base::Exception& e) {
+        Base::Console().Log("Transformed: batched %s failed (%s), "
+                            "applying the instances one by one\n", maker, e.what());
+    }
+
+    result = shapes.front();
+    for (auto it = shapes.begin() + 1; it != shapes.end(); ++it) {
+        result = TopoShape(0, result.Hasher)
+                     .makeElementBoolean(maker, std::vector<TopoShape> {result, *it});
+    }
+    return result;
+}
+
 void Transformed::handleChangedPropertyType(Base::XMLReader& reader,
                                             const char* TypeName,
                                             App::Property* prop)
@@ -327,15 +398,21 @@ App::DocumentObjectExecReturn* Transformed::execute()
                     cutShape = cutShape.makeElementTransform(trsf);
                 }
                 if (!fuseShape.isNull()) {
-                    supportShape.makeElementFuse(getTransformedCompShape(supportShape, fuseShape));
+                    supportShape = makeTransformedBoolean(
+                        Part::OpCodes::Fuse,
+                        getTransformedCompShape(supportShape, fuseShape));
                 }
                 if (!cutShape.isNull()) {
-                    supportShape.makeElementCut(getTransformedCompShape(supportShape, cutShape));
+                    supportShape = makeTransformedBoolean(
+                        Part::OpCodes::Cut,
+                        getTransformedCompShape(supportShape, cutShape));
                 }
             }
             break;
         case Mode::TransformBody: {
-            supportShape.makeElementFuse(getTransformedCompShape(supportShape, supportShape));
+            supportShape = makeTransformedBoolean(
+                Part::OpCodes::Fuse,
+                getTransformedCompShape(supportShape, supportShape));
             break;
         }
     }
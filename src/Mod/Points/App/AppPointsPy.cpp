@@ -39,6 +39,7 @@
 #include "PointsPy.h"
 #include "Properties.h"
 #include "Structured.h"
+#include "Tools.h"
 
 
 namespace Points
@@ -56,6 +57,12 @@ public:
                            &Module::show,
                            "show(points,[string]) -- Add the points to the active document or "
                            "create one if no document exists.  Returns document object.");
+        add_varargs_method("getPropertyArray",
+                           &Module::getPropertyArray,
+                           "getPropertyArray(object, name) -- Return the values of the grey value, "
+                           "normal or curvature property name of object as array of floats.\n"
+                           "The array has one, three or eight columns. numpy.asarray() accepts it "
+                           "without copying.");
         initialize("This module is the Points module.");  // register with Python
     }
 
@@ -348,7 +355,17 @@ private:
                         writer = std::make_unique<PlyWriter>(kernel);
                     }
                     else if (file.hasExtension("pcd")) {
-                        writer = std::make_unique<PcdWriter>(kernel);
+                        auto pcd = std::make_unique<PcdWriter>(kernel);
+                        auto hGrp(App::GetApplication().GetParameterGroupByPath(
+                            "User parameter:BaseApp/Preferences/Mod/Points"));
+                        std::string format = hGrp->GetASCII("PcdFormat", "binary");
+                        if (format == "binary") {
+                            pcd->setFormat(PcdWriter::Format::Binary);
+                        }
+                        else if (format == "binary_compressed") {
+                            pcd->setFormat(PcdWriter::Format::BinaryCompressed);
+                        }
+                        writer = std::move(pcd);
                     }
                     else {
                         throw Py::RuntimeError("Unsupported file extension");
@@ -426,6 +443,37 @@ private:
 
         return Py::None();
     }
+
+    Py::Object getPropertyArray(const Py::Tuple& args)
+    {
+        PyObject* pcObj {};
+        const char* name {};
+        if (!PyArg_ParseTuple(args.ptr(), "O!s", &(App::DocumentObjectPy::Type), &pcObj, &name)) {
+            throw Py::Exception();
+        }
+
+        App::DocumentObject* obj =
+            static_cast<App::DocumentObjectPy*>(pcObj)->getDocumentObjectPtr();
+        App::Property* prop = obj->getPropertyByName(name);
+        if (auto grey = dynamic_cast<PropertyGreyValueList*>(prop)) {
+            const std::vector<float>& values = grey->getValues();
+            return toArray(values.data(), values.size(), 1);
+        }
+        if (auto normals = dynamic_cast<PropertyNormalList*>(prop)) {
+            const std::vector<Base::Vector3f>& values = normals->getValues();
+            auto coords = reinterpret_cast<const float*>(values.data());  // NOLINT
+            return toArray(coords, values.size(), 3);
+        }
+        if (auto curvature = dynamic_cast<PropertyCurvatureList*>(prop)) {
+            // the curvatures are followed by the two directions
+            static_assert(sizeof(CurvatureInfo) == 8 * sizeof(float));
+            const std::vector<CurvatureInfo>& values = curvature->getValues();
+            auto items = reinterpret_cast<const float*>(values.data());  // NOLINT
+            return toArray(items, values.size(), 8);
+        }
+
+        throw Py::TypeError(std::string("No grey value, normal or curvature property ") + name);
+    }
 };
 
 PyObject* initModule()
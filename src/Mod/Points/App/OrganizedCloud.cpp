@@ -0,0 +1,320 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <QFile>
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "OrganizedCloud.h"
+
+
+#ifdef _MSC_VER
+#include <ppl.h>
+#endif
+
+
+using namespace Points;
+
+namespace
+{
+bool isValidPoint(const Base::Vector3f& pnt)
+{
+    return !std::isnan(pnt.x) && !std::isnan(pnt.y) && !std::isnan(pnt.z);
+}
+}  // namespace
+
+OrganizedCloud::OrganizedCloud() = default;
+
+OrganizedCloud::OrganizedCloud(int width, int height)
+    : OrganizedCloud(width,
+                     height,
+                     std::vector<value_type>(std::size_t(std::max(width, 0))
+                                                 * std::size_t(std::max(height, 0)),
+                                             value_type(std::nanf(""), std::nanf(""), std::nanf(""))))
+{}
+
+OrganizedCloud::OrganizedCloud(int width, int height, std::vector<value_type>&& points)
+    : width(width)
+    , height(height)
+    , owned(std::move(points))
+{
+    if (width < 0 || height < 0 || owned.size() != size()) {
+        throw Base::ValueError("(Width * Height) doesn't match with number of points");
+    }
+    this->points = owned.data();
+    this->writable = owned.data();
+}
+
+OrganizedCloud::OrganizedCloud(int width, int height, const PointKernel& kernel)
+    : width(width)
+    , height(height)
+{
+    if (width < 0 || height < 0 || kernel.size() != size()) {
+        throw Base::ValueError("(Width * Height) doesn't match with number of points");
+    }
+    this->points = kernel.getBasicPoints().data();
+}
+
+OrganizedCloud::~OrganizedCloud() = default;
+
+OrganizedCloud::OrganizedCloud(OrganizedCloud&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+OrganizedCloud& OrganizedCloud::operator=(OrganizedCloud&& other) noexcept
+{
+    if (this != &other) {
+        // moving the vector keeps its buffer, so the pointers stay valid
+        width = std::exchange(other.width, 0);
+        height = std::exchange(other.height, 0);
+        points = std::exchange(other.points, nullptr);
+        writable = std::exchange(other.writable, nullptr);
+        owned = std::move(other.owned);
+        other.owned.clear();
+        file = std::move(other.file);
+    }
+    return *this;
+}
+
+OrganizedCloud OrganizedCloud::mapFile(const std::string& file,
+                                       int width,
+                                       int height,
+                                       uint64_t offset,
+                                       bool writable)
+{
+    if (width < 0 || height < 0) {
+        throw Base::ValueError("Negative size of organized cloud");
+    }
+
+    OrganizedCloud cloud;
+    cloud.width = width;
+    cloud.height = height;
+    if (cloud.empty()) {
+        return cloud;
+    }
+
+    Base::FileInfo fi(file);
+    cloud.file = std::make_unique<QFile>(QString::fromStdString(fi.filePath()));
+    if (!cloud.file->open(writable ? QIODevice::ReadWrite : QIODevice::ReadOnly)) {
+        throw Base::FileException("Cannot open file", fi);
+    }
+
+    uint64_t bytes = cloud.size() * sizeof(value_type);
+    if (uint64_t(cloud.file->size()) < offset + bytes) {
+        throw Base::FileException("File contains too few points", fi);
+    }
+
+    uchar* data = cloud.file->map(qint64(offset), qint64(bytes));
+    if (!data) {
+        throw Base::FileException("Cannot map file", fi);
+    }
+
+    // Base::Vector3f is a plain triple of floats
+    static_assert(sizeof(value_type) == 3 * sizeof(float), "Unexpected size of points");
+    cloud.points = reinterpret_cast<value_type*>(data);  // NOLINT
+    if (writable) {
+        cloud.writable = reinterpret_cast<value_type*>(data);  // NOLINT
+    }
+    return cloud;
+}
+
+void OrganizedCloud::save(const std::string& file) const
+{
+    Base::FileInfo fi(file);
+    Base::ofstream out(fi, std::ios::out | std::ios::binary);
+    if (!out) {
+        throw Base::FileException("Cannot open file", fi);
+    }
+    out.write(reinterpret_cast<const char*>(points),  // NOLINT
+              static_cast<std::streamsize>(size() * sizeof(value_type)));
+}
+
+bool OrganizedCloud::isMapped() const
+{
+    return file != nullptr;
+}
+
+OrganizedCloud::value_type* OrganizedCloud::writableData()
+{
+    if (!writable && !empty()) {
+        throw Base::RuntimeError("Points of organized cloud are read-only");
+    }
+    return writable;
+}
+
+bool OrganizedCloud::isValid(int col, int row) const
+{
+    if (col < 0 || row < 0 || col >= width || row >= height) {
+        return false;
+    }
+    return isValidPoint((*this)(col, row));
+}
+
+void OrganizedCloud::getNeighbours(int col,
+                                   int row,
+                                   int radius,
+                                   std::vector<value_type>& neighbours) const
+{
+    int minRow = std::max(row - radius, 0);
+    int maxRow = std::min(row + radius, height - 1);
+    int minCol = std::max(col - radius, 0);
+    int maxCol = std::min(col + radius, width - 1);
+    for (int r = minRow; r <= maxRow; r++) {
+        for (int c = minCol; c <= maxCol; c++) {
+            if (c == col && r == row) {
+                continue;
+            }
+            const value_type& pnt = (*this)(c, r);
+            if (isValidPoint(pnt)) {
+                neighbours.push_back(pnt);
+            }
+        }
+    }
+}
+
+std::vector<OrganizedCloud::value_type> OrganizedCloud::estimateNormals() const
+{
+    std::vector<value_type> normals(size());
+
+    // uses the central difference if possible, otherwise the one-sided difference
+    auto difference = [this](int c0, int r0, int c1, int r1, int c, int r, value_type& diff) {
+        bool prev = isValid(c0, r0);
+        bool next = isValid(c1, r1);
+        if (prev && next) {
+            diff = (*this)(c1, r1) - (*this)(c0, r0);
+        }
+        else if (next) {
+            diff = (*this)(c1, r1) - (*this)(c, r);
+        }
+        else if (prev) {
+            diff = (*this)(c, r) - (*this)(c0, r0);
+        }
+        return prev || next;
+    };
+
+    auto estimateRow = [&](int row) {
+        for (int col = 0; col < width; col++) {
+            if (!isValid(col, row)) {
+                continue;
+            }
+
+            value_type dx;
+            value_type dy;
+            if (!difference(col - 1, row, col + 1, row, col, row, dx)
+                || !difference(col, row - 1, col, row + 1, col, row, dy)) {
+                continue;
+            }
+
+            value_type normal = dx % dy;
+            if (normal.Length() == 0.0F) {
+                continue;
+            }
+            normal.Normalize();
+            // orientate towards the camera
+            if (normal * (*this)(col, row) > 0.0F) {
+                normal = -normal;
+            }
+            normals[std::size_t(row) * width + col] = normal;
+        }
+    };
+
+    std::vector<int> rows(height);
+    std::iota(rows.begin(), rows.end(), 0);
+#ifdef _MSC_VER
+    Concurrency::parallel_for_each(rows.begin(), rows.end(), estimateRow);
+#else
+    QtConcurrent::blockingMap(rows, estimateRow);
+#endif
+    return normals;
+}
+
+void OrganizedCloud::triangulate(float maxEdgeLength, std::vector<uint32_t>& indices) const
+{
+    if (size() > std::numeric_limits<uint32_t>::max()) {
+        throw Base::ValueError("Too many points to triangulate");
+    }
+
+    float maxLength2 = maxEdgeLength * maxEdgeLength;
+    auto addTriangle = [&](uint32_t p0, uint32_t p1, uint32_t p2) {
+        const value_type& v0 = points[p0];
+        const value_type& v1 = points[p1];
+        const value_type& v2 = points[p2];
+        if (Base::DistanceP2(v0, v1) <= maxLength2 && Base::DistanceP2(v1, v2) <= maxLength2
+            && Base::DistanceP2(v2, v0) <= maxLength2) {
+            indices.push_back(p0);
+            indices.push_back(p1);
+            indices.push_back(p2);
+        }
+    };
+
+    for (int row = 0; row + 1 < height; row++) {
+        for (int col = 0; col + 1 < width; col++) {
+            // the corners of the cell in counter-clockwise order
+            uint32_t index = uint32_t(row) * uint32_t(width) + uint32_t(col);
+            std::array<uint32_t, 4> corner {index,
+                                            index + 1,
+                                            index + uint32_t(width) + 1,
+                                            index + uint32_t(width)};
+            std::array<bool, 4> valid {};
+            int numValid = 0;
+            for (std::size_t i = 0; i < 4; i++) {
+                valid[i] = isValidPoint(points[corner[i]]);
+                numValid += valid[i] ? 1 : 0;
+            }
+
+            if (numValid == 4) {
+                addTriangle(corner[0], corner[1], corner[3]);
+                addTriangle(corner[1], corner[2], corner[3]);
+            }
+            else if (numValid == 3) {
+                std::array<uint32_t, 3> tria {};
+                std::size_t num = 0;
+                for (std::size_t i = 0; i < 4; i++) {
+                    if (valid[i]) {
+                        tria[num++] = corner[i];
+                    }
+                }
+                addTriangle(tria[0], tria[1], tria[2]);
+            }
+        }
+    }
+}
+
+void OrganizedCloud::toKernel(PointKernel& kernel) const
+{
+    kernel.resize(size());
+    std::copy(points, points + size(), kernel.getBasicPoints().begin());
+}
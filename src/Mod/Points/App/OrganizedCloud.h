@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+
+#ifndef POINTS_ORGANIZEDCLOUD_H
+#define POINTS_ORGANIZEDCLOUD_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Base/Vector3D.h>
+
+#include "Points.h"
+
+class QFile;
+
+namespace Points
+{
+
+/**
+ * The OrganizedCloud is a point cloud of Width*Height points that are ordered
+ * row by row like the pixels of the depth image they were taken from. Invalid
+ * points have NaN coordinates. Unlike a PointKernel the grid layout is kept so
+ * that the neighbours of a point are found in constant time.
+ *
+ * The points are either owned by the cloud, borrowed from a PointKernel or
+ * mapped from a file of raw float triples. Neither of the last two copies any
+ * data, so a whole series of camera frames can be processed without loading
+ * them into memory.
+ */
+class PointsExport OrganizedCloud
+{
+public:
+    using value_type = Base::Vector3f;
+
+    /// Creates an empty cloud.
+    OrganizedCloud();
+    /// Creates a cloud of \a width * \a height invalid points.
+    OrganizedCloud(int width, int height);
+    /// Takes over the \a points which must have the size \a width * \a height.
+    OrganizedCloud(int width, int height, std::vector<value_type>&& points);
+    /** Creates a view to the points of \a kernel without copying them. The kernel
+     * must outlive the cloud and must not be resized in the meantime.
+     */
+    OrganizedCloud(int width, int height, const PointKernel& kernel);
+    ~OrganizedCloud();
+
+    OrganizedCloud(const OrganizedCloud&) = delete;
+    OrganizedCloud(OrganizedCloud&&) noexcept;
+    OrganizedCloud& operator=(const OrganizedCloud&) = delete;
+    OrganizedCloud& operator=(OrganizedCloud&&) noexcept;
+
+    /** @name Memory-mapped files */
+    //@{
+    /** Maps \a width * \a height points from \a file starting at byte \a offset.
+     * The file is expected to contain three little-endian floats per point. If
+     * \a writable is true changes to the points are written through to the file.
+     * Throws a Base::FileException if the file cannot be mapped.
+     */
+    static OrganizedCloud
+    mapFile(const std::string& file, int width, int height, uint64_t offset = 0, bool writable = false);
+    /// Writes the points as raw float triples that can be mapped by mapFile().
+    void save(const std::string& file) const;
+    /// Returns true if the points are mapped from a file.
+    bool isMapped() const;
+    //@}
+
+    /** @name Grid access */
+    //@{
+    int getWidth() const
+    {
+        return width;
+    }
+    int getHeight() const
+    {
+        return height;
+    }
+    std::size_t size() const
+    {
+        return std::size_t(width) * std::size_t(height);
+    }
+    bool empty() const
+    {
+        return size() == 0;
+    }
+    /// Returns true if the points can be modified.
+    bool isWritable() const
+    {
+        return writable != nullptr;
+    }
+    const value_type* data() const
+    {
+        return points;
+    }
+    /// Returns the writable points, throws a Base::RuntimeError for a read-only cloud.
+    value_type* writableData();
+    /// Returns the point in column \a col and row \a row.
+    const value_type& operator()(int col, int row) const
+    {
+        return points[std::size_t(row) * width + col];
+    }
+    /// Returns true if the grid position is inside the cloud and its point is valid.
+    bool isValid(int col, int row) const;
+    /** Appends the valid points of the (2 * \a radius + 1)^2 window around the given
+     * grid position, except the point itself, to \a neighbours.
+     */
+    void getNeighbours(int col, int row, int radius, std::vector<value_type>& neighbours) const;
+    //@}
+
+    /** @name Algorithms */
+    //@{
+    /** Estimates the normal of a point by the cross product of the central
+     * differences of its horizontal and vertical neighbours. The normals point
+     * towards the origin, i.e. the camera of the frame. Invalid points or points
+     * without enough valid neighbours get a null vector.
+     */
+    std::vector<value_type> estimateNormals() const;
+    /** Triangulates the grid: every cell of four neighbouring points is split into
+     * two triangles whose points are valid and whose edges are not longer than
+     * \a maxEdgeLength. The point indices of the triangles are appended to \a indices.
+     */
+    void triangulate(float maxEdgeLength, std::vector<uint32_t>& indices) const;
+    /// Copies the points to \a kernel.
+    void toKernel(PointKernel& kernel) const;
+    //@}
+
+private:
+    int width {0};
+    int height {0};
+    const value_type* points {nullptr};
+    value_type* writable {nullptr};
+    std::vector<value_type> owned;
+    std::unique_ptr<QFile> file;
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_ORGANIZEDCLOUD_H
@@ -23,6 +23,7 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <QtConcurrentMap>
+#include <algorithm>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <cmath>
 #include <iostream>
@@ -84,18 +85,20 @@ Data::Segment* PointKernel::getSubElement(const char* /*Type*/, unsigned long /*
 void PointKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
     std::vector<value_type>& kernel = getBasicPoints();
+    // Transform blocks of points so that each task runs the vectorized batch kernel
+    const std::size_t blockSize = 8192;
+    std::vector<std::size_t> blocks;
+    for (std::size_t index = 0; index < kernel.size(); index += blockSize) {
+        blocks.push_back(index);
+    }
+    auto transformBlock = [&kernel, &rclMat, blockSize](std::size_t& start) {
+        std::size_t count = std::min(blockSize, kernel.size() - start);
+        rclMat.multVec(&kernel[start], &kernel[start], count);
+    };
 #ifdef _MSC_VER
-    // Win32-only at the moment since ppl.h is a Microsoft library. Points is not using Qt so we
-    // cannot use QtConcurrent We could also rewrite Points to leverage SIMD instructions Other
-    // option: openMP. But with VC2013 results in high CPU usage even after computation (busy-waits
-    // for >100ms)
-    Concurrency::parallel_for_each(kernel.begin(), kernel.end(), [rclMat](value_type& value) {
-        value = rclMat * value;
-    });
+    Concurrency::parallel_for_each(blocks.begin(), blocks.end(), transformBlock);
 #else
-    QtConcurrent::blockingMap(kernel, [rclMat](value_type& value) {
-        rclMat.multVec(value, value);
-    });
+    QtConcurrent::blockingMap(blocks, transformBlock);
 #endif
 }
 
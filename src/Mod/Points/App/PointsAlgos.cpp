@@ -246,90 +246,6 @@ public:
 
 using ConverterPtr = std::shared_ptr<Converter>;
 
-class DataStreambuf: public std::streambuf
-{
-public:
-    explicit DataStreambuf(const std::vector<char>& data)
-        : _buffer(data)
-        , _end(int(data.size()))
-    {}
-    ~DataStreambuf() override = default;
-
-protected:
-    int_type uflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur++]) & 0x000000ff;
-    }
-    int_type underflow() override
-    {
-        if (_cur == _end) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[_cur]) & 0x000000ff;
-    }
-    int_type pbackfail(int_type ch) override
-    {
-        if (_cur == _beg || (ch != traits_type::eof() && ch != _buffer[_cur - 1])) {
-            return traits_type::eof();
-        }
-
-        return static_cast<DataStreambuf::int_type>(_buffer[--_cur]) & 0x000000ff;
-    }
-    std::streamsize showmanyc() override
-    {
-        return _end - _cur;
-    }
-    pos_type seekoff(std::streambuf::off_type off,
-                     std::ios_base::seekdir way,
-                     std::ios_base::openmode mode = std::ios::in | std::ios::out) override
-    {
-        (void)mode;
-        int p_pos = -1;
-        if (way == std::ios_base::beg) {
-            p_pos = _beg;
-        }
-        else if (way == std::ios_base::end) {
-            p_pos = _end;
-        }
-        else if (way == std::ios_base::cur) {
-            p_pos = _cur;
-        }
-
-        if (p_pos > _end) {
-            return traits_type::eof();
-        }
-
-        if (((p_pos + off) > _end) || ((p_pos + off) < _beg)) {
-            return traits_type::eof();
-        }
-
-        _cur = p_pos + off;
-
-        return ((p_pos + off) - _beg);
-    }
-    pos_type seekpos(std::streambuf::pos_type pos,
-                     std::ios_base::openmode which = std::ios::in | std::ios::out) override
-    {
-        (void)which;
-        return seekoff(pos, std::ios_base::beg);
-    }
-
-public:
-    DataStreambuf(const DataStreambuf&) = delete;
-    DataStreambuf(DataStreambuf&&) = delete;
-    DataStreambuf& operator=(const DataStreambuf&) = delete;
-    DataStreambuf& operator=(DataStreambuf&&) = delete;
-
-private:
-    const std::vector<char>& _buffer;
-    int _beg {0}, _end {0}, _cur {0};
-};
-
 // NOLINTBEGIN
 // Taken from https://github.com/PointCloudLibrary/pcl/blob/master/io/src/lzf.cpp
 unsigned int
@@ -540,6 +456,108 @@ lzfDecompress(const void* const in_data, unsigned int in_len, void* out_data, un
 
     return (static_cast<unsigned int>(op - static_cast<unsigned char*>(out_data)));
 }
+
+// Compresses the input to the LZF format understood by lzfDecompress. Returns
+// the size of the compressed data or 0 if it doesn't fit into the output buffer.
+unsigned int
+lzfCompress(const void* const in_data, unsigned int in_len, void* out_data, unsigned int out_len)
+{
+    const unsigned int hash_log = 14;
+    const unsigned int max_lit = (1 << 5);
+    const unsigned int max_off = (1 << 13);
+    const unsigned int max_ref = (1 << 8) + (1 << 3);
+
+    unsigned char const* const ip = static_cast<const unsigned char*>(in_data);
+    unsigned char* op = static_cast<unsigned char*>(out_data);
+    unsigned char* const out_end = op + out_len;
+
+    // the positions of the last occurrence of a three byte sequence, plus one
+    std::vector<unsigned int> htab(1 << hash_log, 0);
+    auto hash = [ip](unsigned int pos) {
+        unsigned int v = (ip[pos] << 16) | (ip[pos + 1] << 8) | ip[pos + 2];
+        return ((v * 2654435761U) >> (32 - hash_log)) & ((1 << hash_log) - 1);
+    };
+
+    // every literal run is preceded by its length
+    unsigned int lit = 0;
+    if (op >= out_end) {
+        return (0);
+    }
+    op++;
+
+    unsigned int pos = 0;
+    while (pos < in_len) {
+        if (pos + 2 < in_len) {
+            unsigned int h = hash(pos);
+            unsigned int ref = htab[h];
+            htab[h] = pos + 1;
+            if (ref > 0 && pos - ref < max_off && ip[ref - 1] == ip[pos]
+                && ip[ref] == ip[pos + 1] && ip[ref + 1] == ip[pos + 2]) {
+                ref--;
+                unsigned int off = pos - ref - 1;
+                unsigned int max_len = std::min(in_len - pos, max_ref);
+                unsigned int len = 3;
+                while (len < max_len && ip[ref + len] == ip[pos + len]) {
+                    len++;
+                }
+
+                // back reference plus the length of the next literal run
+                if (op + 4 > out_end) {
+                    return (0);
+                }
+                if (lit > 0) {
+                    op[-static_cast<int>(lit) - 1] = static_cast<unsigned char>(lit - 1);
+                    lit = 0;
+                }
+                else {
+                    op--;
+                }
+
+                len -= 2;
+                if (len < 7) {
+                    *op++ = static_cast<unsigned char>((off >> 8) + (len << 5));
+                }
+                else {
+                    *op++ = static_cast<unsigned char>((off >> 8) + (7 << 5));
+                    *op++ = static_cast<unsigned char>(len - 7);
+                }
+                *op++ = static_cast<unsigned char>(off);
+                op++;
+
+                unsigned int end = pos + len + 2;
+                for (pos++; pos < end; pos++) {
+                    if (pos + 2 < in_len) {
+                        htab[hash(pos)] = pos + 1;
+                    }
+                }
+                continue;
+            }
+        }
+
+        // Literal
+        if (op >= out_end) {
+            return (0);
+        }
+        *op++ = ip[pos++];
+        if (++lit == max_lit) {
+            op[-static_cast<int>(lit) - 1] = static_cast<unsigned char>(lit - 1);
+            lit = 0;
+            if (op >= out_end) {
+                return (0);
+            }
+            op++;
+        }
+    }
+
+    if (lit > 0) {
+        op[-static_cast<int>(lit) - 1] = static_cast<unsigned char>(lit - 1);
+    }
+    else {
+        op--;
+    }
+
+    return (static_cast<unsigned int>(op - static_cast<unsigned char*>(out_data)));
+}
 }  // namespace Points
 // NOLINTEND
 
@@ -1021,6 +1039,86 @@ void PlyReader::readBinary(bool swapByteOrder,
 
 PcdReader::PcdReader() = default;
 
+namespace
+{
+/// Describes where the values of a PCD field are stored in memory
+struct PcdField
+{
+    const char* data {nullptr};
+    std::size_t stride {0};
+    char type {'F'};
+    int size {4};
+};
+
+/** Calls \a func with the index and the value of every point of \a field.
+ * The type of the field is resolved only once, so the values are copied with a
+ * tight loop over the raw data.
+ */
+template<typename Func>
+void forEachValue(const PcdField& field, std::size_t numPoints, Func func)
+{
+    auto loop = [&](auto tag) {
+        using T = decltype(tag);
+        const char* ptr = field.data;
+        for (std::size_t i = 0; i < numPoints; i++, ptr += field.stride) {
+            T value {};
+            std::memcpy(&value, ptr, sizeof(T));
+            func(i, value);
+        }
+    };
+
+    char t = field.type;
+    switch (field.size) {
+        case 1:
+            if (t == 'I') {
+                loop(int8_t {});
+            }
+            else if (t == 'U') {
+                loop(uint8_t {});
+            }
+            else {
+                throw Base::BadFormatError("Unexpected type");
+            }
+            break;
+        case 2:
+            if (t == 'I') {
+                loop(int16_t {});
+            }
+            else if (t == 'U') {
+                loop(uint16_t {});
+            }
+            else {
+                throw Base::BadFormatError("Unexpected type");
+            }
+            break;
+        case 4:
+            if (t == 'I') {
+                loop(int32_t {});
+            }
+            else if (t == 'U') {
+                loop(uint32_t {});
+            }
+            else if (t == 'F') {
+                loop(float {});
+            }
+            else {
+                throw Base::BadFormatError("Unexpected type");
+            }
+            break;
+        case 8:
+            if (t == 'F') {
+                loop(double {});
+            }
+            else {
+                throw Base::BadFormatError("Unexpected type");
+            }
+            break;
+        default:
+            throw Base::BadFormatError("Unexpected type");
+    }
+}
+}  // namespace
+
 void PcdReader::read(const std::string& filename)
 {
     clear();
@@ -1034,154 +1132,130 @@ void PcdReader::read(const std::string& filename)
     std::vector<std::string> fields;
     std::vector<std::string> types;
     std::vector<int> sizes;
-    Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
-
-    Eigen::MatrixXd data(numPoints, fields.size());
+    std::vector<int> counts;
+    std::size_t numPoints = readHeader(inp, format, fields, types, sizes, counts);
+
+    // a field may consist of several values of which only the first is used
+    std::size_t numValues = 0;
+    std::size_t pointSize = 0;
+    for (std::size_t j = 0; j < fields.size(); j++) {
+        numValues += counts[j];
+        pointSize += std::size_t(sizes[j]) * counts[j];
+    }
+
+    // The binary data is used as is: it is stored point by point while the
+    // decompressed data is stored field by field.
+    Eigen::MatrixXd data;
+    std::vector<char> buffer;
+    std::vector<PcdField> columns;
     if (format == "ascii") {
+        data.resize(Eigen::Index(numPoints), Eigen::Index(numValues));
         readAscii(inp, data);
-    }
-    else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
-    }
-    else if (format == "binary_compressed") {
-        unsigned int c {};
-        unsigned int u {};
-        Base::InputStream str(inp);
-        str >> c >> u;
-
-        std::vector<char> compressed(c);
-        inp.read(compressed.data(), c);
-        std::vector<char> uncompressed(u);
-        if (lzfDecompress(compressed.data(), c, uncompressed.data(), u) == u) {
-            DataStreambuf ibuf(uncompressed);
-            std::istream istr(nullptr);
-            istr.rdbuf(&ibuf);
-            readBinary(true, istr, types, sizes, data);
-        }
-        else {
-            throw Base::BadFormatError("Failed to decompress binary data");
+        Eigen::Index col = 0;
+        for (std::size_t j = 0; j < fields.size(); j++) {
+            PcdField field;
+            field.data = reinterpret_cast<const char*>(data.col(col).data());
+            field.stride = sizeof(double);
+            field.size = sizeof(double);
+            columns.push_back(field);
+            col += counts[j];
+        }
+    }
+    else if (format == "binary" || format == "binary_compressed") {
+        bool compressed = (format == "binary_compressed");
+        buffer = readBinary(compressed, inp, numPoints * pointSize);
+        std::size_t offset = 0;
+        for (std::size_t j = 0; j < fields.size(); j++) {
+            std::size_t fieldSize = std::size_t(sizes[j]) * counts[j];
+            PcdField field;
+            field.data = buffer.data() + (compressed ? offset * numPoints : offset);
+            field.stride = compressed ? fieldSize : pointSize;
+            field.type = types[j].empty() ? ' ' : types[j][0];
+            field.size = sizes[j];
+            columns.push_back(field);
+            offset += fieldSize;
         }
     }
-
-    std::vector<std::string>::iterator it;
-    Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
-
-    // x field
-    Eigen::Index x = max_size;
-    it = std::find(fields.begin(), fields.end(), "x");
-    if (it != fields.end()) {
-        x = std::distance(fields.begin(), it);
-    }
-
-    // y field
-    Eigen::Index y = max_size;
-    it = std::find(fields.begin(), fields.end(), "y");
-    if (it != fields.end()) {
-        y = std::distance(fields.begin(), it);
-    }
-
-    // z field
-    Eigen::Index z = max_size;
-    it = std::find(fields.begin(), fields.end(), "z");
-    if (it != fields.end()) {
-        z = std::distance(fields.begin(), it);
-    }
-
-    // normal x field
-    Eigen::Index normal_x = max_size;
-    it = std::find(fields.begin(), fields.end(), "normal_x");
-    if (it == fields.end()) {
-        it = std::find(fields.begin(), fields.end(), "nx");
-    }
-    if (it != fields.end()) {
-        normal_x = std::distance(fields.begin(), it);
-    }
-
-    // normal y field
-    Eigen::Index normal_y = max_size;
-    it = std::find(fields.begin(), fields.end(), "normal_y");
-    if (it == fields.end()) {
-        it = std::find(fields.begin(), fields.end(), "ny");
-    }
-    if (it != fields.end()) {
-        normal_y = std::distance(fields.begin(), it);
-    }
-
-    // normal z field
-    Eigen::Index normal_z = max_size;
-    it = std::find(fields.begin(), fields.end(), "normal_z");
-    if (it == fields.end()) {
-        it = std::find(fields.begin(), fields.end(), "nz");
-    }
-    if (it != fields.end()) {
-        normal_z = std::distance(fields.begin(), it);
+    else {
+        throw Base::BadFormatError("Unsupported data format");
     }
 
-    // intensity field
-    Eigen::Index greyvalue = max_size;
-    it = std::find(fields.begin(), fields.end(), "intensity");
-    if (it != fields.end()) {
-        greyvalue = std::distance(fields.begin(), it);
-    }
+    auto findField = [&fields](std::initializer_list<const char*> names) {
+        for (const char* name : names) {
+            auto it = std::find(fields.begin(), fields.end(), name);
+            if (it != fields.end()) {
+                return std::distance(fields.begin(), it);
+            }
+        }
+        return std::ptrdiff_t(-1);
+    };
 
-    // rgb(a) field
-    Eigen::Index rgba = max_size;
-    it = std::find(fields.begin(), fields.end(), "rgb");
-    if (it == fields.end()) {
-        it = std::find(fields.begin(), fields.end(), "rgba");
-    }
-    if (it != fields.end()) {
-        rgba = std::distance(fields.begin(), it);
-    }
+    std::ptrdiff_t x = findField({"x"});
+    std::ptrdiff_t y = findField({"y"});
+    std::ptrdiff_t z = findField({"z"});
+    std::ptrdiff_t normal_x = findField({"normal_x", "nx"});
+    std::ptrdiff_t normal_y = findField({"normal_y", "ny"});
+    std::ptrdiff_t normal_z = findField({"normal_z", "nz"});
+    std::ptrdiff_t greyvalue = findField({"intensity"});
+    std::ptrdiff_t rgba = findField({"rgb", "rgba"});
 
     // transfer the data
-    bool hasData = (x != max_size && y != max_size && z != max_size);
-    bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
-    bool hasIntensity = (greyvalue != max_size);
-    bool hasColor = (rgba != max_size);
+    bool hasData = (x >= 0 && y >= 0 && z >= 0);
+    bool hasNormal = (normal_x >= 0 && normal_y >= 0 && normal_z >= 0);
+    bool hasIntensity = (greyvalue >= 0);
+    bool hasColor = (rgba >= 0);
 
     if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
+        points.resize(numPoints);
+        std::vector<Base::Vector3f>& pts = points.getBasicPoints();
+        forEachValue(columns[x], numPoints, [&pts](std::size_t i, auto value) {
+            pts[i].x = static_cast<float>(value);
+        });
+        forEachValue(columns[y], numPoints, [&pts](std::size_t i, auto value) {
+            pts[i].y = static_cast<float>(value);
+        });
+        forEachValue(columns[z], numPoints, [&pts](std::size_t i, auto value) {
+            pts[i].z = static_cast<float>(value);
+        });
     }
 
     if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
-        }
+        normals.resize(numPoints);
+        forEachValue(columns[normal_x], numPoints, [this](std::size_t i, auto value) {
+            normals[i].x = static_cast<float>(value);
+        });
+        forEachValue(columns[normal_y], numPoints, [this](std::size_t i, auto value) {
+            normals[i].y = static_cast<float>(value);
+        });
+        forEachValue(columns[normal_z], numPoints, [this](std::size_t i, auto value) {
+            normals[i].z = static_cast<float>(value);
+        });
     }
 
     if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            intensity.push_back(data(i, greyvalue));
-        }
+        intensity.resize(numPoints);
+        forEachValue(columns[greyvalue], numPoints, [this](std::size_t i, auto value) {
+            intensity[i] = static_cast<float>(value);
+        });
     }
 
     if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        if (types[rgba] == "U") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                uint32_t packed = static_cast<uint32_t>(data(i, rgba));
-                App::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
-        }
-        else if (types[rgba] == "F") {
-            static_assert(sizeof(float) == sizeof(uint32_t),
-                          "float and uint32_t have different sizes");
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float f = static_cast<float>(data(i, rgba));
+        // the color is either stored as integer or its bits are stored as float
+        static_assert(sizeof(float) == sizeof(uint32_t), "float and uint32_t have different sizes");
+        bool isFloat = (types[rgba] == "F");
+        if (isFloat || types[rgba] == "U") {
+            colors.resize(numPoints);
+            forEachValue(columns[rgba], numPoints, [this, isFloat](std::size_t i, auto value) {
                 uint32_t packed {};
-                std::memcpy(&packed, &f, sizeof(packed));
-                App::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
+                if (isFloat) {
+                    float f = static_cast<float>(value);
+                    std::memcpy(&packed, &f, sizeof(packed));
+                }
+                else {
+                    packed = static_cast<uint32_t>(value);
+                }
+                colors[i].setPackedARGB(packed);
+            });
         }
     }
 }
@@ -1190,10 +1264,10 @@ std::size_t PcdReader::readHeader(std::istream& in,
                                   std::string& format,
                                   std::vector<std::string>& fields,
                                   std::vector<std::string>& types,
-                                  std::vector<int>& sizes)
+                                  std::vector<int>& sizes,
+                                  std::vector<int>& counts)
 {
     std::string line;
-    std::vector<std::string> counts;
     std::vector<std::string> list;
     std::size_t points = 0;
 
@@ -1228,7 +1302,7 @@ std::size_t PcdReader::readHeader(std::istream& in,
         }
         else if (kw == "COUNT") {
             for (std::size_t i = 1; i < list.size(); i++) {
-                counts.push_back(list[i]);
+                counts.push_back(boost::lexical_cast<int>(list[i]));
             }
         }
         else if (kw == "WIDTH") {
@@ -1246,6 +1320,11 @@ std::size_t PcdReader::readHeader(std::istream& in,
         }
     }
 
+    // COUNT is optional and defaults to one value per field
+    if (counts.empty()) {
+        counts.resize(fields.size(), 1);
+    }
+
     std::size_t w = static_cast<std::size_t>(this->width);
     std::size_t h = static_cast<std::size_t>(this->height);
     std::size_t size = w * h;
@@ -1253,6 +1332,11 @@ std::size_t PcdReader::readHeader(std::istream& in,
         || fields.size() != counts.size() || points != size) {
         throw Base::BadFormatError("");
     }
+    for (std::size_t i = 0; i < fields.size(); i++) {
+        if (sizes[i] <= 0 || counts[i] <= 0) {
+            throw Base::BadFormatError("Invalid field size");
+        }
+    }
 
     return points;
 }
@@ -1285,109 +1369,49 @@ void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
     }
 }
 
-void PcdReader::readBinary(bool transpose,
-                           std::istream& inp,
-                           const std::vector<std::string>& types,
-                           const std::vector<int>& sizes,
-                           Eigen::MatrixXd& data)
+std::vector<char> PcdReader::readBinary(bool compressed, std::istream& inp, std::size_t dataSize)
 {
-    Eigen::Index numPoints = data.rows();
-    Eigen::Index numFields = data.cols();
-
-    int neededSize = 0;
-    ConverterPtr convert_float32(new ConverterT<float>);
-    ConverterPtr convert_float64(new ConverterT<double>);
-    ConverterPtr convert_int8(new ConverterT<int8_t>);
-    ConverterPtr convert_uint8(new ConverterT<uint8_t>);
-    ConverterPtr convert_int16(new ConverterT<int16_t>);
-    ConverterPtr convert_uint16(new ConverterT<uint16_t>);
-    ConverterPtr convert_int32(new ConverterT<int32_t>);
-    ConverterPtr convert_uint32(new ConverterT<uint32_t>);
-
-    std::vector<ConverterPtr> converters;
-    for (Eigen::Index j = 0; j < numFields; j++) {
-        char t = types[j][0];
-        switch (sizes[j]) {
-            case 1:
-                if (t == 'I') {
-                    converters.push_back(convert_int8);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint8);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 2:
-                if (t == 'I') {
-                    converters.push_back(convert_int16);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint16);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 4:
-                if (t == 'I') {
-                    converters.push_back(convert_int32);
-                }
-                else if (t == 'U') {
-                    converters.push_back(convert_uint32);
-                }
-                else if (t == 'F') {
-                    converters.push_back(convert_float32);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            case 8:
-                if (t == 'F') {
-                    converters.push_back(convert_float64);
-                }
-                else {
-                    throw Base::BadFormatError("Unexpected type");
-                }
-                break;
-            default:
-                throw Base::BadFormatError("Unexpected type");
+    std::vector<char> data;
+    if (!compressed) {
+        std::streamoff ulSize = 0;
+        std::streamoff ulCurr = 0;
+        std::streambuf* buf = inp.rdbuf();
+        if (buf) {
+            ulCurr = buf->pubseekoff(0, std::ios::cur, std::ios::in);
+            ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
+            buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
+            if (ulCurr + static_cast<std::streamoff>(dataSize) > ulSize) {
+                throw Base::BadFormatError("File expects too many elements");
+            }
         }
 
-        neededSize += converters.back()->getSizeOf();
-    }
-
-    std::streamoff ulSize = 0;
-    std::streamoff ulCurr = 0;
-    std::streambuf* buf = inp.rdbuf();
-    if (buf) {
-        ulCurr = buf->pubseekoff(0, std::ios::cur, std::ios::in);
-        ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
-        buf->pubseekoff(ulCurr, std::ios::beg, std::ios::in);
-        if (ulCurr + neededSize * static_cast<std::streamoff>(numPoints) > ulSize) {
+        data.resize(dataSize);
+        inp.read(data.data(), static_cast<std::streamsize>(dataSize));
+        if (static_cast<std::size_t>(inp.gcount()) != dataSize) {
             throw Base::BadFormatError("File expects too many elements");
         }
+        return data;
     }
 
+    unsigned int c {};
+    unsigned int u {};
     Base::InputStream str(inp);
-    if (transpose) {
-        for (Eigen::Index j = 0; j < numFields; j++) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
+    str >> c >> u;
+    if (u < dataSize) {
+        throw Base::BadFormatError("File expects too many elements");
     }
-    else {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            for (Eigen::Index j = 0; j < numFields; j++) {
-                double value = converters[j]->toDouble(str);
-                data(i, j) = value;
-            }
-        }
+
+    std::vector<char> compressedData(c);
+    inp.read(compressedData.data(), c);
+    if (static_cast<std::size_t>(inp.gcount()) != c) {
+        throw Base::BadFormatError("Failed to decompress binary data");
     }
+
+    data.resize(u);
+    if (u > 0 && lzfDecompress(compressedData.data(), c, data.data(), u) != u) {
+        throw Base::BadFormatError("Failed to decompress binary data");
+    }
+    return data;
 }
 
 // ----------------------------------------------------------------------------
@@ -2024,6 +2048,11 @@ PcdWriter::PcdWriter(const PointKernel& p)
     : Writer(p)
 {}
 
+void PcdWriter::setFormat(Format fmt)
+{
+    format = fmt;
+}
+
 void PcdWriter::write(const std::string& filename)
 {
     std::list<std::string> fields;
@@ -2072,72 +2101,76 @@ void PcdWriter::write(const std::string& filename)
         converters.push_back(convert_float);
     }
 
-    Eigen::Index numPoints = Eigen::Index(points.size());
+    std::size_t numPoints = points.size();
     const std::vector<Base::Vector3f>& pts = points.getBasicPoints();
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-
-    if (placement.isIdentity()) {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            data(i, 0) = pts[i].x;
-            data(i, 1) = pts[i].y;
-            data(i, 2) = pts[i].z;
-        }
-    }
-    else {
-        Base::Vector3d tmp;
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            tmp = Base::convertTo<Base::Vector3d>(pts[i]);
-            placement.multVec(tmp, tmp);
-            data(i, 0) = static_cast<float>(tmp.x);
-            data(i, 1) = static_cast<float>(tmp.y);
-            data(i, 2) = static_cast<float>(tmp.z);
-        }
-    }
-
-    Eigen::Index col = 3;
-    if (hasNormals) {
-        Eigen::Index col0 = col;
-        Eigen::Index col1 = col + 1;
-        Eigen::Index col2 = col + 2;
-        Base::Rotation rot = placement.getRotation();
-        if (rot.isIdentity()) {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                data(i, col0) = normals[i].x;
-                data(i, col1) = normals[i].y;
-                data(i, col2) = normals[i].z;
+    // passes the values of all points and fields to store(point, field, value)
+    auto fillValues = [&](auto store) {
+        if (placement.isIdentity()) {
+            for (std::size_t i = 0; i < numPoints; i++) {
+                store(i, 0, pts[i].x);
+                store(i, 1, pts[i].y);
+                store(i, 2, pts[i].z);
             }
         }
         else {
             Base::Vector3d tmp;
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                tmp = Base::convertTo<Base::Vector3d>(normals[i]);
-                rot.multVec(tmp, tmp);
-                data(i, col0) = static_cast<float>(tmp.x);
-                data(i, col1) = static_cast<float>(tmp.y);
-                data(i, col2) = static_cast<float>(tmp.z);
+            for (std::size_t i = 0; i < numPoints; i++) {
+                tmp = Base::convertTo<Base::Vector3d>(pts[i]);
+                placement.multVec(tmp, tmp);
+                store(i, 0, static_cast<float>(tmp.x));
+                store(i, 1, static_cast<float>(tmp.y));
+                store(i, 2, static_cast<float>(tmp.z));
             }
         }
-        col += 3;
-    }
 
-    if (hasColors) {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            // http://docs.pointclouds.org/1.3.0/structpcl_1_1_r_g_b.html
-            data(i, col) = colors[i].getPackedARGB();
+        std::size_t col = 3;
+        if (hasNormals) {
+            std::size_t col0 = col;
+            std::size_t col1 = col + 1;
+            std::size_t col2 = col + 2;
+            Base::Rotation rot = placement.getRotation();
+            if (rot.isIdentity()) {
+                for (std::size_t i = 0; i < numPoints; i++) {
+                    store(i, col0, normals[i].x);
+                    store(i, col1, normals[i].y);
+                    store(i, col2, normals[i].z);
+                }
+            }
+            else {
+                Base::Vector3d tmp;
+                for (std::size_t i = 0; i < numPoints; i++) {
+                    tmp = Base::convertTo<Base::Vector3d>(normals[i]);
+                    rot.multVec(tmp, tmp);
+                    store(i, col0, static_cast<float>(tmp.x));
+                    store(i, col1, static_cast<float>(tmp.y));
+                    store(i, col2, static_cast<float>(tmp.z));
+                }
+            }
+            col += 3;
         }
-        col += 1;
-    }
 
-    if (hasIntensity) {
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            data(i, col) = intensity[i];
+        if (hasColors) {
+            for (std::size_t i = 0; i < numPoints; i++) {
+                // http://docs.pointclouds.org/1.3.0/structpcl_1_1_r_g_b.html
+                store(i, col, colors[i].getPackedARGB());
+            }
+            col += 1;
         }
-        col += 1;
-    }
+
+        if (hasIntensity) {
+            for (std::size_t i = 0; i < numPoints; i++) {
+                store(i, col, intensity[i]);
+            }
+        }
+    };
 
     std::size_t numFields = fields.size();
-    Base::ofstream out(Base::FileInfo(filename), std::ios::out);
+    std::ios::openmode mode = std::ios::out;
+    if (format != Format::Ascii) {
+        mode |= std::ios::binary;
+    }
+    Base::ofstream out(Base::FileInfo(filename), mode);
     out << "# .PCD v0.7 - Point Cloud Data file format" << std::endl << "VERSION 0.7" << std::endl;
 
     // the fields
@@ -2182,18 +2215,69 @@ void PcdWriter::write(const std::string& filename)
     out << "VIEWPOINT " << p.x << " " << p.y << " " << p.z << " " << w << " " << x << " " << y
         << " " << z << std::endl;
 
-    out << "POINTS " << numPoints << std::endl << "DATA ascii" << std::endl;
+    out << "POINTS " << numPoints << std::endl;
 
-    for (Eigen::Index r = 0; r < numPoints; r++) {
-        for (Eigen::Index c = 0; c < col; c++) {
-            double value = data(r, c);
-            if (boost::math::isnan(value)) {
-                out << "nan ";
-            }
-            else {
-                out << converters[c]->toString(value) << " ";
+    if (format == Format::Ascii) {
+        out << "DATA ascii" << std::endl;
+
+        Eigen::MatrixXd data(static_cast<Eigen::Index>(numPoints),
+                             static_cast<Eigen::Index>(numFields));
+        fillValues([&data](std::size_t i, std::size_t col, auto value) {
+            data(static_cast<Eigen::Index>(i), static_cast<Eigen::Index>(col)) = value;
+        });
+
+        for (Eigen::Index r = 0; r < data.rows(); r++) {
+            for (Eigen::Index c = 0; c < data.cols(); c++) {
+                double value = data(r, c);
+                if (boost::math::isnan(value)) {
+                    out << "nan ";
+                }
+                else {
+                    out << converters[c]->toString(value) << " ";
+                }
             }
+            out << std::endl;
         }
-        out << std::endl;
+        return;
+    }
+
+    // All fields have four bytes. The binary data is stored point by point,
+    // the data to be compressed field by field as this compresses much better.
+    bool compressed = (format == Format::BinaryCompressed);
+    const std::size_t valueSize = 4;
+    std::vector<char> buffer(numPoints * numFields * valueSize);
+    fillValues([&](std::size_t i, std::size_t col, auto value) {
+        static_assert(sizeof(value) == valueSize, "Unexpected size of value");
+        std::size_t index = compressed ? col * numPoints + i : i * numFields + col;
+        std::memcpy(buffer.data() + index * valueSize, &value, valueSize);
+    });
+
+    if (!compressed) {
+        out << "DATA binary" << std::endl;
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        return;
     }
+
+    if (buffer.size() > std::numeric_limits<uint32_t>::max()) {
+        throw Base::FileException("Too many points for a compressed PCD file", filename.c_str());
+    }
+
+    // incompressible data grows by one byte per 32 bytes
+    uint32_t u = static_cast<uint32_t>(buffer.size());
+    uint32_t c = 0;
+    std::vector<char> compressedData(std::size_t(u) + u / 16 + 64);
+    if (u > 0) {
+        c = lzfCompress(buffer.data(),
+                        u,
+                        compressedData.data(),
+                        static_cast<unsigned int>(compressedData.size()));
+        if (c == 0) {
+            throw Base::FileException("Failed to compress point data", filename.c_str());
+        }
+    }
+
+    out << "DATA binary_compressed" << std::endl;
+    Base::OutputStream str(out);
+    str << c << u;
+    out.write(compressedData.data(), c);
 }
@@ -121,13 +121,10 @@ private:
                            std::string& format,
                            std::vector<std::string>& fields,
                            std::vector<std::string>& types,
-                           std::vector<int>& sizes);
+                           std::vector<int>& sizes,
+                           std::vector<int>& counts);
     void readAscii(std::istream&, Eigen::MatrixXd& data);
-    void readBinary(bool transpose,
-                    std::istream&,
-                    const std::vector<std::string>& types,
-                    const std::vector<int>& sizes,
-                    Eigen::MatrixXd& data);
+    std::vector<char> readBinary(bool compressed, std::istream&, std::size_t dataSize);
 };
 
 class PointsExport E57Reader: public Reader
@@ -188,8 +185,20 @@ public:
 class PointsExport PcdWriter: public Writer
 {
 public:
+    /// The encoding of the point data
+    enum class Format
+    {
+        Ascii,
+        Binary,
+        BinaryCompressed
+    };
+
     explicit PcdWriter(const PointKernel&);
+    void setFormat(Format);
     void write(const std::string& filename) override;
+
+private:
+    Format format {Format::Ascii};
 };
 
 }  // namespace Points
@@ -21,10 +21,20 @@
  ***************************************************************************/
 
 #include "PreCompiled.h"
+#ifndef _PreComp_
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <thread>
+#endif
 
 #include "PointsGrid.h"
 
 
+#ifdef _MSC_VER
+#include <ppl.h>
+#endif
+
+
 using namespace Points;
 
 PointsGrid::PointsGrid(const PointKernel& rclM)
@@ -122,7 +132,8 @@ void PointsGrid::Attach(const PointKernel& rclM)
 
 void PointsGrid::Clear()
 {
-    _aulGrid.clear();
+    _aulCellStart.clear();
+    _aulCellPoints.clear();
     _pclPoints = nullptr;
 }
 
@@ -202,14 +213,8 @@ void PointsGrid::InitGrid()
     }
 
     // Create data structure
-    _aulGrid.clear();
-    _aulGrid.resize(_ulCtGridsX);
-    for (unsigned long i = 0; i < _ulCtGridsX; i++) {
-        _aulGrid[i].resize(_ulCtGridsY);
-        for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-            _aulGrid[i][j].resize(_ulCtGridsZ);
-        }
-    }
+    _aulCellStart.assign(_ulCtGridsX * _ulCtGridsY * _ulCtGridsZ + 1, 0);
+    _aulCellPoints.clear();
 }
 
 unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
@@ -232,9 +237,7 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(raulElements.end(),
-                                    _aulGrid[i][j][k].begin(),
-                                    _aulGrid[i][j][k].end());
+                AppendElements(i, j, k, raulElements);
             }
         }
     }
@@ -270,9 +273,7 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
                 if (Base::DistanceP2(GetBoundBox(i, j, k).GetCenter(), rclOrg) < fMinDistP2) {
-                    raulElements.insert(raulElements.end(),
-                                        _aulGrid[i][j][k].begin(),
-                                        _aulGrid[i][j][k].end());
+                    AppendElements(i, j, k, raulElements);
                 }
             }
         }
@@ -303,7 +304,7 @@ unsigned long PointsGrid::InSide(const Base::BoundBox3d& rclBB,
     for (auto i = ulMinX; i <= ulMaxX; i++) {
         for (auto j = ulMinY; j <= ulMaxY; j++) {
             for (auto k = ulMinZ; k <= ulMaxZ; k++) {
-                raulElements.insert(_aulGrid[i][j][k].begin(), _aulGrid[i][j][k].end());
+                GetElements(i, j, k, raulElements);
             }
         }
     }
@@ -552,7 +553,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            GetElements(nX, i, j, raclInd);
                         }
                     }
                     nX++;
@@ -564,7 +565,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsY; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[nX][i][j].begin(), _aulGrid[nX][i][j].end());
+                            GetElements(nX, i, j, raclInd);
                         }
                     }
                     nX++;
@@ -576,7 +577,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            GetElements(i, nY, j, raclInd);
                         }
                     }
                     nY++;
@@ -588,7 +589,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsZ; j++) {
-                            raclInd.insert(_aulGrid[i][nY][j].begin(), _aulGrid[i][nY][j].end());
+                            GetElements(i, nY, j, raclInd);
                         }
                     }
                     nY--;
@@ -600,7 +601,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            GetElements(i, j, nZ, raclInd);
                         }
                     }
                     nZ++;
@@ -612,7 +613,7 @@ void PointsGrid::SearchNearestFromPoint(const Base::Vector3d& rclPt,
                 while (raclInd.empty()) {
                     for (unsigned long i = 0; i < _ulCtGridsX; i++) {
                         for (unsigned long j = 0; j < _ulCtGridsY; j++) {
-                            raclInd.insert(_aulGrid[i][j][nZ].begin(), _aulGrid[i][j][nZ].end());
+                            GetElements(i, j, nZ, raclInd);
                         }
                     }
                     nZ--;
@@ -682,22 +683,11 @@ unsigned long PointsGrid::GetElements(unsigned long ulX,
                                       unsigned long ulZ,
                                       std::set<unsigned long>& raclInd) const
 {
-    const std::set<unsigned long>& rclSet = _aulGrid[ulX][ulY][ulZ];
-    if (!rclSet.empty()) {
-        raclInd.insert(rclSet.begin(), rclSet.end());
-        return rclSet.size();
-    }
-
-    return 0;
-}
-
-void PointsGrid::AddPoint(const Base::Vector3d& rclPt, unsigned long ulPtIndex, float /*fEpsilon*/)
-{
-    unsigned long ulX {}, ulY {}, ulZ {};
-    Pos(Base::Vector3d(rclPt.x, rclPt.y, rclPt.z), ulX, ulY, ulZ);
-    if ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ)) {
-        _aulGrid[ulX][ulY][ulZ].insert(ulPtIndex);
-    }
+    unsigned long ulCell = CellIndex(ulX, ulY, ulZ);
+    unsigned long ulBegin = _aulCellStart[ulCell];
+    unsigned long ulEnd = _aulCellStart[ulCell + 1];
+    raclInd.insert(_aulCellPoints.begin() + ulBegin, _aulCellPoints.begin() + ulEnd);
+    return ulEnd - ulBegin;
 }
 
 void PointsGrid::Validate(const PointKernel& rclPoints)
@@ -751,12 +741,77 @@ void PointsGrid::RebuildGrid()
 
     InitGrid();
 
-    // Fill data structure
+    // Fill data structure with a counting sort of the point indices by grid element. Each
+    // block of points is counted and scattered by its own task. The blocks are placed in
+    // ascending order so the indices of each grid element stay sorted.
+    const std::vector<PointKernel::value_type>& points = _pclPoints->getBasicPoints();
+    const Base::Matrix4D mat = _pclPoints->getTransform();
+    const unsigned long ulCtCells = _aulCellStart.size() - 1;
+    auto cellOf = [&](std::size_t index) {
+        const PointKernel::value_type& pnt = points[index];
+        unsigned long ulX {}, ulY {}, ulZ {};
+        Pos(mat * Base::Vector3d(pnt.x, pnt.y, pnt.z), ulX, ulY, ulZ);
+        return CheckPos(ulX, ulY, ulZ) ? CellIndex(ulX, ulY, ulZ) : ulCtCells;
+    };
+
+    // limit the memory used by the counters of the blocks
+    const std::size_t blockSize = 65536;
+    std::size_t numBlocks = (points.size() + blockSize - 1) / blockSize;
+    numBlocks = std::min<std::size_t>(numBlocks, std::max(std::thread::hardware_concurrency(), 1U));
+    numBlocks = std::min<std::size_t>(numBlocks, std::max<std::size_t>(points.size() / ulCtCells, 1));
+    numBlocks = std::max<std::size_t>(numBlocks, 1);
+
+    struct Block
+    {
+        std::size_t begin;
+        std::size_t end;
+        std::vector<unsigned long> offsets;
+    };
+    std::vector<Block> blocks(numBlocks);
+    for (std::size_t i = 0; i < numBlocks; i++) {
+        blocks[i].begin = points.size() * i / numBlocks;
+        blocks[i].end = points.size() * (i + 1) / numBlocks;
+    }
 
-    unsigned long i = 0;
-    for (const auto& pnt : *_pclPoints) {
-        AddPoint(pnt, i++);
+    auto countBlock = [&](Block& block) {
+        block.offsets.assign(ulCtCells + 1, 0);
+        for (std::size_t i = block.begin; i < block.end; i++) {
+            block.offsets[cellOf(i)]++;
+        }
+    };
+#ifdef _MSC_VER
+    Concurrency::parallel_for_each(blocks.begin(), blocks.end(), countBlock);
+#else
+    QtConcurrent::blockingMap(blocks, countBlock);
+#endif
+
+    // points outside of the grid are not stored
+    unsigned long ulOffset = 0;
+    for (unsigned long cell = 0; cell < ulCtCells; cell++) {
+        _aulCellStart[cell] = ulOffset;
+        for (auto& block : blocks) {
+            unsigned long ulCount = block.offsets[cell];
+            block.offsets[cell] = ulOffset;
+            ulOffset += ulCount;
+        }
     }
+    _aulCellStart[ulCtCells] = ulOffset;
+    _aulCellPoints.resize(ulOffset);
+
+    auto scatterBlock = [&](Block& block) {
+        for (std::size_t i = block.begin; i < block.end; i++) {
+            unsigned long cell = cellOf(i);
+            if (cell < ulCtCells) {
+                _aulCellPoints[block.offsets[cell]++] = i;
+            }
+        }
+        std::vector<unsigned long>().swap(block.offsets);
+    };
+#ifdef _MSC_VER
+    Concurrency::parallel_for_each(blocks.begin(), blocks.end(), scatterBlock);
+#else
+    QtConcurrent::blockingMap(blocks, scatterBlock);
+#endif
 }
 
 void PointsGrid::Pos(const Base::Vector3d& rclPoint,
@@ -783,6 +838,69 @@ unsigned long PointsGrid::FindElements(const Base::Vector3d& rclPoint,
     return 0;
 }
 
+unsigned long PointsGrid::RadiusSearch(const Base::Vector3d& rclPt,
+                                       double fRadius,
+                                       std::vector<unsigned long>& raulElements) const
+{
+    raulElements.clear();
+    if (!_pclPoints || _aulCellPoints.empty()) {
+        return 0;
+    }
+
+    unsigned long ulMinX {}, ulMinY {}, ulMinZ {};
+    unsigned long ulMaxX {}, ulMaxY {}, ulMaxZ {};
+    Base::Vector3d clRadius(fRadius, fRadius, fRadius);
+    Position(rclPt - clRadius, ulMinX, ulMinY, ulMinZ);
+    Position(rclPt + clRadius, ulMaxX, ulMaxY, ulMaxZ);
+
+    const std::vector<PointKernel::value_type>& points = _pclPoints->getBasicPoints();
+    const Base::Matrix4D mat = _pclPoints->getTransform();
+    const double fRadiusP2 = fRadius * fRadius;
+    for (auto i = ulMinX; i <= ulMaxX; i++) {
+        for (auto j = ulMinY; j <= ulMaxY; j++) {
+            for (auto k = ulMinZ; k <= ulMaxZ; k++) {
+                unsigned long ulCell = CellIndex(i, j, k);
+                for (auto it = _aulCellStart[ulCell]; it < _aulCellStart[ulCell + 1]; it++) {
+                    unsigned long index = _aulCellPoints[it];
+                    const PointKernel::value_type& pnt = points[index];
+                    Base::Vector3d clPnt = mat * Base::Vector3d(pnt.x, pnt.y, pnt.z);
+                    if (Base::DistanceP2(clPnt, rclPt) <= fRadiusP2) {
+                        raulElements.push_back(index);
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort(raulElements.begin(), raulElements.end());
+    return raulElements.size();
+}
+
+void PointsGrid::RadiusSearch(const std::vector<Base::Vector3d>& rclPts,
+                              double fRadius,
+                              std::vector<std::vector<unsigned long>>& raulElements) const
+{
+    raulElements.resize(rclPts.size());
+
+    // each task handles a block of queries
+    const std::size_t blockSize = 1024;
+    std::vector<std::size_t> blocks;
+    for (std::size_t index = 0; index < rclPts.size(); index += blockSize) {
+        blocks.push_back(index);
+    }
+    auto searchBlock = [&](std::size_t& start) {
+        std::size_t end = std::min(start + blockSize, rclPts.size());
+        for (std::size_t index = start; index < end; index++) {
+            RadiusSearch(rclPts[index], fRadius, raulElements[index]);
+        }
+    };
+#ifdef _MSC_VER
+    Concurrency::parallel_for_each(blocks.begin(), blocks.end(), searchBlock);
+#else
+    QtConcurrent::blockingMap(blocks, searchBlock);
+#endif
+}
+
 // ----------------------------------------------------------------
 
 PointsGridIterator::PointsGridIterator(const PointsGrid& rclG)
@@ -819,9 +937,7 @@ bool PointsGridIterator::InitOnRay(const Base::Vector3d& rclPt,
     // point lies within global BB
     if (_rclGrid.GetBoundBox().IsInBox(rclPt)) {  // determine the voxel by the starting point
         _rclGrid.Position(rclPt, _ulX, _ulY, _ulZ);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        _rclGrid.AppendElements(_ulX, _ulY, _ulZ, raulElements);
         _bValidRay = true;
     }
     else {  // StartPoint outside
@@ -837,9 +953,7 @@ bool PointsGridIterator::InitOnRay(const Base::Vector3d& rclPt,
                 _rclGrid.Position(cP1, _ulX, _ulY, _ulZ);
             }
 
-            raulElements.insert(raulElements.end(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                                _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+            _rclGrid.AppendElements(_ulX, _ulY, _ulZ, raulElements);
             _bValidRay = true;
         }
     }
@@ -903,9 +1017,7 @@ bool PointsGridIterator::NextOnRay(std::vector<unsigned long>& raulElements)
     if (_bValidRay && _rclGrid.CheckPos(_ulX, _ulY, _ulZ)) {
         GridElement pos(_ulX, _ulY, _ulZ);
         _cSearchPositions.insert(pos);
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        _rclGrid.AppendElements(_ulX, _ulY, _ulZ, raulElements);
     }
     else {
         _bValidRay = false;  // ray exited
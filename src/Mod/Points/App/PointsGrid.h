@@ -24,6 +24,7 @@
 #define POINTS_GRID_H
 
 #include <set>
+#include <vector>
 
 #include <Base/BoundBox.h>
 #include <Base/Vector3D.h>
@@ -102,6 +103,16 @@ public:
     /** Searches for the nearest grids that contain elements from a point, the result are grid
      * indices. */
     void SearchNearestFromPoint(const Base::Vector3d& rclPt, std::set<unsigned long>& rclInd) const;
+    /** Searches for the points with a distance not higher than \a fRadius to \a rclPt. The
+     * indices are sorted. */
+    unsigned long RadiusSearch(const Base::Vector3d& rclPt,
+                               double fRadius,
+                               std::vector<unsigned long>& raulElements) const;
+    /** Does a radius search for each of the points \a rclPts, the queries are processed in
+     * parallel. */
+    void RadiusSearch(const std::vector<Base::Vector3d>& rclPts,
+                      double fRadius,
+                      std::vector<std::vector<unsigned long>>& raulElements) const;
     //@}
 
     /** Returns the lengths of the grid elements in x,y and z direction. */
@@ -130,7 +141,8 @@ public:
     /** Returns the number of elements in a given grid. */
     unsigned long GetCtElements(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
     {
-        return _aulGrid[ulX][ulY][ulZ].size();
+        unsigned long ulCell = CellIndex(ulX, ulY, ulZ);
+        return _aulCellStart[ulCell + 1] - _aulCellStart[ulCell];
     }
     /** Finds all points that lie in the same grid as the point \a rclPoint. */
     unsigned long FindElements(const Base::Vector3d& rclPoint,
@@ -156,6 +168,13 @@ public:
 protected:
     /** Checks if this is a valid grid position. */
     inline bool CheckPos(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const;
+    /** Returns the index of the grid element in the flat element arrays. */
+    inline unsigned long CellIndex(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const;
+    /** Appends the indices of the elements in the given grid to \a raulElements. */
+    inline void AppendElements(unsigned long ulX,
+                               unsigned long ulY,
+                               unsigned long ulZ,
+                               std::vector<unsigned long>& raulElements) const;
     /** Initializes the size of the internal structure. */
     virtual void InitGrid();
     /** Deletes the grid structure. */
@@ -180,8 +199,9 @@ protected:
                  std::set<unsigned long>& raclInd) const;
 
 private:
-    std::vector<std::vector<std::vector<std::set<unsigned long>>>>
-        _aulGrid;                  /**< Grid data structure. */
+    std::vector<unsigned long> _aulCellStart;  /**< Offsets of the grid elements into
+                                                  _aulCellPoints. */
+    std::vector<unsigned long> _aulCellPoints; /**< Point indices sorted by grid element. */
     const PointKernel* _pclPoints; /**< The point kernel. */
     unsigned long _ulCtElements;   /**< Number of grid elements for validation issues. */
     unsigned long _ulCtGridsX;     /**< Number of grid elements in z. */
@@ -200,9 +220,6 @@ private:
 
 public:
 protected:
-    /** Adds a new point element to the grid structure. \a rclPt is the geometric point and \a
-     * ulPtIndex the corresponding index in the point kernel. */
-    void AddPoint(const Base::Vector3d& rclPt, unsigned long ulPtIndex, float fEpsilon = 0.0f);
     /** Returns the grid numbers to the given point \a rclPoint. */
     void Pos(const Base::Vector3d& rclPoint,
              unsigned long& rulX,
@@ -227,9 +244,7 @@ public:
     /** Returns indices of the elements in the current grid. */
     void GetElements(std::vector<unsigned long>& raulElements) const
     {
-        raulElements.insert(raulElements.end(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].begin(),
-                            _rclGrid._aulGrid[_ulX][_ulY][_ulZ].end());
+        _rclGrid.AppendElements(_ulX, _ulY, _ulZ, raulElements);
     }
     /** @name Iteration */
     //@{
@@ -352,6 +367,23 @@ inline bool PointsGrid::CheckPos(unsigned long ulX, unsigned long ulY, unsigned
     return ((ulX < _ulCtGridsX) && (ulY < _ulCtGridsY) && (ulZ < _ulCtGridsZ));
 }
 
+inline unsigned long
+PointsGrid::CellIndex(unsigned long ulX, unsigned long ulY, unsigned long ulZ) const
+{
+    return (ulX * _ulCtGridsY + ulY) * _ulCtGridsZ + ulZ;
+}
+
+inline void PointsGrid::AppendElements(unsigned long ulX,
+                                       unsigned long ulY,
+                                       unsigned long ulZ,
+                                       std::vector<unsigned long>& raulElements) const
+{
+    unsigned long ulCell = CellIndex(ulX, ulY, ulZ);
+    raulElements.insert(raulElements.end(),
+                        _aulCellPoints.begin() + _aulCellStart[ulCell],
+                        _aulCellPoints.begin() + _aulCellStart[ulCell + 1]);
+}
+
 // --------------------------------------------------------------
 
 }  // namespace Points
@@ -0,0 +1,467 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+#ifndef _PreComp_
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <queue>
+#endif
+
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
+
+#include "PointsOctree.h"
+
+
+using namespace Points;
+
+namespace
+{
+constexpr uint32_t octreeMagic = 0x4f504346;  // "FCPO"
+constexpr uint32_t octreeVersion = 1;
+// deeper nodes would run out of float precision
+constexpr unsigned int maxDepth = 24;
+// number of points buffered by add() before they are written to disk
+constexpr std::size_t maxBuffered = 1 << 20;
+}  // namespace
+
+static_assert(sizeof(PointsOctree::value_type) == 3 * sizeof(float),
+              "The node files store the points as packed floats");
+
+struct PointsOctree::BuildState
+{
+    /// occupied grid cells of the nodes above the chunk depth
+    std::unordered_map<std::size_t, std::vector<bool>> occupied;
+    /// points not yet written to the node or chunk files
+    std::unordered_map<std::size_t, std::vector<value_type>> buffers;
+    std::size_t buffered {0};
+    /// nodes whose file has already been created
+    std::vector<bool> written;
+    /// number of spooled points of the nodes at the chunk depth
+    std::map<std::size_t, uint64_t> chunks;
+};
+
+PointsOctree::PointsOctree(const std::string& cacheDir,
+                           const Base::BoundBox3f& box,
+                           unsigned int gridSize,
+                           unsigned int chunkDepth)
+    : cacheDir(cacheDir)
+    , gridSize(std::clamp(gridSize, 1U, 1024U))
+    , chunkDepth(std::min(chunkDepth, maxDepth))
+    , build(std::make_unique<BuildState>())
+{
+    Base::FileInfo fi(cacheDir);
+    if (!fi.isDir() && !fi.createDirectories()) {
+        throw Base::FileException("Cannot create cache directory", fi);
+    }
+
+    // the nodes are cubes so that the grid cells are cubes as well
+    float len = std::max({box.LengthX(), box.LengthY(), box.LengthZ()});
+    if (!(len > 0.0F)) {
+        len = 1.0F;
+    }
+    Base::Vector3f center = box.GetCenter();
+    float half = 0.5F * len;
+    Node root;
+    root.box = Base::BoundBox3f(center.x - half,
+                                center.y - half,
+                                center.z - half,
+                                center.x + half,
+                                center.y + half,
+                                center.z + half);
+    root.box.Add(box);
+    nodes.push_back(root);
+}
+
+PointsOctree::PointsOctree(const std::string& cacheDir)
+    : cacheDir(cacheDir)
+{
+    loadIndex();
+}
+
+PointsOctree::~PointsOctree() = default;
+
+std::string PointsOctree::nodeFile(std::size_t index) const
+{
+    return cacheDir + "/n" + std::to_string(index) + ".bin";
+}
+
+std::string PointsOctree::chunkFile(std::size_t index) const
+{
+    return cacheDir + "/c" + std::to_string(index) + ".bin";
+}
+
+int PointsOctree::getOctant(std::size_t index, const value_type& pnt) const
+{
+    Base::Vector3f center = nodes[index].box.GetCenter();
+    return (pnt.x >= center.x ? 1 : 0) | (pnt.y >= center.y ? 2 : 0)
+        | (pnt.z >= center.z ? 4 : 0);
+}
+
+uint32_t PointsOctree::getCell(std::size_t index, const value_type& pnt) const
+{
+    const Base::BoundBox3f& box = nodes[index].box;
+    float scale = float(gridSize) / box.LengthX();
+    auto cell = [&](float val, float min) {
+        return std::min(static_cast<uint32_t>((val - min) * scale), gridSize - 1);
+    };
+    return (cell(pnt.x, box.MinX) * gridSize + cell(pnt.y, box.MinY)) * gridSize
+        + cell(pnt.z, box.MinZ);
+}
+
+std::size_t PointsOctree::createChild(std::size_t index, int octant)
+{
+    Node child;
+    const Base::BoundBox3f& box = nodes[index].box;
+    Base::Vector3f center = box.GetCenter();
+    child.box.MinX = (octant & 1) ? center.x : box.MinX;
+    child.box.MaxX = (octant & 1) ? box.MaxX : center.x;
+    child.box.MinY = (octant & 2) ? center.y : box.MinY;
+    child.box.MaxY = (octant & 2) ? box.MaxY : center.y;
+    child.box.MinZ = (octant & 4) ? center.z : box.MinZ;
+    child.box.MaxZ = (octant & 4) ? box.MaxZ : center.z;
+    child.depth = nodes[index].depth + 1;
+
+    std::size_t childIndex = nodes.size();
+    nodes[index].children[octant] = static_cast<int32_t>(childIndex);
+    nodes.push_back(child);
+    return childIndex;
+}
+
+std::size_t PointsOctree::add(const std::vector<value_type>& points)
+{
+    if (!build) {
+        throw Base::RuntimeError("Cannot add points to a finished octree");
+    }
+
+    std::size_t num = 0;
+    // inserting the points adds nodes, so don't keep a reference
+    Base::BoundBox3f box = nodes.front().box;
+    std::vector<unsigned char> inside(points.size());
+    box.IsInBox(points.data(), points.size(), inside.data());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (inside[i]) {
+            insert(points[i]);
+            num++;
+            if (++build->buffered >= maxBuffered) {
+                writeBuffers();
+            }
+        }
+    }
+
+    numPoints += num;
+    return num;
+}
+
+void PointsOctree::insert(const value_type& pnt)
+{
+    std::size_t index = 0;
+    while (nodes[index].depth < chunkDepth) {
+        std::vector<bool>& occupied = build->occupied[index];
+        if (occupied.empty()) {
+            occupied.resize(std::size_t(gridSize) * gridSize * gridSize);
+        }
+        uint32_t cell = getCell(index, pnt);
+        if (!occupied[cell]) {
+            occupied[cell] = true;
+            nodes[index].count++;
+            build->buffers[index].push_back(pnt);
+            return;
+        }
+
+        int octant = getOctant(index, pnt);
+        int32_t child = nodes[index].children[octant];
+        index = child < 0 ? createChild(index, octant) : std::size_t(child);
+    }
+
+    // spool the point until the subtree is built
+    build->chunks[index]++;
+    build->buffers[index].push_back(pnt);
+}
+
+void PointsOctree::writeBuffers()
+{
+    build->written.resize(nodes.size());
+    for (const auto& it : build->buffers) {
+        std::size_t index = it.first;
+        bool chunk = nodes[index].depth == chunkDepth;
+        Base::FileInfo fi(chunk ? chunkFile(index) : nodeFile(index));
+        std::ios::openmode mode = std::ios::out | std::ios::binary;
+        mode |= build->written[index] ? std::ios::app : std::ios::trunc;
+        Base::ofstream out(fi, mode);
+        out.write(reinterpret_cast<const char*>(it.second.data()),
+                  static_cast<std::streamsize>(it.second.size() * sizeof(value_type)));
+        if (!out) {
+            throw Base::FileException("Failed to write point cache", fi);
+        }
+        build->written[index] = true;
+    }
+
+    build->buffers.clear();
+    build->buffered = 0;
+}
+
+void PointsOctree::writePoints(const std::string& file,
+                               const std::vector<value_type>& points) const
+{
+    Base::FileInfo fi(file);
+    Base::ofstream out(fi, std::ios::out | std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(points.data()),
+              static_cast<std::streamsize>(points.size() * sizeof(value_type)));
+    if (!out) {
+        throw Base::FileException("Failed to write point cache", fi);
+    }
+}
+
+std::vector<PointsOctree::value_type> PointsOctree::readPoints(const std::string& file,
+                                                               uint64_t count) const
+{
+    Base::FileInfo fi(file);
+    Base::ifstream inp(fi, std::ios::in | std::ios::binary);
+    std::vector<value_type> points(count);
+    inp.read(reinterpret_cast<char*>(points.data()),
+             static_cast<std::streamsize>(points.size() * sizeof(value_type)));
+    if (!inp) {
+        throw Base::FileException("Failed to read point cache", fi);
+    }
+    return points;
+}
+
+void PointsOctree::finish()
+{
+    if (!build) {
+        return;
+    }
+
+    writeBuffers();
+    // each chunk is small enough to be built in memory
+    std::map<std::size_t, uint64_t> chunks;
+    chunks.swap(build->chunks);
+    for (const auto& it : chunks) {
+        std::string file = chunkFile(it.first);
+        std::vector<value_type> points = readPoints(file, it.second);
+        Base::FileInfo(file).deleteFile();
+        buildSubtree(it.first, points);
+    }
+
+    build.reset();
+    saveIndex();
+}
+
+void PointsOctree::buildSubtree(std::size_t index, std::vector<value_type>& points)
+{
+    std::vector<value_type> kept;
+    std::array<std::vector<value_type>, 8> parts;
+    // a node is a leaf if its points fit into a single layer of the grid
+    if (points.size() <= std::size_t(gridSize) * gridSize || nodes[index].depth >= maxDepth) {
+        kept.swap(points);
+    }
+    else {
+        std::vector<bool> occupied(std::size_t(gridSize) * gridSize * gridSize);
+        for (const auto& pnt : points) {
+            uint32_t cell = getCell(index, pnt);
+            if (!occupied[cell]) {
+                occupied[cell] = true;
+                kept.push_back(pnt);
+            }
+            else {
+                parts[getOctant(index, pnt)].push_back(pnt);
+            }
+        }
+        std::vector<value_type>().swap(points);
+    }
+
+    nodes[index].count = kept.size();
+    writePoints(nodeFile(index), kept);
+    std::vector<value_type>().swap(kept);
+
+    for (int octant = 0; octant < 8; octant++) {
+        if (!parts[octant].empty()) {
+            std::size_t child = createChild(index, octant);
+            buildSubtree(child, parts[octant]);
+        }
+    }
+}
+
+void PointsOctree::saveIndex() const
+{
+    Base::FileInfo fi(cacheDir + "/octree.idx");
+    Base::ofstream out(fi, std::ios::out | std::ios::binary | std::ios::trunc);
+    Base::OutputStream str(out);
+    str << octreeMagic << octreeVersion << uint32_t(gridSize) << uint32_t(chunkDepth);
+    str << numPoints << uint64_t(nodes.size());
+    for (const auto& node : nodes) {
+        str << node.box.MinX << node.box.MinY << node.box.MinZ;
+        str << node.box.MaxX << node.box.MaxY << node.box.MaxZ;
+        str << uint32_t(node.depth);
+        for (int32_t child : node.children) {
+            str << child;
+        }
+        str << node.count;
+    }
+    if (!out) {
+        throw Base::FileException("Failed to write point cache", fi);
+    }
+}
+
+void PointsOctree::loadIndex()
+{
+    Base::FileInfo fi(cacheDir + "/octree.idx");
+    if (!fi.isReadable()) {
+        throw Base::FileException("No points octree in directory", cacheDir.c_str());
+    }
+
+    Base::ifstream inp(fi, std::ios::in | std::ios::binary);
+    Base::InputStream str(inp);
+    uint32_t magic {};
+    uint32_t version {};
+    uint32_t grid {};
+    uint32_t depth {};
+    uint64_t count {};
+    str >> magic >> version >> grid >> depth >> numPoints >> count;
+    if (!inp || magic != octreeMagic || version != octreeVersion || count == 0) {
+        throw Base::BadFormatError("Not a valid points octree");
+    }
+
+    gridSize = grid;
+    chunkDepth = depth;
+    nodes.resize(count);
+    for (auto& node : nodes) {
+        str >> node.box.MinX >> node.box.MinY >> node.box.MinZ;
+        str >> node.box.MaxX >> node.box.MaxY >> node.box.MaxZ;
+        str >> depth;
+        node.depth = depth;
+        for (int32_t& child : node.children) {
+            str >> child;
+        }
+        str >> node.count;
+    }
+    if (!inp) {
+        throw Base::BadFormatError("Truncated points octree");
+    }
+}
+
+std::vector<std::size_t>
+PointsOctree::selectNodes(const Base::Vector3f& eye,
+                          float minSize,
+                          uint64_t pointBudget,
+                          const std::function<bool(const Base::BoundBox3f&)>& visible) const
+{
+    auto projectedSize = [&](std::size_t index) {
+        const Base::BoundBox3f& box = nodes[index].box;
+        float radius = 0.5F * box.CalcDiagonalLength();
+        float dist = Base::Distance(eye, box.GetCenter());
+        return radius / std::max(dist, std::numeric_limits<float>::min());
+    };
+
+    std::vector<std::size_t> selection;
+    std::priority_queue<std::pair<float, std::size_t>> queue;
+    queue.emplace(projectedSize(0), 0);
+    uint64_t count = 0;
+    while (!queue.empty()) {
+        std::size_t index = queue.top().second;
+        float size = queue.top().first;
+        queue.pop();
+
+        const Node& node = nodes[index];
+        if (size < minSize || (visible && !visible(node.box))) {
+            continue;
+        }
+        if (count + node.count > pointBudget) {
+            break;
+        }
+
+        count += node.count;
+        selection.push_back(index);
+        for (int32_t child : node.children) {
+            if (child >= 0) {
+                queue.emplace(projectedSize(child), child);
+            }
+        }
+    }
+
+    return selection;
+}
+
+std::shared_ptr<const std::vector<PointsOctree::value_type>>
+PointsOctree::getPoints(std::size_t index) const
+{
+    if (build) {
+        throw Base::RuntimeError("The octree must be finished before reading its points");
+    }
+    if (index >= nodes.size()) {
+        throw Base::IndexError("Node index out of range");
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(index);
+    if (it != cache.end()) {
+        lru.splice(lru.begin(), lru, it->second.pos);
+        return it->second.points;
+    }
+
+    std::shared_ptr<const std::vector<value_type>> points;
+    if (nodes[index].count > 0) {
+        points = std::make_shared<std::vector<value_type>>(
+            readPoints(nodeFile(index), nodes[index].count));
+    }
+    else {
+        points = std::make_shared<std::vector<value_type>>();
+    }
+
+    lru.push_front(index);
+    cache[index] = CacheEntry {points, lru.begin()};
+    cachedPoints += points->size();
+    evict();
+    return points;
+}
+
+void PointsOctree::evict() const
+{
+    // the most recently used node is always kept
+    while (cachedPoints > cacheBudget && lru.size() > 1) {
+        auto it = cache.find(lru.back());
+        cachedPoints -= it->second.points->size();
+        cache.erase(it);
+        lru.pop_back();
+    }
+}
+
+void PointsOctree::setCacheBudget(uint64_t points)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cacheBudget = points;
+    evict();
+}
+
+void PointsOctree::collect(const std::vector<std::size_t>& indices, PointKernel& kernel) const
+{
+    std::vector<value_type>& basic = kernel.getBasicPoints();
+    for (std::size_t index : indices) {
+        std::shared_ptr<const std::vector<value_type>> points = getPoints(index);
+        basic.insert(basic.end(), points->begin(), points->end());
+    }
+}
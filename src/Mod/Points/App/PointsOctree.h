@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef POINTS_OCTREE_H
+#define POINTS_OCTREE_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Base/BoundBox.h>
+#include <Base/Vector3D.h>
+
+#include "Points.h"
+
+
+namespace Points
+{
+
+/**
+ * The PointsOctree is a level-of-detail octree for point clouds that are too
+ * big to be held in memory.
+ *
+ * Every node holds a subsample of the points inside its box: a point is kept
+ * by the node if its cell of a regular grid over the node is still free,
+ * otherwise it is passed to the child containing it. So the root is a coarse
+ * overview of the whole cloud and each level adds detail.
+ *
+ * Points are streamed in with add(). The upper levels are sampled on the fly,
+ * below the chunk depth the points are spooled to chunk files which are turned
+ * into subtrees one at a time by finish(). The points of every node are kept in
+ * a file of the cache directory and only loaded on demand, the most recently
+ * used nodes are kept in memory up to a budget.
+ */
+class PointsExport PointsOctree
+{
+public:
+    using value_type = PointKernel::value_type;
+
+    struct Node
+    {
+        Base::BoundBox3f box;
+        unsigned int depth {0};
+        /// indices of the children, -1 if there is no child in the octant
+        std::array<int32_t, 8> children {-1, -1, -1, -1, -1, -1, -1, -1};
+        /// number of points stored in the node itself
+        uint64_t count {0};
+    };
+
+    /** Creates an empty octree for the points inside \a box.
+     * The node files are written to \a cacheDir which is created if needed.
+     * \a gridSize is the number of grid cells per axis used to sample a node,
+     * below \a chunkDepth the points are spooled to disk until finish() is called.
+     */
+    PointsOctree(const std::string& cacheDir,
+                 const Base::BoundBox3f& box,
+                 unsigned int gridSize = 128,
+                 unsigned int chunkDepth = 4);
+    /// Opens an octree that has been built in \a cacheDir before.
+    explicit PointsOctree(const std::string& cacheDir);
+    ~PointsOctree();
+
+    PointsOctree(const PointsOctree&) = delete;
+    PointsOctree(PointsOctree&&) = delete;
+    PointsOctree& operator=(const PointsOctree&) = delete;
+    PointsOctree& operator=(PointsOctree&&) = delete;
+
+    /** @name Building */
+    //@{
+    /** Adds \a points to the octree. Points outside the bounding box of the
+     * octree are ignored. Returns the number of added points.
+     */
+    std::size_t add(const std::vector<value_type>& points);
+    /** Builds the subtrees of the spooled points and writes the index of the
+     * tree to the cache directory. Afterwards no further points can be added.
+     */
+    void finish();
+    /// Returns true if finish() has been called.
+    bool isFinished() const
+    {
+        return !build;
+    }
+    //@}
+
+    /** @name Querying */
+    //@{
+    /// Returns the number of points of the whole tree.
+    uint64_t size() const
+    {
+        return numPoints;
+    }
+    Base::BoundBox3f getBoundBox() const
+    {
+        return nodes.front().box;
+    }
+    const std::vector<Node>& getNodes() const
+    {
+        return nodes;
+    }
+    /** Returns the nodes to be displayed by a perspective view from \a eye.
+     * A node is selected if the ratio of its radius and the distance to \a eye is
+     * at least \a minSize and \a visible, if given, accepts its box. The nodes are
+     * chosen coarse to fine and nearest first until \a pointBudget is reached, so
+     * the parent of a selected node is always selected as well.
+     */
+    std::vector<std::size_t>
+    selectNodes(const Base::Vector3f& eye,
+                float minSize,
+                uint64_t pointBudget,
+                const std::function<bool(const Base::BoundBox3f&)>& visible = {}) const;
+    /** Returns the points of the node with index \a index. They are read from the
+     * cache directory if the node is not in memory.
+     */
+    std::shared_ptr<const std::vector<value_type>> getPoints(std::size_t index) const;
+    /// Appends the points of the given nodes to \a kernel.
+    void collect(const std::vector<std::size_t>& indices, PointKernel& kernel) const;
+    /// Sets the maximum number of points kept in memory by getPoints().
+    void setCacheBudget(uint64_t points);
+    //@}
+
+private:
+    struct BuildState;
+
+    void insert(const value_type& pnt);
+    std::size_t createChild(std::size_t index, int octant);
+    int getOctant(std::size_t index, const value_type& pnt) const;
+    uint32_t getCell(std::size_t index, const value_type& pnt) const;
+    void buildSubtree(std::size_t index, std::vector<value_type>& points);
+    void writeBuffers();
+    void writePoints(const std::string& file, const std::vector<value_type>& points) const;
+    std::vector<value_type> readPoints(const std::string& file, uint64_t count) const;
+    std::string nodeFile(std::size_t index) const;
+    std::string chunkFile(std::size_t index) const;
+    void saveIndex() const;
+    void loadIndex();
+    void evict() const;
+
+private:
+    std::string cacheDir;
+    unsigned int gridSize {128};
+    unsigned int chunkDepth {4};
+    uint64_t numPoints {0};
+    std::vector<Node> nodes;
+    std::unique_ptr<BuildState> build;
+
+    struct CacheEntry
+    {
+        std::shared_ptr<const std::vector<value_type>> points;
+        std::list<std::size_t>::iterator pos;
+    };
+    mutable std::mutex cacheMutex;
+    mutable std::list<std::size_t> lru;
+    mutable std::unordered_map<std::size_t, CacheEntry> cache;
+    mutable uint64_t cachedPoints {0};
+    uint64_t cacheBudget {10000000};
+};
+
+}  // namespace Points
+
+
+#endif  // POINTS_OCTREE_H
@@ -31,6 +31,7 @@
 #include <Base/VectorPy.h>
 
 #include "Points.h"
+#include "Tools.h"
 // inclusion of the generated files (generated out of PointsPy.xml)
 #include "PointsPy.h"
 #include "PointsPy.cpp"
@@ -65,6 +66,11 @@ int PointsPy::PyInit(PyObject* args, PyObject* /*kwd*/)
     if (PyObject_TypeCheck(pcObj, &(PointsPy::Type))) {
         *getPointKernelPtr() = *(static_cast<PointsPy*>(pcObj)->getPointKernelPtr());
     }
+    else if (PyObject_CheckBuffer(pcObj)) {
+        if (!addPoints(args)) {
+            return -1;
+        }
+    }
     else if (PyList_Check(pcObj)) {
         if (!addPoints(args)) {
             return -1;
@@ -159,6 +165,21 @@ PyObject* PointsPy::addPoints(PyObject* args)
         return nullptr;
     }
 
+    if (PyObject_CheckBuffer(obj)) {
+        PY_TRY
+        {
+            std::vector<float> coords = fromArray(obj, 3);
+            PointKernel* kernel = getPointKernelPtr();
+            kernel->reserve(kernel->size() + coords.size() / 3);
+            for (std::size_t i = 0; i < coords.size(); i += 3) {
+                kernel->push_back(Base::Vector3d(coords[i], coords[i + 1], coords[i + 2]));
+            }
+        }
+        PY_CATCH;
+
+        Py_Return;
+    }
+
     try {
         Py::Sequence list(obj);
         Py::Type vType(Base::getTypeAsObject(&Base::VectorPy::Type));
@@ -189,6 +210,33 @@ PyObject* PointsPy::addPoints(PyObject* args)
     Py_Return;
 }
 
+PyObject* PointsPy::getPointArray(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+
+    PY_TRY
+    {
+        const PointKernel* kernel = getPointKernelPtr();
+        const std::vector<Base::Vector3f>& points = kernel->getBasicPoints();
+        Base::Matrix4D mat = kernel->getTransform();
+        if (mat == Base::Matrix4D()) {
+            auto coords = reinterpret_cast<const float*>(points.data());  // NOLINT
+            return Py::new_reference_to(toArray(coords, points.size(), 3));
+        }
+
+        std::vector<Base::Vector3f> placed;
+        placed.reserve(points.size());
+        for (const auto& pnt : points) {
+            placed.push_back(mat * pnt);
+        }
+        auto coords = reinterpret_cast<const float*>(placed.data());  // NOLINT
+        return Py::new_reference_to(toArray(coords, placed.size(), 3));
+    }
+    PY_CATCH;
+}
+
 PyObject* PointsPy::fromSegment(PyObject* args)
 {
     PyObject* obj {};
@@ -39,11 +39,18 @@
 
 // STL
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <queue>
 #include <set>
 #include <sstream>
+#include <thread>
+#include <utility>
 #include <vector>
 
 // boost
@@ -53,6 +60,7 @@
 #include <boost/regex.hpp>
 
 // Qt
+#include <QFile>
 #include <QtConcurrentMap>
 
 #endif  //_PreComp_
@@ -37,6 +37,7 @@
 
 #include "Points.h"
 #include "Properties.h"
+#include "Tools.h"
 
 #ifdef _MSC_VER
 #include <ppl.h>
@@ -89,7 +90,10 @@ PyObject* PropertyGreyValueList::getPyObject()
 
 void PropertyGreyValueList::setPyObject(PyObject* value)
 {
-    if (PyList_Check(value)) {
+    if (PyObject_CheckBuffer(value)) {
+        setValues(fromArray(value, 1));
+    }
+    else if (PyList_Check(value)) {
         Py_ssize_t nSize = PyList_Size(value);
         std::vector<float> values;
         values.resize(nSize);
@@ -267,7 +271,16 @@ PyObject* PropertyNormalList::getPyObject()
 
 void PropertyNormalList::setPyObject(PyObject* value)
 {
-    if (PyList_Check(value)) {
+    if (PyObject_CheckBuffer(value)) {
+        std::vector<float> coords = fromArray(value, 3);
+        std::vector<Base::Vector3f> values;
+        values.reserve(coords.size() / 3);
+        for (std::size_t i = 0; i < coords.size(); i += 3) {
+            values.emplace_back(coords[i], coords[i + 1], coords[i + 2]);
+        }
+        setValues(values);
+    }
+    else if (PyList_Check(value)) {
         Py_ssize_t nSize = PyList_Size(value);
         std::vector<Base::Vector3f> values;
         values.resize(nSize);
@@ -382,17 +395,20 @@ void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
 
     aboutToSetValue();
 
-    // Rotate the normal vectors
+    // Rotate blocks of normals so that each task runs the vectorized batch kernel
+    const std::size_t blockSize = 8192;
+    std::vector<std::size_t> blocks;
+    for (std::size_t index = 0; index < _lValueList.size(); index += blockSize) {
+        blocks.push_back(index);
+    }
+    auto transformBlock = [this, &rot, blockSize](std::size_t& start) {
+        std::size_t count = std::min(blockSize, _lValueList.size() - start);
+        rot.multVec(&_lValueList[start], &_lValueList[start], count);
+    };
 #ifdef _MSC_VER
-    Concurrency::parallel_for_each(_lValueList.begin(),
-                                   _lValueList.end(),
-                                   [rot](Base::Vector3f& value) {
-                                       value = rot * value;
-                                   });
+    Concurrency::parallel_for_each(blocks.begin(), blocks.end(), transformBlock);
 #else
-    QtConcurrent::blockingMap(_lValueList, [rot](Base::Vector3f& value) {
-        rot.multVec(value, value);
-    });
+    QtConcurrent::blockingMap(blocks, transformBlock);
 #endif
 
     hasSetValue();
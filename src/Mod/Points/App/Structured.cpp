@@ -70,6 +70,13 @@ Structured::Structured()
     // Height.setStatus(App::Property::ReadOnly, true);
 }
 
+OrganizedCloud Structured::getCloud() const
+{
+    return {static_cast<int>(Width.getValue()),
+            static_cast<int>(Height.getValue()),
+            Points.getValue()};
+}
+
 App::DocumentObjectExecReturn* Structured::execute()
 {
     std::size_t size = Height.getValue() * Width.getValue();
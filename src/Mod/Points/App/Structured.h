@@ -24,6 +24,7 @@
 #ifndef POINTS_VIEW_FEATURE_H
 #define POINTS_VIEW_FEATURE_H
 
+#include "OrganizedCloud.h"
 #include "PointsFeature.h"
 
 
@@ -45,6 +46,11 @@ public:
     App::PropertyInteger Width;  /**< The width of the structured cloud. */
     App::PropertyInteger Height; /**< The height of the structured cloud. */
 
+    /** Returns a grid view of the points without copying them. The view is only
+     * valid as long as the Points property is not modified.
+     */
+    OrganizedCloud getCloud() const;
+
     /** @name methods override Feature */
     //@{
     /// recalculate the Feature
@@ -25,7 +25,11 @@
 #define POINTS_TOOLS_H
 
 #include <App/DocumentObject.h>
+#include <CXX/Objects.hxx>
 #include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
 
 namespace Points
 {
@@ -60,6 +64,68 @@ bool copyProperty(App::DocumentObject* target,
     return false;
 }
 
+/** Returns a writable memoryview of shape (count, width) holding a copy of the floats \a values.
+ * NumPy takes it without converting the items.
+ */
+inline Py::Object toArray(const float* values, std::size_t count, std::size_t width)
+{
+    auto size = Py_ssize_t(count * width * sizeof(float));
+    Py::Object bytes(PyByteArray_FromStringAndSize(nullptr, size), true);
+    if (size > 0) {
+        std::memcpy(PyByteArray_AsString(bytes.ptr()), values, size);
+    }
+
+    Py::Object view(PyMemoryView_FromObject(bytes.ptr()), true);
+    Py::Callable cast(view.getAttr("cast"));
+    // memoryview cannot cast to a shape with zeros
+    if (width == 1 || count == 0) {
+        return cast.apply(Py::TupleN(Py::String("f")));
+    }
+    Py::Tuple shape(2);
+    shape.setItem(0, Py::Long(static_cast<unsigned long>(count)));
+    shape.setItem(1, Py::Long(static_cast<unsigned long>(width)));
+    return cast.apply(Py::TupleN(Py::String("f"), shape));
+}
+
+/** Reads the items of a C contiguous buffer of 32 or 64 bit floats, e.g. a NumPy array, whose
+ * number of items is a multiple of \a width.
+ */
+inline std::vector<float> fromArray(PyObject* obj, std::size_t width)
+{
+    Py_buffer buf;
+    if (PyObject_GetBuffer(obj, &buf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        throw Py::Exception();
+    }
+
+    std::string format = buf.format ? buf.format : "B";
+    if (format.size() == 2 && format[0] == '@') {
+        format.erase(0, 1);
+    }
+    bool isFloat = format == "f" && buf.itemsize == sizeof(float);
+    bool isDouble = format == "d" && buf.itemsize == sizeof(double);
+    std::size_t count = buf.itemsize > 0 ? std::size_t(buf.len / buf.itemsize) : 0;
+
+    std::vector<float> values;
+    if (isFloat) {
+        values.assign(static_cast<const float*>(buf.buf),
+                      static_cast<const float*>(buf.buf) + count);  // NOLINT
+    }
+    else if (isDouble) {
+        values.assign(static_cast<const double*>(buf.buf),
+                      static_cast<const double*>(buf.buf) + count);  // NOLINT
+    }
+    PyBuffer_Release(&buf);
+
+    if (!isFloat && !isDouble) {
+        throw Py::TypeError(std::string("array of floats expected, not of type ") + format);
+    }
+    if (count % width != 0) {
+        throw Py::ValueError("The number of items of the array must be a multiple of "
+                             + std::to_string(width));
+    }
+    return values;
+}
+
 }  // namespace Points
 
 #endif  // POINTS_TOOLS_H
@@ -38,10 +38,13 @@
 #endif
 
 #include <App/Document.h>
+#include <Base/Tools2D.h>
 #include <Base/Vector3D.h>
+#include <Base/ViewProj.h>
 #include <Gui/Application.h>
 #include <Gui/Document.h>
 #include <Gui/Selection/SoFCSelection.h>
+#include <Gui/Utilities.h>
 #include <Gui/View3DInventorViewer.h>
 #include <Mod/Points/App/PointsFeature.h>
 #include <Mod/Points/App/Properties.h>
@@ -52,6 +55,39 @@
 using namespace PointsGui;
 using namespace Points;
 
+namespace
+{
+
+/** Projects the points into the view of \a vol and returns a flag for each of them that is 1
+ * if it lies inside \a polygon and 0 otherwise. Invalid points are never inside.
+ */
+std::vector<unsigned char> checkPoints(const Points::PointKernel& points,
+                                       const SbViewVolume& vol,
+                                       const Base::Polygon2d& polygon)
+{
+    // Coin's projection is expensive, so project with the composed matrix and test the
+    // points in blocks against the polygon
+    Gui::ViewVolumeProjection proj(vol);
+    Base::ViewProjMatrix fixedProj(proj.getComposedProjectionMatrix());
+    constexpr std::size_t blockSize = 4096;
+    std::vector<Base::Vector2d> block;
+    block.reserve(blockSize);
+    std::vector<unsigned char> inside(points.size());
+    std::size_t start = 0;
+    for (auto it = points.begin(); it != points.end();) {
+        block.clear();
+        for (; it != points.end() && block.size() < blockSize; ++it) {
+            Base::Vector3d pt = fixedProj(*it);
+            block.emplace_back(pt.x, pt.y);
+        }
+        polygon.Contains(block.data(), block.size(), inside.data() + start);
+        start += block.size();
+    }
+    return inside;
+}
+
+}  // namespace
+
 
 PROPERTY_SOURCE_ABSTRACT(PointsGui::ViewProviderPoints, Gui::ViewProviderGeometryObject)
 
@@ -461,17 +497,11 @@ void ViewProviderScattered::cut(const std::vector<SbVec2f>& picked,
     SbViewVolume vol = pCam->getViewVolume();
 
     // search for all points inside/outside the polygon
+    std::vector<unsigned char> inside = checkPoints(points, vol, cPoly);
     std::vector<unsigned long> removeIndices;
     removeIndices.reserve(points.size());
-
-    unsigned long index = 0;
-    for (Points::PointKernel::const_iterator jt = points.begin(); jt != points.end();
-         ++jt, ++index) {
-        SbVec3f pt(jt->x, jt->y, jt->z);
-
-        // project from 3d to 2d
-        vol.projectToScreen(pt, pt);
-        if (cPoly.Contains(Base::Vector2d(pt[0], pt[1]))) {
+    for (unsigned long index = 0; index < inside.size(); ++index) {
+        if (inside[index]) {
             removeIndices.push_back(index);
         }
     }
@@ -623,25 +653,19 @@ void ViewProviderStructured::cut(const std::vector<SbVec2f>& picked,
     SoCamera* pCam = Viewer.getSoRenderManager()->getCamera();
     SbViewVolume vol = pCam->getViewVolume();
 
-    // search for all points inside/outside the polygon
+    // search for all points inside/outside the polygon, invalid points are never inside
+    std::vector<unsigned char> inside = checkPoints(points, vol, cPoly);
     Points::PointKernel newKernel;
     newKernel.reserve(points.size());
 
     bool invalidatePoints = false;
     double nan = std::numeric_limits<double>::quiet_NaN();
+    std::size_t index = 0;
     for (const auto& point : points) {
-        // valid point?
         Base::Vector3d vec(point);
-        if (!(boost::math::isnan(point.x) || boost::math::isnan(point.y)
-              || boost::math::isnan(point.z))) {
-            SbVec3f pt(point.x, point.y, point.z);
-
-            // project from 3d to 2d
-            vol.projectToScreen(pt, pt);
-            if (cPoly.Contains(Base::Vector2d(pt[0], pt[1]))) {
-                invalidatePoints = true;
-                vec.Set(nan, nan, nan);
-            }
+        if (inside[index++]) {
+            invalidatePoints = true;
+            vec.Set(nan, nan, nan);
         }
 
         newKernel.push_back(vec);
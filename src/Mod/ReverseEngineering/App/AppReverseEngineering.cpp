@@ -78,7 +78,8 @@ public:
         add_keyword_method("approxSurface",&Module::approxSurface,
             "approxSurface(Points, UDegree=3, VDegree=3, NbUPoles=6, NbVPoles=6,\n"
             "Smooth=True, Weight=0.1, Grad=1.0, Bend=0.0, Curv=0.0\n"
-            "Iterations=5, Correction=True, PatchFactor=1.0, UVDirs=((ux, uy, uz), (vx, vy, vz)))\n\n"
+            "Iterations=5, Correction=True, PatchFactor=1.0, UVDirs=((ux, uy, uz), (vx, vy, vz)),\n"
+            "Sparse=False)\n\n"
             "Points: the input data (e.g. a point cloud or mesh)\n"
             "UDegree: the degree in u parametric direction\n"
             "VDegree: the degree in v parametric direction\n"
@@ -94,6 +95,7 @@ public:
             "PatchFactor: create an extended surface\n"
             "UVDirs: set the u,v parameter directions as tuple of two vectors\n"
             "        If not set then they will be determined by computing a best-fit plane\n"
+            "Sparse: use a sparse Cholesky solver, recommended for many points and poles\n"
         );
 #if defined(HAVE_PCL_SURFACE)
         add_keyword_method("triangulate",&Module::triangulate,
@@ -342,15 +344,16 @@ private:
         int iteration = 5;
         PyObject* correction = Py_True;
         double factor = 1.0;
+        PyObject* sparse = Py_False;
 
-        static const std::array<const char *, 15> kwds_approx{"Points", "UDegree", "VDegree", "NbUPoles", "NbVPoles",
+        static const std::array<const char *, 16> kwds_approx{"Points", "UDegree", "VDegree", "NbUPoles", "NbVPoles",
                                                               "Smooth", "Weight", "Grad", "Bend", "Curv", "Iterations",
-                                                              "Correction", "PatchFactor", "UVDirs", nullptr};
-        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O|iiiiO!ddddiO!dO!", kwds_approx,
+                                                              "Correction", "PatchFactor", "UVDirs", "Sparse", nullptr};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O|iiiiO!ddddiO!dO!O!", kwds_approx,
                                                  &o, &uDegree, &vDegree, &uPoles, &vPoles,
                                                  &PyBool_Type, &smooth, &weight, &grad, &bend, &curv,
                                                  &iteration, &PyBool_Type, &correction, &factor,
-                                                 &PyTuple_Type, &uvdirs)) {
+                                                 &PyTuple_Type, &uvdirs, &PyBool_Type, &sparse)) {
             throw Py::Exception();
         }
 
@@ -423,6 +426,7 @@ private:
                 pc.SetUV(u, v);
             }
             pc.EnableSmoothing(Base::asBoolean(smooth), weight, grad, bend, curv);
+            pc.EnableSparseSolver(Base::asBoolean(sparse));
             hSurf = pc.CreateSurface(clPoints, iteration, Base::asBoolean(correction), factor);
             if (!hSurf.IsNull()) {
                 return Py::asObject(new Part::BSplineSurfacePy(new Part::GeomBSplineSurface(hSurf)));
@@ -22,10 +22,14 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
-#include <QFuture>
-#include <QFutureWatcher>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
 #include <QtConcurrentMap>
 
+#include <Eigen/Sparse>
+
 #include <Geom_BSplineSurface.hxx>
 #include <Precision.hxx>
 #include <math_Gauss.hxx>
@@ -40,7 +44,6 @@
 
 
 using namespace Reen;
-namespace sp = std::placeholders;
 
 // SplineBasisfunction
 
@@ -964,12 +967,18 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
     double fMaxDiff = 0.0, fMaxScalar = 1.0;
     double fWeight = _fSmoothInfluence;
 
-    Base::SequencerLauncher seq("Calc surface...", iIter * _pvcPoints->Length());
+    // The points are corrected in blocks, each block keeps track of its largest
+    // parameter change and the smallest angle between normal and error vector
+    const int blockSize = 4096;
+    int numPoints = _pvcPoints->Length();
+    int numBlocks = (numPoints + blockSize - 1) / blockSize;
+    std::vector<int> blocks(numBlocks);
+    std::iota(blocks.begin(), blocks.end(), 0);
+    std::vector<std::pair<double, double>> limits(numBlocks);
 
-    do {
-        fMaxScalar = 1.0;
-        fMaxDiff = 0.0;
+    Base::SequencerLauncher seq("Calc surface...", iIter);
 
+    do {
         Handle(Geom_BSplineSurface) pclBSplineSurf = new Geom_BSplineSurface(_vCtrlPntsOfSurf,
                                                                              _vUKnots,
                                                                              _vVKnots,
@@ -978,51 +987,68 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
                                                                              _usUOrder - 1,
                                                                              _usVOrder - 1);
 
-        for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-            double fDeltaU, fDeltaV, fU, fV;
-            const gp_Pnt& pnt = (*_pvcPoints)(ii);
-            gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
-            gp_Pnt PntX;
-            gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
-            // Calculate the first two derivatives and point at (u,v)
-            gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
-            pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
-            gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
-            gp_Vec ErrorVec = X - P;
-
-            // Calculate Xu x Xv the normal in X(u,v)
-            gp_Dir clNormal = Xu ^ Xv;
-
-            // Check, if X = P
-            if (!(X.IsEqual(P, 0.001, 0.001))) {
-                ErrorVec.Normalize();
-                if (fabs(clNormal * ErrorVec) < fMaxScalar) {
-                    fMaxScalar = fabs(clNormal * ErrorVec);
+        auto correct = [&](int block) {
+            double fBlockDiff = 0.0, fBlockScalar = 1.0;
+            int first = _pvcPoints->Lower() + block * blockSize;
+            int last = std::min(first + blockSize - 1, _pvcPoints->Upper());
+            for (int ii = first; ii <= last; ii++) {
+                double fDeltaU, fDeltaV, fU, fV;
+                const gp_Pnt& pnt = (*_pvcPoints)(ii);
+                gp_Vec P(pnt.X(), pnt.Y(), pnt.Z());
+                gp_Pnt PntX;
+                gp_Vec Xu, Xv, Xuv, Xuu, Xvv;
+                // Calculate the first two derivatives and point at (u,v)
+                gp_Pnt2d& uvValue = (*_pvcUVParam)(ii);
+                pclBSplineSurf->D2(uvValue.X(), uvValue.Y(), PntX, Xu, Xv, Xuu, Xvv, Xuv);
+                gp_Vec X(PntX.X(), PntX.Y(), PntX.Z());
+                gp_Vec ErrorVec = X - P;
+
+                // Calculate Xu x Xv the normal in X(u,v)
+                gp_Dir clNormal = Xu ^ Xv;
+
+                // Check, if X = P
+                if (!(X.IsEqual(P, 0.001, 0.001))) {
+                    ErrorVec.Normalize();
+                    if (fabs(clNormal * ErrorVec) < fBlockScalar) {
+                        fBlockScalar = fabs(clNormal * ErrorVec);
+                    }
                 }
-            }
 
-            fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
-            if (fabs(fDeltaU) < Precision::Confusion()) {
-                fDeltaU = 0.0;
-            }
-            fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
-            if (fabs(fDeltaV) < Precision::Confusion()) {
-                fDeltaV = 0.0;
-            }
+                fDeltaU = ((P - X) * Xu) / ((P - X) * Xuu - Xu * Xu);
+                if (fabs(fDeltaU) < Precision::Confusion()) {
+                    fDeltaU = 0.0;
+                }
+                fDeltaV = ((P - X) * Xv) / ((P - X) * Xvv - Xv * Xv);
+                if (fabs(fDeltaV) < Precision::Confusion()) {
+                    fDeltaV = 0.0;
+                }
 
-            // Replace old u/v values with new ones
-            fU = uvValue.X() - fDeltaU;
-            fV = uvValue.Y() - fDeltaV;
-            if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
-                uvValue.SetX(fU);
-                uvValue.SetY(fV);
-                fMaxDiff = std::max<double>(fabs(fDeltaU), fMaxDiff);
-                fMaxDiff = std::max<double>(fabs(fDeltaV), fMaxDiff);
+                // Replace old u/v values with new ones
+                fU = uvValue.X() - fDeltaU;
+                fV = uvValue.Y() - fDeltaV;
+                if (fU <= 1.0 && fU >= 0.0 && fV <= 1.0 && fV >= 0.0) {
+                    uvValue.SetX(fU);
+                    uvValue.SetY(fV);
+                    fBlockDiff = std::max<double>(fabs(fDeltaU), fBlockDiff);
+                    fBlockDiff = std::max<double>(fabs(fDeltaV), fBlockDiff);
+                }
             }
 
-            seq.next();
+            limits[block] = std::make_pair(fBlockDiff, fBlockScalar);
+        };
+
+        // The surface has no evaluation cache and thus can be evaluated by several threads
+        QtConcurrent::blockingMap(blocks, correct);
+
+        fMaxDiff = 0.0;
+        fMaxScalar = 1.0;
+        for (const auto& it : limits) {
+            fMaxDiff = std::max<double>(it.first, fMaxDiff);
+            fMaxScalar = std::min<double>(it.second, fMaxScalar);
         }
 
+        seq.next();
+
         if (_bSmoothing) {
             fWeight *= 0.5f;
             SolveWithSmoothing(fWeight);
@@ -1035,11 +1061,232 @@ void BSplineParameterCorrection::DoParameterCorrection(int iIter)
     } while (i < iIter && fMaxDiff > Precision::Confusion() && fMaxScalar < 0.99);
 }
 
+namespace Reen
+{
+/**
+ * The normal equations N^T*N*x = N^T*b of the least-squares problem.
+ * Since a point only lies in the support of uOrder*vOrder basis functions a control
+ * point is only coupled with the (2*uOrder-1)*(2*vOrder-1) control points around it.
+ * So only these entries of N^T*N are stored.
+ */
+class NormalEquations
+{
+public:
+    NormalEquations(unsigned uCtrl, unsigned vCtrl, unsigned uOrder, unsigned vOrder)
+        : uCtrl(static_cast<int>(uCtrl))
+        , vCtrl(static_cast<int>(vCtrl))
+        , uOrder(static_cast<int>(uOrder))
+        , vOrder(static_cast<int>(vOrder))
+        , uBand(2 * this->uOrder - 1)
+        , vBand(2 * this->vOrder - 1)
+        , band(std::size_t(uCtrl) * vCtrl * uBand * vBand, 0.0)
+        , rhs(std::size_t(uCtrl) * vCtrl * 3, 0.0)
+        , values(std::size_t(uOrder) * vOrder)
+    {}
+
+    /**
+     * Adds the equation of the point \a pnt. The non-zero basis functions at its
+     * parameter start with the indices \a firstU and \a firstV.
+     */
+    void add(int firstU,
+             int firstV,
+             const TColStd_Array1OfReal& basisU,
+             const TColStd_Array1OfReal& basisV,
+             const gp_Pnt& pnt)
+    {
+        for (int a = 0; a < uOrder; a++) {
+            for (int b = 0; b < vOrder; b++) {
+                values[a * vOrder + b] = basisU(a) * basisV(b);
+            }
+        }
+
+        for (int a = 0; a < uOrder; a++) {
+            for (int b = 0; b < vOrder; b++) {
+                double value = values[a * vOrder + b];
+                if (value == 0.0) {
+                    continue;
+                }
+
+                int row = (firstU + a) * vCtrl + firstV + b;
+                rhs[3 * row] += value * pnt.X();
+                rhs[3 * row + 1] += value * pnt.Y();
+                rhs[3 * row + 2] += value * pnt.Z();
+
+                for (int c = 0; c < uOrder; c++) {
+                    for (int d = 0; d < vOrder; d++) {
+                        band[index(row, c - a, d - b)] += value * values[c * vOrder + d];
+                    }
+                }
+            }
+        }
+    }
+
+    void add(const NormalEquations& other)
+    {
+        std::transform(band.begin(), band.end(), other.band.begin(), band.begin(), std::plus<>());
+        std::transform(rhs.begin(), rhs.end(), other.rhs.begin(), rhs.begin(), std::plus<>());
+    }
+
+    /**
+     * Calls \a func(row, col, value) for all non-zero entries of N^T*N.
+     */
+    template<typename Func>
+    void forEach(Func&& func) const
+    {
+        for (int j = 0; j < uCtrl; j++) {
+            for (int k = 0; k < vCtrl; k++) {
+                int row = j * vCtrl + k;
+                for (int dj = 1 - uOrder; dj < uOrder; dj++) {
+                    if (j + dj < 0 || j + dj >= uCtrl) {
+                        continue;
+                    }
+                    for (int dk = 1 - vOrder; dk < vOrder; dk++) {
+                        if (k + dk < 0 || k + dk >= vCtrl) {
+                            continue;
+                        }
+                        double value = band[index(row, dj, dk)];
+                        if (value != 0.0) {
+                            func(row, (j + dj) * vCtrl + k + dk, value);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * Returns the right side N^T*b with the x, y and z components of a control point
+     * next to each other.
+     */
+    const std::vector<double>& getRightSide() const
+    {
+        return rhs;
+    }
+
+private:
+    std::size_t index(int row, int dj, int dk) const
+    {
+        return (std::size_t(row) * uBand + dj + uOrder - 1) * vBand + dk + vOrder - 1;
+    }
+
+private:
+    int uCtrl;
+    int vCtrl;
+    int uOrder;
+    int vOrder;
+    int uBand;
+    int vBand;
+    std::vector<double> band;
+    std::vector<double> rhs;
+    std::vector<double> values;
+};
+}  // namespace Reen
+
+NormalEquations BSplineParameterCorrection::CalcNormalEquations() const
+{
+    NormalEquations normal(_usUCtrlpoints, _usVCtrlpoints, _usUOrder, _usVOrder);
+
+    // Every block of points is assembled into its own matrix, they are added up in
+    // a fixed order afterwards so that the result doesn't depend on the scheduling
+    const int blockSize = 16384;
+    int numPoints = _pvcPoints->Length();
+    int numBlocks = (numPoints + blockSize - 1) / blockSize;
+    std::vector<NormalEquations> parts(numBlocks, normal);
+    std::vector<int> blocks(numBlocks);
+    std::iota(blocks.begin(), blocks.end(), 0);
+
+    auto assemble = [&](int block) {
+        // The methods of the basis functions are not const, so use a copy per block
+        BSplineBasis clUSpline(_clUSpline);
+        BSplineBasis clVSpline(_clVSpline);
+        TColStd_Array1OfReal basisU(0, _usUOrder - 1);
+        TColStd_Array1OfReal basisV(0, _usVOrder - 1);
+        int first = block * blockSize;
+        int last = std::min(first + blockSize, numPoints);
+        for (int i = first; i < last; i++) {
+            const gp_Pnt2d& uvValue = (*_pvcUVParam)(_pvcUVParam->Lower() + i);
+            double fU = std::clamp(uvValue.X(), 0.0, 1.0);
+            double fV = std::clamp(uvValue.Y(), 0.0, 1.0);
+            clUSpline.AllBasisFunctions(fU, basisU);
+            clVSpline.AllBasisFunctions(fV, basisV);
+            int firstU = clUSpline.FindSpan(fU) - static_cast<int>(_usUOrder) + 1;
+            int firstV = clVSpline.FindSpan(fV) - static_cast<int>(_usVOrder) + 1;
+            parts[block].add(firstU,
+                             firstV,
+                             basisU,
+                             basisV,
+                             (*_pvcPoints)(_pvcPoints->Lower() + i));
+        }
+    };
+
+    QtConcurrent::blockingMap(blocks, assemble);
+
+    for (const auto& it : parts) {
+        normal.add(it);
+    }
+
+    return normal;
+}
+
+bool BSplineParameterCorrection::SolveSparse(const NormalEquations& normal, double fWeight)
+{
+    int ulDim = static_cast<int>(_usUCtrlpoints * _usVCtrlpoints);
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    normal.forEach([&triplets](int row, int col, double value) {
+        triplets.emplace_back(row, col, value);
+    });
+    if (fWeight != 0.0) {
+        for (int i = 0; i < ulDim; i++) {
+            for (int j = 0; j < ulDim; j++) {
+                double value = _clSmoothMatrix(i, j);
+                if (value != 0.0) {
+                    triplets.emplace_back(i, j, fWeight * value);
+                }
+            }
+        }
+    }
+
+    // Duplicated entries are summed up
+    Eigen::SparseMatrix<double> MTM(ulDim, ulDim);
+    MTM.setFromTriplets(triplets.begin(), triplets.end());
+
+    const std::vector<double>& rhs = normal.getRightSide();
+    Eigen::MatrixX3d Mb(ulDim, 3);
+    for (int i = 0; i < ulDim; i++) {
+        Mb.row(i) << rhs[3 * i], rhs[3 * i + 1], rhs[3 * i + 2];
+    }
+
+    // Solve the symmetric system with a sparse Cholesky decomposition
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver(MTM);
+    if (solver.info() != Eigen::Success) {
+        return false;
+    }
+    Eigen::MatrixX3d X = solver.solve(Mb);
+    if (solver.info() != Eigen::Success || !X.allFinite()) {
+        return false;
+    }
+
+    int ulIdx = 0;
+    for (unsigned j = 0; j < _usUCtrlpoints; j++) {
+        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
+            _vCtrlPntsOfSurf(j, k) = gp_Pnt(X(ulIdx, 0), X(ulIdx, 1), X(ulIdx, 2));
+            ulIdx++;
+        }
+    }
+
+    return true;
+}
+
 bool BSplineParameterCorrection::SolveWithoutSmoothing()
 {
+    if (_bSparseSolver) {
+        return SolveSparse(CalcNormalEquations(), 0.0);
+    }
+
     unsigned ulSize = _pvcPoints->Length();
     unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
+    math_Matrix M(0, ulSize - 1, 0, ulDim - 1, 0.0);
     math_Matrix Xx(0, ulDim - 1, 0, 0);
     math_Matrix Xy(0, ulDim - 1, 0, 0);
     math_Matrix Xz(0, ulDim - 1, 0, 0);
@@ -1048,35 +1295,21 @@ bool BSplineParameterCorrection::SolveWithoutSmoothing()
     math_Vector bz(0, ulSize - 1);
 
     // Determining the coefficient matrix of the overdetermined LGS
+    // Only the basis functions whose support contains (u,v) are non-zero
+    TColStd_Array1OfReal basisU(0, _usUOrder - 1);
+    TColStd_Array1OfReal basisV(0, _usVOrder - 1);
     for (unsigned i = 0; i < ulSize; i++) {
         const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        unsigned ulIdx = 0;
-
-        // Pre-calculation of the values of the base functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
-        }
-
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
-                }
+        double fU = std::clamp(uvValue.X(), 0.0, 1.0);
+        double fV = std::clamp(uvValue.Y(), 0.0, 1.0);
+        _clUSpline.AllBasisFunctions(fU, basisU);
+        _clVSpline.AllBasisFunctions(fV, basisV);
+        unsigned firstU = _clUSpline.FindSpan(fU) - _usUOrder + 1;
+        unsigned firstV = _clVSpline.FindSpan(fV) - _usVOrder + 1;
+
+        for (unsigned j = 0; j < _usUOrder; j++) {
+            for (unsigned k = 0; k < _usVOrder; k++) {
+                M(i, (firstU + j) * _usVCtrlpoints + firstV + k) = basisU(j) * basisV(k);
             }
         }
     }
@@ -1113,145 +1346,50 @@ bool BSplineParameterCorrection::SolveWithoutSmoothing()
     return true;
 }
 
-namespace Reen
-{
-class ScalarProduct
+bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
 {
-public:
-    explicit ScalarProduct(const math_Matrix& mat)
-        : mat(mat)
-    {}
-    std::vector<double> multiply(int col) const
-    {
-        math_Vector vec = mat.Col(col);
-        std::vector<double> out(mat.ColNumber());
-        for (int n = mat.LowerCol(); n <= mat.UpperCol(); n++) {
-            out[n] = vec * mat.Col(n);
-        }
-        return out;
+    // The normal equations are assembled directly from the non-zero basis functions
+    // instead of multiplying the dense coefficient matrix with its transpose
+    NormalEquations normal = CalcNormalEquations();
+    if (_bSparseSolver) {
+        return SolveSparse(normal, fWeight);
     }
 
-private:
-    const math_Matrix& mat;
-};
-}  // namespace Reen
-
-bool BSplineParameterCorrection::SolveWithSmoothing(double fWeight)
-{
-    unsigned ulSize = _pvcPoints->Length();
     unsigned ulDim = _usUCtrlpoints * _usVCtrlpoints;
-    math_Matrix M(0, ulSize - 1, 0, ulDim - 1);
+    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1, 0.0);
     math_Vector Xx(0, ulDim - 1);
     math_Vector Xy(0, ulDim - 1);
     math_Vector Xz(0, ulDim - 1);
-    math_Vector bx(0, ulSize - 1);
-    math_Vector by(0, ulSize - 1);
-    math_Vector bz(0, ulSize - 1);
     math_Vector Mbx(0, ulDim - 1);
     math_Vector Mby(0, ulDim - 1);
     math_Vector Mbz(0, ulDim - 1);
 
-    // Determining the coefficient matrix of the overdetermined LGS
-    for (unsigned i = 0; i < ulSize; i++) {
-        const gp_Pnt2d& uvValue = (*_pvcUVParam)(i);
-        double fU = uvValue.X();
-        double fV = uvValue.Y();
-        int ulIdx = 0;
-
-        // Pre-calculation of the values of the basis functions
-        std::vector<double> basisU(_usUCtrlpoints);
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            basisU[j] = _clUSpline.BasisFunction(j, fU);
-        }
-        std::vector<double> basisV(_usVCtrlpoints);
-        for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-            basisV[k] = _clVSpline.BasisFunction(k, fV);
-        }
+    normal.forEach([&MTM](int row, int col, double value) {
+        MTM(row, col) = value;
+    });
 
-        for (unsigned j = 0; j < _usUCtrlpoints; j++) {
-            double valueU = basisU[j];
-            if (valueU == 0.0) {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = 0.0;
-                    ulIdx++;
-                }
-            }
-            else {
-                for (unsigned k = 0; k < _usVCtrlpoints; k++) {
-                    M(i, ulIdx) = valueU * basisV[k];
-                    ulIdx++;
-                }
-            }
-        }
-    }
-
-    // The product of its transform and itself results in the quadratic
-    // system matrix (slowly)
-#if 0
-    math_Matrix MTM = M.TMultiply(M);
-#elif 0
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    for (unsigned m = 0; m < ulDim; m++) {
-        math_Vector Mm = M.Col(m);
-        for (unsigned n = m; n < ulDim; n++) {
-            MTM(m, n) = MTM(n, m) = Mm * M.Col(n);
-        }
-    }
-#else  // multi-threaded
-    std::vector<int> columns(ulDim);
-    std::generate(columns.begin(), columns.end(), Base::iotaGen<int>(0));
-    ScalarProduct scalar(M);
-    // NOLINTBEGIN
-    QFuture<std::vector<double>> future =
-        QtConcurrent::mapped(columns, std::bind(&ScalarProduct::multiply, &scalar, sp::_1));
-    // NOLINTEND
-    QFutureWatcher<std::vector<double>> watcher;
-    watcher.setFuture(future);
-    watcher.waitForFinished();
-
-    math_Matrix MTM(0, ulDim - 1, 0, ulDim - 1);
-    int rowIndex = 0;
-    for (const auto& it : future) {
-        int colIndex = 0;
-        for (std::vector<double>::const_iterator jt = it.begin(); jt != it.end();
-             ++jt, colIndex++) {
-            MTM(rowIndex, colIndex) = *jt;
-        }
-        rowIndex++;
-    }
-#endif
-
-    // Determine the right side
-    for (int ii = _pvcPoints->Lower(); ii <= _pvcPoints->Upper(); ii++) {
-        const gp_Pnt& pnt = (*_pvcPoints)(ii);
-        bx(ii) = pnt.X();
-        by(ii) = pnt.Y();
-        bz(ii) = pnt.Z();
-    }
+    const std::vector<double>& rhs = normal.getRightSide();
     for (unsigned i = 0; i < ulDim; i++) {
-        math_Vector Mi = M.Col(i);
-        Mbx(i) = Mi * bx;
-        Mby(i) = Mi * by;
-        Mbz(i) = Mi * bz;
+        Mbx(i) = rhs[3 * i];
+        Mby(i) = rhs[3 * i + 1];
+        Mbz(i) = rhs[3 * i + 2];
     }
 
     // Solve the LGS with the LU decomposition
-    math_Gauss mgGaussX(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussY(MTM + fWeight * _clSmoothMatrix);
-    math_Gauss mgGaussZ(MTM + fWeight * _clSmoothMatrix);
+    math_Gauss mgGauss(MTM + fWeight * _clSmoothMatrix);
 
-    mgGaussX.Solve(Mbx, Xx);
-    if (!mgGaussX.IsDone()) {
+    mgGauss.Solve(Mbx, Xx);
+    if (!mgGauss.IsDone()) {
         return false;
     }
 
-    mgGaussY.Solve(Mby, Xy);
-    if (!mgGaussY.IsDone()) {
+    mgGauss.Solve(Mby, Xy);
+    if (!mgGauss.IsDone()) {
         return false;
     }
 
-    mgGaussZ.Solve(Mbz, Xz);
-    if (!mgGaussZ.IsDone()) {
+    mgGauss.Solve(Mbz, Xz);
+    if (!mgGauss.IsDone()) {
         return false;
     }
 
@@ -1384,6 +1522,11 @@ void BSplineParameterCorrection::EnableSmoothing(bool bSmooth,
     ParameterCorrection::EnableSmoothing(bSmooth, fSmoothInfl);
 }
 
+void BSplineParameterCorrection::EnableSparseSolver(bool bSparse)
+{
+    _bSparseSolver = bSparse;
+}
+
 const math_Matrix& BSplineParameterCorrection::GetFirstSmoothMatrix() const
 {
     return _clFirstMatrix;
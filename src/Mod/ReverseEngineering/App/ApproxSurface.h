@@ -372,6 +372,8 @@ protected:
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
+class NormalEquations;
+
 /**
  * This class calculates a B-spline area on any point cloud (AKA scattered data).
  * The surface is generated iteratively with the help of a parameter correction.
@@ -414,6 +416,18 @@ protected:
      */
     bool SolveWithSmoothing(double fWeight) override;
 
+    /**
+     * Assembles the normal equations of the least-squares problem from the
+     * non-zero basis functions at the parameters of the points
+     */
+    NormalEquations CalcNormalEquations() const;
+
+    /**
+     * Solve the normal equations with a sparse Cholesky decomposition. Depending on
+     * the weighting, smoothing terms are included
+     */
+    bool SolveSparse(const NormalEquations& normal, double fWeight);
+
 public:
     /**
      * Setting the knot vector
@@ -466,6 +480,12 @@ public:
     virtual void
     EnableSmoothing(bool bSmooth, double fSmoothInfl, double fFirst, double fSec, double fThird);
 
+    /**
+     * Solve the normal equations with a sparse Cholesky decomposition instead of the
+     * dense solvers. This is much faster for large control nets.
+     */
+    void EnableSparseSolver(bool bSparse = true);
+
 protected:
     /**
      * Calculates the matrix for the smoothing terms
@@ -497,6 +517,7 @@ protected:
     math_Matrix _clFirstMatrix;   //! Matrix of the 1st smoothing functionals
     math_Matrix _clSecondMatrix;  //! Matrix of the 2nd smoothing functionals
     math_Matrix _clThirdMatrix;   //! Matrix of the 3rd smoothing functionals
+    bool _bSparseSolver {false};  //! Use the sparse Cholesky solver
 };
 
 }  // namespace Reen
@@ -41,11 +41,17 @@
 #ifdef _PreComp_
 
 // standard
+#include <algorithm>
+#include <functional>
 #include <map>
+#include <numeric>
 
 // boost
 #include <boost/math/special_functions/fpclassify.hpp>
 
+// Eigen
+#include <Eigen/Sparse>
+
 // OpenCasCade
 #include <Geom_BSplineSurface.hxx>
 #include <Precision.hxx>
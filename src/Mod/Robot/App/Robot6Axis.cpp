@@ -237,12 +237,7 @@ bool Robot6Axis::setTo(const Placement& To)
     JntArray result(Kinematic.getNrOfJoints());
 
     // Set destination frame
-    Frame F_dest =
-        Frame(KDL::Rotation::Quaternion(To.getRotation()[0],
-                                        To.getRotation()[1],
-                                        To.getRotation()[2],
-                                        To.getRotation()[3]),
-              KDL::Vector(To.getPosition()[0], To.getPosition()[1], To.getPosition()[2]));
+    Frame F_dest = toFrame(To);
 
     // solve
     if (iksolver1.CartToJnt(Actual, F_dest, result) < 0) {
@@ -255,6 +250,34 @@ bool Robot6Axis::setTo(const Placement& To)
     }
 }
 
+std::vector<bool> Robot6Axis::solve(const std::vector<Base::Placement>& To,
+                                    std::vector<std::array<double, 6>>& Axis) const
+{
+    // the same solvers as setTo() uses, created once for all the positions
+    ChainFkSolverPos_recursive fksolver1(Kinematic);
+    ChainIkSolverVel_pinv iksolver1v(Kinematic);
+    ChainIkSolverPos_NR_JL iksolver1(Kinematic, Min, Max, fksolver1, iksolver1v, 100, 1e-6);
+
+    std::vector<bool> reached(To.size(), false);
+    Axis.assign(To.size(), {});
+
+    // warm start every position from the last solution, that keeps the robot in the same
+    // configuration along the path and needs only a few iterations for close positions
+    JntArray start = Actual;
+    JntArray result(Kinematic.getNrOfJoints());
+    for (std::size_t i = 0; i < To.size(); i++) {
+        if (iksolver1.CartToJnt(start, toFrame(To[i]), result) < 0) {
+            continue;
+        }
+        start = result;
+        reached[i] = true;
+        for (int j = 0; j < 6; j++) {
+            Axis[i][j] = RotDir[j] * Base::toDegrees<double>(result(j));
+        }
+    }
+    return reached;
+}
+
 Base::Placement Robot6Axis::getTcp()
 {
     double x, y, z, w;
@@ -23,6 +23,9 @@
 #ifndef ROBOT_ROBOT6AXLE_H
 #define ROBOT_ROBOT6AXLE_H
 
+#include <array>
+#include <vector>
+
 #include "kdl_cp/chain.hpp"
 #include "kdl_cp/jntarray.hpp"
 #include <Base/Persistence.h>
@@ -69,6 +72,13 @@ public:
 
     /// set the robot to that position, calculates the Axis
     bool setTo(const Base::Placement& To);
+    /** Calculates the Axis (in degrees) for a sequence of positions like calling setTo() for
+     * each of them in turn, but sets up the solver only once. Every position starts from the
+     * solution of the previous reachable one, the robot itself is not moved. The Axis of an
+     * unreachable position are left at 0, the returned flags tell which ones were reached.
+     */
+    std::vector<bool> solve(const std::vector<Base::Placement>& To,
+                            std::vector<std::array<double, 6>>& Axis) const;
     bool setAxis(int Axis, double Value);
     double getAxis(int Axis);
     double getMaxAngle(int Axis);
@@ -77,6 +77,45 @@ PyObject* Robot6AxisPy::check(PyObject* /*args*/)
     return nullptr;
 }
 
+PyObject* Robot6AxisPy::solve(PyObject* args) const
+{
+    PyObject* o;
+    if (!PyArg_ParseTuple(args, "O", &o)) {
+        return nullptr;
+    }
+
+    try {
+        std::vector<Base::Placement> placements;
+        Py::Sequence list(o);
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it) {
+            if (!PyObject_TypeCheck((*it).ptr(), &(Base::PlacementPy::Type))) {
+                throw Py::TypeError("sequence of placements expected");
+            }
+            placements.push_back(*static_cast<Base::PlacementPy*>((*it).ptr())->getPlacementPtr());
+        }
+
+        std::vector<std::array<double, 6>> axis;
+        std::vector<bool> reached = getRobot6AxisPtr()->solve(placements, axis);
+
+        Py::List result;
+        for (std::size_t i = 0; i < reached.size(); i++) {
+            if (!reached[i]) {
+                result.append(Py::None());
+                continue;
+            }
+            Py::Tuple tuple(6);
+            for (int j = 0; j < 6; j++) {
+                tuple.setItem(j, Py::Float(axis[i][j]));
+            }
+            result.append(tuple);
+        }
+        return Py::new_reference_to(result);
+    }
+    catch (const Py::Exception&) {
+        return nullptr;
+    }
+}
+
 
 Py::Float Robot6AxisPy::getAxis1() const
 {
@@ -126,6 +126,26 @@ Placement Trajectory::getPosition(double time) const
     return {};
 }
 
+std::vector<Placement> Trajectory::getPositions(double step) const
+{
+    std::vector<Placement> positions;
+    if (!pcTrajectory || step <= 0.0) {
+        return positions;
+    }
+
+    double duration = pcTrajectory->Duration();
+    auto count = static_cast<std::size_t>(duration / step);
+    positions.reserve(count + 2);
+    for (std::size_t i = 0; i <= count; i++) {
+        positions.push_back(toPlacement(pcTrajectory->Pos(double(i) * step)));
+    }
+    // always end at the last Waypoint
+    if (double(count) * step < duration) {
+        positions.push_back(toPlacement(pcTrajectory->Pos(duration)));
+    }
+    return positions;
+}
+
 double Trajectory::getVelocity(double time) const
 {
     if (pcTrajectory) {
@@ -82,6 +82,8 @@ public:
     /// return the duration (s) of the Trajectory if -1 or of the Waypoint with the given number
     double getDuration(int n = -1) const;
     Base::Placement getPosition(double time) const;
+    /// return the positions every \a step seconds from the start up to the last Waypoint
+    std::vector<Base::Placement> getPositions(double step) const;
     double getVelocity(double time) const;
 
 
@@ -127,6 +127,24 @@ PyObject* TrajectoryPy::position(PyObject* args)
     return (new Base::PlacementPy(new Base::Placement(getTrajectoryPtr()->getPosition(pos))));
 }
 
+PyObject* TrajectoryPy::positions(PyObject* args) const
+{
+    double step;
+    if (!PyArg_ParseTuple(args, "d", &step)) {
+        return nullptr;
+    }
+    if (step <= 0.0) {
+        PyErr_SetString(PyExc_ValueError, "step must be positive");
+        return nullptr;
+    }
+
+    Py::List list;
+    for (const auto& pos : getTrajectoryPtr()->getPositions(step)) {
+        list.append(Py::asObject(new Base::PlacementPy(new Base::Placement(pos))));
+    }
+    return Py::new_reference_to(list);
+}
+
 PyObject* TrajectoryPy::velocity(PyObject* args)
 {
     double pos;
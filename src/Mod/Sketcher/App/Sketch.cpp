@@ -70,12 +70,12 @@ TYPESYSTEM_SOURCE(Sketcher::Sketch, Base::Persistence)
 Sketch::Sketch()
     : SolveTime(0)
     , RecalculateInitialSolutionWhileMovingPoint(false)
+    , MoveTimeBudget(0.04)
     , resolveAfterGeometryUpdated(false)
     , GCSsys()
     , ConstraintsCounter(0)
     , isInitMove(false)
     , isFine(true)
-    , moveStep(0)
     , defaultSolver(GCS::DogLeg)
     , defaultSolverRedundant(GCS::DogLeg)
     , debugMode(GCS::Minimal)
@@ -4624,7 +4624,11 @@ int Sketch::internalSolve(std::string& solvername, int level)
 
     if (isInitMove) {
         solvername = "DogLeg";  // DogLeg is used for dragging (same as before)
+        // a drag step has to keep up with the mouse, so it accepts a coarse solution if it
+        // runs out of time
+        GCSsys.DL_maxTime = MoveTimeBudget;
         ret = GCSsys.solve(isFine, GCS::DogLeg);
+        GCSsys.DL_maxTime = 0;
     }
     else {
         switch (defaultSolver) {
@@ -4657,6 +4661,11 @@ int Sketch::internalSolve(std::string& solvername, int level)
         }
         else {
             updateNonDrivingConstraints();
+            // warm start: the next drag step starts from this solution and keeps the
+            // subsystems (and their factorizations) of the drag
+            if (isInitMove && RecalculateInitialSolutionWhileMovingPoint) {
+                GCSsys.setReference();
+            }
         }
     }
     else {
@@ -5104,22 +5113,6 @@ int Sketch::moveGeometries(std::vector<GeoElementId> geoEltIds,
 
     if (!isInitMove) {
         initMove(geoEltIds);
-        initToPoint = toPoint;
-        moveStep = 0;
-    }
-    else {
-        if (!relative && RecalculateInitialSolutionWhileMovingPoint) {
-            if (moveStep == 0) {
-                moveStep = (toPoint - initToPoint).Length();
-            }
-            else {
-                // I am getting too far away from the original solution so reinit the solution
-                if ((toPoint - initToPoint).Length() > 20 * moveStep) {
-                    initMove(geoEltIds);
-                    initToPoint = toPoint;
-                }
-            }
-        }
     }
 
     if (relative) {
@@ -191,8 +191,8 @@ public:
     int moveGeometry(int geoId, PointPos pos, Base::Vector3d toPoint, bool relative = false);
 
     /**
-     * Sets whether the initial solution should be recalculated while dragging after a certain
-     * distance from the previous drag point for smoother dragging operation.
+     * Sets whether the initial solution should be recalculated while dragging for smoother
+     * dragging operation. Then every drag step is started from the solution of the previous one.
      */
     bool getRecalculateInitialSolutionWhileMovingPoint() const
     {
@@ -205,6 +205,20 @@ public:
         RecalculateInitialSolutionWhileMovingPoint = recalculateInitialSolutionWhileMovingPoint;
     }
 
+    /**
+     * Sets the time in seconds the solver may spend on a drag step, 0 means unlimited.
+     * If the time runs out a coarse solution is accepted.
+     */
+    double getMoveTimeBudget() const
+    {
+        return MoveTimeBudget;
+    }
+
+    void setMoveTimeBudget(double seconds)
+    {
+        MoveTimeBudget = seconds;
+    }
+
     /// add dedicated geometry
     //@{
     /// add a point
@@ -528,6 +542,7 @@ public:
 private:
     float SolveTime;
     bool RecalculateInitialSolutionWhileMovingPoint;
+    double MoveTimeBudget;
 
     // regulates a second solve for cases where there result of having update the geometry (e.g. via
     // OCCT) needs to be taken into account by the solver (for example to provide the right value of
@@ -612,8 +627,6 @@ private:
 
     bool isInitMove;
     bool isFine;
-    Base::Vector3d initToPoint;
-    double moveStep;
 
 public:
     GCS::Algorithm defaultSolver;
@@ -24,6 +24,11 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <cmath>
+#include <map>
+#include <numeric>
+#include <set>
+#include <tuple>
+#include <unordered_map>
 
 #include <BRep_Tool.hxx>
 #include <Precision.hxx>
@@ -60,29 +65,6 @@ struct VertexIds
     Sketcher::PointPos PosId {};
 };
 
-struct Vertex_Less
-{
-    explicit Vertex_Less(double tolerance)
-        : tolerance(tolerance)
-    {}
-    bool operator()(const VertexIds& x, const VertexIds& y) const
-    {
-        if (fabs(x.v.x - y.v.x) > tolerance) {
-            return x.v.x < y.v.x;
-        }
-        if (fabs(x.v.y - y.v.y) > tolerance) {
-            return x.v.y < y.v.y;
-        }
-        if (fabs(x.v.z - y.v.z) > tolerance) {
-            return x.v.z < y.v.z;
-        }
-        return false;  // points are considered to be equal
-    }
-
-private:
-    double tolerance;
-};
-
 struct VertexID_Less
 {
     bool operator()(const VertexIds& x, const VertexIds& y) const
@@ -256,126 +238,162 @@ struct PointConstraints
     {
         std::list<ConstraintIds> missingCoincidences;  // Holds the list of missing coincidences
 
-        // Sort points in geographic order
-        std::sort(vertexIds.begin(), vertexIds.end(), Vertex_Less(precision));
+        // Sort points in geographic order, the first vertex of a group of adjacent vertices is the
+        // one the others are compared with
+        std::sort(vertexIds.begin(), vertexIds.end(), [](const VertexIds& x, const VertexIds& y) {
+            return std::tie(x.v.x, x.v.y, x.v.z) < std::tie(y.v.x, y.v.y, y.v.z);
+        });
+
+        std::vector<std::vector<std::size_t>> vertexGrps = getAdjacentVertices(precision);
+        std::vector<std::size_t> vertexGrpOf(vertexIds.size());
+        for (std::size_t i = 0; i < vertexGrps.size(); i++) {
+            for (std::size_t index : vertexGrps[i]) {
+                vertexGrpOf[index] = i;
+            }
+        }
 
-        auto vt = vertexIds.begin();
-        Vertex_EqualTo pred(precision);
+        std::map<VertexIds, std::size_t, VertexID_Less> vertexIndex;
+        for (std::size_t i = 0; i < vertexIds.size(); i++) {
+            vertexIndex.emplace(vertexIds[i], i);
+        }
 
-        // Comparing existing constraints and find missing ones
-
-        while (vt < vertexIds.end()) {
-            // Seeking for adjacent group of vertices
-            vt = std::adjacent_find(vt, vertexIds.end(), pred);
-            if (vt < vertexIds.end()) {  // If one found
-                std::vector<VertexIds>::iterator vn;
-                // Holds a single group of adjacent vertices
-                std::set<VertexIds, VertexID_Less> vertexGrp;
-                // Extract the group of adjacent vertices
-                vertexGrp.insert(*vt);
-                for (vn = vt + 1; vn < vertexIds.end(); ++vn) {
-                    if (pred(*vt, *vn)) {
-                        vertexGrp.insert(*vn);
-                    }
-                    else {
-                        break;
-                    }
+        // Decompose the groups of adjacent vertices into groups of coincident vertices
+        // Going through existent coincidences. A vertex constrained to something outside of its
+        // group of adjacent vertices is left out together with the vertices coincident to it.
+        std::vector<std::size_t> coincGrpOf(vertexIds.size());
+        std::iota(coincGrpOf.begin(), coincGrpOf.end(), 0);
+        auto findCoincGrp = [&coincGrpOf](std::size_t index) {
+            while (coincGrpOf[index] != index) {
+                coincGrpOf[index] = coincGrpOf[coincGrpOf[index]];
+                index = coincGrpOf[index];
+            }
+            return index;
+        };
+        std::vector<std::size_t> leftOut;
+        for (auto& coincidence : allcoincid) {
+            VertexIds v1;
+            VertexIds v2;
+            v1.GeoId = coincidence->First;
+            v1.PosId = coincidence->FirstPos;
+            v2.GeoId = coincidence->Second;
+            v2.PosId = coincidence->SecondPos;
+
+            auto nv1 = vertexIndex.find(v1);
+            auto nv2 = vertexIndex.find(v2);
+            if (nv1 != vertexIndex.end() && nv2 != vertexIndex.end()
+                && vertexGrpOf[nv1->second] == vertexGrpOf[nv2->second]) {
+                coincGrpOf[findCoincGrp(nv1->second)] = findCoincGrp(nv2->second);
+            }
+            else {
+                if (nv1 != vertexIndex.end()) {
+                    leftOut.push_back(nv1->second);
                 }
+                if (nv2 != vertexIndex.end()) {
+                    leftOut.push_back(nv2->second);
+                }
+            }
+        }
 
-                // Holds groups of coincident vertices
-                std::vector<std::set<VertexIds, VertexID_Less>> coincVertexGrps;
-
-                // Decompose the group of adjacent vertices into groups of coincident vertices
-                // Going through existent coincidences
-                for (auto& coincidence : allcoincid) {
-                    VertexIds v1;
-                    VertexIds v2;
-                    v1.GeoId = coincidence->First;
-                    v1.PosId = coincidence->FirstPos;
-                    v2.GeoId = coincidence->Second;
-                    v2.PosId = coincidence->SecondPos;
-
-                    // Look if coincident vertices are in the group of adjacent ones we are
-                    // processing
-                    auto nv1 = vertexGrp.extract(v1);
-                    auto nv2 = vertexGrp.extract(v2);
-
-                    // Maybe if both empty, they already have been extracted by other coincidences
-                    // We have to check in existing coincident groups and eventually merge
-                    if (nv1.empty() && nv2.empty()) {
-                        std::set<VertexIds, VertexID_Less>* tempGrp = nullptr;
-                        for (auto it = coincVertexGrps.begin(); it < coincVertexGrps.end(); ++it) {
-                            if ((it->find(v1) != it->end()) || (it->find(v2) != it->end())) {
-                                if (!tempGrp) {
-                                    tempGrp = &*it;
-                                }
-                                else {
-                                    tempGrp->insert(it->begin(), it->end());
-                                    coincVertexGrps.erase(it);
-                                    break;
-                                }
-                            }
-                        }
-                        continue;
-                    }
-
-                    // Look if one of the constrained vertices is already in a group of coincident
-                    // vertices
-                    for (std::set<VertexIds, VertexID_Less>& grp : coincVertexGrps) {
-                        if ((grp.find(v1) != grp.end()) || (grp.find(v2) != grp.end())) {
-                            // If yes add them to the existing group
-                            if (!nv1.empty()) {
-                                grp.insert(nv1.value());
-                            }
-                            if (!nv2.empty()) {
-                                grp.insert(nv2.value());
-                            }
-                            continue;
-                        }
-                    }
+        std::vector<bool> isLeftOut(vertexIds.size(), false);
+        for (std::size_t index : leftOut) {
+            isLeftOut[findCoincGrp(index)] = true;
+        }
 
-                    if (nv1.empty() || nv2.empty()) {
-                        continue;
-                    }
+        for (auto& vertexGrp : vertexGrps) {
+            if (vertexGrp.size() < 2) {
+                continue;
+            }
 
-                    // If no, create a new group of coincident vertices
-                    std::set<VertexIds, VertexID_Less> newGrp;
-                    newGrp.insert(nv1.value());
-                    newGrp.insert(nv2.value());
-                    coincVertexGrps.push_back(newGrp);
+            // The first vertex of each group of coincident vertices, ordered by GeoId and PosId
+            std::sort(vertexGrp.begin(), vertexGrp.end(), [this](std::size_t x, std::size_t y) {
+                return VertexID_Less()(vertexIds[x], vertexIds[y]);
+            });
+            std::vector<std::size_t> coincGrps;
+            std::vector<std::size_t> firstVertices;
+            for (std::size_t index : vertexGrp) {
+                std::size_t grp = findCoincGrp(index);
+                if (!isLeftOut[grp]
+                    && std::find(coincGrps.begin(), coincGrps.end(), grp) == coincGrps.end()) {
+                    coincGrps.push_back(grp);
+                    firstVertices.push_back(index);
                 }
+            }
 
-                // If there are remaining vertices in the adjacent group (not in any existing
-                // constraint) add them as being each a separate coincident group
-                for (auto& lonept : vertexGrp) {
-                    std::set<VertexIds, VertexID_Less> newGrp;
-                    newGrp.insert(lonept);
-                    coincVertexGrps.push_back(newGrp);
-                }
+            // If there is more than 1 coincident group into adjacent group, constraint(s)
+            // is(are) missing Virtually generate the missing constraint(s)
+            // Starting from the 2nd coincident group, generate a constraint between
+            // this group first vertex, and previous group first vertex
+            for (std::size_t i = 1; i < firstVertices.size(); i++) {
+                const VertexIds& prev = vertexIds[firstVertices[i - 1]];
+                const VertexIds& next = vertexIds[firstVertices[i]];
+                ConstraintIds id;
+                id.Type = Coincident;  // default point on point restriction
+                id.v = prev.v;
+                id.First = prev.GeoId;
+                id.FirstPos = prev.PosId;
+                id.Second = next.GeoId;
+                id.SecondPos = next.PosId;
+                missingCoincidences.push_back(id);
+            }
+        }
 
-                // If there is more than 1 coincident group into adjacent group, constraint(s)
-                // is(are) missing Virtually generate the missing constraint(s)
-                if (coincVertexGrps.size() > 1) {
-                    std::vector<std::set<VertexIds, VertexID_Less>>::iterator vn;
-                    // Starting from the 2nd coincident group, generate a constraint between
-                    // this group first vertex, and previous group first vertex
-                    for (vn = coincVertexGrps.begin() + 1; vn < coincVertexGrps.end(); ++vn) {
-                        ConstraintIds id;
-                        id.Type = Coincident;  // default point on point restriction
-                        id.v = (vn - 1)->begin()->v;
-                        id.First = (vn - 1)->begin()->GeoId;
-                        id.FirstPos = (vn - 1)->begin()->PosId;
-                        id.Second = vn->begin()->GeoId;
-                        id.SecondPos = vn->begin()->PosId;
-                        missingCoincidences.push_back(id);
+        return missingCoincidences;
+    }
+
+private:
+    // Groups the sorted vertices: a group consists of the first vertex not yet grouped and all
+    // remaining vertices within precision of it. Candidates are looked up in a hash grid with a
+    // cell size of precision, so only the neighbouring cells of a vertex have to be searched.
+    std::vector<std::vector<std::size_t>> getAdjacentVertices(double precision) const
+    {
+        using Cell = std::pair<long long, long long>;
+        struct CellHash
+        {
+            std::size_t operator()(const Cell& cell) const
+            {
+                return std::hash<long long>()(cell.first * 73856093LL ^ cell.second * 19349663LL);
+            }
+        };
+
+        double cellSize = precision > 0.0 ? precision : 1.0;
+        auto getCell = [cellSize](const Base::Vector3d& pnt) {
+            return Cell(static_cast<long long>(std::floor(pnt.x / cellSize)),
+                        static_cast<long long>(std::floor(pnt.y / cellSize)));
+        };
+
+        std::unordered_map<Cell, std::vector<std::size_t>, CellHash> grid;
+        for (std::size_t i = 0; i < vertexIds.size(); i++) {
+            grid[getCell(vertexIds[i].v)].push_back(i);
+        }
+
+        Vertex_EqualTo pred(precision);
+        std::vector<bool> grouped(vertexIds.size(), false);
+        std::vector<std::vector<std::size_t>> vertexGrps;
+        for (std::size_t i = 0; i < vertexIds.size(); i++) {
+            if (grouped[i]) {
+                continue;
+            }
+
+            std::vector<std::size_t> vertexGrp;
+            Cell cell = getCell(vertexIds[i].v);
+            for (long long x = cell.first - 1; x <= cell.first + 1; x++) {
+                for (long long y = cell.second - 1; y <= cell.second + 1; y++) {
+                    auto it = grid.find(Cell(x, y));
+                    if (it == grid.end()) {
+                        continue;
+                    }
+                    for (std::size_t index : it->second) {
+                        if (!grouped[index] && pred(vertexIds[i], vertexIds[index])) {
+                            grouped[index] = true;
+                            vertexGrp.push_back(index);
+                        }
                     }
                 }
-
-                vt = vn;
             }
+            vertexGrps.push_back(std::move(vertexGrp));
         }
 
-        return missingCoincidences;
+        return vertexGrps;
     }
 
 private:
@@ -750,30 +768,21 @@ int SketchAnalysis::detectMissingEqualityConstraints(double precision)
     // Go through the available 'Coincident', 'Tangent' or 'Perpendicular' constraints
     // and check which of them is forcing two vertexes to be coincident.
     // If there is none but two vertexes can be considered equal a coincident constraint is missing.
+    std::set<std::pair<int, int>> equalities;
     std::vector<Sketcher::Constraint*> constraint = sketch->Constraints.getValues();
     for (auto it : constraint) {
         if (it->Type == Sketcher::Equal) {
-            ConstraintIds id {Base::Vector3d {},
-                              it->First,
-                              it->Second,
-                              it->FirstPos,
-                              it->SecondPos,
-                              it->Type};
-
-            auto pos = std::find_if(equallines.begin(), equallines.end(), Constraint_Equal(id));
-
-            if (pos != equallines.end()) {
-                equallines.erase(pos);
-            }
-
-            pos = std::find_if(equalradius.begin(), equalradius.end(), Constraint_Equal(id));
-
-            if (pos != equalradius.end()) {
-                equalradius.erase(pos);
-            }
+            equalities.emplace(std::min(it->First, it->Second), std::max(it->First, it->Second));
         }
     }
 
+    auto hasEquality = [&equalities](const ConstraintIds& id) {
+        return equalities.count({std::min(id.First, id.Second), std::max(id.First, id.Second)})
+            > 0;
+    };
+    equallines.remove_if(hasEquality);
+    equalradius.remove_if(hasEquality);
+
     this->lineequalityConstraints.clear();
     this->lineequalityConstraints.reserve(equallines.size());
 
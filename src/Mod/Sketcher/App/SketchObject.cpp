@@ -499,6 +499,66 @@ void SketchObject::retrieveSolverDiagnostics()
     lastMalformedConstraints = solvedSketch.getMalformedConstraints();
 }
 
+// returns true if the two constraints lead to the same equations in the solver, i.e. they only
+// differ in their name, label placement or virtual space
+static bool isSameSolverInput(const Constraint* cstr1, const Constraint* cstr2)
+{
+    return cstr1->Type == cstr2->Type && cstr1->AlignmentType == cstr2->AlignmentType
+        && cstr1->getValue() == cstr2->getValue() && cstr1->First == cstr2->First
+        && cstr1->FirstPos == cstr2->FirstPos && cstr1->Second == cstr2->Second
+        && cstr1->SecondPos == cstr2->SecondPos && cstr1->Third == cstr2->Third
+        && cstr1->ThirdPos == cstr2->ThirdPos && cstr1->isDriving == cstr2->isDriving
+        && cstr1->InternalAlignmentIndex == cstr2->InternalAlignmentIndex
+        && cstr1->isActive == cstr2->isActive;
+}
+
+bool SketchObject::isSolverInputUnchanged(const std::vector<Part::Geometry*>& geometry,
+                                          const std::vector<Constraint*>& constraints) const
+{
+    if (!lastSolverInputValid || lastSolverExternalCount != getExternalGeometryCount()
+        || lastSolverGeometry.size() != geometry.size()
+        || lastSolverConstraints.size() != constraints.size()) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < geometry.size(); i++) {
+        const Part::Geometry* geo = lastSolverGeometry[i].get();
+        if (geo->getTypeId() != geometry[i]->getTypeId() || !geo->isSame(*geometry[i], 0.0, 0.0)
+            || !geo->hasSameExtensions(*geometry[i])) {
+            return false;
+        }
+    }
+
+    for (std::size_t i = 0; i < constraints.size(); i++) {
+        if (!isSameSolverInput(lastSolverConstraints[i].get(), constraints[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void SketchObject::storeSolverInput(int result)
+{
+    std::vector<Part::Geometry*> geometry = getCompleteGeometry();
+    lastSolverGeometry.clear();
+    lastSolverGeometry.reserve(geometry.size());
+    for (auto* geo : geometry) {
+        lastSolverGeometry.emplace_back(geo->clone());
+    }
+
+    const std::vector<Constraint*>& constraints = Constraints.getValues();
+    lastSolverConstraints.clear();
+    lastSolverConstraints.reserve(constraints.size());
+    for (auto* cstr : constraints) {
+        lastSolverConstraints.emplace_back(cstr->clone());
+    }
+
+    lastSolverExternalCount = getExternalGeometryCount();
+    lastSolveResult = result;
+    lastSolverInputValid = true;
+}
+
 int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
 {
     // no need to check input data validity as this is an sketchobject managed operation.
@@ -507,6 +567,16 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
     // Reset the initial movement in case of a dragging operation was ongoing on the solver.
     solvedSketch.resetInitMove();
 
+    // Edits that do not change the equations (renaming a constraint, moving it to the virtual
+    // space, recomputing an expression to the same value, refreshing unchanged external geometry)
+    // would yield the same result as the last solve, which still is in the solver.
+    if (isSolverInputUnchanged(getCompleteGeometry(), Constraints.getValues())) {
+        solverNeedsUpdate = false;
+        signalSolverUpdate();
+        return lastSolveResult;
+    }
+    lastSolverInputValid = false;
+
     // if updateGeoAfterSolving=false, the solver information is updated, but the Sketch is nothing
     // updated. It is useful to avoid triggering an OnChange when the goeometry did not change but
     // the solver needs to be updated.
@@ -591,6 +661,11 @@ int SketchObject::solve(bool updateGeoAfterSolving /*=true*/)
         if (!Geometry.isSame(tmp))
             Geometry.moveValues(std::move(tmp));
     }
+
+    // the solver holds the solution of the current geometry only if it has been written back
+    if (err != 0 || updateGeoAfterSolving) {
+        storeSolverInput(err);
+    }
     else if (err < 0) {
         // if solver failed, invalid constraints were likely added before solving
         // (see solve in addConstraint), so solver information is definitely invalid.
@@ -1305,6 +1380,7 @@ int SketchObject::toggleVirtualSpace(int ConstrId)
 
 int SketchObject::setUpSketch()
 {
+    lastSolverInputValid = false;
     lastDoF = solvedSketch.setUpSketch(
         getCompleteGeometry(), Constraints.getValues(), getExternalGeometryCount());
 
@@ -1329,6 +1405,7 @@ int SketchObject::diagnoseAdditionalConstraints(
     std::copy(
         additionalconstraints.begin(), additionalconstraints.end(), back_inserter(allconstraints));
 
+    lastSolverInputValid = false;
     lastDoF =
         solvedSketch.setUpSketch(getCompleteGeometry(), allconstraints, getExternalGeometryCount());
 
@@ -1352,6 +1429,8 @@ int SketchObject::moveGeometries(std::vector<GeoElementId> geoEltIds, const Base
     // geometry to that of of SketchObject upon moving. => use updateGeometry parameter = true then
 
 
+    lastSolverInputValid = false;
+
     if (updateGeoBeforeMoving || solverNeedsUpdate) {
         lastDoF = solvedSketch.setUpSketch(
             getCompleteGeometry(), Constraints.getValues(), getExternalGeometryCount());
@@ -9003,6 +9082,20 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
                     "Datum feature type is not yet supported as external geometry for a sketch");
             }
 
+            // Reuse the last projection if neither the referenced shape nor the sketch moved
+            auto cached = externalProjections.find(key);
+            bool fromCache = !beingCreated && cached != externalProjections.end()
+                && cached->second.shape.IsEqual(refSubShape) && cached->second.placement == Plm
+                && cached->second.type == Types[i]
+                && cached->second.arcFitTolerance == ArcFitTolerance.getValue();
+            if (fromCache) {
+                for (auto& geo : cached->second.geos) {
+                    geos.emplace_back(geo->clone());
+                }
+                projection = false;
+                intersection = false;
+            }
+
             if (projection) {
                 switch (refSubShape.ShapeType()) {
                 case TopAbs_FACE: {
@@ -9163,19 +9256,35 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
                 }
             }
 
+            if (!fromCache) {
+                ExternalProjection& entry = externalProjections[key];
+                entry.shape = refSubShape;
+                entry.placement = Plm;
+                entry.type = Types[i];
+                entry.arcFitTolerance = ArcFitTolerance.getValue();
+                entry.geos.clear();
+                for (auto& geo : geos) {
+                    entry.geos.emplace_back(geo->clone());
+                }
+            }
+
         } catch (Base::Exception &e) {
+            externalProjections.erase(key);
             FC_ERR("Failed to project external geometry in "
                    << getFullName() << ": " << key << std::endl << e.what());
             continue;
         } catch (Standard_Failure &e) {
+            externalProjections.erase(key);
             FC_ERR("Failed to project external geometry in "
                    << getFullName() << ": " << key << std::endl << e.GetMessageString());
             continue;
         } catch (std::exception &e) {
+            externalProjections.erase(key);
             FC_ERR("Failed to project external geometry in "
                    << getFullName() << ": " << key << std::endl << e.what());
             continue;
         } catch (...) {
+            externalProjections.erase(key);
             FC_ERR("Failed to project external geometry in "
                    << getFullName() << ": " << key << std::endl << "Unknown exception");
             continue;
@@ -9195,6 +9304,16 @@ void SketchObject::rebuildExternalGeometry(std::optional<ExternalToAdd> extToAdd
         newGeos.push_back(std::move(geos));
     }
 
+    // forget the projections of removed references
+    for (auto it = externalProjections.begin(); it != externalProjections.end();) {
+        if (refSet.count(it->first) == 0) {
+            it = externalProjections.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
     // allocate unique geometry id
     for(auto &geos : newGeos) {
         auto egf = ExternalGeometryFacade::getFacade(geos.front().get());
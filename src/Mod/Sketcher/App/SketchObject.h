@@ -698,6 +698,11 @@ public: /* Solver exposed interface */
         solvedSketch.setRecalculateInitialSolutionWhileMovingPoint(
             recalculateInitialSolutionWhileMovingPoint);
     }
+    /// sets the time in seconds the solver may spend on a drag step, 0 means unlimited
+    inline void setMoveTimeBudget(double seconds)
+    {
+        solvedSketch.setMoveTimeBudget(seconds);
+    }
     /// Forwards a request for a temporary initMove to the solver using the current sketch state as
     /// a reference (enables dragging)
 
@@ -721,6 +726,7 @@ public: /* Solver exposed interface */
     /// forwards a request to update an extension of a geometry of the solver to the solver.
     inline void updateSolverExtension(int geoId, std::unique_ptr<Part::GeometryExtension>&& ext)
     {
+        lastSolverInputValid = false;
         return solvedSketch.updateExtension(geoId, std::move(ext));
     }
 
@@ -972,6 +978,12 @@ protected:
     // retrieves redundant, conflicting and malformed constraint information from the solver
     void retrieveSolverDiagnostics();
 
+    // returns true if solving the given input would repeat the last solve
+    bool isSolverInputUnchanged(const std::vector<Part::Geometry*>& geometry,
+                                const std::vector<Constraint*>& constraints) const;
+    // remembers the current geometry and constraints as the input of the last solve
+    void storeSolverInput(int result);
+
     // retrieves whether a geometry blocked state corresponds to this constraint
     // returns true of the constraint is of Block type, false otherwise
     bool getBlockedState(const Constraint* cstr, bool& blockedstate) const;
@@ -1037,6 +1049,16 @@ private:
     int lastSolverStatus;
     float lastSolveTime;
 
+    /** the geometry and constraints the solver last saw, so that solve() can be skipped if they
+       did not change in a way that matters to the solver (e.g. renaming a constraint). It is
+       invalidated whenever solvedSketch is set up or moved by anything else than solve().
+    */
+    std::vector<std::unique_ptr<Part::Geometry>> lastSolverGeometry;
+    std::vector<std::unique_ptr<Constraint>> lastSolverConstraints;
+    int lastSolverExternalCount {0};
+    int lastSolveResult {0};
+    bool lastSolverInputValid {false};
+
     std::vector<int> lastConflicting;
     std::vector<int> lastRedundant;
     std::vector<int> lastPartiallyRedundant;
@@ -1083,6 +1105,18 @@ private:
     // mapping from ExternalGeo[*].Id to index of ExternalGeo
     std::map<long, int> externalGeoMap;
 
+    // the projection of an external reference, reused by rebuildExternalGeometry() as long as
+    // the referenced shape, the sketch placement and the type of the reference are unchanged
+    struct ExternalProjection
+    {
+        TopoDS_Shape shape;
+        Base::Placement placement;
+        int type {0};
+        double arcFitTolerance {0.0};
+        std::vector<std::unique_ptr<Part::Geometry>> geos;
+    };
+    std::map<std::string, ExternalProjection> externalProjections;
+
     // mapping from Geometry[*].Id to index of Geometry
     std::map<long, int> geoMap;
 
@@ -1103,6 +1137,7 @@ inline int SketchObject::initTemporaryMove(std::vector<GeoElementId> moved, bool
         solve();
     }
 
+    lastSolverInputValid = false;
     return solvedSketch.initMove(moved, fine);
 }
 
@@ -1124,6 +1159,7 @@ inline int SketchObject::initTemporaryBSplinePieceMove(int geoId,
         solve();
     }
 
+    lastSolverInputValid = false;
     return solvedSketch.initBSplinePieceMove(geoId, pos, firstPoint, fine);
 }
 
@@ -1131,6 +1167,7 @@ inline int SketchObject::moveGeometriesTemporary(std::vector<GeoElementId> geoEl
                                                  Base::Vector3d toPoint,
                                                  bool relative /*=false*/)
 {
+    lastSolverInputValid = false;
     return solvedSketch.moveGeometries(geoEltIds, toPoint, relative);
 }
 inline int SketchObject::moveGeometryTemporary(int geoId,
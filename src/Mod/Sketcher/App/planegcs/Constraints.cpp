@@ -35,12 +35,35 @@
 
 #include <boost/graph/graph_concepts.hpp>
 
+#include <Base/DualNumber.h>
+
 #include "Constraints.h"
 
 
 namespace GCS
 {
 
+namespace
+{
+// Reads a parameter as the number type a residual is evaluated with. A Base::DualNumber is seeded
+// with the derivative 1 for the parameter to differentiate for, so its derivative comes out of
+// the same evaluation.
+template<typename T>
+T seed(const double* p, const double* param);
+
+template<>
+double seed<double>(const double* p, const double* /*param*/)
+{
+    return *p;
+}
+
+template<>
+Base::DualNumber seed<Base::DualNumber>(const double* p, const double* param)
+{
+    return {*p, p == param ? 1.0 : 0.0};
+}
+}  // namespace
+
 ///////////////////////////////////////
 // Constraints
 ///////////////////////////////////////
@@ -93,6 +116,26 @@ double Constraint::grad(double* /*param*/)
     return 0.0;
 }
 
+void Constraint::grads(const VEC_pD& params, double* derivs)
+{
+    for (std::size_t i = 0; i < params.size(); i++) {
+        derivs[i] = grad(params[i]);
+    }
+}
+
+void Constraint::collectGrads(const double* partials, const VEC_pD& params, double* derivs) const
+{
+    for (std::size_t i = 0; i < params.size(); i++) {
+        double deriv = 0.;
+        for (std::size_t j = 0; j < pvec.size(); j++) {
+            if (pvec[j] == params[i]) {
+                deriv += partials[j];
+            }
+        }
+        derivs[i] = scale * deriv;
+    }
+}
+
 double Constraint::maxStep(MAP_pD_D& /*dir*/, double lim)
 {
     return lim;
@@ -149,6 +192,12 @@ double ConstraintEqual::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintEqual::grads(const VEC_pD& params, double* derivs)
+{
+    const double partials[] = {1., -1.};
+    collectGrads(partials, params, derivs);
+}
+
 
 // --------------------------------------------------------
 // Weighted Linear Combination
@@ -352,153 +401,59 @@ void ConstraintSlopeAtBSplineKnot::rescale(double coef)
     scale = coef / sqrt((slopex * slopex + slopey * slopey));
 }
 
-double ConstraintSlopeAtBSplineKnot::error()
+template<typename T>
+T ConstraintSlopeAtBSplineKnot::evaluate(double* param)
 {
-    double xsum = 0., xslopesum = 0.;
-    double ysum = 0., yslopesum = 0.;
-    double wsum = 0., wslopesum = 0.;
+    T xsum = 0., xslopesum = 0.;
+    T ysum = 0., yslopesum = 0.;
+    T wsum = 0., wslopesum = 0.;
 
     for (size_t i = 0; i < numpoles; ++i) {
-        double wcontrib = *weightat(i) * factors[i];
-        double wslopecontrib = *weightat(i) * slopefactors[i];
-        wsum += wcontrib;
-        xsum += *polexat(i) * wcontrib;
-        ysum += *poleyat(i) * wcontrib;
-        wslopesum += wslopecontrib;
-        xslopesum += *polexat(i) * wslopecontrib;
-        yslopesum += *poleyat(i) * wslopecontrib;
+        T polex = seed<T>(polexat(i), param);
+        T poley = seed<T>(poleyat(i), param);
+        T weight = seed<T>(weightat(i), param);
+        T wcontrib = weight * factors[i];
+        T wslopecontrib = weight * slopefactors[i];
+        wsum = wsum + wcontrib;
+        xsum = xsum + polex * wcontrib;
+        ysum = ysum + poley * wcontrib;
+        wslopesum = wslopesum + wslopecontrib;
+        xslopesum = xslopesum + polex * wslopecontrib;
+        yslopesum = yslopesum + poley * wslopecontrib;
     }
 
     // This is actually wsum^2 * the respective slopes
     // See Eq (19) from:
     // https://forum.freecad.org/viewtopic.php?f=9&t=71130&start=120#p635538
-    double slopex = wsum * xslopesum - wslopesum * xsum;
-    double slopey = wsum * yslopesum - wslopesum * ysum;
+    T slopex = wsum * xslopesum - wslopesum * xsum;
+    T slopey = wsum * yslopesum - wslopesum * ysum;
 
     // Normalizing it ensures that the cross product is not zero just because
     // one vector is zero.
-    double linex = *linep2x() - *linep1x();
-    double liney = *linep2y() - *linep1y();
-    double dirx = linex / sqrt(linex * linex + liney * liney);
-    double diry = liney / sqrt(linex * linex + liney * liney);
+    using std::sqrt;
+    T linex = seed<T>(linep2x(), param) - seed<T>(linep1x(), param);
+    T liney = seed<T>(linep2y(), param) - seed<T>(linep1y(), param);
+    T length = sqrt(linex * linex + liney * liney);
+    T dirx = linex / length;
+    T diry = liney / length;
 
     // error is the cross product
     return scale * (slopex * diry - slopey * dirx);
 }
 
-double ConstraintSlopeAtBSplineKnot::grad(double* param)
+double ConstraintSlopeAtBSplineKnot::error()
 {
-    // Equations are from here:
-    // https://forum.freecad.org/viewtopic.php?f=9&t=71130&start=120#p635538
-    double result = 0.0;
-    double linex = *linep2x() - *linep1x();
-    double liney = *linep2y() - *linep1y();
-    double dirx = linex / sqrt(linex * linex + liney * liney);
-    double diry = liney / sqrt(linex * linex + liney * liney);
+    return evaluate<double>(nullptr);
+}
 
-    for (size_t i = 0; i < numpoles; ++i) {
-        if (param == polexat(i)) {
-            // Eq. (21)
-            double wsum = 0., wslopesum = 0.;
-            for (size_t j = 0; j < numpoles; ++j) {
-                double wcontrib = *weightat(j) * factors[j];
-                double wslopecontrib = *weightat(j) * slopefactors[j];
-                wsum += wcontrib;
-                wslopesum += wslopecontrib;
-            }
-            result = (wsum * slopefactors[i] - wslopesum * factors[i]) * diry;
-            return scale * result;
-        }
-        if (param == poleyat(i)) {
-            // Eq. (21)
-            double wsum = 0., wslopesum = 0.;
-            for (size_t i = 0; i < numpoles; ++i) {
-                double wcontrib = *weightat(i) * factors[i];
-                double wslopecontrib = *weightat(i) * slopefactors[i];
-                wsum += wcontrib;
-                wslopesum += wslopecontrib;
-            }
-            result = -(wsum * slopefactors[i] - wslopesum * factors[i]) * dirx;
-            return scale * result;
-        }
-        if (param == weightat(i)) {
-            // Eq. (22)
-            double xsum = 0., xslopesum = 0.;
-            double ysum = 0., yslopesum = 0.;
-            for (size_t j = 0; j < numpoles; ++j) {
-                double wcontrib = *weightat(j) * factors[j];
-                double wslopecontrib = *weightat(j) * slopefactors[j];
-                xsum += wcontrib * (*polexat(j) - *polexat(i));
-                xslopesum += wslopecontrib * (*polexat(j) - *polexat(i));
-                ysum += wcontrib * (*poleyat(j) - *poleyat(i));
-                yslopesum += wslopecontrib * (*poleyat(j) - *poleyat(i));
-            }
-            result = (factors[i] * xslopesum - slopefactors[i] * xsum) * diry
-                - (factors[i] * yslopesum - slopefactors[i] * ysum) * dirx;
-            return scale * result;
-        }
+double ConstraintSlopeAtBSplineKnot::grad(double* param)
+{
+    if (std::find(pvec.begin(), pvec.end(), param) == pvec.end()) {
+        return 0.0;
     }
-
-    double slopex = 0., slopey = 0.;
-
-    auto getSlopes = [&]() {
-        double xsum = 0., xslopesum = 0.;
-        double ysum = 0., yslopesum = 0.;
-        double wsum = 0., wslopesum = 0.;
-
-        for (size_t i = 0; i < numpoles; ++i) {
-            double wcontrib = *weightat(i) * factors[i];
-            double wslopecontrib = *weightat(i) * slopefactors[i];
-            wsum += wcontrib;
-            xsum += *polexat(i) * wcontrib;
-            ysum += *poleyat(i) * wcontrib;
-            wslopesum += wslopecontrib;
-            xslopesum += *polexat(i) * wslopecontrib;
-            yslopesum += *poleyat(i) * wslopecontrib;
-        }
-
-        // This is actually wsum^2 * the respective slopes
-        slopex = wsum * xslopesum - wslopesum * xsum;
-        slopey = wsum * yslopesum - wslopesum * ysum;
-    };
-
-    if (param == linep1x()) {
-        getSlopes();
-        double dDirxDLinex = (liney * liney) / pow(linex * linex + liney * liney, 1.5);
-        double dDiryDLinex = -(linex * liney) / pow(linex * linex + liney * liney, 1.5);
-        // NOTE: d(linex)/d(x1) = -1
-        result = slopex * (-dDiryDLinex) - slopey * (-dDirxDLinex);
-        return scale * result;
-    }
-    if (param == linep2x()) {
-        getSlopes();
-        double dDirxDLinex = (liney * liney) / pow(linex * linex + liney * liney, 1.5);
-        double dDiryDLinex = -(linex * liney) / pow(linex * linex + liney * liney, 1.5);
-        // NOTE: d(linex)/d(x2) = 1
-        result = slopex * dDiryDLinex - slopey * dDirxDLinex;
-        return scale * result;
-    }
-    if (param == linep1y()) {
-        getSlopes();
-        double dDirxDLiney = -(linex * liney) / pow(linex * linex + liney * liney, 1.5);
-        double dDiryDLiney = (linex * linex) / pow(linex * linex + liney * liney, 1.5);
-        // NOTE: d(liney)/d(y1) = -1
-        result = slopex * (-dDiryDLiney) - slopey * (-dDirxDLiney);
-        return scale * result;
-    }
-    if (param == linep2y()) {
-        getSlopes();
-        double dDirxDLiney = -(linex * liney) / pow(linex * linex + liney * liney, 1.5);
-        double dDiryDLiney = (linex * linex) / pow(linex * linex + liney * liney, 1.5);
-        // NOTE: d(liney)/d(y2) = 1
-        result = slopex * dDiryDLiney - slopey * dDirxDLiney;
-        return scale * result;
-    }
-
-    return scale * result;
+    return evaluate<Base::DualNumber>(param).du;
 }
 
-
 // --------------------------------------------------------
 // Point On BSpline
 ConstraintPointOnBSpline::ConstraintPointOnBSpline(double* point,
@@ -691,6 +646,12 @@ double ConstraintDifference::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintDifference::grads(const VEC_pD& params, double* derivs)
+{
+    const double partials[] = {-1., 1., -1.};
+    collectGrads(partials, params, derivs);
+}
+
 
 // --------------------------------------------------------
 // P2PDistance
@@ -751,6 +712,15 @@ double ConstraintP2PDistance::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2PDistance::grads(const VEC_pD& params, double* derivs)
+{
+    double dx = (*p1x() - *p2x());
+    double dy = (*p1y() - *p2y());
+    double d = sqrt(dx * dx + dy * dy);
+    const double partials[] = {dx / d, dy / d, -dx / d, -dy / d, -1.};
+    collectGrads(partials, params, derivs);
+}
+
 double ConstraintP2PDistance::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it;
@@ -862,6 +832,26 @@ double ConstraintP2PAngle::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2PAngle::grads(const VEC_pD& params, double* derivs)
+{
+    double dx = (*p2x() - *p1x());
+    double dy = (*p2y() - *p1y());
+    double a = *angle() + da;
+    double ca = cos(a);
+    double sa = sin(a);
+    double x = dx * ca + dy * sa;
+    double y = -dx * sa + dy * ca;
+    double r2 = dx * dx + dy * dy;
+    dx = -y / r2;
+    dy = x / r2;
+    const double partials[] = {(-ca * dx + sa * dy),
+                               (-sa * dx - ca * dy),
+                               (ca * dx - sa * dy),
+                               (sa * dx + ca * dy),
+                               -1.};
+    collectGrads(partials, params, derivs);
+}
+
 double ConstraintP2PAngle::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it = dir.find(angle());
@@ -954,6 +944,26 @@ double ConstraintP2LDistance::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintP2LDistance::grads(const VEC_pD& params, double* derivs)
+{
+    double x0 = *p0x(), x1 = *p1x(), x2 = *p2x();
+    double y0 = *p0y(), y1 = *p1y(), y2 = *p2y();
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double d2 = dx * dx + dy * dy;
+    double d = sqrt(d2);
+    double area = -x0 * dy + y0 * dx + x1 * y2 - x2 * y1;
+    double sign = area < 0 ? -1. : 1.;
+    const double partials[] = {sign * (y1 - y2) / d,
+                               sign * (x2 - x1) / d,
+                               sign * ((y2 - y0) * d + (dx / d) * area) / d2,
+                               sign * ((x0 - x2) * d + (dy / d) * area) / d2,
+                               sign * ((y0 - y1) * d - (dx / d) * area) / d2,
+                               sign * ((x1 - x0) * d - (dy / d) * area) / d2,
+                               -1.};
+    collectGrads(partials, params, derivs);
+}
+
 double ConstraintP2LDistance::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it;
@@ -1089,6 +1099,24 @@ double ConstraintPointOnLine::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPointOnLine::grads(const VEC_pD& params, double* derivs)
+{
+    double x0 = *p0x(), x1 = *p1x(), x2 = *p2x();
+    double y0 = *p0y(), y1 = *p1y(), y2 = *p2y();
+    double dx = x2 - x1;
+    double dy = y2 - y1;
+    double d2 = dx * dx + dy * dy;
+    double d = sqrt(d2);
+    double area = -x0 * dy + y0 * dx + x1 * y2 - x2 * y1;
+    const double partials[] = {(y1 - y2) / d,
+                               (x2 - x1) / d,
+                               ((y2 - y0) * d + (dx / d) * area) / d2,
+                               ((x0 - x2) * d + (dy / d) * area) / d2,
+                               ((y0 - y1) * d - (dx / d) * area) / d2,
+                               ((x1 - x0) * d - (dy / d) * area) / d2};
+    collectGrads(partials, params, derivs);
+}
+
 
 // --------------------------------------------------------
 // PointOnPerpBisector
@@ -1242,6 +1270,16 @@ double ConstraintParallel::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintParallel::grads(const VEC_pD& params, double* derivs)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    const double partials[] = {dy2, -dx2, -dy2, dx2, -dy1, dx1, dy1, -dx1};
+    collectGrads(partials, params, derivs);
+}
+
 
 // --------------------------------------------------------
 // Perpendicular
@@ -1328,6 +1366,16 @@ double ConstraintPerpendicular::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintPerpendicular::grads(const VEC_pD& params, double* derivs)
+{
+    double dx1 = (*l1p1x() - *l1p2x());
+    double dy1 = (*l1p1y() - *l1p2y());
+    double dx2 = (*l2p1x() - *l2p2x());
+    double dy2 = (*l2p1y() - *l2p2y());
+    const double partials[] = {dx2, dy2, -dx2, -dy2, dx1, dy1, -dx1, -dy1};
+    collectGrads(partials, params, derivs);
+}
+
 
 // --------------------------------------------------------
 // L2LAngle
@@ -1442,6 +1490,33 @@ double ConstraintL2LAngle::grad(double* param)
     return scale * deriv;
 }
 
+void ConstraintL2LAngle::grads(const VEC_pD& params, double* derivs)
+{
+    double dx1 = (*l1p2x() - *l1p1x());
+    double dy1 = (*l1p2y() - *l1p1y());
+    double r1 = dx1 * dx1 + dy1 * dy1;
+    double dx2 = (*l2p2x() - *l2p1x());
+    double dy2 = (*l2p2y() - *l2p1y());
+    double a = atan2(dy1, dx1) + *angle();
+    double ca = cos(a);
+    double sa = sin(a);
+    double x2 = dx2 * ca + dy2 * sa;
+    double y2 = -dx2 * sa + dy2 * ca;
+    double r2 = dx2 * dx2 + dy2 * dy2;
+    dx2 = -y2 / r2;
+    dy2 = x2 / r2;
+    const double partials[] = {-dy1 / r1,
+                               dx1 / r1,
+                               dy1 / r1,
+                               -dx1 / r1,
+                               (-ca * dx2 + sa * dy2),
+                               (-sa * dx2 - ca * dy2),
+                               (ca * dx2 - sa * dy2),
+                               (sa * dx2 + ca * dy2),
+                               -1.};
+    collectGrads(partials, params, derivs);
+}
+
 double ConstraintL2LAngle::maxStep(MAP_pD_D& dir, double lim)
 {
     MAP_pD_D::iterator it = dir.find(angle());
@@ -1660,73 +1735,37 @@ void ConstraintPointOnEllipse::rescale(double coef)
     scale = coef * 1;
 }
 
-double ConstraintPointOnEllipse::error()
+template<typename T>
+T ConstraintPointOnEllipse::evaluate(double* param)
 {
-    double X_0 = *p1x();
-    double Y_0 = *p1y();
-    double X_c = *cx();
-    double Y_c = *cy();
-    double X_F1 = *f1x();
-    double Y_F1 = *f1y();
-    double b = *rmin();
-
-    double err = sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-        + sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2))
-        - 2 * sqrt(pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2));
+    T X_0 = seed<T>(p1x(), param);
+    T Y_0 = seed<T>(p1y(), param);
+    T X_c = seed<T>(cx(), param);
+    T Y_c = seed<T>(cy(), param);
+    T X_F1 = seed<T>(f1x(), param);
+    T Y_F1 = seed<T>(f1y(), param);
+    T b = seed<T>(rmin(), param);
+
+    using std::sqrt;
+    T err = sqrt((X_0 - X_F1) * (X_0 - X_F1) + (Y_0 - Y_F1) * (Y_0 - Y_F1))
+        + sqrt((X_0 + X_F1 - 2 * X_c) * (X_0 + X_F1 - 2 * X_c)
+               + (Y_0 + Y_F1 - 2 * Y_c) * (Y_0 + Y_F1 - 2 * Y_c))
+        - 2 * sqrt(b * b + (X_F1 - X_c) * (X_F1 - X_c) + (Y_F1 - Y_c) * (Y_F1 - Y_c));
     return scale * err;
 }
 
+double ConstraintPointOnEllipse::error()
+{
+    return evaluate<double>(nullptr);
+}
+
 double ConstraintPointOnEllipse::grad(double* param)
 {
-    double deriv = 0.;
     if (param == p1x() || param == p1y() || param == f1x() || param == f1y() || param == cx()
         || param == cy() || param == rmin()) {
-
-        double X_0 = *p1x();
-        double Y_0 = *p1y();
-        double X_c = *cx();
-        double Y_c = *cy();
-        double X_F1 = *f1x();
-        double Y_F1 = *f1y();
-        double b = *rmin();
-
-        if (param == p1x()) {
-            deriv += (X_0 - X_F1) / sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-                + (X_0 + X_F1 - 2 * X_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == p1y()) {
-            deriv += (Y_0 - Y_F1) / sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-                + (Y_0 + Y_F1 - 2 * Y_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == f1x()) {
-            deriv += -(X_0 - X_F1) / sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-                - 2 * (X_F1 - X_c) / sqrt(pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2))
-                + (X_0 + X_F1 - 2 * X_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == f1y()) {
-            deriv += -(Y_0 - Y_F1) / sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-                - 2 * (Y_F1 - Y_c) / sqrt(pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2))
-                + (Y_0 + Y_F1 - 2 * Y_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == cx()) {
-            deriv += 2 * (X_F1 - X_c) / sqrt(pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2))
-                - 2 * (X_0 + X_F1 - 2 * X_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == cy()) {
-            deriv += 2 * (Y_F1 - Y_c) / sqrt(pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2))
-                - 2 * (Y_0 + Y_F1 - 2 * Y_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == rmin()) {
-            deriv += -2 * b / sqrt(pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2));
-        }
+        return evaluate<Base::DualNumber>(param).du;
     }
-    return scale * deriv;
+    return 0.0;
 }
 
 
@@ -2367,15 +2406,16 @@ void ConstraintPointOnHyperbola::rescale(double coef)
     scale = coef * 1;
 }
 
-double ConstraintPointOnHyperbola::error()
+template<typename T>
+T ConstraintPointOnHyperbola::evaluate(double* param)
 {
-    double X_0 = *p1x();
-    double Y_0 = *p1y();
-    double X_c = *cx();
-    double Y_c = *cy();
-    double X_F1 = *f1x();
-    double Y_F1 = *f1y();
-    double b = *rmin();
+    T X_0 = seed<T>(p1x(), param);
+    T Y_0 = seed<T>(p1y(), param);
+    T X_c = seed<T>(cx(), param);
+    T Y_c = seed<T>(cy(), param);
+    T X_F1 = seed<T>(f1x(), param);
+    T Y_F1 = seed<T>(f1y(), param);
+    T b = seed<T>(rmin(), param);
 
     // Full sage worksheet at:
     // https://forum.freecad.org/viewtopic.php?f=10&t=8038&p=110447#p110447
@@ -2390,63 +2430,26 @@ double ConstraintPointOnHyperbola::error()
     // show(a)
     // DM=sqrt((P-F2)*(P-F2))-sqrt((P-F1)*(P-F1))-2*a
     // show(DM.simplify_radical())
-    double err = -sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-        + sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2))
-        - 2 * sqrt(-pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2));
+    using std::sqrt;
+    T err = -sqrt((X_0 - X_F1) * (X_0 - X_F1) + (Y_0 - Y_F1) * (Y_0 - Y_F1))
+        + sqrt((X_0 + X_F1 - 2 * X_c) * (X_0 + X_F1 - 2 * X_c)
+               + (Y_0 + Y_F1 - 2 * Y_c) * (Y_0 + Y_F1 - 2 * Y_c))
+        - 2 * sqrt(-b * b + (X_F1 - X_c) * (X_F1 - X_c) + (Y_F1 - Y_c) * (Y_F1 - Y_c));
     return scale * err;
 }
 
+double ConstraintPointOnHyperbola::error()
+{
+    return evaluate<double>(nullptr);
+}
+
 double ConstraintPointOnHyperbola::grad(double* param)
 {
-    double deriv = 0.;
     if (param == p1x() || param == p1y() || param == f1x() || param == f1y() || param == cx()
         || param == cy() || param == rmin()) {
-
-        double X_0 = *p1x();
-        double Y_0 = *p1y();
-        double X_c = *cx();
-        double Y_c = *cy();
-        double X_F1 = *f1x();
-        double Y_F1 = *f1y();
-        double b = *rmin();
-
-        if (param == p1x()) {
-            deriv += -(X_0 - X_F1) / sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-                + (X_0 + X_F1 - 2 * X_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == p1y()) {
-            deriv += -(Y_0 - Y_F1) / sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-                + (Y_0 + Y_F1 - 2 * Y_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == f1x()) {
-            deriv += (X_0 - X_F1) / sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-                - 2 * (X_F1 - X_c) / sqrt(-pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2))
-                + (X_0 + X_F1 - 2 * X_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == f1y()) {
-            deriv += (Y_0 - Y_F1) / sqrt(pow(X_0 - X_F1, 2) + pow(Y_0 - Y_F1, 2))
-                - 2 * (Y_F1 - Y_c) / sqrt(-pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2))
-                + (Y_0 + Y_F1 - 2 * Y_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == cx()) {
-            deriv += 2 * (X_F1 - X_c) / sqrt(-pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2))
-                - 2 * (X_0 + X_F1 - 2 * X_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == cy()) {
-            deriv += 2 * (Y_F1 - Y_c) / sqrt(-pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2))
-                - 2 * (Y_0 + Y_F1 - 2 * Y_c)
-                    / sqrt(pow(X_0 + X_F1 - 2 * X_c, 2) + pow(Y_0 + Y_F1 - 2 * Y_c, 2));
-        }
-        if (param == rmin()) {
-            deriv += 2 * b / sqrt(-pow(b, 2) + pow(X_F1 - X_c, 2) + pow(Y_F1 - Y_c, 2));
-        }
+        return evaluate<Base::DualNumber>(param).du;
     }
-    return scale * deriv;
+    return 0.0;
 }
 
 
@@ -171,13 +171,21 @@ public:
     virtual void rescale(double coef = 1.);
     virtual double error();
     virtual double grad(double*);
-    // virtual void grad(MAP_pD_D &deriv);  --> TODO: vectorized grad version
+    // Writes the derivatives with respect to each of params to derivs, i.e. a row of the
+    // Jacobian. The terms shared by the derivatives are computed only once if a constraint
+    // overrides it, the default calls grad() for every parameter.
+    virtual void grads(const VEC_pD& params, double* derivs);
     virtual double maxStep(MAP_pD_D& dir, double lim = 1.);
     // Finds first occurrence of param in pvec. This is useful to test if a constraint depends
     // on the parameter (it may not actually depend on it, e.g. angle-via-point doesn't depend
     // on ellipse's b (radmin), but b will be included within the constraint anyway.
     // Returns -1 if not found.
     int findParamInPvec(double* param);
+
+protected:
+    // Writes the scaled derivatives with respect to params given the partial derivatives with
+    // respect to each entry of pvec. Parameters occurring several times in pvec sum up.
+    void collectGrads(const double* partials, const VEC_pD& params, double* derivs) const;
 };
 
 // Equal
@@ -200,6 +208,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(const VEC_pD& params, double* derivs) override;
 };
 
 // Center of Gravity
@@ -316,6 +325,10 @@ public:
     double grad(double*) override;
 
 private:
+    // Evaluates the error, as Base::DualNumber its derivative with respect to param as well
+    template<typename T>
+    T evaluate(double* param);
+
     std::vector<double> factors;
     std::vector<double> slopefactors;
     size_t numpoles;
@@ -380,6 +393,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(const VEC_pD& params, double* derivs) override;
 };
 
 // P2PDistance
@@ -417,6 +431,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(const VEC_pD& params, double* derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
 };
 
@@ -456,6 +471,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(const VEC_pD& params, double* derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
 };
 
@@ -502,6 +518,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(const VEC_pD& params, double* derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
     double abs(double darea);
 };
@@ -546,6 +563,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(const VEC_pD& params, double* derivs) override;
 };
 
 // PointOnPerpBisector
@@ -638,6 +656,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(const VEC_pD& params, double* derivs) override;
 };
 
 // Perpendicular
@@ -688,6 +707,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(const VEC_pD& params, double* derivs) override;
 };
 
 // L2LAngle
@@ -742,6 +762,7 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+    void grads(const VEC_pD& params, double* derivs) override;
     double maxStep(MAP_pD_D& dir, double lim = 1.) override;
 };
 
@@ -890,6 +911,11 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+
+private:
+    // Evaluates the error, as Base::DualNumber its derivative with respect to param as well
+    template<typename T>
+    T evaluate(double* param);
 };
 
 class ConstraintEllipseTangentLine: public Constraint
@@ -1069,6 +1095,11 @@ public:
     void rescale(double coef = 1.) override;
     double error() override;
     double grad(double*) override;
+
+private:
+    // Evaluates the error, as Base::DualNumber its derivative with respect to param as well
+    template<typename T>
+    T evaluate(double* param);
 };
 
 // PointOnParabola
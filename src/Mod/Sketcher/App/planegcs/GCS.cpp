@@ -47,10 +47,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cfloat>
 #include <future>
 #include <iostream>
 #include <limits>
+#include <thread>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -493,6 +495,10 @@ System::System()
     , DL_tolgRedundant(1E-80)
     , DL_tolxRedundant(1E-80)
     , DL_tolfRedundant(1E-10)
+    , sparseThreshold(500)
+    , DL_maxTime(0)
+    , DL_tolfCoarse(1E-6)
+    , concurrentSolving(true)
 {
     // currently Eigen only supports multithreading for multiplications
     // There is no appreciable gain from using more threads
@@ -1976,25 +1982,72 @@ int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
         return Failed;
     }
 
-    bool isReset = false;
-    // return success by default in order to permit coincidence constraints to be applied
-    // even if no other system has to be solved
-    int res = Success;
+    iterations = 0;
+
+    // the time budget is shared by all subsystems
+    hasDeadline = alg == DogLeg && DL_maxTime > 0;
+    if (hasDeadline) {
+        deadline = std::chrono::steady_clock::now()
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                       std::chrono::duration<double>(DL_maxTime));
+    }
+
+    std::vector<int> cids;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            cids.push_back(cid);
         }
+    }
+    if (!cids.empty()) {
+        resetToReference();
+    }
+
+    auto solveCluster = [&](int cid) {
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res,
-                           solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            return solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            return solve(subSystems[cid], isFine, alg, isRedundantsolving);
         }
-        else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+        return solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
+    };
+
+    // The clusters have disjoint parameters and constraints, so they can be solved in parallel.
+    // Base::Console is not thread-safe, so the solvers must not write to it.
+    std::size_t numThreads = 1;
+    if (concurrentSolving && debugMode != IterationLevel) {
+        numThreads = std::min<std::size_t>(cids.size(), std::thread::hardware_concurrency());
+    }
+
+    std::vector<int> results(cids.size(), Success);
+    if (numThreads > 1) {
+        std::atomic<std::size_t> next {0};
+        auto worker = [&]() {
+            for (std::size_t i = next++; i < cids.size(); i = next++) {
+                results[i] = solveCluster(cids[i]);
+            }
+        };
+
+        std::vector<std::future<void>> futures;
+        for (std::size_t i = 1; i < numThreads; i++) {
+            futures.push_back(std::async(std::launch::async, worker));
         }
+        worker();
+        for (auto& it : futures) {
+            it.get();
+        }
+    }
+    else {
+        for (std::size_t i = 0; i < cids.size(); i++) {
+            results[i] = solveCluster(cids[i]);
+        }
+    }
+
+    // return success by default in order to permit coincidence constraints to be applied
+    // even if no other system has to be solved
+    int res = Success;
+    for (int it : results) {
+        res = std::max(res, it);
     }
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
@@ -2084,7 +2137,8 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     double divergingLim = 1e6 * err + 1e12;
     double h_norm {};
 
-    for (int iter = 1; iter < maxIterNumber; ++iter) {
+    int iter = 1;
+    for (; iter < maxIterNumber; ++iter) {
         h_norm = h.norm();
         if (h_norm <= convCriterion || err <= smallF) {
             if (debugMode == IterationLevel) {
@@ -2146,6 +2200,7 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
         }
     }
 
+    iterations += iter;
     subsys->revertParams();
 
     if (err <= smallF) {
@@ -2172,10 +2227,18 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    Eigen::MatrixXd J;  // Jacobi of the subsystem
+    Eigen::MatrixXd A;
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
+    // large subsystems use a sparse Jacobi, the damping is added to a copy of J^T J
+    bool sparse = xsize >= sparseThreshold;
+    Eigen::SparseMatrix<double> SJ, SA, SA_mu, I;
+    if (sparse) {
+        I.resize(xsize, xsize);
+        I.setIdentity();
+    }
+
     subsys->redirectParams();
 
     subsys->getParams(x);
@@ -2225,14 +2288,24 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         }
 
         // J^T J, J^T e
-        subsys->calcJacobi(J);
+        if (sparse) {
+            subsys->calcJacobi(SJ);
 
-        A = J.transpose() * J;
-        g = J.transpose() * e;
+            SA = SJ.transpose() * SJ;
+            g = SJ.transpose() * e;
+            diag_A = SA.diagonal();
+        }
+        else {
+            subsys->calcJacobi(J);
+
+            A = J.transpose() * J;
+            g = J.transpose() * e;
+            // save diagonal entries so that augmentation can be later canceled
+            diag_A = A.diagonal();
+        }
 
         // Compute ||J^T e||_inf
         double g_inf = g.lpNorm<Eigen::Infinity>();
-        diag_A = A.diagonal();  // save diagonal entries so that augmentation can be later canceled
 
         // check for convergence
         if (g_inf <= eps1) {
@@ -2249,14 +2322,27 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         // determine increment using adaptive damping
         int k = 0;
         while (k < 50) {
-            // augment normal equations A = A+uI
-            for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
+            double rel_error = 1.;
+            if (sparse) {
+                // augment normal equations A = A+uI, the pattern stays the same so that the
+                // symbolic factorization of the subsystem can be reused
+                SA_mu = SA + mu * I;
+
+                // solve augmented functions A*h=-g
+                if (subsys->solveSparseLDLT(SA_mu, g, h)) {
+                    rel_error = (SA_mu * h - g).norm() / g.norm();
+                }
             }
+            else {
+                // augment normal equations A = A+uI
+                for (int i = 0; i < xsize; ++i) {
+                    A(i, i) += mu;
+                }
 
-            // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
-            double rel_error = (A * h - g).norm() / g.norm();
+                // solve augmented functions A*h=-g
+                h = A.fullPivLu().solve(g);
+                rel_error = (A * h - g).norm() / g.norm();
+            }
 
             // check if solving works
             if (rel_error < 1e-5) {
@@ -2305,8 +2391,10 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
             mu *= nu;
             nu *= 2.0;
-            for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
+            if (!sparse) {
+                for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
+                    A(i, i) = diag_A(i);
+                }
             }
 
             k++;
@@ -2331,6 +2419,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         stop = 5;
     }
 
+    iterations += iter;
     subsys->revertParams();
 
     return (stop == 1) ? Success : Failed;
@@ -2381,17 +2470,41 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    Eigen::MatrixXd Jx, Jx_new;
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
+    // large subsystems use a sparse Jacobi
+    bool sparse = xsize >= sparseThreshold;
+    Eigen::SparseMatrix<double> SJx, SJx_new, SJJt;
+    auto calcJacobi = [&](Eigen::MatrixXd& J, Eigen::SparseMatrix<double>& SJ) {
+        if (sparse) {
+            subsys->calcJacobi(SJ);
+        }
+        else {
+            subsys->calcJacobi(J);
+        }
+    };
+    auto jacobiTimes = [&](const Eigen::VectorXd& v) -> Eigen::VectorXd {
+        if (sparse) {
+            return SJx * v;
+        }
+        return Jx * v;
+    };
+    auto jacobiTransposeTimes = [&](const Eigen::VectorXd& v) -> Eigen::VectorXd {
+        if (sparse) {
+            return SJx.transpose() * v;
+        }
+        return Jx.transpose() * v;
+    };
+
     subsys->redirectParams();
 
     double err;
     subsys->getParams(x);
     subsys->calcResidual(fx, err);
-    subsys->calcJacobi(Jx);
+    calcJacobi(Jx, SJx);
 
-    g = Jx.transpose() * (-fx);
+    g = jacobiTransposeTimes(-fx);
 
     // get the infinity norm fx_inf and g_inf
     double g_inf = g.lpNorm<Eigen::Infinity>();
@@ -2427,27 +2540,58 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
             stop = 6;
             break;
         }
+        else if (hasDeadline && std::chrono::steady_clock::now() > deadline) {
+            // out of time, a coarse solution is good enough
+            stop = fx_inf <= std::max(tolf, DL_tolfCoarse) ? 1 : 4;
+            break;
+        }
 
         // get the steepest descent direction
-        alpha = g.squaredNorm() / (Jx * g).squaredNorm();
+        alpha = g.squaredNorm() / jacobiTimes(g).squaredNorm();
         h_sd = alpha * g;
 
         // get the gauss-newton step
         // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
         // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-        switch (dogLegGaussStep) {
-            case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
-                break;
-            case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                break;
-            case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                break;
+        bool solved = false;
+        if (sparse) {
+            Eigen::VectorXd y;
+            switch (dogLegGaussStep) {
+                case FullPivLU:
+                    solved = subsys->solveSparseQR(SJx, -fx, h_gn);
+                    break;
+                case LeastNormFullPivLU:
+                    break;
+                case LeastNormLdlt:
+                    SJJt = SJx * SJx.transpose();
+                    solved = subsys->solveSparseLDLT(SJJt, -fx, y);
+                    if (solved) {
+                        h_gn = SJx.transpose() * y;
+                    }
+                    break;
+            }
+
+            // fall back to the dense decompositions
+            if (!solved) {
+                Jx = SJx.toDense();
+            }
+        }
+
+        if (!solved) {
+            switch (dogLegGaussStep) {
+                case FullPivLU:
+                    h_gn = Jx.fullPivLu().solve(-fx);
+                    break;
+                case LeastNormFullPivLU:
+                    h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+                    break;
+                case LeastNormLdlt:
+                    h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+                    break;
+            }
         }
 
-        double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
+        double rel_error = (jacobiTimes(h_gn) + fx).norm() / fx.norm();
         if (rel_error > 1e15) {
             break;
         }
@@ -2487,20 +2631,25 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         x_new = x + h_dl;
         subsys->setParams(x_new);
         subsys->calcResidual(fx_new, err_new);
-        subsys->calcJacobi(Jx_new);
+        calcJacobi(Jx_new, SJx_new);
 
         // calculate the linear model and the update ratio
-        double dL = err - 0.5 * (fx + Jx * h_dl).squaredNorm();
+        double dL = err - 0.5 * (fx + jacobiTimes(h_dl)).squaredNorm();
         double dF = err - err_new;
         double rho = dL / dF;
 
         if (dF > 0 && dL > 0) {
             x = x_new;
-            Jx = Jx_new;
+            if (sparse) {
+                SJx.swap(SJx_new);
+            }
+            else {
+                Jx = Jx_new;
+            }
             fx = fx_new;
             err = err_new;
 
-            g = Jx.transpose() * (-fx);
+            g = jacobiTransposeTimes(-fx);
 
             // get infinity norms
             g_inf = g.lpNorm<Eigen::Infinity>();
@@ -2540,6 +2689,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         iter++;
     }
 
+    iterations += iter;
     subsys->revertParams();
 
     if (debugMode == IterationLevel) {
@@ -4746,7 +4896,8 @@ int System::solve(SubSystem* subsysA, SubSystem* subsysB, bool /*isFine*/, bool
 
     double mu = 0;
     lambda.setZero();
-    for (int iter = 1; iter < maxIterNumber; iter++) {
+    int iter = 1;
+    for (; iter < maxIterNumber; iter++) {
         int status = qp_eq(B, grad, JA, resA, xdir, Y, Z);
         if (status) {
             break;
@@ -4841,6 +4992,8 @@ int System::solve(SubSystem* subsysA, SubSystem* subsysB, bool /*isFine*/, bool
         }
     }
 
+    iterations += iter;
+
     int ret;
     if (subsysA->error() <= smallF) {
         ret = Success;
@@ -4879,22 +5032,23 @@ void System::undoSolution()
     resetToReference();
 }
 
-void System::makeReducedJacobian(Eigen::MatrixXd& J,
+void System::makeReducedJacobian(Eigen::SparseMatrix<double>& J,
                                  std::map<int, int>& jacobianconstraintmap,
                                  GCS::VEC_pD& pdiagnoselist,
                                  std::map<int, int>& tagmultiplicity)
 {
     // construct specific parameter list for diagonose ignoring driven constraint parameters
+    std::set<double*> pdrivenset(pdrivenlist.begin(), pdrivenlist.end());
+    std::map<double*, int> pdiagnoseindex;
     for (int j = 0; j < int(plist.size()); j++) {
-        auto result1 = std::find(std::begin(pdrivenlist), std::end(pdrivenlist), plist[j]);
-
-        if (result1 == std::end(pdrivenlist)) {
+        if (pdrivenset.count(plist[j]) == 0) {
+            pdiagnoseindex[plist[j]] = int(pdiagnoselist.size());
             pdiagnoselist.push_back(plist[j]);
         }
     }
 
-
-    J = Eigen::MatrixXd::Zero(clist.size(), pdiagnoselist.size());
+    // a constraint only has a gradient for its own parameters
+    std::vector<Eigen::Triplet<double>> triplets;
 
     int jacobianconstraintcount = 0;
     int allcount = 0;
@@ -4904,8 +5058,17 @@ void System::makeReducedJacobian(Eigen::MatrixXd& J,
         ++allcount;
         if ((*constr)->getTag() >= 0 && (*constr)->isDriving()) {
             jacobianconstraintcount++;
-            for (int j = 0; j < int(pdiagnoselist.size()); j++) {
-                J(jacobianconstraintcount - 1, j) = (*constr)->grad(pdiagnoselist[j]);
+            VEC_pD constrparams = c2p[*constr];
+            std::sort(constrparams.begin(), constrparams.end());
+            constrparams.erase(std::unique(constrparams.begin(), constrparams.end()),
+                               constrparams.end());
+            std::vector<double> derivs(constrparams.size());
+            (*constr)->grads(constrparams, derivs.data());
+            for (std::size_t k = 0; k < constrparams.size(); k++) {
+                auto it = pdiagnoseindex.find(constrparams[k]);
+                if (it != pdiagnoseindex.end() && derivs[k] != 0.) {
+                    triplets.emplace_back(jacobianconstraintcount - 1, it->second, derivs[k]);
+                }
             }
 
             // parallel processing: create tag multiplicity map
@@ -4923,6 +5086,11 @@ void System::makeReducedJacobian(Eigen::MatrixXd& J,
     if (jacobianconstraintcount == 0) {  // only driven constraints
         J.resize(0, 0);
     }
+    else {
+        J.resize(clist.size(), pdiagnoselist.size());
+        J.setFromTriplets(triplets.begin(), triplets.end());
+        J.makeCompressed();
+    }
 }
 
 int System::diagnose(Algorithm alg)
@@ -4976,7 +5144,8 @@ int System::diagnose(Algorithm alg)
     // The Jacobian has been reduced to:
     // 1. only contain driving constraints, but keep a full size (zero padded).
     // 2. remove the parameters of the values of driven constraints.
-    Eigen::MatrixXd J;
+    // It is assembled as a sparse matrix, only the dense QR works on a dense copy.
+    Eigen::SparseMatrix<double> J;
 
     // maps the index of the rows of the reduced jacobian matrix (solver constraints) to
     // the index those constraints would have in a full size Jacobian matrix
@@ -5067,6 +5236,7 @@ int System::diagnose(Algorithm alg)
         int rank = 0;  // rank is not cheap to retrieve from qrJT in DenseQR
         Eigen::MatrixXd R;
         Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qrJT;
+        Eigen::MatrixXd DJ = J;
         // Here we give the system the possibility to run the two QR decompositions in parallel,
         // depending on the load of the system so we are using the default std::launch::async |
         // std::launch::deferred policy, as nobody better than the system nows if it can run the
@@ -5081,12 +5251,12 @@ int System::diagnose(Algorithm alg)
         //
         auto fut = std::async(&System::identifyDependentParametersDenseQR,
                               this,
-                              J,
+                              DJ,
                               jacobianconstraintmap,
                               pdiagnoselist,
                               true);
 
-        makeDenseQRDecomposition(J, jacobianconstraintmap, qrJT, rank, R);
+        makeDenseQRDecomposition(DJ, jacobianconstraintmap, qrJT, rank, R);
 
         int paramsNum = qrJT.rows();
         int constrNum = qrJT.cols();
@@ -5287,7 +5457,7 @@ void System::makeDenseQRDecomposition(const Eigen::MatrixXd& J,
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
 void System::makeSparseQRDecomposition(
-    const Eigen::MatrixXd& J,
+    const Eigen::SparseMatrix<double>& SJ,
     const std::map<int, int>& jacobianconstraintmap,
     Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>>& SqrJT,
     int& rank,
@@ -5296,17 +5466,9 @@ void System::makeSparseQRDecomposition(
     bool silent)
 {
 
-    Eigen::SparseMatrix<double> SJ;
-
-    // this creation is not optimized (done using triplets)
-    // however the time this takes is negligible compared to the
-    // time the QR decomposition itself takes
-    SJ = J.sparseView();
-    SJ.makeCompressed();
-
 #ifdef _GCS_DEBUG
     if (!silent) {
-        SolverReportingManager::Manager().LogMatrix("J", J);
+        SolverReportingManager::Manager().LogMatrix("J", Eigen::MatrixXd(SJ));
     }
 #endif
 
@@ -5397,7 +5559,7 @@ void System::identifyDependentParametersDenseQR(const Eigen::MatrixXd& J,
 }
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
-void System::identifyDependentParametersSparseQR(const Eigen::MatrixXd& J,
+void System::identifyDependentParametersSparseQR(const Eigen::SparseMatrix<double>& J,
                                                  const std::map<int, int>& jacobianconstraintmap,
                                                  const GCS::VEC_pD& pdiagnoselist,
                                                  bool silent)
@@ -5559,18 +5721,23 @@ void System::identifyDependentGeometryParametersInTransposedJacobianDenseQRDecom
 
 void System::eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd& R, int rank)
 {
-    for (int i = 1; i < rank; i++) {
-        // eliminate non zeros above pivot
-        assert(R(i, i) != 0);
-        for (int row = 0; row < i; row++) {
-            if (R(row, i) != 0) {
-                double coef = R(row, i) / R(i, i);
-                R.block(row, i + 1, 1, R.cols() - i - 1) -=
-                    coef * R.block(i, i + 1, 1, R.cols() - i - 1);
-                R(row, i) = 0;
-            }
-        }
+    if (rank < 2) {
+        return;
+    }
+
+    // Eliminating the non zeros above the pivots turns R = [R11 R12] into [D D*R11^-1*R12],
+    // with D the diagonal of R11. Only a few columns follow the pivots, so a triangular solve
+    // for them is much cheaper than the elimination row by row over the whole matrix.
+    Eigen::VectorXd diagonal = R.diagonal().head(rank);
+    assert((diagonal.array() != 0).all());
+    int cols = int(R.cols()) - rank;
+    if (cols > 0) {
+        Eigen::MatrixXd X = R.topLeftCorner(rank, rank)
+                                .triangularView<Eigen::Upper>()
+                                .solve(R.topRightCorner(rank, cols));
+        R.topRightCorner(rank, cols) = diagonal.asDiagonal() * X;
     }
+    R.topLeftCorner(rank, rank) = diagonal.asDiagonal();
 }
 
 template<typename T>
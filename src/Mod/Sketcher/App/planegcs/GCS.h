@@ -23,6 +23,9 @@
 #ifndef PLANEGCS_GCS_H
 #define PLANEGCS_GCS_H
 
+#include <atomic>
+#include <chrono>
+
 #include <Eigen/QR>
 
 #include "../../SketcherGlobal.h"
@@ -125,9 +128,15 @@ private:
     void clearSubSystems();
 
     VEC_D reference;
-    void setReference();      // copies the current parameter values to reference
     void resetToReference();  // reverts all parameter values to the stored reference
 
+    // end of the time budget of the running solve, see DL_maxTime
+    std::chrono::steady_clock::time_point deadline;
+    bool hasDeadline {false};
+
+    // iterations of the running solve, summed up over the subsystems
+    std::atomic<int> iterations {0};
+
     std::vector<VEC_pD> plists;  // partitioned plist except equality constraints
     // partitioned clist except equality constraints
     std::vector<std::vector<Constraint*>> clists;
@@ -147,7 +156,7 @@ private:
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
 
-    void makeReducedJacobian(Eigen::MatrixXd& J,
+    void makeReducedJacobian(Eigen::SparseMatrix<double>& J,
                              std::map<int, int>& jacobianconstraintmap,
                              GCS::VEC_pD& pdiagnoselist,
                              std::map<int, int>& tagmultiplicity);
@@ -162,7 +171,7 @@ private:
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
     void makeSparseQRDecomposition(
-        const Eigen::MatrixXd& J,
+        const Eigen::SparseMatrix<double>& J,
         const std::map<int, int>& jacobianconstraintmap,
         Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>>& SqrJT,
         int& rank,
@@ -193,7 +202,7 @@ private:
     void eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd& R, int rank);
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
-    void identifyDependentParametersSparseQR(const Eigen::MatrixXd& J,
+    void identifyDependentParametersSparseQR(const Eigen::SparseMatrix<double>& J,
                                              const std::map<int, int>& jacobianconstraintmap,
                                              const GCS::VEC_pD& pdiagnoselist,
                                              bool silent = true);
@@ -238,6 +247,14 @@ public:
     double DL_tolgRedundant;
     double DL_tolxRedundant;
     double DL_tolfRedundant;
+    // LM and DL use a sparse jacobi matrix for subsystems with at least this many parameters
+    int sparseThreshold;
+    // time budget in seconds of a DL solve, 0 means unlimited. If it runs out, a solution with
+    // a residual below DL_tolfCoarse is accepted.
+    double DL_maxTime;
+    double DL_tolfCoarse;
+    // solve the decoupled subsystems on several threads
+    bool concurrentSolving;
 
 public:
     System();
@@ -542,6 +559,8 @@ public:
     void declareUnknowns(VEC_pD& params);
     void declareDrivenParams(VEC_pD& params);
     void initSolution(Algorithm alg = DogLeg);
+    // copies the current parameter values to the reference, the start of the next solve
+    void setReference();
 
     int solve(bool isFine = true, Algorithm alg = DogLeg, bool isRedundantsolving = false);
     int solve(VEC_pD& params,
@@ -569,6 +588,12 @@ public:
         return convergence;
     }
 
+    // number of iterations the last solve took, summed up over the decoupled subsystems
+    int getIterations() const
+    {
+        return iterations;
+    }
+
     int diagnose(Algorithm alg = DogLeg);
     int dofsNumber() const
     {
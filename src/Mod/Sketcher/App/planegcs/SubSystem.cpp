@@ -24,6 +24,7 @@
 #pragma warning(disable : 4251)
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 
@@ -261,11 +262,29 @@ void SubSystem::calcResidual(Eigen::VectorXd& r, double& err)
 void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 {
     jacobi.setZero(csize, params.size());
+
+    // columns of the parameters, several parameters may be redirected to the same value
+    std::map<double*, std::vector<int>> columns;
     for (int j = 0; j < int(params.size()); j++) {
         MAP_pD_pD::const_iterator pmapfind = pmap.find(params[j]);
         if (pmapfind != pmap.end()) {
-            for (int i = 0; i < csize; i++) {
-                jacobi(i, j) = clist[i]->grad(pmapfind->second);
+            columns[pmapfind->second].push_back(j);
+        }
+    }
+
+    // a constraint only depends on its own parameters
+    std::vector<double> derivs;
+    for (int i = 0; i < csize; i++) {
+        const VEC_pD& constr_params = c2p[clist[i]];
+        derivs.resize(constr_params.size());
+        clist[i]->grads(constr_params, derivs.data());
+        for (std::size_t k = 0; k < constr_params.size(); k++) {
+            std::map<double*, std::vector<int>>::const_iterator it =
+                columns.find(constr_params[k]);
+            if (it != columns.end()) {
+                for (int j : it->second) {
+                    jacobi(i, j) = derivs[k];
+                }
             }
         }
     }
@@ -276,6 +295,59 @@ void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
     calcJacobi(plist, jacobi);
 }
 
+void SubSystem::analyseJacobi()
+{
+    jacobiRows.assign(1, 0);
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < csize; i++) {
+        const VEC_pD& constr_params = c2p[clist[i]];
+        for (VEC_pD::const_iterator p = constr_params.begin(); p != constr_params.end(); ++p) {
+            // c2p refers to the values in pvals
+            triplets.emplace_back(i, static_cast<int>(*p - pvals.data()), 1.);
+        }
+        jacobiRows.push_back(triplets.size());
+    }
+
+    jacobiPattern.resize(csize, psize);
+    jacobiPattern.setFromTriplets(triplets.begin(), triplets.end());
+    jacobiPattern.makeCompressed();
+
+    // position of each non-zero in the value array, the rows of a column are sorted
+    jacobiValues.clear();
+    jacobiValues.reserve(triplets.size());
+    const auto* outer = jacobiPattern.outerIndexPtr();
+    const auto* inner = jacobiPattern.innerIndexPtr();
+    for (const auto& it : triplets) {
+        const auto* first = inner + outer[it.col()];
+        const auto* last = inner + outer[it.col() + 1];
+        jacobiValues.push_back(std::lower_bound(first, last, it.row()) - inner);
+    }
+}
+
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    if (jacobiRows.empty()) {
+        analyseJacobi();
+    }
+
+    if (jacobi.rows() != jacobiPattern.rows() || jacobi.cols() != jacobiPattern.cols()
+        || jacobi.nonZeros() != jacobiPattern.nonZeros() || !jacobi.isCompressed()) {
+        jacobi = jacobiPattern;
+    }
+
+    // the rows are evaluated in the order of c2p, as in analyseJacobi()
+    double* values = jacobi.valuePtr();
+    std::vector<double> derivs;
+    for (int i = 0; i < csize; i++) {
+        derivs.resize(jacobiRows[i + 1] - jacobiRows[i]);
+        clist[i]->grads(c2p[clist[i]], derivs.data());
+        for (std::size_t k = jacobiRows[i]; k < jacobiRows[i + 1]; k++) {
+            values[jacobiValues[k]] = derivs[k - jacobiRows[i]];
+        }
+    }
+}
+
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
 {
     assert(grad.size() == int(params.size()));
@@ -325,6 +397,83 @@ double SubSystem::maxStep(Eigen::VectorXd& xdir)
     return maxStep(plist, xdir);
 }
 
+bool SubSystem::SparsePattern::update(const Eigen::SparseMatrix<double>& mat)
+{
+    const auto* outerPtr = mat.outerIndexPtr();
+    const auto* innerPtr = mat.innerIndexPtr();
+    Eigen::Index numOuter = mat.outerSize() + 1;
+    Eigen::Index numInner = mat.nonZeros();
+    if (mat.isCompressed() && outer.size() == std::size_t(numOuter)
+        && inner.size() == std::size_t(numInner)
+        && std::equal(outer.begin(), outer.end(), outerPtr)
+        && std::equal(inner.begin(), inner.end(), innerPtr)) {
+        return false;
+    }
+
+    if (mat.isCompressed()) {
+        outer.assign(outerPtr, outerPtr + numOuter);
+        inner.assign(innerPtr, innerPtr + numInner);
+    }
+    else {
+        outer.clear();
+        inner.clear();
+    }
+    return true;
+}
+
+bool SubSystem::solveSparseLDLT(const Eigen::SparseMatrix<double>& A,
+                                const Eigen::VectorXd& b,
+                                Eigen::VectorXd& x)
+{
+    if (ldltPattern.update(A)) {
+        ldlt.analyzePattern(A);
+    }
+    ldlt.factorize(A);
+    if (ldlt.info() != Eigen::Success) {
+        return false;
+    }
+    x = ldlt.solve(b);
+    return ldlt.info() == Eigen::Success && x.allFinite();
+}
+
+bool SubSystem::solveSparseQR(const Eigen::SparseMatrix<double>& A,
+                              const Eigen::VectorXd& b,
+                              Eigen::VectorXd& x)
+{
+    if (A.rows() >= A.cols()) {
+        if (sparseQRPattern.update(A)) {
+            sparseQR.analyzePattern(A);
+        }
+        sparseQR.factorize(A);
+        if (sparseQR.info() != Eigen::Success) {
+            return false;
+        }
+        x = sparseQR.solve(b);
+        return sparseQR.info() == Eigen::Success && x.allFinite();
+    }
+
+    // An underdetermined system gets the minimum norm solution from the decomposition of the
+    // transposed matrix: A^T P = Q R, so R^T (Q^T x) = P^T b
+    Eigen::SparseMatrix<double> At = A.transpose();
+    if (sparseQRPattern.update(At)) {
+        sparseQR.analyzePattern(At);
+    }
+    sparseQR.factorize(At);
+    if (sparseQR.info() != Eigen::Success) {
+        return false;
+    }
+
+    Eigen::Index rank = sparseQR.rank();
+    Eigen::VectorXd c = sparseQR.colsPermutation().transpose() * b;
+    // the transposition also sorts the indices of R, which is required by the block
+    Eigen::SparseMatrix<double> Rt = sparseQR.matrixR().transpose();
+    Eigen::SparseMatrix<double> R1t = Rt.topLeftCorner(rank, rank);
+    Eigen::VectorXd z = Eigen::VectorXd::Zero(A.cols());
+    z.head(rank) = R1t.triangularView<Eigen::Lower>().solve(c.head(rank));
+    x = sparseQR.matrixQ() * z;
+    return x.allFinite();
+}
+
 void SubSystem::applySolution()
 {
     for (MAP_pD_pD::const_iterator it = pmap.begin(); it != pmap.end(); ++it) {
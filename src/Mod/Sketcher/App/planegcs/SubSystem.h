@@ -27,6 +27,8 @@
 #undef max
 
 #include <Eigen/Core>
+#include <Eigen/OrderingMethods>
+#include <Eigen/Sparse>
 
 #include "Constraints.h"
 
@@ -46,6 +48,27 @@ private:
     std::map<Constraint*, VEC_pD> c2p;                // constraint to parameter adjacency list
     std::map<double*, std::vector<Constraint*>> p2c;  // parameter to constraint adjacency list
     void initialize(VEC_pD& params, MAP_pD_pD& reductionmap);  // called by the constructors
+
+    // The sparsity pattern of the jacobi matrix. The non-zeros are ordered by constraint, for
+    // each one the position of the derivatives of its parameters (in the order of c2p) in the
+    // value array of the matrix is stored.
+    Eigen::SparseMatrix<double> jacobiPattern;
+    std::vector<Eigen::Index> jacobiValues;
+    std::vector<std::size_t> jacobiRows;
+    void analyseJacobi();
+
+    // The sparse solvers keep the symbolic factorization as long as the pattern doesn't change
+    struct SparsePattern
+    {
+        std::vector<Eigen::SparseMatrix<double>::StorageIndex> outer;
+        std::vector<Eigen::SparseMatrix<double>::StorageIndex> inner;
+        bool update(const Eigen::SparseMatrix<double>& mat);
+    };
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt;
+    SparsePattern ldltPattern;
+    Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> sparseQR;
+    SparsePattern sparseQRPattern;
+
 public:
     SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params);
     SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params, MAP_pD_pD& reductionmap);
@@ -78,12 +101,27 @@ public:
     void calcResidual(Eigen::VectorXd& r, double& err);
     void calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi);
     void calcJacobi(Eigen::MatrixXd& jacobi);
+    // The sparsity pattern is computed by the first call, a matrix with this pattern
+    // only gets its values updated
+    void calcJacobi(Eigen::SparseMatrix<double>& jacobi);
     void calcGrad(VEC_pD& params, Eigen::VectorXd& grad);
     void calcGrad(Eigen::VectorXd& grad);
 
     double maxStep(VEC_pD& params, Eigen::VectorXd& xdir);
     double maxStep(Eigen::VectorXd& xdir);
 
+    // Solves A*x = b for a symmetric positive definite A with a sparse Cholesky (LDLT)
+    // decomposition. The symbolic factorization is reused while the pattern of A is unchanged.
+    bool solveSparseLDLT(const Eigen::SparseMatrix<double>& A,
+                         const Eigen::VectorXd& b,
+                         Eigen::VectorXd& x);
+    // Solves A*x = b in the least squares sense with a sparse QR decomposition, or gives the
+    // minimum norm solution if A has more columns than rows. The symbolic factorization is
+    // reused while the pattern of A is unchanged.
+    bool solveSparseQR(const Eigen::SparseMatrix<double>& A,
+                       const Eigen::VectorXd& b,
+                       Eigen::VectorXd& x);
+
     void applySolution();
     void analyse(Eigen::MatrixXd& J, Eigen::MatrixXd& ker, Eigen::MatrixXd& img);
     void report();
@@ -2181,22 +2181,21 @@ void ViewProviderSketch::onSelectionChanged(const Gui::SelectionChanges& msg)
             }
         }
         else if (msg.Type == Gui::SelectionChanges::SetSelection) {
-            // remove all items
-            // selectionView->clear();
-            // std::vector<SelectionSingleton::SelObj> objs =
-            // Gui::Selection().getSelection(Reason.pDocName); for
-            // (std::vector<SelectionSingleton::SelObj>::iterator it = objs.begin(); it !=
-            // objs.end(); ++it) {
-            //    // build name
-            //    temp = it->DocName;
-            //    temp += ".";
-            //    temp += it->FeatName;
-            //    if (it->SubName && it->SubName[0] != '\0') {
-            //        temp += ".";
-            //        temp += it->SubName;
-            //    }
-            //    new QListWidgetItem(QString::fromLatin1(temp.c_str()), selectionView);
-            //}
+            // any number of elements may have been added or removed at once, e.g. by
+            // Gui::SelectionSingleton::addSelections(), so pick up the whole selection again
+            if (strcmp(msg.pDocName, getSketchObject()->getDocument()->getName()) == 0) {
+                onSelectionChanged(Gui::SelectionChanges(Gui::SelectionChanges::ClrSelection));
+                for (const auto& sel :
+                     Gui::Selection().getSelection(msg.pDocName, Gui::ResolveMode::NoResolve)) {
+                    if (sel.pObject == getSketchObject()) {
+                        onSelectionChanged(Gui::SelectionChanges(Gui::SelectionChanges::AddSelection,
+                                                                 sel.DocName,
+                                                                 sel.FeatName,
+                                                                 sel.SubName,
+                                                                 sel.TypeName));
+                    }
+                }
+            }
         }
         else if (msg.Type == Gui::SelectionChanges::SetPreselect) {
             if (strcmp(msg.pDocName, getSketchObject()->getDocument()->getName()) == 0
@@ -23,10 +23,10 @@
 #include "PreCompiled.h"
 #ifndef _PreComp_
 #include <algorithm>
+#include <cctype>
 
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/algorithm/copy.hpp>
-#include <boost/regex.hpp>
 #endif
 
 #include <App/Document.h>
@@ -105,7 +105,7 @@ const Cell* PropertySheet::getValue(CellAddress key) const
 
 Cell* PropertySheet::getValueFromAlias(const std::string& alias)
 {
-    std::map<std::string, CellAddress>::const_iterator it = revAliasProp.find(alias);
+    auto it = revAliasProp.find(alias);
 
     if (it != revAliasProp.end()) {
         return getValue(it->second);
@@ -117,7 +117,7 @@ Cell* PropertySheet::getValueFromAlias(const std::string& alias)
 
 const Cell* PropertySheet::getValueFromAlias(const std::string& alias) const
 {
-    std::map<std::string, CellAddress>::const_iterator it = revAliasProp.find(alias);
+    auto it = revAliasProp.find(alias);
 
     if (it != revAliasProp.end()) {
         return getValue(it->second);
@@ -130,28 +130,20 @@ const Cell* PropertySheet::getValueFromAlias(const std::string& alias) const
 bool PropertySheet::isValidCellAddressName(const std::string& candidate)
 {
     /* Check if it matches a cell reference */
-    static const boost::regex e("\\${0,1}([A-Z]{1,2})\\${0,1}([0-9]{1,5})");
-    boost::cmatch cm;
-
-    if (boost::regex_match(candidate.c_str(), cm, e)) {
-        const boost::sub_match<const char*> colstr = cm[1];
-        const boost::sub_match<const char*> rowstr = cm[2];
-
-        if (App::validRow(rowstr.str()) >= 0 && App::validColumn(colstr.str())) {
-            return true;
-        }
-    }
-    return false;
+    return App::stringToAddress(candidate.c_str(), true).isValid();
 }
 
 bool PropertySheet::isValidAlias(const std::string& candidate)
 {
     /* Ensure it only contains allowed characters */
-    static const boost::regex gen("^[A-Za-z][_A-Za-z0-9]*$");
-    boost::cmatch cm;
-    if (!boost::regex_match(candidate.c_str(), cm, gen)) {
+    if (candidate.empty() || !std::isalpha(static_cast<unsigned char>(candidate[0]))) {
         return false;
     }
+    for (char chr : candidate) {
+        if (chr != '_' && !std::isalnum(static_cast<unsigned char>(chr))) {
+            return false;
+        }
+    }
 
     /* Check if it is used before */
     if (getValueFromAlias(candidate)) {
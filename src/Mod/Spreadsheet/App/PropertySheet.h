@@ -24,6 +24,7 @@
 #define PROPERTYSHEET_H
 
 #include <map>
+#include <unordered_map>
 
 #include <App/DocumentObject.h>
 #include <App/PropertyLinks.h>
@@ -326,7 +327,7 @@ private:
     std::map<App::CellAddress, std::string> aliasProp;
 
     /*! Mapping of alias property to cell position */
-    std::map<std::string, App::CellAddress> revAliasProp;
+    std::unordered_map<std::string, App::CellAddress> revAliasProp;
 
     /*! The associated python object */
     Py::SmartPtr PythonObject;
@@ -459,6 +459,26 @@ void Sheet::setCell(CellAddress address, const char* value)
     setContent(address, value);
 }
 
+/**
+ * Set the cells given by \a values like setCell(). The dependencies of the
+ * sheet are updated and its change is signalled only once at the end, which
+ * is much faster than setting many cells one by one.
+ *
+ * @param values Addresses and contents of the cells.
+ *
+ */
+
+void Sheet::setCells(const std::vector<std::pair<CellAddress, std::string>>& values)
+{
+    PropertySheet::AtomicPropertyChange signaller(cells);
+
+    for (const auto& it : values) {
+        setCell(it.first, it.second.c_str());
+    }
+
+    signaller.tryInvoke();
+}
+
 /**
  * Get the Python object for the Sheet.
  *
@@ -592,7 +612,10 @@ Property* Sheet::setFloatProperty(CellAddress key, double value)
     }
 
     propAddress[floatProp] = key;
-    floatProp->setValue(value);
+    if (floatProp != prop || floatProp->getValue() != value) {
+        floatProp->setValue(value);
+        cellValueChanged = true;
+    }
 
     return floatProp;
 }
@@ -620,7 +643,10 @@ Property* Sheet::setIntegerProperty(CellAddress key, long value)
     }
 
     propAddress[intProp] = key;
-    intProp->setValue(value);
+    if (intProp != prop || intProp->getValue() != value) {
+        intProp->setValue(value);
+        cellValueChanged = true;
+    }
 
     return intProp;
 }
@@ -660,8 +686,12 @@ Property* Sheet::setQuantityProperty(CellAddress key, double value, const Base::
     }
 
     propAddress[quantityProp] = key;
-    quantityProp->setValue(value);
-    quantityProp->setUnit(unit);
+    if (quantityProp != prop || quantityProp->getValue() != value
+        || quantityProp->getUnit() != unit) {
+        quantityProp->setValue(value);
+        quantityProp->setUnit(unit);
+        cellValueChanged = true;
+    }
 
     cells.setComputedUnit(key, unit);
 
@@ -698,7 +728,10 @@ Property* Sheet::setStringProperty(CellAddress key, const std::string& value)
     }
 
     propAddress[stringProp] = key;
-    stringProp->setValue(value.c_str());
+    if (stringProp != prop || value != stringProp->getValue()) {
+        stringProp->setValue(value.c_str());
+        cellValueChanged = true;
+    }
 
     return stringProp;
 }
@@ -722,8 +755,10 @@ Property* Sheet::setObjectProperty(CellAddress key, Py::Object object)
                                Prop_ReadOnly | Prop_Hidden | Prop_NoPersist));
     }
 
+    // Comparing Python objects may run arbitrary code, so always assign
     propAddress[pyProp] = key;
     pyProp->setValue(object);
+    cellValueChanged = true;
 
     return pyProp;
 }
@@ -775,6 +810,7 @@ void Sheet::updateProperty(CellAddress key)
             }
             else {
                 this->removeDynamicProperty(key.toString().c_str());
+                cellValueChanged = true;
                 return;
             }
         }
@@ -818,6 +854,7 @@ void Sheet::updateProperty(CellAddress key)
     }
     else {
         clear(key);
+        cellValueChanged = true;
     }
 
     cellUpdated(key);
@@ -891,11 +928,14 @@ void Sheet::recomputeCells(Range range)
 /**
  * @brief Recompute cell at address \a p.
  * @param p Address of cell.
+ * @return True if the value of the cell has changed or it has failed, i.e.
+ * the cells depending on it must be recomputed too.
  */
 
-void Sheet::recomputeCell(CellAddress p)
+bool Sheet::recomputeCell(CellAddress p)
 {
     Cell* cell = cells.getValue(p);
+    cellValueChanged = false;
 
     try {
         if (cell && cell->hasException()) {
@@ -908,7 +948,13 @@ void Sheet::recomputeCell(CellAddress p)
 
         if (!cell || !cell->hasException()) {
             cells.clearDirty(p);
-            cellErrors.erase(p);
+            // a cell recovering from an error must update its dependents
+            if (cellErrors.erase(p) > 0) {
+                cellValueChanged = true;
+            }
+        }
+        else {
+            cellValueChanged = true;
         }
     }
     catch (const Base::Exception& e) {
@@ -929,7 +975,9 @@ void Sheet::recomputeCell(CellAddress p)
         if (e.isDerivedFrom<Base::AbortException>()) {
             throw;
         }
+        cellValueChanged = true;
     }
+    return cellValueChanged;
 }
 
 PropertySheet::BindingType Sheet::getCellBinding(Range& range,
@@ -1042,6 +1090,7 @@ DocumentObjectExecReturn* Sheet::execute()
     DependencyList graph;
     std::map<CellAddress, Vertex> VertexList;
     std::map<Vertex, CellAddress> VertexIndexList;
+    const std::set<CellAddress> sourceCells = dirtyCells;
     std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
     while (!workQueue.empty()) {
         CellAddress currPos = workQueue.front();
@@ -1073,12 +1122,26 @@ DocumentObjectExecReturn* Sheet::execute()
     // Sort graph topologically to find evaluation order
     try {
         boost::topological_sort(graph, std::front_inserter(make_order));
-        // Recompute cells
+        // Recompute cells. A dependent cell is only recomputed if one of its
+        // inputs has changed, so an edit stops propagating at the first cells
+        // whose values stay the same.
         FC_LOG("recomputing " << getFullName());
+        std::vector<bool> inputChanged(num_vertices(graph), false);
+        for (const auto& addr : sourceCells) {
+            inputChanged[VertexList[addr]] = true;
+        }
         for (auto& pos : make_order) {
+            if (!inputChanged[pos]) {
+                continue;
+            }
             const auto& addr = VertexIndexList[pos];
             FC_TRACE(addr.toString());
-            recomputeCell(addr);
+            if (recomputeCell(addr)) {
+                Traits::adjacency_iterator dep, end;
+                for (boost::tie(dep, end) = adjacent_vertices(pos, graph); dep != end; ++dep) {
+                    inputChanged[*dep] = true;
+                }
+            }
         }
     }
     catch (std::exception&) {
@@ -120,6 +120,8 @@ public:
 
     void setCell(App::CellAddress address, const char* value);
 
+    void setCells(const std::vector<std::pair<App::CellAddress, std::string>>& values);
+
     void clearAll();
 
     void clear(App::CellAddress address, bool all = true);
@@ -243,7 +245,7 @@ protected:
 
     void onDocumentRestored() override;
 
-    void recomputeCell(App::CellAddress p);
+    bool recomputeCell(App::CellAddress p);
 
     App::Property* getProperty(App::CellAddress key) const;
 
@@ -274,6 +276,9 @@ protected:
     /* Set of cells with errors */
     std::set<App::CellAddress> cellErrors;
 
+    /* Set by updateProperty() if the value of the cell has changed */
+    bool cellValueChanged = false;
+
     /* Properties */
 
     /* Cell data */
@@ -39,6 +39,32 @@
 using namespace Spreadsheet;
 using namespace App;
 
+namespace
+{
+
+// Appends the cells of an address, range or alias with their contents to \a values
+void addCellValues(Sheet* sheet,
+                   const char* address,
+                   const char* contents,
+                   std::vector<std::pair<CellAddress, std::string>>& values)
+{
+    std::string cellAddress = sheet->getAddressFromAlias(address);
+
+    /* Check to see if address is really an alias first */
+    if (!cellAddress.empty()) {
+        values.emplace_back(CellAddress(cellAddress.c_str()), contents);
+    }
+    else {
+        Range rangeIter(address);
+
+        do {
+            values.emplace_back(*rangeIter, contents);
+        } while (rangeIter.next());
+    }
+}
+
+}  // namespace
+
 // returns a string which represents the object e.g. when printed in python
 std::string SheetPy::representation() const
 {
@@ -71,19 +97,42 @@ PyObject* SheetPy::set(PyObject* args)
 
     try {
         Sheet* sheet = getSheetPtr();
-        std::string cellAddress = sheet->getAddressFromAlias(address).c_str();
+        std::vector<std::pair<CellAddress, std::string>> values;
+        addCellValues(sheet, address, contents, values);
+        sheet->setCells(values);
+    }
+    catch (const Base::Exception& e) {
+        PyErr_SetString(PyExc_ValueError, e.what());
+        return nullptr;
+    }
 
-        /* Check to see if address is really an alias first */
-        if (!cellAddress.empty()) {
-            sheet->setCell(cellAddress.c_str(), contents);
-        }
-        else {
-            Range rangeIter(address);
+    Py_Return;
+}
 
-            do {
-                sheet->setCell(rangeIter.address().c_str(), contents);
-            } while (rangeIter.next());
+PyObject* SheetPy::setCells(PyObject* args)
+{
+    PyObject* dict;
+
+    if (!PyArg_ParseTuple(args, "O!:setCells", &PyDict_Type, &dict)) {
+        return nullptr;
+    }
+
+    try {
+        Sheet* sheet = getSheetPtr();
+        std::vector<std::pair<CellAddress, std::string>> values;
+        values.reserve(PyDict_Size(dict));
+
+        PyObject* key;
+        PyObject* value;
+        Py_ssize_t pos = 0;
+        while (PyDict_Next(dict, &pos, &key, &value)) {
+            if (!PyUnicode_Check(key) || !PyUnicode_Check(value)) {
+                PyErr_SetString(PyExc_TypeError, "Expect a dict of address and content strings");
+                return nullptr;
+            }
+            addCellValues(sheet, PyUnicode_AsUTF8(key), PyUnicode_AsUTF8(value), values);
         }
+        sheet->setCells(values);
     }
     catch (const Base::Exception& e) {
         PyErr_SetString(PyExc_ValueError, e.what());
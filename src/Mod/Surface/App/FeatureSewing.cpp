@@ -22,9 +22,20 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <thread>
+
+#include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
+#include <BRep_Builder.hxx>
+#include <Bnd_Box.hxx>
 #include <Precision.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
 #endif
 
 #include "FeatureSewing.h"
@@ -32,6 +43,72 @@
 
 using namespace Surface;
 
+namespace
+{
+
+/**
+ * Splits \a shapes into groups that cannot be sewn to each other because their bounding boxes,
+ * enlarged by \a tolerance, neither overlap directly nor through other shapes of the group.
+ */
+std::vector<std::vector<TopoDS_Shape>> groupShapes(const std::vector<TopoDS_Shape>& shapes,
+                                                   double tolerance)
+{
+    std::size_t count = shapes.size();
+    std::vector<Bnd_Box> boxes(count);
+    std::vector<std::size_t> order;
+    std::vector<std::size_t> parent(count);
+    std::iota(parent.begin(), parent.end(), 0);
+    for (std::size_t i = 0; i < count; i++) {
+        BRepBndLib::Add(shapes[i], boxes[i]);
+        boxes[i].Enlarge(tolerance);
+        // shapes without a box go into the group of the first shape
+        if (boxes[i].IsVoid()) {
+            parent[i] = 0;
+        }
+        else {
+            order.push_back(i);
+        }
+    }
+
+    auto find = [&parent](std::size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    // sweep along the x axis and join the shapes with overlapping boxes
+    std::sort(order.begin(), order.end(), [&boxes](std::size_t i, std::size_t j) {
+        return boxes[i].CornerMin().X() < boxes[j].CornerMin().X();
+    });
+    for (auto it = order.begin(); it != order.end(); ++it) {
+        double xMax = boxes[*it].CornerMax().X();
+        for (auto jt = it + 1; jt != order.end() && boxes[*jt].CornerMin().X() <= xMax; ++jt) {
+            if (!boxes[*it].IsOut(boxes[*jt])) {
+                std::size_t root1 = find(*it);
+                std::size_t root2 = find(*jt);
+                parent[std::max(root1, root2)] = std::min(root1, root2);
+            }
+        }
+    }
+
+    // keep the order of the shapes within and between the groups
+    std::vector<std::vector<TopoDS_Shape>> groups;
+    std::vector<std::size_t> groupIndex(count);
+    for (std::size_t i = 0; i < count; i++) {
+        std::size_t root = find(i);
+        if (root == i) {
+            groupIndex[i] = groups.size();
+            groups.emplace_back();
+        }
+        groups[groupIndex[root]].push_back(shapes[i]);
+    }
+    return groups;
+}
+
+}  // namespace
+
 PROPERTY_SOURCE(Surface::Sewing, Part::Feature)
 
 // Initial values
@@ -75,8 +152,7 @@ App::DocumentObjectExecReturn* Sewing::execute()
     bool opt4 = Nonmanifold.getValue();
 
     try {
-        BRepBuilderAPI_Sewing builder(atol, opt1, opt2, opt3, opt4);
-
+        std::vector<TopoDS_Shape> shapes;
         std::vector<App::PropertyLinkSubList::SubSet> subset = ShapeList.getSubListValues();
         for (const auto& it : subset) {
             // the subset has the documentobject and the element name which belongs to it,
@@ -87,8 +163,7 @@ App::DocumentObjectExecReturn* Sewing::execute()
 
                 // we want only the subshape which is linked
                 for (const auto& jt : it.second) {
-                    TopoDS_Shape sub = ts.getSubShape(jt.c_str());
-                    builder.Add(sub);
+                    shapes.push_back(ts.getSubShape(jt.c_str()));
                 }
             }
             else {
@@ -96,9 +171,66 @@ App::DocumentObjectExecReturn* Sewing::execute()
             }
         }
 
-        builder.Perform();  // Perform Sewing
+        auto sew = [=](const std::vector<TopoDS_Shape>& group) {
+            BRepBuilderAPI_Sewing builder(atol, opt1, opt2, opt3, opt4);
+            for (const auto& shape : group) {
+                builder.Add(shape);
+            }
+            builder.Perform();  // Perform Sewing
+            return builder.SewedShape();
+        };
+
+        // Shapes of different groups do not touch and are sewn independently. The groups are
+        // handed out to the worker threads one by one, so a big group does not hold up the
+        // small ones.
+        std::vector<std::vector<TopoDS_Shape>> groups = groupShapes(shapes, atol);
+        std::vector<TopoDS_Shape> sewed(groups.size());
+        if (groups.size() == 1) {
+            sewed.front() = sew(groups.front());
+        }
+        else if (groups.size() > 1) {
+            std::atomic<std::size_t> next {0};
+            auto worker = [&]() {
+                for (std::size_t i = next++; i < groups.size(); i = next++) {
+                    sewed[i] = sew(groups[i]);
+                }
+            };
+
+            std::size_t threads = std::max(std::thread::hardware_concurrency(), 1U);
+            std::vector<std::future<void>> futures;
+            for (std::size_t i = 1; i < std::min(threads, groups.size()); i++) {
+                futures.push_back(std::async(std::launch::async, worker));
+            }
+            worker();
+            for (auto& future : futures) {
+                future.get();
+            }
+        }
 
-        TopoDS_Shape aShape = builder.SewedShape();  // Get Shape
+        TopoDS_Shape aShape;
+        if (sewed.size() == 1) {
+            aShape = sewed.front();
+        }
+        else if (sewed.size() > 1) {
+            // like the sewing of all shapes at once return a compound of the shells and faces
+            BRep_Builder builder;
+            TopoDS_Compound comp;
+            builder.MakeCompound(comp);
+            for (const auto& shape : sewed) {
+                if (shape.IsNull()) {
+                    continue;
+                }
+                if (shape.ShapeType() == TopAbs_COMPOUND) {
+                    for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+                        builder.Add(comp, it.Value());
+                    }
+                }
+                else {
+                    builder.Add(comp, shape);
+                }
+            }
+            aShape = comp;
+        }
         if (aShape.IsNull()) {
             return new App::DocumentObjectExecReturn("Resulting shape is null");
         }
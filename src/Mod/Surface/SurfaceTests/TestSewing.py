@@ -0,0 +1,84 @@
+# ***************************************************************************
+# *                                                                         *
+# *   This program is free software; you can redistribute it and/or modify  *
+# *   it under the terms of the GNU Lesser General Public License (LGPL)    *
+# *   as published by the Free Software Foundation; either version 2 of     *
+# *   the License, or (at your option) any later version.                   *
+# *   for detail see the LICENCE text file.                                 *
+# *                                                                         *
+# *   This program is distributed in the hope that it will be useful,       *
+# *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+# *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+# *   GNU Library General Public License for more details.                  *
+# *                                                                         *
+# *   You should have received a copy of the GNU Library General Public     *
+# *   License along with this program; if not, write to the Free Software   *
+# *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  *
+# *   USA                                                                   *
+# *                                                                         *
+# ***************************************************************************
+
+__title__ = "Surface sewing unit tests"
+__url__ = "https://www.freecad.org"
+
+import unittest
+
+import FreeCAD
+import Part
+
+
+class TestSewing(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("TestSewing")
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
+
+    def addFaces(self, placements):
+        """Adds a feature with the faces of a cube at each of the placements"""
+        faces = []
+        for placement in placements:
+            box = Part.makeBox(10, 10, 10)
+            box.Placement = placement
+            faces.extend(f.copy() for f in box.Faces)
+        feature = self.doc.addObject("Part::Feature", "Faces")
+        feature.Shape = Part.makeCompound(faces)
+        return feature
+
+    def sew(self, feature):
+        sewing = self.doc.addObject("Surface::Sewing", "Sewing")
+        names = ["Face{}".format(i + 1) for i in range(len(feature.Shape.Faces))]
+        sewing.ShapeList = [(feature, names)]
+        self.doc.recompute()
+        return sewing.Shape
+
+    def test_sew_one_group(self):
+        feature = self.addFaces([FreeCAD.Placement()])
+        shape = self.sew(feature)
+        self.assertEqual(shape.ShapeType, "Shell")
+        self.assertTrue(shape.isClosed())
+
+    def test_sew_separate_groups(self):
+        placements = [FreeCAD.Placement(FreeCAD.Vector(20 * i, 0, 0), FreeCAD.Rotation())
+                      for i in range(4)]
+        feature = self.addFaces(placements)
+        shape = self.sew(feature)
+        self.assertEqual(shape.ShapeType, "Compound")
+        self.assertEqual(len(shape.Shells), 4)
+        for shell in shape.Shells:
+            self.assertEqual(len(shell.Faces), 6)
+            self.assertTrue(shell.isClosed())
+
+    def test_sew_touching_groups(self):
+        # the second cube shares a face with the first one and the third is apart
+        placements = [FreeCAD.Placement(FreeCAD.Vector(x, 0, 0), FreeCAD.Rotation())
+                      for x in (0, 10, 30)]
+        feature = self.addFaces(placements)
+        shape = self.sew(feature)
+
+        # sewing all faces at once gives the same shells
+        reference = feature.Shape.copy()
+        reference.sewShape()
+        self.assertEqual(shape.ShapeType, "Compound")
+        self.assertEqual(len(shape.Faces), len(reference.Faces))
+        self.assertEqual(len(shape.Shells), len(reference.Shells))
@@ -23,6 +23,11 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <atomic>
+# include <functional>
+# include <future>
+# include <sstream>
+# include <thread>
 # include <BRep_Builder.hxx>
 # include <BRepBuilderAPI_Transform.hxx>
 # include <gp_Trsf.hxx>
@@ -40,7 +45,9 @@
 #include <App/DocumentObjectPy.h>
 #include <Base/Console.h>
 #include <Base/Exception.h>
+#include <Base/FileInfo.h>
 #include <Base/PyWrapParseTupleAndKeywords.h>
+#include <Base/Stream.h>
 #include <Base/Vector3D.h>
 #include <Base/VectorPy.h>
 #include <Mod/Import/App/dxf/ImpExpDxf.h>
@@ -119,6 +126,135 @@ void copy(Py::Dict sourceRange, OutputIt targetIt)
   }
 }
 
+//! The cached edges of a view to export, picked in the main thread so workers can format them
+struct ExportEdges
+{
+    std::vector<TopoDS_Shape> visible;
+    std::vector<TopoDS_Shape> hidden;
+    std::vector<TopoDS_Shape> cosmetic;
+    double thick {0.0};
+    double thin {0.0};
+    //! the position of the view on the page
+    double x {0.0};
+    double y {0.0};
+};
+
+ExportEdges getExportEdges(DrawViewPart* dvp, bool alignPage, bool withCosmetic)
+{
+    ExportEdges edges;
+    edges.thick = DrawUtil::getDefaultLineWeight("Thick");
+    edges.thin = DrawUtil::getDefaultLineWeight("Thin");
+    if (!dvp->hasGeometry()) {
+        return edges;
+    }
+
+    GeometryObjectPtr gObj = dvp->getGeometryObject();
+    edges.visible.push_back(gObj->getVisHard());
+    edges.visible.push_back(gObj->getVisOutline());
+    if (dvp->SmoothVisible.getValue()) {
+        edges.visible.push_back(gObj->getVisSmooth());
+    }
+    if (dvp->SeamVisible.getValue()) {
+        edges.visible.push_back(gObj->getVisSeam());
+    }
+    if (dvp->HardHidden.getValue()) {
+        edges.hidden.push_back(gObj->getHidHard());
+        edges.hidden.push_back(gObj->getHidOutline());
+    }
+    if (dvp->SmoothHidden.getValue()) {
+        edges.hidden.push_back(gObj->getHidSmooth());
+    }
+    if (dvp->SeamHidden.getValue()) {
+        edges.hidden.push_back(gObj->getHidSeam());
+    }
+
+    if (withCosmetic) {
+        std::vector<TopoDS_Edge> cosmeticEdges;
+        for (auto& geom : dvp->getEdgeGeometry()) {
+            if (geom->getHlrVisible() && geom->getCosmetic()) {
+                cosmeticEdges.push_back(geom->getOCCEdge());
+            }
+        }
+        if (!cosmeticEdges.empty()) {
+            edges.cosmetic.push_back(DrawUtil::vectorToCompound(cosmeticEdges));
+        }
+    }
+
+    if (alignPage) {
+        edges.x = dvp->X.getValue();
+        edges.y = dvp->Y.getValue();
+        if (dvp->isDerivedFrom<DrawProjGroupItem>()) {
+            DrawProjGroup* dpg = static_cast<DrawProjGroupItem*>(dvp)->getPGroup();
+            if (dpg) {
+                edges.x += dpg->X.getValue();
+                edges.y += dpg->Y.getValue();
+            }
+        }
+    }
+    return edges;
+}
+
+//! Writes the visible and the hidden edges as svg groups
+void writeSvgEdges(const ExportEdges& edges, std::ostream& out)
+{
+    const char* grpHead1 = "<g fill=\"none\" stroke=\"#000000\" stroke-opacity=\"1\" stroke-width=\"";
+    const char* grpHead2 = "\" stroke-linecap=\"butt\" stroke-linejoin=\"miter\" stroke-miterlimit=\"4\">\n";
+    const char* grpTail = "</g>\n";
+    SVGOutput svgOut;
+    out << grpHead1 << edges.thick << grpHead2;
+    for (auto& shape : edges.visible) {
+        svgOut.exportEdges(shape, out);
+    }
+    for (auto& shape : edges.cosmetic) {
+        svgOut.exportEdges(shape, out);
+    }
+    out << grpTail;
+
+    if (!edges.hidden.empty()) {
+        out << grpHead1 << edges.thin << grpHead2;
+        for (auto& shape : edges.hidden) {
+            svgOut.exportEdges(shape, out);
+        }
+        out << grpTail;
+    }
+}
+
+//! Returns the edges mirrored to y up and moved to the position of the view
+std::vector<TopoDS_Shape> getDxfShapes(const ExportEdges& edges)
+{
+    gp_Trsf xLate;
+    xLate.SetTranslation(gp_Vec(edges.x, edges.y, 0.0));
+    std::vector<TopoDS_Shape> result;
+    for (auto group : {&edges.visible, &edges.hidden, &edges.cosmetic}) {
+        for (auto& shape : *group) {
+            BRepBuilderAPI_Transform mkTrf(ShapeUtils::mirrorShape(shape), xLate);
+            result.push_back(mkTrf.Shape());
+        }
+    }
+    return result;
+}
+
+//! Runs \a work for every index below \a count, spread over the cores
+void forEachParallel(std::size_t count, const std::function<void(std::size_t)>& work)
+{
+    std::atomic<std::size_t> next {0};
+    auto worker = [&]() {
+        for (std::size_t index = next++; index < count; index = next++) {
+            work(index);
+        }
+    };
+    std::size_t numThreads =
+        std::min<std::size_t>(count, std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 
 class Module : public Py::ExtensionModule<Module>
 {
@@ -146,6 +282,9 @@ public:
         add_varargs_method("writeDXFPage", &Module::writeDXFPage,
             "writeDXFPage(page, filename): Exports a DrawPage to a DXF file."
         );
+        add_varargs_method("writeSVGPage", &Module::writeSVGPage,
+            "writeSVGPage(page, filename): Exports the edges of the DrawViewParts of a DrawPage to a SVG file."
+        );
         add_varargs_method("findCentroid", &Module::findCentroid,
             "vector = findCentroid(shape, direction): finds geometric centroid of shape looking in direction."
         );
@@ -479,66 +618,12 @@ private:
             throw Py::TypeError("expected (DrawViewPart)");
         }
         Py::String svgReturn;
-        std::string grpHead1 = "<g fill=\"none\" stroke=\"#000000\" stroke-opacity=\"1\" stroke-width=\"";
-        std::string grpHead2 = "\" stroke-linecap=\"butt\" stroke-linejoin=\"miter\" stroke-miterlimit=\"4\">\n";
-        std::string grpTail  = "</g>\n";
         try {
-            App::DocumentObject* obj = nullptr;
-            TechDraw::DrawViewPart* dvp = nullptr;
-            TechDraw::SVGOutput svgOut;
-            std::string svgText;
-            std::stringstream ss;
             if (PyObject_TypeCheck(viewObj, &(TechDraw::DrawViewPartPy::Type))) {
-                obj = static_cast<App::DocumentObjectPy*>(viewObj)->getDocumentObjectPtr();
-                dvp = static_cast<TechDraw::DrawViewPart*>(obj);
-                TechDraw::GeometryObjectPtr gObj = dvp->getGeometryObject();
-                //visible group begin "<g ... >"
-                ss << grpHead1;
-//                double thick = dvp->LineWidth.getValue();
-                double thick = DrawUtil::getDefaultLineWeight("Thick");
-                ss << thick;
-                ss << grpHead2;
-                TopoDS_Shape shape = gObj->getVisHard();
-                ss << svgOut.exportEdges(shape);
-                shape = gObj->getVisOutline();
-                ss << svgOut.exportEdges(shape);
-                if (dvp->SmoothVisible.getValue()) {
-                    shape = gObj->getVisSmooth();
-                    ss << svgOut.exportEdges(shape);
-                }
-                if (dvp->SeamVisible.getValue()) {
-                    shape = gObj->getVisSeam();
-                    ss << svgOut.exportEdges(shape);
-                }
-                //visible group end "</g>"
-                ss << grpTail;
-
-                if ( dvp->HardHidden.getValue()  ||
-                     dvp->SmoothHidden.getValue() ||
-                     dvp->SeamHidden.getValue() ) {
-                    //hidden group begin
-                    ss << grpHead1;
-//                    thick = dvp->HiddenWidth.getValue();
-                    thick = DrawUtil::getDefaultLineWeight("Thin");
-                    ss << thick;
-                    ss << grpHead2;
-                    if (dvp->HardHidden.getValue()) {
-                        shape = gObj->getHidHard();
-                        ss << svgOut.exportEdges(shape);
-                        shape = gObj->getHidOutline();
-                        ss << svgOut.exportEdges(shape);
-                    }
-                    if (dvp->SmoothHidden.getValue()) {
-                        shape = gObj->getHidSmooth();
-                        ss << svgOut.exportEdges(shape);
-                    }
-                    if (dvp->SeamHidden.getValue()) {
-                        shape = gObj->getHidSeam();
-                        ss << svgOut.exportEdges(shape);
-                    }
-                    ss << grpTail;
-                    //hidden group end
-                }
+                App::DocumentObject* obj = static_cast<App::DocumentObjectPy*>(viewObj)->getDocumentObjectPtr();
+                TechDraw::DrawViewPart* dvp = static_cast<TechDraw::DrawViewPart*>(obj);
+                std::stringstream ss;
+                writeSvgEdges(getExportEdges(dvp, false, false), ss);
                 // ss now contains all edges as Svg
                 svgReturn = Py::String(ss.str());
            }
@@ -553,81 +638,7 @@ private:
 
     void write1ViewDxf( ImpExpDxfWrite& writer, TechDraw::DrawViewPart* dvp, bool alignPage)
     {
-        if(!dvp->hasGeometry())
-            return;
-        TechDraw::GeometryObjectPtr gObj = dvp->getGeometryObject();
-        TopoDS_Shape shape = ShapeUtils::mirrorShape(gObj->getVisHard());
-        double offX = 0.0;
-        double offY = 0.0;
-        if (dvp->isDerivedFrom<TechDraw::DrawProjGroupItem>()) {
-            TechDraw::DrawProjGroupItem* dpgi = static_cast<TechDraw::DrawProjGroupItem*>(dvp);
-            TechDraw::DrawProjGroup*      dpg = dpgi->getPGroup();
-            if (dpg) {
-                offX = dpg->X.getValue();
-                offY = dpg->Y.getValue();
-            }
-        }
-        double dvpX(0.0);
-        double dvpY(0.0);
-        if (alignPage) {
-            dvpX = dvp->X.getValue() + offX;
-            dvpY = dvp->Y.getValue() + offY;
-        }
-        gp_Trsf xLate;
-        xLate.SetTranslation(gp_Vec(dvpX, dvpY, 0.0));
-        BRepBuilderAPI_Transform mkTrf(shape, xLate);
-        shape = mkTrf.Shape();
-        writer.exportShape(shape);
-        shape = ShapeUtils::mirrorShape(gObj->getVisOutline());
-        mkTrf.Perform(shape);
-        shape = mkTrf.Shape();
-        writer.exportShape(shape);
-        if (dvp->SmoothVisible.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getVisSmooth());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        if (dvp->SeamVisible.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getVisSeam());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        if (dvp->HardHidden.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getHidHard());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-            shape = ShapeUtils::mirrorShape(gObj->getHidOutline());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        if (dvp->SmoothHidden.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getHidSmooth());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        if (dvp->SeamHidden.getValue()) {
-            shape = ShapeUtils::mirrorShape(gObj->getHidSeam());
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
-            writer.exportShape(shape);
-        }
-        //add the cosmetic edges also
-        std::vector<TechDraw::BaseGeomPtr> geoms = dvp->getEdgeGeometry();
-        std::vector<TopoDS_Edge> cosmeticEdges;
-        for (auto& g : geoms) {
-            if (g->getHlrVisible() && g->getCosmetic()) {
-                cosmeticEdges.push_back(g->getOCCEdge());
-            }
-        }
-        if (!cosmeticEdges.empty()) {
-            shape = ShapeUtils::mirrorShape(DrawUtil::vectorToCompound(cosmeticEdges));
-            mkTrf.Perform(shape);
-            shape = mkTrf.Shape();
+        for (auto& shape : getDxfShapes(getExportEdges(dvp, alignPage, true))) {
             writer.exportShape(shape);
         }
     }
@@ -692,12 +703,26 @@ private:
                 obj = static_cast<App::DocumentObjectPy*>(pageObj)->getDocumentObjectPtr();
                 dPage = static_cast<TechDraw::DrawPage*>(obj);
                 auto views = dPage->getAllViews();
+                // the edges of the views are moved into place in parallel, the writer is serial
+                std::vector<ExportEdges> partEdges;
+                for (auto& view : views) {
+                    if (view->isDerivedFrom<TechDraw::DrawViewPart>()) {
+                        partEdges.push_back(getExportEdges(static_cast<TechDraw::DrawViewPart*>(view), true, true));
+                    }
+                }
+                std::vector<std::vector<TopoDS_Shape>> partShapes(partEdges.size());
+                forEachParallel(partEdges.size(), [&](std::size_t index) {
+                    partShapes[index] = getDxfShapes(partEdges[index]);
+                });
+                std::size_t iPart = 0;
                 for (auto& view : views) {
                     if (view->isDerivedFrom<TechDraw::DrawViewPart>()) {
                         TechDraw::DrawViewPart* dvp = static_cast<TechDraw::DrawViewPart*>(view);
                         layerName = dvp->getNameInDocument();
                         writer.setLayerName(layerName);
-                        write1ViewDxf(writer, dvp, true);
+                        for (auto& shape : partShapes[iPart++]) {
+                            writer.exportShape(shape);
+                        }
 
                     } else if (view->isDerivedFrom<TechDraw::DrawViewAnnotation>()) {
                         TechDraw::DrawViewAnnotation* dva = static_cast<TechDraw::DrawViewAnnotation*>(view);
@@ -811,6 +836,70 @@ private:
         catch (const Base::Exception& e) {
             throw Py::RuntimeError(e.what());
         }
+        catch (Standard_Failure& e) {
+            throw Py::Exception(Part::PartExceptionOCCError, e.GetMessageString());
+        }
+
+        return Py::None();
+    }
+
+    Py::Object writeSVGPage(const Py::Tuple& args)
+    {
+        PyObject *pageObj(nullptr);
+        char* name(nullptr);
+        if (!PyArg_ParseTuple(args.ptr(), "Oet", &pageObj, "utf-8", &name)) {
+            throw Py::TypeError("expected (page, path");
+        }
+
+        std::string filePath = std::string(name);
+        PyMem_Free(name);
+        if (!PyObject_TypeCheck(pageObj, &(TechDraw::DrawPagePy::Type))) {
+            throw Py::TypeError("expected (page, path");
+        }
+
+        try {
+            App::DocumentObject* obj = static_cast<App::DocumentObjectPy*>(pageObj)->getDocumentObjectPtr();
+            TechDraw::DrawPage* dPage = static_cast<TechDraw::DrawPage*>(obj);
+            double width = dPage->getPageWidth();
+            double height = dPage->getPageHeight();
+            std::vector<ExportEdges> partEdges;
+            for (auto& view : dPage->getAllViews()) {
+                if (view->isDerivedFrom<TechDraw::DrawViewPart>()) {
+                    partEdges.push_back(getExportEdges(static_cast<TechDraw::DrawViewPart*>(view), true, true));
+                }
+            }
+
+            // every view is formatted into its own buffer, the file gets them in page order
+            std::vector<std::string> buffers(partEdges.size());
+            forEachParallel(partEdges.size(), [&](std::size_t index) {
+                const ExportEdges& edges = partEdges[index];
+                std::stringstream ss;
+                // the page origin is the lower left corner, the view edges are y down already
+                ss << "<g transform=\"translate(" << edges.x << "," << height - edges.y << ")\">\n";
+                writeSvgEdges(edges, ss);
+                ss << "</g>\n";
+                buffers[index] = ss.str();
+            });
+
+            Base::FileInfo fi(filePath);
+            Base::ofstream out(fi, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!out) {
+                throw Py::RuntimeError(std::string("Cannot open file: ") + filePath);
+            }
+            out << "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" width=\"" << width
+                << "mm\" height=\"" << height << "mm\" viewBox=\"0 0 " << width << " " << height << "\">\n";
+            for (auto& buffer : buffers) {
+                out << buffer;
+                std::string().swap(buffer);
+            }
+            out << "</svg>\n";
+        }
+        catch (const Base::Exception& e) {
+            throw Py::RuntimeError(e.what());
+        }
+        catch (Standard_Failure& e) {
+            throw Py::Exception(Part::PartExceptionOCCError, e.GetMessageString());
+        }
 
         return Py::None();
     }
@@ -59,6 +59,17 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <algorithm>
+# include <array>
+# include <cmath>
+# include <list>
+# include <memory>
+# include <mutex>
+# include <unordered_map>
+# include <BRep_Tool.hxx>
+# include <BRepAdaptor_Curve.hxx>
+# include <gp_Circ.hxx>
+# include <TopoDS.hxx>
 #endif
 
 #include <TopoDS_Shape.hxx>
@@ -75,12 +86,199 @@
 #include "DimensionGeometry.h"
 #include "DimensionAutoCorrect.h"
 #include "DrawUtil.h"
+#include "DrawViewPart.h"
+#include "Geometry.h"
+#include "GeometryObject.h"
 #include "Preferences.h"
+#include "ShapeUtils.h"
 
 using namespace TechDraw;
 using namespace Measure;
 using DU = DrawUtil;
 
+namespace
+{
+
+using CellKey = std::array<long long, 3>;
+
+struct CellHash
+{
+    std::size_t operator()(const CellKey& key) const
+    {
+        std::size_t seed = 0;
+        for (long long value : key) {
+            seed ^= std::hash<long long> {}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+};
+
+using CellMap = std::unordered_map<CellKey, std::vector<int>, CellHash>;
+
+//! matching points are at most EWTOLERANCE apart, so they lie in neighbouring cells
+constexpr double cellSize = 2.0 * EWTOLERANCE;
+
+CellKey cellOf(const Base::Vector3d& pos)
+{
+    return {static_cast<long long>(std::floor(pos.x / cellSize)),
+            static_cast<long long>(std::floor(pos.y / cellSize)),
+            static_cast<long long>(std::floor(pos.z / cellSize))};
+}
+
+//! the indexes stored in the cells around pos, in ascending order
+std::vector<int> findNear(const CellMap& cells, const Base::Vector3d& pos)
+{
+    std::vector<int> result;
+    CellKey center = cellOf(pos);
+    for (long long dx = -1; dx <= 1; dx++) {
+        for (long long dy = -1; dy <= 1; dy++) {
+            for (long long dz = -1; dz <= 1; dz++) {
+                auto it = cells.find({center[0] + dx, center[1] + dy, center[2] + dz});
+                if (it != cells.end()) {
+                    result.insert(result.end(), it->second.begin(), it->second.end());
+                }
+            }
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+//! GeometryMatcher only matches lines with lines by their ends and circles with circles
+//! by their centers. Returns the cells for those, or nullptr for the other edges.
+CellMap* edgeCells(const TopoDS_Shape& shape, CellMap& lines, CellMap& circles, Base::Vector3d& pos)
+{
+    if (shape.IsNull() || shape.ShapeType() != TopAbs_EDGE) {
+        return nullptr;
+    }
+    try {
+        TopoDS_Edge edge = TopoDS::Edge(shape);
+        BRepAdaptor_Curve adapt(edge);
+        if (adapt.GetType() == GeomAbs_Line) {
+            pos = ShapeUtils::getEdgeEnds(edge).first;
+            return &lines;
+        }
+        if (adapt.GetType() == GeomAbs_Circle) {
+            pos = DU::toVector3d(adapt.Circle().Location());
+            return &circles;
+        }
+    }
+    catch (Standard_Failure&) {
+    }
+    return nullptr;
+}
+
+/** The canonical edges and vertices of one revision of the geometry of a view, indexed
+ * by position so a reference is only compared to the geometry near it instead of to
+ * every edge of the view.
+ */
+class ViewGeometryIndex
+{
+public:
+    ViewGeometryIndex(const DrawViewPart& view, std::size_t revision)
+        : m_revision(revision)
+        , m_scale(view.getScale())
+        , m_rotation(view.Rotation.getValue())
+    {
+        for (auto& edge : view.getEdgeGeometry()) {
+            edges.push_back(ReferenceEntry::asCanonicalTopoShape(edge->asTopoShape(), view));
+            Base::Vector3d pos;
+            CellMap* cells = edgeCells(edges.back().getShape(), m_lines, m_circles, pos);
+            if (cells) {
+                (*cells)[cellOf(pos)].push_back(int(edges.size()) - 1);
+            }
+            else {
+                m_others.push_back(int(edges.size()) - 1);
+            }
+        }
+        for (auto& vert : view.getVertexGeometry()) {
+            vertexes.push_back(ReferenceEntry::asCanonicalTopoShape(vert->asTopoShape(), view));
+            const TopoDS_Shape& shape = vertexes.back().getShape();
+            if (!shape.IsNull() && shape.ShapeType() == TopAbs_VERTEX) {
+                Base::Vector3d pos = DU::toVector3d(BRep_Tool::Pnt(TopoDS::Vertex(shape)));
+                m_points[cellOf(pos)].push_back(int(vertexes.size()) - 1);
+            }
+        }
+    }
+
+    bool isValidFor(const DrawViewPart& view, std::size_t revision) const
+    {
+        return revision == m_revision && view.getScale() == m_scale
+            && view.Rotation.getValue() == m_rotation;
+    }
+
+    //! the indexes of the edges that can match refEdge, in ascending order
+    std::vector<int> edgeCandidates(const Part::TopoShape& refEdge) const
+    {
+        CellMap lines;
+        CellMap circles;
+        Base::Vector3d pos;
+        CellMap* cells = edgeCells(refEdge.getShape(), lines, circles, pos);
+        if (cells == &lines) {
+            return findNear(m_lines, pos);
+        }
+        if (cells == &circles) {
+            return findNear(m_circles, pos);
+        }
+        return m_others;
+    }
+
+    //! the indexes of the vertexes that can match refVertex, in ascending order
+    std::vector<int> vertexCandidates(const Part::TopoShape& refVertex) const
+    {
+        const TopoDS_Shape& shape = refVertex.getShape();
+        if (shape.IsNull() || shape.ShapeType() != TopAbs_VERTEX) {
+            return {};
+        }
+        return findNear(m_points, DU::toVector3d(BRep_Tool::Pnt(TopoDS::Vertex(shape))));
+    }
+
+    std::vector<Part::TopoShape> edges;
+    std::vector<Part::TopoShape> vertexes;
+
+private:
+    std::size_t m_revision;
+    double m_scale;
+    double m_rotation;
+    CellMap m_lines;
+    CellMap m_circles;
+    CellMap m_points;
+    std::vector<int> m_others;
+};
+
+//! the indexes of the views whose dimensions were corrected last, shared by all dimensions
+std::list<std::shared_ptr<const ViewGeometryIndex>> viewIndexes;
+std::mutex viewIndexMutex;
+constexpr std::size_t viewIndexCount = 8;
+
+std::shared_ptr<const ViewGeometryIndex> getViewIndex(const DrawViewPart& view)
+{
+    auto geometry = view.getGeometryObject();
+    std::size_t revision = geometry ? geometry->getRevision() : 0;
+    {
+        std::lock_guard<std::mutex> lock(viewIndexMutex);
+        for (auto it = viewIndexes.begin(); it != viewIndexes.end(); ++it) {
+            if ((*it)->isValidFor(view, revision)) {
+                viewIndexes.splice(viewIndexes.begin(), viewIndexes, it);
+                return viewIndexes.front();
+            }
+        }
+    }
+
+    auto index = std::make_shared<const ViewGeometryIndex>(view, revision);
+    if (!geometry) {
+        return index;
+    }
+    std::lock_guard<std::mutex> lock(viewIndexMutex);
+    viewIndexes.push_front(index);
+    if (viewIndexes.size() > viewIndexCount) {
+        viewIndexes.pop_back();
+    }
+    return index;
+}
+
+}  // namespace
+
 //! true if references point to valid geometry and the valid geometry matches the
 //! corresponding saved geometry.  this method does not correct anything, it just
 //! verifies if the references point to the same geometry as when the reference
@@ -473,19 +671,15 @@ ReferenceEntry DimensionAutoCorrect::searchViewForVert(DrawViewPart* obj,
 {
     // Base::Console().Message("DAC::searchViewForVert()\n");
     (void)exact;
-    std::vector<TechDraw::VertexPtr> gVertexAll =
-        getDimension()->getViewPart()->getVertexGeometry();
+    // the index holds the vertexes in canonical form - unscaled and unrotated
+    auto index = getViewIndex(*obj);
     getMatcher()->setPointTolerance(EWTOLERANCE);
-    int iVertex = 0;
-    for (auto& vert : gVertexAll) {
-        // vert is in display form - scaled and rotated
-        Part::TopoShape temp = ReferenceEntry::asCanonicalTopoShape(vert->asTopoShape(), *obj);
-        bool isSame = getMatcher()->compareGeometry(temp, refVertex);
+    for (int iVertex : index->vertexCandidates(refVertex)) {
+        bool isSame = getMatcher()->compareGeometry(index->vertexes.at(iVertex), refVertex);
         if (isSame) {
             auto newSubname = std::string("Vertex") + std::to_string(iVertex);
             return {obj, newSubname, getDimension()->getDocument()};
         }
-        iVertex++;
     }
     return {};
 }
@@ -495,18 +689,15 @@ ReferenceEntry DimensionAutoCorrect::searchViewForExactEdge(DrawViewPart* obj,
                                                             const Part::TopoShape& refEdge) const
 {
     // Base::Console().Message("DAC::searchViewForExactEdge()\n");
-    auto gEdgeAll = getDimension()->getViewPart()->getEdgeGeometry();
-    int iEdge {0};
-    for (auto& edge : gEdgeAll) {
-        // edge is scaled and rotated. we need it in the same scale/rotate state as
-        // the reference edge in order to match.
-        Part::TopoShape temp = ReferenceEntry::asCanonicalTopoShape(edge->asTopoShape(), *obj);
-        bool isSame = getMatcher()->compareGeometry(refEdge, temp);
+    // the view edges are scaled and rotated. the index holds them in the same
+    // unscaled/unrotated state as the reference edge in order to match.
+    auto index = getViewIndex(*obj);
+    for (int iEdge : index->edgeCandidates(refEdge)) {
+        bool isSame = getMatcher()->compareGeometry(refEdge, index->edges.at(iEdge));
         if (isSame) {
             auto newSubname = std::string("Edge") + std::to_string(iEdge);
             return {obj, newSubname, getDimension()->getDocument()};
         }
-        iEdge++;
     }
     return {};
 }
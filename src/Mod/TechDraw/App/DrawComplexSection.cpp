@@ -83,7 +83,6 @@
 #include <HLRAlgo_Projector.hxx>
 #include <QFuture>
 #include <QFutureWatcher>
-#include <QtConcurrentRun>
 #include <ShapeExtend_WireData.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -121,6 +120,7 @@
 #include "DrawUtil.h"
 #include "GeometryObject.h"
 #include "ShapeUtils.h"
+#include "ViewScheduler.h"
 
 using namespace TechDraw;
 using namespace std;
@@ -231,6 +231,27 @@ TopoDS_Shape DrawComplexSection::makeCuttingTool(double dMax)
     return BRepPrimAPI_MakePrism(m_toolFaceShape, extrudeDir).Shape();
 }
 
+//! the aligned pieces also depend on the profile and on the orientation of the section
+std::size_t DrawComplexSection::sectionCutKey(const TopoDS_Shape& baseShape,
+                                              const TopoDS_Shape& cuttingTool) const
+{
+    std::size_t seed = DrawViewSection::sectionCutKey(baseShape, cuttingTool);
+    auto combine = [&seed](std::size_t value) {
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    combine(std::size_t(ProjectionStrategy.getValue()));
+    if (ProjectionStrategy.getValue() != 0) {
+        combine(GeometryObject::shapeFingerprint(makeProfileWire()));
+        gp_Ax2 sectionCS = getSectionCS();
+        for (const gp_Dir& dir : {sectionCS.Direction(), sectionCS.XDirection()}) {
+            combine(std::hash<double> {}(dir.X()));
+            combine(std::hash<double> {}(dir.Y()));
+            combine(std::hash<double> {}(dir.Z()));
+        }
+    }
+    return seed == 0 ? 1 : seed;
+}
+
 TopoDS_Shape DrawComplexSection::getShapeToPrepare() const
 {
     //    Base::Console().Message("DCS::getShapeToPrepare()\n");
@@ -291,7 +312,7 @@ void DrawComplexSection::makeSectionCut(const TopoDS_Shape& baseShape)
         // This is important because this variable might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [this, baseShape]{this->makeAlignedPieces(baseShape);};
-        m_alignFuture = QtConcurrent::run(std::move(lambda));
+        m_alignFuture = ViewScheduler::instance().run(this, std::move(lambda));
         m_alignWatcher.setFuture(m_alignFuture);
         waitingForAlign(true);
     }
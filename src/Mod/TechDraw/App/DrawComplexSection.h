@@ -52,6 +52,8 @@ public:
     TopoDS_Compound findSectionPlaneIntersections(const TopoDS_Shape& cutShape) override;
     TopoDS_Shape prepareShape(const TopoDS_Shape& cutShape, double shapeSize) override;
     TopoDS_Shape getShapeToPrepare() const override;
+    std::size_t sectionCutKey(const TopoDS_Shape& baseShape,
+                              const TopoDS_Shape& cuttingTool) const override;
     TopoDS_Shape getShapeToIntersect() override;
     gp_Pln getSectionPlane() const override;
     TopoDS_Compound alignSectionFaces(TopoDS_Shape faceIntersections) override;
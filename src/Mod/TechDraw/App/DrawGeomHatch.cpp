@@ -23,20 +23,30 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
+# include <atomic>
+# include <future>
 # include <iomanip>
+# include <list>
+# include <mutex>
 # include <sstream>
+# include <thread>
+# include <unordered_map>
 
 #include <Bnd_Box.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
 #include <Mod/Part/App/FCBRepAlgoAPI_Common.h>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepBuilderAPI_Transform.hxx>
+#include <gp_Lin.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
 #include <Precision.hxx>
+#include <Standard_Failure.hxx>
 #include <TopExp.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
@@ -66,6 +76,92 @@
 using namespace TechDraw;
 using DU = DrawUtil;
 
+namespace
+{
+
+// copied from boost::hash_combine
+template<class T>
+void hashCombine(std::size_t& seed, const T& v)
+{
+    seed ^= std::hash<T> {}(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+void hashVector(std::size_t& seed, const Base::Vector3d& vec)
+{
+    hashCombine(seed, vec.x);
+    hashCombine(seed, vec.y);
+    hashCombine(seed, vec.z);
+}
+
+//! the trimmed hatch lines of all faces, the most recently used at the front. The faces of a
+//! view are trimmed in parallel, so the cache is guarded by a mutex.
+std::list<std::pair<std::size_t, std::vector<LineSet>>> trimmedLines;
+std::unordered_map<std::size_t, std::list<std::pair<std::size_t, std::vector<LineSet>>>::iterator>
+    trimmedIndex;
+std::mutex trimmedMutex;
+
+//! a key for the hatch of face with lineSets, the same for copies of the face
+std::size_t trimCacheKey(const TopoDS_Face& face,
+                         std::vector<LineSet>& lineSets,
+                         double scale,
+                         double hatchRotation,
+                         const Base::Vector3d& hatchOffset)
+{
+    std::size_t seed = GeometryObject::shapeFingerprint(face);
+    for (auto& ls : lineSets) {
+        PATLineSpec spec = ls.getPATLineSpec();
+        hashCombine(seed, spec.getAngle());
+        hashVector(seed, spec.getOrigin());
+        hashCombine(seed, spec.getInterval());
+        hashCombine(seed, spec.getOffset());
+        for (double dash : spec.getDashParms().get()) {
+            hashCombine(seed, dash);
+        }
+    }
+    hashCombine(seed, scale);
+    hashCombine(seed, hatchRotation);
+    hashVector(seed, hatchOffset);
+    return seed;
+}
+
+bool restoreTrimmedLines(std::size_t key, std::vector<LineSet>& result)
+{
+    std::lock_guard<std::mutex> lock(trimmedMutex);
+    auto it = trimmedIndex.find(key);
+    if (it == trimmedIndex.end()) {
+        return false;
+    }
+    trimmedLines.splice(trimmedLines.begin(), trimmedLines, it->second);
+    result = it->second->second;
+    return true;
+}
+
+void storeTrimmedLines(std::size_t key, const std::vector<LineSet>& lineSets)
+{
+    int capacity = Preferences::hatchCacheSize();
+    std::lock_guard<std::mutex> lock(trimmedMutex);
+    if (capacity <= 0) {
+        trimmedIndex.clear();
+        trimmedLines.clear();
+        return;
+    }
+
+    auto it = trimmedIndex.find(key);
+    if (it != trimmedIndex.end()) {
+        it->second->second = lineSets;
+        trimmedLines.splice(trimmedLines.begin(), trimmedLines, it->second);
+        return;
+    }
+    trimmedLines.emplace_front(key, lineSets);
+    trimmedIndex[key] = trimmedLines.begin();
+    while (trimmedLines.size() > static_cast<std::size_t>(capacity)) {
+        trimmedIndex.erase(trimmedLines.back().first);
+        trimmedLines.pop_back();
+    }
+}
+
+}// namespace
+
 App::PropertyFloatConstraint::Constraints DrawGeomHatch::scaleRange = {
     Precision::Confusion(), std::numeric_limits<double>::max(), (0.1)}; // increment by 0.1
 
@@ -297,6 +393,52 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source, std::v
     );
 }
 
+//! get the trimmed hatch lines for several faces at once, the faces are trimmed in parallel
+std::vector<std::vector<LineSet>> DrawGeomHatch::getTrimmedLines(const std::vector<int>& faces)
+{
+    std::vector<std::vector<LineSet>> result(faces.size());
+    if (m_lineSets.empty()) {
+        makeLineSets();
+    }
+
+    DrawViewPart* source = getSourceView();
+    if (!source ||
+        !source->hasGeometry()) {
+        return result;
+    }
+
+    double scale = ScalePattern.getValue();
+    double rotation = PatternRotation.getValue();
+    Base::Vector3d offset = PatternOffset.getValue();
+    std::atomic<std::size_t> nextFace(0);
+    auto trimFaces = [&]() {
+        for (std::size_t i = nextFace++; i < faces.size(); i = nextFace++) {
+            try {
+                result[i] = getTrimmedLines(source, m_lineSets, faces[i], scale, rotation, offset);
+            }
+            catch (const Standard_Failure& e) {
+                Base::Console().Error("DGH::getTrimmedLines - face %d: %s\n", faces[i],
+                                      e.GetMessageString());
+            }
+            catch (const Base::Exception& e) {
+                Base::Console().Error("DGH::getTrimmedLines - face %d: %s\n", faces[i], e.what());
+            }
+        }
+    };
+
+    std::size_t numThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, faces.size());
+    std::vector<std::future<void>> workers;
+    for (std::size_t i = 1; i < numThreads; i++) {
+        workers.push_back(std::async(std::launch::async, trimFaces));
+    }
+    trimFaces();
+    for (auto& worker : workers) {
+        worker.get();
+    }
+    return result;
+}
+
 std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
                                                     std::vector<LineSet> lineSets,
                                                     TopoDS_Face f,
@@ -314,13 +456,21 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
 
     TopoDS_Face face = f;
 
+    std::size_t key = trimCacheKey(face, lineSets, scale, hatchRotation, hatchOffset);
+    if (restoreTrimmedLines(key, result)) {
+        return result;
+    }
+
     Bnd_Box bBox;
     BRepBndLib::AddOptimal(face, bBox);
     bBox.SetGap(0.0);
 
     for (auto& ls: lineSets) {
         PATLineSpec hl = ls.getPATLineSpec();
-        std::vector<TopoDS_Edge> candidates = DrawGeomHatch::makeEdgeOverlay(hl, bBox, scale);   //completely cover face bbox with lines
+        //the lines crossing the face bbox, already rotated and moved
+        std::vector<TopoDS_Edge> candidates = DrawGeomHatch::makeEdgeOverlay(hl, bBox, scale,
+                                                                             hatchRotation,
+                                                                             hatchOffset);
 
         //make Compound for this linespec
         BRep_Builder builder;
@@ -329,20 +479,7 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
         for (auto& c: candidates) {
            builder.Add(gridComp, c);
         }
-
         TopoDS_Shape grid = gridComp;
-        if (hatchRotation != 0.0) {
-            double hatchRotationRad = hatchRotation * M_PI / 180.0;
-            gp_Ax1 gridAxis(gp_Pnt(0.0, 0.0, 0.0), gp_Vec(gp::OZ().Direction()));
-            gp_Trsf xGridRotate;
-            xGridRotate.SetRotation(gridAxis, hatchRotationRad);
-            BRepBuilderAPI_Transform mkTransRotate(grid, xGridRotate, true);
-            grid = mkTransRotate.Shape();
-        }
-        gp_Trsf xGridTranslate;
-        xGridTranslate.SetTranslation(DrawUtil::togp_Vec(hatchOffset));
-        BRepBuilderAPI_Transform mkTransTranslate(grid, xGridTranslate, true);
-        grid = mkTransTranslate.Shape();
 
         //Common(Compound, Face)
         FCBRepAlgoAPI_Common mkCommon(face, grid);
@@ -382,6 +519,40 @@ std::vector<LineSet> DrawGeomHatch::getTrimmedLines(DrawViewPart* source,
         ls.setGeoms(resultGeoms);
         result.push_back(ls);
     }
+    storeTrimmedLines(key, result);
+    return result;
+}
+
+/* static */
+//! the overlay of makeEdgeOverlay rotated and moved, without the lines that miss bBox
+std::vector<TopoDS_Edge> DrawGeomHatch::makeEdgeOverlay(PATLineSpec hatchLine, Bnd_Box bBox,
+                                                        double scale, double hatchRotation,
+                                                        Base::Vector3d hatchOffset)
+{
+    gp_Trsf xGrid;
+    if (hatchRotation != 0.0) {
+        double hatchRotationRad = hatchRotation * M_PI / 180.0;
+        gp_Ax1 gridAxis(gp_Pnt(0.0, 0.0, 0.0), gp_Vec(gp::OZ().Direction()));
+        xGrid.SetRotation(gridAxis, hatchRotationRad);
+    }
+    gp_Trsf xGridTranslate;
+    xGridTranslate.SetTranslation(DrawUtil::togp_Vec(hatchOffset));
+    xGrid.PreMultiply(xGridTranslate);
+
+    //a line is dropped only if it can't touch the face, so the trimmed result is unchanged
+    Bnd_Box clipBox = bBox;
+    clipBox.Enlarge(Precision::Confusion());
+
+    std::vector<TopoDS_Edge> result;
+    for (auto& line : makeEdgeOverlay(hatchLine, bBox, scale)) {
+        gp_Pnt start = BRep_Tool::Pnt(TopExp::FirstVertex(line)).Transformed(xGrid);
+        gp_Pnt end = BRep_Tool::Pnt(TopExp::LastVertex(line)).Transformed(xGrid);
+        if (start.Distance(end) < Precision::Confusion()
+            || clipBox.IsOut(gp_Lin(start, gp_Dir(gp_Vec(start, end))))) {
+            continue;
+        }
+        result.push_back(BRepBuilderAPI_MakeEdge(start, end).Edge());
+    }
     return result;
 }
 
@@ -79,6 +79,7 @@ public:
 
     std::vector<LineSet> getFaceOverlay(int iFace = 0);
     std::vector<LineSet> getTrimmedLines(int iFace = 0);
+    std::vector<std::vector<LineSet>> getTrimmedLines(const std::vector<int>& faces);
     static std::vector<LineSet> getTrimmedLines(DrawViewPart* dvp, std::vector<LineSet> lineSets, int iface,
                                                 double scale, double hatchRotation = 0.0,
                                                 Base::Vector3d hatchOffset = Base::Vector3d(0.0, 0.0, 0.0));
@@ -95,6 +96,9 @@ public:
 
     static std::vector<TopoDS_Edge> makeEdgeOverlay(PATLineSpec hatchLine, Bnd_Box bBox,
                                     double scale);
+    static std::vector<TopoDS_Edge> makeEdgeOverlay(PATLineSpec hatchLine, Bnd_Box bBox,
+                                    double scale, double hatchRotation,
+                                    Base::Vector3d hatchOffset);
     static TopoDS_Edge makeLine(Base::Vector3d start, Base::Vector3d end);
     static std::vector<PATLineSpec> getDecodedSpecsFromFile(std::string fileSpec, std::string myPattern);
     static TopoDS_Face extractFace(DrawViewPart* source, int iface );
@@ -46,6 +46,7 @@
 #include "DrawProjGroupPy.h"// generated from DrawProjGroupPy.xml
 #include "DrawUtil.h"
 #include "Preferences.h"
+#include "ShapeExtractor.h"
 
 
 using namespace TechDraw;
@@ -84,6 +85,15 @@ DrawProjGroup::DrawProjGroup()
     ADD_PROPERTY_TYPE(
         spacingY, (15), agroup, App::Prop_None,
         "If AutoDistribute is on, this is the vertical \nspacing between the borders of views");
+
+    // any change outside of TechDraw may change the source shapes, the views themselves
+    // change all the time while they are laid out
+    connectChangedObject = App::GetApplication().signalChangedObject.connect(
+        [this](const App::DocumentObject& obj, const App::Property&) {
+            if (!obj.isDerivedFrom<DrawView>()) {
+                clearSharedSourceShapes();
+            }
+        });
     Rotation.setStatus(App::Property::Hidden, true);//DPG does not rotate
     Caption.setStatus(App::Property::Hidden, true);
 }
@@ -103,10 +113,35 @@ std::vector<App::DocumentObject*> DrawProjGroup::getAllSources() const
 }
 
 
+//! the shape of the sources for all items, so the sources are only collected (and fused) once
+//! for the group
+TopoDS_Shape DrawProjGroup::getSharedSourceShape(bool fuse)
+{
+    TopoDS_Shape& shape = fuse ? m_fusedSourceShape : m_sourceShape;
+    if (shape.IsNull()) {
+        const std::vector<App::DocumentObject*> links = getAllSources();
+        if (links.empty()) {
+            return TopoDS_Shape();
+        }
+        shape = fuse ? ShapeExtractor::getShapesFused(links) : ShapeExtractor::getShapes(links);
+    }
+    return shape;
+}
+
+void DrawProjGroup::clearSharedSourceShapes()
+{
+    m_sourceShape.Nullify();
+    m_fusedSourceShape.Nullify();
+}
+
 void DrawProjGroup::onChanged(const App::Property* prop)
 {
     //TODO: For some reason, when the projection type is changed, the isometric views show change appropriately, but the orthographic ones don't... Or vice-versa.  WF: why would you change from 1st to 3rd in mid drawing?
     //if group hasn't been added to page yet, can't scale or distribute projItems
+    if (prop == &Source || prop == &XSource) {
+        clearSharedSourceShapes();
+    }
+
     if (isRestoring() || !getPage()) {
         return TechDraw::DrawViewCollection::onChanged(prop);
     }
@@ -25,6 +25,8 @@
 
 #include <string>
 #include <QRectF>
+#include <TopoDS_Shape.hxx>
+#include <boost_signals2.hpp>
 
 #include <App/DocumentObject.h>
 #include <App/PropertyLinks.h>
@@ -140,6 +142,7 @@ public:
     void updateChildrenEnforce();
 
     std::vector<App::DocumentObject*> getAllSources() const;
+    TopoDS_Shape getSharedSourceShape(bool fuse);
     bool checkFit() const override;
     bool checkFit(DrawPage* p) const override;
 
@@ -195,6 +198,14 @@ protected:
                            std::array<Base::BoundBox3d, MAXPROJECTIONCOUNT> bboxes);
     double getMaxColWidth(std::array<int, 3> list,
                           std::array<Base::BoundBox3d, MAXPROJECTIONCOUNT> bboxes);
+
+private:
+    void clearSharedSourceShapes();
+
+    //! the source shapes of the items, made on the first request after a change
+    TopoDS_Shape m_sourceShape;
+    TopoDS_Shape m_fusedSourceShape;
+    boost::signals2::scoped_connection connectChangedObject;
 };
 
 } //namespace TechDraw
@@ -113,10 +113,6 @@ App::DocumentObjectExecReturn *DrawProjGroupItem::execute()
         return DrawView::execute();
     }
 
-    if (waitingForHlr()) {
-        return DrawView::execute();
-    }
-
     bool haveX = checkXDirection();
     if (!haveX) {
         //block touch/onChanged stuff
@@ -184,6 +180,16 @@ DrawProjGroup* DrawProjGroupItem::getPGroup() const
     return dynamic_cast<DrawProjGroup *>(getCollection());
 }
 
+//! items showing the sources of their group share its source shape
+TopoDS_Shape DrawProjGroupItem::getSourceShape(bool fuse) const
+{
+    DrawProjGroup* pGroup = getPGroup();
+    if (pGroup && getAllSources() == pGroup->getAllSources()) {
+        return pGroup->getSharedSourceShape(fuse);
+    }
+    return DrawViewPart::getSourceShape(fuse);
+}
+
 bool DrawProjGroupItem::isAnchor() const
 {
     return getPGroup() && (getPGroup()->getAnchor() == this);
@@ -66,6 +66,7 @@ public:
     void postHlrTasks(void) override;
 
     DrawProjGroup* getPGroup() const;
+    TopoDS_Shape getSourceShape(bool fuse = false) const override;
     double getRotateAngle();
     Base::Vector3d getXDirection() const override;
     Base::Vector3d getLegacyX(const Base::Vector3d& pt,
@@ -592,6 +592,13 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
     std::vector<TopoDS_Edge> overlapEdges;
     std::vector<bool> skipThisEdge(inEdges.size(), false);
     int edgeCount = inEdges.size();
+    //the same boxes as boxesIntersect, computed once per edge. Edges with disjoint boxes are
+    //not a subset of each other and need no boolean operation.
+    std::vector<Bnd_Box> boxes(inEdges.size());
+    for (int ie = 0; ie < edgeCount; ie++) {
+        BRepBndLib::Add(inEdges.at(ie), boxes.at(ie));
+        boxes.at(ie).SetGap(0.1);
+    }
     int ie0 = 0;
     for (; ie0 < edgeCount; ie0++) {
         if (skipThisEdge.at(ie0)) {
@@ -602,6 +609,9 @@ std::vector<TopoDS_Edge> DrawProjectSplit::removeOverlapEdges(const std::vector<
             if (skipThisEdge.at(ie1)) {
                 continue;
             }
+            if (boxes.at(ie0).IsOut(boxes.at(ie1))) {
+                continue;
+            }
             int rc = isSubset(inEdges.at(ie0), inEdges.at(ie1));
             if (rc == e0ISSUBSET) {
                 skipThisEdge.at(ie0) = true;
@@ -33,7 +33,6 @@
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 #include <Bnd_Box.hxx>
-#include <QtConcurrentRun>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
@@ -61,6 +60,7 @@
 #include "GeometryObject.h"
 #include "Preferences.h"
 #include "ShapeUtils.h"
+#include "ViewScheduler.h"
 
 
 using namespace TechDraw;
@@ -201,7 +201,7 @@ void DrawViewDetail::detailExec(TopoDS_Shape& shape, DrawViewPart* dvp, DrawView
     // function and might get destructed before the parallel processing finishes.
     // TODO: What about dvp and dvs? Do they live past makeDetailShape?
     auto lambda = [this, shape, dvp, dvs]{this->makeDetailShape(shape, dvp, dvs);};
-    m_detailFuture = QtConcurrent::run(std::move(lambda));
+    m_detailFuture = ViewScheduler::instance().run(this, std::move(lambda));
     m_detailWatcher.setFuture(m_detailFuture);
     waitingForDetail(true);
 }
@@ -291,6 +291,9 @@ void DrawViewDimension::resetArea()
 
 void DrawViewDimension::onChanged(const App::Property* prop)
 {
+    if (prop == &References2D || prop == &References3D || prop == &SavedGeometry) {
+        m_validRevision = 0;
+    }
     if (prop == &References3D) {
         // have to rebuild the Measurement object
         clear3DMeasurements();  // Measurement object
@@ -578,6 +581,14 @@ bool DrawViewDimension::autocorrectReferences()
     // TODO: check for saved geometry here.  If we don't have saved geometry, we can't
     // successfully auto correct in phase 1.  This check is currently in
     // referencesHaveValidGeometry.
+    // 2d references only change with the geometry of the view, so they need to be
+    // checked once per revision of it
+    bool only2d = References3D.getValues().empty();
+    std::size_t revision = getViewPart()->getGeometryObject()->getRevision();
+    if (only2d && revision == m_validRevision) {
+        return true;
+    }
+
     std::vector<bool> referenceState;
     bool refsAreValid = m_corrector->referencesHaveValidGeometry(referenceState);
     if (!refsAreValid) {
@@ -596,6 +607,9 @@ bool DrawViewDimension::autocorrectReferences()
             setReferences2d(repairedRefs);
         }
     }
+    if (only2d) {
+        m_validRevision = revision;
+    }
     return true;
 }
 
@@ -274,6 +274,8 @@ private:
     DimensionAutoCorrect* m_corrector;
 
     bool m_referencesCorrect {false};
+    //! the revision of the view geometry the 2d references were last found valid for
+    std::size_t m_validRevision {0};
 
     std::set<std::string> m_3dObjectCache;
 };
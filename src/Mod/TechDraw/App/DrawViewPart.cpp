@@ -48,7 +48,6 @@
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
 #include <HLRAlgo_Projector.hxx>
-#include <QtConcurrentRun>
 #include <ShapeAnalysis.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -58,11 +57,16 @@
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Wire.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <gp_Ax2.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <sstream>
+#include <thread>
 #endif
 
 #include <App/Document.h>
@@ -90,6 +94,7 @@
 #include "ShapeExtractor.h"
 #include "Preferences.h"
 #include "ShapeUtils.h"
+#include "ViewScheduler.h"
 
 using namespace TechDraw;
 using DU = DrawUtil;
@@ -230,10 +235,6 @@ App::DocumentObjectExecReturn* DrawViewPart::execute()
         return DrawView::execute();
     }
 
-    if (waitingForHlr()) {
-        return DrawView::execute();
-    }
-
     TopoDS_Shape shape = getSourceShape();
     if (shape.IsNull()) {
         Base::Console().Message("DVP::execute - %s - Source shape is Null.\n", getNameInDocument());
@@ -286,8 +287,10 @@ void DrawViewPart::partExec(TopoDS_Shape& shape)
 {
     //    Base::Console().Message("DVP::partExec() - %s\n", getNameInDocument());
     if (waitingForHlr()) {
-        //finish what we are already doing before starting a new cycle
-        return;
+        //the running projection is outdated, drop its result and start a new cycle
+        QObject::disconnect(connectHlrWatcher);
+        ViewScheduler::cancel(m_hlrFuture);
+        waitingForHlr(false);
     }
 
     //we need to keep using the old geometryObject until the new one is fully populated
@@ -358,6 +361,10 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         go->projectShapeWithPolygonAlgo(shape, viewAxis);
     }
     else {
+        if (wantsPreview(shape)) {
+            showPreview(shape, viewAxis);
+        }
+
         //projectShape (the HLR process) runs in a separate thread since it can take a long time
         //note that &m_hlrWatcher in the third parameter is not strictly required, but using the
         //4 parameter signature instead of the 3 parameter signature prevents clazy warning:
@@ -369,13 +376,52 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(TopoDS_Shape& shap
         // This is important because those variables might be local to the calling
         // function and might get destructed before the parallel processing finishes.
         auto lambda = [go, shape, viewAxis]{go->projectShape(shape, viewAxis);};
-        m_hlrFuture = QtConcurrent::run(std::move(lambda));
+        m_hlrFuture = ViewScheduler::instance().run(this, std::move(lambda));
         m_hlrWatcher.setFuture(m_hlrFuture);
         waitingForHlr(true);
     }
     return go;
 }
 
+//! true if a big shape should be shown with the polygon algorithm until its exact hidden lines
+//! are found. Views with dimensions or balloons are not previewed, as their references would
+//! point to the wrong geometry.
+bool DrawViewPart::wantsPreview(const TopoDS_Shape& shape) const
+{
+    int faceCount = Preferences::previewFaceCount();
+    if (faceCount <= 0 || hasGeometry() || !getDimensions().empty() || !getBalloons().empty()) {
+        return false;
+    }
+    TopTools_IndexedMapOfShape faces;
+    TopExp::MapShapes(shape, TopAbs_FACE, faces);
+    return faces.Extent() >= faceCount;
+}
+
+//! show a quick projection of shape made from its mesh, onHlrFinished replaces it
+void DrawViewPart::showPreview(const TopoDS_Shape& shape, const gp_Ax2& viewAxis)
+{
+    TechDraw::GeometryObjectPtr preview(
+        std::make_shared<TechDraw::GeometryObject>(getNameInDocument(), this));
+    preview->setIsoCount(IsoCount.getValue());
+    preview->isPerspective(Perspective.getValue());
+    preview->setFocus(Focus.getValue());
+    preview->usePolygonHLR(true);
+    preview->setDeflection(Preferences::previewDeflection());
+    preview->setScrubCount(ScrubCount.getValue());
+    try {
+        preview->projectShapeWithPolygonAlgo(shape, viewAxis);
+    }
+    catch (const Standard_Failure& e) {
+        Base::Console().Warning("DVP::showPreview - %s - %s\n", getNameInDocument(),
+                                e.GetMessageString());
+        return;
+    }
+
+    geometryObject = preview;
+    bbox = geometryObject->calcBoundingBox();
+    requestPaint();
+}
+
 //! continue processing after hlr thread completes
 void DrawViewPart::onHlrFinished()
 {
@@ -416,7 +462,7 @@ void DrawViewPart::onHlrFinished()
                                  [this] { this->onFacesFinished(); });
 
             auto lambda = [this]{this->extractFaces();};
-            m_faceFuture = QtConcurrent::run(std::move(lambda));
+            m_faceFuture = ViewScheduler::instance().run(this, std::move(lambda));
             m_faceWatcher.setFuture(m_faceFuture);
             waitingForFaces(true);
         }
@@ -599,60 +645,97 @@ void DrawViewPart::findFacesOld(const std::vector<BaseGeomPtr> &goEdges)
 
     //HLR algo does not provide all edge intersections for edge endpoints.
     //need to split long edges touched by Vertex of another edge
-    std::vector<splitPoint> splits;
-    std::vector<TopoDS_Edge>::iterator itOuter = nonZero.begin();
-    int iOuter = 0;
-    for (; itOuter != nonZero.end(); ++itOuter, iOuter++) {//*** itOuter != nonZero.end() - 1
-        TopoDS_Vertex v1 = TopExp::FirstVertex((*itOuter));
-        TopoDS_Vertex v2 = TopExp::LastVertex((*itOuter));
-        Bnd_Box sOuter;
-        BRepBndLib::AddOptimal(*itOuter, sOuter);
-        sOuter.SetGap(0.1);
-        if (sOuter.IsVoid()) {
-            continue;
-        }
-        if (DrawUtil::isZeroEdge(*itOuter)) {
+    //the boxes are computed once and sorted by their left side, so only the edges whose boxes
+    //overlap in x are compared
+    std::size_t edgeCount = nonZero.size();
+    std::vector<Bnd_Box> boxes(edgeCount);
+    std::vector<bool> usable(edgeCount, false);
+    std::vector<std::size_t> byXmin;
+    for (std::size_t i = 0; i < edgeCount; i++) {
+        BRepBndLib::AddOptimal(nonZero[i], boxes[i]);
+        boxes[i].SetGap(0.1);
+        if (boxes[i].IsVoid() || DrawUtil::isZeroEdge(nonZero[i])) {
             continue;                   //skip zero length edges. shouldn't happen ;)
         }
-        int iInner = 0;
-        std::vector<TopoDS_Edge>::iterator itInner = nonZero.begin();//***sb itOuter + 1;
-        for (; itInner != nonZero.end(); ++itInner, iInner++) {
-            if (iInner == iOuter) {
+        usable[i] = true;
+        byXmin.push_back(i);
+    }
+    auto xMin = [&boxes](std::size_t i) {
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        boxes[i].Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        return xmin;
+    };
+    std::sort(byXmin.begin(), byXmin.end(), [&xMin](std::size_t i, std::size_t j) {
+        return xMin(i) < xMin(j);
+    });
+    std::vector<double> sortedXmin;
+    sortedXmin.reserve(byXmin.size());
+    for (std::size_t i : byXmin) {
+        sortedXmin.push_back(xMin(i));
+    }
+
+    //the edges are tested in parallel, the splits are kept per outer edge so they come out
+    //in the same order as from a serial loop
+    std::vector<std::vector<splitPoint>> splitsPerEdge(edgeCount);
+    std::atomic<std::size_t> nextOuter(0);
+    auto findSplits = [&]() {
+        std::vector<std::size_t> candidates;
+        for (std::size_t iOuter = nextOuter++; iOuter < edgeCount; iOuter = nextOuter++) {
+            if (!usable[iOuter]) {
                 continue;
             }
-            if (DrawUtil::isZeroEdge((*itInner))) {
-                continue;//skip zero length edges. shouldn't happen ;)
+            const Bnd_Box& sOuter = boxes[iOuter];
+            double xmin, ymin, zmin, xmax, ymax, zmax;
+            sOuter.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+            candidates.clear();
+            auto end = std::upper_bound(sortedXmin.begin(), sortedXmin.end(), xmax);
+            for (auto it = sortedXmin.begin(); it != end; ++it) {
+                std::size_t iInner = byXmin[it - sortedXmin.begin()];
+                if (iInner != iOuter && !sOuter.IsOut(boxes[iInner])) {
+                    candidates.push_back(iInner);
+                }
             }
+            std::sort(candidates.begin(), candidates.end());
+
+            TopoDS_Vertex v1 = TopExp::FirstVertex(nonZero[iOuter]);
+            TopoDS_Vertex v2 = TopExp::LastVertex(nonZero[iOuter]);
+            for (std::size_t iInner : candidates) {
+                double param = -1;
+                if (DrawProjectSplit::isOnEdge(nonZero[iInner], v1, param, false)) {
+                    gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
+                    splitPoint s1;
+                    s1.i = static_cast<int>(iInner);
+                    s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
+                    s1.param = param;
+                    splitsPerEdge[iOuter].push_back(s1);
+                }
+                if (DrawProjectSplit::isOnEdge(nonZero[iInner], v2, param, false)) {
+                    gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
+                    splitPoint s2;
+                    s2.i = static_cast<int>(iInner);
+                    s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
+                    s2.param = param;
+                    splitsPerEdge[iOuter].push_back(s2);
+                }
+            }//inner loop
+        }    //outer loop
+    };
 
-            Bnd_Box sInner;
-            BRepBndLib::AddOptimal(*itInner, sInner);
-            sInner.SetGap(0.1);
-            if (sInner.IsVoid()) {
-                continue;
-            }
-            if (sOuter.IsOut(sInner)) {//bboxes of edges don't intersect, don't bother
-                continue;
-            }
+    std::size_t numThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, std::max<std::size_t>(1, edgeCount / 16));
+    std::vector<std::future<void>> workers;
+    for (std::size_t i = 1; i < numThreads; i++) {
+        workers.push_back(std::async(std::launch::async, findSplits));
+    }
+    findSplits();
+    for (auto& worker : workers) {
+        worker.get();
+    }
 
-            double param = -1;
-            if (DrawProjectSplit::isOnEdge((*itInner), v1, param, false)) {
-                gp_Pnt pnt1 = BRep_Tool::Pnt(v1);
-                splitPoint s1;
-                s1.i = iInner;
-                s1.v = Base::Vector3d(pnt1.X(), pnt1.Y(), pnt1.Z());
-                s1.param = param;
-                splits.push_back(s1);
-            }
-            if (DrawProjectSplit::isOnEdge((*itInner), v2, param, false)) {
-                gp_Pnt pnt2 = BRep_Tool::Pnt(v2);
-                splitPoint s2;
-                s2.i = iInner;
-                s2.v = Base::Vector3d(pnt2.X(), pnt2.Y(), pnt2.Z());
-                s2.param = param;
-                splits.push_back(s2);
-            }
-        }//inner loop
-    }    //outer loop
+    std::vector<splitPoint> splits;
+    for (auto& edgeSplits : splitsPerEdge) {
+        splits.insert(splits.end(), edgeSplits.begin(), edgeSplits.end());
+    }
 
     std::vector<splitPoint> sorted = DrawProjectSplit::sortSplits(splits, true);
     auto last = std::unique(sorted.begin(), sorted.end(),
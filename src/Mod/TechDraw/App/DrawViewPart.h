@@ -230,6 +230,8 @@ protected:
     virtual TechDraw::GeometryObjectPtr buildGeometryObject(TopoDS_Shape& shape,
                                                             const gp_Ax2& viewAxis);
     virtual TechDraw::GeometryObjectPtr makeGeometryForShape(TopoDS_Shape& shape);//const??
+    bool wantsPreview(const TopoDS_Shape& shape) const;
+    void showPreview(const TopoDS_Shape& shape, const gp_Ax2& viewAxis);
     void partExec(TopoDS_Shape& shape);
     virtual void addPoints(void);
 
@@ -56,7 +56,6 @@
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 #include <Bnd_Box.hxx>
-#include <QtConcurrentRun>
 #include <ShapeAnalysis.hxx>
 #include <ShapeFix_Shape.hxx>
 #include <TopExp.hxx>
@@ -66,6 +65,7 @@
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
+#include <algorithm>
 #include <chrono>
 #include <gp_Ax2.hxx>
 #include <gp_Ax3.hxx>
@@ -91,6 +91,7 @@
 #include "EdgeWalker.h"
 #include "GeometryObject.h"
 #include "Preferences.h"
+#include "ViewScheduler.h"
 
 #include "DrawViewSection.h"
 
@@ -335,7 +336,10 @@ void DrawViewSection::onChanged(const App::Property* prop)
             UsePreviousCut.setStatus(App::Property::ReadOnly, true);
         }
     } else if (prop == &SectionLineStretch) {
-        BaseView.getValue()->touch();
+        // the section line is drawn by the base view, it needs no recompute
+        if (getBaseDVP()) {
+            getBaseDVP()->requestPaint();
+        }
     }
 
     DrawView::onChanged(prop);
@@ -409,6 +413,14 @@ App::DocumentObjectExecReturn* DrawViewSection::execute()
     Bnd_Box centerBox;
     BRepBndLib::AddOptimal(baseShape, centerBox);
     centerBox.SetGap(0.0);
+
+    // a change to the looks of the view only needs a repaint if the cut is still valid
+    if (onlyAppearanceTouched() && hasGeometry()
+        && sectionCutKey(baseShape, makeCuttingTool(sqrt(centerBox.SquareExtent())))
+            == m_cutKey) {
+        requestPaint();
+        return DrawView::execute();
+    }
     Base::Vector3d orgPnt = SectionOrigin.getValue();
 
     if (!isReallyInBox(gp_Pnt(orgPnt.x, orgPnt.y, orgPnt.z), centerBox)) {
@@ -459,6 +471,10 @@ void DrawViewSection::sectionExec(TopoDS_Shape& baseShape)
 
     m_cuttingTool = makeCuttingTool(m_shapeSize);
 
+    // the cut of the same shape with the same tool is still valid, only the projection is redone
+    std::size_t key = sectionCutKey(baseShape, m_cuttingTool);
+    bool reuseCut = key == m_cutKey && !m_cutPieces.IsNull();
+
     try {
         // note that &m_cutWatcher in the third parameter is not strictly required,
         // but using the 4 parameter signature instead of the 3 parameter signature
@@ -469,16 +485,26 @@ void DrawViewSection::sectionExec(TopoDS_Shape& baseShape)
                 this->onSectionCutFinished();
             });
 
-        // We create a lambda closure to hold a copy of baseShape.
-        // This is important because this variable might be local to the calling
-        // function and might get destructed before the parallel processing finishes.
-        auto lambda = [this, baseShape]{this->makeSectionCut(baseShape);};
-        m_cutFuture = QtConcurrent::run(std::move(lambda));
-        m_cutWatcher.setFuture(m_cutFuture);
+        // a reused cut still finishes through the watcher, so the follow up work runs as usual
+        std::function<void()> lambda = [this] { this->waitingForCut(false); };
+        if (!reuseCut) {
+            // We create a lambda closure to hold a copy of baseShape.
+            // This is important because this variable might be local to the calling
+            // function and might get destructed before the parallel processing finishes.
+            m_cutKey = 0;
+            lambda = [this, baseShape, key] {
+                this->makeSectionCut(baseShape);
+                m_cutKey = key;
+            };
+        }
+        // set before the job starts, it may finish at once
         waitingForCut(true);
+        m_cutFuture = ViewScheduler::instance().run(this, std::move(lambda));
+        m_cutWatcher.setFuture(m_cutFuture);
     }
     catch (...) {
         Base::Console().Message("DVS::sectionExec - failed to make section cut");
+        waitingForCut(false);
         return;
     }
 }
@@ -550,6 +576,45 @@ void DrawViewSection::makeSectionCut(const TopoDS_Shape& baseShape)
     waitingForCut(false);
 }
 
+//! a key for the result of cutting baseShape with cuttingTool
+std::size_t DrawViewSection::sectionCutKey(const TopoDS_Shape& baseShape,
+                                           const TopoDS_Shape& cuttingTool) const
+{
+    std::size_t seed = GeometryObject::shapeFingerprint(baseShape);
+    for (std::size_t value :
+         {GeometryObject::shapeFingerprint(cuttingTool), std::size_t(trimAfterCut())}) {
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    // 0 means no cut
+    return seed == 0 ? 1 : seed;
+}
+
+//! true if the only properties touched change the looks of the section, but not its geometry
+bool DrawViewSection::onlyAppearanceTouched() const
+{
+    const std::vector<const App::Property*> appearance {
+        &SectionSymbol, &CutSurfaceDisplay, &FileHatchPattern, &FileGeomPattern,
+        &SvgIncluded,   &PatIncluded,       &NameGeomPattern,  &HatchScale,
+        &HatchRotation, &HatchOffset,       &SectionLineStretch, &X,
+        &Y,             &LockPosition,      &Caption,          &Label,
+        &Label2,        &Visibility};
+
+    std::vector<App::Property*> props;
+    getPropertyList(props);
+    bool touched = false;
+    for (auto* prop : props) {
+        if (!prop->isTouched()) {
+            continue;
+        }
+        if (std::find(appearance.begin(), appearance.end(), prop) == appearance.end()) {
+            return false;
+        }
+        touched = true;
+    }
+    // nothing touched means the object is recomputed for a change of its inputs
+    return touched;
+}
+
 //! position, scale and rotate shape for  buildGeometryObject
 //! save the cut shape for further processing
 TopoDS_Shape DrawViewSection::prepareShape(const TopoDS_Shape& rawShape, double shapeSize)
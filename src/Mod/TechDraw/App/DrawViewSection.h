@@ -25,6 +25,8 @@
 #ifndef DrawViewSection_h_
 #define DrawViewSection_h_
 
+#include <atomic>
+
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
 #include <gp_Ax2.hxx>
@@ -132,6 +134,9 @@ public:
     virtual bool isBaseValid() const;
     virtual TopoDS_Shape prepareShape(const TopoDS_Shape& rawShape, double shapeSize);
     virtual TopoDS_Shape getShapeToPrepare() const { return m_cutPieces; }
+    virtual std::size_t sectionCutKey(const TopoDS_Shape& baseShape,
+                                      const TopoDS_Shape& cuttingTool) const;
+    bool onlyAppearanceTouched() const;
 
     //CS related methods
     void setCSFromBase(const std::string sectionName);
@@ -207,6 +212,8 @@ protected:
     bool m_waitingForCut;
     TopoDS_Shape m_cuttingTool;
     double m_shapeSize;
+    //! the sectionCutKey of m_cutPieces, 0 if there is no cut yet
+    std::atomic<std::size_t> m_cutKey {0};
 
     static App::PropertyFloatConstraint::Constraints stretchRange;
 
@@ -28,8 +28,11 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
+# include <array>
 # include <cmath>
 # include <sstream>
+# include <unordered_map>
 # include <BRep_Tool.hxx>
 # include <BRepBuilderAPI_MakeWire.hxx>
 # include <ShapeAnalysis.hxx>
@@ -49,6 +52,69 @@
 using namespace TechDraw;
 using namespace boost;
 
+namespace
+{
+
+//! sorts points into cubes of a given size, so the points close to a point are found without
+//! comparing it to all others
+class PointGrid
+{
+public:
+    explicit PointGrid(double cellSize)
+        : m_cellSize(cellSize)
+    {}
+
+    void add(const Base::Vector3d& point, std::size_t index)
+    {
+        m_cells[{cell(point.x), cell(point.y), cell(point.z)}].push_back(index);
+    }
+
+    //! calls visit with the index of every point in the cell of point and the cells around it
+    template<typename Visitor>
+    void forNeighbours(const Base::Vector3d& point, Visitor visit) const
+    {
+        long long cx = cell(point.x);
+        long long cy = cell(point.y);
+        long long cz = cell(point.z);
+        for (long long x = cx - 1; x <= cx + 1; x++) {
+            for (long long y = cy - 1; y <= cy + 1; y++) {
+                for (long long z = cz - 1; z <= cz + 1; z++) {
+                    auto it = m_cells.find({x, y, z});
+                    if (it != m_cells.end()) {
+                        for (std::size_t index : it->second) {
+                            visit(index);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    using Key = std::array<long long, 3>;
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            std::size_t seed = 0;
+            for (long long k : key) {
+                seed ^= std::hash<long long> {}(k) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            }
+            return seed;
+        }
+    };
+
+    long long cell(double value) const
+    {
+        return static_cast<long long>(std::floor(value / m_cellSize));
+    }
+
+    double m_cellSize;
+    std::unordered_map<Key, std::vector<std::size_t>, KeyHash> m_cells;
+};
+
+}// namespace
+
 //*******************************************************
 //* edgeVisior methods
 //*******************************************************
@@ -270,26 +336,32 @@ std::vector<TopoDS_Vertex> EdgeWalker:: makeUniqueVList(std::vector<TopoDS_Edge>
 {
 //    Base::Console().Message("TRACE - EW::makeUniqueVList() - edgesIn: %d\n", edges.size());
     std::vector<TopoDS_Vertex> uniqueVert;
+    std::vector<Base::Vector3d> uniquePoints;
+    PointGrid grid(EWTOLERANCE);
+    auto isNew = [&](const Base::Vector3d& point) {
+        bool found = false;
+        grid.forNeighbours(point, [&](std::size_t i) {
+            found = found || uniquePoints[i].IsEqual(point, EWTOLERANCE);
+        });
+        return !found;
+    };
     for(auto& e:edges) {
-        Base::Vector3d v1 = DrawUtil::vertex2Vector(TopExp::FirstVertex(e));
-        Base::Vector3d v2 = DrawUtil::vertex2Vector(TopExp::LastVertex(e));
-        bool addv1 = true;
-        bool addv2 = true;
+        TopoDS_Vertex first = TopExp::FirstVertex(e);
+        TopoDS_Vertex last = TopExp::LastVertex(e);
+        Base::Vector3d v1 = DrawUtil::vertex2Vector(first);
+        Base::Vector3d v2 = DrawUtil::vertex2Vector(last);
         //check if we've already added this vertex
-        for (const auto& v: uniqueVert) {
-            Base::Vector3d v3d = DrawUtil::vertex2Vector(v);
-            if (v3d.IsEqual(v1, EWTOLERANCE)) {
-                addv1 = false;
-            }
-            if (v3d.IsEqual(v2, EWTOLERANCE)) {
-                addv2 = false;
-            }
-        }
+        bool addv1 = isNew(v1);
+        bool addv2 = isNew(v2);
         if (addv1) {
-            uniqueVert.push_back(TopExp::FirstVertex(e));
+            grid.add(v1, uniquePoints.size());
+            uniquePoints.push_back(v1);
+            uniqueVert.push_back(first);
         }
         if (addv2) {
-            uniqueVert.push_back(TopExp::LastVertex(e));
+            grid.add(v2, uniquePoints.size());
+            uniquePoints.push_back(v2);
+            uniqueVert.push_back(last);
         }
     }
 //    Base::Console().Message("EW::makeUniqueVList - verts out: %d\n", uniqueVert.size());
@@ -302,15 +374,33 @@ std::vector<WalkerEdge> EdgeWalker::makeWalkerEdges(std::vector<TopoDS_Edge> edg
 {
 //    Base::Console().Message("TRACE - EW::makeWalkerEdges() - edges: %d  verts: %d\n", edges.size(), verts.size());
     m_saveInEdges = edges;
+
+    std::vector<Base::Vector3d> points;
+    points.reserve(verts.size());
+    PointGrid grid(EWTOLERANCE);
+    for (const auto& v : verts) {
+        grid.add(DrawUtil::vertex2Vector(v), points.size());
+        points.push_back(DrawUtil::vertex2Vector(v));
+    }
+    //the first unique vertex close to the edge vertex, like findUniqueVert
+    auto findIndex = [&](const TopoDS_Vertex& vx) {
+        std::size_t index = SIZE_MAX;
+        Base::Vector3d vx3d = DrawUtil::vertex2Vector(vx);
+        grid.forNeighbours(vx3d, [&](std::size_t i) {
+            if (i < index && vx3d.IsEqual(points[i], EWTOLERANCE)) {
+                index = i;
+            }
+        });
+        return index;
+    };
+
     std::vector<WalkerEdge> walkerEdges;
     for (const auto& e:edges) {
-        TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
-        TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
-        std::size_t vertex1Index = findUniqueVert(edgeVertex1, verts);
+        std::size_t vertex1Index = findIndex(TopExp::FirstVertex(e));
         if (vertex1Index == SIZE_MAX) {
             continue;
         }
-        std::size_t vertex2Index = findUniqueVert(edgeVertex2, verts);
+        std::size_t vertex2Index = findIndex(TopExp::LastVertex(e));
         if (vertex2Index == SIZE_MAX) {
             continue;
         }
@@ -388,29 +478,45 @@ std::vector<embedItem> EdgeWalker::makeEmbedding(const std::vector<TopoDS_Edge>
 //    Base::Console().Message("TRACE - EW::makeEmbedding(edges: %d, verts: %d)\n",
 //                            edges.size(), uniqueVList.size());
     std::vector<embedItem> result;
+    result.reserve(uniqueVList.size());
+
+    //the end points of all edges, in flat arrays and in a grid. vertexEqual accepts points up
+    //to 2 * EWTOLERANCE apart in x and y, so the cells are that large.
+    std::vector<Base::Vector3d> firstPoints;
+    std::vector<Base::Vector3d> lastPoints;
+    firstPoints.reserve(edges.size());
+    lastPoints.reserve(edges.size());
+    PointGrid grid(2.0 * EWTOLERANCE);
+    for (std::size_t iEdge = 0; iEdge < edges.size(); iEdge++) {
+        firstPoints.push_back(DrawUtil::vertex2Vector(TopExp::FirstVertex(edges[iEdge])));
+        lastPoints.push_back(DrawUtil::vertex2Vector(TopExp::LastVertex(edges[iEdge])));
+        grid.add(firstPoints.back(), iEdge);
+        grid.add(lastPoints.back(), iEdge);
+    }
 
     std::size_t iVert = 0;
     //make an embedItem for each vertex in uniqueVList
     //for each vertex v
     //  find all the edges that have v as first or last vertex
+    std::vector<std::size_t> nearEdges;
     for (auto& v: uniqueVList) {
-        TopoDS_Vertex cv = v;               //v is const but we need non-const for vertexEqual
-        std::size_t iEdge = 0;
+        Base::Vector3d point = DrawUtil::vertex2Vector(v);
+        nearEdges.clear();
+        grid.forNeighbours(point, [&](std::size_t iEdge) {
+            nearEdges.push_back(iEdge);
+        });
+        //visit the edges in their order, as the incidence sort is not stable
+        std::sort(nearEdges.begin(), nearEdges.end());
+        nearEdges.erase(std::unique(nearEdges.begin(), nearEdges.end()), nearEdges.end());
+
         std::vector<incidenceItem> iiList;
-        for (auto& e: edges) {
-            double angle = 0;
-            TopoDS_Vertex edgeVertex1 = TopExp::FirstVertex(e);
-            TopoDS_Vertex edgeVertex2 = TopExp::LastVertex(e);
-            if (DrawUtil::vertexEqual(cv, edgeVertex1)) {
-                angle = DrawUtil::incidenceAngleAtVertex(e,v,EWTOLERANCE);
-                incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
-                iiList.push_back(ii);
-            } else if (DrawUtil::vertexEqual(cv, edgeVertex2)) {
-                angle = DrawUtil::incidenceAngleAtVertex(e,v,EWTOLERANCE);
+        for (std::size_t iEdge : nearEdges) {
+            if (DrawUtil::vectorEqual(point, firstPoints[iEdge])
+                || DrawUtil::vectorEqual(point, lastPoints[iEdge])) {
+                double angle = DrawUtil::incidenceAngleAtVertex(edges[iEdge], v, EWTOLERANCE);
                 incidenceItem ii(iEdge, angle, m_saveWalkerEdges[iEdge].ed);
                 iiList.push_back(ii);
             }
-            iEdge++;
        }
        //sort incidenceList by angle
        iiList = embedItem::sortIncidenceList(iiList,  false);
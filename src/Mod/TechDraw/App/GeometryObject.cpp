@@ -26,6 +26,9 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+#include <atomic>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
 #include <BRepAlgo_NormalProjection.hxx>
 #include <BRepBndLib.hxx>
 #include <BRepBuilderAPI_Copy.hxx>
@@ -48,6 +51,7 @@
 #include <HLRBRep_PolyHLRToShape.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
@@ -63,7 +67,12 @@
 #endif// #ifndef _PreComp_
 
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 
 #include <Base/Console.h>
 #include <Mod/Part/App/PartFeature.h>
@@ -74,6 +83,7 @@
 #include "DrawViewPart.h"
 #include "GeometryObject.h"
 #include "DrawProjectSplit.h"
+#include "Preferences.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
@@ -81,11 +91,55 @@ using namespace std;
 
 using DU = DrawUtil;
 
+namespace
+{
+
+//! the last revision handed out, revisions are unique among all geometry objects
+std::atomic<std::size_t> lastRevision {0};
+
+// copied from boost::hash_combine
+template<class T>
+void hashCombine(std::size_t& seed, const T& v)
+{
+    seed ^= std::hash<T> {}(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+//! points are compared to a nanometre, so copies of a shape hash alike
+void hashPoint(std::size_t& seed, const gp_Pnt& pnt)
+{
+    const double resolution = 1.0e6;
+    hashCombine(seed, std::llround(pnt.X() * resolution));
+    hashCombine(seed, std::llround(pnt.Y() * resolution));
+    hashCombine(seed, std::llround(pnt.Z() * resolution));
+}
+
+void hashDir(std::size_t& seed, const gp_Dir& dir)
+{
+    const double resolution = 1.0e9;
+    hashCombine(seed, std::llround(dir.X() * resolution));
+    hashCombine(seed, std::llround(dir.Y() * resolution));
+    hashCombine(seed, std::llround(dir.Z() * resolution));
+}
+
+//! the HLR output of a projection: visible hard, outline, smooth, seam and iso lines,
+//! followed by the hidden ones
+using HlrResult = std::array<TopoDS_Shape, 10>;
+
+//! the HLR results shared by all views, the most recently used at the front. The HLR
+//! runs in worker threads, so the cache is guarded by a mutex.
+std::list<std::pair<std::size_t, HlrResult>> hlrResults;
+std::unordered_map<std::size_t, std::list<std::pair<std::size_t, HlrResult>>::iterator> hlrIndex;
+std::mutex hlrMutex;
+
+}// namespace
+
 GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentObj)
     : m_parentName(parent), m_parent(parentObj), m_isoCount(0), m_isPersp(false), m_focus(100.0),
-      m_usePolygonHLR(false), m_scrubCount(0)
+      m_usePolygonHLR(false), m_scrubCount(0), m_deflection(0.10), m_revision(0)
 
-{}
+{
+    touchGeometry();
+}
 
 GeometryObject::~GeometryObject() { clear(); }
 
@@ -131,8 +185,14 @@ const BaseGeomPtrVector GeometryObject::getVisibleFaceEdges(const bool smooth,
 }
 
 
+void GeometryObject::touchGeometry()
+{
+    m_revision = ++lastRevision;
+}
+
 void GeometryObject::clear()
 {
+    touchGeometry();
     //shared pointers will delete v/e/f when reference counts go to zero.
 
     vertexGeom.clear();
@@ -144,6 +204,13 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
 {
     clear();
 
+    //the same shape seen from the same direction gives the same hidden lines
+    std::size_t key = hlrCacheKey(inShape, viewAxis);
+    if (restoreHlrResult(key)) {
+        makeTDGeometry();
+        return;
+    }
+
     Handle(HLRBRep_Algo) brep_hlr;
     try {
         brep_hlr = new HLRBRep_Algo();
@@ -244,9 +311,121 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
             "GeometryObject::projectShape - unknown error occurred while extracting edges");
     }
 
+    storeHlrResult(key);
     makeTDGeometry();
 }
 
+std::size_t GeometryObject::shapeFingerprint(const TopoDS_Shape& shape)
+{
+    std::size_t seed = 0;
+    if (shape.IsNull()) {
+        return seed;
+    }
+
+    TopTools_IndexedMapOfShape vertexMap;
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
+    hashCombine(seed, vertexMap.Extent());
+    for (int i = 1; i <= vertexMap.Extent(); ++i) {
+        hashPoint(seed, BRep_Tool::Pnt(TopoDS::Vertex(vertexMap(i))));
+    }
+
+    //the type and a middle point of the curves and surfaces tell apart shapes with the same
+    //vertices, like a fillet and a chamfer
+    TopTools_IndexedMapOfShape edgeMap;
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+    hashCombine(seed, edgeMap.Extent());
+    for (int i = 1; i <= edgeMap.Extent(); ++i) {
+        const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(i));
+        if (BRep_Tool::Degenerated(edge)) {
+            hashCombine(seed, -1);
+            continue;
+        }
+        BRepAdaptor_Curve curve(edge);
+        hashCombine(seed, static_cast<int>(curve.GetType()));
+        hashPoint(seed, curve.Value((curve.FirstParameter() + curve.LastParameter()) / 2.0));
+    }
+
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    hashCombine(seed, faceMap.Extent());
+    for (int i = 1; i <= faceMap.Extent(); ++i) {
+        const TopoDS_Face& face = TopoDS::Face(faceMap(i));
+        BRepAdaptor_Surface surface(face);
+        hashCombine(seed, static_cast<int>(surface.GetType()));
+        hashCombine(seed, static_cast<int>(face.Orientation()));
+        hashPoint(seed, surface.Value((surface.FirstUParameter() + surface.LastUParameter()) / 2.0,
+                                      (surface.FirstVParameter() + surface.LastVParameter()) / 2.0));
+    }
+    return seed;
+}
+
+std::size_t GeometryObject::hlrCacheKey(const TopoDS_Shape& input, const gp_Ax2& viewAxis) const
+{
+    std::size_t seed = shapeFingerprint(input);
+    hashPoint(seed, viewAxis.Location());
+    hashDir(seed, viewAxis.Direction());
+    hashDir(seed, viewAxis.XDirection());
+    hashCombine(seed, m_isoCount);
+    hashCombine(seed, m_usePolygonHLR);
+    if (m_usePolygonHLR) {
+        hashCombine(seed, m_deflection);
+    }
+    hashCombine(seed, m_isPersp);
+    if (m_isPersp) {
+        hashCombine(seed, m_focus);
+    }
+    return seed;
+}
+
+bool GeometryObject::restoreHlrResult(std::size_t key)
+{
+    std::lock_guard<std::mutex> lock(hlrMutex);
+    auto it = hlrIndex.find(key);
+    if (it == hlrIndex.end()) {
+        return false;
+    }
+    hlrResults.splice(hlrResults.begin(), hlrResults, it->second);
+
+    const HlrResult& result = it->second->second;
+    visHard = result[0];
+    visOutline = result[1];
+    visSmooth = result[2];
+    visSeam = result[3];
+    visIso = result[4];
+    hidHard = result[5];
+    hidOutline = result[6];
+    hidSmooth = result[7];
+    hidSeam = result[8];
+    hidIso = result[9];
+    return true;
+}
+
+void GeometryObject::storeHlrResult(std::size_t key) const
+{
+    int capacity = Preferences::hlrCacheSize();
+    std::lock_guard<std::mutex> lock(hlrMutex);
+    if (capacity <= 0) {
+        hlrIndex.clear();
+        hlrResults.clear();
+        return;
+    }
+
+    HlrResult result {visHard, visOutline, visSmooth, visSeam, visIso,
+                      hidHard, hidOutline, hidSmooth, hidSeam, hidIso};
+    auto it = hlrIndex.find(key);
+    if (it != hlrIndex.end()) {
+        it->second->second = std::move(result);
+        hlrResults.splice(hlrResults.begin(), hlrResults, it->second);
+        return;
+    }
+    hlrResults.emplace_front(key, std::move(result));
+    hlrIndex[key] = hlrResults.begin();
+    while (hlrResults.size() > static_cast<std::size_t>(capacity)) {
+        hlrIndex.erase(hlrResults.back().first);
+        hlrResults.pop_back();
+    }
+}
+
 //convert the hlr output into TD Geometry
 void GeometryObject::makeTDGeometry()
 {
@@ -293,6 +472,12 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
     // Clear previous Geometry
     clear();
 
+    std::size_t key = hlrCacheKey(input, viewAxis);
+    if (restoreHlrResult(key)) {
+        makeTDGeometry();
+        return;
+    }
+
     //work around for Mantis issue #3332
     //if 3332 gets fixed in OCC, this will produce shifted views and will need
     //to be reverted.
@@ -312,7 +497,7 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
     try {
         // HLRBRep_PolyAlgo will fail if the whole input shape has not been meshed.
         // meshing the faces is not sufficient.
-        BRepMesh_IncrementalMesh(inCopy, 0.10);
+        BRepMesh_IncrementalMesh(inCopy, m_deflection);
 
         brep_hlrPoly = new HLRBRep_PolyAlgo();
         brep_hlrPoly->Load(inCopy);
@@ -388,6 +573,7 @@ void GeometryObject::projectShapeWithPolygonAlgo(const TopoDS_Shape& input, cons
                                  "occurred while extracting edges");
     }
 
+    storeHlrResult(key);
     makeTDGeometry();
 }
 
@@ -454,6 +640,7 @@ TopoDS_Shape GeometryObject::projectFace(const TopoDS_Shape& face, const gp_Ax2&
 //!add edges meeting filter criteria for category, visibility
 void GeometryObject::extractGeometry(edgeClass category, bool hlrVisible)
 {
+    touchGeometry();
     //    Base::Console().Message("GO::extractGeometry(%d, %d)\n", category, hlrVisible);
     TopoDS_Shape filtEdges;
     if (hlrVisible) {
@@ -615,9 +802,17 @@ void GeometryObject::addGeomFromCompound(TopoDS_Shape edgeCompound, edgeClass ca
     }//end TopExp
 }
 
-void GeometryObject::addVertex(TechDraw::VertexPtr v) { vertexGeom.push_back(v); }
+void GeometryObject::addVertex(TechDraw::VertexPtr v)
+{
+    vertexGeom.push_back(v);
+    touchGeometry();
+}
 
-void GeometryObject::addEdge(TechDraw::BaseGeomPtr bg) { edgeGeom.push_back(bg); }
+void GeometryObject::addEdge(TechDraw::BaseGeomPtr bg)
+{
+    edgeGeom.push_back(bg);
+    touchGeometry();
+}
 
 //********** Cosmetic Vertex ***************************************************
 
@@ -627,6 +822,7 @@ void GeometryObject::addEdge(TechDraw::BaseGeomPtr bg) { edgeGeom.push_back(bg);
 // is this ever used?
 int GeometryObject::addCosmeticVertex(CosmeticVertex* cv)
 {
+    touchGeometry();
     double scale = m_parent->getScale();
     Base::Vector3d pos = cv->scaled(scale);
     TechDraw::VertexPtr v(std::make_shared<TechDraw::Vertex>(pos.x, pos.y));
@@ -642,6 +838,7 @@ int GeometryObject::addCosmeticVertex(CosmeticVertex* cv)
 //should probably be called addVertex since not connect to CV by tag
 int GeometryObject::addCosmeticVertex(Base::Vector3d pos)
 {
+    touchGeometry();
     TechDraw::VertexPtr v(std::make_shared<TechDraw::Vertex>(pos.x, pos.y));
     v->setCosmetic(true);
     v->setCosmeticTag("tbi");//not connected to CV
@@ -653,6 +850,7 @@ int GeometryObject::addCosmeticVertex(Base::Vector3d pos)
 
 int GeometryObject::addCosmeticVertex(Base::Vector3d pos, std::string tagString)
 {
+    touchGeometry();
     TechDraw::VertexPtr v(std::make_shared<TechDraw::Vertex>(pos.x, pos.y));
     v->setCosmetic(true);
     v->setCosmeticTag(tagString);//connected to CV
@@ -669,6 +867,7 @@ int GeometryObject::addCosmeticVertex(Base::Vector3d pos, std::string tagString)
 // insertGeomForCE(ce)
 int GeometryObject::addCosmeticEdge(CosmeticEdge* ce)
 {
+    touchGeometry();
     //    Base::Console().Message("GO::addCosmeticEdge(%X) 0\n", ce);
     double scale = m_parent->getScale();
     TechDraw::BaseGeomPtr e = ce->scaledGeometry(scale);
@@ -684,6 +883,7 @@ int GeometryObject::addCosmeticEdge(CosmeticEdge* ce)
 //this should be made obsolete and the variant with tag used instead
 int GeometryObject::addCosmeticEdge(Base::Vector3d start, Base::Vector3d end)
 {
+    touchGeometry();
     //    Base::Console().Message("GO::addCosmeticEdge() 1 - deprec?\n");
     gp_Pnt gp1(start.x, start.y, start.z);
     gp_Pnt gp2(end.x, end.y, end.z);
@@ -700,6 +900,7 @@ int GeometryObject::addCosmeticEdge(Base::Vector3d start, Base::Vector3d end)
 
 int GeometryObject::addCosmeticEdge(Base::Vector3d start, Base::Vector3d end, std::string tagString)
 {
+    touchGeometry();
     //    Base::Console().Message("GO::addCosmeticEdge() 2\n");
     gp_Pnt gp1(start.x, start.y, start.z);
     gp_Pnt gp2(end.x, end.y, end.z);
@@ -716,6 +917,7 @@ int GeometryObject::addCosmeticEdge(Base::Vector3d start, Base::Vector3d end, st
 
 int GeometryObject::addCosmeticEdge(TechDraw::BaseGeomPtr base, std::string tagString)
 {
+    touchGeometry();
     //    Base::Console().Message("GO::addCosmeticEdge(%X, %s) 3\n", base, tagString.c_str());
     base->setCosmetic(true);
     base->setHlrVisible(true);
@@ -730,6 +932,7 @@ int GeometryObject::addCosmeticEdge(TechDraw::BaseGeomPtr base, std::string tagS
 int GeometryObject::addCenterLine(TechDraw::BaseGeomPtr base, std::string tag)
 //                                    int s, int si)
 {
+    touchGeometry();
     //    Base::Console().Message("GO::addCenterLine()\n");
     base->setCosmetic(true);
     base->setCosmeticTag(tag);
@@ -77,11 +77,23 @@ public:
     const BaseGeomPtrVector getVisibleFaceEdges(bool smooth, bool seam) const;
     const std::vector<FacePtr>& getFaceGeometry() const { return faceGeom; }
 
-    void setVertexGeometry(std::vector<VertexPtr> newVerts) { vertexGeom = newVerts; }
-    void setEdgeGeometry(BaseGeomPtrVector newGeoms) { edgeGeom = newGeoms; }
+    void setVertexGeometry(std::vector<VertexPtr> newVerts)
+    {
+        vertexGeom = newVerts;
+        touchGeometry();
+    }
+    void setEdgeGeometry(BaseGeomPtrVector newGeoms)
+    {
+        edgeGeom = newGeoms;
+        touchGeometry();
+    }
+    //! changes whenever vertices or edges are added or replaced, equal revisions mean equal geometry
+    std::size_t getRevision() const { return m_revision; }
 
     void projectShape(const TopoDS_Shape& input, const gp_Ax2& viewAxis);
     void projectShapeWithPolygonAlgo(const TopoDS_Shape& input, const gp_Ax2& viewAxis);
+    //! a hash of the vertices, edges and faces of shape, equal for equal copies of a shape
+    static std::size_t shapeFingerprint(const TopoDS_Shape& shape);
     static TopoDS_Shape projectSimpleShape(const TopoDS_Shape& shape, const gp_Ax2& CS);
     static TopoDS_Shape simpleProjection(const TopoDS_Shape& shape, const gp_Ax2& projCS);
     static TopoDS_Shape projectFace(const TopoDS_Shape& face, const gp_Ax2& CS);
@@ -98,6 +110,8 @@ public:
     void setFocus(double f) { m_focus = f; }
     double getFocus() { return m_focus; }
     void setScrubCount(int count) { m_scrubCount = count; }
+    //! the linear deflection of the mesh used by the polygon algorithm
+    void setDeflection(double deflection) { m_deflection = deflection; }
 
 
     void pruneVertexGeom(Base::Vector3d center, double radius);
@@ -144,6 +158,12 @@ protected:
     void addGeomFromCompound(TopoDS_Shape edgeCompound, edgeClass category, bool visible);
     TechDraw::DrawViewDetail* isParentDetail();
 
+    //! the key of the HLR result of input seen along viewAxis with the current options
+    std::size_t hlrCacheKey(const TopoDS_Shape& input, const gp_Ax2& viewAxis) const;
+    //! fill the HLR output from the cache, returns false if there is no entry for key
+    bool restoreHlrResult(std::size_t key);
+    void storeHlrResult(std::size_t key) const;
+
     //similar function in Geometry?
     /*!
      * Returns true iff angle theta is in [first, last], where the arc goes
@@ -157,6 +177,8 @@ protected:
     std::vector<FacePtr> faceGeom;
 
     bool findVertex(Base::Vector3d v);
+    //! give the geometry a new revision
+    void touchGeometry();
 
     std::string m_parentName;
     TechDraw::DrawView* m_parent;
@@ -165,6 +187,8 @@ protected:
     double m_focus;
     bool m_usePolygonHLR;
     int m_scrubCount;
+    double m_deflection;
+    std::size_t m_revision;
 };
 
 using GeometryObjectPtr = std::shared_ptr<GeometryObject>;
@@ -33,15 +33,23 @@
 
 // standard
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdio>
 #include <chrono>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <list>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 // boost
@@ -59,9 +67,13 @@
 #include <QDateTime>
 #include <QDomDocument>
 #include <QFile>
+#include <QFutureInterface>
 #include <QLocale>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
 #include <QtConcurrentRun>
 
 // OpenCasCade
@@ -438,6 +438,37 @@ int Preferences::scrubCount()
     return getPreferenceGroup("General")->GetInt("ScrubCount", 1);
 }
 
+//! Returns the number of HLR results kept for reuse, 0 to always run HLR
+int Preferences::hlrCacheSize()
+{
+    return getPreferenceGroup("General")->GetInt("HLRCacheSize", 100);
+}
+
+//! Returns the number of trimmed PAT hatches kept for reuse, 0 to always trim the pattern
+int Preferences::hatchCacheSize()
+{
+    return getPreferenceGroup("PAT")->GetInt("HatchCacheSize", 200);
+}
+
+//! Returns the number of faces from which a shape is first shown with the polygon algorithm
+//! while the exact hidden lines are found, 0 to never show a preview
+int Preferences::previewFaceCount()
+{
+    return getPreferenceGroup("General")->GetInt("HLRPreviewFaceCount", 2000);
+}
+
+//! Returns the mesh deflection of the preview projection
+double Preferences::previewDeflection()
+{
+    return getPreferenceGroup("General")->GetFloat("HLRPreviewDeflection", 0.10);
+}
+
+//! Returns the number of views computed at the same time, 0 for one per processor core
+int Preferences::maxViewThreads()
+{
+    return getPreferenceGroup("General")->GetInt("MaxViewThreads", 0);
+}
+
 //! Returns the factor for the overlap of svg tiles when hatching faces
 double Preferences::svgHatchFactor()
 {
@@ -108,6 +108,11 @@ public:
 
     static bool autoCorrectDimRefs();
     static int scrubCount();
+    static int hlrCacheSize();
+    static int maxViewThreads();
+    static int hatchCacheSize();
+    static int previewFaceCount();
+    static double previewDeflection();
 
     static double svgHatchFactor();
     static bool SectionUsePreviousCut();
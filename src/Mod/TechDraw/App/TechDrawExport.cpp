@@ -162,7 +162,12 @@ SVGOutput::SVGOutput()
 std::string SVGOutput::exportEdges(const TopoDS_Shape& input)
 {
     std::stringstream result;
+    exportEdges(input, result);
+    return result.str();
+}
 
+void SVGOutput::exportEdges(const TopoDS_Shape& input, std::ostream& result)
+{
     TopExp_Explorer edges(input, TopAbs_EDGE);
     for (int i = 1 ; edges.More(); edges.Next(), i++) {
         const TopoDS_Edge& edge = TopoDS::Edge(edges.Current());
@@ -191,8 +196,6 @@ std::string SVGOutput::exportEdges(const TopoDS_Shape& input)
             printGeneric(adapt, i, result);
         }
     }
-
-    return result.str();
 }
 
 void SVGOutput::printCircle(const BRepAdaptor_Curve& c, std::ostream& out)
@@ -260,10 +263,10 @@ void SVGOutput::printEllipse(const BRepAdaptor_Curve& c, int id, std::ostream& o
     Standard_Real angle = xaxis.AngleWithRef(gp_Dir(1, 0,0), gp_Dir(0, 0,-1));
     angle = Base::toDegrees<double>(angle);
     if (fabs(l-f) > 1.0 && s.SquareDistance(e) < 0.001) {
-        out << "<g transform = \"rotate(" << angle << ", " << p.X() << ", " << p.Y() << ")\">" << std::endl;
+        out << "<g transform = \"rotate(" << angle << ", " << p.X() << ", " << p.Y() << ")\">" << '\n';
         out << "<ellipse cx =\"" << p.X() << "\" cy =\""
-            << p.Y() << "\" rx =\"" << r1 << "\"  ry =\"" << r2 << "\"/>" << std::endl;
-        out << "</g>" << std::endl;
+            << p.Y() << "\" rx =\"" << r1 << "\"  ry =\"" << r2 << "\"/>" << '\n';
+        out << "</g>" << '\n';
     }
     // arc of ellipse
     else {
@@ -272,7 +275,7 @@ void SVGOutput::printEllipse(const BRepAdaptor_Curve& c, int id, std::ostream& o
         out << "<path d=\"M" << s.X() <<  " " << s.Y()
             << " A" << r1 << " " << r2 << " "
             << angle << " " << las << " " << swp << " "
-            << e.X() << " " << e.Y() << "\" />" << std::endl;
+            << e.X() << " " << e.Y() << "\" />" << '\n';
     }
 }
 
@@ -419,7 +422,7 @@ void SVGOutput::printGeneric(const BRepAdaptor_Curve& bac, int id, std::ostream&
             out << c << " " << nodes(i).X() << " " << nodes(i).Y()<< " " ;
             c = 'L';
         }
-        out << "\" />" << endl;
+        out << "\" />" << '\n';
     } else if (bac.GetType() == GeomAbs_Line) {
         //BRep_Tool::Polygon3D assumes the edge has polygon representation - ie already been "tessellated"
         //this is not true for all edges, especially "floating edges"
@@ -432,7 +435,7 @@ void SVGOutput::printGeneric(const BRepAdaptor_Curve& bac, int id, std::ostream&
         out << c << " " << s.X() << " " << s.Y()<< " " ;
         c = 'L';
         out << c << " " << e.X() << " " << e.Y()<< " " ;
-        out << "\" />" << endl;
+        out << "\" />" << '\n';
     }
 }
 
@@ -445,7 +448,12 @@ DXFOutput::DXFOutput()
 std::string DXFOutput::exportEdges(const TopoDS_Shape& input)
 {
     std::stringstream result;
+    exportEdges(input, result);
+    return result.str();
+}
 
+void DXFOutput::exportEdges(const TopoDS_Shape& input, std::ostream& result)
+{
     TopExp_Explorer edges(input, TopAbs_EDGE);
     for (int i = 1 ; edges.More(); edges.Next(), i++) {
         const TopoDS_Edge& edge = TopoDS::Edge(edges.Current());
@@ -464,16 +472,14 @@ std::string DXFOutput::exportEdges(const TopoDS_Shape& input)
             printGeneric(adapt, i, result);
         }
     }
-
-    return result.str();
 }
 
 void DXFOutput::printHeader( std::ostream& out)
 {
-        out	 << 0          << endl;
-        out << "SECTION"  << endl;
-        out << 2          << endl;
-        out << "ENTITIES" << endl;
+        out	 << 0          << '\n';
+        out << "SECTION"  << '\n';
+        out << 2          << '\n';
+        out << "ENTITIES" << '\n';
 }
 
 void DXFOutput::printCircle(const BRepAdaptor_Curve& c, std::ostream& out)
@@ -497,22 +503,22 @@ void DXFOutput::printCircle(const BRepAdaptor_Curve& c, std::ostream& out)
     if (s.SquareDistance(e) < 0.001) {
         //out << "<circle cx =\"" << p.X() << "\" cy =\""
             //<< p.Y() << "\" r =\"" << r << "\" />";
-	    out << 0			<< endl;
-	    out << "CIRCLE"		<< endl;
-	    out << 8			<< endl;	// Group code for layer name
-	    out << "sheet_layer"	<< endl;	// Layer number
-        out << "100"        << endl;
-        out << "AcDbEntity" << endl;
-        out << "100"        << endl;
-        out << "AcDbCircle"   << endl;
-	    out << 10			<< endl;	// Centre X
-	    out << p.X()		<< endl;	// X in WCS coordinates
-	    out << 20			<< endl;
-	    out << p.Y()		<< endl;	// Y in WCS coordinates
-	    out << 30			<< endl;
-	    out << 0		<< endl;	// Z in WCS coordinates-leaving flat
-	    out << 40			<< endl;	//
-	    out << r		<< endl;	// Radius
+	    out << 0			<< '\n';
+	    out << "CIRCLE"		<< '\n';
+	    out << 8			<< '\n';	// Group code for layer name
+	    out << "sheet_layer"	<< '\n';	// Layer number
+        out << "100"        << '\n';
+        out << "AcDbEntity" << '\n';
+        out << "100"        << '\n';
+        out << "AcDbCircle"   << '\n';
+	    out << 10			<< '\n';	// Centre X
+	    out << p.X()		<< '\n';	// X in WCS coordinates
+	    out << 20			<< '\n';
+	    out << p.Y()		<< '\n';	// Y in WCS coordinates
+	    out << 30			<< '\n';
+	    out << 0		<< '\n';	// Z in WCS coordinates-leaving flat
+	    out << 40			<< '\n';	//
+	    out << r		<< '\n';	// Radius
                                 }
 
 
@@ -539,28 +545,28 @@ void DXFOutput::printCircle(const BRepAdaptor_Curve& c, std::ostream& out)
 		double temp = start_angle;
 		start_angle = end_angle;
 		end_angle = temp;}
-	out << 0			<< endl;
-	out << "ARC"		<< endl;
-	out << 8			<< endl;	// Group code for layer name
-	out << "sheet_layer"	<< endl;	// Layer number
-    out << "100"        << endl;
-    out << "AcDbEntity" << endl;
-    out << "100"        << endl;
-    out << "AcDbCircle" << endl;
-	out << 10			<< endl;	// Centre X
-	out << p.X()		<< endl;	// X in WCS coordinates
-	out << 20			<< endl;
-	out << p.Y()		<< endl;	// Y in WCS coordinates
-	out << 30			<< endl;
-	out << 0		<< endl;	// Z in WCS coordinates
-	out << 40			<< endl;	//
-	out << r		<< endl;	// Radius
-    out << "100"        << endl;
-    out << "AcDbArc" << endl;
-	out << 50			<< endl;
-	out << start_angle	<< endl;	// Start angle
-	out << 51			<< endl;
-	out << end_angle	<< endl;	// End angle
+	out << 0			<< '\n';
+	out << "ARC"		<< '\n';
+	out << 8			<< '\n';	// Group code for layer name
+	out << "sheet_layer"	<< '\n';	// Layer number
+    out << "100"        << '\n';
+    out << "AcDbEntity" << '\n';
+    out << "100"        << '\n';
+    out << "AcDbCircle" << '\n';
+	out << 10			<< '\n';	// Centre X
+	out << p.X()		<< '\n';	// X in WCS coordinates
+	out << 20			<< '\n';
+	out << p.Y()		<< '\n';	// Y in WCS coordinates
+	out << 30			<< '\n';
+	out << 0		<< '\n';	// Z in WCS coordinates
+	out << 40			<< '\n';	//
+	out << r		<< '\n';	// Radius
+    out << "100"        << '\n';
+    out << "AcDbArc" << '\n';
+	out << 50			<< '\n';
+	out << start_angle	<< '\n';	// Start angle
+	out << 51			<< '\n';
+	out << end_angle	<< '\n';	// End angle
     }
 }
 
@@ -609,32 +615,32 @@ void DXFOutput::printEllipse(const BRepAdaptor_Curve& c, int /*id*/, std::ostrea
 		start_angle = end_angle;
 		end_angle = temp;
 	}
-	out << 0			<< endl;
-	out << "ELLIPSE"		<< endl;
-	out << 8			<< endl;	// Group code for layer name
-	out << "sheet_layer"	<< endl;	// Layer number
-    out << "100"        << endl;
-    out << "AcDbEntity" << endl;
-    out << "100"        << endl;
-    out << "AcDbEllipse"   << endl;
-	out << 10			<< endl;	// Centre X
-	out << p.X()		<< endl;	// X in WCS coordinates
-	out << 20			<< endl;
-	out << p.Y()		<< endl;	// Y in WCS coordinates
-	out << 30			<< endl;
-	out << 0		<< endl;	// Z in WCS coordinates
-	out << 11			<< endl;	//
-	out << major_x		<< endl;	// Major X
-	out << 21			<< endl;
-	out << major_y		<< endl;	// Major Y
-	out << 31			<< endl;
-	out << 0		<< endl;	// Major Z
-	out << 40			<< endl;	//
-	out << ratio		<< endl;	// Ratio
-	out << 41		<< endl;
-	out << start_angle	<< endl;	// Start angle
-	out << 42		<< endl;
-	out << end_angle	<< endl;	// End angle
+	out << 0			<< '\n';
+	out << "ELLIPSE"		<< '\n';
+	out << 8			<< '\n';	// Group code for layer name
+	out << "sheet_layer"	<< '\n';	// Layer number
+    out << "100"        << '\n';
+    out << "AcDbEntity" << '\n';
+    out << "100"        << '\n';
+    out << "AcDbEllipse"   << '\n';
+	out << 10			<< '\n';	// Centre X
+	out << p.X()		<< '\n';	// X in WCS coordinates
+	out << 20			<< '\n';
+	out << p.Y()		<< '\n';	// Y in WCS coordinates
+	out << 30			<< '\n';
+	out << 0		<< '\n';	// Z in WCS coordinates
+	out << 11			<< '\n';	//
+	out << major_x		<< '\n';	// Major X
+	out << 21			<< '\n';
+	out << major_y		<< '\n';	// Major Y
+	out << 31			<< '\n';
+	out << 0		<< '\n';	// Major Z
+	out << 40			<< '\n';	//
+	out << ratio		<< '\n';	// Ratio
+	out << 41		<< '\n';
+	out << start_angle	<< '\n';	// Start angle
+	out << 42		<< '\n';
+	out << end_angle	<< '\n';	// End angle
 }
 
 void DXFOutput::printBSpline(const BRepAdaptor_Curve& c, int id, std::ostream& out) //Not even close yet- DF
@@ -673,31 +679,31 @@ void DXFOutput::printBSpline(const BRepAdaptor_Curve& c, int id, std::ostream& o
         spline->Poles(poles);
 
 
-        str << 0 << endl
-            << "SPLINE" << endl
-            << 8 << endl // Group code for layer name
-            << "sheet_layer" << endl // Layer name
-            << "100"        << endl
-            << "AcDbEntity" << endl
-            << "100"        << endl
-            << "AcDbSpline"   << endl
-            << 70 << endl
-            << spline->IsRational()*4 << endl //flags
-            << 71 << endl << spline->Degree() << endl
-            << 72 << endl << knotsequence.Length() << endl
-            << 73 << endl << poles.Length() << endl
-            << 74 << endl << 0 << endl; //fitpoints
+        str << 0 << '\n'
+            << "SPLINE" << '\n'
+            << 8 << '\n' // Group code for layer name
+            << "sheet_layer" << '\n' // Layer name
+            << "100"        << '\n'
+            << "AcDbEntity" << '\n'
+            << "100"        << '\n'
+            << "AcDbSpline"   << '\n'
+            << 70 << '\n'
+            << spline->IsRational()*4 << '\n' //flags
+            << 71 << '\n' << spline->Degree() << '\n'
+            << 72 << '\n' << knotsequence.Length() << '\n'
+            << 73 << '\n' << poles.Length() << '\n'
+            << 74 << '\n' << 0 << '\n'; //fitpoints
 
         for (int i = knotsequence.Lower() ; i <= knotsequence.Upper(); i++) {
-            str << 40 << endl << knotsequence(i) << endl;
+            str << 40 << '\n' << knotsequence(i) << '\n';
         }
         for (int i = poles.Lower(); i <= poles.Upper(); i++) {
             gp_Pnt pole = poles(i);
-            str << 10 << endl << pole.X() << endl
-                << 20 << endl << pole.Y() << endl
-                << 30 << endl << pole.Z() << endl;
+            str << 10 << '\n' << pole.X() << '\n'
+                << 20 << '\n' << pole.Y() << '\n'
+                << 30 << '\n' << pole.Z() << '\n';
             if (spline->IsRational()) {
-                str << 41 << endl << spline->Weight(i) << endl;
+                str << 41 << '\n' << spline->Weight(i) << '\n';
             }
         }
 
@@ -721,24 +727,24 @@ void DXFOutput::printGeneric(const BRepAdaptor_Curve& c, int /*id*/, std::ostrea
     gp_Vec VE;
     c.D1(uEnd, PE, VE);
 
-    out << "0"			<< endl;
-    out << "LINE"		<< endl;
-    out << "8"			<< endl;	// Group code for layer name
-    out << "sheet_layer" << endl; // Layer name
-    out << "100"        << endl;
-    out << "AcDbEntity" << endl;
-    out << "100"        << endl;
-    out << "AcDbLine"   << endl;
-    out << "10"			<< endl;	// Start point of line
-    out << PS.X()		<< endl;	// X in WCS coordinates
-    out << "20"			<< endl;
-    out << PS.Y()		<< endl;	// Y in WCS coordinates
-    out << "30"			<< endl;
-    out << "0"		<< endl;	// Z in WCS coordinates
-    out << "11"			<< endl;	// End point of line
-    out << PE.X()		<< endl;	// X in WCS coordinates
-    out << "21"			<< endl;
-    out << PE.Y()		<< endl;	// Y in WCS coordinates
-    out << "31"			<< endl;
-    out << "0"		<< endl;	// Z in WCS coordinates
+    out << "0"			<< '\n';
+    out << "LINE"		<< '\n';
+    out << "8"			<< '\n';	// Group code for layer name
+    out << "sheet_layer" << '\n'; // Layer name
+    out << "100"        << '\n';
+    out << "AcDbEntity" << '\n';
+    out << "100"        << '\n';
+    out << "AcDbLine"   << '\n';
+    out << "10"			<< '\n';	// Start point of line
+    out << PS.X()		<< '\n';	// X in WCS coordinates
+    out << "20"			<< '\n';
+    out << PS.Y()		<< '\n';	// Y in WCS coordinates
+    out << "30"			<< '\n';
+    out << "0"		<< '\n';	// Z in WCS coordinates
+    out << "11"			<< '\n';	// End point of line
+    out << PE.X()		<< '\n';	// X in WCS coordinates
+    out << "21"			<< '\n';
+    out << PE.Y()		<< '\n';	// Y in WCS coordinates
+    out << "31"			<< '\n';
+    out << "0"		<< '\n';	// Z in WCS coordinates
 }
@@ -25,6 +25,7 @@
 #ifndef TECHDRAW_EXPORT_H
 #define TECHDRAW_EXPORT_H
 
+#include <iosfwd>
 #include <string>
 #include <TopoDS_Edge.hxx>
 
@@ -51,6 +52,8 @@ class TechDrawExport SVGOutput : public TechDrawOutput
 public:
     SVGOutput();
     std::string exportEdges(const TopoDS_Shape&);
+    /// Writes the edges straight to \a out, without building a string first
+    void exportEdges(const TopoDS_Shape&, std::ostream& out);
 
 private:
     void printCircle(const BRepAdaptor_Curve&, std::ostream&);
@@ -66,6 +69,8 @@ class TechDrawExport DXFOutput : public TechDrawOutput
 public:
     DXFOutput();
     std::string exportEdges(const TopoDS_Shape&);
+    /// Writes the edges straight to \a out, without building a string first
+    void exportEdges(const TopoDS_Shape&, std::ostream& out);
 
 private:
     void printHeader(std::ostream& out);
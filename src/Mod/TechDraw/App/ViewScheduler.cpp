@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+#include <QFutureInterface>
+#include <QRunnable>
+#include <QThread>
+#endif
+
+#include <Base/Console.h>
+#include <Base/Exception.h>
+
+#include "DrawView.h"
+#include "Preferences.h"
+#include "ViewScheduler.h"
+
+using namespace TechDraw;
+
+namespace
+{
+
+class ViewJob: public QRunnable
+{
+public:
+    explicit ViewJob(std::function<void()> job)
+        : m_job(std::move(job))
+    {
+        // the future is running from the start, so callers can tell it from a finished one
+        m_promise.reportStarted();
+    }
+
+    QFuture<void> future()
+    {
+        return m_promise.future();
+    }
+
+    //! the progress is 1 once the job has started, it is not set any more after a cancel
+    void run() override
+    {
+        m_promise.setProgressValue(1);
+        if (m_promise.progressValue() == 1) {
+            try {
+                m_job();
+            }
+            catch (const Base::Exception& e) {
+                e.ReportException();
+            }
+            catch (const std::exception& e) {
+                Base::Console().Error("TechDraw - error in a view computation - %s\n", e.what());
+            }
+            catch (...) {
+                Base::Console().Error("TechDraw - unknown error in a view computation\n");
+            }
+        }
+        m_promise.reportFinished();
+    }
+
+private:
+    std::function<void()> m_job;
+    QFutureInterface<void> m_promise;
+};
+
+}// namespace
+
+ViewScheduler::ViewScheduler()
+    : m_activePage(nullptr)
+{
+    // every running job holds the shapes of its view, so the limit bounds the memory
+    int threads = Preferences::maxViewThreads();
+    if (threads <= 0) {
+        threads = QThread::idealThreadCount();
+    }
+    m_pool.setMaxThreadCount(threads);
+}
+
+ViewScheduler& ViewScheduler::instance()
+{
+    static ViewScheduler scheduler;
+    return scheduler;
+}
+
+QFuture<void> ViewScheduler::run(const DrawView* view, std::function<void()> job)
+{
+    const int backgroundPriority = 0;
+    const int activePriority = 1;
+    int priority = backgroundPriority;
+    if (view && m_activePage && view->findParentPage() == m_activePage) {
+        priority = activePriority;
+    }
+
+    auto runnable = new ViewJob(std::move(job));
+    QFuture<void> future = runnable->future();
+    m_pool.start(runnable, priority);
+    return future;
+}
+
+bool ViewScheduler::cancel(QFuture<void>& future)
+{
+    // a running job is not interrupted, its result is just no longer wanted
+    future.cancel();
+    return future.progressValue() == 0;
+}
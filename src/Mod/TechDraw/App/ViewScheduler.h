@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/***************************************************************************
+ *   Copyright (c) 2026 FreeCAD Project Association                        *
+ *                                                                         *
+ *   This file is part of FreeCAD.                                         *
+ *                                                                         *
+ *   FreeCAD is free software: you can redistribute it and/or modify it    *
+ *   under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1 of the  *
+ *   License, or (at your option) any later version.                       *
+ *                                                                         *
+ *   FreeCAD is distributed in the hope that it will be useful, but        *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU      *
+ *   Lesser General Public License for more details.                       *
+ *                                                                         *
+ *   You should have received a copy of the GNU Lesser General Public      *
+ *   License along with FreeCAD. If not, see                               *
+ *   <https://www.gnu.org/licenses/>.                                      *
+ *                                                                         *
+ **************************************************************************/
+
+#ifndef TECHDRAW_VIEWSCHEDULER_H
+#define TECHDRAW_VIEWSCHEDULER_H
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include <atomic>
+#include <functional>
+
+#include <QFuture>
+#include <QThreadPool>
+
+//! runs the long computations of the views (hidden line removal, face finding, section and
+//  detail cuts) in a thread pool reserved for TechDraw.
+
+namespace TechDraw
+{
+class DrawPage;
+class DrawView;
+
+class TechDrawExport ViewScheduler
+{
+public:
+    static ViewScheduler& instance();
+
+    //! queue job on behalf of view. Jobs of the views on the active page run before the
+    //! others. The returned future finishes when the job is done or has been cancelled.
+    QFuture<void> run(const DrawView* view, std::function<void()> job);
+    //! cancel the job of future. Returns true if the job has not started and never will.
+    static bool cancel(QFuture<void>& future);
+
+    //! the page shown to the user, its views have priority
+    void setActivePage(const DrawPage* page) { m_activePage = page; }
+    const DrawPage* getActivePage() const { return m_activePage; }
+
+private:
+    ViewScheduler();
+
+    QThreadPool m_pool;
+    std::atomic<const DrawPage*> m_activePage;
+};
+
+}//namespace TechDraw
+
+#endif
@@ -30,6 +30,7 @@
 #include <Gui/Application.h>
 #include <Gui/Language/Translator.h>
 #include <Gui/WidgetFactory.h>
+#include <Mod/TechDraw/App/ViewScheduler.h>
 
 #include "DlgPrefsTechDrawAdvancedImp.h"
 #include "DlgPrefsTechDrawAnnotationImp.h"
@@ -135,6 +136,13 @@ PyMOD_INIT_FUNC(TechDrawGui)
     TechDrawGui::MDIViewPage::init();
     TechDrawGui::MDIViewPagePy::init_type();
 
+    // the views on the page in front are computed first
+    Gui::Application::Instance->signalActivateView.connect([](const Gui::MDIView* view) {
+        if (auto pageView = dynamic_cast<const TechDrawGui::MDIViewPage*>(view)) {
+            TechDraw::ViewScheduler::instance().setActivePage(pageView->getPage());
+        }
+    });
+
     TechDrawGui::ViewProviderPage::init();
     TechDrawGui::ViewProviderDrawingView::init();
 
@@ -98,7 +98,7 @@ public:
     void setDocumentName(const std::string&);
 
     PyObject* getPyObject() override;
-    TechDraw::DrawPage * getPage() { return m_vpPage->getDrawPage(); }
+    TechDraw::DrawPage * getPage() const { return m_vpPage->getDrawPage(); }
     ViewProviderPage* getViewProviderPage() {return m_vpPage;}
 
     void setTabText(std::string tabText);
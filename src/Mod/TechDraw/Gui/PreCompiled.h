@@ -45,6 +45,7 @@
 
 // STL
 #include <algorithm>
+#include <map>
 #include <regex>
 #include <string>
 #include <vector>
@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+#include <map>
 
 #include <QPainterPath>
 #include <QKeyEvent>
@@ -272,6 +273,23 @@ void QGIViewPart::drawAllFaces(void)
     std::vector<TechDraw::DrawHatch*> regularHatches = dvp->getHatches();
     std::vector<TechDraw::DrawGeomHatch*> geomHatches = dvp->getGeomHatches();
     const std::vector<TechDraw::FacePtr>& faceGeoms = dvp->getFaceGeometry();
+
+    // trim the pattern of each geometric hatch to all its faces at once
+    std::map<TechDraw::DrawGeomHatch*, std::vector<int>> geomHatchFaces;
+    for (int i = 0; i < int(faceGeoms.size()); i++) {
+        TechDraw::DrawGeomHatch* fGeom = faceIsGeomHatched(i, geomHatches);
+        if (fGeom) {
+            geomHatchFaces[fGeom].push_back(i);
+        }
+    }
+    std::map<int, std::vector<LineSet>> geomHatchLines;
+    for (auto& [fGeom, faces] : geomHatchFaces) {
+        std::vector<std::vector<LineSet>> lines = fGeom->getTrimmedLines(faces);
+        for (std::size_t i = 0; i < faces.size(); i++) {
+            geomHatchLines[faces[i]] = std::move(lines[i]);
+        }
+    }
+
     int iFace(0);
     for (auto& face : faceGeoms) {
         QGIFace* newFace = drawFace(face, iFace);
@@ -286,7 +304,7 @@ void QGIViewPart::drawAllFaces(void)
             // geometric hatch (from PAT hatch specification)
             newFace->isHatched(true);
             newFace->setFillMode(QGIFace::GeomHatchFill);
-            std::vector<LineSet> lineSets = fGeom->getTrimmedLines(iFace);
+            std::vector<LineSet>& lineSets = geomHatchLines[iFace];
             if (!lineSets.empty()) {
                 // this face has geometric hatch lines
                 newFace->clearLineSets();
@@ -636,6 +636,44 @@ class DocumentBasicCases(unittest.TestCase):
         self.assertIn("Test", self.Doc.Python.PropertiesList)
         self.assertIn("Test", self.Doc.Link.PropertiesList)
 
+    def testMemoryReport(self):
+        obj = self.Doc.addObject("App::FeaturePython", "Python")
+        obj.addProperty("App::PropertyString", "Text")
+        obj.Text = "x" * 1000
+        report = FreeCAD.getMemoryReport(True)
+        doc = report["Documents"][self.Doc.Name]
+        entry = doc["Objects"]["Python"]
+        self.assertEqual(entry["Type"], "App::FeaturePython")
+        self.assertGreaterEqual(entry["Properties"]["Text"], 1000)
+        self.assertGreaterEqual(entry["Total"], entry["Properties"]["Text"])
+        self.assertGreaterEqual(doc["Total"], entry["Total"])
+        self.assertGreaterEqual(report["Categories"]["App::PropertyString"], 1000)
+        report = FreeCAD.getMemoryReport()
+        self.assertNotIn("Properties", report["Documents"][self.Doc.Name]["Objects"]["Python"])
+
+    def testLargeLinkArray(self):
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Link")
+        param.SetInt("MaxElementObjects", 10)
+        try:
+            test = self.Doc.addObject("App::FeaturePython", "Python")
+            link = self.Doc.addObject("App::Link", "Link")
+            link.LinkedObject = test
+            link.ElementCount = 5
+            self.assertTrue(link.ShowElement)
+            self.assertEqual(len(link.ElementList), 5)
+
+            # more elements than the limit are kept in the lists
+            link.ElementCount = 20
+            self.assertFalse(link.ShowElement)
+            self.assertEqual(len(link.ElementList), 0)
+            self.assertEqual(len(link.PlacementList), 20)
+
+            # unless the user asks for the objects
+            link.ShowElement = True
+            self.assertEqual(len(link.ElementList), 20)
+        finally:
+            param.RemoveInt("MaxElementObjects")
+
     def testNoProxy(self):
         test = self.Doc.addObject("App::DocumentObject", "Object")
         test.addProperty("App::PropertyPythonObject", "Dictionary")
@@ -727,6 +765,21 @@ class DocumentSaveRestoreCases(unittest.TestCase):
         self.assertTrue(self.Doc.Label_1.TypeTransient == 4711)
         self.assertTrue(self.Doc == FreeCAD.getDocument(self.Doc.Name))
 
+    def testSaveAndRestoreLongLists(self):
+        # long integer and bool lists are saved in binary files
+        SaveName = self.TempPath + os.sep + "SaveRestoreTests.FCStd"
+        integers = [i * 7 - 1000 for i in range(1000)]
+        bools = [i % 3 == 0 for i in range(1000)]
+        self.Doc.Label_1.IntegerList = integers
+        self.Doc.Label_1.BoolList = bools
+        self.Doc.Label_2.IntegerList = [1, 2, 3]
+        self.Doc.saveAs(SaveName)
+        FreeCAD.closeDocument("SaveRestoreTests")
+        self.Doc = FreeCAD.open(SaveName)
+        self.assertEqual(self.Doc.Label_1.IntegerList, integers)
+        self.assertEqual(list(self.Doc.Label_1.BoolList), bools)
+        self.assertEqual(self.Doc.Label_2.IntegerList, [1, 2, 3])
+
     def testRestore(self):
         Doc = FreeCAD.newDocument("RestoreTests")
         Doc.addObject("App::FeatureTest", "Label_1")
@@ -103,6 +103,28 @@ int ZipInputStreambuf::underflow() {
 }
 
 
+std::streamsize ZipInputStreambuf::xsgetn( char *s, std::streamsize n ) {
+  if ( ! _open_entry || _curr_entry.getMethod() != STORED )
+    return InflateInputStreambuf::xsgetn( s, n ) ;
+
+  // First hand out what is left in the get area
+  std::streamsize done = std::min< std::streamsize >( egptr() - gptr(), n ) ;
+  if ( done > 0 ) {
+    std::copy( gptr(), gptr() + done, s ) ;
+    gbump( static_cast< int >( done ) ) ;
+  }
+
+  // then read the rest of the request straight from the archive
+  std::streamsize num_b = std::min< std::streamsize >( _remain, n - done ) ;
+  if ( num_b > 0 ) {
+    std::streamsize g = _inbuf->sgetn( s + done, num_b ) ;
+    _remain -= static_cast< int >( g ) ;
+    done += g ;
+  }
+  return done ;
+}
+
+
 // FIXME: We need to check somew
 //  
 //    // gp_bitfield bit 3 is one, if the length of the zip entry
@@ -43,6 +43,9 @@ public:
   virtual ~ZipInputStreambuf() ;
 protected:
   virtual int underflow() ;
+  /** For STORED entries bulk reads are copied directly from the
+      underlying streambuf instead of going through the get area. */
+  virtual std::streamsize xsgetn( char *s, std::streamsize n ) ;
 private:
   bool _open_entry ;
   ZipLocalEntry _curr_entry ;
@@ -49,6 +49,18 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes an entry whose data has already been compressed, e.g. on
+      another thread.
+      @param entry the entry to write.
+      @param data the compressed data (raw deflate stream without zlib
+      header if method is DEFLATED).
+      @param size the size of the compressed data.
+      @param crc the crc32 of the uncompressed data.
+      @param uncompressed_size the size of the uncompressed data.
+      @param method the method used to compress the data. */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data, uint32 size,
+                    uint32 crc, uint32 uncompressed_size, StorageMethod method ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -5,6 +5,7 @@
 
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/FeatureTest.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
@@ -94,4 +95,179 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, recomputeOnlyTouchedAndDependentObjects)
+{
+    // Arrange
+    auto base = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Base"));
+    auto dependent =
+        static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Dependent"));
+    auto other = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Other"));
+    dependent->Source1.setValue(base);
+    doc()->recompute();
+    base->Integer.setValue(1);
+
+    // Act
+    int count = doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(base->ExecCount.getValue(), 2);
+    EXPECT_EQ(dependent->ExecCount.getValue(), 2);
+    EXPECT_EQ(other->ExecCount.getValue(), 1);
+}
+
+TEST_F(DocumentTest, recomputeFollowsLinkChanges)
+{
+    // Arrange
+    auto base = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Base"));
+    auto other = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Other"));
+    doc()->recompute();
+    other->Source1.setValue(base);
+    doc()->recompute();
+    base->Integer.setValue(1);
+
+    // Act
+    int count = doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(count, 2);
+    EXPECT_EQ(other->ExecCount.getValue(), 3);
+}
+
+TEST_F(DocumentTest, recomputeProfileRecordsObjects)
+{
+    // Arrange
+    auto base = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Base"));
+    auto dependent =
+        static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Dependent"));
+    dependent->Source1.setValue(base);
+    doc()->recompute();
+    doc()->clearRecomputeProfile();
+    base->Integer.setValue(1);
+
+    // Act
+    doc()->recompute();
+    auto profile = doc()->getRecomputeProfile();
+
+    // Assert
+    ASSERT_EQ(profile.size(), 2);
+    for (const auto& entry : profile) {
+        EXPECT_EQ(entry.count, 1);
+        EXPECT_GE(entry.time, 0.0);
+        if (entry.name == "Base") {
+            EXPECT_EQ(entry.reason, "Touched: Integer");
+        }
+        else {
+            EXPECT_EQ(entry.name, "Dependent");
+            EXPECT_EQ(entry.reason, "Dependency");
+        }
+    }
+}
+
+TEST_F(DocumentTest, undoRedoListElementChanges)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Feature"));
+    feature->FloatList.setValues({1.0, 2.0, 3.0});
+    doc()->commitTransaction();
+
+    // Act
+    doc()->openTransaction("Edit");
+    feature->FloatList.set1Value(1, 5.0);
+    feature->FloatList.set1Value(1, 6.0);
+    feature->FloatList.set1Value(3, 7.0);
+    doc()->commitTransaction();
+    doc()->undo();
+    auto undone = feature->FloatList.getValues();
+    doc()->redo();
+    auto redone = feature->FloatList.getValues();
+
+    // Assert
+    EXPECT_EQ(undone, std::vector<double>({1.0, 2.0, 3.0}));
+    EXPECT_EQ(redone, std::vector<double>({1.0, 6.0, 3.0, 7.0}));
+    EXPECT_GT(doc()->getUndoMemSize(), 0U);
+}
+
+TEST_F(DocumentTest, undoMemoryBudgetSpillsToDisk)
+{
+    // Arrange
+    doc()->setUndoMode(1);
+    // room for one list in memory only
+    doc()->setUndoLimit(100000);
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Feature"));
+    doc()->commitTransaction();
+    std::vector<std::vector<double>> values;
+    for (int i = 0; i < 3; i++) {
+        values.emplace_back(10000, double(i));
+        doc()->openTransaction("Edit");
+        feature->FloatList.setValues(values.back());
+        doc()->commitTransaction();
+    }
+    auto size = doc()->getUndoMemSize();
+
+    // Act
+    doc()->undo();
+    auto undone1 = feature->FloatList.getValues();
+    doc()->undo();
+    auto undone2 = feature->FloatList.getValues();
+    doc()->redo();
+    auto redone = feature->FloatList.getValues();
+
+    // Assert
+    EXPECT_LT(size, 100000U);
+    EXPECT_EQ(undone1, values[1]);
+    EXPECT_EQ(undone2, values[0]);
+    EXPECT_EQ(redone, values[1]);
+}
+
+TEST_F(DocumentTest, changeBatchCoalescesNotifications)
+{
+    // Arrange
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Feature"));
+    auto removed = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Removed"));
+    int changed = 0;
+    int skipped = 0;
+    App::ObjectChanges batched;
+    auto connChanged = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property& prop) {
+            if (doc()->isFlushingChangeBatch()) {
+                ++skipped;
+                return;
+            }
+            EXPECT_EQ(&obj, feature);
+            EXPECT_EQ(&prop, &feature->Integer);
+            ++changed;
+        });
+    auto connBatch = doc()->signalChangedObjects.connect(
+        [&](const App::Document&, const App::ObjectChanges& changes) {
+            batched = changes;
+        });
+
+    // Act
+    int changedInBatch = 0;
+    {
+        App::DocumentChangeBatch batch(doc());
+        for (int i = 0; i < 10; i++) {
+            feature->Integer.setValue(i);
+            removed->Integer.setValue(i);
+        }
+        {
+            App::DocumentChangeBatch nested(doc());
+            feature->Integer.setValue(10);
+        }
+        doc()->removeObject(removed->getNameInDocument());
+        changedInBatch = changed + skipped;
+    }
+    feature->Integer.setValue(11);
+
+    // Assert
+    EXPECT_EQ(changedInBatch, 0);
+    ASSERT_EQ(batched.size(), 1U);
+    EXPECT_EQ(batched[0].first, feature);
+    EXPECT_EQ(batched[0].second, &feature->Integer);
+    EXPECT_EQ(skipped, 1);
+    EXPECT_EQ(changed, 1);
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -9,6 +9,7 @@
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/GeoFeatureGroupExtension.h>
+#include <App/Link.h>
 #include <Base/Interpreter.h>
 
 using namespace App;
@@ -155,4 +156,45 @@ TEST_F(DocumentObjectTest, getSubObjectList)
     EXPECT_EQ(sizesFlatten[1], strlen(fuseName) + strlen(boxName) + 2);
 }
 
+TEST_F(DocumentObjectTest, recursiveListsFollowLinkChanges)
+{
+    // Arrange
+    auto box {_doc->addObject("Part::Box")};
+    auto link1 {static_cast<App::Link*>(_doc->addObject("App::Link"))};
+    auto link2 {static_cast<App::Link*>(_doc->addObject("App::Link"))};
+    link1->LinkedObject.setValue(box);
+    link2->LinkedObject.setValue(link1);
+    auto sorted = [](std::vector<App::DocumentObject*> objs) {
+        std::sort(objs.begin(), objs.end());
+        return objs;
+    };
+
+    // Act
+    auto inList = sorted(box->getInListRecursive());
+    auto outList = sorted(link2->getOutListRecursive());
+    auto inLists = App::DocumentObject::getInListsRecursive({box, link1, link2});
+
+    // Assert
+    EXPECT_EQ(inList, sorted({link1, link2}));
+    EXPECT_EQ(outList, sorted({box, link1}));
+    ASSERT_EQ(inLists.size(), 3);
+    EXPECT_EQ(sorted(inLists[0]), inList);
+    EXPECT_EQ(inLists[1], std::vector<App::DocumentObject*> {link2});
+    EXPECT_TRUE(inLists[2].empty());
+
+    // Act
+    link2->LinkedObject.setValue(box);
+
+    // Assert
+    EXPECT_EQ(sorted(box->getInListRecursive()), sorted({link1, link2}));
+    EXPECT_TRUE(link1->getInListRecursive().empty());
+    EXPECT_EQ(link2->getOutListRecursive(), std::vector<App::DocumentObject*> {box});
+
+    // Act
+    _doc->removeObject(link2->getNameInDocument());
+
+    // Assert
+    EXPECT_EQ(box->getInListRecursive(), std::vector<App::DocumentObject*> {link1});
+}
+
 // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
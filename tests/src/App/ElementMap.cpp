@@ -553,4 +553,51 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
             return e.indexedName.toString() == "Pong2";
         }));
 }
+
+TEST_F(ElementMapTest, saveAndRestoreBinary)
+{
+    // Arrange
+    auto& app = App::GetApplication();
+    auto doc = app.getDocument(_docName.c_str());
+    LessComplexPart base(1L, "Box", _hasher);
+    LessComplexPart first(2L, "First", _hasher);
+    LessComplexPart second(3L, "Second", _hasher);
+    Data::ElementMap::MappedChildElements child =
+        {Data::IndexedName("Face", 1), 6, 0, 1L, base.elementMapPtr, QByteArray(":C1"), _sid};
+    first.elementMapPtr->addChildElements(first.Tag, {child});
+    second.elementMapPtr->addChildElements(second.Tag, {child});
+    app.signalStartSaveDocument(*doc, std::string());
+    first.elementMapPtr->beforeSave(_hasher);
+    second.elementMapPtr->beforeSave(_hasher);
+    std::stringstream firstStream;
+    std::stringstream secondStream;
+    first.elementMapPtr->saveBinary(firstStream);
+    second.elementMapPtr->saveBinary(secondStream);
+    app.signalFinishSaveDocument(*doc, std::string());
+
+    // Act
+    app.signalStartRestoreDocument(*doc);
+    auto firstRestored =
+        std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, firstStream);
+    auto secondRestored =
+        std::make_shared<Data::ElementMap>()->restoreBinary(_hasher, secondStream);
+    app.signalFinishRestoreDocument(*doc);
+
+    // Assert
+    auto expected = first.elementMapPtr->getAll();
+    auto result = firstRestored->getAll();
+    ASSERT_EQ(result.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(result[i].name, expected[i].name);
+        EXPECT_EQ(result[i].index, expected[i].index);
+    }
+    auto firstChildren = firstRestored->getChildElements();
+    auto secondChildren = secondRestored->getChildElements();
+    ASSERT_EQ(firstChildren.size(), 1);
+    ASSERT_EQ(secondChildren.size(), 1);
+    EXPECT_EQ(firstChildren[0].count, 6);
+    // the child map saved by both maps is restored only once
+    EXPECT_TRUE(firstChildren[0].elementMap);
+    EXPECT_EQ(firstChildren[0].elementMap, secondChildren[0].elementMap);
+}
 // NOLINTEND(readability-magic-numbers)
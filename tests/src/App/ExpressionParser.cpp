@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include "Base/Parameter.h"
 #include "Base/Quantity.h"
 
 #include "App/Application.h"
@@ -7,6 +8,8 @@
 #include "App/DocumentObject.h"
 #include "App/Expression.h"
 #include "App/ExpressionParser.h"
+#include "App/PropertyStandard.h"
+#include "App/PropertyUnits.h"
 
 #include "src/App/InitApplication.h"
 
@@ -117,4 +120,58 @@ TEST_F(ExpressionParserTest, isTokenAConstant)
     }
 }
 
+TEST_F(ExpressionParserTest, compiledEvaluationMatchesInterpreter)
+{
+    // Arrange
+    static_cast<App::PropertyLength*>(this_obj()->addDynamicProperty("App::PropertyLength", "TestLength"))->setValue(12.5);
+    static_cast<App::PropertyInteger*>(this_obj()->addDynamicProperty("App::PropertyInteger", "TestCount"))->setValue(7);
+    static_cast<App::PropertyFloat*>(this_obj()->addDynamicProperty("App::PropertyFloat", "TestFactor"))->setValue(0.25);
+    static_cast<App::PropertyBool*>(this_obj()->addDynamicProperty("App::PropertyBool", "TestFlag"))->setValue(true);
+    auto hGrp = App::GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Expression");
+    auto evaluate = [this](const char* text) -> std::string {
+        try {
+            std::unique_ptr<App::Expression> expression(App::ExpressionParser::parse(this_obj(), text));
+            std::unique_ptr<App::Expression> result(expression->eval());
+            return result->toString();
+        }
+        catch (Base::Exception& e) {
+            return std::string("error: ") + e.what();
+        }
+    };
+    std::array<const char*, 20> expressions {
+        "1 + 2 * 3",
+        "7 / 2",
+        "-7 % 3",
+        "7.5 % -2",
+        "2 ^ 10",
+        "2 ^ -1",
+        "2 ^ 62 * 4",
+        "1 / 0",
+        "1 mm + 2 cm",
+        "3 mm * 2 mm",
+        "10 mm % 3",
+        "1 mm + 1 s",
+        "1 < 2 ? 3 mm : 4",
+        "TestLength * 2 + 1 mm",
+        "TestCount * TestFactor",
+        "TestCount % 4 == 3 ? TestLength : 0 mm",
+        "TestFlag ? TestCount : -TestCount",
+        "TestFactor <= 0.25",
+        "sin(TestFactor) + TestCount",
+        "Placement.Base.x + TestCount",
+    };
+
+    for (const auto& text : expressions) {
+        // Act
+        hGrp->SetBool("CompiledEvaluation", true);
+        auto compiled = evaluate(text);
+        hGrp->SetBool("CompiledEvaluation", false);
+        auto interpreted = evaluate(text);
+
+        // Assert
+        EXPECT_EQ(compiled, interpreted) << "mismatch for '" << text << "'";
+    }
+    hGrp->RemoveBool("CompiledEvaluation");
+}
+
 // clang-format on
@@ -179,6 +179,36 @@ TEST_F(IndexedNameTest, byteArrayConstruction)
     EXPECT_EQ(indexedName.getIndex(), 42);
 }
 
+TEST_F(IndexedNameTest, stringViewConstruction)
+{
+    // Arrange
+    const char* text {"EDGE42xyz"};
+
+    // Act
+    auto indexedName = Data::IndexedName(std::string_view(text, 6));
+
+    // Assert
+    EXPECT_STREQ(indexedName.getType(), "EDGE");
+    EXPECT_EQ(indexedName.getIndex(), 42);
+}
+
+// Check that the types of the shape elements are predefined and never copied
+TEST_F(IndexedNameTest, predefinedTypeReusedMemoryCheck)
+{
+    // Arrange
+    std::string face1 {"Face1"};
+    std::string face2 {"Face2"};
+
+    // Act
+    auto indexedName1 = Data::IndexedName(face1.c_str());
+    auto indexedName2 = Data::IndexedName(std::string_view(face2));
+
+    // Assert
+    EXPECT_STREQ(indexedName1.getType(), "Face");
+    EXPECT_EQ(indexedName1.getType(), indexedName2.getType());
+    EXPECT_NE(indexedName1.getType(), face1.c_str());
+}
+
 TEST_F(IndexedNameTest, copyConstruction)
 {
     // Arrange
@@ -958,7 +958,26 @@ TEST(MappedName, hash)
     Data::MappedName mappedName(Data::MappedName("TEST"), "POSTFIXTEST");
 
     // Act & Assert
-    EXPECT_EQ(mappedName.hash(), qHash(QByteArray("TEST"), qHash(QByteArray("POSTFIXTEST"))));
+    EXPECT_EQ(mappedName.hash(), Data::MappedName("TESTPOSTFIXTEST").hash());
+    EXPECT_NE(mappedName.hash(), Data::MappedName("TESTPOSTFIXTESU").hash());
+}
+
+TEST(MappedName, compareSplit)
+{
+    // Arrange
+    Data::MappedName mappedName1(Data::MappedName("TEST"), "POSTFIX");
+    Data::MappedName mappedName2(Data::MappedName("TESTPOST"), "FIX");
+    Data::MappedName mappedName3(Data::MappedName("TESTPOSTFIX"));
+    Data::MappedName mappedName4(Data::MappedName("TES"), "TPOSTFIY");
+    Data::MappedName mappedName5(Data::MappedName("TESTPOST"), "FI");
+
+    // Act & Assert
+    EXPECT_EQ(mappedName1.compare(mappedName2), 0);
+    EXPECT_EQ(mappedName2.compare(mappedName3), 0);
+    EXPECT_EQ(mappedName1.compare(mappedName4), -1);
+    EXPECT_EQ(mappedName4.compare(mappedName1), 1);
+    EXPECT_EQ(mappedName1.compare(mappedName5), 1);
+    EXPECT_EQ(mappedName5.compare(mappedName1), -1);
 }
 
 // NOLINTEND(readability-magic-numbers)
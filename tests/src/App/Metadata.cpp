@@ -23,6 +23,10 @@
 // NOLINTNEXTLINE
 #include <gtest/gtest.h>
 
+#include <fstream>
+
+#include <boost/filesystem/operations.hpp>
+
 #include "App/Metadata.h"
 #include <xercesc/util/PlatformUtils.hpp>
 
@@ -234,4 +238,24 @@ TEST_F(MetadataTest, MetadataInMemoryConstruction)
     AssertMetadataMatches(testObject);
 }
 
+TEST_F(MetadataTest, MetadataFromFileFollowsChanges)
+{
+    auto path = boost::filesystem::temp_directory_path()
+        / boost::filesystem::unique_path("metadata-%%%%-%%%%.xml");
+    auto xml = GivenSimpleMetadataXMLString();
+    std::ofstream(path.string()) << xml;
+
+    auto first = App::Metadata::fromFile(path);
+    auto second = App::Metadata::fromFile(path);
+    AssertMetadataMatches(first);
+    AssertMetadataMatches(second);
+
+    auto pos = xml.find("TestAddon");
+    std::ofstream(path.string()) << xml.replace(pos, 9, "ChangedTestAddon");
+    auto changed = App::Metadata::fromFile(path);
+    EXPECT_EQ(changed.name(), "ChangedTestAddon");
+
+    boost::filesystem::remove(path);
+}
+
 // NOLINTEND(readability-named-parameter)
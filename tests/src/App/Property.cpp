@@ -50,3 +50,74 @@ TEST_F(PropertyFloatTest, testWriteRead)
     prop2.Restore(reader);
     EXPECT_DOUBLE_EQ(prop2.getValue(), value);
 }
+
+TEST(PropertyFloatList, TestSetValuesMove)
+{
+    std::vector<double> values {1.0, 2.0, 3.0};
+    const double* data = values.data();
+    App::PropertyFloatList prop;
+    prop.setValues(std::move(values));
+    EXPECT_EQ(prop.getSize(), 3);
+    EXPECT_EQ(prop.getValues().data(), data);
+    EXPECT_DOUBLE_EQ(prop[2], 3.0);
+
+    // the copying overload is still available
+    const std::vector<double> copy {4.0};
+    prop.setValues(copy);
+    EXPECT_EQ(prop.getSize(), 1);
+    EXPECT_EQ(copy.size(), 1);
+}
+
+TEST(PropertyIntegerList, TestSetValuesTouchesChangedElements)
+{
+    App::PropertyIntegerList prop;
+    std::vector<long> values(100, 0);
+    prop.setValues(values);
+
+    values[3] = 1;
+    values[42] = 2;
+    prop.setValues(values);
+    EXPECT_EQ(prop.getTouchList(), (std::set<int> {3, 42}));
+
+    // too many changes and changes of the size stand for the whole list
+    std::fill(values.begin(), values.end(), 3);
+    prop.setValues(values);
+    EXPECT_TRUE(prop.getTouchList().empty());
+    values.push_back(4);
+    prop.setValues(values);
+    EXPECT_TRUE(prop.getTouchList().empty());
+}
+
+TEST(PropertyIntegerList, TestSaveRestoreDocFile)
+{
+    std::vector<long> values {0, -1, 42, 100000, -100000};
+    App::PropertyIntegerList prop;
+    prop.setValues(values);
+    Base::StringWriter writer;
+    prop.SaveDocFile(writer);
+
+    std::istringstream data(writer.getString());
+    Base::Reader reader(data, "IntegerList", 0);
+    App::PropertyIntegerList prop2;
+    prop2.RestoreDocFile(reader);
+    EXPECT_EQ(prop2.getValues(), values);
+}
+
+TEST(PropertyBoolList, TestSaveRestoreDocFile)
+{
+    boost::dynamic_bitset<> values(19);
+    values[0] = true;
+    values[7] = true;
+    values[8] = true;
+    values[18] = true;
+    App::PropertyBoolList prop;
+    prop.setValues(values);
+    Base::StringWriter writer;
+    prop.SaveDocFile(writer);
+
+    std::istringstream data(writer.getString());
+    Base::Reader reader(data, "BoolList", 0);
+    App::PropertyBoolList prop2;
+    prop2.RestoreDocFile(reader);
+    EXPECT_EQ(prop2.getValues(), values);
+}
@@ -90,4 +90,41 @@ TEST_F(PropertyExpressionEngineTest, executeCrossPropertyReference)
     ;
 }
 
+TEST_F(PropertyExpressionEngineTest, executeReevaluatesChangedBindings)
+{
+    // Arrange
+    auto source_path = App::ObjectIdentifier::parse(this_obj(), source_name());
+    source_prop()->setPathValue(source_path, std::string("1.5 m"));
+    auto target_path = App::ObjectIdentifier::parse(this_obj(), target_name());
+    std::shared_ptr<App::Expression> target_rule(App::Expression::parse(this_obj(), "parsequant(" + source_name() + ")"));
+    this_obj()->setExpression(target_path, target_rule);
+    this_obj()->ExpressionEngine.execute();
+    auto target_value = [&]() {
+        return App::any_cast<Base::Quantity>(target_prop()->getPathValue(target_path));
+    };
+
+    // Act
+    bool touched = false;
+    this_obj()->ExpressionEngine.execute(App::PropertyExpressionEngine::ExecuteAll, &touched);
+
+    // Assert
+    EXPECT_FALSE(touched);
+    EXPECT_EQ(target_value(), Base::Quantity::parse("1500 mm"));
+
+    // Act
+    source_prop()->setPathValue(source_path, std::string("2 m"));
+    this_obj()->ExpressionEngine.execute(App::PropertyExpressionEngine::ExecuteAll, &touched);
+
+    // Assert
+    EXPECT_TRUE(touched);
+    EXPECT_EQ(target_value(), Base::Quantity::parse("2000 mm"));
+
+    // Act
+    target_prop()->setPathValue(target_path, Base::Quantity::parse("1 mm"));
+    this_obj()->ExpressionEngine.execute();
+
+    // Assert
+    EXPECT_EQ(target_value(), Base::Quantity::parse("2000 mm"));
+}
+
 // clang-format on
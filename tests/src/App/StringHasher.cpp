@@ -9,6 +9,7 @@
 
 #include <QCryptographicHash>
 #include <array>
+#include <thread>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1586,3 +1587,31 @@ TEST_F(StringHasherTest, compact)  // NOLINT
     // Assert
     EXPECT_EQ(0, Hasher()->count());
 }
+
+TEST_F(StringHasherTest, getIDFromMultipleThreads)  // NOLINT
+{
+    // Arrange
+    const int numThreads {4};
+    const int numStrings {500};
+    std::vector<std::vector<long>> results(numThreads);
+    std::vector<std::thread> threads;
+
+    // Act
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([this, &results, i]() {
+            for (int j = 0; j < numStrings; ++j) {
+                auto text = std::to_string(j);
+                results[i].push_back(Hasher()->getID(text.c_str()).value());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    EXPECT_EQ(numStrings, Hasher()->size());
+    for (int i = 1; i < numThreads; ++i) {
+        EXPECT_EQ(results[0], results[i]);
+    }
+}
@@ -27,9 +27,12 @@ the tests into individual parts.
 */
 
 #include "Base/Base64.h"
+#include "Base/Base64Filter.h"
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 using namespace Base;
 
 // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -88,4 +91,36 @@ TEST(Base64, oneEqualsSignPadding)
     ASSERT_EQ(rest2_decoded, rest2_original);
 }
 
+TEST(Base64, decodeStopsAtInvalidCharacter)
+{
+    std::string decoded;
+    std::size_t read = base64_decode(decoded, "YWJjZGVm*ZA==", 13);
+
+    ASSERT_EQ(decoded, "abcdef");
+    ASSERT_EQ(read, 9U);
+}
+
+TEST(Base64, streamRoundTrip)
+{
+    // Sizes that are no multiple of three and longer than one line and one buffer
+    for (std::size_t size : {1U, 2U, 100U, 5000U}) {
+        std::string original;
+        for (std::size_t i = 0; i < size; ++i) {
+            original.push_back(static_cast<char>(i * 7));
+        }
+
+        std::ostringstream encoded;
+        {
+            auto encoder = create_base64_encoder(encoded);
+            encoder->write(original.c_str(), static_cast<std::streamsize>(original.size()));
+        }
+        std::istringstream input(encoded.str());
+        auto decoder = create_base64_decoder(input);
+        std::string decoded((std::istreambuf_iterator<char>(*decoder)),
+                            std::istreambuf_iterator<char>());
+
+        ASSERT_EQ(decoded, original) << "size " << size;
+    }
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
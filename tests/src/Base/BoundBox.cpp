@@ -199,6 +199,22 @@ TEST(BoundBox, TestAdd)
     EXPECT_EQ(box1.IsInBox(Base::Vector3d(1, 1, 1)), true);
 }
 
+TEST(BoundBox, TestIsInBoxMany)
+{
+    Base::BoundBox3d box(0, 0, 0, 1, 1, 1);
+    std::vector<Base::Vector3d> points {Base::Vector3d(0, 0, 0),
+                                        Base::Vector3d(0.5, 0.5, 0.5),
+                                        Base::Vector3d(1, 1, 1),
+                                        Base::Vector3d(1.5, 0.5, 0.5),
+                                        Base::Vector3d(0.5, -0.5, 0.5),
+                                        Base::Vector3d(0.5, 0.5, 2)};
+    std::vector<unsigned char> inside(points.size());
+    box.IsInBox(points.data(), points.size(), inside.data());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(inside[i] != 0, box.IsInBox(points[i]));
+    }
+}
+
 TEST(BoundBox, TestCenter)
 {
     Base::BoundBox3d box;
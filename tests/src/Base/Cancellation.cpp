@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "Base/Cancellation.h"
+#include "Base/Exception.h"
+
+using Base::Cancellation;
+
+TEST(Cancellation, noDeadlineByDefault)
+{
+    EXPECT_EQ(Cancellation::deadline(), Cancellation::Clock::time_point::max());
+    EXPECT_FALSE(Cancellation::isRequested());
+    EXPECT_FALSE(Cancellation::deadlineExceeded());
+    EXPECT_NO_THROW(Cancellation::check());  // NOLINT
+}
+
+TEST(Cancellation, request)
+{
+    Cancellation::request();
+    EXPECT_TRUE(Cancellation::isRequested());
+    EXPECT_FALSE(Cancellation::deadlineExceeded());
+    EXPECT_THROW(Cancellation::check(), Base::AbortException);  // NOLINT
+    Cancellation::reset();
+    EXPECT_FALSE(Cancellation::isRequested());
+}
+
+TEST(Cancellation, deadlineExceeded)
+{
+    Cancellation::Deadline deadline(0.001);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_TRUE(Cancellation::isRequested());
+    EXPECT_TRUE(Cancellation::deadlineExceeded());
+    EXPECT_THROW(Cancellation::check(), Base::AbortException);  // NOLINT
+}
+
+TEST(Cancellation, nestedDeadlines)
+{
+    Cancellation::Deadline outer(1000.0);
+    auto outerDeadline = Cancellation::deadline();
+    {
+        // a longer inner deadline does not extend the outer one
+        Cancellation::Deadline inner(2000.0);
+        EXPECT_EQ(Cancellation::deadline(), outerDeadline);
+    }
+    {
+        Cancellation::Deadline inner(10.0);
+        EXPECT_LT(Cancellation::deadline(), outerDeadline);
+        Cancellation::Deadline none(0.0);
+        EXPECT_LT(Cancellation::deadline(), outerDeadline);
+    }
+    EXPECT_EQ(Cancellation::deadline(), outerDeadline);
+    EXPECT_FALSE(Cancellation::isRequested());
+}
+
+TEST(Cancellation, deadlineOfOtherThread)
+{
+    auto deadline = Cancellation::Clock::now() - std::chrono::seconds(1);
+    bool requested = false;
+    std::thread worker([&]() {
+        requested = Cancellation::isRequested(deadline);
+    });
+    worker.join();
+    EXPECT_TRUE(requested);
+    EXPECT_FALSE(Cancellation::isRequested(Cancellation::Clock::time_point::max()));
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include "Base/Console.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+class RecordingObserver: public Base::ILogger
+{
+public:
+    void SendLog(const std::string& /*notifiername*/,
+                 const std::string& msg,
+                 Base::LogStyle /*level*/,
+                 Base::IntendedRecipient /*recipient*/,
+                 Base::ContentType /*content*/) override
+    {
+        messages.push_back(msg);
+    }
+
+    const char* Name() override
+    {
+        return "RecordingObserver";
+    }
+
+    std::vector<std::string> messages;
+};
+}  // namespace
+
+class ConsoleTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Base::Console().AttachObserver(&observer);
+    }
+
+    void TearDown() override
+    {
+        Base::Console().SetConnectionMode(Base::ConsoleSingleton::Direct);
+        Base::Console().DetachObserver(&observer);
+    }
+
+    RecordingObserver observer;
+};
+
+TEST_F(ConsoleTest, asynchronousDeliversInOrder)
+{
+    // Arrange
+    Base::Console().SetConnectionMode(Base::ConsoleSingleton::Asynchronous);
+
+    // Act
+    Base::Console().Message("first\n");
+    Base::Console().Warning("second\n");
+    Base::Console().Message("third\n");
+    Base::Console().SetConnectionMode(Base::ConsoleSingleton::Direct);
+
+    // Assert
+    std::vector<std::string> expected {"first\n", "second\n", "third\n"};
+    EXPECT_EQ(observer.messages, expected);
+}
+
+TEST_F(ConsoleTest, asynchronousCollapsesRepeatedMessages)
+{
+    // Arrange
+    Base::Console().SetConnectionMode(Base::ConsoleSingleton::Asynchronous);
+
+    // Act
+    for (int i = 0; i < 10; ++i) {
+        Base::Console().Message("again\n");
+    }
+    Base::Console().Message("done\n");
+    Base::Console().SetConnectionMode(Base::ConsoleSingleton::Direct);
+
+    // Assert
+    ASSERT_GE(observer.messages.size(), 3U);
+    EXPECT_EQ(observer.messages.front(), "again\n");
+    EXPECT_EQ(observer.messages.back(), "done\n");
+    EXPECT_LE(observer.messages.size(), 11U);
+}
+
+TEST_F(ConsoleTest, asynchronousFromSeveralThreads)
+{
+    // Arrange
+    Base::Console().SetConnectionMode(Base::ConsoleSingleton::Asynchronous);
+    constexpr int count = 100;
+
+    // Act
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < count; ++i) {
+                Base::Console().Message("%d:%d\n", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    Base::Console().SetConnectionMode(Base::ConsoleSingleton::Direct);
+
+    // Assert
+    EXPECT_EQ(observer.messages.size(), 4U * count);
+}
@@ -401,5 +401,33 @@ TEST(Matrix, TestRotAxisFormula) //NOLINT
     EXPECT_DOUBLE_EQ(mat1[2][1], mat2[2][1]);
     EXPECT_DOUBLE_EQ(mat1[2][2], mat2[2][2]);
 }
+
+TEST(Matrix, TestMultVecArray)
+{
+    Base::Matrix4D mat;
+    mat.rotLine(Base::Vector3d(1, 2, 3), 0.7);
+    mat.scale(2.0, 3.0, 0.5);
+    mat.move(Base::Vector3d(4, -5, 6));
+
+    std::vector<Base::Vector3d> points = {Base::Vector3d(1, 0, 0),
+                                          Base::Vector3d(0, 1, 0),
+                                          Base::Vector3d(-1, 2, 5),
+                                          Base::Vector3d(0.5, 0.25, -3)};
+    std::vector<Base::Vector3d> result(points.size());
+    mat.multVec(points.data(), result.data(), points.size());
+
+    std::vector<Base::Vector3f> pointsf;
+    for (const auto& pnt : points) {
+        pointsf.emplace_back(float(pnt.x), float(pnt.y), float(pnt.z));
+    }
+    std::vector<Base::Vector3f> expectf = pointsf;
+    // in-place
+    mat.multVec(pointsf.data(), pointsf.data(), pointsf.size());
+
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(result[i], mat * points[i]);
+        EXPECT_EQ(pointsf[i], mat * expectf[i]);
+    }
+}
 // clang-format on
 // NOLINTEND(cppcoreguidelines-*,readability-magic-numbers)
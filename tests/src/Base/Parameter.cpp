@@ -328,6 +328,33 @@ TEST_F(ParameterTest, TestRenameGroup)
     cfg->CheckDocument();
 }
 
+TEST_F(ParameterTest, TestCachedValues)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup/Cached");
+
+    // a missing value is cached without its default
+    EXPECT_EQ(grp->GetInt("Int", 1), 1);
+    EXPECT_EQ(grp->GetInt("Int", 2), 2);
+    EXPECT_EQ(grp->GetASCII("Text", "a"), "a");
+
+    grp->SetInt("Int", 3);
+    grp->SetASCII("Text", "b");
+    grp->SetBool("Bool", true);
+    EXPECT_EQ(grp->GetInt("Int", 1), 3);
+    EXPECT_EQ(grp->GetASCII("Text", "a"), "b");
+    EXPECT_TRUE(grp->GetBool("Bool", false));
+
+    grp->SetInt("Int", 4);
+    grp->RemoveASCII("Text");
+    EXPECT_EQ(grp->GetInt("Int", 1), 4);
+    EXPECT_EQ(grp->GetASCII("Text", "a"), "a");
+
+    grp->Clear();
+    EXPECT_EQ(grp->GetInt("Int", 1), 1);
+    EXPECT_FALSE(grp->GetBool("Bool", false));
+}
+
 TEST_F(ParameterTest, TestSaveRestoreRef)
 {
     auto cfg = getCreateConfig();
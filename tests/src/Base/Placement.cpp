@@ -213,3 +213,32 @@ TEST(Placement, TestSclerp)
     EXPECT_EQ(plm6.getRotation().isSame(Base::Rotation(1, 1, 0, 0), epsilon), true);
     EXPECT_EQ(plm6.getPosition().IsEqual(pos, epsilon), true);
 }
+
+TEST(Placement, TestMultVecArray)
+{
+    Base::Placement plm(Base::Vector3d(1, 2, 3), Base::Rotation(Base::Vector3d(1, 1, 0), 0.5));
+    std::vector<Base::Vector3d> points = {Base::Vector3d(1, 0, 0),
+                                         Base::Vector3d(0, 1, 0),
+                                         Base::Vector3d(-1, 2, 5)};
+    std::vector<Base::Vector3d> expect(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        plm.multVec(points[i], expect[i]);
+    }
+
+    plm.multVec(points.data(), points.data(), points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(points[i].IsEqual(expect[i], epsilon), true);
+    }
+
+    std::vector<Base::Vector3d> rotated = {Base::Vector3d(1, 0, 0),
+                                          Base::Vector3d(0, 1, 0),
+                                          Base::Vector3d(-1, 2, 5)};
+    std::vector<Base::Vector3d> expectRot = rotated;
+    for (auto& pnt : expectRot) {
+        plm.getRotation().multVec(pnt, pnt);
+    }
+    plm.getRotation().multVec(rotated.data(), rotated.data(), rotated.size());
+    for (std::size_t i = 0; i < rotated.size(); i++) {
+        EXPECT_EQ(rotated[i].IsEqual(expectRot[i], epsilon), true);
+    }
+}
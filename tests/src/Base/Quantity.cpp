@@ -25,6 +25,30 @@ TEST(BaseQuantity, TestParse)
     EXPECT_THROW(boost::ignore_unused(Base::Quantity::parse("1,234,500.12 kg")), Base::ParserError);
 }
 
+TEST(BaseQuantity, TestParseSimpleForms)
+{
+    EXPECT_EQ(Base::Quantity::parse("-2.5e1mm"), Base::Quantity(-25.0, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse(" 3 \xC2\xB5m "), Base::Quantity(0.003, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse("2 min"), Base::Quantity(120.0, Base::Unit::TimeSpan));
+    EXPECT_EQ(Base::Quantity::parse("7"), Base::Quantity(7.0));
+    // forms that need the full grammar
+    EXPECT_EQ(Base::Quantity::parse("1 ft 2 in"), Base::Quantity(355.6, Base::Unit::Length));
+    EXPECT_EQ(Base::Quantity::parse("2 m^2"), Base::Quantity(2e6, Base::Unit::Area));
+    EXPECT_THROW(boost::ignore_unused(Base::Quantity::parse("2 mmm")), Base::ParserError);
+    EXPECT_THROW(boost::ignore_unused(Base::Quantity::parse("2em")), Base::ParserError);
+}
+
+TEST(BaseQuantity, TestParseCached)
+{
+    Base::Quantity q1 = Base::Quantity::parse("12.5 kg");
+    Base::Quantity q2 = Base::Quantity::parse("12.5 kg");
+
+    EXPECT_EQ(q1, q2);
+    // failures are not cached
+    EXPECT_THROW(boost::ignore_unused(Base::Quantity::parse("12.5 kg kg")), Base::ParserError);
+    EXPECT_THROW(boost::ignore_unused(Base::Quantity::parse("12.5 kg kg")), Base::ParserError);
+}
+
 TEST(BaseQuantity, TestDim)
 {
     Base::Quantity q1 {0, Base::Unit::Area};
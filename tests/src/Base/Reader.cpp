@@ -12,6 +12,7 @@
 #include <boost/filesystem.hpp>
 #include <fstream>
 #include <xercesc/util/PlatformUtils.hpp>
+#include <zipios++/zipoutputstream.h>
 
 namespace fs = boost::filesystem;
 
@@ -51,6 +52,13 @@ public:
         _reader = std::make_unique<Base::XMLReader>(_tempFile.string().c_str(), inputStream);
     }
 
+    void givenDataAsXMLBuffer(const std::string& data)
+    {
+        auto stringData =
+            R"(<?xml version="1.0" encoding="UTF-8"?><document>)" + data + "</document>";
+        _reader = std::make_unique<Base::XMLReader>(_tempFile.string().c_str(), stringData);
+    }
+
 private:
     std::unique_ptr<Base::XMLReader> _reader;
     fs::path _tempDir;
@@ -368,3 +376,141 @@ TEST_F(ReaderTest, invalidDefaults)
         { xml.Reader()->getAttributeAsInteger("missing", "Not a Float"); },
         std::invalid_argument);
 }
+
+namespace
+{
+// Record the elements, attributes and characters seen when reading through a document
+std::string traceDocument(Base::XMLReader& reader)
+{
+    std::ostringstream trace;
+    reader.readElement("document");
+    for (;;) {
+        bool start = reader.readNextElement();
+        if (reader.isEndOfDocument()) {
+            break;
+        }
+        if (!start) {
+            trace << '/' << reader.localName() << '@' << reader.level();
+            continue;
+        }
+        trace << reader.localName() << '@' << reader.level() << '[';
+        for (const char* name : {"name", "value", "empty"}) {
+            if (reader.hasAttribute(name)) {
+                trace << name << '=' << reader.getAttribute(name) << ';';
+            }
+        }
+        trace << ']';
+        if (std::string(reader.localName()) == "text") {
+            reader.beginCharStream() >> trace.rdbuf();
+            reader.readEndElement("text");
+        }
+    }
+    return trace.str();
+}
+}  // namespace
+
+TEST_F(ReaderTest, bufferMatchesXerces)
+{
+    // Arrange
+    auto xmlBody = R"(
+<!-- a comment -->
+<Properties Count="2">
+    <Property name="Label" value="a &lt;b&gt; &amp; &quot;c&quot; &#10;d&#x20AC;"/>
+    <Property name='Expr' value='x
+y'>
+        <text>Line1&#13;
+Line2 &amp; more</text>
+    </Property>
+    <Empty empty=""></Empty>
+</Properties>
+)";
+    ReaderXML fromStream;
+    fromStream.givenDataAsXMLStream(xmlBody);
+    ReaderXML fromBuffer;
+    fromBuffer.givenDataAsXMLBuffer(xmlBody);
+
+    // Act
+    auto expected = traceDocument(*fromStream.Reader());
+    auto result = traceDocument(*fromBuffer.Reader());
+
+    // Assert
+    EXPECT_EQ(result, expected);
+    EXPECT_NE(result.find("value=a <b> & \"c\" \nd\xE2\x82\xAC;"), std::string::npos);
+    EXPECT_NE(result.find("value=x y;"), std::string::npos);
+}
+
+TEST_F(ReaderTest, bufferReadsCDATA)
+{
+    // Arrange
+    ReaderXML xml;
+    xml.givenDataAsXMLBuffer("<data><![CDATA[a<b>&c]]></data><next/>");
+    xml.Reader()->readElement("data");
+
+    // Act
+    auto& stream = xml.Reader()->beginCharStream();
+    std::string result((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    // Assert
+    EXPECT_EQ(result, "a<b>&c");
+}
+
+TEST_F(ReaderTest, bufferReportsMalformedDocument)
+{
+    // Arrange
+    ReaderXML xml;
+    xml.givenDataAsXMLBuffer("<data value='1></data>");
+
+    // Act / Assert
+    EXPECT_THROW(xml.Reader()->readElement("data"), Base::XMLParseException);  // NOLINT
+}
+
+namespace
+{
+// Writes a project archive with a Document.xml and a number of data files of different sizes
+std::vector<Base::ArchiveEntry> givenArchive(const fs::path& path)
+{
+    std::vector<Base::ArchiveEntry> entries;
+    entries.push_back({"Document.xml", "<Document/>"});
+    for (int i = 0; i < 20; i++) {
+        std::string data;
+        for (int j = 0; j < i * 500; j++) {
+            data += std::to_string(i * j) + '\n';
+        }
+        entries.push_back({"File" + std::to_string(i) + ".txt", data});
+    }
+    std::ofstream file(path.string(), std::ios::out | std::ios::binary);
+    zipios::ZipOutputStream zip(file);
+    for (const auto& entry : entries) {
+        zip.putNextEntry(entry.FileName);
+        zip << entry.Data;
+    }
+    return entries;
+}
+}  // namespace
+
+TEST_F(ReaderTest, readArchiveConcurrently)
+{
+    // Arrange
+    fs::path path = fs::temp_directory_path() / fs::unique_path("unit_test_Reader-%%%%.zip");
+    std::vector<Base::ArchiveEntry> expected = givenArchive(path);
+
+    // Act
+    auto serial = Base::XMLReader::readArchive(path.string().c_str(), 1);
+    auto concurrent = Base::XMLReader::readArchive(path.string().c_str(), 4);
+    auto withoutDocument = Base::XMLReader::readArchive(path.string().c_str(), 4, false);
+    fs::remove(path);
+
+    // Assert
+    ASSERT_EQ(serial.size(), expected.size());
+    ASSERT_EQ(concurrent.size(), expected.size());
+    ASSERT_EQ(withoutDocument.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(serial[i].FileName, expected[i].FileName);
+        EXPECT_EQ(serial[i].Data, expected[i].Data);
+        EXPECT_EQ(concurrent[i].FileName, expected[i].FileName);
+        EXPECT_EQ(concurrent[i].Data, expected[i].Data);
+        EXPECT_EQ(withoutDocument[i].FileName, expected[i].FileName);
+    }
+    EXPECT_TRUE(withoutDocument.front().Data.empty());
+    EXPECT_EQ(withoutDocument.back().Data, expected.back().Data);
+}
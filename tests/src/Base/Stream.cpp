@@ -125,3 +125,25 @@ TEST_F(TextStreamIntegrationTest, OutputThenInputMultiLineWithCarriageReturns)
     // Assert
     EXPECT_EQ(multiLineStringResult, result);
 }
+
+TEST(Streambuf, readBlocksAndSingleCharacters)
+{
+    // Arrange
+    std::string data("0123456789");
+    Base::Streambuf buf(data);
+    std::istream str(&buf);
+    std::string block(4, '\0');
+    std::string rest(8, '\0');
+
+    // Act
+    str.read(&block[0], 4);
+    char next = static_cast<char>(str.get());
+    str.read(&rest[0], 8);
+
+    // Assert
+    EXPECT_EQ(block, "0123");
+    EXPECT_EQ(next, '4');
+    EXPECT_EQ(str.gcount(), 5);
+    EXPECT_EQ(rest.substr(0, 5), "56789");
+    EXPECT_TRUE(str.eof());
+}
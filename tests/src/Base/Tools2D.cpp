@@ -85,3 +85,71 @@ TEST(Polygon2D, TestClear)
     poly.DeleteAll();
     EXPECT_EQ(poly.GetCtVectors(), 0);
 }
+
+TEST(Polygon2D, TestContainsMany)
+{
+    // a self-intersecting polygon, a square with a loop at one corner
+    Base::Polygon2d poly;
+    poly.Add(Base::Vector2d(0.0, 0.0));
+    poly.Add(Base::Vector2d(4.0, 0.0));
+    poly.Add(Base::Vector2d(4.0, 4.0));
+    poly.Add(Base::Vector2d(5.0, 5.0));
+    poly.Add(Base::Vector2d(5.0, 3.0));
+    poly.Add(Base::Vector2d(0.0, 4.0));
+
+    // a grid of points in and around the polygon, many of them on its lines and corners
+    std::vector<Base::Vector2d> points;
+    for (int i = -2; i <= 12; i++) {
+        for (int j = -2; j <= 12; j++) {
+            points.emplace_back(0.5 * i, 0.5 * j);
+        }
+    }
+    std::vector<unsigned char> inside(points.size());
+    poly.Contains(points.data(), points.size(), inside.data());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(inside[i] != 0, poly.Contains(points[i])) << points[i].x << ", " << points[i].y;
+    }
+    EXPECT_EQ(inside[4 * 15 + 4], 1);  // (0, 0)
+    EXPECT_EQ(inside[6 * 15 + 6], 1);  // (1, 1)
+    EXPECT_EQ(inside[14 * 15 + 14], 0);  // (6, 6)
+}
+
+TEST(Polygon2D, TestContainsManyTooFewPoints)
+{
+    Base::Polygon2d poly;
+    poly.Add(Base::Vector2d(0.0, 0.0));
+    poly.Add(Base::Vector2d(1.0, 1.0));
+    std::vector<Base::Vector2d> points {Base::Vector2d(0.5, 0.5)};
+    std::vector<unsigned char> inside {1};
+    poly.Contains(points.data(), points.size(), inside.data());
+    EXPECT_EQ(inside[0], 0);
+}
+
+TEST(BoundBox2D, TestContainsMany)
+{
+    Base::BoundBox2d box(0.0, 0.0, 2.0, 1.0);
+    std::vector<Base::Vector2d> points {Base::Vector2d(0.0, 0.0),
+                                        Base::Vector2d(1.0, 0.5),
+                                        Base::Vector2d(2.0, 1.0),
+                                        Base::Vector2d(2.5, 0.5),
+                                        Base::Vector2d(1.0, -0.5)};
+    std::vector<unsigned char> inside(points.size());
+    box.Contains(points.data(), points.size(), inside.data());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        EXPECT_EQ(inside[i] != 0, box.Contains(points[i]));
+    }
+}
+
+TEST(BoundBox2D, TestIntersectMany)
+{
+    Base::BoundBox2d box(0.0, 0.0, 2.0, 1.0);
+    std::vector<Base::BoundBox2d> boxes {Base::BoundBox2d(1.0, 0.5, 3.0, 3.0),
+                                         Base::BoundBox2d(-1.0, -1.0, 5.0, 5.0),
+                                         Base::BoundBox2d(2.0, 0.0, 3.0, 1.0),
+                                         Base::BoundBox2d(3.0, 3.0, 4.0, 4.0)};
+    std::vector<unsigned char> result(boxes.size());
+    box.Intersect(boxes.data(), boxes.size(), result.data());
+    for (std::size_t i = 0; i < boxes.size(); i++) {
+        EXPECT_EQ(result[i] != 0, box.Intersect(boxes[i]));
+    }
+}
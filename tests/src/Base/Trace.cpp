@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+
+#include "Base/Trace.h"
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+std::string writeTrace()
+{
+    fs::path path = fs::temp_directory_path() / fs::unique_path("unit_test_Trace-%%%%.json");
+    EXPECT_TRUE(Base::Trace::write(path.string()));
+    std::ifstream file(path.string());
+    std::stringstream content;
+    content << file.rdbuf();
+    file.close();
+    fs::remove(path);
+    return content.str();
+}
+
+}  // namespace
+
+TEST(Trace, disabledByDefault)
+{
+    EXPECT_FALSE(Base::Trace::isEnabled());
+}
+
+TEST(Trace, recordsZonesOfAllThreads)
+{
+    // Arrange
+    Base::Trace::start();
+
+    // Act
+    {
+        FC_TRACE_ZONE("TraceTest::outer", "Box\"001");
+        std::thread worker([]() {
+            FC_TRACE_ZONE("TraceTest::worker");
+        });
+        worker.join();
+    }
+    Base::Trace::stop();
+    {
+        FC_TRACE_ZONE("TraceTest::stopped");
+    }
+    std::string json = writeTrace();
+
+    // Assert
+    EXPECT_FALSE(Base::Trace::isEnabled());
+    EXPECT_NE(json.find("\"name\":\"TraceTest::outer\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"detail\":\"Box\\\"001\"}"), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"TraceTest::worker\""), std::string::npos);
+    EXPECT_EQ(json.find("TraceTest::stopped"), std::string::npos);
+}
+
+TEST(Trace, startDiscardsEarlierZones)
+{
+    // Arrange
+    Base::Trace::start();
+    {
+        FC_TRACE_ZONE("TraceTest::first");
+    }
+
+    // Act
+    Base::Trace::start();
+    {
+        FC_TRACE_ZONE("TraceTest::second");
+    }
+    Base::Trace::stop();
+    std::string json = writeTrace();
+
+    // Assert
+    EXPECT_EQ(json.find("TraceTest::first"), std::string::npos);
+    EXPECT_NE(json.find("TraceTest::second"), std::string::npos);
+}
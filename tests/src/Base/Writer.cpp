@@ -2,7 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 #include "Base/Exception.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +132,120 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+namespace
+{
+// Persistence object writing a numbered block of text into its own file
+class NumberFile: public Base::Persistence
+{
+public:
+    NumberFile(int number, bool concurrent)
+        : number {number}
+        , concurrent {concurrent}
+    {}
+    unsigned int getMemSize() const override
+    {
+        return 0;
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        for (int i = 0; i < 1000; i++) {
+            writer.Stream() << number << ' ' << i << '\n';
+        }
+    }
+    bool canSaveDocFileConcurrently() const override
+    {
+        return concurrent;
+    }
+    std::string expected() const
+    {
+        std::stringstream str;
+        for (int i = 0; i < 1000; i++) {
+            str << number << ' ' << i << '\n';
+        }
+        return str.str();
+    }
+
+private:
+    int number;
+    bool concurrent;
+};
+}  // namespace
+
+TEST(ZipWriterTest, writeFilesConcurrently)
+{
+    // Arrange
+    std::vector<NumberFile> files;
+    for (int i = 0; i < 10; i++) {
+        files.emplace_back(i, i % 3 != 0);
+    }
+    std::stringstream archive;
+    std::vector<std::string> names;
+
+    // Act
+    {
+        Base::ZipWriter writer(archive);
+        writer.setThreads(4);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        for (const auto& file : files) {
+            names.push_back(writer.addFile("File.txt", &file));
+        }
+        writer.writeFiles();
+        EXPECT_FALSE(writer.hasErrors());
+    }
+
+    // Assert
+    zipios::ZipInputStream zip(archive);
+    std::string xml {std::istreambuf_iterator<char>(zip), std::istreambuf_iterator<char>()};
+    EXPECT_EQ(xml, "<Document/>");
+    for (std::size_t i = 0; i < files.size(); i++) {
+        zip.clear();
+        auto entry = zip.getNextEntry();
+        ASSERT_TRUE(entry->isValid());
+        EXPECT_EQ(entry->getName(), names[i]);
+        std::string data {std::istreambuf_iterator<char>(zip), std::istreambuf_iterator<char>()};
+        EXPECT_EQ(data, files[i].expected());
+    }
+}
+
+TEST(ZipWriterTest, writeStoredEntries)
+{
+    // Arrange
+    NumberFile serial(1, false);
+    NumberFile buffered(2, true);
+    std::stringstream archive;
+
+    // Act
+    {
+        Base::ZipWriter writer(archive);
+        writer.setEntryLevel("BIN", 0);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << "<Document/>";
+        writer.addFile("Serial.bin", &serial);
+        writer.addFile("Buffered.bin", &buffered);
+        writer.addFile("Buffered.txt", &buffered);
+        writer.writeFiles();
+    }
+
+    // Assert
+    zipios::ZipInputStream zip(archive);
+    std::vector<zipios::StorageMethod> methods {zipios::DEFLATED,
+                                                zipios::STORED,
+                                                zipios::DEFLATED};
+    std::vector<std::string> expected {serial.expected(),
+                                       buffered.expected(),
+                                       buffered.expected()};
+    for (std::size_t i = 0; i < methods.size(); i++) {
+        auto entry = zip.getNextEntry();
+        ASSERT_TRUE(entry->isValid());
+        EXPECT_EQ(entry->getMethod(), methods[i]);
+        std::string data(entry->getSize(), '\0');
+        zip.read(&data[0], static_cast<std::streamsize>(data.size()));
+        EXPECT_EQ(data, expected[i]);
+    }
+}
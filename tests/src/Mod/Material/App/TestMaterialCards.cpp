@@ -200,4 +200,44 @@ TEST_F(TestMaterialCards, TestColumns)
     EXPECT_EQ(dynamic_cast<Materials::Material3DArray &>(*array3d).columns(), 2);
 }
 
+TEST_F(TestMaterialCards, TestLoadOnFirstUse)
+{
+    ASSERT_NE(_modelManager, nullptr);
+    ASSERT_TRUE(_library);
+
+    auto testMaterial = _materialManager->getMaterial(_testMaterialUUID);
+    auto newMaterial = std::make_shared<Materials::Material>(*testMaterial);
+    _materialManager->saveMaterial(_library,
+                      newMaterial,
+                      QString::fromStdString("/Test Lazy.FCMat"),
+                      false, // overwrite
+                      true,  // saveAsCopy
+                      false); // saveInherited
+
+    // A material created from the index of a library only knows its name and UUID
+    QString path = _library->getLocalPath(QString::fromStdString("/Test Lazy.FCMat"));
+    Materials::Material material(_library, path, _testMaterialUUID, QString::fromStdString("Test Lazy"));
+    material.setLoadPath(path);
+    EXPECT_FALSE(material.isLoaded());
+    EXPECT_EQ(material.getUUID(), _testMaterialUUID);
+    EXPECT_EQ(material.getName(), QString::fromStdString("Test Lazy"));
+    EXPECT_FALSE(material.isLoaded());
+
+    // The card is read on the first access to its contents
+    EXPECT_TRUE(material.hasPhysicalProperty(QString::fromStdString("TestArray2D3Column")));
+    EXPECT_TRUE(material.isLoaded());
+    auto array2d = material.getPhysicalProperty(QString::fromStdString("TestArray2D3Column"))->getMaterialValue();
+    EXPECT_TRUE(array2d);
+    EXPECT_EQ(dynamic_cast<Materials::Material2DArray &>(*array2d).columns(), 3);
+
+    // Copies of a material that isn't loaded yet read the card themselves
+    Materials::Material lazy(_library, path, _testMaterialUUID, QString::fromStdString("Test Lazy"));
+    lazy.setLoadPath(path);
+    Materials::Material copy(lazy);
+    EXPECT_FALSE(copy.isLoaded());
+    EXPECT_EQ(copy.getPhysicalModels()->size(), material.getPhysicalModels()->size());
+    EXPECT_TRUE(copy.isLoaded());
+    EXPECT_FALSE(lazy.isLoaded());
+}
+
 // clang-format on
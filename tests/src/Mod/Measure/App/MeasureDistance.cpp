@@ -67,4 +67,29 @@ TEST_F(MeasureDistance, testCircleCircle)
     EXPECT_EQ(md->Position1.getValue(), Base::Vector3d(0.0, 0.0, 0.0));
     EXPECT_EQ(md->Position2.getValue(), Base::Vector3d(3.0, 4.0, 0.0));
 }
+
+TEST_F(MeasureDistance, testRecomputeAfterChange)
+{
+    App::Document* doc = getDocument();
+    auto p1 = dynamic_cast<Part::Feature*>(doc->addObject("Part::Feature", "Shape1"));
+    p1->Shape.setValue(makeCircle(gp_Pnt(0.0, 0.0, 0.0)));
+    auto p2 = dynamic_cast<Part::Feature*>(doc->addObject("Part::Feature", "Shape2"));
+    p2->Shape.setValue(makeCircle(gp_Pnt(3.0, 4.0, 0.0)));
+
+    auto md = dynamic_cast<Measure::MeasureDistance*>(
+        doc->addObject("Measure::MeasureDistance", "Distance"));
+    md->Element1.setValue(p1, {"Edge1"});
+    md->Element2.setValue(p2, {"Edge1"});
+    doc->recompute();
+
+    // the measured shapes did not change, so the measurement keeps its result
+    md->Distance.setValue(0.0);
+    md->Distance.purgeTouched();
+    md->recomputeFeature();
+    EXPECT_DOUBLE_EQ(md->Distance.getValue(), 0.0);
+
+    p2->Shape.setValue(makeCircle(gp_Pnt(6.0, 8.0, 0.0)));
+    doc->recompute();
+    EXPECT_DOUBLE_EQ(md->Distance.getValue(), 10.0);
+}
 // NOLINTEND
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/BVH.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class BVHTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // wavy height field with facets of different sizes
+        const unsigned long num = 60;
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        for (unsigned long i = 0; i < num; i++) {
+            for (unsigned long j = 0; j < num; j++) {
+                float x = float(i) * (i < num / 2 ? 0.1F : 1.0F);
+                float y = float(j) * 0.5F;
+                points.emplace_back(x, y, std::sin(x) * std::cos(y));
+            }
+        }
+        for (unsigned long i = 0; i + 1 < num; i++) {
+            for (unsigned long j = 0; j + 1 < num; j++) {
+                MeshCore::PointIndex p = i * num + j;
+                facets.emplace_back(p, p + num, p + 1);
+                facets.emplace_back(p + 1, p + num, p + num + 1);
+            }
+        }
+        kernel.Adopt(points, facets);
+    }
+
+    void TearDown() override
+    {}
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(BVHTest, TestBVHEmpty)
+{
+    MeshCore::MeshKernel empty;
+    MeshCore::MeshFacetBVH bvh(empty);
+    EXPECT_TRUE(bvh.IsEmpty());
+
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    EXPECT_FALSE(bvh.NearestFacetOnRay(Base::Vector3f(0, 0, 0),
+                                       Base::Vector3f(0, 0, 1),
+                                       MeshCore::Mathf::PI,
+                                       res,
+                                       index));
+    EXPECT_FALSE(bvh.NearestFacetToPoint(Base::Vector3f(0, 0, 0), FLOAT_MAX, res, index));
+}
+
+TEST_F(BVHTest, TestBVHNearestFacetOnRay)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+    ASSERT_FALSE(bvh.IsEmpty());
+
+    MeshCore::MeshAlgorithm alg(kernel);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> pos(-5.0F, 40.0F);
+    std::uniform_real_distribution<float> dir(-1.0F, 1.0F);
+    int hits = 0;
+    for (int i = 0; i < 200; i++) {
+        Base::Vector3f pt(pos(gen), pos(gen), pos(gen) * 0.1F);
+        Base::Vector3f dr(dir(gen), dir(gen), dir(gen));
+
+        Base::Vector3f res1;
+        Base::Vector3f res2;
+        MeshCore::FacetIndex index1 {};
+        MeshCore::FacetIndex index2 {};
+        bool found1 = alg.NearestFacetOnRay(pt, dr, res1, index1);
+        bool found2 = alg.NearestFacetOnRay(pt, dr, bvh, res2, index2);
+        ASSERT_EQ(found1, found2);
+        if (found1) {
+            hits++;
+            EXPECT_EQ(index1, index2);
+            EXPECT_FLOAT_EQ(Base::Distance(res1, res2), 0.0F);
+        }
+    }
+    EXPECT_GT(hits, 0);
+}
+
+TEST_F(BVHTest, TestBVHForwardRay)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    // the mesh lies below the point
+    Base::Vector3f pt(10.0F, 10.0F, 5.0F);
+    EXPECT_TRUE(
+        bvh.NearestFacetOnRay(pt, Base::Vector3f(0, 0, -1), MeshCore::Mathf::PI, res, index, true));
+    EXPECT_LT(res.z, 1.1F);
+    EXPECT_FALSE(
+        bvh.NearestFacetOnRay(pt, Base::Vector3f(0, 0, 1), MeshCore::Mathf::PI, res, index, true));
+    EXPECT_TRUE(
+        bvh.NearestFacetOnRay(pt, Base::Vector3f(0, 0, 1), MeshCore::Mathf::PI, res, index, false));
+}
+
+TEST_F(BVHTest, TestBVHNearestPointFromPoint)
+{
+    MeshCore::MeshFacetBVH bvh(kernel);
+
+    MeshCore::MeshAlgorithm alg(kernel);
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> pos(-5.0F, 40.0F);
+    for (int i = 0; i < 200; i++) {
+        Base::Vector3f pt(pos(gen), pos(gen), pos(gen) * 0.1F);
+
+        Base::Vector3f res1;
+        Base::Vector3f res2;
+        MeshCore::FacetIndex index1 {};
+        MeshCore::FacetIndex index2 {};
+        ASSERT_TRUE(alg.NearestPointFromPoint(pt, index1, res1));
+        ASSERT_TRUE(alg.NearestPointFromPoint(pt, bvh, index2, res2));
+        EXPECT_FLOAT_EQ(Base::Distance(pt, res1), Base::Distance(pt, res2));
+    }
+
+    // nothing within the maximum distance
+    Base::Vector3f res;
+    MeshCore::FacetIndex index {};
+    EXPECT_FALSE(bvh.NearestFacetToPoint(Base::Vector3f(10.0F, 10.0F, 50.0F), 1.0F, res, index));
+}
+
+TEST_F(BVHTest, TestBVHOverlappingFacets)
+{
+    // a tilted copy of the height field
+    MeshCore::MeshKernel other(kernel);
+    Base::Matrix4D mat;
+    mat.rotX(0.3);
+    mat.move(Base::Vector3d(1.0, 2.0, 0.5));
+    other.Transform(mat);
+
+    MeshCore::MeshFacetBVH bvh1(kernel);
+    MeshCore::MeshFacetBVH bvh2(other);
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> pairs =
+        bvh1.GetOverlappingFacets(bvh2);
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> check;
+    for (MeshCore::FacetIndex i = 0; i < kernel.CountFacets(); i++) {
+        Base::BoundBox3f box1 = kernel.GetFacet(i).GetBoundBox();
+        for (MeshCore::FacetIndex j = 0; j < other.CountFacets(); j++) {
+            if (box1 && other.GetFacet(j).GetBoundBox()) {
+                check.emplace_back(i, j);
+            }
+        }
+    }
+    EXPECT_FALSE(pairs.empty());
+    EXPECT_EQ(pairs, check);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
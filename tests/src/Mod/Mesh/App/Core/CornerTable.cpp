@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <Mod/Mesh/App/Core/Algorithm.h>
+#include <Mod/Mesh/App/Core/CornerTable.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/TopoAlgorithm.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class CornerTableTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const unsigned long num = 10;
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        for (unsigned long i = 0; i < num; i++) {
+            for (unsigned long j = 0; j < num; j++) {
+                points.emplace_back(float(i), float(j), 0.0F);
+            }
+        }
+        for (unsigned long i = 0; i + 1 < num; i++) {
+            for (unsigned long j = 0; j + 1 < num; j++) {
+                MeshCore::PointIndex p = i * num + j;
+                facets.emplace_back(p, p + num, p + 1);
+                facets.emplace_back(p + 1, p + num, p + num + 1);
+            }
+        }
+        kernel.Adopt(points, facets);
+    }
+
+    void TearDown() override
+    {}
+
+    static void Compare(const MeshCore::MeshCornerTable& table1,
+                        const MeshCore::MeshCornerTable& table2,
+                        unsigned long numPoints)
+    {
+        std::vector<MeshCore::FacetIndex> facets1, facets2;
+        std::vector<MeshCore::PointIndex> points1, points2;
+        for (MeshCore::PointIndex i = 0; i < numPoints; i++) {
+            table1.GetFacets(i, facets1);
+            table2.GetFacets(i, facets2);
+            EXPECT_EQ(facets1, facets2);
+            table1.GetNeighbourPoints(i, points1);
+            table2.GetNeighbourPoints(i, points2);
+            EXPECT_EQ(points1, points2);
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(CornerTableTest, TestSameAsRefTables)
+{
+    const MeshCore::MeshCornerTable& table = kernel.GetCornerTable();
+    MeshCore::MeshRefPointToFacets pt2f(kernel);
+    MeshCore::MeshRefPointToPoints pt2p(kernel);
+
+    std::vector<MeshCore::FacetIndex> facets;
+    std::vector<MeshCore::PointIndex> points;
+    for (MeshCore::PointIndex i = 0; i < kernel.CountPoints(); i++) {
+        table.GetFacets(i, facets);
+        const std::set<MeshCore::FacetIndex>& refFacets = pt2f[i];
+        EXPECT_EQ(facets, std::vector<MeshCore::FacetIndex>(refFacets.begin(), refFacets.end()));
+        EXPECT_EQ(table.CountFacets(i), refFacets.size());
+
+        table.GetNeighbourPoints(i, points);
+        const std::set<MeshCore::PointIndex>& refPoints = pt2p[i];
+        EXPECT_EQ(points, std::vector<MeshCore::PointIndex>(refPoints.begin(), refPoints.end()));
+    }
+
+    // facets of an edge
+    const MeshCore::MeshFacet& face = kernel.GetFacets()[0];
+    std::vector<MeshCore::FacetIndex> edge = table.GetFacets(face._aulPoints[1], face._aulPoints[2]);
+    EXPECT_EQ(edge, std::vector<MeshCore::FacetIndex>({0, 1}));
+
+    // two rings around a point
+    std::set<MeshCore::PointIndex> ring = table.NeighbourPoints({55}, 2);
+    EXPECT_EQ(pt2f.NeighbourPoints({55}, 2), ring);
+}
+
+TEST_F(CornerTableTest, TestIncrementalUpdate)
+{
+    const MeshCore::MeshCornerTable& table = kernel.GetCornerTable();
+    MeshCore::MeshTopoAlgorithm topo(kernel);
+
+    topo.SwapEdge(0, 1);
+    topo.SplitEdge(20, 21, Base::Vector3f(3.5F, 0.5F, 0.0F));
+    topo.InsertVertex(50, kernel.GetFacet(50).GetGravityPoint());
+    ASSERT_TRUE(kernel.HasCornerTable());
+
+    MeshCore::MeshCornerTable check(kernel);
+    Compare(table, check, kernel.CountPoints());
+}
+
+TEST_F(CornerTableTest, TestInvalidation)
+{
+    kernel.GetCornerTable();
+    EXPECT_TRUE(kernel.HasCornerTable());
+
+    MeshCore::MeshFacetArray facets;
+    facets.emplace_back(0, 1, 10);
+    kernel.AddFacets(facets, false);
+    EXPECT_FALSE(kernel.HasCornerTable());
+
+    kernel.GetCornerTable();
+    std::vector<MeshCore::FacetIndex> remove {0, 1};
+    kernel.DeleteFacets(remove);
+    EXPECT_FALSE(kernel.HasCornerTable());
+
+    MeshCore::MeshCornerTable check(kernel);
+    Compare(kernel.GetCornerTable(), check, kernel.CountPoints());
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
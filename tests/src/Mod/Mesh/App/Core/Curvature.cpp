@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <Mod/Mesh/App/Core/Curvature.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/WildMagic4/Wm4MeshCurvature.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class CurvatureTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a noisy part of a sphere
+        const unsigned long num = 40;
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<float> noise(-0.002F, 0.002F);
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        for (unsigned long i = 0; i < num; i++) {
+            for (unsigned long j = 0; j < num; j++) {
+                float u = 0.3F + 2.5F * float(i) / float(num);
+                float v = 3.0F * float(j) / float(num);
+                float r = 2.0F + noise(gen);
+                points.emplace_back(r * std::sin(u) * std::cos(v),
+                                    r * std::sin(u) * std::sin(v),
+                                    r * std::cos(u));
+            }
+        }
+        for (unsigned long i = 0; i + 1 < num; i++) {
+            for (unsigned long j = 0; j + 1 < num; j++) {
+                MeshCore::PointIndex p = i * num + j;
+                facets.emplace_back(p, p + num, p + 1);
+                facets.emplace_back(p + 1, p + num, p + num + 1);
+            }
+        }
+        kernel.Adopt(points, facets, true);
+    }
+
+    void TearDown() override
+    {}
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(CurvatureTest, TestCurvatureEmpty)
+{
+    MeshCore::MeshKernel empty;
+    MeshCore::MeshCurvature meshCurv(empty);
+    meshCurv.ComputePerVertex();
+    EXPECT_TRUE(meshCurv.GetCurvature().empty());
+}
+
+TEST_F(CurvatureTest, TestCurvatureSameAsWm4)
+{
+    std::vector<Wm4::Vector3<double>> aPnts;
+    for (const auto& it : kernel.GetPoints()) {
+        aPnts.emplace_back(it.x, it.y, it.z);
+    }
+    std::vector<int> aIdx;
+    for (const auto& it : kernel.GetFacets()) {
+        for (MeshCore::PointIndex point : it._aulPoints) {
+            aIdx.push_back(int(point));
+        }
+    }
+    Wm4::MeshCurvature<double> wm4Curv(int(aPnts.size()),
+                                       aPnts.data(),
+                                       int(aIdx.size() / 3),
+                                       aIdx.data());
+
+    MeshCore::MeshCurvature meshCurv(kernel);
+    meshCurv.ComputePerVertex();
+    const std::vector<MeshCore::CurvatureInfo>& curv = meshCurv.GetCurvature();
+    ASSERT_EQ(curv.size(), kernel.CountPoints());
+    for (std::size_t i = 0; i < curv.size(); i++) {
+        EXPECT_EQ(curv[i].fMaxCurvature, float(wm4Curv.GetMaxCurvatures()[i]));
+        EXPECT_EQ(curv[i].fMinCurvature, float(wm4Curv.GetMinCurvatures()[i]));
+        EXPECT_EQ(curv[i].cMaxCurvDir.x, float(wm4Curv.GetMaxDirections()[i].X()));
+        EXPECT_EQ(curv[i].cMinCurvDir.z, float(wm4Curv.GetMinDirections()[i].Z()));
+    }
+
+    // the curvature of a sphere with radius 2 away from the border
+    const MeshCore::CurvatureInfo& ci = curv[20 * 40 + 20];
+    EXPECT_NEAR(ci.fMaxCurvature, 0.5F, 0.1F);
+    EXPECT_NEAR(ci.fMinCurvature, 0.5F, 0.1F);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
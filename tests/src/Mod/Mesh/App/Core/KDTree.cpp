@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
 #include <Mod/Mesh/App/Core/KDTree.h>
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
@@ -88,4 +90,84 @@ TEST_F(KDTreeTest, TestKDTreeFindRange)
     tree.FindInRange(Base::Vector3f(0.5F, 0, 0), 0.6F, index);
     EXPECT_EQ(index, result);
 }
+
+TEST_F(KDTreeTest, TestKDTreeNearestK)
+{
+    MeshCore::MeshKDTree tree(GetPoints());
+
+    std::vector<MeshCore::PointIndex> index;
+    tree.FindNearestK(Base::Vector3f(0.1F, 0.2F, 0.3F), 3, index);
+    std::vector<MeshCore::PointIndex> result = {0, 1, 2};
+    EXPECT_EQ(index, result);
+
+    tree.FindNearestK(Base::Vector3f(0, 0, 0), 20, index);
+    EXPECT_EQ(index.size(), 8);
+    EXPECT_EQ(index.front(), 0);
+    EXPECT_EQ(index.back(), 7);
+}
+
+TEST_F(KDTreeTest, TestKDTreeBatchQueries)
+{
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<float> pos(-1.0F, 1.0F);
+    std::vector<Base::Vector3f> cloud;
+    for (int i = 0; i < 5000; i++) {
+        cloud.emplace_back(pos(gen), pos(gen), pos(gen));
+    }
+    std::vector<Base::Vector3f> queries;
+    for (int i = 0; i < 3000; i++) {
+        queries.emplace_back(pos(gen), pos(gen), pos(gen));
+    }
+    queries.push_back(cloud[42]);
+
+    MeshCore::MeshKDTree tree(cloud);
+
+    std::vector<MeshCore::PointIndex> indices;
+    std::vector<float> dists;
+    tree.FindNearest(queries, indices, dists);
+    ASSERT_EQ(indices.size(), queries.size());
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        // brute force check of the distance
+        float best = FLOAT_MAX;
+        for (const auto& it : cloud) {
+            best = std::min(best, Base::Distance(queries[i], it));
+        }
+        EXPECT_FLOAT_EQ(dists[i], best);
+        EXPECT_FLOAT_EQ(Base::Distance(queries[i], cloud[indices[i]]), best);
+    }
+
+    tree.FindNearest(queries, 0.01F, indices, dists);
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        Base::Vector3f n;
+        float dist {};
+        EXPECT_EQ(indices[i], tree.FindNearest(queries[i], 0.01F, n, dist));
+    }
+
+    tree.FindExact(queries, indices);
+    EXPECT_EQ(indices.back(), 42);
+
+    std::vector<std::vector<MeshCore::PointIndex>> ranges;
+    tree.FindInRange(queries, 0.1F, ranges);
+    ASSERT_EQ(ranges.size(), queries.size());
+    for (std::size_t i = 0; i < queries.size(); i += 100) {
+        std::vector<MeshCore::PointIndex> index;
+        tree.FindInRange(queries[i], 0.1F, index);
+        EXPECT_EQ(ranges[i], index);
+    }
+
+    std::vector<std::vector<MeshCore::PointIndex>> nearest;
+    tree.FindNearestK(queries, 10, nearest);
+    ASSERT_EQ(nearest.size(), queries.size());
+    for (std::size_t i = 0; i < queries.size(); i += 100) {
+        std::vector<float> all;
+        for (const auto& it : cloud) {
+            all.push_back(Base::Distance(queries[i], it));
+        }
+        std::sort(all.begin(), all.end());
+        ASSERT_EQ(nearest[i].size(), 10);
+        for (std::size_t j = 0; j < 10; j++) {
+            EXPECT_FLOAT_EQ(Base::Distance(queries[i], cloud[nearest[i][j]]), all[j]);
+        }
+    }
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <Mod/Mesh/App/Core/Curvature.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <Mod/Mesh/App/Core/Segmentation.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace
+{
+// Forces the segments to be grown one after another
+template<class Segment>
+class SerialSegment: public Segment
+{
+public:
+    using Segment::Segment;
+    bool IsLocal() const override
+    {
+        return false;
+    }
+};
+}  // namespace
+
+class SegmentationTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const unsigned long num = 120;
+        MeshCore::MeshPointArray points;
+        MeshCore::MeshFacetArray facets;
+        for (unsigned long i = 0; i < num; i++) {
+            for (unsigned long j = 0; j < num; j++) {
+                points.emplace_back(float(i), float(j), 0.0F);
+            }
+        }
+        for (unsigned long i = 0; i + 1 < num; i++) {
+            for (unsigned long j = 0; j + 1 < num; j++) {
+                MeshCore::PointIndex p = i * num + j;
+                facets.emplace_back(p, p + num, p + 1);
+                facets.emplace_back(p + 1, p + num, p + num + 1);
+            }
+        }
+        kernel.Adopt(points, facets, true);
+
+        // patches of flat, curved and noisy points
+        std::mt19937 gen(3);
+        std::uniform_int_distribution<int> dist(0, 9);
+        curvature.resize(kernel.CountPoints());
+        for (unsigned long i = 0; i < num; i++) {
+            for (unsigned long j = 0; j < num; j++) {
+                MeshCore::CurvatureInfo& ci = curvature[i * num + j];
+                int value = dist(gen);
+                if (value == 0) {
+                    ci.fMinCurvature = 5.0F;
+                    ci.fMaxCurvature = 5.0F;
+                }
+                else if ((i / 10 + j / 15) % 2 == 0) {
+                    ci.fMinCurvature = 0.0F;
+                    ci.fMaxCurvature = 0.0F;
+                }
+                else {
+                    ci.fMinCurvature = 0.0F;
+                    ci.fMaxCurvature = 0.5F;
+                }
+            }
+        }
+    }
+
+    void TearDown() override
+    {}
+
+    MeshCore::MeshKernel kernel;
+    std::vector<MeshCore::CurvatureInfo> curvature;
+};
+
+TEST_F(SegmentationTest, TestLocalSegmentsSameAsSerial)
+{
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> local;
+    local.push_back(std::make_shared<MeshCore::MeshCurvaturePlanarSegment>(curvature, 3, 0.1F));
+    local.push_back(
+        std::make_shared<MeshCore::MeshCurvatureCylindricalSegment>(curvature, 3, 0.1F, 0.1F, 0.5F));
+
+    std::vector<MeshCore::MeshSurfaceSegmentPtr> serial;
+    serial.push_back(
+        std::make_shared<SerialSegment<MeshCore::MeshCurvaturePlanarSegment>>(curvature, 3, 0.1F));
+    serial.push_back(
+        std::make_shared<SerialSegment<MeshCore::MeshCurvatureCylindricalSegment>>(curvature,
+                                                                                   3,
+                                                                                   0.1F,
+                                                                                   0.1F,
+                                                                                   0.5F));
+
+    MeshCore::MeshSegmentAlgorithm finder(kernel);
+    finder.FindSegments(local);
+    finder.FindSegments(serial);
+
+    for (std::size_t i = 0; i < local.size(); i++) {
+        std::vector<MeshCore::MeshSegment> segments1 = local[i]->GetSegments();
+        std::vector<MeshCore::MeshSegment> segments2 = serial[i]->GetSegments();
+        EXPECT_FALSE(segments1.empty());
+        ASSERT_EQ(segments1.size(), segments2.size());
+        for (std::size_t j = 0; j < segments1.size(); j++) {
+            std::sort(segments2[j].begin(), segments2[j].end());
+            EXPECT_EQ(segments1[j], segments2[j]);
+        }
+    }
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
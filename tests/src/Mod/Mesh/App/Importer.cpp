@@ -1,6 +1,14 @@
 #include <gtest/gtest.h>
 #include <Base/FileInfo.h>
 #include <Mod/Mesh/App/Core/IO/Reader3MF.h>
+#include <Mod/Mesh/App/Core/IO/ReaderGLTF.h>
+#include <Mod/Mesh/App/Core/IO/ReaderPLY.h>
+#include <Mod/Mesh/App/Core/IO/Writer3MF.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <zipios++/fcoll.h>
 
@@ -37,4 +45,232 @@ TEST_F(ImporterTest, Test3MF)
     EXPECT_EQ(mesh2.CountEdges(), 1950);
     EXPECT_EQ(mesh2.CountFacets(), 1300);
 }
+
+TEST_F(ImporterTest, TestWriteRead3MF)
+{
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    const unsigned long num = 50;
+    for (unsigned long i = 0; i < num; i++) {
+        for (unsigned long j = 0; j < num; j++) {
+            points.emplace_back(float(i) * 0.25F, float(j) * 0.5F, float(i * j) * 0.125F);
+        }
+    }
+    for (unsigned long i = 0; i + 1 < num; i++) {
+        for (unsigned long j = 0; j + 1 < num; j++) {
+            MeshCore::PointIndex p = i * num + j;
+            facets.emplace_back(p, p + num, p + 1);
+            facets.emplace_back(p + 1, p + num, p + num + 1);
+        }
+    }
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(1.0, 2.0, 3.0));
+
+    std::stringstream str;
+    {
+        MeshCore::Writer3MF writer(str);
+        EXPECT_TRUE(writer.AddMesh(kernel, mat));
+        EXPECT_TRUE(writer.Save());
+    }
+
+    MeshCore::Reader3MF reader(str);
+    EXPECT_TRUE(reader.Load());
+    std::vector<int> ids = reader.GetMeshIds();
+    ASSERT_EQ(ids.size(), 1);
+
+    const MeshCore::MeshKernel& mesh = reader.GetMesh(ids[0]);
+    ASSERT_EQ(mesh.CountPoints(), kernel.CountPoints());
+    ASSERT_EQ(mesh.CountFacets(), kernel.CountFacets());
+    for (MeshCore::PointIndex i = 0; i < mesh.CountPoints(); i++) {
+        EXPECT_EQ(mesh.GetPoint(i), kernel.GetPoint(i));
+    }
+    for (MeshCore::FacetIndex i = 0; i < mesh.CountFacets(); i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(mesh.GetFacets()[i]._aulPoints[j], kernel.GetFacets()[i]._aulPoints[j]);
+        }
+    }
+    EXPECT_EQ(reader.GetTransform(ids[0]), mat);
+}
+
+TEST_F(ImporterTest, TestGLB)
+{
+    // A unit square in the XZ plane made of two triangles, translated by a node
+    const float points[] = {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0};
+    const uint16_t indices[] = {0, 1, 2, 0, 2, 3};
+
+    std::string json = R"({"asset":{"version":"2.0"},"scene":0,"scenes":[{"nodes":[0]}],)"
+                       R"("nodes":[{"mesh":0,"translation":[0,0,2]}],)"
+                       R"("meshes":[{"primitives":[{"attributes":{"POSITION":0},"indices":1}]}],)"
+                       R"("accessors":[{"bufferView":0,"componentType":5126,"count":4,"type":"VEC3"},)"
+                       R"({"bufferView":1,"componentType":5123,"count":6,"type":"SCALAR"}],)"
+                       R"("bufferViews":[{"buffer":0,"byteOffset":0,"byteLength":48},)"
+                       R"({"buffer":0,"byteOffset":48,"byteLength":12}],)"
+                       R"("buffers":[{"byteLength":60}]})";
+    json.append((4 - json.size() % 4) % 4, ' ');
+
+    std::string bin(sizeof(points) + sizeof(indices), '\0');
+    std::memcpy(&bin[0], points, sizeof(points));
+    std::memcpy(&bin[sizeof(points)], indices, sizeof(indices));
+
+    auto writeUInt32 = [](std::ostream& out, uint32_t value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    std::string file = Base::FileInfo::getTempFileName("mesh.glb");
+    {
+        std::ofstream out(file, std::ios::binary);
+        writeUInt32(out, 0x46546C67);
+        writeUInt32(out, 2);
+        writeUInt32(out, static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size()));
+        writeUInt32(out, static_cast<uint32_t>(json.size()));
+        writeUInt32(out, 0x4E4F534A);
+        out << json;
+        writeUInt32(out, static_cast<uint32_t>(bin.size()));
+        writeUInt32(out, 0x004E4942);
+        out << bin;
+    }
+
+    MeshCore::MeshKernel mesh;
+    MeshCore::ReaderGLTF reader(mesh);
+    EXPECT_EQ(reader.Load(file), true);
+    Base::FileInfo(file).deleteFile();
+
+    EXPECT_EQ(mesh.CountPoints(), 4);
+    EXPECT_EQ(mesh.CountFacets(), 2);
+
+    // Y-up meters become Z-up millimeters
+    Base::BoundBox3f box = mesh.GetBoundBox();
+    EXPECT_FLOAT_EQ(box.MinX, 0.0F);
+    EXPECT_FLOAT_EQ(box.MaxX, 1000.0F);
+    EXPECT_FLOAT_EQ(box.MinY, -2000.0F);
+    EXPECT_FLOAT_EQ(box.MaxY, -2000.0F);
+    EXPECT_FLOAT_EQ(box.MinZ, 0.0F);
+    EXPECT_FLOAT_EQ(box.MaxZ, 1000.0F);
+}
+
+TEST_F(ImporterTest, TestBinarySTLFromBuffer)
+{
+    // A unit square made of two triangles sharing an edge
+    const float facets[2][12] = {{0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0},
+                                 {0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 0}};
+    std::string stl(80, ' ');
+    uint32_t count = 2;
+    stl.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (const auto& facet : facets) {
+        stl.append(reinterpret_cast<const char*>(facet), sizeof(facet));
+        stl.append(2, '\0');
+    }
+
+    MeshCore::MeshKernel mesh;
+    MeshCore::MeshInput input(mesh);
+    EXPECT_EQ(input.LoadBinarySTL(stl.data(), stl.size()), true);
+    EXPECT_EQ(mesh.CountPoints(), 4);
+    EXPECT_EQ(mesh.CountFacets(), 2);
+
+    // the facets are the same as when reading from a stream
+    MeshCore::MeshKernel streamMesh;
+    std::istringstream str(stl);
+    EXPECT_EQ(MeshCore::MeshInput(streamMesh).LoadBinarySTL(str), true);
+    ASSERT_EQ(streamMesh.CountFacets(), 2);
+    for (MeshCore::FacetIndex i = 0; i < 2; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(mesh.GetFacet(i)._aclPoints[j], streamMesh.GetFacet(i)._aclPoints[j]);
+        }
+    }
+
+    // a truncated file is rejected
+    EXPECT_EQ(input.LoadBinarySTL(stl.data(), stl.size() - 10), false);
+}
+
+TEST_F(ImporterTest, TestBinaryPLY)
+{
+    // A unit square made of two triangles with vertex colors
+    MeshCore::MeshPointArray points;
+    points.emplace_back(0.0F, 0.0F, 0.0F);
+    points.emplace_back(1.0F, 0.0F, 0.0F);
+    points.emplace_back(1.0F, 1.0F, 0.0F);
+    points.emplace_back(0.0F, 1.0F, 0.0F);
+    MeshCore::MeshFacetArray facets;
+    facets.emplace_back(0, 1, 2);
+    facets.emplace_back(0, 2, 3);
+    MeshCore::MeshKernel mesh;
+    mesh.Adopt(points, facets);
+
+    MeshCore::Material mat;
+    mat.binding = MeshCore::MeshIO::PER_VERTEX;
+    mat.diffuseColor = {App::Color(1.0F, 0.0F, 0.0F),
+                        App::Color(0.0F, 1.0F, 0.0F),
+                        App::Color(0.0F, 0.0F, 1.0F),
+                        App::Color(1.0F, 1.0F, 1.0F)};
+
+    std::stringstream str;
+    EXPECT_EQ(MeshCore::MeshOutput(mesh, &mat).SaveBinaryPLY(str), true);
+
+    MeshCore::MeshKernel result;
+    MeshCore::Material resultMat;
+    EXPECT_EQ(MeshCore::ReaderPLY(result, &resultMat).Load(str), true);
+    ASSERT_EQ(result.CountPoints(), 4);
+    ASSERT_EQ(result.CountFacets(), 2);
+    for (MeshCore::FacetIndex i = 0; i < 2; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(result.GetFacets()[i]._aulPoints[j], mesh.GetFacets()[i]._aulPoints[j]);
+        }
+    }
+    for (MeshCore::PointIndex i = 0; i < 4; i++) {
+        EXPECT_EQ(result.GetPoint(i), mesh.GetPoint(i));
+    }
+    EXPECT_EQ(resultMat.binding, MeshCore::MeshIO::PER_VERTEX);
+    EXPECT_EQ(resultMat.diffuseColor, mat.diffuseColor);
+}
+
+TEST_F(ImporterTest, TestBigEndianPLY)
+{
+    // A triangle with an additional vertex property, 16-bit indices and a face property
+    std::string ply = "ply\n"
+                      "format binary_big_endian 1.0\n"
+                      "element vertex 3\n"
+                      "property double x\n"
+                      "property double y\n"
+                      "property double z\n"
+                      "property float quality\n"
+                      "element face 1\n"
+                      "property list uchar ushort vertex_indices\n"
+                      "property uchar flags\n"
+                      "end_header\n";
+
+    auto writeBigEndian = [&ply](const auto& value) {
+        const char* data = reinterpret_cast<const char*>(&value);
+        for (std::size_t i = sizeof(value); i > 0; i--) {
+            ply.push_back(data[i - 1]);
+        }
+    };
+
+    const double coords[3][3] = {{0, 0, 0}, {2, 0, 0}, {0, 3, 0}};
+    for (const auto& coord : coords) {
+        for (double value : coord) {
+            writeBigEndian(value);
+        }
+        writeBigEndian(0.5F);
+    }
+    writeBigEndian(uint8_t(3));
+    writeBigEndian(uint16_t(0));
+    writeBigEndian(uint16_t(1));
+    writeBigEndian(uint16_t(2));
+    writeBigEndian(uint8_t(0));
+
+    MeshCore::MeshKernel mesh;
+    std::istringstream str(ply);
+    EXPECT_EQ(MeshCore::ReaderPLY(mesh).Load(str), true);
+    ASSERT_EQ(mesh.CountPoints(), 3);
+    ASSERT_EQ(mesh.CountFacets(), 1);
+    EXPECT_FLOAT_EQ(mesh.GetPoint(1).x, 2.0F);
+    EXPECT_FLOAT_EQ(mesh.GetPoint(2).y, 3.0F);
+
+    // a truncated file is rejected
+    std::istringstream truncated(ply.substr(0, ply.size() - 4));
+    EXPECT_EQ(MeshCore::ReaderPLY(mesh).Load(truncated), false);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
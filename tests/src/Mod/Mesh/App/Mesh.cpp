@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <Mod/Mesh/App/Mesh.h>
+#include <Mod/Mesh/App/Core/Decimation.h>
+#include <Mod/Mesh/App/Core/Degeneration.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
 #include <Mod/Mesh/App/Core/Grid.h>
 
 // NOLINTBEGIN(cppcoreguidelines-*,readability-*)
@@ -95,4 +98,145 @@ TEST(MeshTest, TestGrid2OfAlmostPlanarMesh)
     EXPECT_EQ(countY, 1);
     EXPECT_EQ(countZ, 1);
 }
+
+TEST(MeshTest, TestEvalDefects)
+{
+    MeshCore::MeshPointArray points;
+    points.emplace_back(0.0F, 0.0F, 0.0F);
+    points.emplace_back(1.0F, 0.0F, 0.0F);
+    points.emplace_back(0.0F, 1.0F, 0.0F);
+    points.emplace_back(1.0F, 1.0F, 0.0F);
+    points.emplace_back(2.0F, 2.0F, 0.0F);
+    points.emplace_back(1.0F, 1.0F, 0.0F);
+
+    MeshCore::MeshFacetArray facets;
+    facets.emplace_back(0, 1, 2);
+    facets.emplace_back(2, 1, 3);
+    facets.emplace_back(2, 1, 3);  // duplicated
+    facets.emplace_back(0, 3, 4);  // degenerated
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets, true);
+
+    MeshCore::MeshEvalDefects eval(kernel, 1.0e-6F, true);
+    EXPECT_FALSE(eval.Evaluate());
+    EXPECT_EQ(eval.GetDuplicatedFacets(), MeshCore::MeshEvalDuplicateFacets(kernel).GetIndices());
+    EXPECT_FALSE(eval.GetDuplicatedFacets().empty());
+    EXPECT_EQ(eval.GetDuplicatedPoints(), MeshCore::MeshEvalDuplicatePoints(kernel).GetIndices());
+    EXPECT_FALSE(eval.GetDuplicatedPoints().empty());
+    EXPECT_EQ(eval.GetDegeneratedFacets(),
+              MeshCore::MeshEvalDegeneratedFacets(kernel, 1.0e-6F).GetIndices());
+    EXPECT_FALSE(eval.GetDegeneratedFacets().empty());
+    EXPECT_EQ(eval.GetFlippedFacets(), MeshCore::MeshEvalOrientation(kernel).GetIndices());
+    EXPECT_EQ(eval.GetIndexDefect(), MeshCore::MeshEvalDefects::IndexDefect::None);
+
+    kernel.Clear();
+    kernel.AddFacet(MeshCore::MeshGeomFacet(Base::Vector3f(0, 0, 0),
+                                            Base::Vector3f(1, 0, 0),
+                                            Base::Vector3f(0, 1, 0)));
+    MeshCore::MeshEvalDefects none(kernel, 1.0e-6F, true);
+    EXPECT_TRUE(none.Evaluate());
+}
+
+TEST(MeshTest, TestBoundBoxAndNormalsOfLargeMesh)
+{
+    // big enough to be split into several blocks
+    const unsigned long num = 100000;
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    points.reserve(2 * num);
+    for (unsigned long i = 0; i < num; i++) {
+        float z = float(i % 7);
+        points.emplace_back(float(i), 0.0F, z);
+        points.emplace_back(float(i), 1.0F, z);
+    }
+    for (unsigned long i = 0; i + 1 < num; i++) {
+        MeshCore::PointIndex p = 2 * i;
+        facets.emplace_back(p, p + 2, p + 1);
+        facets.emplace_back(p + 1, p + 2, p + 3);
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets);
+
+    Base::BoundBox3f box = kernel.GetBoundBox();
+    EXPECT_FLOAT_EQ(box.MinX, 0.0F);
+    EXPECT_FLOAT_EQ(box.MaxX, float(num - 1));
+    EXPECT_FLOAT_EQ(box.MinY, 0.0F);
+    EXPECT_FLOAT_EQ(box.MaxY, 1.0F);
+    EXPECT_FLOAT_EQ(box.MinZ, 0.0F);
+    EXPECT_FLOAT_EQ(box.MaxZ, 6.0F);
+
+    Base::Matrix4D mat;
+    mat.move(Base::Vector3d(1.0, 2.0, 3.0));
+    kernel.Transform(mat);
+    box = kernel.GetBoundBox();
+    EXPECT_FLOAT_EQ(box.MinX, 1.0F);
+    EXPECT_FLOAT_EQ(box.MaxY, 3.0F);
+    EXPECT_FLOAT_EQ(box.MaxZ, 9.0F);
+    EXPECT_FLOAT_EQ(kernel.GetPoint(2 * num - 1).x, float(num));
+
+    std::vector<Base::Vector3f> normals = kernel.CalcVertexNormals();
+    ASSERT_EQ(normals.size(), 2 * num);
+    for (MeshCore::PointIndex i = 0; i < 2 * num; i++) {
+        Base::Vector3f expected;
+        for (MeshCore::FacetIndex j = (i / 2 > 0 ? 2 * (i / 2 - 1) : 0);
+             j < std::min<MeshCore::FacetIndex>(2 * (i / 2 + 1), kernel.CountFacets());
+             j++) {
+            const MeshCore::MeshFacet& face = kernel.GetFacets()[j];
+            if (face._aulPoints[0] == i || face._aulPoints[1] == i || face._aulPoints[2] == i) {
+                expected += kernel.GetFacet(j).GetNormal() * (2.0F * kernel.GetFacet(j).Area());
+            }
+        }
+        ASSERT_NEAR((normals[i] - expected).Length(), 0.0F, 1.0e-3F) << "point " << i;
+    }
+}
+
+TEST(MeshTest, TestDecimatePartitioned)
+{
+    // curved height field
+    const unsigned long num = 80;
+    MeshCore::MeshPointArray points;
+    MeshCore::MeshFacetArray facets;
+    for (unsigned long i = 0; i < num; i++) {
+        for (unsigned long j = 0; j < num; j++) {
+            float x = float(i) * 0.1F;
+            float y = float(j) * 0.1F;
+            points.emplace_back(x, y, std::sin(x) * std::cos(y));
+        }
+    }
+    for (unsigned long i = 0; i + 1 < num; i++) {
+        for (unsigned long j = 0; j + 1 < num; j++) {
+            MeshCore::PointIndex p = i * num + j;
+            facets.emplace_back(p, p + num, p + 1);
+            facets.emplace_back(p + 1, p + num, p + num + 1);
+        }
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel.Adopt(points, facets);
+    Base::BoundBox3f box = kernel.GetBoundBox();
+    MeshCore::MeshKernel serial = kernel;
+
+    const int target = 2000;
+    MeshCore::MeshSimplify simplify(kernel);
+    simplify.setPartitionSize(1000);
+    simplify.simplify(target);
+
+    MeshCore::MeshSimplify(serial).simplify(target);
+
+    EXPECT_LE(kernel.CountFacets(), target + 100);
+    EXPECT_GE(kernel.CountFacets(), target / 2);
+    EXPECT_TRUE(MeshCore::MeshEvalRangePoint(kernel).Evaluate());
+    EXPECT_TRUE(MeshCore::MeshEvalTopology(kernel).Evaluate());
+    EXPECT_TRUE(MeshCore::MeshEvalOrientation(kernel).Evaluate());
+    EXPECT_NEAR(float(kernel.CountFacets()), float(serial.CountFacets()), 0.1F * float(target));
+
+    // the border of the height field is kept
+    Base::BoundBox3f result = kernel.GetBoundBox();
+    EXPECT_FLOAT_EQ(result.MinX, box.MinX);
+    EXPECT_FLOAT_EQ(result.MaxX, box.MaxX);
+    EXPECT_FLOAT_EQ(result.MinY, box.MinY);
+    EXPECT_FLOAT_EQ(result.MaxY, box.MaxY);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -108,6 +108,27 @@ TEST_F(AttacherTest, TestCalculateAttachedPlacement)
     EXPECT_EQ(placement.getPosition().z, 0);
 }
 
+TEST_F(AttacherTest, TestCalculateAttachedPlacements)
+{
+    // Arrange
+    _boxes[2]->AttachmentSupport.setValue(_boxes[0]);
+    _boxes[2]->MapMode.setValue("ObjectXZ");
+    _boxes[2]->recomputeFeature();
+    std::vector<AttachEngine*> engines {&_boxes[1]->attacher(), &_boxes[2]->attacher()};
+    std::vector<Base::Placement> origPlacements(2);
+    auto expected1 = engines[0]->calculateAttachedPlacement(origPlacements[0]);
+    auto expected2 = engines[1]->calculateAttachedPlacement(origPlacements[1]);
+
+    // Act
+    auto placements = AttachEngine::calculateAttachedPlacements(engines, origPlacements);
+
+    // Assert
+    ASSERT_EQ(placements.size(), 2);
+    EXPECT_TRUE(placements[0].isSame(expected1));
+    EXPECT_TRUE(placements[1].isSame(expected2));
+    EXPECT_FALSE(placements[0].isSame(placements[1]));
+}
+
 TEST_F(AttacherTest, TestAllStringModesValid)
 {
     // Arrange
@@ -4,6 +4,7 @@
 
 #include <boost/core/ignore_unused.hpp>
 #include "Mod/Part/App/FeaturePartCommon.h"
+#include <App/Link.h>
 #include <src/App/InitApplication.h>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include "PartTestHelpers.h"
@@ -230,3 +231,95 @@ TEST_F(FeaturePartTest, getComplexElementTypes)
     EXPECT_STREQ(types[1], "Edge");
     EXPECT_STREQ(types[2], "Vertex");
 }
+
+TEST_F(FeaturePartTest, resultCacheReusesUnchangedResult)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+    hGrp->SetBool("ResultCache", true);
+    _common->Base.setValue(_boxes[0]);
+    _common->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    TopoDS_Shape first = _common->Shape.getShape().getShape();
+
+    // Act
+    _common->touch();
+    _doc->recompute();
+    TopoDS_Shape second = _common->Shape.getShape().getShape();
+    _boxes[1]->Length.setValue(_boxes[1]->Length.getValue() + 1.0);
+    _doc->recompute();
+    TopoDS_Shape third = _common->Shape.getShape().getShape();
+    hGrp->RemoveBool("ResultCache");
+
+    // Assert
+    EXPECT_TRUE(first.IsSame(second));
+    EXPECT_FALSE(first.IsSame(third));
+    EXPECT_FALSE(_common->Shape.getShape().getElementMap().empty());
+}
+
+TEST_F(FeaturePartTest, getTopoShapeReturnsCurrentShape)
+{
+    // Arrange
+    _doc->recompute();
+    auto first = Feature::getTopoShape(_boxes[0], "Face1", true);
+
+    // Act
+    auto second = Feature::getTopoShape(_boxes[0], "Face1", true);
+    _boxes[0]->Length.setValue(_boxes[0]->Length.getValue() + 1.0);
+    _doc->recompute();
+    auto third = Feature::getTopoShape(_boxes[0], "Face1", true);
+
+    // Assert
+    EXPECT_TRUE(first.getShape().IsSame(second.getShape()));
+    EXPECT_FALSE(first.getShape().IsSame(third.getShape()));
+    EXPECT_TRUE(third.getShape().IsSame(
+        _boxes[0]->Shape.getShape().getSubTopoShape("Face1").getShape()));
+}
+
+TEST_F(FeaturePartTest, resultCacheKeepsReproducedShape)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+    hGrp->SetBool("ResultCache", true);
+    hGrp->SetInt("ResultCacheSize", 0);  // Nothing stays in the cache, so everything recomputes
+    _common->Base.setValue(_boxes[0]);
+    _common->Tool.setValue(_boxes[1]);
+    _doc->recompute();
+    TopoDS_Shape firstBox = _boxes[1]->Shape.getShape().getShape();
+    TopoDS_Shape first = _common->Shape.getShape().getShape();
+
+    // Act
+    _boxes[1]->touch();
+    _doc->recompute();
+    TopoDS_Shape secondBox = _boxes[1]->Shape.getShape().getShape();
+    TopoDS_Shape second = _common->Shape.getShape().getShape();
+    hGrp->RemoveBool("ResultCache");
+    hGrp->RemoveInt("ResultCacheSize");
+
+    // Assert
+    EXPECT_TRUE(firstBox.IsSame(secondBox));
+    EXPECT_TRUE(first.IsSame(second));
+}
+
+TEST_F(FeaturePartTest, getTopoShapeOfExternalLinkFollowsSource)
+{
+    // Arrange
+    App::Document* consumer = App::GetApplication().newDocument(
+        App::GetApplication().getUniqueDocumentName("consumer").c_str(),
+        "testUser");
+    auto link = dynamic_cast<App::Link*>(consumer->addObject("App::Link"));
+    link->LinkedObject.setValue(_boxes[0]);
+    TopoShape first = Feature::getTopoShape(link);
+
+    // Act
+    _boxes[0]->Length.setValue(4);
+    _doc->recompute();
+    TopoShape second = Feature::getTopoShape(link);
+    App::GetApplication().closeDocument(consumer->getName());
+
+    // Assert
+    EXPECT_DOUBLE_EQ(getVolume(first.getShape()), 6.0);
+    EXPECT_DOUBLE_EQ(getVolume(second.getShape()), 24.0);
+}
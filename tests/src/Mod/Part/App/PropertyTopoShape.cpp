@@ -2,7 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <BRep_Tool.hxx>
 #include <BRepFilletAPI_MakeFillet.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
 #include "Mod/Part/App/FeaturePartCommon.h"
 #include "Mod/Part/App/PropertyTopoShape.h"
 #include <src/App/InitApplication.h>
@@ -269,3 +271,52 @@ TEST_F(PropertyTopoShapeTest, testRestore)
     EXPECT_TRUE(reader.isValid());
     EXPECT_TRUE(reader.isEndOfElement());
 }
+
+TEST_F(PropertyTopoShapeTest, testLazyRestoreDocFile)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General");
+    hGrp->SetBool("LazyRestore", true);
+    std::stringstream stream;
+    _boxes[0]->Shape.getShape().exportBrep(stream);
+    Base::Reader reader(stream, "Box.Shape.brp", 1);
+    Part::PropertyPartShape prop;
+
+    // Act
+    prop.RestoreDocFile(reader);
+    bool lazy = prop.isLazyRestored();
+    auto shape = prop.getShape();
+    hGrp->RemoveBool("LazyRestore");
+
+    // Assert
+    EXPECT_TRUE(lazy);
+    EXPECT_FALSE(prop.isLazyRestored());
+    EXPECT_FALSE(shape.isNull());
+    EXPECT_EQ(shape.countSubShapes(TopAbs_FACE), 6);
+}
+
+TEST_F(PropertyTopoShapeTest, testSaveTessellation)
+{
+    // Arrange
+    TopoDS_Shape box = _boxes[0]->Shape.getShape().getShape();
+    BRepMesh_IncrementalMesh(box, 0.1);
+    TopoShape meshed(box);
+    std::stringstream withTriangles;
+    std::stringstream withoutTriangles;
+
+    // Act
+    meshed.exportBrep(withTriangles, true);
+    meshed.exportBrep(withoutTriangles);
+    TopoShape restored;
+    restored.importBrep(withTriangles);
+    TopoShape plain;
+    plain.importBrep(withoutTriangles);
+    TopLoc_Location loc;
+    auto restoredFace = TopoDS::Face(restored.getSubShape(TopAbs_FACE, 1));
+    auto plainFace = TopoDS::Face(plain.getSubShape(TopAbs_FACE, 1));
+
+    // Assert
+    EXPECT_FALSE(BRep_Tool::Triangulation(restoredFace, loc).IsNull());
+    EXPECT_TRUE(BRep_Tool::Triangulation(plainFace, loc).IsNull());
+}
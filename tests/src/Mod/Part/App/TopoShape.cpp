@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 #include "PartTestHelpers.h"
+#include <BRep_Builder.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Compound.hxx>
 #include <Mod/Part/App/TopoShape.h>
 #include "src/App/InitApplication.h"
 
@@ -136,4 +139,83 @@ TEST_F(TopoShapeTest, TestGetSubshape)
     EXPECT_THROW(cube1.getSubShape("WOOHOO", false), Base::ValueError);  // Invalid
 }
 
+TEST_F(TopoShapeTest, TestFillTessellation)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    // Act
+    auto layout = cube1.prepareTessellation(0.1);
+    std::vector<float> points(3 * layout.countPoints());
+    std::vector<uint32_t> triangles(3 * layout.countTriangles());
+    cube1.fillTessellation(layout, points.data(), triangles.data());
+    // Assert
+    ASSERT_EQ(layout.pointOffsets.size(), 7);  // Six faces and the total
+    ASSERT_EQ(layout.triangleOffsets.size(), 7);
+    EXPECT_EQ(layout.countTriangles(), 12);  // Two triangles per face
+    for (std::size_t face = 0; face < 6; ++face) {
+        for (uint32_t tria = layout.triangleOffsets[face]; tria < layout.triangleOffsets[face + 1];
+             ++tria) {
+            for (int corner = 0; corner < 3; ++corner) {
+                uint32_t index = triangles[3 * tria + corner];
+                EXPECT_GE(index, layout.pointOffsets[face]);
+                EXPECT_LT(index, layout.pointOffsets[face + 1]);
+            }
+        }
+    }
+    for (float value : points) {
+        EXPECT_GE(value, 0.0F);
+        EXPECT_LE(value, 1.0F);
+    }
+}
+
+TEST_F(TopoShapeTest, TestFacesFromSubElements)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    cube1.prepareTessellation(0.1);  // makes sure the faces are meshed
+    std::vector<Data::IndexedName> names {Data::IndexedName("Face2"),
+                                          Data::IndexedName("Face7"),
+                                          Data::IndexedName("Edge1")};
+    // Act
+    auto faces = cube1.getFacesFromSubElements(names);
+    auto lines = cube1.getLinesFromSubElements(names);
+    // Assert
+    ASSERT_EQ(faces.size(), 3);
+    EXPECT_EQ(faces[0].points.size(), 4);
+    EXPECT_EQ(faces[0].normals.size(), 4);
+    EXPECT_EQ(faces[0].facets.size(), 2);
+    EXPECT_TRUE(faces[1].points.empty());  // Out of range
+    EXPECT_TRUE(faces[2].facets.empty());  // Not a face
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_EQ(lines[0].lines.size(), 4);  // The four edges of the face
+    EXPECT_TRUE(lines[1].lines.empty());
+    EXPECT_EQ(lines[2].lines.size(), 1);
+}
+
+TEST_F(TopoShapeTest, TestFixParallelKeepsValidShapes)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoTopoShapeCubes();
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(10, 0, 0));
+    BRep_Builder builder;
+    TopoDS_Compound comp;
+    builder.MakeCompound(comp);
+    builder.Add(comp, cube1.getShape());
+    builder.Add(comp, cube2.getShape());
+    builder.Add(comp, cube1.getShape().Moved(TopLoc_Location(move)));  // shares cube1's vertices
+    Part::TopoShape shape(comp);
+    // Act
+    auto reports = shape.fixParallel();
+    // Assert
+    ASSERT_EQ(reports.size(), 3);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(reports[i].index, i + 1);
+        EXPECT_FALSE(reports[i].invalid);
+        EXPECT_FALSE(reports[i].fixed);
+        EXPECT_TRUE(reports[i].valid);
+    }
+    EXPECT_TRUE(shape.getShape().IsSame(comp));
+}
+
 // clang-format on
@@ -6,6 +6,7 @@
 
 #include <src/App/InitApplication.h>
 #include <gp_Quaternion.hxx>
+#include <gp_Trsf.hxx>
 #include <TopoDS_TVertex.hxx>
 #include <BRep_TVertex.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
@@ -281,4 +282,29 @@ TEST_F(TopoShapeCacheTest, FindAncestor)
     EXPECT_FALSE(ancestorResultCompound.IsNull());
 }
 
+TEST_F(TopoShapeCacheTest, AcquireSharesCacheForSameTShape)
+{
+    // Arrange
+    auto box = BRepPrimAPI_MakeBox(1, 2, 3).Solid();
+    gp_Trsf trsf;
+    trsf.SetTranslation(gp_Vec(1, 0, 0));
+    auto moved = box.Moved(TopLoc_Location(trsf));
+
+    // Act
+    auto cache1 = Part::TopoShapeCache::acquire(box, {});
+    auto cache2 = Part::TopoShapeCache::acquire(moved, {});
+    auto cache3 = Part::TopoShapeCache::acquire(box.Reversed(), {});
+    Part::TopoShape shape1(box);
+    Part::TopoShape shape2(box);
+    shape1.findShape(TopAbs_FACE, 1);
+    shape2.findShape(TopAbs_FACE, 1);
+
+    // Assert
+    EXPECT_TRUE(cache1->isShared());
+    EXPECT_EQ(cache1, cache2);
+    EXPECT_NE(cache1, cache3);
+    EXPECT_EQ(cache1->countShape(TopAbs_FACE), 6);
+    EXPECT_EQ(shape1.findShape(TopAbs_FACE, 1), shape2.findShape(TopAbs_FACE, 1));
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
@@ -1475,6 +1475,34 @@ TEST_F(TopoShapeExpansionTest, makeElementBooleanCut)
                                  }));
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementBooleanCutSkipsDistantTools)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    auto cube3 = BRepPrimAPI_MakeBox(gp_Pnt(10, 10, 10), 1, 1, 1).Shape();
+    auto cube4 = BRepPrimAPI_MakeBox(gp_Pnt(-10, 0, 0), 1, 1, 1).Shape();
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    TopoShape topoShape3 {cube3, 3L};
+    TopoShape topoShape4 {cube4, 4L};
+    TopoShape expected {0L};
+    expected.makeElementBoolean(Part::OpCodes::Cut, {topoShape1, topoShape2});
+    // Act
+    TopoShape result {0L};
+    result.makeElementBoolean(Part::OpCodes::Cut,
+                              {topoShape1, topoShape3, topoShape2, topoShape4});
+    TopoShape untouched {0L};
+    untouched.makeElementBoolean(Part::OpCodes::Cut, {topoShape1, topoShape3, topoShape4});
+    // Assert
+    EXPECT_FLOAT_EQ(getVolume(result.getShape()), 0.75);
+    EXPECT_EQ(elementMap(result), elementMap(expected));
+    EXPECT_FLOAT_EQ(getVolume(untouched.getShape()), 1.0);
+    EXPECT_TRUE(untouched.getShape().IsSame(cube1));
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementBooleanFuse)
 {
     // Arrange
@@ -2420,6 +2448,26 @@ TEST_F(TopoShapeExpansionTest, makeElementSlices)
                                                     // again after importing other TopoNaming logics
 }
 
+TEST_F(TopoShapeExpansionTest, makeElementSlicesPerLevel)
+{
+    // Arrange
+    auto [cube1, cube2] = CreateTwoCubes();
+    TopoShape cube1TS {cube1, 1L};
+    Base::Vector3d direction {1.0, 0.0, 0.0};
+    // Act
+    auto levels = cube1TS.makeElementSlicesPerLevel(direction, {0.25, 2.0, 0.75});
+    auto slices = cube1TS.makeElementSlices(direction, {0.25, 0.75});
+    // Assert
+    ASSERT_EQ(levels.size(), 3);
+    ASSERT_EQ(levels[0].size(), 1);
+    EXPECT_TRUE(levels[1].empty());  // The plane misses the cube
+    ASSERT_EQ(levels[2].size(), 1);
+    EXPECT_FLOAT_EQ(getLength(levels[0][0].getShape()), 4);
+    EXPECT_FLOAT_EQ(getLength(levels[2][0].getShape()), 4);
+    EXPECT_EQ(slices.countSubElements("Wire"), 2);
+    EXPECT_FLOAT_EQ(getLength(slices.getShape()), 8);
+}
+
 TEST_F(TopoShapeExpansionTest, makeElementMirror)
 {
     // Arrange
@@ -5,6 +5,7 @@
 #include <src/App/InitApplication.h>
 
 #include "PartTestHelpers.h"
+#include "Mod/Part/App/modelRefine.h"
 
 class FeaturePartMakeElementRefineTest: public ::testing::Test,
                                         public PartTestHelpers::PartTestHelperClass
@@ -53,3 +54,28 @@ TEST_F(FeaturePartMakeElementRefineTest, makeElementRefineBoxes)
     // TODO: Refine doesn't work on compounds, so we're going to need a binary operation or the
     // like, and those don't exist yet.  Once they do, this test can be expanded
 }
+
+TEST_F(FeaturePartMakeElementRefineTest, faceUniterReportsMergedGroups)
+{
+    // Arrange
+    auto _doc = App::GetApplication().getActiveDocument();
+    auto _fuse = dynamic_cast<Part::Fuse*>(_doc->addObject("Part::Fuse"));
+    _fuse->Base.setValue(_boxes[0]);
+    _fuse->Tool.setValue(_boxes[3]);
+    _fuse->execute();
+    TopExp_Explorer xp(_fuse->Shape.getValue(), TopAbs_SHELL);
+    ASSERT_TRUE(xp.More());
+    ModelRefine::FaceUniter uniter(TopoDS::Shell(xp.Current()));
+    // Act
+    bool done = uniter.process();
+    const auto& groups = uniter.getMergedGroups();
+    // Assert
+    EXPECT_TRUE(done);
+    EXPECT_TRUE(uniter.isModified());
+    ASSERT_EQ(groups.size(), 4);  // The four side faces of both boxes are united in pairs
+    for (const auto& group : groups) {
+        EXPECT_EQ(group.type, GeomAbs_Plane);
+        EXPECT_EQ(group.faceCount, 2);
+    }
+    EXPECT_GE(uniter.getModifiedShapes().size(), 8);
+}
@@ -10,6 +10,9 @@
 #include <Mod/Part/App/TopoShapeOpCode.h>
 // #include <MappedName.h>
 
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <gp_Trsf.hxx>
+#include <TopLoc_Location.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Wire.hxx>
@@ -335,3 +338,36 @@ std::string composeTagInfo(const MappedElement& element, const TopoShape& shape)
 
     return tagInfo;
 }
+
+TEST_F(TopoShapeMakeShapeWithElementMapTests, deferredElementMapMatchesEagerMap)
+{
+    // Arrange
+    auto [cube1, cube2] = PartTestHelpers::CreateTwoCubes();
+    auto tr {gp_Trsf()};
+    tr.SetTranslation(gp_Vec(gp_XYZ(-0.5, -0.5, 0)));
+    cube2.Move(TopLoc_Location(tr));
+    TopoShape topoShape1 {cube1, 1L};
+    TopoShape topoShape2 {cube2, 2L};
+    std::vector<TopoShape> sources {topoShape1, topoShape2};
+    BRepAlgoAPI_Fuse mkFuse(cube1, cube2);
+    TopoShape eager {3L};
+    TopoShape deferred {3L};
+
+    // Act
+    eager.makeElementShape(mkFuse, sources, OpCodes::Fuse);
+    {
+        TopoShape::DeferElementMap guard;
+        EXPECT_TRUE(TopoShape::isElementMapDeferred());
+        deferred.makeElementShape(mkFuse, sources, OpCodes::Fuse);
+    }
+    TopoShape copy {deferred};
+
+    // Assert
+    EXPECT_FALSE(TopoShape::isElementMapDeferred());
+    EXPECT_TRUE(deferred.hasDeferredElementMap());
+    EXPECT_TRUE(copy.hasDeferredElementMap());
+    EXPECT_EQ(PartTestHelpers::elementMap(deferred), PartTestHelpers::elementMap(eager));
+    EXPECT_FALSE(deferred.hasDeferredElementMap());
+    EXPECT_EQ(PartTestHelpers::elementMap(copy), PartTestHelpers::elementMap(eager));
+    EXPECT_FALSE(copy.hasDeferredElementMap());
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Mod/Points/App/OrganizedCloud.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class OrganizedCloudTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a tilted plane in front of the camera with a hole in the middle
+        for (int row = 0; row < height; row++) {
+            for (int col = 0; col < width; col++) {
+                float x = float(col) * 0.1F;
+                float y = float(row) * 0.1F;
+                points.emplace_back(x, y, 10.0F + 0.5F * x);
+            }
+        }
+        points[index(5, 4)].z = std::nanf("");
+
+        tmp.setFile(Base::FileInfo::getTempFileName());
+    }
+
+    void TearDown() override
+    {
+        tmp.deleteFile();
+    }
+
+    static std::size_t index(int col, int row)
+    {
+        return std::size_t(row) * width + col;
+    }
+
+    static constexpr int width = 10;
+    static constexpr int height = 8;
+    std::vector<Base::Vector3f> points;
+    Base::FileInfo tmp;
+};
+
+TEST_F(OrganizedCloudTest, TestGridAccess)
+{
+    std::vector<Base::Vector3f> copy = points;
+    EXPECT_THROW(Points::OrganizedCloud(width + 1, height, std::move(copy)), Base::ValueError);
+
+    Points::OrganizedCloud cloud(width, height, std::vector<Base::Vector3f>(points));
+    EXPECT_EQ(cloud.size(), points.size());
+    EXPECT_TRUE(cloud.isWritable());
+    EXPECT_FALSE(cloud.isMapped());
+    EXPECT_EQ(cloud(3, 2), points[index(3, 2)]);
+    EXPECT_TRUE(cloud.isValid(0, 0));
+    EXPECT_FALSE(cloud.isValid(5, 4));
+    EXPECT_FALSE(cloud.isValid(-1, 0));
+    EXPECT_FALSE(cloud.isValid(width, 0));
+
+    std::vector<Base::Vector3f> neighbours;
+    cloud.getNeighbours(0, 0, 1, neighbours);
+    EXPECT_EQ(neighbours.size(), 3);
+    neighbours.clear();
+    cloud.getNeighbours(5, 5, 1, neighbours);
+    EXPECT_EQ(neighbours.size(), 7);
+
+    // moving keeps the points
+    Points::OrganizedCloud other(std::move(cloud));
+    EXPECT_EQ(other(3, 2), points[index(3, 2)]);
+    EXPECT_TRUE(cloud.empty());
+}
+
+TEST_F(OrganizedCloudTest, TestKernelView)
+{
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(points);
+    Points::OrganizedCloud cloud(width, height, kernel);
+    EXPECT_EQ(cloud.data(), kernel.getBasicPoints().data());
+    EXPECT_FALSE(cloud.isWritable());
+    EXPECT_THROW(cloud.writableData(), Base::RuntimeError);
+
+    Points::PointKernel copy;
+    cloud.toKernel(copy);
+    EXPECT_EQ(copy.getBasicPoints().size(), points.size());
+    EXPECT_EQ(copy.getBasicPoints()[7], points[7]);
+}
+
+TEST_F(OrganizedCloudTest, TestNormals)
+{
+    Points::OrganizedCloud cloud(width, height, std::vector<Base::Vector3f>(points));
+    std::vector<Base::Vector3f> normals = cloud.estimateNormals();
+    ASSERT_EQ(normals.size(), points.size());
+
+    Base::Vector3f expected(0.5F, 0.0F, -1.0F);
+    expected.Normalize();
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            const Base::Vector3f& normal = normals[index(col, row)];
+            if (col == 5 && row == 4) {
+                EXPECT_EQ(normal, Base::Vector3f());
+            }
+            else {
+                EXPECT_NEAR(normal * expected, 1.0F, 1e-4F);
+            }
+        }
+    }
+}
+
+TEST_F(OrganizedCloudTest, TestTriangulate)
+{
+    Points::OrganizedCloud cloud(width, height, std::vector<Base::Vector3f>(points));
+    std::vector<uint32_t> indices;
+    cloud.triangulate(1.0F, indices);
+    // every cell has two triangles except the four cells at the hole having one
+    std::size_t cells = (width - 1) * (height - 1);
+    EXPECT_EQ(indices.size(), 3 * (2 * cells - 4));
+    for (uint32_t index : indices) {
+        EXPECT_TRUE(cloud.isValid(int(index % width), int(index / width)));
+    }
+
+    // all edges are too long
+    indices.clear();
+    cloud.triangulate(0.05F, indices);
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST_F(OrganizedCloudTest, TestMapFile)
+{
+    std::string name = tmp.filePath();
+    Points::OrganizedCloud(width, height, std::vector<Base::Vector3f>(points)).save(name);
+    EXPECT_EQ(tmp.size(), points.size() * sizeof(Base::Vector3f));
+
+    {
+        Points::OrganizedCloud cloud = Points::OrganizedCloud::mapFile(name, width, height);
+        EXPECT_TRUE(cloud.isMapped());
+        EXPECT_FALSE(cloud.isWritable());
+        EXPECT_EQ(cloud(9, 7), points.back());
+        EXPECT_FALSE(cloud.isValid(5, 4));
+    }
+
+    // skip the first row
+    {
+        Points::OrganizedCloud cloud =
+            Points::OrganizedCloud::mapFile(name, width, height - 1, width * sizeof(Base::Vector3f));
+        EXPECT_EQ(cloud(0, 0), points[index(0, 1)]);
+    }
+
+    // write through to the file
+    {
+        Points::OrganizedCloud cloud =
+            Points::OrganizedCloud::mapFile(name, width, height, 0, true);
+        ASSERT_TRUE(cloud.isWritable());
+        cloud.writableData()[0] = Base::Vector3f(1, 2, 3);
+    }
+    {
+        Points::OrganizedCloud cloud = Points::OrganizedCloud::mapFile(name, width, height);
+        EXPECT_EQ(cloud(0, 0), Base::Vector3f(1, 2, 3));
+    }
+
+    EXPECT_THROW(Points::OrganizedCloud::mapFile(name, width, height + 1), Base::FileException);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -238,4 +238,58 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+
+TEST_F(PointsTest, TestBinaryPCD)
+{
+    using Format = Points::PcdWriter::Format;
+    for (Format format : {Format::Ascii, Format::Binary, Format::BinaryCompressed}) {
+        std::string name = getFileName();
+        Points::PcdWriter writer(getKernel());
+        writer.setFormat(format);
+        writer.setIntensities(getIntensity());
+        writer.setColors(getColors());
+        writer.setNormals(getNormals());
+        writer.write(name);
+
+        Points::PcdReader reader;
+        reader.read(name);
+
+        EXPECT_EQ(reader.getPoints().getBasicPoints(), getKernel().getBasicPoints());
+        EXPECT_EQ(reader.getIntensities(), getIntensity());
+        EXPECT_EQ(reader.getNormals(), getNormals());
+        std::vector<App::Color> colors = getColors();
+        ASSERT_EQ(reader.getColors().size(), colors.size());
+        for (std::size_t i = 0; i < colors.size(); i++) {
+            EXPECT_EQ(reader.getColors()[i].getPackedARGB(), colors[i].getPackedARGB());
+        }
+        EXPECT_EQ(reader.getWidth(), 8);
+        EXPECT_EQ(reader.getHeight(), 1);
+    }
+}
+
+TEST_F(PointsTest, TestCompressedPCD)
+{
+    // enough data for long literal runs and back references
+    std::vector<Base::Vector3f> points;
+    std::vector<float> intensity;
+    for (int i = 0; i < 20000; i++) {
+        points.emplace_back(float(i % 100), float(i / 100), float(i) * 0.001F);
+        intensity.push_back(float(i % 7) * 0.1F);
+    }
+    Points::PointKernel kernel;
+    kernel.setBasicPoints(points);
+
+    std::string name = getFileName();
+    Points::PcdWriter writer(kernel);
+    writer.setFormat(Points::PcdWriter::Format::BinaryCompressed);
+    writer.setIntensities(intensity);
+    writer.write(name);
+    Base::FileInfo fi(name);
+    EXPECT_LT(fi.size(), points.size() * 4 * sizeof(float));
+
+    Points::PcdReader reader;
+    reader.read(name);
+    EXPECT_EQ(reader.getPoints().getBasicPoints(), points);
+    EXPECT_EQ(reader.getIntensities(), intensity);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
 #include <src/App/InitApplication.h>
+#include <Base/Interpreter.h>
 #include <Mod/Points/App/PointsFeature.h>
+#include <Mod/Points/App/Properties.h>
+#include <Mod/Points/App/Tools.h>
 
 class PointsFeatureTest: public ::testing::Test
 {
@@ -33,4 +36,26 @@ TEST_F(PointsFeatureTest, getComplexElementTypes)
 
     EXPECT_EQ(types.size(), 0);
 }
+
+TEST_F(PointsFeatureTest, setNormalsFromArray)
+{
+    Base::PyGILStateLocker lock;
+    std::vector<Base::Vector3f> normals {{0, 0, 1}, {0, 1, 0}, {1, 0, 0}};
+    Py::Object array = Points::toArray(&normals[0].x, normals.size(), 3);
+
+    Points::PropertyNormalList prop;
+    prop.setPyObject(array.ptr());
+    EXPECT_EQ(prop.getValues(), normals);
+}
+
+TEST_F(PointsFeatureTest, setGreyValuesFromArray)
+{
+    Base::PyGILStateLocker lock;
+    std::vector<float> values {0.1F, 0.2F, 0.3F, 0.4F};
+    Py::Object array = Points::toArray(values.data(), values.size(), 1);
+
+    Points::PropertyGreyValueList prop;
+    prop.setPyObject(array.ptr());
+    EXPECT_EQ(prop.getValues(), values);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
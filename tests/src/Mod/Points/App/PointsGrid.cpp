@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <Mod/Points/App/PointsGrid.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsGridTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<float> pos(0.0F, 10.0F);
+        std::vector<Base::Vector3f> points;
+        for (int i = 0; i < 100000; i++) {
+            points.emplace_back(pos(gen), pos(gen), 0.2F * pos(gen));
+        }
+        kernel.setBasicPoints(points);
+    }
+
+    void TearDown() override
+    {}
+
+    Points::PointKernel kernel;
+};
+
+TEST_F(PointsGridTest, TestRebuild)
+{
+    Points::PointsGrid grid(kernel, 20);
+    EXPECT_TRUE(grid.Verify());
+
+    // every point is stored exactly once and the indices of a grid element are sorted
+    std::vector<unsigned long> all;
+    Points::PointsGridIterator it(grid);
+    for (it.Init(); it.More(); it.Next()) {
+        std::vector<unsigned long> elements;
+        it.GetElements(elements);
+        EXPECT_TRUE(std::is_sorted(elements.begin(), elements.end()));
+        unsigned long x {}, y {}, z {};
+        it.GetGridPos(x, y, z);
+        EXPECT_EQ(grid.GetCtElements(x, y, z), elements.size());
+        all.insert(all.end(), elements.begin(), elements.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), kernel.size());
+    for (unsigned long i = 0; i < all.size(); i++) {
+        EXPECT_EQ(all[i], i);
+    }
+}
+
+TEST_F(PointsGridTest, TestInSide)
+{
+    Points::PointsGrid grid(kernel, 20);
+    Base::BoundBox3d box(2.0, 3.0, 0.0, 4.0, 5.0, 1.0);
+    std::vector<unsigned long> elements;
+    grid.InSide(box, elements);
+    std::set<unsigned long> check;
+    grid.InSide(box, check);
+    EXPECT_EQ(elements, std::vector<unsigned long>(check.begin(), check.end()));
+
+    // all points inside the box are found
+    for (unsigned long i = 0; i < kernel.size(); i++) {
+        if (box.IsInBox(kernel.getPoint(i))) {
+            EXPECT_TRUE(check.count(i) > 0);
+        }
+    }
+}
+
+TEST_F(PointsGridTest, TestRadiusSearch)
+{
+    Points::PointsGrid grid(kernel, 20);
+    std::vector<Base::Vector3d> queries;
+    for (unsigned long i = 0; i < kernel.size(); i += 97) {
+        queries.push_back(kernel.getPoint(i));
+    }
+    queries.emplace_back(-5.0, -5.0, -5.0);
+
+    const double radius = 0.3;
+    std::vector<std::vector<unsigned long>> results;
+    grid.RadiusSearch(queries, radius, results);
+    ASSERT_EQ(results.size(), queries.size());
+
+    for (std::size_t q = 0; q < queries.size(); q += 50) {
+        std::vector<unsigned long> check;
+        for (unsigned long i = 0; i < kernel.size(); i++) {
+            if (Base::Distance(kernel.getPoint(i), queries[q]) <= radius) {
+                check.push_back(i);
+            }
+        }
+        EXPECT_EQ(results[q], check);
+
+        std::vector<unsigned long> single;
+        grid.RadiusSearch(queries[q], radius, single);
+        EXPECT_EQ(single, check);
+    }
+    EXPECT_FALSE(results.front().empty());
+    EXPECT_TRUE(results.back().empty());
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <Base/Exception.h>
+#include <Base/FileInfo.h>
+#include <Mod/Points/App/PointsOctree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsOctreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a noisy terrain
+        std::mt19937 gen(3);
+        std::uniform_real_distribution<float> pos(0.0F, 100.0F);
+        std::uniform_real_distribution<float> noise(0.0F, 1.0F);
+        for (int i = 0; i < 200000; i++) {
+            float x = pos(gen);
+            float y = pos(gen);
+            points.emplace_back(x, y, 0.1F * x + noise(gen));
+        }
+
+        cache.setFile(Base::FileInfo::getTempFileName("octree"));
+        cache.deleteFile();
+    }
+
+    void TearDown() override
+    {
+        cache.deleteDirectoryRecursive();
+    }
+
+    Base::BoundBox3f getBoundBox() const
+    {
+        Base::BoundBox3f box;
+        for (const auto& pnt : points) {
+            box.Add(pnt);
+        }
+        return box;
+    }
+
+    std::vector<Base::Vector3f> collectAll(const Points::PointsOctree& tree) const
+    {
+        std::vector<Base::Vector3f> result;
+        for (std::size_t i = 0; i < tree.getNodes().size(); i++) {
+            auto pts = tree.getPoints(i);
+            result.insert(result.end(), pts->begin(), pts->end());
+        }
+        return result;
+    }
+
+    static bool lessPoint(const Base::Vector3f& p, const Base::Vector3f& q)
+    {
+        return std::tie(p.x, p.y, p.z) < std::tie(q.x, q.y, q.z);
+    }
+
+    std::vector<Base::Vector3f> points;
+    Base::FileInfo cache;
+};
+
+TEST_F(PointsOctreeTest, TestBuildKeepsAllPoints)
+{
+    Points::PointsOctree tree(cache.filePath(), getBoundBox(), 32, 2);
+    // stream the points in several chunks
+    std::size_t half = points.size() / 2;
+    std::vector<Base::Vector3f> first(points.begin(), points.begin() + half);
+    std::vector<Base::Vector3f> second(points.begin() + half, points.end());
+    EXPECT_EQ(tree.add(first), first.size());
+    EXPECT_EQ(tree.add(second), second.size());
+    EXPECT_THROW(tree.getPoints(0), Base::RuntimeError);
+    tree.finish();
+    EXPECT_TRUE(tree.isFinished());
+    EXPECT_THROW(tree.add(first), Base::RuntimeError);
+
+    EXPECT_EQ(tree.size(), points.size());
+    EXPECT_GT(tree.getNodes().size(), 9);
+
+    std::vector<Base::Vector3f> result = collectAll(tree);
+    std::sort(result.begin(), result.end(), lessPoint);
+    std::vector<Base::Vector3f> check = points;
+    std::sort(check.begin(), check.end(), lessPoint);
+    EXPECT_EQ(result, check);
+
+    // the points of a node lie inside its box and the box of its parent
+    const auto& nodes = tree.getNodes();
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        auto pts = tree.getPoints(i);
+        EXPECT_EQ(pts->size(), nodes[i].count);
+        for (const auto& pnt : *pts) {
+            EXPECT_TRUE(nodes[i].box.IsInBox(pnt));
+        }
+        for (int32_t child : nodes[i].children) {
+            if (child >= 0) {
+                EXPECT_EQ(nodes[child].depth, nodes[i].depth + 1);
+                EXPECT_TRUE(nodes[i].box.IsInBox(nodes[child].box));
+            }
+        }
+    }
+}
+
+TEST_F(PointsOctreeTest, TestIgnorePointsOutside)
+{
+    Base::BoundBox3f box(0, 0, 0, 10, 10, 10);
+    Points::PointsOctree tree(cache.filePath(), box);
+    std::vector<Base::Vector3f> pts {Base::Vector3f(1, 1, 1), Base::Vector3f(20, 1, 1), Base::Vector3f(5, 5, 5)};
+    EXPECT_EQ(tree.add(pts), 2);
+    tree.finish();
+    EXPECT_EQ(tree.size(), 2);
+    EXPECT_EQ(collectAll(tree).size(), 2);
+}
+
+TEST_F(PointsOctreeTest, TestReopen)
+{
+    std::size_t numNodes {};
+    {
+        Points::PointsOctree tree(cache.filePath(), getBoundBox(), 32, 1);
+        tree.add(points);
+        tree.finish();
+        numNodes = tree.getNodes().size();
+    }
+
+    Points::PointsOctree tree(cache.filePath());
+    EXPECT_TRUE(tree.isFinished());
+    EXPECT_EQ(tree.size(), points.size());
+    EXPECT_EQ(tree.getNodes().size(), numNodes);
+    EXPECT_EQ(collectAll(tree).size(), points.size());
+
+    Base::FileInfo empty(Base::FileInfo::getTempFileName("noctree"));
+    empty.deleteFile();
+    EXPECT_THROW(Points::PointsOctree {empty.filePath()}, Base::FileException);
+}
+
+TEST_F(PointsOctreeTest, TestSelectNodes)
+{
+    Points::PointsOctree tree(cache.filePath(), getBoundBox(), 32, 2);
+    tree.add(points);
+    tree.finish();
+
+    const auto& nodes = tree.getNodes();
+    Base::Vector3f eye(0, 0, 50);
+
+    // everything is selected with an unlimited budget
+    std::vector<std::size_t> all = tree.selectNodes(eye, 0.0F, points.size());
+    EXPECT_EQ(all.size(), nodes.size());
+
+    // the budget is respected and the parents are selected before the children
+    std::vector<std::size_t> sel = tree.selectNodes(eye, 0.0F, points.size() / 10);
+    ASSERT_FALSE(sel.empty());
+    EXPECT_EQ(sel.front(), 0);
+    uint64_t count = 0;
+    for (std::size_t index : sel) {
+        count += nodes[index].count;
+    }
+    EXPECT_LE(count, points.size() / 10);
+    for (std::size_t index : sel) {
+        for (int32_t child : nodes[index].children) {
+            if (child >= 0 && std::find(sel.begin(), sel.end(), child) != sel.end()) {
+                auto parent = std::find(sel.begin(), sel.end(), index);
+                EXPECT_LT(parent, std::find(sel.begin(), sel.end(), child));
+            }
+        }
+    }
+
+    // nearer regions get more detail
+    Points::PointKernel kernel;
+    tree.collect(sel, kernel);
+    EXPECT_EQ(kernel.size(), count);
+    std::size_t near = 0;
+    std::size_t far = 0;
+    for (const auto& pnt : kernel.getBasicPoints()) {
+        if (pnt.x < 25.0F && pnt.y < 25.0F) {
+            near++;
+        }
+        else if (pnt.x > 75.0F && pnt.y > 75.0F) {
+            far++;
+        }
+    }
+    EXPECT_GT(near, far);
+
+    // nothing is visible
+    EXPECT_TRUE(tree.selectNodes(eye, 0.0F, points.size(), [](const Base::BoundBox3f&) {
+                        return false;
+                    }).empty());
+}
+
+TEST_F(PointsOctreeTest, TestCacheBudget)
+{
+    Points::PointsOctree tree(cache.filePath(), getBoundBox(), 32, 2);
+    tree.add(points);
+    tree.finish();
+    tree.setCacheBudget(0);
+
+    auto pts = tree.getPoints(0);
+    auto again = tree.getPoints(0);
+    EXPECT_EQ(pts, again);
+    // the root has been evicted but the returned points are still valid
+    tree.getPoints(1);
+    again = tree.getPoints(0);
+    EXPECT_NE(pts, again);
+    EXPECT_EQ(*pts, *again);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -870,6 +870,39 @@ TEST_F(SketchObjectTest, testDeleteOnlyUnusedInternalGeometryOfBSpline)
     EXPECT_EQ(getObject()->getHighestCurveIndex(), 2);
 }
 
+TEST_F(SketchObjectTest, testSolveAfterNonGeometricEdit)
+{
+    // Arrange
+    Part::GeomLineSegment lineSeg;
+    setupLineSegment(lineSeg);
+    int geoId = getObject()->addGeometry(&lineSeg);
+    auto constraint = new Sketcher::Constraint();  // Ownership will be transferred to the sketch
+    constraint->Type = Sketcher::ConstraintType::Distance;
+    constraint->First = geoId;
+    constraint->setValue(5.0);
+    int cstrId = getObject()->addConstraint(constraint);
+    ASSERT_EQ(getObject()->solve(), 0);
+    auto getLength = [&]() {
+        auto line = getObject()->getGeometry<Part::GeomLineSegment>(geoId);
+        return (line->getEndPoint() - line->getStartPoint()).Length();
+    };
+    EXPECT_NEAR(getLength(), 5.0, 1e-8);
+
+    // Act
+    getObject()->renameConstraint(cstrId, "Length");
+    getObject()->setVirtualSpace(cstrId, true);
+
+    // Assert
+    EXPECT_EQ(getObject()->solve(), 0);
+    EXPECT_NEAR(getLength(), 5.0, 1e-8);
+    EXPECT_EQ(getObject()->getLastDoF(), 3);
+
+    // A change of the value has to be solved again
+    getObject()->setDatum(cstrId, 7.0);
+    EXPECT_EQ(getObject()->solve(), 0);
+    EXPECT_NEAR(getLength(), 7.0, 1e-8);
+}
+
 TEST_F(SketchObjectTest, testSplitLineSegment)
 {
     // Arrange
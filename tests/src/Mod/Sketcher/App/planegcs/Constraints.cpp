@@ -178,3 +178,112 @@ TEST_F(ConstraintsTest, tangentBSplineAndArc)  // NOLINT
                 1.0,
                 0.005);
 }
+
+TEST_F(ConstraintsTest, gradsMatchGrad)  // NOLINT
+{
+    // Arrange
+    std::vector<double> values {1.0, 2.0, 4.5, 3.0, -1.0, 0.5, 2.5, -2.0, 0.7, 1.3};
+    std::vector<double*> p;
+    for (double& value : values) {
+        p.push_back(&value);
+    }
+    GCS::Point p1 {p[0], p[1]}, p2 {p[2], p[3]}, p3 {p[4], p[5]}, p4 {p[6], p[7]};
+    GCS::Line l1, l2;
+    l1.p1 = p1;
+    l1.p2 = p2;
+    l2.p1 = p3;
+    l2.p2 = p4;
+
+    std::vector<std::unique_ptr<GCS::Constraint>> constraints;
+    constraints.push_back(std::make_unique<GCS::ConstraintEqual>(p[0], p[2]));
+    constraints.push_back(std::make_unique<GCS::ConstraintDifference>(p[0], p[2], p[8]));
+    constraints.push_back(std::make_unique<GCS::ConstraintP2PDistance>(p1, p2, p[8]));
+    constraints.push_back(std::make_unique<GCS::ConstraintP2PAngle>(p1, p2, p[9]));
+    constraints.push_back(std::make_unique<GCS::ConstraintP2LDistance>(p3, l1, p[8]));
+    constraints.push_back(std::make_unique<GCS::ConstraintPointOnLine>(p3, l1));
+    constraints.push_back(std::make_unique<GCS::ConstraintParallel>(l1, l2));
+    constraints.push_back(std::make_unique<GCS::ConstraintPerpendicular>(l1, l2));
+    constraints.push_back(std::make_unique<GCS::ConstraintL2LAngle>(l1, l2, p[9]));
+
+    // Act & Assert
+    for (int side = 0; side < 2; side++) {
+        for (auto& constr : constraints) {
+            GCS::VEC_pD params = constr->params();
+            std::vector<double> derivs(params.size());
+            constr->grads(params, derivs.data());
+            for (std::size_t i = 0; i < params.size(); i++) {
+                EXPECT_DOUBLE_EQ(derivs[i], constr->grad(params[i]));
+            }
+
+            // a parameter that is not used has no derivative
+            double other = 0.0;
+            constr->grads({&other}, derivs.data());
+            EXPECT_EQ(derivs[0], 0.0);
+
+            // parameters redirected to the same value sum up
+            GCS::MAP_pD_pD redirection {{params[1], params[0]}};
+            constr->redirectParams(redirection);
+            constr->grads({params[0]}, derivs.data());
+            EXPECT_DOUBLE_EQ(derivs[0], constr->grad(params[0]));
+            constr->revertParams();
+        }
+        // the point on the other side of the line flips the sign of the distance
+        values[5] = -values[5] - 4.0;
+    }
+}
+
+TEST_F(ConstraintsTest, gradMatchesDifferences)  // NOLINT
+{
+    // Arrange
+    std::vector<double> values {3.0, 1.0, 0.5, -0.2, 2.0, 0.5, 1.5, 1.0, 2.0, 4.0, 5.0};
+    GCS::Point point {&values[0], &values[1]};
+    GCS::Ellipse ellipse;
+    ellipse.center = GCS::Point {&values[2], &values[3]};
+    ellipse.focus1 = GCS::Point {&values[4], &values[5]};
+    ellipse.radmin = &values[6];
+    GCS::Hyperbola hyperbola;
+    hyperbola.center = ellipse.center;
+    hyperbola.focus1 = ellipse.focus1;
+    hyperbola.radmin = ellipse.radmin;
+    GCS::Line line;
+    line.p1 = GCS::Point {&values[7], &values[8]};
+    line.p2 = GCS::Point {&values[9], &values[10]};
+
+    // a cubic B-spline with one inner knot
+    std::vector<double> poleValues {0.0, 10.0, 0.0, 6.0, 6.0, 0.5, 16.0, 0.5, 16.0, -10.0};
+    std::vector<double> weights {1.0, 0.8, 1.2, 0.9, 1.0};
+    std::vector<double> knots {0.0, 1.0, 2.0};
+    GCS::BSpline bspline;
+    for (std::size_t i = 0; i < weights.size(); i++) {
+        bspline.poles.emplace_back(&poleValues[2 * i], &poleValues[2 * i + 1]);
+        bspline.weights.push_back(&weights[i]);
+    }
+    for (double& knot : knots) {
+        bspline.knots.push_back(&knot);
+    }
+    bspline.mult = {4, 1, 4};
+    bspline.degree = 3;
+    bspline.periodic = false;
+    bspline.setupFlattenedKnots();
+
+    std::vector<std::unique_ptr<GCS::Constraint>> constraints;
+    constraints.push_back(std::make_unique<GCS::ConstraintPointOnEllipse>(point, ellipse));
+    constraints.push_back(std::make_unique<GCS::ConstraintPointOnHyperbola>(point, hyperbola));
+    constraints.push_back(std::make_unique<GCS::ConstraintSlopeAtBSplineKnot>(bspline, line, 1));
+
+    // Act & Assert
+    const double step = 1e-6;
+    for (auto& constr : constraints) {
+        for (double* param : constr->params()) {
+            double value = *param;
+            *param = value + step;
+            double errorAbove = constr->error();
+            *param = value - step;
+            double errorBelow = constr->error();
+            *param = value;
+            EXPECT_NEAR(constr->grad(param), (errorAbove - errorBelow) / (2 * step), 1e-6);
+        }
+        double other = 0.0;
+        EXPECT_EQ(constr->grad(&other), 0.0);
+    }
+}
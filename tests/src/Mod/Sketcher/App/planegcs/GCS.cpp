@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include "Mod/Sketcher/App/planegcs/GCS.h"
 
 class SystemTest: public GCS::System
@@ -50,3 +53,94 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, solveDecoupledClustersConcurrently)  // NOLINT
+{
+    // Arrange: many unconnected triangles with fixed side lengths
+    const int numClusters {64};
+    std::vector<double> lengths {3.0, 4.0, 5.0};
+
+    auto solveClusters = [&](bool concurrent) {
+        std::vector<double> values(6 * numClusters);
+        std::vector<GCS::Point> points(3 * numClusters);
+        GCS::VEC_pD params;
+        for (int i = 0; i < 3 * numClusters; i++) {
+            values[2 * i] = i + std::sin(i);
+            values[2 * i + 1] = std::cos(i);
+            points[i].x = &values[2 * i];
+            points[i].y = &values[2 * i + 1];
+            params.push_back(points[i].x);
+            params.push_back(points[i].y);
+        }
+
+        SystemTest system;
+        system.concurrentSolving = concurrent;
+        for (int i = 0; i < numClusters; i++) {
+            for (int j = 0; j < 3; j++) {
+                system.addConstraintP2PDistance(points[3 * i + j],
+                                                points[3 * i + (j + 1) % 3],
+                                                &lengths[j]);
+            }
+        }
+        system.declareUnknowns(params);
+        system.initSolution(GCS::DogLeg);
+        EXPECT_EQ(system.solve(true, GCS::DogLeg), GCS::Success);
+        system.applySolution();
+        return values;
+    };
+
+    // Act
+    std::vector<double> sequential = solveClusters(false);
+    std::vector<double> concurrent = solveClusters(true);
+
+    // Assert: the result doesn't depend on the order the clusters are solved
+    EXPECT_EQ(sequential, concurrent);
+    for (int i = 0; i < numClusters; i++) {
+        double dx = concurrent[6 * i + 2] - concurrent[6 * i];
+        double dy = concurrent[6 * i + 3] - concurrent[6 * i + 1];
+        EXPECT_NEAR(std::sqrt(dx * dx + dy * dy), lengths[0], 1e-6);
+    }
+}
+
+TEST_F(GCSTest, diagnoseRedundantConstraint)  // NOLINT
+{
+    for (auto algorithm : {GCS::EigenDenseQR, GCS::EigenSparseQR}) {
+        // Arrange: a triangle with a fixed corner and a duplicated side length
+        std::vector<double> values {0.1, 0.2, 3.0, 0.5, 0.4, 4.2};
+        std::vector<double> lengths {3.0, 4.0, 5.0, 0.0, 0.0};
+        std::vector<GCS::Point> points(3);
+        GCS::VEC_pD params;
+        for (int i = 0; i < 3; i++) {
+            points[i].x = &values[2 * i];
+            points[i].y = &values[2 * i + 1];
+            params.push_back(points[i].x);
+            params.push_back(points[i].y);
+        }
+
+        SystemTest system;
+        system.qrAlgorithm = algorithm;
+        system.debugMode = GCS::NoDebug;
+        system.addConstraintCoordinateX(points[0], &lengths[3], 1);
+        system.addConstraintCoordinateY(points[0], &lengths[4], 2);
+        for (int j = 0; j < 3; j++) {
+            system.addConstraintP2PDistance(points[j], points[(j + 1) % 3], &lengths[j], 3 + j);
+        }
+        system.addConstraintP2PDistance(points[1], points[2], &lengths[1], 6);
+
+        // Act
+        system.declareUnknowns(params);
+        system.initSolution(GCS::DogLeg);
+        GCS::VEC_I redundant;
+        GCS::VEC_I conflicting;
+        system.getRedundant(redundant);
+        system.getConflicting(conflicting);
+        GCS::VEC_pD dependent;
+        system.getDependentParams(dependent);
+
+        // Assert: the triangle can still rotate around the fixed corner
+        EXPECT_EQ(system.dofsNumber(), 1);
+        EXPECT_EQ(redundant, GCS::VEC_I {6});
+        EXPECT_TRUE(conflicting.empty());
+        EXPECT_FALSE(dependent.empty());
+    }
+}
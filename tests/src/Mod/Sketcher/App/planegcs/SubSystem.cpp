@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "Mod/Sketcher/App/planegcs/GCS.h"
+#include "Mod/Sketcher/App/planegcs/SubSystem.h"
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class SubSystemTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a chain of points with a fixed start and a unit distance between neighbours
+        const int num = 200;
+        values.resize(2 * num + 1);
+        for (int i = 0; i < num; i++) {
+            values[2 * i] = 0.9 * i + 0.05 * std::sin(i);
+            values[2 * i + 1] = 0.3 * std::cos(0.2 * i);
+        }
+        values[2 * num] = 1.0;
+        start = {0.0, 0.0};
+
+        points.assign(num, GCS::Point());
+        for (int i = 0; i < num; i++) {
+            points[i].x = &values[2 * i];
+            points[i].y = &values[2 * i + 1];
+        }
+        params.clear();
+        for (int i = 1; i < num; i++) {
+            params.push_back(points[i].x);
+            params.push_back(points[i].y);
+        }
+        params.push_back(points[0].x);
+        params.push_back(points[0].y);
+    }
+
+    void addConstraints(GCS::System& system)
+    {
+        system.addConstraintCoordinateX(points[0], &start[0]);
+        system.addConstraintCoordinateY(points[0], &start[1]);
+        for (std::size_t i = 1; i < points.size(); i++) {
+            system.addConstraintP2PDistance(points[i - 1], points[i], &values.back());
+        }
+    }
+
+    double chainError() const
+    {
+        double err = std::fabs(*points[0].x) + std::fabs(*points[0].y);
+        for (std::size_t i = 1; i < points.size(); i++) {
+            double dx = *points[i].x - *points[i - 1].x;
+            double dy = *points[i].y - *points[i - 1].y;
+            err += std::fabs(std::sqrt(dx * dx + dy * dy) - 1.0);
+        }
+        return err;
+    }
+
+    std::vector<double> values;
+    std::vector<double> start;
+    std::vector<GCS::Point> points;
+    GCS::VEC_pD params;
+};
+
+TEST_F(SubSystemTest, sparseJacobiEqualsDense)
+{
+    std::vector<std::unique_ptr<GCS::Constraint>> constraints;
+    constraints.push_back(std::make_unique<GCS::ConstraintEqual>(points[0].x, &start[0]));
+    for (std::size_t i = 1; i < points.size(); i++) {
+        constraints.push_back(
+            std::make_unique<GCS::ConstraintP2PDistance>(points[i - 1], points[i], &values.back()));
+    }
+    std::vector<GCS::Constraint*> clist;
+    for (const auto& it : constraints) {
+        clist.push_back(it.get());
+    }
+
+    // the second point is merged into the first one
+    GCS::MAP_pD_pD reduction;
+    reduction[points[1].x] = points[0].x;
+    GCS::SubSystem subsys(clist, params, reduction);
+    subsys.redirectParams();
+
+    Eigen::MatrixXd dense;
+    Eigen::SparseMatrix<double> sparse;
+    subsys.calcJacobi(dense);
+    subsys.calcJacobi(sparse);
+    ASSERT_EQ(sparse.rows(), dense.rows());
+    ASSERT_EQ(sparse.cols(), dense.cols());
+    EXPECT_LT(sparse.nonZeros(), 5 * dense.rows());
+    EXPECT_DOUBLE_EQ((Eigen::MatrixXd(sparse) - dense).norm(), 0.0);
+
+    // only the values are updated for a changed configuration
+    Eigen::VectorXd x(subsys.pSize());
+    subsys.getParams(x);
+    x *= 1.5;
+    subsys.setParams(x);
+    const double* data = sparse.valuePtr();
+    subsys.calcJacobi(dense);
+    subsys.calcJacobi(sparse);
+    EXPECT_EQ(sparse.valuePtr(), data);
+    EXPECT_DOUBLE_EQ((Eigen::MatrixXd(sparse) - dense).norm(), 0.0);
+
+    subsys.revertParams();
+}
+
+TEST_F(SubSystemTest, sparseSolvers)
+{
+    // a tridiagonal positive definite matrix
+    const int num = 50;
+    Eigen::SparseMatrix<double> A(num, num);
+    for (int i = 0; i < num; i++) {
+        A.insert(i, i) = 4.0;
+        if (i > 0) {
+            A.insert(i, i - 1) = -1.0;
+            A.insert(i - 1, i) = -1.0;
+        }
+    }
+    A.makeCompressed();
+    Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(num, 1.0, 2.0);
+
+    std::vector<GCS::Constraint*> clist;
+    GCS::SubSystem subsys(clist, params);
+    Eigen::VectorXd x;
+    for (int i = 0; i < 2; i++) {
+        ASSERT_TRUE(subsys.solveSparseLDLT(A, b, x));
+        EXPECT_LT((A * x - b).norm(), 1e-12);
+        ASSERT_TRUE(subsys.solveSparseQR(A, b, x));
+        EXPECT_LT((A * x - b).norm(), 1e-12);
+        A *= 2.0;
+    }
+}
+
+TEST_F(SubSystemTest, solveSparse)
+{
+    for (auto alg : {GCS::LevenbergMarquardt, GCS::DogLeg}) {
+        for (int threshold : {0, 100000}) {
+            SCOPED_TRACE(testing::Message() << "algorithm " << alg << ", threshold " << threshold);
+            SetUp();
+            GCS::System system;
+            system.sparseThreshold = threshold;
+            addConstraints(system);
+            system.declareUnknowns(params);
+            system.initSolution(alg);
+            ASSERT_GT(chainError(), 1.0);
+            EXPECT_EQ(system.solve(true, alg), GCS::Success);
+            system.applySolution();
+            EXPECT_LT(chainError(), 1e-6);
+        }
+    }
+}
+
+TEST_F(SubSystemTest, solveSparseLeastNorm)
+{
+    for (auto step : {GCS::LeastNormLdlt, GCS::LeastNormFullPivLU}) {
+        SetUp();
+        GCS::System system;
+        system.sparseThreshold = 0;
+        system.dogLegGaussStep = step;
+        addConstraints(system);
+        system.declareUnknowns(params);
+        system.initSolution(GCS::DogLeg);
+        EXPECT_EQ(system.solve(true, GCS::DogLeg), GCS::Success);
+        system.applySolution();
+        EXPECT_LT(chainError(), 1e-6);
+    }
+}
+TEST_F(SubSystemTest, timeBudgetAndWarmStart)
+{
+    GCS::System system;
+    addConstraints(system);
+    system.declareUnknowns(params);
+    system.initSolution(GCS::DogLeg);
+
+    // no time to get below the coarse tolerance
+    system.DL_maxTime = 1e-9;
+    EXPECT_NE(system.solve(true, GCS::DogLeg), GCS::Success);
+    system.DL_maxTime = 0;
+    EXPECT_EQ(system.solve(true, GCS::DogLeg), GCS::Success);
+    system.applySolution();
+
+    // the next solve starts from the solution, so a tiny budget is enough
+    system.setReference();
+    system.DL_maxTime = 1e-9;
+    EXPECT_EQ(system.solve(true, GCS::DogLeg), GCS::Success);
+    system.applySolution();
+    EXPECT_LT(chainError(), 1e-6);
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
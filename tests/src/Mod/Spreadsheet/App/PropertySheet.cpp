@@ -62,6 +62,20 @@ TEST_F(PropertySheetTest, isValidCellAddressNameInvalidNames)  // NOLINT
     }
 }
 
+TEST_F(PropertySheetTest, isValidCellAddressNameAbsoluteNames)  // NOLINT
+{
+    std::vector<std::string> validAddressNames {"$A1", "A$1", "$ZZ$16384"};
+    for (const auto& name : validAddressNames) {
+        EXPECT_TRUE(propertySheet()->isValidCellAddressName(name))
+            << "\"" << name << "\" was not accepted as a cell name, and should be";
+    }
+    std::vector<std::string> invalidAddressNames {"A0", "A16385", "$$A1", "A1$", "a1", ""};
+    for (const auto& name : invalidAddressNames) {
+        EXPECT_FALSE(propertySheet()->isValidCellAddressName(name))
+            << "\"" << name << "\" was accepted as a cell name, and should not be";
+    }
+}
+
 TEST_F(PropertySheetTest, validAliases)  // NOLINT
 {
     std::vector<std::string> validAliases {"Bork",
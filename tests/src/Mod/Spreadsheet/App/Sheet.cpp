@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/PropertyStandard.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+class SheetTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = static_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet"));
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    Spreadsheet::Sheet* sheet()
+    {
+        return _sheet;
+    }
+
+    long getInteger(const char* address)
+    {
+        auto prop = dynamic_cast<App::PropertyInteger*>(sheet()->getPropertyByName(address));
+        EXPECT_NE(prop, nullptr) << address << " has no integer value";
+        return prop ? prop->getValue() : 0;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(SheetTest, recomputeUpdatesDependents)  // NOLINT
+{
+    // Arrange
+    sheet()->setCell("A1", "1");
+    sheet()->setCell("B1", "=A1 + 1");
+    sheet()->setCell("C1", "=B1 * 2");
+    doc()->recompute();
+
+    // Act
+    sheet()->setCell("A1", "2");
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(getInteger("B1"), 3);
+    EXPECT_EQ(getInteger("C1"), 6);
+}
+
+TEST_F(SheetTest, recomputeStopsAtUnchangedValues)  // NOLINT
+{
+    // Arrange
+    sheet()->setCell("A1", "1");
+    sheet()->setCell("B1", "=A1 * 0");
+    sheet()->setCell("C1", "=B1 + 1");
+    doc()->recompute();
+    int changes = 0;
+    auto connection = sheet()->signalChanged.connect(
+        [&changes](const App::DocumentObject&, const App::Property& prop) {
+            if (std::string(prop.getName()) == "B1" || std::string(prop.getName()) == "C1") {
+                changes++;
+            }
+        });
+
+    // Act
+    sheet()->setCell("A1", "2");
+    doc()->recompute();
+    connection.disconnect();
+
+    // Assert
+    EXPECT_EQ(changes, 0);
+    EXPECT_EQ(getInteger("B1"), 0);
+    EXPECT_EQ(getInteger("C1"), 1);
+}
+
+TEST_F(SheetTest, recomputeAfterErrorUpdatesDependents)  // NOLINT
+{
+    // Arrange
+    sheet()->setCell("A1", "=1 / 0");
+    sheet()->setCell("B1", "=A1 * 2");
+    doc()->recompute();
+
+    // Act
+    sheet()->setCell("A1", "=1");
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(getInteger("A1"), 1);
+    EXPECT_EQ(getInteger("B1"), 2);
+}
+
+TEST_F(SheetTest, setCellsSetsAllCells)  // NOLINT
+{
+    // Arrange
+    std::vector<std::pair<App::CellAddress, std::string>> values {
+        {App::CellAddress("A1"), "2"},
+        {App::CellAddress("A2"), "=A1 * 3"},
+        {App::CellAddress("A3"), "=A2 + A1"},
+    };
+
+    // Act
+    sheet()->setCells(values);
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(getInteger("A1"), 2);
+    EXPECT_EQ(getInteger("A2"), 6);
+    EXPECT_EQ(getInteger("A3"), 8);
+}